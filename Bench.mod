@@ -0,0 +1,54 @@
+MODULE Bench;
+	(* kernels for comparing the bytecode vm with native code *)
+	PROCEDURE GCD(a, b: INTEGER): INTEGER;
+		VAR x, y, t: INTEGER;
+		BEGIN
+			x := a; y := b;
+			WHILE y # 0 DO
+				t := x MOD y;
+				x := y;
+				y := t
+			END;
+		RETURN x
+	END GCD;
+	PROCEDURE Min(a, b: INTEGER): INTEGER;
+		VAR r: INTEGER;
+		BEGIN
+			IF a < b THEN
+				r := a
+			ELSE
+				r := b
+			END;
+		RETURN r
+	END Min;
+	PROCEDURE Sum2(a, b: REAL): REAL;
+		BEGIN
+		RETURN a + b
+	END Sum2;
+	(* sums GCD(i, j) and Min(i, j) over all pairs below n *)
+	PROCEDURE Run(n: INTEGER): INTEGER;
+		VAR i, j, s: INTEGER;
+		BEGIN
+			s := 0; i := 1;
+			WHILE i < n DO
+				j := 1;
+				WHILE j < n DO
+					s := s + GCD(i, j) + Min(i, j);
+					j := j + 1
+				END;
+				i := i + 1
+			END;
+		RETURN s
+	END Run;
+	(* adds up x n times *)
+	PROCEDURE RunReal(n: INTEGER; x: REAL): REAL;
+		VAR i: INTEGER; s: REAL;
+		BEGIN
+			s := 0; i := 0;
+			WHILE i < n DO
+				s := Sum2(s, x);
+				i := i + 1
+			END;
+		RETURN s
+	END RunReal;
+END Bench.
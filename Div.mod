@@ -0,0 +1,19 @@
+MODULE Div;
+	(* the division only runs for positive x, so it must not leave the
+	   loop: the smallest INTEGER DIV -1 overflows *)
+	PROCEDURE P(x, n: INTEGER): INTEGER;
+		VAR i, y: INTEGER;
+	BEGIN
+		i := 0; y := 0;
+		WHILE i < n DO
+			IF x > 0 THEN y := y + x DIV (0 - 1) END;
+			i := i + 1
+		END
+	RETURN y
+	END P;
+	(* the smallest INTEGER DIV -1 wraps around to itself *)
+	PROCEDURE Quot(x: INTEGER): INTEGER;
+	BEGIN RETURN x DIV (0 - 1) END Quot;
+	PROCEDURE Rem(x: INTEGER): INTEGER;
+	BEGIN RETURN x MOD (0 - 1) END Rem;
+END Div.
@@ -0,0 +1,11 @@
+MODULE Real;
+	(* x * 0 and 0 + x must not be folded for REAL x: IEEE gives -0
+	   for -3 * 0, NaN for inf * 0 and +0 for 0 + -0 *)
+	PROCEDURE Times0(x: REAL): REAL;
+	BEGIN RETURN x * 0 END Times0;
+	PROCEDURE Plus0(x: REAL): REAL;
+	BEGIN RETURN 0 + x END Plus0;
+	(* folded from literals once Times0 and Plus0 are inlined *)
+	PROCEDURE One(): REAL;
+	BEGIN RETURN Plus0(Times0(2)) + 1 END One;
+END Real.
@@ -0,0 +1,13 @@
+MODULE Repeat;
+	(* the body runs until the condition holds, and at least once *)
+	PROCEDURE Sum(n: INTEGER): INTEGER;
+		VAR i, s: INTEGER;
+	BEGIN
+		i := 0; s := 0;
+		REPEAT
+			i := i + 1;
+			s := s + i
+		UNTIL i >= n;
+		RETURN s
+	END Sum;
+END Repeat.
@@ -0,0 +1,9 @@
+MODULE Wrap;
+	(* folded INTEGER arithmetic wraps around like the generated code *)
+	PROCEDURE Add(): INTEGER;
+	BEGIN RETURN 2147483647 + 1 END Add;
+	PROCEDURE Neg(): INTEGER;
+	BEGIN RETURN -(0 - 2147483647 - 1) END Neg;
+	PROCEDURE Mul(): INTEGER;
+	BEGIN RETURN 65536 * 65536 END Mul;
+END Wrap.
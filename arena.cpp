@@ -0,0 +1,38 @@
+#include "arena.h"
+
+#include <algorithm>
+
+void *Arena::allocate_slow(size_t size, size_t align) {
+	auto needed { size + align };
+	// reuse blocks left over from a released mark if they are big enough
+	size_t next { cur_ ? block_ + 1 : block_ };
+	while (next < blocks_.size() && blocks_[next].size < needed) { ++next; }
+	if (next >= blocks_.size()) {
+		auto grown { std::min(
+			first_block_size << std::min<size_t>(blocks_.size(), 16),
+			block_size
+		) };
+		auto bytes { std::max(grown, needed) };
+		// not cleared, objects are constructed into the memory
+		blocks_.push_back({
+			std::unique_ptr<char[]> { new char[bytes] }, bytes
+		});
+		next = blocks_.size() - 1;
+	}
+	block_ = next;
+	cur_ = blocks_[block_].data.get();
+	end_ = cur_ + blocks_[block_].size;
+	return allocate(size, align);
+}
+
+void Arena::release(const Mark &mark) {
+	while (cleanups_.size() > mark.cleanups) {
+		auto &c { cleanups_.back() };
+		c.destroy(c.object);
+		cleanups_.pop_back();
+	}
+	block_ = mark.block;
+	cur_ = mark.cur;
+	end_ = cur_ ?
+		blocks_[block_].data.get() + blocks_[block_].size : nullptr;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+// bump allocator that owns the objects created in it; everything
+// created after a mark is destroyed at once when releasing the mark
+class Arena {
+		struct Block {
+			std::unique_ptr<char[]> data;
+			size_t size;
+		};
+		struct Cleanup {
+			void (*destroy)(void *);
+			void *object;
+		};
+
+		// blocks double from the first size up to block_size, so that
+		// the many small arenas of functions stay small
+		static constexpr size_t first_block_size { 1024 };
+		static constexpr size_t block_size { 64 * 1024 };
+		std::vector<Block> blocks_;
+		size_t block_ { 0 };
+		char *cur_ { nullptr };
+		char *end_ { nullptr };
+		std::vector<Cleanup> cleanups_;
+
+		void *allocate_slow(size_t size, size_t align);
+	public:
+		struct Mark {
+			size_t block;
+			char *cur;
+			size_t cleanups;
+		};
+
+		Arena() = default;
+		Arena(const Arena &) = delete;
+		Arena &operator=(const Arena &) = delete;
+		~Arena() { release({ 0, nullptr, 0 }); }
+
+		void *allocate(size_t size, size_t align) {
+			auto p { reinterpret_cast<char *>(
+				(reinterpret_cast<uintptr_t>(cur_) + align - 1) &
+				~(align - 1)
+			) };
+			if (cur_ && p + size <= end_) {
+				cur_ = p + size;
+				return p;
+			}
+			return allocate_slow(size, align);
+		}
+
+		template<typename T, typename... ARGS> T *create(ARGS &&...args) {
+			auto obj { new (allocate(sizeof(T), alignof(T))) T(
+				std::forward<ARGS>(args)...
+			) };
+			if constexpr (! std::is_trivially_destructible_v<T>) {
+				cleanups_.push_back({
+					[](void *p) { static_cast<T *>(p)->~T(); }, obj
+				});
+			}
+			return obj;
+		}
+
+		Mark mark() const { return { block_, cur_, cleanups_.size() }; }
+		void release(const Mark &mark);
+};
+
+class Arena_Scope {
+		Arena &arena_;
+		Arena::Mark mark_;
+	public:
+		Arena_Scope(Arena &arena): arena_ { arena }, mark_ { arena.mark() } { }
+		~Arena_Scope() { arena_.release(mark_); }
+};
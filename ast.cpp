@@ -0,0 +1,95 @@
+#include "ast.h"
+
+namespace {
+	template<typename T> std::uint32_t push(
+		std::vector<T> &nodes, const T &node
+	) {
+		nodes.push_back(node);
+		return static_cast<std::uint32_t>(nodes.size() - 1);
+	}
+
+	// nested nodes are added while the outer ones are parsed, so the
+	// children of a node are collected first and appended at once
+	template<typename T> Node_Range append(
+		std::vector<T> &nodes, const std::vector<T> &added
+	) {
+		Node_Range range {
+			static_cast<std::uint32_t>(nodes.size()),
+			static_cast<std::uint32_t>(added.size())
+		};
+		nodes.insert(nodes.end(), added.begin(), added.end());
+		return range;
+	}
+}
+
+Expr Ast::add_literal(Literal::Ptr literal) {
+	return { Expr_Kind::literal, push(literals_, literal) };
+}
+
+Expr Ast::add_variable(Variable::Ptr variable) {
+	return { Expr_Kind::variable, push(variables_, variable) };
+}
+
+Expr Ast::add_plus(Expr operand) {
+	return { Expr_Kind::plus, push(pluses_, operand) };
+}
+
+Expr Ast::add_unary(Unary_Op op, Expr operand) {
+	return { Expr_Kind::unary, push(unaries_, { op, operand }) };
+}
+
+Expr Ast::add_binary(Binary_Op op, Expr left, Expr right) {
+	return { Expr_Kind::binary, push(binaries_, { op, left, right }) };
+}
+
+Expr Ast::add_call(
+	Procedure::Ptr procedure, const std::vector<Expr> &arguments
+) {
+	auto range { append(arguments_, arguments) };
+	return { Expr_Kind::call, push(calls_, { procedure, range }) };
+}
+
+Node_Range Ast::add_sequence(const std::vector<Stmt> &statements) {
+	return append(statements_, statements);
+}
+
+Stmt Ast::add_assign(Variable::Ptr target, Expr value, int line) {
+	return { Stmt_Kind::assign, push(assigns_, { target, value }), line };
+}
+
+Stmt Ast::add_call_statement(Expr call, int line) {
+	return { Stmt_Kind::call, call.index, line };
+}
+
+Stmt Ast::add_if(
+	const std::vector<Branch_Node> &branches, Node_Range otherwise,
+	int line
+) {
+	If_Node node { append(branches_, branches), otherwise };
+	return { Stmt_Kind::if_, push(ifs_, node), line };
+}
+
+Stmt Ast::add_while(const std::vector<Branch_Node> &branches, int line) {
+	auto range { append(branches_, branches) };
+	return { Stmt_Kind::while_, push(whiles_, range), line };
+}
+
+Stmt Ast::add_repeat(Node_Range body, Expr condition, int line) {
+	return { Stmt_Kind::repeat, push(repeats_, { body, condition }), line };
+}
+
+void Ast::clear() {
+	literals_.clear();
+	variables_.clear();
+	pluses_.clear();
+	unaries_.clear();
+	binaries_.clear();
+	calls_.clear();
+	arguments_.clear();
+	statements_.clear();
+	assigns_.clear();
+	branches_.clear();
+	ifs_.clear();
+	whiles_.clear();
+	repeats_.clear();
+}
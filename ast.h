@@ -0,0 +1,167 @@
+#pragma once
+
+#include "err.h"
+#include "fold.h"
+#include "obj.h"
+
+#include <cstdint>
+#include <vector>
+
+// the statements of a procedure or module body as a tree; every kind
+// of node has its own array and children are indices into them, so
+// the passes can walk a tree as often as they need
+
+enum class Expr_Kind: std::uint8_t {
+	literal, variable, plus, unary, binary, call
+};
+
+struct Expr {
+	Expr_Kind kind { Expr_Kind::literal };
+	std::uint32_t index { 0 };
+};
+
+enum class Stmt_Kind: std::uint8_t { assign, call, if_, while_, repeat };
+
+// errors in a statement are reported at its first line
+struct Stmt {
+	Stmt_Kind kind;
+	std::uint32_t index;
+	int line;
+};
+
+// consecutive entries of one array
+struct Node_Range {
+	std::uint32_t first { 0 };
+	std::uint32_t count { 0 };
+};
+
+struct Unary_Node {
+	Unary_Op op;
+	Expr operand;
+};
+
+// & and OR are binary nodes that only evaluate the right operand if
+// the left one does not decide the result
+struct Binary_Node {
+	Binary_Op op;
+	Expr left;
+	Expr right;
+};
+
+// VAR arguments are variable nodes
+struct Call_Node {
+	Procedure::Ptr procedure;
+	Node_Range arguments;
+};
+
+struct Assign_Node {
+	Variable::Ptr target;
+	Expr value;
+};
+
+// a condition and the statements it guards, one per IF or ELSIF
+struct Branch_Node {
+	Expr condition;
+	Node_Range body;
+	int line;
+};
+
+struct If_Node {
+	Node_Range branches;
+	Node_Range otherwise;
+};
+
+struct Repeat_Node {
+	Node_Range body;
+	Expr condition;
+};
+
+// the local variables are allocated when the body is generated
+struct Body {
+	std::vector<Variable::Ptr> locals;
+	Node_Range statements;
+	bool has_result { false };
+	Expr result;
+	int result_line { 0 };
+};
+
+class Ast {
+		std::vector<Literal::Ptr> literals_;
+		std::vector<Variable::Ptr> variables_;
+		std::vector<Expr> pluses_;
+		std::vector<Unary_Node> unaries_;
+		std::vector<Binary_Node> binaries_;
+		std::vector<Call_Node> calls_;
+		std::vector<Expr> arguments_;
+		std::vector<Stmt> statements_;
+		std::vector<Assign_Node> assigns_;
+		std::vector<Branch_Node> branches_;
+		std::vector<If_Node> ifs_;
+		std::vector<Node_Range> whiles_;
+		std::vector<Repeat_Node> repeats_;
+	public:
+		Expr add_literal(Literal::Ptr literal);
+		Expr add_variable(Variable::Ptr variable);
+		Expr add_plus(Expr operand);
+		Expr add_unary(Unary_Op op, Expr operand);
+		Expr add_binary(Binary_Op op, Expr left, Expr right);
+		Expr add_call(
+			Procedure::Ptr procedure, const std::vector<Expr> &arguments
+		);
+		Node_Range add_sequence(const std::vector<Stmt> &statements);
+		Stmt add_assign(Variable::Ptr target, Expr value, int line);
+		Stmt add_call_statement(Expr call, int line);
+		Stmt add_if(
+			const std::vector<Branch_Node> &branches,
+			Node_Range otherwise, int line
+		);
+		Stmt add_while(const std::vector<Branch_Node> &branches, int line);
+		Stmt add_repeat(Node_Range body, Expr condition, int line);
+
+		// drops all nodes once the code of a body is generated
+		void clear();
+
+		Literal::Ptr literal(Expr e) const { return literals_[e.index]; }
+		Variable::Ptr variable(Expr e) const {
+			return variables_[e.index];
+		}
+		Expr plus(Expr e) const { return pluses_[e.index]; }
+		const Unary_Node &unary(Expr e) const { return unaries_[e.index]; }
+		const Binary_Node &binary(Expr e) const {
+			return binaries_[e.index];
+		}
+		const Call_Node &call(Expr e) const { return calls_[e.index]; }
+		Expr argument(std::uint32_t i) const { return arguments_[i]; }
+
+		const Stmt &statement(std::uint32_t i) const {
+			return statements_[i];
+		}
+		const Assign_Node &assign(const Stmt &s) const {
+			return assigns_[s.index];
+		}
+		const Call_Node &call(const Stmt &s) const {
+			return calls_[s.index];
+		}
+		const Branch_Node &branch(std::uint32_t i) const {
+			return branches_[i];
+		}
+		const If_Node &if_statement(const Stmt &s) const {
+			return ifs_[s.index];
+		}
+		Node_Range while_statement(const Stmt &s) const {
+			return whiles_[s.index];
+		}
+		const Repeat_Node &repeat(const Stmt &s) const {
+			return repeats_[s.index];
+		}
+};
+
+// runs a pass over one node and reports its errors at the line
+template<typename F> void at_line(int line, F &&f) {
+	try {
+		f();
+	} catch (Error &e) {
+		e.set_line(line);
+		throw;
+	}
+}
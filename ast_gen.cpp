@@ -0,0 +1,267 @@
+#include "ast_gen.h"
+
+namespace {
+	Value::Ptr propagate_to_real(Constant_Pool &pool, Value::Ptr v) {
+		if (v->type() == real_type) { return v; }
+		if (auto i { value_cast<Integer_Literal>(v) }) {
+			return pool.get(static_cast<double>(i->value()));
+		}
+		throw Error { "cannot cast integer to REAL" }; // TODO
+	}
+}
+
+Value::Ptr Ast_Gen::expression(Expr e) {
+	switch (e.kind) {
+		case Expr_Kind::literal:
+			return ast_.literal(e);
+		case Expr_Kind::variable: {
+			auto var { ast_.variable(e) };
+			if (! var->with_load()) { return var->ref(); }
+			auto r { result(var->type()) };
+			gen_.load(r, var->ref());
+			return r;
+		}
+		case Expr_Kind::plus:
+			return expression(ast_.plus(e));
+		case Expr_Kind::unary: {
+			auto &node { ast_.unary(e) };
+			return unary(node.op, expression(node.operand));
+		}
+		case Expr_Kind::binary: {
+			auto &node { ast_.binary(e) };
+			if (
+				node.op == Binary_Op::log_and || node.op == Binary_Op::log_or
+			) {
+				return conditional(node);
+			}
+			return binary(node);
+		}
+		case Expr_Kind::call:
+			return call(ast_.call(e));
+	}
+	return nullptr;
+}
+
+Value::Ptr Ast_Gen::unary(Unary_Op op, Value::Ptr value) {
+	if (auto folded { fold(pool_, op, value) }) { return folded; }
+	auto r { result(value->type()) };
+	gen_.unary(r, op, value);
+	return r;
+}
+
+Value::Ptr Ast_Gen::binary(const Binary_Node &node) {
+	auto left { expression(node.left) };
+	auto right { expression(node.right) };
+	auto t { operand_type(node.op, left, right) };
+	if (t == real_type) {
+		left = propagate_to_real(pool_, left);
+		right = propagate_to_real(pool_, right);
+	}
+	if (auto folded { fold(pool_, node.op, left, right) }) {
+		return folded;
+	}
+	auto r { result(
+		binary_operator(node.op).predicate ? boolean_type : t
+	) };
+	gen_.binary(r, node.op, left, right);
+	return r;
+}
+
+// both values meet in a phi at the end label; a constant left operand
+// that decides the result leaves the right one out
+Value::Ptr Ast_Gen::conditional(const Binary_Node &node) {
+	bool is_or { node.op == Binary_Op::log_or };
+	auto left { expression(node.left) };
+	if (auto lb { value_cast<Bool_Literal>(left) }) {
+		if (lb->value() == is_or) { return left; }
+		return expression(node.right);
+	}
+
+	auto id { is_or ? gen_.next_or_id() : gen_.next_and_id() };
+	Label alt { is_or ? "or_alt_" : "and_alt_", id };
+	Label end { is_or ? "or_end_" : "and_end_", id };
+	auto from { current_label_ };
+	if (is_or) {
+		gen_.conditional(left, end, alt);
+	} else {
+		gen_.conditional(left, alt, end);
+	}
+	def_label(alt);
+	auto right { expression(node.right) };
+	auto right_from { current_label_ };
+	gen_.branch(end);
+	def_label(end);
+	auto r { result(boolean_type) };
+	gen_.phi(r, { { left, from }, { right, right_from } });
+	return r;
+}
+
+Value::Ptr Ast_Gen::call(const Call_Node &node) {
+	auto procedure { node.procedure };
+	std::vector<Argument> args;
+	auto formal { procedure->args_begin() };
+	for (std::uint32_t i { 0 }; i < node.arguments.count; ++i, ++formal) {
+		auto arg { ast_.argument(node.arguments.first + i) };
+		if ((**formal).is_var()) {
+			args.push_back({ ast_.variable(arg)->ref(), true });
+			continue;
+		}
+		auto value { expression(arg) };
+		if ((**formal).type() == real_type) {
+			value = propagate_to_real(pool_, value);
+		}
+		args.push_back({ value, false });
+	}
+	Reference::Ptr r { nullptr };
+	if (auto returns { procedure->returns() }) { r = result(returns); }
+	gen_.call(r, procedure->parent()->mangle(procedure->symbol()), args);
+	return r;
+}
+
+// each condition jumps to its statements or to the next condition; the
+// statements continue at after
+void Ast_Gen::branches(
+	const char *cond, const char *body, int id, Node_Range list,
+	const Label &after
+) {
+	for (int alt { 0 }; alt < static_cast<int>(list.count); ++alt) {
+		auto &branch { ast_.branch(list.first + alt) };
+		Value::Ptr value { nullptr };
+		at_line(branch.line, [&] { value = expression(branch.condition); });
+		gen_.conditional(value, { body, id, alt }, { cond, id, alt + 1 });
+		def_label({ body, id, alt });
+		statements(branch.body);
+		gen_.branch(after);
+		def_label({ cond, id, alt + 1 });
+	}
+}
+
+void Ast_Gen::statement(const Stmt &stmt) {
+	switch (stmt.kind) {
+		case Stmt_Kind::assign: {
+			auto &node { ast_.assign(stmt) };
+			auto value { expression(node.value) };
+			if (node.target->type() == real_type) {
+				value = propagate_to_real(pool_, value);
+			}
+			gen_.store(value, node.target->ref());
+			break;
+		}
+		case Stmt_Kind::call:
+			call(ast_.call(stmt));
+			break;
+		case Stmt_Kind::if_: {
+			auto &node { ast_.if_statement(stmt) };
+			auto id { gen_.next_if_id() };
+			gen_.branch({ "if_cond_", id, 0 });
+			def_label({ "if_cond_", id, 0 });
+			branches(
+				"if_cond_", "if_body_", id, node.branches, { "if_end_", id }
+			);
+			statements(node.otherwise);
+			gen_.branch({ "if_end_", id });
+			def_label({ "if_end_", id });
+			break;
+		}
+		case Stmt_Kind::while_: {
+			auto id { gen_.next_while_id() };
+			gen_.branch({ "while_cond_", id, 0 });
+			def_label({ "while_cond_", id, 0 });
+			branches(
+				"while_cond_", "while_body_", id, ast_.while_statement(stmt),
+				{ "while_cond_", id, 0 }
+			);
+			break;
+		}
+		case Stmt_Kind::repeat: {
+			auto &node { ast_.repeat(stmt) };
+			auto id { gen_.next_repeat_id() };
+			gen_.branch({ "repeat_body_", id });
+			def_label({ "repeat_body_", id });
+			statements(node.body);
+			gen_.conditional(
+				expression(node.condition), { "repeat_end_", id },
+				{ "repeat_body_", id }
+			);
+			def_label({ "repeat_end_", id });
+			break;
+		}
+	}
+}
+
+void Ast_Gen::statements(Node_Range list) {
+	for (std::uint32_t i { 0 }; i < list.count; ++i) {
+		auto &stmt { ast_.statement(list.first + i) };
+		at_line(stmt.line, [&] { statement(stmt); });
+	}
+}
+
+void Ast_Gen::body(const Body &body, Type::Ptr returns) {
+	for (auto var : body.locals) { gen_.alloca(var->ref()); }
+	statements(body.statements);
+	if (! body.has_result) {
+		gen_.ret();
+		return;
+	}
+	at_line(body.result_line, [&] {
+		auto value { expression(body.result) };
+		if (returns == real_type) {
+			value = propagate_to_real(pool_, value);
+		}
+		gen_.ret(value);
+	});
+}
+
+void Ast_Gen::globals(const std::vector<Variable::Ptr> &variables) {
+	for (auto var : variables) { gen_.alloca(var->ref()); }
+}
+
+void Ast_Gen::procedure(
+	Procedure::Ptr decl, bool inline_hint, const Body &body
+) {
+	gen_.reset();
+	std::vector<Parameter> params;
+	for (
+		auto i { decl->args_begin() }, e { decl->args_end() };
+		i != e; ++i
+	) {
+		params.push_back({ (**i).ref(), (**i).is_var() });
+	}
+	gen_.define(
+		decl->parent()->mangle(decl->symbol()), decl->returns(), params,
+		inline_hint
+	);
+	def_label({ "entry" });
+	// value parameters are local variables set to the argument
+	for (
+		auto i { decl->args_begin() }, e { decl->args_end() };
+		i != e; ++i
+	) {
+		if ((**i).is_var()) { continue; }
+		auto local { result((**i).type()) };
+		gen_.alloca(local);
+		gen_.store((**i).ref(), local);
+		(**i).set_ref(local);
+	}
+	this->body(body, decl->returns());
+	gen_.end_define();
+	// the locals die with the arena, callers still check their
+	// arguments against the formal types
+	auto param { params.begin() };
+	for (
+		auto i { decl->args_begin() }, e { decl->args_end() };
+		i != e; ++i, ++param
+	) {
+		(**i).set_ref(param->ref);
+	}
+}
+
+void Ast_Gen::module(Module::Ptr mod, const Body &body) {
+	gen_.reset();
+	gen_.define(
+		mod->mangle(Symbol::intern("_init")), nullptr, { }, false
+	);
+	def_label({ "entry" });
+	this->body(body, nullptr);
+	gen_.end_define();
+}
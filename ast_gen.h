@@ -0,0 +1,49 @@
+#pragma once
+
+#include "ast.h"
+#include "gen.h"
+
+// generates code for a checked tree by driving a Gen; operations on
+// constants are folded on the way and the values of the generated
+// code are created in the arena
+class Ast_Gen {
+		const Ast &ast_;
+		Gen &gen_;
+		Constant_Pool &pool_;
+		Arena &arena_;
+		Label current_label_ { "entry" };
+
+		// remembers the block that code is generated into
+		void def_label(const Label &label) {
+			current_label_ = label;
+			gen_.def_label(label);
+		}
+
+		Reference::Ptr result(Type::Ptr type) {
+			return Reference::create(arena_, gen_.next_id(), type);
+		}
+
+		Value::Ptr unary(Unary_Op op, Value::Ptr value);
+		Value::Ptr binary(const Binary_Node &node);
+		Value::Ptr conditional(const Binary_Node &node);
+		// the result is nullptr for proper procedures
+		Value::Ptr call(const Call_Node &node);
+		void branches(
+			const char *cond, const char *body, int id, Node_Range list,
+			const Label &after
+		);
+		void statement(const Stmt &stmt);
+		void statements(Node_Range list);
+		void body(const Body &body, Type::Ptr returns);
+	public:
+		Ast_Gen(const Ast &ast, Gen &gen, Constant_Pool &pool, Arena &arena):
+			ast_ { ast }, gen_ { gen }, pool_ { pool }, arena_ { arena }
+		{ }
+
+		Value::Ptr expression(Expr e);
+		void globals(const std::vector<Variable::Ptr> &variables);
+		void procedure(
+			Procedure::Ptr decl, bool inline_hint, const Body &body
+		);
+		void module(Module::Ptr mod, const Body &body);
+};
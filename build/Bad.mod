@@ -0,0 +1,3 @@
+MODULE Bad; PROCEDURE P(): INTEGER;
+BEGIN RETURN TRUE END P;
+END Bad.
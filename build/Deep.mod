@@ -0,0 +1,20002 @@
+MODULE Deep; PROCEDURE P(x: INTEGER): INTEGER; BEGIN
+IF x > 0 THEN x := x - 1 END;
+IF x > 1 THEN x := x - 1 END;
+IF x > 2 THEN x := x - 1 END;
+IF x > 3 THEN x := x - 1 END;
+IF x > 4 THEN x := x - 1 END;
+IF x > 5 THEN x := x - 1 END;
+IF x > 6 THEN x := x - 1 END;
+IF x > 7 THEN x := x - 1 END;
+IF x > 8 THEN x := x - 1 END;
+IF x > 9 THEN x := x - 1 END;
+IF x > 10 THEN x := x - 1 END;
+IF x > 11 THEN x := x - 1 END;
+IF x > 12 THEN x := x - 1 END;
+IF x > 13 THEN x := x - 1 END;
+IF x > 14 THEN x := x - 1 END;
+IF x > 15 THEN x := x - 1 END;
+IF x > 16 THEN x := x - 1 END;
+IF x > 17 THEN x := x - 1 END;
+IF x > 18 THEN x := x - 1 END;
+IF x > 19 THEN x := x - 1 END;
+IF x > 20 THEN x := x - 1 END;
+IF x > 21 THEN x := x - 1 END;
+IF x > 22 THEN x := x - 1 END;
+IF x > 23 THEN x := x - 1 END;
+IF x > 24 THEN x := x - 1 END;
+IF x > 25 THEN x := x - 1 END;
+IF x > 26 THEN x := x - 1 END;
+IF x > 27 THEN x := x - 1 END;
+IF x > 28 THEN x := x - 1 END;
+IF x > 29 THEN x := x - 1 END;
+IF x > 30 THEN x := x - 1 END;
+IF x > 31 THEN x := x - 1 END;
+IF x > 32 THEN x := x - 1 END;
+IF x > 33 THEN x := x - 1 END;
+IF x > 34 THEN x := x - 1 END;
+IF x > 35 THEN x := x - 1 END;
+IF x > 36 THEN x := x - 1 END;
+IF x > 37 THEN x := x - 1 END;
+IF x > 38 THEN x := x - 1 END;
+IF x > 39 THEN x := x - 1 END;
+IF x > 40 THEN x := x - 1 END;
+IF x > 41 THEN x := x - 1 END;
+IF x > 42 THEN x := x - 1 END;
+IF x > 43 THEN x := x - 1 END;
+IF x > 44 THEN x := x - 1 END;
+IF x > 45 THEN x := x - 1 END;
+IF x > 46 THEN x := x - 1 END;
+IF x > 47 THEN x := x - 1 END;
+IF x > 48 THEN x := x - 1 END;
+IF x > 49 THEN x := x - 1 END;
+IF x > 50 THEN x := x - 1 END;
+IF x > 51 THEN x := x - 1 END;
+IF x > 52 THEN x := x - 1 END;
+IF x > 53 THEN x := x - 1 END;
+IF x > 54 THEN x := x - 1 END;
+IF x > 55 THEN x := x - 1 END;
+IF x > 56 THEN x := x - 1 END;
+IF x > 57 THEN x := x - 1 END;
+IF x > 58 THEN x := x - 1 END;
+IF x > 59 THEN x := x - 1 END;
+IF x > 60 THEN x := x - 1 END;
+IF x > 61 THEN x := x - 1 END;
+IF x > 62 THEN x := x - 1 END;
+IF x > 63 THEN x := x - 1 END;
+IF x > 64 THEN x := x - 1 END;
+IF x > 65 THEN x := x - 1 END;
+IF x > 66 THEN x := x - 1 END;
+IF x > 67 THEN x := x - 1 END;
+IF x > 68 THEN x := x - 1 END;
+IF x > 69 THEN x := x - 1 END;
+IF x > 70 THEN x := x - 1 END;
+IF x > 71 THEN x := x - 1 END;
+IF x > 72 THEN x := x - 1 END;
+IF x > 73 THEN x := x - 1 END;
+IF x > 74 THEN x := x - 1 END;
+IF x > 75 THEN x := x - 1 END;
+IF x > 76 THEN x := x - 1 END;
+IF x > 77 THEN x := x - 1 END;
+IF x > 78 THEN x := x - 1 END;
+IF x > 79 THEN x := x - 1 END;
+IF x > 80 THEN x := x - 1 END;
+IF x > 81 THEN x := x - 1 END;
+IF x > 82 THEN x := x - 1 END;
+IF x > 83 THEN x := x - 1 END;
+IF x > 84 THEN x := x - 1 END;
+IF x > 85 THEN x := x - 1 END;
+IF x > 86 THEN x := x - 1 END;
+IF x > 87 THEN x := x - 1 END;
+IF x > 88 THEN x := x - 1 END;
+IF x > 89 THEN x := x - 1 END;
+IF x > 90 THEN x := x - 1 END;
+IF x > 91 THEN x := x - 1 END;
+IF x > 92 THEN x := x - 1 END;
+IF x > 93 THEN x := x - 1 END;
+IF x > 94 THEN x := x - 1 END;
+IF x > 95 THEN x := x - 1 END;
+IF x > 96 THEN x := x - 1 END;
+IF x > 97 THEN x := x - 1 END;
+IF x > 98 THEN x := x - 1 END;
+IF x > 99 THEN x := x - 1 END;
+IF x > 100 THEN x := x - 1 END;
+IF x > 101 THEN x := x - 1 END;
+IF x > 102 THEN x := x - 1 END;
+IF x > 103 THEN x := x - 1 END;
+IF x > 104 THEN x := x - 1 END;
+IF x > 105 THEN x := x - 1 END;
+IF x > 106 THEN x := x - 1 END;
+IF x > 107 THEN x := x - 1 END;
+IF x > 108 THEN x := x - 1 END;
+IF x > 109 THEN x := x - 1 END;
+IF x > 110 THEN x := x - 1 END;
+IF x > 111 THEN x := x - 1 END;
+IF x > 112 THEN x := x - 1 END;
+IF x > 113 THEN x := x - 1 END;
+IF x > 114 THEN x := x - 1 END;
+IF x > 115 THEN x := x - 1 END;
+IF x > 116 THEN x := x - 1 END;
+IF x > 117 THEN x := x - 1 END;
+IF x > 118 THEN x := x - 1 END;
+IF x > 119 THEN x := x - 1 END;
+IF x > 120 THEN x := x - 1 END;
+IF x > 121 THEN x := x - 1 END;
+IF x > 122 THEN x := x - 1 END;
+IF x > 123 THEN x := x - 1 END;
+IF x > 124 THEN x := x - 1 END;
+IF x > 125 THEN x := x - 1 END;
+IF x > 126 THEN x := x - 1 END;
+IF x > 127 THEN x := x - 1 END;
+IF x > 128 THEN x := x - 1 END;
+IF x > 129 THEN x := x - 1 END;
+IF x > 130 THEN x := x - 1 END;
+IF x > 131 THEN x := x - 1 END;
+IF x > 132 THEN x := x - 1 END;
+IF x > 133 THEN x := x - 1 END;
+IF x > 134 THEN x := x - 1 END;
+IF x > 135 THEN x := x - 1 END;
+IF x > 136 THEN x := x - 1 END;
+IF x > 137 THEN x := x - 1 END;
+IF x > 138 THEN x := x - 1 END;
+IF x > 139 THEN x := x - 1 END;
+IF x > 140 THEN x := x - 1 END;
+IF x > 141 THEN x := x - 1 END;
+IF x > 142 THEN x := x - 1 END;
+IF x > 143 THEN x := x - 1 END;
+IF x > 144 THEN x := x - 1 END;
+IF x > 145 THEN x := x - 1 END;
+IF x > 146 THEN x := x - 1 END;
+IF x > 147 THEN x := x - 1 END;
+IF x > 148 THEN x := x - 1 END;
+IF x > 149 THEN x := x - 1 END;
+IF x > 150 THEN x := x - 1 END;
+IF x > 151 THEN x := x - 1 END;
+IF x > 152 THEN x := x - 1 END;
+IF x > 153 THEN x := x - 1 END;
+IF x > 154 THEN x := x - 1 END;
+IF x > 155 THEN x := x - 1 END;
+IF x > 156 THEN x := x - 1 END;
+IF x > 157 THEN x := x - 1 END;
+IF x > 158 THEN x := x - 1 END;
+IF x > 159 THEN x := x - 1 END;
+IF x > 160 THEN x := x - 1 END;
+IF x > 161 THEN x := x - 1 END;
+IF x > 162 THEN x := x - 1 END;
+IF x > 163 THEN x := x - 1 END;
+IF x > 164 THEN x := x - 1 END;
+IF x > 165 THEN x := x - 1 END;
+IF x > 166 THEN x := x - 1 END;
+IF x > 167 THEN x := x - 1 END;
+IF x > 168 THEN x := x - 1 END;
+IF x > 169 THEN x := x - 1 END;
+IF x > 170 THEN x := x - 1 END;
+IF x > 171 THEN x := x - 1 END;
+IF x > 172 THEN x := x - 1 END;
+IF x > 173 THEN x := x - 1 END;
+IF x > 174 THEN x := x - 1 END;
+IF x > 175 THEN x := x - 1 END;
+IF x > 176 THEN x := x - 1 END;
+IF x > 177 THEN x := x - 1 END;
+IF x > 178 THEN x := x - 1 END;
+IF x > 179 THEN x := x - 1 END;
+IF x > 180 THEN x := x - 1 END;
+IF x > 181 THEN x := x - 1 END;
+IF x > 182 THEN x := x - 1 END;
+IF x > 183 THEN x := x - 1 END;
+IF x > 184 THEN x := x - 1 END;
+IF x > 185 THEN x := x - 1 END;
+IF x > 186 THEN x := x - 1 END;
+IF x > 187 THEN x := x - 1 END;
+IF x > 188 THEN x := x - 1 END;
+IF x > 189 THEN x := x - 1 END;
+IF x > 190 THEN x := x - 1 END;
+IF x > 191 THEN x := x - 1 END;
+IF x > 192 THEN x := x - 1 END;
+IF x > 193 THEN x := x - 1 END;
+IF x > 194 THEN x := x - 1 END;
+IF x > 195 THEN x := x - 1 END;
+IF x > 196 THEN x := x - 1 END;
+IF x > 197 THEN x := x - 1 END;
+IF x > 198 THEN x := x - 1 END;
+IF x > 199 THEN x := x - 1 END;
+IF x > 200 THEN x := x - 1 END;
+IF x > 201 THEN x := x - 1 END;
+IF x > 202 THEN x := x - 1 END;
+IF x > 203 THEN x := x - 1 END;
+IF x > 204 THEN x := x - 1 END;
+IF x > 205 THEN x := x - 1 END;
+IF x > 206 THEN x := x - 1 END;
+IF x > 207 THEN x := x - 1 END;
+IF x > 208 THEN x := x - 1 END;
+IF x > 209 THEN x := x - 1 END;
+IF x > 210 THEN x := x - 1 END;
+IF x > 211 THEN x := x - 1 END;
+IF x > 212 THEN x := x - 1 END;
+IF x > 213 THEN x := x - 1 END;
+IF x > 214 THEN x := x - 1 END;
+IF x > 215 THEN x := x - 1 END;
+IF x > 216 THEN x := x - 1 END;
+IF x > 217 THEN x := x - 1 END;
+IF x > 218 THEN x := x - 1 END;
+IF x > 219 THEN x := x - 1 END;
+IF x > 220 THEN x := x - 1 END;
+IF x > 221 THEN x := x - 1 END;
+IF x > 222 THEN x := x - 1 END;
+IF x > 223 THEN x := x - 1 END;
+IF x > 224 THEN x := x - 1 END;
+IF x > 225 THEN x := x - 1 END;
+IF x > 226 THEN x := x - 1 END;
+IF x > 227 THEN x := x - 1 END;
+IF x > 228 THEN x := x - 1 END;
+IF x > 229 THEN x := x - 1 END;
+IF x > 230 THEN x := x - 1 END;
+IF x > 231 THEN x := x - 1 END;
+IF x > 232 THEN x := x - 1 END;
+IF x > 233 THEN x := x - 1 END;
+IF x > 234 THEN x := x - 1 END;
+IF x > 235 THEN x := x - 1 END;
+IF x > 236 THEN x := x - 1 END;
+IF x > 237 THEN x := x - 1 END;
+IF x > 238 THEN x := x - 1 END;
+IF x > 239 THEN x := x - 1 END;
+IF x > 240 THEN x := x - 1 END;
+IF x > 241 THEN x := x - 1 END;
+IF x > 242 THEN x := x - 1 END;
+IF x > 243 THEN x := x - 1 END;
+IF x > 244 THEN x := x - 1 END;
+IF x > 245 THEN x := x - 1 END;
+IF x > 246 THEN x := x - 1 END;
+IF x > 247 THEN x := x - 1 END;
+IF x > 248 THEN x := x - 1 END;
+IF x > 249 THEN x := x - 1 END;
+IF x > 250 THEN x := x - 1 END;
+IF x > 251 THEN x := x - 1 END;
+IF x > 252 THEN x := x - 1 END;
+IF x > 253 THEN x := x - 1 END;
+IF x > 254 THEN x := x - 1 END;
+IF x > 255 THEN x := x - 1 END;
+IF x > 256 THEN x := x - 1 END;
+IF x > 257 THEN x := x - 1 END;
+IF x > 258 THEN x := x - 1 END;
+IF x > 259 THEN x := x - 1 END;
+IF x > 260 THEN x := x - 1 END;
+IF x > 261 THEN x := x - 1 END;
+IF x > 262 THEN x := x - 1 END;
+IF x > 263 THEN x := x - 1 END;
+IF x > 264 THEN x := x - 1 END;
+IF x > 265 THEN x := x - 1 END;
+IF x > 266 THEN x := x - 1 END;
+IF x > 267 THEN x := x - 1 END;
+IF x > 268 THEN x := x - 1 END;
+IF x > 269 THEN x := x - 1 END;
+IF x > 270 THEN x := x - 1 END;
+IF x > 271 THEN x := x - 1 END;
+IF x > 272 THEN x := x - 1 END;
+IF x > 273 THEN x := x - 1 END;
+IF x > 274 THEN x := x - 1 END;
+IF x > 275 THEN x := x - 1 END;
+IF x > 276 THEN x := x - 1 END;
+IF x > 277 THEN x := x - 1 END;
+IF x > 278 THEN x := x - 1 END;
+IF x > 279 THEN x := x - 1 END;
+IF x > 280 THEN x := x - 1 END;
+IF x > 281 THEN x := x - 1 END;
+IF x > 282 THEN x := x - 1 END;
+IF x > 283 THEN x := x - 1 END;
+IF x > 284 THEN x := x - 1 END;
+IF x > 285 THEN x := x - 1 END;
+IF x > 286 THEN x := x - 1 END;
+IF x > 287 THEN x := x - 1 END;
+IF x > 288 THEN x := x - 1 END;
+IF x > 289 THEN x := x - 1 END;
+IF x > 290 THEN x := x - 1 END;
+IF x > 291 THEN x := x - 1 END;
+IF x > 292 THEN x := x - 1 END;
+IF x > 293 THEN x := x - 1 END;
+IF x > 294 THEN x := x - 1 END;
+IF x > 295 THEN x := x - 1 END;
+IF x > 296 THEN x := x - 1 END;
+IF x > 297 THEN x := x - 1 END;
+IF x > 298 THEN x := x - 1 END;
+IF x > 299 THEN x := x - 1 END;
+IF x > 300 THEN x := x - 1 END;
+IF x > 301 THEN x := x - 1 END;
+IF x > 302 THEN x := x - 1 END;
+IF x > 303 THEN x := x - 1 END;
+IF x > 304 THEN x := x - 1 END;
+IF x > 305 THEN x := x - 1 END;
+IF x > 306 THEN x := x - 1 END;
+IF x > 307 THEN x := x - 1 END;
+IF x > 308 THEN x := x - 1 END;
+IF x > 309 THEN x := x - 1 END;
+IF x > 310 THEN x := x - 1 END;
+IF x > 311 THEN x := x - 1 END;
+IF x > 312 THEN x := x - 1 END;
+IF x > 313 THEN x := x - 1 END;
+IF x > 314 THEN x := x - 1 END;
+IF x > 315 THEN x := x - 1 END;
+IF x > 316 THEN x := x - 1 END;
+IF x > 317 THEN x := x - 1 END;
+IF x > 318 THEN x := x - 1 END;
+IF x > 319 THEN x := x - 1 END;
+IF x > 320 THEN x := x - 1 END;
+IF x > 321 THEN x := x - 1 END;
+IF x > 322 THEN x := x - 1 END;
+IF x > 323 THEN x := x - 1 END;
+IF x > 324 THEN x := x - 1 END;
+IF x > 325 THEN x := x - 1 END;
+IF x > 326 THEN x := x - 1 END;
+IF x > 327 THEN x := x - 1 END;
+IF x > 328 THEN x := x - 1 END;
+IF x > 329 THEN x := x - 1 END;
+IF x > 330 THEN x := x - 1 END;
+IF x > 331 THEN x := x - 1 END;
+IF x > 332 THEN x := x - 1 END;
+IF x > 333 THEN x := x - 1 END;
+IF x > 334 THEN x := x - 1 END;
+IF x > 335 THEN x := x - 1 END;
+IF x > 336 THEN x := x - 1 END;
+IF x > 337 THEN x := x - 1 END;
+IF x > 338 THEN x := x - 1 END;
+IF x > 339 THEN x := x - 1 END;
+IF x > 340 THEN x := x - 1 END;
+IF x > 341 THEN x := x - 1 END;
+IF x > 342 THEN x := x - 1 END;
+IF x > 343 THEN x := x - 1 END;
+IF x > 344 THEN x := x - 1 END;
+IF x > 345 THEN x := x - 1 END;
+IF x > 346 THEN x := x - 1 END;
+IF x > 347 THEN x := x - 1 END;
+IF x > 348 THEN x := x - 1 END;
+IF x > 349 THEN x := x - 1 END;
+IF x > 350 THEN x := x - 1 END;
+IF x > 351 THEN x := x - 1 END;
+IF x > 352 THEN x := x - 1 END;
+IF x > 353 THEN x := x - 1 END;
+IF x > 354 THEN x := x - 1 END;
+IF x > 355 THEN x := x - 1 END;
+IF x > 356 THEN x := x - 1 END;
+IF x > 357 THEN x := x - 1 END;
+IF x > 358 THEN x := x - 1 END;
+IF x > 359 THEN x := x - 1 END;
+IF x > 360 THEN x := x - 1 END;
+IF x > 361 THEN x := x - 1 END;
+IF x > 362 THEN x := x - 1 END;
+IF x > 363 THEN x := x - 1 END;
+IF x > 364 THEN x := x - 1 END;
+IF x > 365 THEN x := x - 1 END;
+IF x > 366 THEN x := x - 1 END;
+IF x > 367 THEN x := x - 1 END;
+IF x > 368 THEN x := x - 1 END;
+IF x > 369 THEN x := x - 1 END;
+IF x > 370 THEN x := x - 1 END;
+IF x > 371 THEN x := x - 1 END;
+IF x > 372 THEN x := x - 1 END;
+IF x > 373 THEN x := x - 1 END;
+IF x > 374 THEN x := x - 1 END;
+IF x > 375 THEN x := x - 1 END;
+IF x > 376 THEN x := x - 1 END;
+IF x > 377 THEN x := x - 1 END;
+IF x > 378 THEN x := x - 1 END;
+IF x > 379 THEN x := x - 1 END;
+IF x > 380 THEN x := x - 1 END;
+IF x > 381 THEN x := x - 1 END;
+IF x > 382 THEN x := x - 1 END;
+IF x > 383 THEN x := x - 1 END;
+IF x > 384 THEN x := x - 1 END;
+IF x > 385 THEN x := x - 1 END;
+IF x > 386 THEN x := x - 1 END;
+IF x > 387 THEN x := x - 1 END;
+IF x > 388 THEN x := x - 1 END;
+IF x > 389 THEN x := x - 1 END;
+IF x > 390 THEN x := x - 1 END;
+IF x > 391 THEN x := x - 1 END;
+IF x > 392 THEN x := x - 1 END;
+IF x > 393 THEN x := x - 1 END;
+IF x > 394 THEN x := x - 1 END;
+IF x > 395 THEN x := x - 1 END;
+IF x > 396 THEN x := x - 1 END;
+IF x > 397 THEN x := x - 1 END;
+IF x > 398 THEN x := x - 1 END;
+IF x > 399 THEN x := x - 1 END;
+IF x > 400 THEN x := x - 1 END;
+IF x > 401 THEN x := x - 1 END;
+IF x > 402 THEN x := x - 1 END;
+IF x > 403 THEN x := x - 1 END;
+IF x > 404 THEN x := x - 1 END;
+IF x > 405 THEN x := x - 1 END;
+IF x > 406 THEN x := x - 1 END;
+IF x > 407 THEN x := x - 1 END;
+IF x > 408 THEN x := x - 1 END;
+IF x > 409 THEN x := x - 1 END;
+IF x > 410 THEN x := x - 1 END;
+IF x > 411 THEN x := x - 1 END;
+IF x > 412 THEN x := x - 1 END;
+IF x > 413 THEN x := x - 1 END;
+IF x > 414 THEN x := x - 1 END;
+IF x > 415 THEN x := x - 1 END;
+IF x > 416 THEN x := x - 1 END;
+IF x > 417 THEN x := x - 1 END;
+IF x > 418 THEN x := x - 1 END;
+IF x > 419 THEN x := x - 1 END;
+IF x > 420 THEN x := x - 1 END;
+IF x > 421 THEN x := x - 1 END;
+IF x > 422 THEN x := x - 1 END;
+IF x > 423 THEN x := x - 1 END;
+IF x > 424 THEN x := x - 1 END;
+IF x > 425 THEN x := x - 1 END;
+IF x > 426 THEN x := x - 1 END;
+IF x > 427 THEN x := x - 1 END;
+IF x > 428 THEN x := x - 1 END;
+IF x > 429 THEN x := x - 1 END;
+IF x > 430 THEN x := x - 1 END;
+IF x > 431 THEN x := x - 1 END;
+IF x > 432 THEN x := x - 1 END;
+IF x > 433 THEN x := x - 1 END;
+IF x > 434 THEN x := x - 1 END;
+IF x > 435 THEN x := x - 1 END;
+IF x > 436 THEN x := x - 1 END;
+IF x > 437 THEN x := x - 1 END;
+IF x > 438 THEN x := x - 1 END;
+IF x > 439 THEN x := x - 1 END;
+IF x > 440 THEN x := x - 1 END;
+IF x > 441 THEN x := x - 1 END;
+IF x > 442 THEN x := x - 1 END;
+IF x > 443 THEN x := x - 1 END;
+IF x > 444 THEN x := x - 1 END;
+IF x > 445 THEN x := x - 1 END;
+IF x > 446 THEN x := x - 1 END;
+IF x > 447 THEN x := x - 1 END;
+IF x > 448 THEN x := x - 1 END;
+IF x > 449 THEN x := x - 1 END;
+IF x > 450 THEN x := x - 1 END;
+IF x > 451 THEN x := x - 1 END;
+IF x > 452 THEN x := x - 1 END;
+IF x > 453 THEN x := x - 1 END;
+IF x > 454 THEN x := x - 1 END;
+IF x > 455 THEN x := x - 1 END;
+IF x > 456 THEN x := x - 1 END;
+IF x > 457 THEN x := x - 1 END;
+IF x > 458 THEN x := x - 1 END;
+IF x > 459 THEN x := x - 1 END;
+IF x > 460 THEN x := x - 1 END;
+IF x > 461 THEN x := x - 1 END;
+IF x > 462 THEN x := x - 1 END;
+IF x > 463 THEN x := x - 1 END;
+IF x > 464 THEN x := x - 1 END;
+IF x > 465 THEN x := x - 1 END;
+IF x > 466 THEN x := x - 1 END;
+IF x > 467 THEN x := x - 1 END;
+IF x > 468 THEN x := x - 1 END;
+IF x > 469 THEN x := x - 1 END;
+IF x > 470 THEN x := x - 1 END;
+IF x > 471 THEN x := x - 1 END;
+IF x > 472 THEN x := x - 1 END;
+IF x > 473 THEN x := x - 1 END;
+IF x > 474 THEN x := x - 1 END;
+IF x > 475 THEN x := x - 1 END;
+IF x > 476 THEN x := x - 1 END;
+IF x > 477 THEN x := x - 1 END;
+IF x > 478 THEN x := x - 1 END;
+IF x > 479 THEN x := x - 1 END;
+IF x > 480 THEN x := x - 1 END;
+IF x > 481 THEN x := x - 1 END;
+IF x > 482 THEN x := x - 1 END;
+IF x > 483 THEN x := x - 1 END;
+IF x > 484 THEN x := x - 1 END;
+IF x > 485 THEN x := x - 1 END;
+IF x > 486 THEN x := x - 1 END;
+IF x > 487 THEN x := x - 1 END;
+IF x > 488 THEN x := x - 1 END;
+IF x > 489 THEN x := x - 1 END;
+IF x > 490 THEN x := x - 1 END;
+IF x > 491 THEN x := x - 1 END;
+IF x > 492 THEN x := x - 1 END;
+IF x > 493 THEN x := x - 1 END;
+IF x > 494 THEN x := x - 1 END;
+IF x > 495 THEN x := x - 1 END;
+IF x > 496 THEN x := x - 1 END;
+IF x > 497 THEN x := x - 1 END;
+IF x > 498 THEN x := x - 1 END;
+IF x > 499 THEN x := x - 1 END;
+IF x > 500 THEN x := x - 1 END;
+IF x > 501 THEN x := x - 1 END;
+IF x > 502 THEN x := x - 1 END;
+IF x > 503 THEN x := x - 1 END;
+IF x > 504 THEN x := x - 1 END;
+IF x > 505 THEN x := x - 1 END;
+IF x > 506 THEN x := x - 1 END;
+IF x > 507 THEN x := x - 1 END;
+IF x > 508 THEN x := x - 1 END;
+IF x > 509 THEN x := x - 1 END;
+IF x > 510 THEN x := x - 1 END;
+IF x > 511 THEN x := x - 1 END;
+IF x > 512 THEN x := x - 1 END;
+IF x > 513 THEN x := x - 1 END;
+IF x > 514 THEN x := x - 1 END;
+IF x > 515 THEN x := x - 1 END;
+IF x > 516 THEN x := x - 1 END;
+IF x > 517 THEN x := x - 1 END;
+IF x > 518 THEN x := x - 1 END;
+IF x > 519 THEN x := x - 1 END;
+IF x > 520 THEN x := x - 1 END;
+IF x > 521 THEN x := x - 1 END;
+IF x > 522 THEN x := x - 1 END;
+IF x > 523 THEN x := x - 1 END;
+IF x > 524 THEN x := x - 1 END;
+IF x > 525 THEN x := x - 1 END;
+IF x > 526 THEN x := x - 1 END;
+IF x > 527 THEN x := x - 1 END;
+IF x > 528 THEN x := x - 1 END;
+IF x > 529 THEN x := x - 1 END;
+IF x > 530 THEN x := x - 1 END;
+IF x > 531 THEN x := x - 1 END;
+IF x > 532 THEN x := x - 1 END;
+IF x > 533 THEN x := x - 1 END;
+IF x > 534 THEN x := x - 1 END;
+IF x > 535 THEN x := x - 1 END;
+IF x > 536 THEN x := x - 1 END;
+IF x > 537 THEN x := x - 1 END;
+IF x > 538 THEN x := x - 1 END;
+IF x > 539 THEN x := x - 1 END;
+IF x > 540 THEN x := x - 1 END;
+IF x > 541 THEN x := x - 1 END;
+IF x > 542 THEN x := x - 1 END;
+IF x > 543 THEN x := x - 1 END;
+IF x > 544 THEN x := x - 1 END;
+IF x > 545 THEN x := x - 1 END;
+IF x > 546 THEN x := x - 1 END;
+IF x > 547 THEN x := x - 1 END;
+IF x > 548 THEN x := x - 1 END;
+IF x > 549 THEN x := x - 1 END;
+IF x > 550 THEN x := x - 1 END;
+IF x > 551 THEN x := x - 1 END;
+IF x > 552 THEN x := x - 1 END;
+IF x > 553 THEN x := x - 1 END;
+IF x > 554 THEN x := x - 1 END;
+IF x > 555 THEN x := x - 1 END;
+IF x > 556 THEN x := x - 1 END;
+IF x > 557 THEN x := x - 1 END;
+IF x > 558 THEN x := x - 1 END;
+IF x > 559 THEN x := x - 1 END;
+IF x > 560 THEN x := x - 1 END;
+IF x > 561 THEN x := x - 1 END;
+IF x > 562 THEN x := x - 1 END;
+IF x > 563 THEN x := x - 1 END;
+IF x > 564 THEN x := x - 1 END;
+IF x > 565 THEN x := x - 1 END;
+IF x > 566 THEN x := x - 1 END;
+IF x > 567 THEN x := x - 1 END;
+IF x > 568 THEN x := x - 1 END;
+IF x > 569 THEN x := x - 1 END;
+IF x > 570 THEN x := x - 1 END;
+IF x > 571 THEN x := x - 1 END;
+IF x > 572 THEN x := x - 1 END;
+IF x > 573 THEN x := x - 1 END;
+IF x > 574 THEN x := x - 1 END;
+IF x > 575 THEN x := x - 1 END;
+IF x > 576 THEN x := x - 1 END;
+IF x > 577 THEN x := x - 1 END;
+IF x > 578 THEN x := x - 1 END;
+IF x > 579 THEN x := x - 1 END;
+IF x > 580 THEN x := x - 1 END;
+IF x > 581 THEN x := x - 1 END;
+IF x > 582 THEN x := x - 1 END;
+IF x > 583 THEN x := x - 1 END;
+IF x > 584 THEN x := x - 1 END;
+IF x > 585 THEN x := x - 1 END;
+IF x > 586 THEN x := x - 1 END;
+IF x > 587 THEN x := x - 1 END;
+IF x > 588 THEN x := x - 1 END;
+IF x > 589 THEN x := x - 1 END;
+IF x > 590 THEN x := x - 1 END;
+IF x > 591 THEN x := x - 1 END;
+IF x > 592 THEN x := x - 1 END;
+IF x > 593 THEN x := x - 1 END;
+IF x > 594 THEN x := x - 1 END;
+IF x > 595 THEN x := x - 1 END;
+IF x > 596 THEN x := x - 1 END;
+IF x > 597 THEN x := x - 1 END;
+IF x > 598 THEN x := x - 1 END;
+IF x > 599 THEN x := x - 1 END;
+IF x > 600 THEN x := x - 1 END;
+IF x > 601 THEN x := x - 1 END;
+IF x > 602 THEN x := x - 1 END;
+IF x > 603 THEN x := x - 1 END;
+IF x > 604 THEN x := x - 1 END;
+IF x > 605 THEN x := x - 1 END;
+IF x > 606 THEN x := x - 1 END;
+IF x > 607 THEN x := x - 1 END;
+IF x > 608 THEN x := x - 1 END;
+IF x > 609 THEN x := x - 1 END;
+IF x > 610 THEN x := x - 1 END;
+IF x > 611 THEN x := x - 1 END;
+IF x > 612 THEN x := x - 1 END;
+IF x > 613 THEN x := x - 1 END;
+IF x > 614 THEN x := x - 1 END;
+IF x > 615 THEN x := x - 1 END;
+IF x > 616 THEN x := x - 1 END;
+IF x > 617 THEN x := x - 1 END;
+IF x > 618 THEN x := x - 1 END;
+IF x > 619 THEN x := x - 1 END;
+IF x > 620 THEN x := x - 1 END;
+IF x > 621 THEN x := x - 1 END;
+IF x > 622 THEN x := x - 1 END;
+IF x > 623 THEN x := x - 1 END;
+IF x > 624 THEN x := x - 1 END;
+IF x > 625 THEN x := x - 1 END;
+IF x > 626 THEN x := x - 1 END;
+IF x > 627 THEN x := x - 1 END;
+IF x > 628 THEN x := x - 1 END;
+IF x > 629 THEN x := x - 1 END;
+IF x > 630 THEN x := x - 1 END;
+IF x > 631 THEN x := x - 1 END;
+IF x > 632 THEN x := x - 1 END;
+IF x > 633 THEN x := x - 1 END;
+IF x > 634 THEN x := x - 1 END;
+IF x > 635 THEN x := x - 1 END;
+IF x > 636 THEN x := x - 1 END;
+IF x > 637 THEN x := x - 1 END;
+IF x > 638 THEN x := x - 1 END;
+IF x > 639 THEN x := x - 1 END;
+IF x > 640 THEN x := x - 1 END;
+IF x > 641 THEN x := x - 1 END;
+IF x > 642 THEN x := x - 1 END;
+IF x > 643 THEN x := x - 1 END;
+IF x > 644 THEN x := x - 1 END;
+IF x > 645 THEN x := x - 1 END;
+IF x > 646 THEN x := x - 1 END;
+IF x > 647 THEN x := x - 1 END;
+IF x > 648 THEN x := x - 1 END;
+IF x > 649 THEN x := x - 1 END;
+IF x > 650 THEN x := x - 1 END;
+IF x > 651 THEN x := x - 1 END;
+IF x > 652 THEN x := x - 1 END;
+IF x > 653 THEN x := x - 1 END;
+IF x > 654 THEN x := x - 1 END;
+IF x > 655 THEN x := x - 1 END;
+IF x > 656 THEN x := x - 1 END;
+IF x > 657 THEN x := x - 1 END;
+IF x > 658 THEN x := x - 1 END;
+IF x > 659 THEN x := x - 1 END;
+IF x > 660 THEN x := x - 1 END;
+IF x > 661 THEN x := x - 1 END;
+IF x > 662 THEN x := x - 1 END;
+IF x > 663 THEN x := x - 1 END;
+IF x > 664 THEN x := x - 1 END;
+IF x > 665 THEN x := x - 1 END;
+IF x > 666 THEN x := x - 1 END;
+IF x > 667 THEN x := x - 1 END;
+IF x > 668 THEN x := x - 1 END;
+IF x > 669 THEN x := x - 1 END;
+IF x > 670 THEN x := x - 1 END;
+IF x > 671 THEN x := x - 1 END;
+IF x > 672 THEN x := x - 1 END;
+IF x > 673 THEN x := x - 1 END;
+IF x > 674 THEN x := x - 1 END;
+IF x > 675 THEN x := x - 1 END;
+IF x > 676 THEN x := x - 1 END;
+IF x > 677 THEN x := x - 1 END;
+IF x > 678 THEN x := x - 1 END;
+IF x > 679 THEN x := x - 1 END;
+IF x > 680 THEN x := x - 1 END;
+IF x > 681 THEN x := x - 1 END;
+IF x > 682 THEN x := x - 1 END;
+IF x > 683 THEN x := x - 1 END;
+IF x > 684 THEN x := x - 1 END;
+IF x > 685 THEN x := x - 1 END;
+IF x > 686 THEN x := x - 1 END;
+IF x > 687 THEN x := x - 1 END;
+IF x > 688 THEN x := x - 1 END;
+IF x > 689 THEN x := x - 1 END;
+IF x > 690 THEN x := x - 1 END;
+IF x > 691 THEN x := x - 1 END;
+IF x > 692 THEN x := x - 1 END;
+IF x > 693 THEN x := x - 1 END;
+IF x > 694 THEN x := x - 1 END;
+IF x > 695 THEN x := x - 1 END;
+IF x > 696 THEN x := x - 1 END;
+IF x > 697 THEN x := x - 1 END;
+IF x > 698 THEN x := x - 1 END;
+IF x > 699 THEN x := x - 1 END;
+IF x > 700 THEN x := x - 1 END;
+IF x > 701 THEN x := x - 1 END;
+IF x > 702 THEN x := x - 1 END;
+IF x > 703 THEN x := x - 1 END;
+IF x > 704 THEN x := x - 1 END;
+IF x > 705 THEN x := x - 1 END;
+IF x > 706 THEN x := x - 1 END;
+IF x > 707 THEN x := x - 1 END;
+IF x > 708 THEN x := x - 1 END;
+IF x > 709 THEN x := x - 1 END;
+IF x > 710 THEN x := x - 1 END;
+IF x > 711 THEN x := x - 1 END;
+IF x > 712 THEN x := x - 1 END;
+IF x > 713 THEN x := x - 1 END;
+IF x > 714 THEN x := x - 1 END;
+IF x > 715 THEN x := x - 1 END;
+IF x > 716 THEN x := x - 1 END;
+IF x > 717 THEN x := x - 1 END;
+IF x > 718 THEN x := x - 1 END;
+IF x > 719 THEN x := x - 1 END;
+IF x > 720 THEN x := x - 1 END;
+IF x > 721 THEN x := x - 1 END;
+IF x > 722 THEN x := x - 1 END;
+IF x > 723 THEN x := x - 1 END;
+IF x > 724 THEN x := x - 1 END;
+IF x > 725 THEN x := x - 1 END;
+IF x > 726 THEN x := x - 1 END;
+IF x > 727 THEN x := x - 1 END;
+IF x > 728 THEN x := x - 1 END;
+IF x > 729 THEN x := x - 1 END;
+IF x > 730 THEN x := x - 1 END;
+IF x > 731 THEN x := x - 1 END;
+IF x > 732 THEN x := x - 1 END;
+IF x > 733 THEN x := x - 1 END;
+IF x > 734 THEN x := x - 1 END;
+IF x > 735 THEN x := x - 1 END;
+IF x > 736 THEN x := x - 1 END;
+IF x > 737 THEN x := x - 1 END;
+IF x > 738 THEN x := x - 1 END;
+IF x > 739 THEN x := x - 1 END;
+IF x > 740 THEN x := x - 1 END;
+IF x > 741 THEN x := x - 1 END;
+IF x > 742 THEN x := x - 1 END;
+IF x > 743 THEN x := x - 1 END;
+IF x > 744 THEN x := x - 1 END;
+IF x > 745 THEN x := x - 1 END;
+IF x > 746 THEN x := x - 1 END;
+IF x > 747 THEN x := x - 1 END;
+IF x > 748 THEN x := x - 1 END;
+IF x > 749 THEN x := x - 1 END;
+IF x > 750 THEN x := x - 1 END;
+IF x > 751 THEN x := x - 1 END;
+IF x > 752 THEN x := x - 1 END;
+IF x > 753 THEN x := x - 1 END;
+IF x > 754 THEN x := x - 1 END;
+IF x > 755 THEN x := x - 1 END;
+IF x > 756 THEN x := x - 1 END;
+IF x > 757 THEN x := x - 1 END;
+IF x > 758 THEN x := x - 1 END;
+IF x > 759 THEN x := x - 1 END;
+IF x > 760 THEN x := x - 1 END;
+IF x > 761 THEN x := x - 1 END;
+IF x > 762 THEN x := x - 1 END;
+IF x > 763 THEN x := x - 1 END;
+IF x > 764 THEN x := x - 1 END;
+IF x > 765 THEN x := x - 1 END;
+IF x > 766 THEN x := x - 1 END;
+IF x > 767 THEN x := x - 1 END;
+IF x > 768 THEN x := x - 1 END;
+IF x > 769 THEN x := x - 1 END;
+IF x > 770 THEN x := x - 1 END;
+IF x > 771 THEN x := x - 1 END;
+IF x > 772 THEN x := x - 1 END;
+IF x > 773 THEN x := x - 1 END;
+IF x > 774 THEN x := x - 1 END;
+IF x > 775 THEN x := x - 1 END;
+IF x > 776 THEN x := x - 1 END;
+IF x > 777 THEN x := x - 1 END;
+IF x > 778 THEN x := x - 1 END;
+IF x > 779 THEN x := x - 1 END;
+IF x > 780 THEN x := x - 1 END;
+IF x > 781 THEN x := x - 1 END;
+IF x > 782 THEN x := x - 1 END;
+IF x > 783 THEN x := x - 1 END;
+IF x > 784 THEN x := x - 1 END;
+IF x > 785 THEN x := x - 1 END;
+IF x > 786 THEN x := x - 1 END;
+IF x > 787 THEN x := x - 1 END;
+IF x > 788 THEN x := x - 1 END;
+IF x > 789 THEN x := x - 1 END;
+IF x > 790 THEN x := x - 1 END;
+IF x > 791 THEN x := x - 1 END;
+IF x > 792 THEN x := x - 1 END;
+IF x > 793 THEN x := x - 1 END;
+IF x > 794 THEN x := x - 1 END;
+IF x > 795 THEN x := x - 1 END;
+IF x > 796 THEN x := x - 1 END;
+IF x > 797 THEN x := x - 1 END;
+IF x > 798 THEN x := x - 1 END;
+IF x > 799 THEN x := x - 1 END;
+IF x > 800 THEN x := x - 1 END;
+IF x > 801 THEN x := x - 1 END;
+IF x > 802 THEN x := x - 1 END;
+IF x > 803 THEN x := x - 1 END;
+IF x > 804 THEN x := x - 1 END;
+IF x > 805 THEN x := x - 1 END;
+IF x > 806 THEN x := x - 1 END;
+IF x > 807 THEN x := x - 1 END;
+IF x > 808 THEN x := x - 1 END;
+IF x > 809 THEN x := x - 1 END;
+IF x > 810 THEN x := x - 1 END;
+IF x > 811 THEN x := x - 1 END;
+IF x > 812 THEN x := x - 1 END;
+IF x > 813 THEN x := x - 1 END;
+IF x > 814 THEN x := x - 1 END;
+IF x > 815 THEN x := x - 1 END;
+IF x > 816 THEN x := x - 1 END;
+IF x > 817 THEN x := x - 1 END;
+IF x > 818 THEN x := x - 1 END;
+IF x > 819 THEN x := x - 1 END;
+IF x > 820 THEN x := x - 1 END;
+IF x > 821 THEN x := x - 1 END;
+IF x > 822 THEN x := x - 1 END;
+IF x > 823 THEN x := x - 1 END;
+IF x > 824 THEN x := x - 1 END;
+IF x > 825 THEN x := x - 1 END;
+IF x > 826 THEN x := x - 1 END;
+IF x > 827 THEN x := x - 1 END;
+IF x > 828 THEN x := x - 1 END;
+IF x > 829 THEN x := x - 1 END;
+IF x > 830 THEN x := x - 1 END;
+IF x > 831 THEN x := x - 1 END;
+IF x > 832 THEN x := x - 1 END;
+IF x > 833 THEN x := x - 1 END;
+IF x > 834 THEN x := x - 1 END;
+IF x > 835 THEN x := x - 1 END;
+IF x > 836 THEN x := x - 1 END;
+IF x > 837 THEN x := x - 1 END;
+IF x > 838 THEN x := x - 1 END;
+IF x > 839 THEN x := x - 1 END;
+IF x > 840 THEN x := x - 1 END;
+IF x > 841 THEN x := x - 1 END;
+IF x > 842 THEN x := x - 1 END;
+IF x > 843 THEN x := x - 1 END;
+IF x > 844 THEN x := x - 1 END;
+IF x > 845 THEN x := x - 1 END;
+IF x > 846 THEN x := x - 1 END;
+IF x > 847 THEN x := x - 1 END;
+IF x > 848 THEN x := x - 1 END;
+IF x > 849 THEN x := x - 1 END;
+IF x > 850 THEN x := x - 1 END;
+IF x > 851 THEN x := x - 1 END;
+IF x > 852 THEN x := x - 1 END;
+IF x > 853 THEN x := x - 1 END;
+IF x > 854 THEN x := x - 1 END;
+IF x > 855 THEN x := x - 1 END;
+IF x > 856 THEN x := x - 1 END;
+IF x > 857 THEN x := x - 1 END;
+IF x > 858 THEN x := x - 1 END;
+IF x > 859 THEN x := x - 1 END;
+IF x > 860 THEN x := x - 1 END;
+IF x > 861 THEN x := x - 1 END;
+IF x > 862 THEN x := x - 1 END;
+IF x > 863 THEN x := x - 1 END;
+IF x > 864 THEN x := x - 1 END;
+IF x > 865 THEN x := x - 1 END;
+IF x > 866 THEN x := x - 1 END;
+IF x > 867 THEN x := x - 1 END;
+IF x > 868 THEN x := x - 1 END;
+IF x > 869 THEN x := x - 1 END;
+IF x > 870 THEN x := x - 1 END;
+IF x > 871 THEN x := x - 1 END;
+IF x > 872 THEN x := x - 1 END;
+IF x > 873 THEN x := x - 1 END;
+IF x > 874 THEN x := x - 1 END;
+IF x > 875 THEN x := x - 1 END;
+IF x > 876 THEN x := x - 1 END;
+IF x > 877 THEN x := x - 1 END;
+IF x > 878 THEN x := x - 1 END;
+IF x > 879 THEN x := x - 1 END;
+IF x > 880 THEN x := x - 1 END;
+IF x > 881 THEN x := x - 1 END;
+IF x > 882 THEN x := x - 1 END;
+IF x > 883 THEN x := x - 1 END;
+IF x > 884 THEN x := x - 1 END;
+IF x > 885 THEN x := x - 1 END;
+IF x > 886 THEN x := x - 1 END;
+IF x > 887 THEN x := x - 1 END;
+IF x > 888 THEN x := x - 1 END;
+IF x > 889 THEN x := x - 1 END;
+IF x > 890 THEN x := x - 1 END;
+IF x > 891 THEN x := x - 1 END;
+IF x > 892 THEN x := x - 1 END;
+IF x > 893 THEN x := x - 1 END;
+IF x > 894 THEN x := x - 1 END;
+IF x > 895 THEN x := x - 1 END;
+IF x > 896 THEN x := x - 1 END;
+IF x > 897 THEN x := x - 1 END;
+IF x > 898 THEN x := x - 1 END;
+IF x > 899 THEN x := x - 1 END;
+IF x > 900 THEN x := x - 1 END;
+IF x > 901 THEN x := x - 1 END;
+IF x > 902 THEN x := x - 1 END;
+IF x > 903 THEN x := x - 1 END;
+IF x > 904 THEN x := x - 1 END;
+IF x > 905 THEN x := x - 1 END;
+IF x > 906 THEN x := x - 1 END;
+IF x > 907 THEN x := x - 1 END;
+IF x > 908 THEN x := x - 1 END;
+IF x > 909 THEN x := x - 1 END;
+IF x > 910 THEN x := x - 1 END;
+IF x > 911 THEN x := x - 1 END;
+IF x > 912 THEN x := x - 1 END;
+IF x > 913 THEN x := x - 1 END;
+IF x > 914 THEN x := x - 1 END;
+IF x > 915 THEN x := x - 1 END;
+IF x > 916 THEN x := x - 1 END;
+IF x > 917 THEN x := x - 1 END;
+IF x > 918 THEN x := x - 1 END;
+IF x > 919 THEN x := x - 1 END;
+IF x > 920 THEN x := x - 1 END;
+IF x > 921 THEN x := x - 1 END;
+IF x > 922 THEN x := x - 1 END;
+IF x > 923 THEN x := x - 1 END;
+IF x > 924 THEN x := x - 1 END;
+IF x > 925 THEN x := x - 1 END;
+IF x > 926 THEN x := x - 1 END;
+IF x > 927 THEN x := x - 1 END;
+IF x > 928 THEN x := x - 1 END;
+IF x > 929 THEN x := x - 1 END;
+IF x > 930 THEN x := x - 1 END;
+IF x > 931 THEN x := x - 1 END;
+IF x > 932 THEN x := x - 1 END;
+IF x > 933 THEN x := x - 1 END;
+IF x > 934 THEN x := x - 1 END;
+IF x > 935 THEN x := x - 1 END;
+IF x > 936 THEN x := x - 1 END;
+IF x > 937 THEN x := x - 1 END;
+IF x > 938 THEN x := x - 1 END;
+IF x > 939 THEN x := x - 1 END;
+IF x > 940 THEN x := x - 1 END;
+IF x > 941 THEN x := x - 1 END;
+IF x > 942 THEN x := x - 1 END;
+IF x > 943 THEN x := x - 1 END;
+IF x > 944 THEN x := x - 1 END;
+IF x > 945 THEN x := x - 1 END;
+IF x > 946 THEN x := x - 1 END;
+IF x > 947 THEN x := x - 1 END;
+IF x > 948 THEN x := x - 1 END;
+IF x > 949 THEN x := x - 1 END;
+IF x > 950 THEN x := x - 1 END;
+IF x > 951 THEN x := x - 1 END;
+IF x > 952 THEN x := x - 1 END;
+IF x > 953 THEN x := x - 1 END;
+IF x > 954 THEN x := x - 1 END;
+IF x > 955 THEN x := x - 1 END;
+IF x > 956 THEN x := x - 1 END;
+IF x > 957 THEN x := x - 1 END;
+IF x > 958 THEN x := x - 1 END;
+IF x > 959 THEN x := x - 1 END;
+IF x > 960 THEN x := x - 1 END;
+IF x > 961 THEN x := x - 1 END;
+IF x > 962 THEN x := x - 1 END;
+IF x > 963 THEN x := x - 1 END;
+IF x > 964 THEN x := x - 1 END;
+IF x > 965 THEN x := x - 1 END;
+IF x > 966 THEN x := x - 1 END;
+IF x > 967 THEN x := x - 1 END;
+IF x > 968 THEN x := x - 1 END;
+IF x > 969 THEN x := x - 1 END;
+IF x > 970 THEN x := x - 1 END;
+IF x > 971 THEN x := x - 1 END;
+IF x > 972 THEN x := x - 1 END;
+IF x > 973 THEN x := x - 1 END;
+IF x > 974 THEN x := x - 1 END;
+IF x > 975 THEN x := x - 1 END;
+IF x > 976 THEN x := x - 1 END;
+IF x > 977 THEN x := x - 1 END;
+IF x > 978 THEN x := x - 1 END;
+IF x > 979 THEN x := x - 1 END;
+IF x > 980 THEN x := x - 1 END;
+IF x > 981 THEN x := x - 1 END;
+IF x > 982 THEN x := x - 1 END;
+IF x > 983 THEN x := x - 1 END;
+IF x > 984 THEN x := x - 1 END;
+IF x > 985 THEN x := x - 1 END;
+IF x > 986 THEN x := x - 1 END;
+IF x > 987 THEN x := x - 1 END;
+IF x > 988 THEN x := x - 1 END;
+IF x > 989 THEN x := x - 1 END;
+IF x > 990 THEN x := x - 1 END;
+IF x > 991 THEN x := x - 1 END;
+IF x > 992 THEN x := x - 1 END;
+IF x > 993 THEN x := x - 1 END;
+IF x > 994 THEN x := x - 1 END;
+IF x > 995 THEN x := x - 1 END;
+IF x > 996 THEN x := x - 1 END;
+IF x > 997 THEN x := x - 1 END;
+IF x > 998 THEN x := x - 1 END;
+IF x > 999 THEN x := x - 1 END;
+IF x > 1000 THEN x := x - 1 END;
+IF x > 1001 THEN x := x - 1 END;
+IF x > 1002 THEN x := x - 1 END;
+IF x > 1003 THEN x := x - 1 END;
+IF x > 1004 THEN x := x - 1 END;
+IF x > 1005 THEN x := x - 1 END;
+IF x > 1006 THEN x := x - 1 END;
+IF x > 1007 THEN x := x - 1 END;
+IF x > 1008 THEN x := x - 1 END;
+IF x > 1009 THEN x := x - 1 END;
+IF x > 1010 THEN x := x - 1 END;
+IF x > 1011 THEN x := x - 1 END;
+IF x > 1012 THEN x := x - 1 END;
+IF x > 1013 THEN x := x - 1 END;
+IF x > 1014 THEN x := x - 1 END;
+IF x > 1015 THEN x := x - 1 END;
+IF x > 1016 THEN x := x - 1 END;
+IF x > 1017 THEN x := x - 1 END;
+IF x > 1018 THEN x := x - 1 END;
+IF x > 1019 THEN x := x - 1 END;
+IF x > 1020 THEN x := x - 1 END;
+IF x > 1021 THEN x := x - 1 END;
+IF x > 1022 THEN x := x - 1 END;
+IF x > 1023 THEN x := x - 1 END;
+IF x > 1024 THEN x := x - 1 END;
+IF x > 1025 THEN x := x - 1 END;
+IF x > 1026 THEN x := x - 1 END;
+IF x > 1027 THEN x := x - 1 END;
+IF x > 1028 THEN x := x - 1 END;
+IF x > 1029 THEN x := x - 1 END;
+IF x > 1030 THEN x := x - 1 END;
+IF x > 1031 THEN x := x - 1 END;
+IF x > 1032 THEN x := x - 1 END;
+IF x > 1033 THEN x := x - 1 END;
+IF x > 1034 THEN x := x - 1 END;
+IF x > 1035 THEN x := x - 1 END;
+IF x > 1036 THEN x := x - 1 END;
+IF x > 1037 THEN x := x - 1 END;
+IF x > 1038 THEN x := x - 1 END;
+IF x > 1039 THEN x := x - 1 END;
+IF x > 1040 THEN x := x - 1 END;
+IF x > 1041 THEN x := x - 1 END;
+IF x > 1042 THEN x := x - 1 END;
+IF x > 1043 THEN x := x - 1 END;
+IF x > 1044 THEN x := x - 1 END;
+IF x > 1045 THEN x := x - 1 END;
+IF x > 1046 THEN x := x - 1 END;
+IF x > 1047 THEN x := x - 1 END;
+IF x > 1048 THEN x := x - 1 END;
+IF x > 1049 THEN x := x - 1 END;
+IF x > 1050 THEN x := x - 1 END;
+IF x > 1051 THEN x := x - 1 END;
+IF x > 1052 THEN x := x - 1 END;
+IF x > 1053 THEN x := x - 1 END;
+IF x > 1054 THEN x := x - 1 END;
+IF x > 1055 THEN x := x - 1 END;
+IF x > 1056 THEN x := x - 1 END;
+IF x > 1057 THEN x := x - 1 END;
+IF x > 1058 THEN x := x - 1 END;
+IF x > 1059 THEN x := x - 1 END;
+IF x > 1060 THEN x := x - 1 END;
+IF x > 1061 THEN x := x - 1 END;
+IF x > 1062 THEN x := x - 1 END;
+IF x > 1063 THEN x := x - 1 END;
+IF x > 1064 THEN x := x - 1 END;
+IF x > 1065 THEN x := x - 1 END;
+IF x > 1066 THEN x := x - 1 END;
+IF x > 1067 THEN x := x - 1 END;
+IF x > 1068 THEN x := x - 1 END;
+IF x > 1069 THEN x := x - 1 END;
+IF x > 1070 THEN x := x - 1 END;
+IF x > 1071 THEN x := x - 1 END;
+IF x > 1072 THEN x := x - 1 END;
+IF x > 1073 THEN x := x - 1 END;
+IF x > 1074 THEN x := x - 1 END;
+IF x > 1075 THEN x := x - 1 END;
+IF x > 1076 THEN x := x - 1 END;
+IF x > 1077 THEN x := x - 1 END;
+IF x > 1078 THEN x := x - 1 END;
+IF x > 1079 THEN x := x - 1 END;
+IF x > 1080 THEN x := x - 1 END;
+IF x > 1081 THEN x := x - 1 END;
+IF x > 1082 THEN x := x - 1 END;
+IF x > 1083 THEN x := x - 1 END;
+IF x > 1084 THEN x := x - 1 END;
+IF x > 1085 THEN x := x - 1 END;
+IF x > 1086 THEN x := x - 1 END;
+IF x > 1087 THEN x := x - 1 END;
+IF x > 1088 THEN x := x - 1 END;
+IF x > 1089 THEN x := x - 1 END;
+IF x > 1090 THEN x := x - 1 END;
+IF x > 1091 THEN x := x - 1 END;
+IF x > 1092 THEN x := x - 1 END;
+IF x > 1093 THEN x := x - 1 END;
+IF x > 1094 THEN x := x - 1 END;
+IF x > 1095 THEN x := x - 1 END;
+IF x > 1096 THEN x := x - 1 END;
+IF x > 1097 THEN x := x - 1 END;
+IF x > 1098 THEN x := x - 1 END;
+IF x > 1099 THEN x := x - 1 END;
+IF x > 1100 THEN x := x - 1 END;
+IF x > 1101 THEN x := x - 1 END;
+IF x > 1102 THEN x := x - 1 END;
+IF x > 1103 THEN x := x - 1 END;
+IF x > 1104 THEN x := x - 1 END;
+IF x > 1105 THEN x := x - 1 END;
+IF x > 1106 THEN x := x - 1 END;
+IF x > 1107 THEN x := x - 1 END;
+IF x > 1108 THEN x := x - 1 END;
+IF x > 1109 THEN x := x - 1 END;
+IF x > 1110 THEN x := x - 1 END;
+IF x > 1111 THEN x := x - 1 END;
+IF x > 1112 THEN x := x - 1 END;
+IF x > 1113 THEN x := x - 1 END;
+IF x > 1114 THEN x := x - 1 END;
+IF x > 1115 THEN x := x - 1 END;
+IF x > 1116 THEN x := x - 1 END;
+IF x > 1117 THEN x := x - 1 END;
+IF x > 1118 THEN x := x - 1 END;
+IF x > 1119 THEN x := x - 1 END;
+IF x > 1120 THEN x := x - 1 END;
+IF x > 1121 THEN x := x - 1 END;
+IF x > 1122 THEN x := x - 1 END;
+IF x > 1123 THEN x := x - 1 END;
+IF x > 1124 THEN x := x - 1 END;
+IF x > 1125 THEN x := x - 1 END;
+IF x > 1126 THEN x := x - 1 END;
+IF x > 1127 THEN x := x - 1 END;
+IF x > 1128 THEN x := x - 1 END;
+IF x > 1129 THEN x := x - 1 END;
+IF x > 1130 THEN x := x - 1 END;
+IF x > 1131 THEN x := x - 1 END;
+IF x > 1132 THEN x := x - 1 END;
+IF x > 1133 THEN x := x - 1 END;
+IF x > 1134 THEN x := x - 1 END;
+IF x > 1135 THEN x := x - 1 END;
+IF x > 1136 THEN x := x - 1 END;
+IF x > 1137 THEN x := x - 1 END;
+IF x > 1138 THEN x := x - 1 END;
+IF x > 1139 THEN x := x - 1 END;
+IF x > 1140 THEN x := x - 1 END;
+IF x > 1141 THEN x := x - 1 END;
+IF x > 1142 THEN x := x - 1 END;
+IF x > 1143 THEN x := x - 1 END;
+IF x > 1144 THEN x := x - 1 END;
+IF x > 1145 THEN x := x - 1 END;
+IF x > 1146 THEN x := x - 1 END;
+IF x > 1147 THEN x := x - 1 END;
+IF x > 1148 THEN x := x - 1 END;
+IF x > 1149 THEN x := x - 1 END;
+IF x > 1150 THEN x := x - 1 END;
+IF x > 1151 THEN x := x - 1 END;
+IF x > 1152 THEN x := x - 1 END;
+IF x > 1153 THEN x := x - 1 END;
+IF x > 1154 THEN x := x - 1 END;
+IF x > 1155 THEN x := x - 1 END;
+IF x > 1156 THEN x := x - 1 END;
+IF x > 1157 THEN x := x - 1 END;
+IF x > 1158 THEN x := x - 1 END;
+IF x > 1159 THEN x := x - 1 END;
+IF x > 1160 THEN x := x - 1 END;
+IF x > 1161 THEN x := x - 1 END;
+IF x > 1162 THEN x := x - 1 END;
+IF x > 1163 THEN x := x - 1 END;
+IF x > 1164 THEN x := x - 1 END;
+IF x > 1165 THEN x := x - 1 END;
+IF x > 1166 THEN x := x - 1 END;
+IF x > 1167 THEN x := x - 1 END;
+IF x > 1168 THEN x := x - 1 END;
+IF x > 1169 THEN x := x - 1 END;
+IF x > 1170 THEN x := x - 1 END;
+IF x > 1171 THEN x := x - 1 END;
+IF x > 1172 THEN x := x - 1 END;
+IF x > 1173 THEN x := x - 1 END;
+IF x > 1174 THEN x := x - 1 END;
+IF x > 1175 THEN x := x - 1 END;
+IF x > 1176 THEN x := x - 1 END;
+IF x > 1177 THEN x := x - 1 END;
+IF x > 1178 THEN x := x - 1 END;
+IF x > 1179 THEN x := x - 1 END;
+IF x > 1180 THEN x := x - 1 END;
+IF x > 1181 THEN x := x - 1 END;
+IF x > 1182 THEN x := x - 1 END;
+IF x > 1183 THEN x := x - 1 END;
+IF x > 1184 THEN x := x - 1 END;
+IF x > 1185 THEN x := x - 1 END;
+IF x > 1186 THEN x := x - 1 END;
+IF x > 1187 THEN x := x - 1 END;
+IF x > 1188 THEN x := x - 1 END;
+IF x > 1189 THEN x := x - 1 END;
+IF x > 1190 THEN x := x - 1 END;
+IF x > 1191 THEN x := x - 1 END;
+IF x > 1192 THEN x := x - 1 END;
+IF x > 1193 THEN x := x - 1 END;
+IF x > 1194 THEN x := x - 1 END;
+IF x > 1195 THEN x := x - 1 END;
+IF x > 1196 THEN x := x - 1 END;
+IF x > 1197 THEN x := x - 1 END;
+IF x > 1198 THEN x := x - 1 END;
+IF x > 1199 THEN x := x - 1 END;
+IF x > 1200 THEN x := x - 1 END;
+IF x > 1201 THEN x := x - 1 END;
+IF x > 1202 THEN x := x - 1 END;
+IF x > 1203 THEN x := x - 1 END;
+IF x > 1204 THEN x := x - 1 END;
+IF x > 1205 THEN x := x - 1 END;
+IF x > 1206 THEN x := x - 1 END;
+IF x > 1207 THEN x := x - 1 END;
+IF x > 1208 THEN x := x - 1 END;
+IF x > 1209 THEN x := x - 1 END;
+IF x > 1210 THEN x := x - 1 END;
+IF x > 1211 THEN x := x - 1 END;
+IF x > 1212 THEN x := x - 1 END;
+IF x > 1213 THEN x := x - 1 END;
+IF x > 1214 THEN x := x - 1 END;
+IF x > 1215 THEN x := x - 1 END;
+IF x > 1216 THEN x := x - 1 END;
+IF x > 1217 THEN x := x - 1 END;
+IF x > 1218 THEN x := x - 1 END;
+IF x > 1219 THEN x := x - 1 END;
+IF x > 1220 THEN x := x - 1 END;
+IF x > 1221 THEN x := x - 1 END;
+IF x > 1222 THEN x := x - 1 END;
+IF x > 1223 THEN x := x - 1 END;
+IF x > 1224 THEN x := x - 1 END;
+IF x > 1225 THEN x := x - 1 END;
+IF x > 1226 THEN x := x - 1 END;
+IF x > 1227 THEN x := x - 1 END;
+IF x > 1228 THEN x := x - 1 END;
+IF x > 1229 THEN x := x - 1 END;
+IF x > 1230 THEN x := x - 1 END;
+IF x > 1231 THEN x := x - 1 END;
+IF x > 1232 THEN x := x - 1 END;
+IF x > 1233 THEN x := x - 1 END;
+IF x > 1234 THEN x := x - 1 END;
+IF x > 1235 THEN x := x - 1 END;
+IF x > 1236 THEN x := x - 1 END;
+IF x > 1237 THEN x := x - 1 END;
+IF x > 1238 THEN x := x - 1 END;
+IF x > 1239 THEN x := x - 1 END;
+IF x > 1240 THEN x := x - 1 END;
+IF x > 1241 THEN x := x - 1 END;
+IF x > 1242 THEN x := x - 1 END;
+IF x > 1243 THEN x := x - 1 END;
+IF x > 1244 THEN x := x - 1 END;
+IF x > 1245 THEN x := x - 1 END;
+IF x > 1246 THEN x := x - 1 END;
+IF x > 1247 THEN x := x - 1 END;
+IF x > 1248 THEN x := x - 1 END;
+IF x > 1249 THEN x := x - 1 END;
+IF x > 1250 THEN x := x - 1 END;
+IF x > 1251 THEN x := x - 1 END;
+IF x > 1252 THEN x := x - 1 END;
+IF x > 1253 THEN x := x - 1 END;
+IF x > 1254 THEN x := x - 1 END;
+IF x > 1255 THEN x := x - 1 END;
+IF x > 1256 THEN x := x - 1 END;
+IF x > 1257 THEN x := x - 1 END;
+IF x > 1258 THEN x := x - 1 END;
+IF x > 1259 THEN x := x - 1 END;
+IF x > 1260 THEN x := x - 1 END;
+IF x > 1261 THEN x := x - 1 END;
+IF x > 1262 THEN x := x - 1 END;
+IF x > 1263 THEN x := x - 1 END;
+IF x > 1264 THEN x := x - 1 END;
+IF x > 1265 THEN x := x - 1 END;
+IF x > 1266 THEN x := x - 1 END;
+IF x > 1267 THEN x := x - 1 END;
+IF x > 1268 THEN x := x - 1 END;
+IF x > 1269 THEN x := x - 1 END;
+IF x > 1270 THEN x := x - 1 END;
+IF x > 1271 THEN x := x - 1 END;
+IF x > 1272 THEN x := x - 1 END;
+IF x > 1273 THEN x := x - 1 END;
+IF x > 1274 THEN x := x - 1 END;
+IF x > 1275 THEN x := x - 1 END;
+IF x > 1276 THEN x := x - 1 END;
+IF x > 1277 THEN x := x - 1 END;
+IF x > 1278 THEN x := x - 1 END;
+IF x > 1279 THEN x := x - 1 END;
+IF x > 1280 THEN x := x - 1 END;
+IF x > 1281 THEN x := x - 1 END;
+IF x > 1282 THEN x := x - 1 END;
+IF x > 1283 THEN x := x - 1 END;
+IF x > 1284 THEN x := x - 1 END;
+IF x > 1285 THEN x := x - 1 END;
+IF x > 1286 THEN x := x - 1 END;
+IF x > 1287 THEN x := x - 1 END;
+IF x > 1288 THEN x := x - 1 END;
+IF x > 1289 THEN x := x - 1 END;
+IF x > 1290 THEN x := x - 1 END;
+IF x > 1291 THEN x := x - 1 END;
+IF x > 1292 THEN x := x - 1 END;
+IF x > 1293 THEN x := x - 1 END;
+IF x > 1294 THEN x := x - 1 END;
+IF x > 1295 THEN x := x - 1 END;
+IF x > 1296 THEN x := x - 1 END;
+IF x > 1297 THEN x := x - 1 END;
+IF x > 1298 THEN x := x - 1 END;
+IF x > 1299 THEN x := x - 1 END;
+IF x > 1300 THEN x := x - 1 END;
+IF x > 1301 THEN x := x - 1 END;
+IF x > 1302 THEN x := x - 1 END;
+IF x > 1303 THEN x := x - 1 END;
+IF x > 1304 THEN x := x - 1 END;
+IF x > 1305 THEN x := x - 1 END;
+IF x > 1306 THEN x := x - 1 END;
+IF x > 1307 THEN x := x - 1 END;
+IF x > 1308 THEN x := x - 1 END;
+IF x > 1309 THEN x := x - 1 END;
+IF x > 1310 THEN x := x - 1 END;
+IF x > 1311 THEN x := x - 1 END;
+IF x > 1312 THEN x := x - 1 END;
+IF x > 1313 THEN x := x - 1 END;
+IF x > 1314 THEN x := x - 1 END;
+IF x > 1315 THEN x := x - 1 END;
+IF x > 1316 THEN x := x - 1 END;
+IF x > 1317 THEN x := x - 1 END;
+IF x > 1318 THEN x := x - 1 END;
+IF x > 1319 THEN x := x - 1 END;
+IF x > 1320 THEN x := x - 1 END;
+IF x > 1321 THEN x := x - 1 END;
+IF x > 1322 THEN x := x - 1 END;
+IF x > 1323 THEN x := x - 1 END;
+IF x > 1324 THEN x := x - 1 END;
+IF x > 1325 THEN x := x - 1 END;
+IF x > 1326 THEN x := x - 1 END;
+IF x > 1327 THEN x := x - 1 END;
+IF x > 1328 THEN x := x - 1 END;
+IF x > 1329 THEN x := x - 1 END;
+IF x > 1330 THEN x := x - 1 END;
+IF x > 1331 THEN x := x - 1 END;
+IF x > 1332 THEN x := x - 1 END;
+IF x > 1333 THEN x := x - 1 END;
+IF x > 1334 THEN x := x - 1 END;
+IF x > 1335 THEN x := x - 1 END;
+IF x > 1336 THEN x := x - 1 END;
+IF x > 1337 THEN x := x - 1 END;
+IF x > 1338 THEN x := x - 1 END;
+IF x > 1339 THEN x := x - 1 END;
+IF x > 1340 THEN x := x - 1 END;
+IF x > 1341 THEN x := x - 1 END;
+IF x > 1342 THEN x := x - 1 END;
+IF x > 1343 THEN x := x - 1 END;
+IF x > 1344 THEN x := x - 1 END;
+IF x > 1345 THEN x := x - 1 END;
+IF x > 1346 THEN x := x - 1 END;
+IF x > 1347 THEN x := x - 1 END;
+IF x > 1348 THEN x := x - 1 END;
+IF x > 1349 THEN x := x - 1 END;
+IF x > 1350 THEN x := x - 1 END;
+IF x > 1351 THEN x := x - 1 END;
+IF x > 1352 THEN x := x - 1 END;
+IF x > 1353 THEN x := x - 1 END;
+IF x > 1354 THEN x := x - 1 END;
+IF x > 1355 THEN x := x - 1 END;
+IF x > 1356 THEN x := x - 1 END;
+IF x > 1357 THEN x := x - 1 END;
+IF x > 1358 THEN x := x - 1 END;
+IF x > 1359 THEN x := x - 1 END;
+IF x > 1360 THEN x := x - 1 END;
+IF x > 1361 THEN x := x - 1 END;
+IF x > 1362 THEN x := x - 1 END;
+IF x > 1363 THEN x := x - 1 END;
+IF x > 1364 THEN x := x - 1 END;
+IF x > 1365 THEN x := x - 1 END;
+IF x > 1366 THEN x := x - 1 END;
+IF x > 1367 THEN x := x - 1 END;
+IF x > 1368 THEN x := x - 1 END;
+IF x > 1369 THEN x := x - 1 END;
+IF x > 1370 THEN x := x - 1 END;
+IF x > 1371 THEN x := x - 1 END;
+IF x > 1372 THEN x := x - 1 END;
+IF x > 1373 THEN x := x - 1 END;
+IF x > 1374 THEN x := x - 1 END;
+IF x > 1375 THEN x := x - 1 END;
+IF x > 1376 THEN x := x - 1 END;
+IF x > 1377 THEN x := x - 1 END;
+IF x > 1378 THEN x := x - 1 END;
+IF x > 1379 THEN x := x - 1 END;
+IF x > 1380 THEN x := x - 1 END;
+IF x > 1381 THEN x := x - 1 END;
+IF x > 1382 THEN x := x - 1 END;
+IF x > 1383 THEN x := x - 1 END;
+IF x > 1384 THEN x := x - 1 END;
+IF x > 1385 THEN x := x - 1 END;
+IF x > 1386 THEN x := x - 1 END;
+IF x > 1387 THEN x := x - 1 END;
+IF x > 1388 THEN x := x - 1 END;
+IF x > 1389 THEN x := x - 1 END;
+IF x > 1390 THEN x := x - 1 END;
+IF x > 1391 THEN x := x - 1 END;
+IF x > 1392 THEN x := x - 1 END;
+IF x > 1393 THEN x := x - 1 END;
+IF x > 1394 THEN x := x - 1 END;
+IF x > 1395 THEN x := x - 1 END;
+IF x > 1396 THEN x := x - 1 END;
+IF x > 1397 THEN x := x - 1 END;
+IF x > 1398 THEN x := x - 1 END;
+IF x > 1399 THEN x := x - 1 END;
+IF x > 1400 THEN x := x - 1 END;
+IF x > 1401 THEN x := x - 1 END;
+IF x > 1402 THEN x := x - 1 END;
+IF x > 1403 THEN x := x - 1 END;
+IF x > 1404 THEN x := x - 1 END;
+IF x > 1405 THEN x := x - 1 END;
+IF x > 1406 THEN x := x - 1 END;
+IF x > 1407 THEN x := x - 1 END;
+IF x > 1408 THEN x := x - 1 END;
+IF x > 1409 THEN x := x - 1 END;
+IF x > 1410 THEN x := x - 1 END;
+IF x > 1411 THEN x := x - 1 END;
+IF x > 1412 THEN x := x - 1 END;
+IF x > 1413 THEN x := x - 1 END;
+IF x > 1414 THEN x := x - 1 END;
+IF x > 1415 THEN x := x - 1 END;
+IF x > 1416 THEN x := x - 1 END;
+IF x > 1417 THEN x := x - 1 END;
+IF x > 1418 THEN x := x - 1 END;
+IF x > 1419 THEN x := x - 1 END;
+IF x > 1420 THEN x := x - 1 END;
+IF x > 1421 THEN x := x - 1 END;
+IF x > 1422 THEN x := x - 1 END;
+IF x > 1423 THEN x := x - 1 END;
+IF x > 1424 THEN x := x - 1 END;
+IF x > 1425 THEN x := x - 1 END;
+IF x > 1426 THEN x := x - 1 END;
+IF x > 1427 THEN x := x - 1 END;
+IF x > 1428 THEN x := x - 1 END;
+IF x > 1429 THEN x := x - 1 END;
+IF x > 1430 THEN x := x - 1 END;
+IF x > 1431 THEN x := x - 1 END;
+IF x > 1432 THEN x := x - 1 END;
+IF x > 1433 THEN x := x - 1 END;
+IF x > 1434 THEN x := x - 1 END;
+IF x > 1435 THEN x := x - 1 END;
+IF x > 1436 THEN x := x - 1 END;
+IF x > 1437 THEN x := x - 1 END;
+IF x > 1438 THEN x := x - 1 END;
+IF x > 1439 THEN x := x - 1 END;
+IF x > 1440 THEN x := x - 1 END;
+IF x > 1441 THEN x := x - 1 END;
+IF x > 1442 THEN x := x - 1 END;
+IF x > 1443 THEN x := x - 1 END;
+IF x > 1444 THEN x := x - 1 END;
+IF x > 1445 THEN x := x - 1 END;
+IF x > 1446 THEN x := x - 1 END;
+IF x > 1447 THEN x := x - 1 END;
+IF x > 1448 THEN x := x - 1 END;
+IF x > 1449 THEN x := x - 1 END;
+IF x > 1450 THEN x := x - 1 END;
+IF x > 1451 THEN x := x - 1 END;
+IF x > 1452 THEN x := x - 1 END;
+IF x > 1453 THEN x := x - 1 END;
+IF x > 1454 THEN x := x - 1 END;
+IF x > 1455 THEN x := x - 1 END;
+IF x > 1456 THEN x := x - 1 END;
+IF x > 1457 THEN x := x - 1 END;
+IF x > 1458 THEN x := x - 1 END;
+IF x > 1459 THEN x := x - 1 END;
+IF x > 1460 THEN x := x - 1 END;
+IF x > 1461 THEN x := x - 1 END;
+IF x > 1462 THEN x := x - 1 END;
+IF x > 1463 THEN x := x - 1 END;
+IF x > 1464 THEN x := x - 1 END;
+IF x > 1465 THEN x := x - 1 END;
+IF x > 1466 THEN x := x - 1 END;
+IF x > 1467 THEN x := x - 1 END;
+IF x > 1468 THEN x := x - 1 END;
+IF x > 1469 THEN x := x - 1 END;
+IF x > 1470 THEN x := x - 1 END;
+IF x > 1471 THEN x := x - 1 END;
+IF x > 1472 THEN x := x - 1 END;
+IF x > 1473 THEN x := x - 1 END;
+IF x > 1474 THEN x := x - 1 END;
+IF x > 1475 THEN x := x - 1 END;
+IF x > 1476 THEN x := x - 1 END;
+IF x > 1477 THEN x := x - 1 END;
+IF x > 1478 THEN x := x - 1 END;
+IF x > 1479 THEN x := x - 1 END;
+IF x > 1480 THEN x := x - 1 END;
+IF x > 1481 THEN x := x - 1 END;
+IF x > 1482 THEN x := x - 1 END;
+IF x > 1483 THEN x := x - 1 END;
+IF x > 1484 THEN x := x - 1 END;
+IF x > 1485 THEN x := x - 1 END;
+IF x > 1486 THEN x := x - 1 END;
+IF x > 1487 THEN x := x - 1 END;
+IF x > 1488 THEN x := x - 1 END;
+IF x > 1489 THEN x := x - 1 END;
+IF x > 1490 THEN x := x - 1 END;
+IF x > 1491 THEN x := x - 1 END;
+IF x > 1492 THEN x := x - 1 END;
+IF x > 1493 THEN x := x - 1 END;
+IF x > 1494 THEN x := x - 1 END;
+IF x > 1495 THEN x := x - 1 END;
+IF x > 1496 THEN x := x - 1 END;
+IF x > 1497 THEN x := x - 1 END;
+IF x > 1498 THEN x := x - 1 END;
+IF x > 1499 THEN x := x - 1 END;
+IF x > 1500 THEN x := x - 1 END;
+IF x > 1501 THEN x := x - 1 END;
+IF x > 1502 THEN x := x - 1 END;
+IF x > 1503 THEN x := x - 1 END;
+IF x > 1504 THEN x := x - 1 END;
+IF x > 1505 THEN x := x - 1 END;
+IF x > 1506 THEN x := x - 1 END;
+IF x > 1507 THEN x := x - 1 END;
+IF x > 1508 THEN x := x - 1 END;
+IF x > 1509 THEN x := x - 1 END;
+IF x > 1510 THEN x := x - 1 END;
+IF x > 1511 THEN x := x - 1 END;
+IF x > 1512 THEN x := x - 1 END;
+IF x > 1513 THEN x := x - 1 END;
+IF x > 1514 THEN x := x - 1 END;
+IF x > 1515 THEN x := x - 1 END;
+IF x > 1516 THEN x := x - 1 END;
+IF x > 1517 THEN x := x - 1 END;
+IF x > 1518 THEN x := x - 1 END;
+IF x > 1519 THEN x := x - 1 END;
+IF x > 1520 THEN x := x - 1 END;
+IF x > 1521 THEN x := x - 1 END;
+IF x > 1522 THEN x := x - 1 END;
+IF x > 1523 THEN x := x - 1 END;
+IF x > 1524 THEN x := x - 1 END;
+IF x > 1525 THEN x := x - 1 END;
+IF x > 1526 THEN x := x - 1 END;
+IF x > 1527 THEN x := x - 1 END;
+IF x > 1528 THEN x := x - 1 END;
+IF x > 1529 THEN x := x - 1 END;
+IF x > 1530 THEN x := x - 1 END;
+IF x > 1531 THEN x := x - 1 END;
+IF x > 1532 THEN x := x - 1 END;
+IF x > 1533 THEN x := x - 1 END;
+IF x > 1534 THEN x := x - 1 END;
+IF x > 1535 THEN x := x - 1 END;
+IF x > 1536 THEN x := x - 1 END;
+IF x > 1537 THEN x := x - 1 END;
+IF x > 1538 THEN x := x - 1 END;
+IF x > 1539 THEN x := x - 1 END;
+IF x > 1540 THEN x := x - 1 END;
+IF x > 1541 THEN x := x - 1 END;
+IF x > 1542 THEN x := x - 1 END;
+IF x > 1543 THEN x := x - 1 END;
+IF x > 1544 THEN x := x - 1 END;
+IF x > 1545 THEN x := x - 1 END;
+IF x > 1546 THEN x := x - 1 END;
+IF x > 1547 THEN x := x - 1 END;
+IF x > 1548 THEN x := x - 1 END;
+IF x > 1549 THEN x := x - 1 END;
+IF x > 1550 THEN x := x - 1 END;
+IF x > 1551 THEN x := x - 1 END;
+IF x > 1552 THEN x := x - 1 END;
+IF x > 1553 THEN x := x - 1 END;
+IF x > 1554 THEN x := x - 1 END;
+IF x > 1555 THEN x := x - 1 END;
+IF x > 1556 THEN x := x - 1 END;
+IF x > 1557 THEN x := x - 1 END;
+IF x > 1558 THEN x := x - 1 END;
+IF x > 1559 THEN x := x - 1 END;
+IF x > 1560 THEN x := x - 1 END;
+IF x > 1561 THEN x := x - 1 END;
+IF x > 1562 THEN x := x - 1 END;
+IF x > 1563 THEN x := x - 1 END;
+IF x > 1564 THEN x := x - 1 END;
+IF x > 1565 THEN x := x - 1 END;
+IF x > 1566 THEN x := x - 1 END;
+IF x > 1567 THEN x := x - 1 END;
+IF x > 1568 THEN x := x - 1 END;
+IF x > 1569 THEN x := x - 1 END;
+IF x > 1570 THEN x := x - 1 END;
+IF x > 1571 THEN x := x - 1 END;
+IF x > 1572 THEN x := x - 1 END;
+IF x > 1573 THEN x := x - 1 END;
+IF x > 1574 THEN x := x - 1 END;
+IF x > 1575 THEN x := x - 1 END;
+IF x > 1576 THEN x := x - 1 END;
+IF x > 1577 THEN x := x - 1 END;
+IF x > 1578 THEN x := x - 1 END;
+IF x > 1579 THEN x := x - 1 END;
+IF x > 1580 THEN x := x - 1 END;
+IF x > 1581 THEN x := x - 1 END;
+IF x > 1582 THEN x := x - 1 END;
+IF x > 1583 THEN x := x - 1 END;
+IF x > 1584 THEN x := x - 1 END;
+IF x > 1585 THEN x := x - 1 END;
+IF x > 1586 THEN x := x - 1 END;
+IF x > 1587 THEN x := x - 1 END;
+IF x > 1588 THEN x := x - 1 END;
+IF x > 1589 THEN x := x - 1 END;
+IF x > 1590 THEN x := x - 1 END;
+IF x > 1591 THEN x := x - 1 END;
+IF x > 1592 THEN x := x - 1 END;
+IF x > 1593 THEN x := x - 1 END;
+IF x > 1594 THEN x := x - 1 END;
+IF x > 1595 THEN x := x - 1 END;
+IF x > 1596 THEN x := x - 1 END;
+IF x > 1597 THEN x := x - 1 END;
+IF x > 1598 THEN x := x - 1 END;
+IF x > 1599 THEN x := x - 1 END;
+IF x > 1600 THEN x := x - 1 END;
+IF x > 1601 THEN x := x - 1 END;
+IF x > 1602 THEN x := x - 1 END;
+IF x > 1603 THEN x := x - 1 END;
+IF x > 1604 THEN x := x - 1 END;
+IF x > 1605 THEN x := x - 1 END;
+IF x > 1606 THEN x := x - 1 END;
+IF x > 1607 THEN x := x - 1 END;
+IF x > 1608 THEN x := x - 1 END;
+IF x > 1609 THEN x := x - 1 END;
+IF x > 1610 THEN x := x - 1 END;
+IF x > 1611 THEN x := x - 1 END;
+IF x > 1612 THEN x := x - 1 END;
+IF x > 1613 THEN x := x - 1 END;
+IF x > 1614 THEN x := x - 1 END;
+IF x > 1615 THEN x := x - 1 END;
+IF x > 1616 THEN x := x - 1 END;
+IF x > 1617 THEN x := x - 1 END;
+IF x > 1618 THEN x := x - 1 END;
+IF x > 1619 THEN x := x - 1 END;
+IF x > 1620 THEN x := x - 1 END;
+IF x > 1621 THEN x := x - 1 END;
+IF x > 1622 THEN x := x - 1 END;
+IF x > 1623 THEN x := x - 1 END;
+IF x > 1624 THEN x := x - 1 END;
+IF x > 1625 THEN x := x - 1 END;
+IF x > 1626 THEN x := x - 1 END;
+IF x > 1627 THEN x := x - 1 END;
+IF x > 1628 THEN x := x - 1 END;
+IF x > 1629 THEN x := x - 1 END;
+IF x > 1630 THEN x := x - 1 END;
+IF x > 1631 THEN x := x - 1 END;
+IF x > 1632 THEN x := x - 1 END;
+IF x > 1633 THEN x := x - 1 END;
+IF x > 1634 THEN x := x - 1 END;
+IF x > 1635 THEN x := x - 1 END;
+IF x > 1636 THEN x := x - 1 END;
+IF x > 1637 THEN x := x - 1 END;
+IF x > 1638 THEN x := x - 1 END;
+IF x > 1639 THEN x := x - 1 END;
+IF x > 1640 THEN x := x - 1 END;
+IF x > 1641 THEN x := x - 1 END;
+IF x > 1642 THEN x := x - 1 END;
+IF x > 1643 THEN x := x - 1 END;
+IF x > 1644 THEN x := x - 1 END;
+IF x > 1645 THEN x := x - 1 END;
+IF x > 1646 THEN x := x - 1 END;
+IF x > 1647 THEN x := x - 1 END;
+IF x > 1648 THEN x := x - 1 END;
+IF x > 1649 THEN x := x - 1 END;
+IF x > 1650 THEN x := x - 1 END;
+IF x > 1651 THEN x := x - 1 END;
+IF x > 1652 THEN x := x - 1 END;
+IF x > 1653 THEN x := x - 1 END;
+IF x > 1654 THEN x := x - 1 END;
+IF x > 1655 THEN x := x - 1 END;
+IF x > 1656 THEN x := x - 1 END;
+IF x > 1657 THEN x := x - 1 END;
+IF x > 1658 THEN x := x - 1 END;
+IF x > 1659 THEN x := x - 1 END;
+IF x > 1660 THEN x := x - 1 END;
+IF x > 1661 THEN x := x - 1 END;
+IF x > 1662 THEN x := x - 1 END;
+IF x > 1663 THEN x := x - 1 END;
+IF x > 1664 THEN x := x - 1 END;
+IF x > 1665 THEN x := x - 1 END;
+IF x > 1666 THEN x := x - 1 END;
+IF x > 1667 THEN x := x - 1 END;
+IF x > 1668 THEN x := x - 1 END;
+IF x > 1669 THEN x := x - 1 END;
+IF x > 1670 THEN x := x - 1 END;
+IF x > 1671 THEN x := x - 1 END;
+IF x > 1672 THEN x := x - 1 END;
+IF x > 1673 THEN x := x - 1 END;
+IF x > 1674 THEN x := x - 1 END;
+IF x > 1675 THEN x := x - 1 END;
+IF x > 1676 THEN x := x - 1 END;
+IF x > 1677 THEN x := x - 1 END;
+IF x > 1678 THEN x := x - 1 END;
+IF x > 1679 THEN x := x - 1 END;
+IF x > 1680 THEN x := x - 1 END;
+IF x > 1681 THEN x := x - 1 END;
+IF x > 1682 THEN x := x - 1 END;
+IF x > 1683 THEN x := x - 1 END;
+IF x > 1684 THEN x := x - 1 END;
+IF x > 1685 THEN x := x - 1 END;
+IF x > 1686 THEN x := x - 1 END;
+IF x > 1687 THEN x := x - 1 END;
+IF x > 1688 THEN x := x - 1 END;
+IF x > 1689 THEN x := x - 1 END;
+IF x > 1690 THEN x := x - 1 END;
+IF x > 1691 THEN x := x - 1 END;
+IF x > 1692 THEN x := x - 1 END;
+IF x > 1693 THEN x := x - 1 END;
+IF x > 1694 THEN x := x - 1 END;
+IF x > 1695 THEN x := x - 1 END;
+IF x > 1696 THEN x := x - 1 END;
+IF x > 1697 THEN x := x - 1 END;
+IF x > 1698 THEN x := x - 1 END;
+IF x > 1699 THEN x := x - 1 END;
+IF x > 1700 THEN x := x - 1 END;
+IF x > 1701 THEN x := x - 1 END;
+IF x > 1702 THEN x := x - 1 END;
+IF x > 1703 THEN x := x - 1 END;
+IF x > 1704 THEN x := x - 1 END;
+IF x > 1705 THEN x := x - 1 END;
+IF x > 1706 THEN x := x - 1 END;
+IF x > 1707 THEN x := x - 1 END;
+IF x > 1708 THEN x := x - 1 END;
+IF x > 1709 THEN x := x - 1 END;
+IF x > 1710 THEN x := x - 1 END;
+IF x > 1711 THEN x := x - 1 END;
+IF x > 1712 THEN x := x - 1 END;
+IF x > 1713 THEN x := x - 1 END;
+IF x > 1714 THEN x := x - 1 END;
+IF x > 1715 THEN x := x - 1 END;
+IF x > 1716 THEN x := x - 1 END;
+IF x > 1717 THEN x := x - 1 END;
+IF x > 1718 THEN x := x - 1 END;
+IF x > 1719 THEN x := x - 1 END;
+IF x > 1720 THEN x := x - 1 END;
+IF x > 1721 THEN x := x - 1 END;
+IF x > 1722 THEN x := x - 1 END;
+IF x > 1723 THEN x := x - 1 END;
+IF x > 1724 THEN x := x - 1 END;
+IF x > 1725 THEN x := x - 1 END;
+IF x > 1726 THEN x := x - 1 END;
+IF x > 1727 THEN x := x - 1 END;
+IF x > 1728 THEN x := x - 1 END;
+IF x > 1729 THEN x := x - 1 END;
+IF x > 1730 THEN x := x - 1 END;
+IF x > 1731 THEN x := x - 1 END;
+IF x > 1732 THEN x := x - 1 END;
+IF x > 1733 THEN x := x - 1 END;
+IF x > 1734 THEN x := x - 1 END;
+IF x > 1735 THEN x := x - 1 END;
+IF x > 1736 THEN x := x - 1 END;
+IF x > 1737 THEN x := x - 1 END;
+IF x > 1738 THEN x := x - 1 END;
+IF x > 1739 THEN x := x - 1 END;
+IF x > 1740 THEN x := x - 1 END;
+IF x > 1741 THEN x := x - 1 END;
+IF x > 1742 THEN x := x - 1 END;
+IF x > 1743 THEN x := x - 1 END;
+IF x > 1744 THEN x := x - 1 END;
+IF x > 1745 THEN x := x - 1 END;
+IF x > 1746 THEN x := x - 1 END;
+IF x > 1747 THEN x := x - 1 END;
+IF x > 1748 THEN x := x - 1 END;
+IF x > 1749 THEN x := x - 1 END;
+IF x > 1750 THEN x := x - 1 END;
+IF x > 1751 THEN x := x - 1 END;
+IF x > 1752 THEN x := x - 1 END;
+IF x > 1753 THEN x := x - 1 END;
+IF x > 1754 THEN x := x - 1 END;
+IF x > 1755 THEN x := x - 1 END;
+IF x > 1756 THEN x := x - 1 END;
+IF x > 1757 THEN x := x - 1 END;
+IF x > 1758 THEN x := x - 1 END;
+IF x > 1759 THEN x := x - 1 END;
+IF x > 1760 THEN x := x - 1 END;
+IF x > 1761 THEN x := x - 1 END;
+IF x > 1762 THEN x := x - 1 END;
+IF x > 1763 THEN x := x - 1 END;
+IF x > 1764 THEN x := x - 1 END;
+IF x > 1765 THEN x := x - 1 END;
+IF x > 1766 THEN x := x - 1 END;
+IF x > 1767 THEN x := x - 1 END;
+IF x > 1768 THEN x := x - 1 END;
+IF x > 1769 THEN x := x - 1 END;
+IF x > 1770 THEN x := x - 1 END;
+IF x > 1771 THEN x := x - 1 END;
+IF x > 1772 THEN x := x - 1 END;
+IF x > 1773 THEN x := x - 1 END;
+IF x > 1774 THEN x := x - 1 END;
+IF x > 1775 THEN x := x - 1 END;
+IF x > 1776 THEN x := x - 1 END;
+IF x > 1777 THEN x := x - 1 END;
+IF x > 1778 THEN x := x - 1 END;
+IF x > 1779 THEN x := x - 1 END;
+IF x > 1780 THEN x := x - 1 END;
+IF x > 1781 THEN x := x - 1 END;
+IF x > 1782 THEN x := x - 1 END;
+IF x > 1783 THEN x := x - 1 END;
+IF x > 1784 THEN x := x - 1 END;
+IF x > 1785 THEN x := x - 1 END;
+IF x > 1786 THEN x := x - 1 END;
+IF x > 1787 THEN x := x - 1 END;
+IF x > 1788 THEN x := x - 1 END;
+IF x > 1789 THEN x := x - 1 END;
+IF x > 1790 THEN x := x - 1 END;
+IF x > 1791 THEN x := x - 1 END;
+IF x > 1792 THEN x := x - 1 END;
+IF x > 1793 THEN x := x - 1 END;
+IF x > 1794 THEN x := x - 1 END;
+IF x > 1795 THEN x := x - 1 END;
+IF x > 1796 THEN x := x - 1 END;
+IF x > 1797 THEN x := x - 1 END;
+IF x > 1798 THEN x := x - 1 END;
+IF x > 1799 THEN x := x - 1 END;
+IF x > 1800 THEN x := x - 1 END;
+IF x > 1801 THEN x := x - 1 END;
+IF x > 1802 THEN x := x - 1 END;
+IF x > 1803 THEN x := x - 1 END;
+IF x > 1804 THEN x := x - 1 END;
+IF x > 1805 THEN x := x - 1 END;
+IF x > 1806 THEN x := x - 1 END;
+IF x > 1807 THEN x := x - 1 END;
+IF x > 1808 THEN x := x - 1 END;
+IF x > 1809 THEN x := x - 1 END;
+IF x > 1810 THEN x := x - 1 END;
+IF x > 1811 THEN x := x - 1 END;
+IF x > 1812 THEN x := x - 1 END;
+IF x > 1813 THEN x := x - 1 END;
+IF x > 1814 THEN x := x - 1 END;
+IF x > 1815 THEN x := x - 1 END;
+IF x > 1816 THEN x := x - 1 END;
+IF x > 1817 THEN x := x - 1 END;
+IF x > 1818 THEN x := x - 1 END;
+IF x > 1819 THEN x := x - 1 END;
+IF x > 1820 THEN x := x - 1 END;
+IF x > 1821 THEN x := x - 1 END;
+IF x > 1822 THEN x := x - 1 END;
+IF x > 1823 THEN x := x - 1 END;
+IF x > 1824 THEN x := x - 1 END;
+IF x > 1825 THEN x := x - 1 END;
+IF x > 1826 THEN x := x - 1 END;
+IF x > 1827 THEN x := x - 1 END;
+IF x > 1828 THEN x := x - 1 END;
+IF x > 1829 THEN x := x - 1 END;
+IF x > 1830 THEN x := x - 1 END;
+IF x > 1831 THEN x := x - 1 END;
+IF x > 1832 THEN x := x - 1 END;
+IF x > 1833 THEN x := x - 1 END;
+IF x > 1834 THEN x := x - 1 END;
+IF x > 1835 THEN x := x - 1 END;
+IF x > 1836 THEN x := x - 1 END;
+IF x > 1837 THEN x := x - 1 END;
+IF x > 1838 THEN x := x - 1 END;
+IF x > 1839 THEN x := x - 1 END;
+IF x > 1840 THEN x := x - 1 END;
+IF x > 1841 THEN x := x - 1 END;
+IF x > 1842 THEN x := x - 1 END;
+IF x > 1843 THEN x := x - 1 END;
+IF x > 1844 THEN x := x - 1 END;
+IF x > 1845 THEN x := x - 1 END;
+IF x > 1846 THEN x := x - 1 END;
+IF x > 1847 THEN x := x - 1 END;
+IF x > 1848 THEN x := x - 1 END;
+IF x > 1849 THEN x := x - 1 END;
+IF x > 1850 THEN x := x - 1 END;
+IF x > 1851 THEN x := x - 1 END;
+IF x > 1852 THEN x := x - 1 END;
+IF x > 1853 THEN x := x - 1 END;
+IF x > 1854 THEN x := x - 1 END;
+IF x > 1855 THEN x := x - 1 END;
+IF x > 1856 THEN x := x - 1 END;
+IF x > 1857 THEN x := x - 1 END;
+IF x > 1858 THEN x := x - 1 END;
+IF x > 1859 THEN x := x - 1 END;
+IF x > 1860 THEN x := x - 1 END;
+IF x > 1861 THEN x := x - 1 END;
+IF x > 1862 THEN x := x - 1 END;
+IF x > 1863 THEN x := x - 1 END;
+IF x > 1864 THEN x := x - 1 END;
+IF x > 1865 THEN x := x - 1 END;
+IF x > 1866 THEN x := x - 1 END;
+IF x > 1867 THEN x := x - 1 END;
+IF x > 1868 THEN x := x - 1 END;
+IF x > 1869 THEN x := x - 1 END;
+IF x > 1870 THEN x := x - 1 END;
+IF x > 1871 THEN x := x - 1 END;
+IF x > 1872 THEN x := x - 1 END;
+IF x > 1873 THEN x := x - 1 END;
+IF x > 1874 THEN x := x - 1 END;
+IF x > 1875 THEN x := x - 1 END;
+IF x > 1876 THEN x := x - 1 END;
+IF x > 1877 THEN x := x - 1 END;
+IF x > 1878 THEN x := x - 1 END;
+IF x > 1879 THEN x := x - 1 END;
+IF x > 1880 THEN x := x - 1 END;
+IF x > 1881 THEN x := x - 1 END;
+IF x > 1882 THEN x := x - 1 END;
+IF x > 1883 THEN x := x - 1 END;
+IF x > 1884 THEN x := x - 1 END;
+IF x > 1885 THEN x := x - 1 END;
+IF x > 1886 THEN x := x - 1 END;
+IF x > 1887 THEN x := x - 1 END;
+IF x > 1888 THEN x := x - 1 END;
+IF x > 1889 THEN x := x - 1 END;
+IF x > 1890 THEN x := x - 1 END;
+IF x > 1891 THEN x := x - 1 END;
+IF x > 1892 THEN x := x - 1 END;
+IF x > 1893 THEN x := x - 1 END;
+IF x > 1894 THEN x := x - 1 END;
+IF x > 1895 THEN x := x - 1 END;
+IF x > 1896 THEN x := x - 1 END;
+IF x > 1897 THEN x := x - 1 END;
+IF x > 1898 THEN x := x - 1 END;
+IF x > 1899 THEN x := x - 1 END;
+IF x > 1900 THEN x := x - 1 END;
+IF x > 1901 THEN x := x - 1 END;
+IF x > 1902 THEN x := x - 1 END;
+IF x > 1903 THEN x := x - 1 END;
+IF x > 1904 THEN x := x - 1 END;
+IF x > 1905 THEN x := x - 1 END;
+IF x > 1906 THEN x := x - 1 END;
+IF x > 1907 THEN x := x - 1 END;
+IF x > 1908 THEN x := x - 1 END;
+IF x > 1909 THEN x := x - 1 END;
+IF x > 1910 THEN x := x - 1 END;
+IF x > 1911 THEN x := x - 1 END;
+IF x > 1912 THEN x := x - 1 END;
+IF x > 1913 THEN x := x - 1 END;
+IF x > 1914 THEN x := x - 1 END;
+IF x > 1915 THEN x := x - 1 END;
+IF x > 1916 THEN x := x - 1 END;
+IF x > 1917 THEN x := x - 1 END;
+IF x > 1918 THEN x := x - 1 END;
+IF x > 1919 THEN x := x - 1 END;
+IF x > 1920 THEN x := x - 1 END;
+IF x > 1921 THEN x := x - 1 END;
+IF x > 1922 THEN x := x - 1 END;
+IF x > 1923 THEN x := x - 1 END;
+IF x > 1924 THEN x := x - 1 END;
+IF x > 1925 THEN x := x - 1 END;
+IF x > 1926 THEN x := x - 1 END;
+IF x > 1927 THEN x := x - 1 END;
+IF x > 1928 THEN x := x - 1 END;
+IF x > 1929 THEN x := x - 1 END;
+IF x > 1930 THEN x := x - 1 END;
+IF x > 1931 THEN x := x - 1 END;
+IF x > 1932 THEN x := x - 1 END;
+IF x > 1933 THEN x := x - 1 END;
+IF x > 1934 THEN x := x - 1 END;
+IF x > 1935 THEN x := x - 1 END;
+IF x > 1936 THEN x := x - 1 END;
+IF x > 1937 THEN x := x - 1 END;
+IF x > 1938 THEN x := x - 1 END;
+IF x > 1939 THEN x := x - 1 END;
+IF x > 1940 THEN x := x - 1 END;
+IF x > 1941 THEN x := x - 1 END;
+IF x > 1942 THEN x := x - 1 END;
+IF x > 1943 THEN x := x - 1 END;
+IF x > 1944 THEN x := x - 1 END;
+IF x > 1945 THEN x := x - 1 END;
+IF x > 1946 THEN x := x - 1 END;
+IF x > 1947 THEN x := x - 1 END;
+IF x > 1948 THEN x := x - 1 END;
+IF x > 1949 THEN x := x - 1 END;
+IF x > 1950 THEN x := x - 1 END;
+IF x > 1951 THEN x := x - 1 END;
+IF x > 1952 THEN x := x - 1 END;
+IF x > 1953 THEN x := x - 1 END;
+IF x > 1954 THEN x := x - 1 END;
+IF x > 1955 THEN x := x - 1 END;
+IF x > 1956 THEN x := x - 1 END;
+IF x > 1957 THEN x := x - 1 END;
+IF x > 1958 THEN x := x - 1 END;
+IF x > 1959 THEN x := x - 1 END;
+IF x > 1960 THEN x := x - 1 END;
+IF x > 1961 THEN x := x - 1 END;
+IF x > 1962 THEN x := x - 1 END;
+IF x > 1963 THEN x := x - 1 END;
+IF x > 1964 THEN x := x - 1 END;
+IF x > 1965 THEN x := x - 1 END;
+IF x > 1966 THEN x := x - 1 END;
+IF x > 1967 THEN x := x - 1 END;
+IF x > 1968 THEN x := x - 1 END;
+IF x > 1969 THEN x := x - 1 END;
+IF x > 1970 THEN x := x - 1 END;
+IF x > 1971 THEN x := x - 1 END;
+IF x > 1972 THEN x := x - 1 END;
+IF x > 1973 THEN x := x - 1 END;
+IF x > 1974 THEN x := x - 1 END;
+IF x > 1975 THEN x := x - 1 END;
+IF x > 1976 THEN x := x - 1 END;
+IF x > 1977 THEN x := x - 1 END;
+IF x > 1978 THEN x := x - 1 END;
+IF x > 1979 THEN x := x - 1 END;
+IF x > 1980 THEN x := x - 1 END;
+IF x > 1981 THEN x := x - 1 END;
+IF x > 1982 THEN x := x - 1 END;
+IF x > 1983 THEN x := x - 1 END;
+IF x > 1984 THEN x := x - 1 END;
+IF x > 1985 THEN x := x - 1 END;
+IF x > 1986 THEN x := x - 1 END;
+IF x > 1987 THEN x := x - 1 END;
+IF x > 1988 THEN x := x - 1 END;
+IF x > 1989 THEN x := x - 1 END;
+IF x > 1990 THEN x := x - 1 END;
+IF x > 1991 THEN x := x - 1 END;
+IF x > 1992 THEN x := x - 1 END;
+IF x > 1993 THEN x := x - 1 END;
+IF x > 1994 THEN x := x - 1 END;
+IF x > 1995 THEN x := x - 1 END;
+IF x > 1996 THEN x := x - 1 END;
+IF x > 1997 THEN x := x - 1 END;
+IF x > 1998 THEN x := x - 1 END;
+IF x > 1999 THEN x := x - 1 END;
+IF x > 2000 THEN x := x - 1 END;
+IF x > 2001 THEN x := x - 1 END;
+IF x > 2002 THEN x := x - 1 END;
+IF x > 2003 THEN x := x - 1 END;
+IF x > 2004 THEN x := x - 1 END;
+IF x > 2005 THEN x := x - 1 END;
+IF x > 2006 THEN x := x - 1 END;
+IF x > 2007 THEN x := x - 1 END;
+IF x > 2008 THEN x := x - 1 END;
+IF x > 2009 THEN x := x - 1 END;
+IF x > 2010 THEN x := x - 1 END;
+IF x > 2011 THEN x := x - 1 END;
+IF x > 2012 THEN x := x - 1 END;
+IF x > 2013 THEN x := x - 1 END;
+IF x > 2014 THEN x := x - 1 END;
+IF x > 2015 THEN x := x - 1 END;
+IF x > 2016 THEN x := x - 1 END;
+IF x > 2017 THEN x := x - 1 END;
+IF x > 2018 THEN x := x - 1 END;
+IF x > 2019 THEN x := x - 1 END;
+IF x > 2020 THEN x := x - 1 END;
+IF x > 2021 THEN x := x - 1 END;
+IF x > 2022 THEN x := x - 1 END;
+IF x > 2023 THEN x := x - 1 END;
+IF x > 2024 THEN x := x - 1 END;
+IF x > 2025 THEN x := x - 1 END;
+IF x > 2026 THEN x := x - 1 END;
+IF x > 2027 THEN x := x - 1 END;
+IF x > 2028 THEN x := x - 1 END;
+IF x > 2029 THEN x := x - 1 END;
+IF x > 2030 THEN x := x - 1 END;
+IF x > 2031 THEN x := x - 1 END;
+IF x > 2032 THEN x := x - 1 END;
+IF x > 2033 THEN x := x - 1 END;
+IF x > 2034 THEN x := x - 1 END;
+IF x > 2035 THEN x := x - 1 END;
+IF x > 2036 THEN x := x - 1 END;
+IF x > 2037 THEN x := x - 1 END;
+IF x > 2038 THEN x := x - 1 END;
+IF x > 2039 THEN x := x - 1 END;
+IF x > 2040 THEN x := x - 1 END;
+IF x > 2041 THEN x := x - 1 END;
+IF x > 2042 THEN x := x - 1 END;
+IF x > 2043 THEN x := x - 1 END;
+IF x > 2044 THEN x := x - 1 END;
+IF x > 2045 THEN x := x - 1 END;
+IF x > 2046 THEN x := x - 1 END;
+IF x > 2047 THEN x := x - 1 END;
+IF x > 2048 THEN x := x - 1 END;
+IF x > 2049 THEN x := x - 1 END;
+IF x > 2050 THEN x := x - 1 END;
+IF x > 2051 THEN x := x - 1 END;
+IF x > 2052 THEN x := x - 1 END;
+IF x > 2053 THEN x := x - 1 END;
+IF x > 2054 THEN x := x - 1 END;
+IF x > 2055 THEN x := x - 1 END;
+IF x > 2056 THEN x := x - 1 END;
+IF x > 2057 THEN x := x - 1 END;
+IF x > 2058 THEN x := x - 1 END;
+IF x > 2059 THEN x := x - 1 END;
+IF x > 2060 THEN x := x - 1 END;
+IF x > 2061 THEN x := x - 1 END;
+IF x > 2062 THEN x := x - 1 END;
+IF x > 2063 THEN x := x - 1 END;
+IF x > 2064 THEN x := x - 1 END;
+IF x > 2065 THEN x := x - 1 END;
+IF x > 2066 THEN x := x - 1 END;
+IF x > 2067 THEN x := x - 1 END;
+IF x > 2068 THEN x := x - 1 END;
+IF x > 2069 THEN x := x - 1 END;
+IF x > 2070 THEN x := x - 1 END;
+IF x > 2071 THEN x := x - 1 END;
+IF x > 2072 THEN x := x - 1 END;
+IF x > 2073 THEN x := x - 1 END;
+IF x > 2074 THEN x := x - 1 END;
+IF x > 2075 THEN x := x - 1 END;
+IF x > 2076 THEN x := x - 1 END;
+IF x > 2077 THEN x := x - 1 END;
+IF x > 2078 THEN x := x - 1 END;
+IF x > 2079 THEN x := x - 1 END;
+IF x > 2080 THEN x := x - 1 END;
+IF x > 2081 THEN x := x - 1 END;
+IF x > 2082 THEN x := x - 1 END;
+IF x > 2083 THEN x := x - 1 END;
+IF x > 2084 THEN x := x - 1 END;
+IF x > 2085 THEN x := x - 1 END;
+IF x > 2086 THEN x := x - 1 END;
+IF x > 2087 THEN x := x - 1 END;
+IF x > 2088 THEN x := x - 1 END;
+IF x > 2089 THEN x := x - 1 END;
+IF x > 2090 THEN x := x - 1 END;
+IF x > 2091 THEN x := x - 1 END;
+IF x > 2092 THEN x := x - 1 END;
+IF x > 2093 THEN x := x - 1 END;
+IF x > 2094 THEN x := x - 1 END;
+IF x > 2095 THEN x := x - 1 END;
+IF x > 2096 THEN x := x - 1 END;
+IF x > 2097 THEN x := x - 1 END;
+IF x > 2098 THEN x := x - 1 END;
+IF x > 2099 THEN x := x - 1 END;
+IF x > 2100 THEN x := x - 1 END;
+IF x > 2101 THEN x := x - 1 END;
+IF x > 2102 THEN x := x - 1 END;
+IF x > 2103 THEN x := x - 1 END;
+IF x > 2104 THEN x := x - 1 END;
+IF x > 2105 THEN x := x - 1 END;
+IF x > 2106 THEN x := x - 1 END;
+IF x > 2107 THEN x := x - 1 END;
+IF x > 2108 THEN x := x - 1 END;
+IF x > 2109 THEN x := x - 1 END;
+IF x > 2110 THEN x := x - 1 END;
+IF x > 2111 THEN x := x - 1 END;
+IF x > 2112 THEN x := x - 1 END;
+IF x > 2113 THEN x := x - 1 END;
+IF x > 2114 THEN x := x - 1 END;
+IF x > 2115 THEN x := x - 1 END;
+IF x > 2116 THEN x := x - 1 END;
+IF x > 2117 THEN x := x - 1 END;
+IF x > 2118 THEN x := x - 1 END;
+IF x > 2119 THEN x := x - 1 END;
+IF x > 2120 THEN x := x - 1 END;
+IF x > 2121 THEN x := x - 1 END;
+IF x > 2122 THEN x := x - 1 END;
+IF x > 2123 THEN x := x - 1 END;
+IF x > 2124 THEN x := x - 1 END;
+IF x > 2125 THEN x := x - 1 END;
+IF x > 2126 THEN x := x - 1 END;
+IF x > 2127 THEN x := x - 1 END;
+IF x > 2128 THEN x := x - 1 END;
+IF x > 2129 THEN x := x - 1 END;
+IF x > 2130 THEN x := x - 1 END;
+IF x > 2131 THEN x := x - 1 END;
+IF x > 2132 THEN x := x - 1 END;
+IF x > 2133 THEN x := x - 1 END;
+IF x > 2134 THEN x := x - 1 END;
+IF x > 2135 THEN x := x - 1 END;
+IF x > 2136 THEN x := x - 1 END;
+IF x > 2137 THEN x := x - 1 END;
+IF x > 2138 THEN x := x - 1 END;
+IF x > 2139 THEN x := x - 1 END;
+IF x > 2140 THEN x := x - 1 END;
+IF x > 2141 THEN x := x - 1 END;
+IF x > 2142 THEN x := x - 1 END;
+IF x > 2143 THEN x := x - 1 END;
+IF x > 2144 THEN x := x - 1 END;
+IF x > 2145 THEN x := x - 1 END;
+IF x > 2146 THEN x := x - 1 END;
+IF x > 2147 THEN x := x - 1 END;
+IF x > 2148 THEN x := x - 1 END;
+IF x > 2149 THEN x := x - 1 END;
+IF x > 2150 THEN x := x - 1 END;
+IF x > 2151 THEN x := x - 1 END;
+IF x > 2152 THEN x := x - 1 END;
+IF x > 2153 THEN x := x - 1 END;
+IF x > 2154 THEN x := x - 1 END;
+IF x > 2155 THEN x := x - 1 END;
+IF x > 2156 THEN x := x - 1 END;
+IF x > 2157 THEN x := x - 1 END;
+IF x > 2158 THEN x := x - 1 END;
+IF x > 2159 THEN x := x - 1 END;
+IF x > 2160 THEN x := x - 1 END;
+IF x > 2161 THEN x := x - 1 END;
+IF x > 2162 THEN x := x - 1 END;
+IF x > 2163 THEN x := x - 1 END;
+IF x > 2164 THEN x := x - 1 END;
+IF x > 2165 THEN x := x - 1 END;
+IF x > 2166 THEN x := x - 1 END;
+IF x > 2167 THEN x := x - 1 END;
+IF x > 2168 THEN x := x - 1 END;
+IF x > 2169 THEN x := x - 1 END;
+IF x > 2170 THEN x := x - 1 END;
+IF x > 2171 THEN x := x - 1 END;
+IF x > 2172 THEN x := x - 1 END;
+IF x > 2173 THEN x := x - 1 END;
+IF x > 2174 THEN x := x - 1 END;
+IF x > 2175 THEN x := x - 1 END;
+IF x > 2176 THEN x := x - 1 END;
+IF x > 2177 THEN x := x - 1 END;
+IF x > 2178 THEN x := x - 1 END;
+IF x > 2179 THEN x := x - 1 END;
+IF x > 2180 THEN x := x - 1 END;
+IF x > 2181 THEN x := x - 1 END;
+IF x > 2182 THEN x := x - 1 END;
+IF x > 2183 THEN x := x - 1 END;
+IF x > 2184 THEN x := x - 1 END;
+IF x > 2185 THEN x := x - 1 END;
+IF x > 2186 THEN x := x - 1 END;
+IF x > 2187 THEN x := x - 1 END;
+IF x > 2188 THEN x := x - 1 END;
+IF x > 2189 THEN x := x - 1 END;
+IF x > 2190 THEN x := x - 1 END;
+IF x > 2191 THEN x := x - 1 END;
+IF x > 2192 THEN x := x - 1 END;
+IF x > 2193 THEN x := x - 1 END;
+IF x > 2194 THEN x := x - 1 END;
+IF x > 2195 THEN x := x - 1 END;
+IF x > 2196 THEN x := x - 1 END;
+IF x > 2197 THEN x := x - 1 END;
+IF x > 2198 THEN x := x - 1 END;
+IF x > 2199 THEN x := x - 1 END;
+IF x > 2200 THEN x := x - 1 END;
+IF x > 2201 THEN x := x - 1 END;
+IF x > 2202 THEN x := x - 1 END;
+IF x > 2203 THEN x := x - 1 END;
+IF x > 2204 THEN x := x - 1 END;
+IF x > 2205 THEN x := x - 1 END;
+IF x > 2206 THEN x := x - 1 END;
+IF x > 2207 THEN x := x - 1 END;
+IF x > 2208 THEN x := x - 1 END;
+IF x > 2209 THEN x := x - 1 END;
+IF x > 2210 THEN x := x - 1 END;
+IF x > 2211 THEN x := x - 1 END;
+IF x > 2212 THEN x := x - 1 END;
+IF x > 2213 THEN x := x - 1 END;
+IF x > 2214 THEN x := x - 1 END;
+IF x > 2215 THEN x := x - 1 END;
+IF x > 2216 THEN x := x - 1 END;
+IF x > 2217 THEN x := x - 1 END;
+IF x > 2218 THEN x := x - 1 END;
+IF x > 2219 THEN x := x - 1 END;
+IF x > 2220 THEN x := x - 1 END;
+IF x > 2221 THEN x := x - 1 END;
+IF x > 2222 THEN x := x - 1 END;
+IF x > 2223 THEN x := x - 1 END;
+IF x > 2224 THEN x := x - 1 END;
+IF x > 2225 THEN x := x - 1 END;
+IF x > 2226 THEN x := x - 1 END;
+IF x > 2227 THEN x := x - 1 END;
+IF x > 2228 THEN x := x - 1 END;
+IF x > 2229 THEN x := x - 1 END;
+IF x > 2230 THEN x := x - 1 END;
+IF x > 2231 THEN x := x - 1 END;
+IF x > 2232 THEN x := x - 1 END;
+IF x > 2233 THEN x := x - 1 END;
+IF x > 2234 THEN x := x - 1 END;
+IF x > 2235 THEN x := x - 1 END;
+IF x > 2236 THEN x := x - 1 END;
+IF x > 2237 THEN x := x - 1 END;
+IF x > 2238 THEN x := x - 1 END;
+IF x > 2239 THEN x := x - 1 END;
+IF x > 2240 THEN x := x - 1 END;
+IF x > 2241 THEN x := x - 1 END;
+IF x > 2242 THEN x := x - 1 END;
+IF x > 2243 THEN x := x - 1 END;
+IF x > 2244 THEN x := x - 1 END;
+IF x > 2245 THEN x := x - 1 END;
+IF x > 2246 THEN x := x - 1 END;
+IF x > 2247 THEN x := x - 1 END;
+IF x > 2248 THEN x := x - 1 END;
+IF x > 2249 THEN x := x - 1 END;
+IF x > 2250 THEN x := x - 1 END;
+IF x > 2251 THEN x := x - 1 END;
+IF x > 2252 THEN x := x - 1 END;
+IF x > 2253 THEN x := x - 1 END;
+IF x > 2254 THEN x := x - 1 END;
+IF x > 2255 THEN x := x - 1 END;
+IF x > 2256 THEN x := x - 1 END;
+IF x > 2257 THEN x := x - 1 END;
+IF x > 2258 THEN x := x - 1 END;
+IF x > 2259 THEN x := x - 1 END;
+IF x > 2260 THEN x := x - 1 END;
+IF x > 2261 THEN x := x - 1 END;
+IF x > 2262 THEN x := x - 1 END;
+IF x > 2263 THEN x := x - 1 END;
+IF x > 2264 THEN x := x - 1 END;
+IF x > 2265 THEN x := x - 1 END;
+IF x > 2266 THEN x := x - 1 END;
+IF x > 2267 THEN x := x - 1 END;
+IF x > 2268 THEN x := x - 1 END;
+IF x > 2269 THEN x := x - 1 END;
+IF x > 2270 THEN x := x - 1 END;
+IF x > 2271 THEN x := x - 1 END;
+IF x > 2272 THEN x := x - 1 END;
+IF x > 2273 THEN x := x - 1 END;
+IF x > 2274 THEN x := x - 1 END;
+IF x > 2275 THEN x := x - 1 END;
+IF x > 2276 THEN x := x - 1 END;
+IF x > 2277 THEN x := x - 1 END;
+IF x > 2278 THEN x := x - 1 END;
+IF x > 2279 THEN x := x - 1 END;
+IF x > 2280 THEN x := x - 1 END;
+IF x > 2281 THEN x := x - 1 END;
+IF x > 2282 THEN x := x - 1 END;
+IF x > 2283 THEN x := x - 1 END;
+IF x > 2284 THEN x := x - 1 END;
+IF x > 2285 THEN x := x - 1 END;
+IF x > 2286 THEN x := x - 1 END;
+IF x > 2287 THEN x := x - 1 END;
+IF x > 2288 THEN x := x - 1 END;
+IF x > 2289 THEN x := x - 1 END;
+IF x > 2290 THEN x := x - 1 END;
+IF x > 2291 THEN x := x - 1 END;
+IF x > 2292 THEN x := x - 1 END;
+IF x > 2293 THEN x := x - 1 END;
+IF x > 2294 THEN x := x - 1 END;
+IF x > 2295 THEN x := x - 1 END;
+IF x > 2296 THEN x := x - 1 END;
+IF x > 2297 THEN x := x - 1 END;
+IF x > 2298 THEN x := x - 1 END;
+IF x > 2299 THEN x := x - 1 END;
+IF x > 2300 THEN x := x - 1 END;
+IF x > 2301 THEN x := x - 1 END;
+IF x > 2302 THEN x := x - 1 END;
+IF x > 2303 THEN x := x - 1 END;
+IF x > 2304 THEN x := x - 1 END;
+IF x > 2305 THEN x := x - 1 END;
+IF x > 2306 THEN x := x - 1 END;
+IF x > 2307 THEN x := x - 1 END;
+IF x > 2308 THEN x := x - 1 END;
+IF x > 2309 THEN x := x - 1 END;
+IF x > 2310 THEN x := x - 1 END;
+IF x > 2311 THEN x := x - 1 END;
+IF x > 2312 THEN x := x - 1 END;
+IF x > 2313 THEN x := x - 1 END;
+IF x > 2314 THEN x := x - 1 END;
+IF x > 2315 THEN x := x - 1 END;
+IF x > 2316 THEN x := x - 1 END;
+IF x > 2317 THEN x := x - 1 END;
+IF x > 2318 THEN x := x - 1 END;
+IF x > 2319 THEN x := x - 1 END;
+IF x > 2320 THEN x := x - 1 END;
+IF x > 2321 THEN x := x - 1 END;
+IF x > 2322 THEN x := x - 1 END;
+IF x > 2323 THEN x := x - 1 END;
+IF x > 2324 THEN x := x - 1 END;
+IF x > 2325 THEN x := x - 1 END;
+IF x > 2326 THEN x := x - 1 END;
+IF x > 2327 THEN x := x - 1 END;
+IF x > 2328 THEN x := x - 1 END;
+IF x > 2329 THEN x := x - 1 END;
+IF x > 2330 THEN x := x - 1 END;
+IF x > 2331 THEN x := x - 1 END;
+IF x > 2332 THEN x := x - 1 END;
+IF x > 2333 THEN x := x - 1 END;
+IF x > 2334 THEN x := x - 1 END;
+IF x > 2335 THEN x := x - 1 END;
+IF x > 2336 THEN x := x - 1 END;
+IF x > 2337 THEN x := x - 1 END;
+IF x > 2338 THEN x := x - 1 END;
+IF x > 2339 THEN x := x - 1 END;
+IF x > 2340 THEN x := x - 1 END;
+IF x > 2341 THEN x := x - 1 END;
+IF x > 2342 THEN x := x - 1 END;
+IF x > 2343 THEN x := x - 1 END;
+IF x > 2344 THEN x := x - 1 END;
+IF x > 2345 THEN x := x - 1 END;
+IF x > 2346 THEN x := x - 1 END;
+IF x > 2347 THEN x := x - 1 END;
+IF x > 2348 THEN x := x - 1 END;
+IF x > 2349 THEN x := x - 1 END;
+IF x > 2350 THEN x := x - 1 END;
+IF x > 2351 THEN x := x - 1 END;
+IF x > 2352 THEN x := x - 1 END;
+IF x > 2353 THEN x := x - 1 END;
+IF x > 2354 THEN x := x - 1 END;
+IF x > 2355 THEN x := x - 1 END;
+IF x > 2356 THEN x := x - 1 END;
+IF x > 2357 THEN x := x - 1 END;
+IF x > 2358 THEN x := x - 1 END;
+IF x > 2359 THEN x := x - 1 END;
+IF x > 2360 THEN x := x - 1 END;
+IF x > 2361 THEN x := x - 1 END;
+IF x > 2362 THEN x := x - 1 END;
+IF x > 2363 THEN x := x - 1 END;
+IF x > 2364 THEN x := x - 1 END;
+IF x > 2365 THEN x := x - 1 END;
+IF x > 2366 THEN x := x - 1 END;
+IF x > 2367 THEN x := x - 1 END;
+IF x > 2368 THEN x := x - 1 END;
+IF x > 2369 THEN x := x - 1 END;
+IF x > 2370 THEN x := x - 1 END;
+IF x > 2371 THEN x := x - 1 END;
+IF x > 2372 THEN x := x - 1 END;
+IF x > 2373 THEN x := x - 1 END;
+IF x > 2374 THEN x := x - 1 END;
+IF x > 2375 THEN x := x - 1 END;
+IF x > 2376 THEN x := x - 1 END;
+IF x > 2377 THEN x := x - 1 END;
+IF x > 2378 THEN x := x - 1 END;
+IF x > 2379 THEN x := x - 1 END;
+IF x > 2380 THEN x := x - 1 END;
+IF x > 2381 THEN x := x - 1 END;
+IF x > 2382 THEN x := x - 1 END;
+IF x > 2383 THEN x := x - 1 END;
+IF x > 2384 THEN x := x - 1 END;
+IF x > 2385 THEN x := x - 1 END;
+IF x > 2386 THEN x := x - 1 END;
+IF x > 2387 THEN x := x - 1 END;
+IF x > 2388 THEN x := x - 1 END;
+IF x > 2389 THEN x := x - 1 END;
+IF x > 2390 THEN x := x - 1 END;
+IF x > 2391 THEN x := x - 1 END;
+IF x > 2392 THEN x := x - 1 END;
+IF x > 2393 THEN x := x - 1 END;
+IF x > 2394 THEN x := x - 1 END;
+IF x > 2395 THEN x := x - 1 END;
+IF x > 2396 THEN x := x - 1 END;
+IF x > 2397 THEN x := x - 1 END;
+IF x > 2398 THEN x := x - 1 END;
+IF x > 2399 THEN x := x - 1 END;
+IF x > 2400 THEN x := x - 1 END;
+IF x > 2401 THEN x := x - 1 END;
+IF x > 2402 THEN x := x - 1 END;
+IF x > 2403 THEN x := x - 1 END;
+IF x > 2404 THEN x := x - 1 END;
+IF x > 2405 THEN x := x - 1 END;
+IF x > 2406 THEN x := x - 1 END;
+IF x > 2407 THEN x := x - 1 END;
+IF x > 2408 THEN x := x - 1 END;
+IF x > 2409 THEN x := x - 1 END;
+IF x > 2410 THEN x := x - 1 END;
+IF x > 2411 THEN x := x - 1 END;
+IF x > 2412 THEN x := x - 1 END;
+IF x > 2413 THEN x := x - 1 END;
+IF x > 2414 THEN x := x - 1 END;
+IF x > 2415 THEN x := x - 1 END;
+IF x > 2416 THEN x := x - 1 END;
+IF x > 2417 THEN x := x - 1 END;
+IF x > 2418 THEN x := x - 1 END;
+IF x > 2419 THEN x := x - 1 END;
+IF x > 2420 THEN x := x - 1 END;
+IF x > 2421 THEN x := x - 1 END;
+IF x > 2422 THEN x := x - 1 END;
+IF x > 2423 THEN x := x - 1 END;
+IF x > 2424 THEN x := x - 1 END;
+IF x > 2425 THEN x := x - 1 END;
+IF x > 2426 THEN x := x - 1 END;
+IF x > 2427 THEN x := x - 1 END;
+IF x > 2428 THEN x := x - 1 END;
+IF x > 2429 THEN x := x - 1 END;
+IF x > 2430 THEN x := x - 1 END;
+IF x > 2431 THEN x := x - 1 END;
+IF x > 2432 THEN x := x - 1 END;
+IF x > 2433 THEN x := x - 1 END;
+IF x > 2434 THEN x := x - 1 END;
+IF x > 2435 THEN x := x - 1 END;
+IF x > 2436 THEN x := x - 1 END;
+IF x > 2437 THEN x := x - 1 END;
+IF x > 2438 THEN x := x - 1 END;
+IF x > 2439 THEN x := x - 1 END;
+IF x > 2440 THEN x := x - 1 END;
+IF x > 2441 THEN x := x - 1 END;
+IF x > 2442 THEN x := x - 1 END;
+IF x > 2443 THEN x := x - 1 END;
+IF x > 2444 THEN x := x - 1 END;
+IF x > 2445 THEN x := x - 1 END;
+IF x > 2446 THEN x := x - 1 END;
+IF x > 2447 THEN x := x - 1 END;
+IF x > 2448 THEN x := x - 1 END;
+IF x > 2449 THEN x := x - 1 END;
+IF x > 2450 THEN x := x - 1 END;
+IF x > 2451 THEN x := x - 1 END;
+IF x > 2452 THEN x := x - 1 END;
+IF x > 2453 THEN x := x - 1 END;
+IF x > 2454 THEN x := x - 1 END;
+IF x > 2455 THEN x := x - 1 END;
+IF x > 2456 THEN x := x - 1 END;
+IF x > 2457 THEN x := x - 1 END;
+IF x > 2458 THEN x := x - 1 END;
+IF x > 2459 THEN x := x - 1 END;
+IF x > 2460 THEN x := x - 1 END;
+IF x > 2461 THEN x := x - 1 END;
+IF x > 2462 THEN x := x - 1 END;
+IF x > 2463 THEN x := x - 1 END;
+IF x > 2464 THEN x := x - 1 END;
+IF x > 2465 THEN x := x - 1 END;
+IF x > 2466 THEN x := x - 1 END;
+IF x > 2467 THEN x := x - 1 END;
+IF x > 2468 THEN x := x - 1 END;
+IF x > 2469 THEN x := x - 1 END;
+IF x > 2470 THEN x := x - 1 END;
+IF x > 2471 THEN x := x - 1 END;
+IF x > 2472 THEN x := x - 1 END;
+IF x > 2473 THEN x := x - 1 END;
+IF x > 2474 THEN x := x - 1 END;
+IF x > 2475 THEN x := x - 1 END;
+IF x > 2476 THEN x := x - 1 END;
+IF x > 2477 THEN x := x - 1 END;
+IF x > 2478 THEN x := x - 1 END;
+IF x > 2479 THEN x := x - 1 END;
+IF x > 2480 THEN x := x - 1 END;
+IF x > 2481 THEN x := x - 1 END;
+IF x > 2482 THEN x := x - 1 END;
+IF x > 2483 THEN x := x - 1 END;
+IF x > 2484 THEN x := x - 1 END;
+IF x > 2485 THEN x := x - 1 END;
+IF x > 2486 THEN x := x - 1 END;
+IF x > 2487 THEN x := x - 1 END;
+IF x > 2488 THEN x := x - 1 END;
+IF x > 2489 THEN x := x - 1 END;
+IF x > 2490 THEN x := x - 1 END;
+IF x > 2491 THEN x := x - 1 END;
+IF x > 2492 THEN x := x - 1 END;
+IF x > 2493 THEN x := x - 1 END;
+IF x > 2494 THEN x := x - 1 END;
+IF x > 2495 THEN x := x - 1 END;
+IF x > 2496 THEN x := x - 1 END;
+IF x > 2497 THEN x := x - 1 END;
+IF x > 2498 THEN x := x - 1 END;
+IF x > 2499 THEN x := x - 1 END;
+IF x > 2500 THEN x := x - 1 END;
+IF x > 2501 THEN x := x - 1 END;
+IF x > 2502 THEN x := x - 1 END;
+IF x > 2503 THEN x := x - 1 END;
+IF x > 2504 THEN x := x - 1 END;
+IF x > 2505 THEN x := x - 1 END;
+IF x > 2506 THEN x := x - 1 END;
+IF x > 2507 THEN x := x - 1 END;
+IF x > 2508 THEN x := x - 1 END;
+IF x > 2509 THEN x := x - 1 END;
+IF x > 2510 THEN x := x - 1 END;
+IF x > 2511 THEN x := x - 1 END;
+IF x > 2512 THEN x := x - 1 END;
+IF x > 2513 THEN x := x - 1 END;
+IF x > 2514 THEN x := x - 1 END;
+IF x > 2515 THEN x := x - 1 END;
+IF x > 2516 THEN x := x - 1 END;
+IF x > 2517 THEN x := x - 1 END;
+IF x > 2518 THEN x := x - 1 END;
+IF x > 2519 THEN x := x - 1 END;
+IF x > 2520 THEN x := x - 1 END;
+IF x > 2521 THEN x := x - 1 END;
+IF x > 2522 THEN x := x - 1 END;
+IF x > 2523 THEN x := x - 1 END;
+IF x > 2524 THEN x := x - 1 END;
+IF x > 2525 THEN x := x - 1 END;
+IF x > 2526 THEN x := x - 1 END;
+IF x > 2527 THEN x := x - 1 END;
+IF x > 2528 THEN x := x - 1 END;
+IF x > 2529 THEN x := x - 1 END;
+IF x > 2530 THEN x := x - 1 END;
+IF x > 2531 THEN x := x - 1 END;
+IF x > 2532 THEN x := x - 1 END;
+IF x > 2533 THEN x := x - 1 END;
+IF x > 2534 THEN x := x - 1 END;
+IF x > 2535 THEN x := x - 1 END;
+IF x > 2536 THEN x := x - 1 END;
+IF x > 2537 THEN x := x - 1 END;
+IF x > 2538 THEN x := x - 1 END;
+IF x > 2539 THEN x := x - 1 END;
+IF x > 2540 THEN x := x - 1 END;
+IF x > 2541 THEN x := x - 1 END;
+IF x > 2542 THEN x := x - 1 END;
+IF x > 2543 THEN x := x - 1 END;
+IF x > 2544 THEN x := x - 1 END;
+IF x > 2545 THEN x := x - 1 END;
+IF x > 2546 THEN x := x - 1 END;
+IF x > 2547 THEN x := x - 1 END;
+IF x > 2548 THEN x := x - 1 END;
+IF x > 2549 THEN x := x - 1 END;
+IF x > 2550 THEN x := x - 1 END;
+IF x > 2551 THEN x := x - 1 END;
+IF x > 2552 THEN x := x - 1 END;
+IF x > 2553 THEN x := x - 1 END;
+IF x > 2554 THEN x := x - 1 END;
+IF x > 2555 THEN x := x - 1 END;
+IF x > 2556 THEN x := x - 1 END;
+IF x > 2557 THEN x := x - 1 END;
+IF x > 2558 THEN x := x - 1 END;
+IF x > 2559 THEN x := x - 1 END;
+IF x > 2560 THEN x := x - 1 END;
+IF x > 2561 THEN x := x - 1 END;
+IF x > 2562 THEN x := x - 1 END;
+IF x > 2563 THEN x := x - 1 END;
+IF x > 2564 THEN x := x - 1 END;
+IF x > 2565 THEN x := x - 1 END;
+IF x > 2566 THEN x := x - 1 END;
+IF x > 2567 THEN x := x - 1 END;
+IF x > 2568 THEN x := x - 1 END;
+IF x > 2569 THEN x := x - 1 END;
+IF x > 2570 THEN x := x - 1 END;
+IF x > 2571 THEN x := x - 1 END;
+IF x > 2572 THEN x := x - 1 END;
+IF x > 2573 THEN x := x - 1 END;
+IF x > 2574 THEN x := x - 1 END;
+IF x > 2575 THEN x := x - 1 END;
+IF x > 2576 THEN x := x - 1 END;
+IF x > 2577 THEN x := x - 1 END;
+IF x > 2578 THEN x := x - 1 END;
+IF x > 2579 THEN x := x - 1 END;
+IF x > 2580 THEN x := x - 1 END;
+IF x > 2581 THEN x := x - 1 END;
+IF x > 2582 THEN x := x - 1 END;
+IF x > 2583 THEN x := x - 1 END;
+IF x > 2584 THEN x := x - 1 END;
+IF x > 2585 THEN x := x - 1 END;
+IF x > 2586 THEN x := x - 1 END;
+IF x > 2587 THEN x := x - 1 END;
+IF x > 2588 THEN x := x - 1 END;
+IF x > 2589 THEN x := x - 1 END;
+IF x > 2590 THEN x := x - 1 END;
+IF x > 2591 THEN x := x - 1 END;
+IF x > 2592 THEN x := x - 1 END;
+IF x > 2593 THEN x := x - 1 END;
+IF x > 2594 THEN x := x - 1 END;
+IF x > 2595 THEN x := x - 1 END;
+IF x > 2596 THEN x := x - 1 END;
+IF x > 2597 THEN x := x - 1 END;
+IF x > 2598 THEN x := x - 1 END;
+IF x > 2599 THEN x := x - 1 END;
+IF x > 2600 THEN x := x - 1 END;
+IF x > 2601 THEN x := x - 1 END;
+IF x > 2602 THEN x := x - 1 END;
+IF x > 2603 THEN x := x - 1 END;
+IF x > 2604 THEN x := x - 1 END;
+IF x > 2605 THEN x := x - 1 END;
+IF x > 2606 THEN x := x - 1 END;
+IF x > 2607 THEN x := x - 1 END;
+IF x > 2608 THEN x := x - 1 END;
+IF x > 2609 THEN x := x - 1 END;
+IF x > 2610 THEN x := x - 1 END;
+IF x > 2611 THEN x := x - 1 END;
+IF x > 2612 THEN x := x - 1 END;
+IF x > 2613 THEN x := x - 1 END;
+IF x > 2614 THEN x := x - 1 END;
+IF x > 2615 THEN x := x - 1 END;
+IF x > 2616 THEN x := x - 1 END;
+IF x > 2617 THEN x := x - 1 END;
+IF x > 2618 THEN x := x - 1 END;
+IF x > 2619 THEN x := x - 1 END;
+IF x > 2620 THEN x := x - 1 END;
+IF x > 2621 THEN x := x - 1 END;
+IF x > 2622 THEN x := x - 1 END;
+IF x > 2623 THEN x := x - 1 END;
+IF x > 2624 THEN x := x - 1 END;
+IF x > 2625 THEN x := x - 1 END;
+IF x > 2626 THEN x := x - 1 END;
+IF x > 2627 THEN x := x - 1 END;
+IF x > 2628 THEN x := x - 1 END;
+IF x > 2629 THEN x := x - 1 END;
+IF x > 2630 THEN x := x - 1 END;
+IF x > 2631 THEN x := x - 1 END;
+IF x > 2632 THEN x := x - 1 END;
+IF x > 2633 THEN x := x - 1 END;
+IF x > 2634 THEN x := x - 1 END;
+IF x > 2635 THEN x := x - 1 END;
+IF x > 2636 THEN x := x - 1 END;
+IF x > 2637 THEN x := x - 1 END;
+IF x > 2638 THEN x := x - 1 END;
+IF x > 2639 THEN x := x - 1 END;
+IF x > 2640 THEN x := x - 1 END;
+IF x > 2641 THEN x := x - 1 END;
+IF x > 2642 THEN x := x - 1 END;
+IF x > 2643 THEN x := x - 1 END;
+IF x > 2644 THEN x := x - 1 END;
+IF x > 2645 THEN x := x - 1 END;
+IF x > 2646 THEN x := x - 1 END;
+IF x > 2647 THEN x := x - 1 END;
+IF x > 2648 THEN x := x - 1 END;
+IF x > 2649 THEN x := x - 1 END;
+IF x > 2650 THEN x := x - 1 END;
+IF x > 2651 THEN x := x - 1 END;
+IF x > 2652 THEN x := x - 1 END;
+IF x > 2653 THEN x := x - 1 END;
+IF x > 2654 THEN x := x - 1 END;
+IF x > 2655 THEN x := x - 1 END;
+IF x > 2656 THEN x := x - 1 END;
+IF x > 2657 THEN x := x - 1 END;
+IF x > 2658 THEN x := x - 1 END;
+IF x > 2659 THEN x := x - 1 END;
+IF x > 2660 THEN x := x - 1 END;
+IF x > 2661 THEN x := x - 1 END;
+IF x > 2662 THEN x := x - 1 END;
+IF x > 2663 THEN x := x - 1 END;
+IF x > 2664 THEN x := x - 1 END;
+IF x > 2665 THEN x := x - 1 END;
+IF x > 2666 THEN x := x - 1 END;
+IF x > 2667 THEN x := x - 1 END;
+IF x > 2668 THEN x := x - 1 END;
+IF x > 2669 THEN x := x - 1 END;
+IF x > 2670 THEN x := x - 1 END;
+IF x > 2671 THEN x := x - 1 END;
+IF x > 2672 THEN x := x - 1 END;
+IF x > 2673 THEN x := x - 1 END;
+IF x > 2674 THEN x := x - 1 END;
+IF x > 2675 THEN x := x - 1 END;
+IF x > 2676 THEN x := x - 1 END;
+IF x > 2677 THEN x := x - 1 END;
+IF x > 2678 THEN x := x - 1 END;
+IF x > 2679 THEN x := x - 1 END;
+IF x > 2680 THEN x := x - 1 END;
+IF x > 2681 THEN x := x - 1 END;
+IF x > 2682 THEN x := x - 1 END;
+IF x > 2683 THEN x := x - 1 END;
+IF x > 2684 THEN x := x - 1 END;
+IF x > 2685 THEN x := x - 1 END;
+IF x > 2686 THEN x := x - 1 END;
+IF x > 2687 THEN x := x - 1 END;
+IF x > 2688 THEN x := x - 1 END;
+IF x > 2689 THEN x := x - 1 END;
+IF x > 2690 THEN x := x - 1 END;
+IF x > 2691 THEN x := x - 1 END;
+IF x > 2692 THEN x := x - 1 END;
+IF x > 2693 THEN x := x - 1 END;
+IF x > 2694 THEN x := x - 1 END;
+IF x > 2695 THEN x := x - 1 END;
+IF x > 2696 THEN x := x - 1 END;
+IF x > 2697 THEN x := x - 1 END;
+IF x > 2698 THEN x := x - 1 END;
+IF x > 2699 THEN x := x - 1 END;
+IF x > 2700 THEN x := x - 1 END;
+IF x > 2701 THEN x := x - 1 END;
+IF x > 2702 THEN x := x - 1 END;
+IF x > 2703 THEN x := x - 1 END;
+IF x > 2704 THEN x := x - 1 END;
+IF x > 2705 THEN x := x - 1 END;
+IF x > 2706 THEN x := x - 1 END;
+IF x > 2707 THEN x := x - 1 END;
+IF x > 2708 THEN x := x - 1 END;
+IF x > 2709 THEN x := x - 1 END;
+IF x > 2710 THEN x := x - 1 END;
+IF x > 2711 THEN x := x - 1 END;
+IF x > 2712 THEN x := x - 1 END;
+IF x > 2713 THEN x := x - 1 END;
+IF x > 2714 THEN x := x - 1 END;
+IF x > 2715 THEN x := x - 1 END;
+IF x > 2716 THEN x := x - 1 END;
+IF x > 2717 THEN x := x - 1 END;
+IF x > 2718 THEN x := x - 1 END;
+IF x > 2719 THEN x := x - 1 END;
+IF x > 2720 THEN x := x - 1 END;
+IF x > 2721 THEN x := x - 1 END;
+IF x > 2722 THEN x := x - 1 END;
+IF x > 2723 THEN x := x - 1 END;
+IF x > 2724 THEN x := x - 1 END;
+IF x > 2725 THEN x := x - 1 END;
+IF x > 2726 THEN x := x - 1 END;
+IF x > 2727 THEN x := x - 1 END;
+IF x > 2728 THEN x := x - 1 END;
+IF x > 2729 THEN x := x - 1 END;
+IF x > 2730 THEN x := x - 1 END;
+IF x > 2731 THEN x := x - 1 END;
+IF x > 2732 THEN x := x - 1 END;
+IF x > 2733 THEN x := x - 1 END;
+IF x > 2734 THEN x := x - 1 END;
+IF x > 2735 THEN x := x - 1 END;
+IF x > 2736 THEN x := x - 1 END;
+IF x > 2737 THEN x := x - 1 END;
+IF x > 2738 THEN x := x - 1 END;
+IF x > 2739 THEN x := x - 1 END;
+IF x > 2740 THEN x := x - 1 END;
+IF x > 2741 THEN x := x - 1 END;
+IF x > 2742 THEN x := x - 1 END;
+IF x > 2743 THEN x := x - 1 END;
+IF x > 2744 THEN x := x - 1 END;
+IF x > 2745 THEN x := x - 1 END;
+IF x > 2746 THEN x := x - 1 END;
+IF x > 2747 THEN x := x - 1 END;
+IF x > 2748 THEN x := x - 1 END;
+IF x > 2749 THEN x := x - 1 END;
+IF x > 2750 THEN x := x - 1 END;
+IF x > 2751 THEN x := x - 1 END;
+IF x > 2752 THEN x := x - 1 END;
+IF x > 2753 THEN x := x - 1 END;
+IF x > 2754 THEN x := x - 1 END;
+IF x > 2755 THEN x := x - 1 END;
+IF x > 2756 THEN x := x - 1 END;
+IF x > 2757 THEN x := x - 1 END;
+IF x > 2758 THEN x := x - 1 END;
+IF x > 2759 THEN x := x - 1 END;
+IF x > 2760 THEN x := x - 1 END;
+IF x > 2761 THEN x := x - 1 END;
+IF x > 2762 THEN x := x - 1 END;
+IF x > 2763 THEN x := x - 1 END;
+IF x > 2764 THEN x := x - 1 END;
+IF x > 2765 THEN x := x - 1 END;
+IF x > 2766 THEN x := x - 1 END;
+IF x > 2767 THEN x := x - 1 END;
+IF x > 2768 THEN x := x - 1 END;
+IF x > 2769 THEN x := x - 1 END;
+IF x > 2770 THEN x := x - 1 END;
+IF x > 2771 THEN x := x - 1 END;
+IF x > 2772 THEN x := x - 1 END;
+IF x > 2773 THEN x := x - 1 END;
+IF x > 2774 THEN x := x - 1 END;
+IF x > 2775 THEN x := x - 1 END;
+IF x > 2776 THEN x := x - 1 END;
+IF x > 2777 THEN x := x - 1 END;
+IF x > 2778 THEN x := x - 1 END;
+IF x > 2779 THEN x := x - 1 END;
+IF x > 2780 THEN x := x - 1 END;
+IF x > 2781 THEN x := x - 1 END;
+IF x > 2782 THEN x := x - 1 END;
+IF x > 2783 THEN x := x - 1 END;
+IF x > 2784 THEN x := x - 1 END;
+IF x > 2785 THEN x := x - 1 END;
+IF x > 2786 THEN x := x - 1 END;
+IF x > 2787 THEN x := x - 1 END;
+IF x > 2788 THEN x := x - 1 END;
+IF x > 2789 THEN x := x - 1 END;
+IF x > 2790 THEN x := x - 1 END;
+IF x > 2791 THEN x := x - 1 END;
+IF x > 2792 THEN x := x - 1 END;
+IF x > 2793 THEN x := x - 1 END;
+IF x > 2794 THEN x := x - 1 END;
+IF x > 2795 THEN x := x - 1 END;
+IF x > 2796 THEN x := x - 1 END;
+IF x > 2797 THEN x := x - 1 END;
+IF x > 2798 THEN x := x - 1 END;
+IF x > 2799 THEN x := x - 1 END;
+IF x > 2800 THEN x := x - 1 END;
+IF x > 2801 THEN x := x - 1 END;
+IF x > 2802 THEN x := x - 1 END;
+IF x > 2803 THEN x := x - 1 END;
+IF x > 2804 THEN x := x - 1 END;
+IF x > 2805 THEN x := x - 1 END;
+IF x > 2806 THEN x := x - 1 END;
+IF x > 2807 THEN x := x - 1 END;
+IF x > 2808 THEN x := x - 1 END;
+IF x > 2809 THEN x := x - 1 END;
+IF x > 2810 THEN x := x - 1 END;
+IF x > 2811 THEN x := x - 1 END;
+IF x > 2812 THEN x := x - 1 END;
+IF x > 2813 THEN x := x - 1 END;
+IF x > 2814 THEN x := x - 1 END;
+IF x > 2815 THEN x := x - 1 END;
+IF x > 2816 THEN x := x - 1 END;
+IF x > 2817 THEN x := x - 1 END;
+IF x > 2818 THEN x := x - 1 END;
+IF x > 2819 THEN x := x - 1 END;
+IF x > 2820 THEN x := x - 1 END;
+IF x > 2821 THEN x := x - 1 END;
+IF x > 2822 THEN x := x - 1 END;
+IF x > 2823 THEN x := x - 1 END;
+IF x > 2824 THEN x := x - 1 END;
+IF x > 2825 THEN x := x - 1 END;
+IF x > 2826 THEN x := x - 1 END;
+IF x > 2827 THEN x := x - 1 END;
+IF x > 2828 THEN x := x - 1 END;
+IF x > 2829 THEN x := x - 1 END;
+IF x > 2830 THEN x := x - 1 END;
+IF x > 2831 THEN x := x - 1 END;
+IF x > 2832 THEN x := x - 1 END;
+IF x > 2833 THEN x := x - 1 END;
+IF x > 2834 THEN x := x - 1 END;
+IF x > 2835 THEN x := x - 1 END;
+IF x > 2836 THEN x := x - 1 END;
+IF x > 2837 THEN x := x - 1 END;
+IF x > 2838 THEN x := x - 1 END;
+IF x > 2839 THEN x := x - 1 END;
+IF x > 2840 THEN x := x - 1 END;
+IF x > 2841 THEN x := x - 1 END;
+IF x > 2842 THEN x := x - 1 END;
+IF x > 2843 THEN x := x - 1 END;
+IF x > 2844 THEN x := x - 1 END;
+IF x > 2845 THEN x := x - 1 END;
+IF x > 2846 THEN x := x - 1 END;
+IF x > 2847 THEN x := x - 1 END;
+IF x > 2848 THEN x := x - 1 END;
+IF x > 2849 THEN x := x - 1 END;
+IF x > 2850 THEN x := x - 1 END;
+IF x > 2851 THEN x := x - 1 END;
+IF x > 2852 THEN x := x - 1 END;
+IF x > 2853 THEN x := x - 1 END;
+IF x > 2854 THEN x := x - 1 END;
+IF x > 2855 THEN x := x - 1 END;
+IF x > 2856 THEN x := x - 1 END;
+IF x > 2857 THEN x := x - 1 END;
+IF x > 2858 THEN x := x - 1 END;
+IF x > 2859 THEN x := x - 1 END;
+IF x > 2860 THEN x := x - 1 END;
+IF x > 2861 THEN x := x - 1 END;
+IF x > 2862 THEN x := x - 1 END;
+IF x > 2863 THEN x := x - 1 END;
+IF x > 2864 THEN x := x - 1 END;
+IF x > 2865 THEN x := x - 1 END;
+IF x > 2866 THEN x := x - 1 END;
+IF x > 2867 THEN x := x - 1 END;
+IF x > 2868 THEN x := x - 1 END;
+IF x > 2869 THEN x := x - 1 END;
+IF x > 2870 THEN x := x - 1 END;
+IF x > 2871 THEN x := x - 1 END;
+IF x > 2872 THEN x := x - 1 END;
+IF x > 2873 THEN x := x - 1 END;
+IF x > 2874 THEN x := x - 1 END;
+IF x > 2875 THEN x := x - 1 END;
+IF x > 2876 THEN x := x - 1 END;
+IF x > 2877 THEN x := x - 1 END;
+IF x > 2878 THEN x := x - 1 END;
+IF x > 2879 THEN x := x - 1 END;
+IF x > 2880 THEN x := x - 1 END;
+IF x > 2881 THEN x := x - 1 END;
+IF x > 2882 THEN x := x - 1 END;
+IF x > 2883 THEN x := x - 1 END;
+IF x > 2884 THEN x := x - 1 END;
+IF x > 2885 THEN x := x - 1 END;
+IF x > 2886 THEN x := x - 1 END;
+IF x > 2887 THEN x := x - 1 END;
+IF x > 2888 THEN x := x - 1 END;
+IF x > 2889 THEN x := x - 1 END;
+IF x > 2890 THEN x := x - 1 END;
+IF x > 2891 THEN x := x - 1 END;
+IF x > 2892 THEN x := x - 1 END;
+IF x > 2893 THEN x := x - 1 END;
+IF x > 2894 THEN x := x - 1 END;
+IF x > 2895 THEN x := x - 1 END;
+IF x > 2896 THEN x := x - 1 END;
+IF x > 2897 THEN x := x - 1 END;
+IF x > 2898 THEN x := x - 1 END;
+IF x > 2899 THEN x := x - 1 END;
+IF x > 2900 THEN x := x - 1 END;
+IF x > 2901 THEN x := x - 1 END;
+IF x > 2902 THEN x := x - 1 END;
+IF x > 2903 THEN x := x - 1 END;
+IF x > 2904 THEN x := x - 1 END;
+IF x > 2905 THEN x := x - 1 END;
+IF x > 2906 THEN x := x - 1 END;
+IF x > 2907 THEN x := x - 1 END;
+IF x > 2908 THEN x := x - 1 END;
+IF x > 2909 THEN x := x - 1 END;
+IF x > 2910 THEN x := x - 1 END;
+IF x > 2911 THEN x := x - 1 END;
+IF x > 2912 THEN x := x - 1 END;
+IF x > 2913 THEN x := x - 1 END;
+IF x > 2914 THEN x := x - 1 END;
+IF x > 2915 THEN x := x - 1 END;
+IF x > 2916 THEN x := x - 1 END;
+IF x > 2917 THEN x := x - 1 END;
+IF x > 2918 THEN x := x - 1 END;
+IF x > 2919 THEN x := x - 1 END;
+IF x > 2920 THEN x := x - 1 END;
+IF x > 2921 THEN x := x - 1 END;
+IF x > 2922 THEN x := x - 1 END;
+IF x > 2923 THEN x := x - 1 END;
+IF x > 2924 THEN x := x - 1 END;
+IF x > 2925 THEN x := x - 1 END;
+IF x > 2926 THEN x := x - 1 END;
+IF x > 2927 THEN x := x - 1 END;
+IF x > 2928 THEN x := x - 1 END;
+IF x > 2929 THEN x := x - 1 END;
+IF x > 2930 THEN x := x - 1 END;
+IF x > 2931 THEN x := x - 1 END;
+IF x > 2932 THEN x := x - 1 END;
+IF x > 2933 THEN x := x - 1 END;
+IF x > 2934 THEN x := x - 1 END;
+IF x > 2935 THEN x := x - 1 END;
+IF x > 2936 THEN x := x - 1 END;
+IF x > 2937 THEN x := x - 1 END;
+IF x > 2938 THEN x := x - 1 END;
+IF x > 2939 THEN x := x - 1 END;
+IF x > 2940 THEN x := x - 1 END;
+IF x > 2941 THEN x := x - 1 END;
+IF x > 2942 THEN x := x - 1 END;
+IF x > 2943 THEN x := x - 1 END;
+IF x > 2944 THEN x := x - 1 END;
+IF x > 2945 THEN x := x - 1 END;
+IF x > 2946 THEN x := x - 1 END;
+IF x > 2947 THEN x := x - 1 END;
+IF x > 2948 THEN x := x - 1 END;
+IF x > 2949 THEN x := x - 1 END;
+IF x > 2950 THEN x := x - 1 END;
+IF x > 2951 THEN x := x - 1 END;
+IF x > 2952 THEN x := x - 1 END;
+IF x > 2953 THEN x := x - 1 END;
+IF x > 2954 THEN x := x - 1 END;
+IF x > 2955 THEN x := x - 1 END;
+IF x > 2956 THEN x := x - 1 END;
+IF x > 2957 THEN x := x - 1 END;
+IF x > 2958 THEN x := x - 1 END;
+IF x > 2959 THEN x := x - 1 END;
+IF x > 2960 THEN x := x - 1 END;
+IF x > 2961 THEN x := x - 1 END;
+IF x > 2962 THEN x := x - 1 END;
+IF x > 2963 THEN x := x - 1 END;
+IF x > 2964 THEN x := x - 1 END;
+IF x > 2965 THEN x := x - 1 END;
+IF x > 2966 THEN x := x - 1 END;
+IF x > 2967 THEN x := x - 1 END;
+IF x > 2968 THEN x := x - 1 END;
+IF x > 2969 THEN x := x - 1 END;
+IF x > 2970 THEN x := x - 1 END;
+IF x > 2971 THEN x := x - 1 END;
+IF x > 2972 THEN x := x - 1 END;
+IF x > 2973 THEN x := x - 1 END;
+IF x > 2974 THEN x := x - 1 END;
+IF x > 2975 THEN x := x - 1 END;
+IF x > 2976 THEN x := x - 1 END;
+IF x > 2977 THEN x := x - 1 END;
+IF x > 2978 THEN x := x - 1 END;
+IF x > 2979 THEN x := x - 1 END;
+IF x > 2980 THEN x := x - 1 END;
+IF x > 2981 THEN x := x - 1 END;
+IF x > 2982 THEN x := x - 1 END;
+IF x > 2983 THEN x := x - 1 END;
+IF x > 2984 THEN x := x - 1 END;
+IF x > 2985 THEN x := x - 1 END;
+IF x > 2986 THEN x := x - 1 END;
+IF x > 2987 THEN x := x - 1 END;
+IF x > 2988 THEN x := x - 1 END;
+IF x > 2989 THEN x := x - 1 END;
+IF x > 2990 THEN x := x - 1 END;
+IF x > 2991 THEN x := x - 1 END;
+IF x > 2992 THEN x := x - 1 END;
+IF x > 2993 THEN x := x - 1 END;
+IF x > 2994 THEN x := x - 1 END;
+IF x > 2995 THEN x := x - 1 END;
+IF x > 2996 THEN x := x - 1 END;
+IF x > 2997 THEN x := x - 1 END;
+IF x > 2998 THEN x := x - 1 END;
+IF x > 2999 THEN x := x - 1 END;
+IF x > 3000 THEN x := x - 1 END;
+IF x > 3001 THEN x := x - 1 END;
+IF x > 3002 THEN x := x - 1 END;
+IF x > 3003 THEN x := x - 1 END;
+IF x > 3004 THEN x := x - 1 END;
+IF x > 3005 THEN x := x - 1 END;
+IF x > 3006 THEN x := x - 1 END;
+IF x > 3007 THEN x := x - 1 END;
+IF x > 3008 THEN x := x - 1 END;
+IF x > 3009 THEN x := x - 1 END;
+IF x > 3010 THEN x := x - 1 END;
+IF x > 3011 THEN x := x - 1 END;
+IF x > 3012 THEN x := x - 1 END;
+IF x > 3013 THEN x := x - 1 END;
+IF x > 3014 THEN x := x - 1 END;
+IF x > 3015 THEN x := x - 1 END;
+IF x > 3016 THEN x := x - 1 END;
+IF x > 3017 THEN x := x - 1 END;
+IF x > 3018 THEN x := x - 1 END;
+IF x > 3019 THEN x := x - 1 END;
+IF x > 3020 THEN x := x - 1 END;
+IF x > 3021 THEN x := x - 1 END;
+IF x > 3022 THEN x := x - 1 END;
+IF x > 3023 THEN x := x - 1 END;
+IF x > 3024 THEN x := x - 1 END;
+IF x > 3025 THEN x := x - 1 END;
+IF x > 3026 THEN x := x - 1 END;
+IF x > 3027 THEN x := x - 1 END;
+IF x > 3028 THEN x := x - 1 END;
+IF x > 3029 THEN x := x - 1 END;
+IF x > 3030 THEN x := x - 1 END;
+IF x > 3031 THEN x := x - 1 END;
+IF x > 3032 THEN x := x - 1 END;
+IF x > 3033 THEN x := x - 1 END;
+IF x > 3034 THEN x := x - 1 END;
+IF x > 3035 THEN x := x - 1 END;
+IF x > 3036 THEN x := x - 1 END;
+IF x > 3037 THEN x := x - 1 END;
+IF x > 3038 THEN x := x - 1 END;
+IF x > 3039 THEN x := x - 1 END;
+IF x > 3040 THEN x := x - 1 END;
+IF x > 3041 THEN x := x - 1 END;
+IF x > 3042 THEN x := x - 1 END;
+IF x > 3043 THEN x := x - 1 END;
+IF x > 3044 THEN x := x - 1 END;
+IF x > 3045 THEN x := x - 1 END;
+IF x > 3046 THEN x := x - 1 END;
+IF x > 3047 THEN x := x - 1 END;
+IF x > 3048 THEN x := x - 1 END;
+IF x > 3049 THEN x := x - 1 END;
+IF x > 3050 THEN x := x - 1 END;
+IF x > 3051 THEN x := x - 1 END;
+IF x > 3052 THEN x := x - 1 END;
+IF x > 3053 THEN x := x - 1 END;
+IF x > 3054 THEN x := x - 1 END;
+IF x > 3055 THEN x := x - 1 END;
+IF x > 3056 THEN x := x - 1 END;
+IF x > 3057 THEN x := x - 1 END;
+IF x > 3058 THEN x := x - 1 END;
+IF x > 3059 THEN x := x - 1 END;
+IF x > 3060 THEN x := x - 1 END;
+IF x > 3061 THEN x := x - 1 END;
+IF x > 3062 THEN x := x - 1 END;
+IF x > 3063 THEN x := x - 1 END;
+IF x > 3064 THEN x := x - 1 END;
+IF x > 3065 THEN x := x - 1 END;
+IF x > 3066 THEN x := x - 1 END;
+IF x > 3067 THEN x := x - 1 END;
+IF x > 3068 THEN x := x - 1 END;
+IF x > 3069 THEN x := x - 1 END;
+IF x > 3070 THEN x := x - 1 END;
+IF x > 3071 THEN x := x - 1 END;
+IF x > 3072 THEN x := x - 1 END;
+IF x > 3073 THEN x := x - 1 END;
+IF x > 3074 THEN x := x - 1 END;
+IF x > 3075 THEN x := x - 1 END;
+IF x > 3076 THEN x := x - 1 END;
+IF x > 3077 THEN x := x - 1 END;
+IF x > 3078 THEN x := x - 1 END;
+IF x > 3079 THEN x := x - 1 END;
+IF x > 3080 THEN x := x - 1 END;
+IF x > 3081 THEN x := x - 1 END;
+IF x > 3082 THEN x := x - 1 END;
+IF x > 3083 THEN x := x - 1 END;
+IF x > 3084 THEN x := x - 1 END;
+IF x > 3085 THEN x := x - 1 END;
+IF x > 3086 THEN x := x - 1 END;
+IF x > 3087 THEN x := x - 1 END;
+IF x > 3088 THEN x := x - 1 END;
+IF x > 3089 THEN x := x - 1 END;
+IF x > 3090 THEN x := x - 1 END;
+IF x > 3091 THEN x := x - 1 END;
+IF x > 3092 THEN x := x - 1 END;
+IF x > 3093 THEN x := x - 1 END;
+IF x > 3094 THEN x := x - 1 END;
+IF x > 3095 THEN x := x - 1 END;
+IF x > 3096 THEN x := x - 1 END;
+IF x > 3097 THEN x := x - 1 END;
+IF x > 3098 THEN x := x - 1 END;
+IF x > 3099 THEN x := x - 1 END;
+IF x > 3100 THEN x := x - 1 END;
+IF x > 3101 THEN x := x - 1 END;
+IF x > 3102 THEN x := x - 1 END;
+IF x > 3103 THEN x := x - 1 END;
+IF x > 3104 THEN x := x - 1 END;
+IF x > 3105 THEN x := x - 1 END;
+IF x > 3106 THEN x := x - 1 END;
+IF x > 3107 THEN x := x - 1 END;
+IF x > 3108 THEN x := x - 1 END;
+IF x > 3109 THEN x := x - 1 END;
+IF x > 3110 THEN x := x - 1 END;
+IF x > 3111 THEN x := x - 1 END;
+IF x > 3112 THEN x := x - 1 END;
+IF x > 3113 THEN x := x - 1 END;
+IF x > 3114 THEN x := x - 1 END;
+IF x > 3115 THEN x := x - 1 END;
+IF x > 3116 THEN x := x - 1 END;
+IF x > 3117 THEN x := x - 1 END;
+IF x > 3118 THEN x := x - 1 END;
+IF x > 3119 THEN x := x - 1 END;
+IF x > 3120 THEN x := x - 1 END;
+IF x > 3121 THEN x := x - 1 END;
+IF x > 3122 THEN x := x - 1 END;
+IF x > 3123 THEN x := x - 1 END;
+IF x > 3124 THEN x := x - 1 END;
+IF x > 3125 THEN x := x - 1 END;
+IF x > 3126 THEN x := x - 1 END;
+IF x > 3127 THEN x := x - 1 END;
+IF x > 3128 THEN x := x - 1 END;
+IF x > 3129 THEN x := x - 1 END;
+IF x > 3130 THEN x := x - 1 END;
+IF x > 3131 THEN x := x - 1 END;
+IF x > 3132 THEN x := x - 1 END;
+IF x > 3133 THEN x := x - 1 END;
+IF x > 3134 THEN x := x - 1 END;
+IF x > 3135 THEN x := x - 1 END;
+IF x > 3136 THEN x := x - 1 END;
+IF x > 3137 THEN x := x - 1 END;
+IF x > 3138 THEN x := x - 1 END;
+IF x > 3139 THEN x := x - 1 END;
+IF x > 3140 THEN x := x - 1 END;
+IF x > 3141 THEN x := x - 1 END;
+IF x > 3142 THEN x := x - 1 END;
+IF x > 3143 THEN x := x - 1 END;
+IF x > 3144 THEN x := x - 1 END;
+IF x > 3145 THEN x := x - 1 END;
+IF x > 3146 THEN x := x - 1 END;
+IF x > 3147 THEN x := x - 1 END;
+IF x > 3148 THEN x := x - 1 END;
+IF x > 3149 THEN x := x - 1 END;
+IF x > 3150 THEN x := x - 1 END;
+IF x > 3151 THEN x := x - 1 END;
+IF x > 3152 THEN x := x - 1 END;
+IF x > 3153 THEN x := x - 1 END;
+IF x > 3154 THEN x := x - 1 END;
+IF x > 3155 THEN x := x - 1 END;
+IF x > 3156 THEN x := x - 1 END;
+IF x > 3157 THEN x := x - 1 END;
+IF x > 3158 THEN x := x - 1 END;
+IF x > 3159 THEN x := x - 1 END;
+IF x > 3160 THEN x := x - 1 END;
+IF x > 3161 THEN x := x - 1 END;
+IF x > 3162 THEN x := x - 1 END;
+IF x > 3163 THEN x := x - 1 END;
+IF x > 3164 THEN x := x - 1 END;
+IF x > 3165 THEN x := x - 1 END;
+IF x > 3166 THEN x := x - 1 END;
+IF x > 3167 THEN x := x - 1 END;
+IF x > 3168 THEN x := x - 1 END;
+IF x > 3169 THEN x := x - 1 END;
+IF x > 3170 THEN x := x - 1 END;
+IF x > 3171 THEN x := x - 1 END;
+IF x > 3172 THEN x := x - 1 END;
+IF x > 3173 THEN x := x - 1 END;
+IF x > 3174 THEN x := x - 1 END;
+IF x > 3175 THEN x := x - 1 END;
+IF x > 3176 THEN x := x - 1 END;
+IF x > 3177 THEN x := x - 1 END;
+IF x > 3178 THEN x := x - 1 END;
+IF x > 3179 THEN x := x - 1 END;
+IF x > 3180 THEN x := x - 1 END;
+IF x > 3181 THEN x := x - 1 END;
+IF x > 3182 THEN x := x - 1 END;
+IF x > 3183 THEN x := x - 1 END;
+IF x > 3184 THEN x := x - 1 END;
+IF x > 3185 THEN x := x - 1 END;
+IF x > 3186 THEN x := x - 1 END;
+IF x > 3187 THEN x := x - 1 END;
+IF x > 3188 THEN x := x - 1 END;
+IF x > 3189 THEN x := x - 1 END;
+IF x > 3190 THEN x := x - 1 END;
+IF x > 3191 THEN x := x - 1 END;
+IF x > 3192 THEN x := x - 1 END;
+IF x > 3193 THEN x := x - 1 END;
+IF x > 3194 THEN x := x - 1 END;
+IF x > 3195 THEN x := x - 1 END;
+IF x > 3196 THEN x := x - 1 END;
+IF x > 3197 THEN x := x - 1 END;
+IF x > 3198 THEN x := x - 1 END;
+IF x > 3199 THEN x := x - 1 END;
+IF x > 3200 THEN x := x - 1 END;
+IF x > 3201 THEN x := x - 1 END;
+IF x > 3202 THEN x := x - 1 END;
+IF x > 3203 THEN x := x - 1 END;
+IF x > 3204 THEN x := x - 1 END;
+IF x > 3205 THEN x := x - 1 END;
+IF x > 3206 THEN x := x - 1 END;
+IF x > 3207 THEN x := x - 1 END;
+IF x > 3208 THEN x := x - 1 END;
+IF x > 3209 THEN x := x - 1 END;
+IF x > 3210 THEN x := x - 1 END;
+IF x > 3211 THEN x := x - 1 END;
+IF x > 3212 THEN x := x - 1 END;
+IF x > 3213 THEN x := x - 1 END;
+IF x > 3214 THEN x := x - 1 END;
+IF x > 3215 THEN x := x - 1 END;
+IF x > 3216 THEN x := x - 1 END;
+IF x > 3217 THEN x := x - 1 END;
+IF x > 3218 THEN x := x - 1 END;
+IF x > 3219 THEN x := x - 1 END;
+IF x > 3220 THEN x := x - 1 END;
+IF x > 3221 THEN x := x - 1 END;
+IF x > 3222 THEN x := x - 1 END;
+IF x > 3223 THEN x := x - 1 END;
+IF x > 3224 THEN x := x - 1 END;
+IF x > 3225 THEN x := x - 1 END;
+IF x > 3226 THEN x := x - 1 END;
+IF x > 3227 THEN x := x - 1 END;
+IF x > 3228 THEN x := x - 1 END;
+IF x > 3229 THEN x := x - 1 END;
+IF x > 3230 THEN x := x - 1 END;
+IF x > 3231 THEN x := x - 1 END;
+IF x > 3232 THEN x := x - 1 END;
+IF x > 3233 THEN x := x - 1 END;
+IF x > 3234 THEN x := x - 1 END;
+IF x > 3235 THEN x := x - 1 END;
+IF x > 3236 THEN x := x - 1 END;
+IF x > 3237 THEN x := x - 1 END;
+IF x > 3238 THEN x := x - 1 END;
+IF x > 3239 THEN x := x - 1 END;
+IF x > 3240 THEN x := x - 1 END;
+IF x > 3241 THEN x := x - 1 END;
+IF x > 3242 THEN x := x - 1 END;
+IF x > 3243 THEN x := x - 1 END;
+IF x > 3244 THEN x := x - 1 END;
+IF x > 3245 THEN x := x - 1 END;
+IF x > 3246 THEN x := x - 1 END;
+IF x > 3247 THEN x := x - 1 END;
+IF x > 3248 THEN x := x - 1 END;
+IF x > 3249 THEN x := x - 1 END;
+IF x > 3250 THEN x := x - 1 END;
+IF x > 3251 THEN x := x - 1 END;
+IF x > 3252 THEN x := x - 1 END;
+IF x > 3253 THEN x := x - 1 END;
+IF x > 3254 THEN x := x - 1 END;
+IF x > 3255 THEN x := x - 1 END;
+IF x > 3256 THEN x := x - 1 END;
+IF x > 3257 THEN x := x - 1 END;
+IF x > 3258 THEN x := x - 1 END;
+IF x > 3259 THEN x := x - 1 END;
+IF x > 3260 THEN x := x - 1 END;
+IF x > 3261 THEN x := x - 1 END;
+IF x > 3262 THEN x := x - 1 END;
+IF x > 3263 THEN x := x - 1 END;
+IF x > 3264 THEN x := x - 1 END;
+IF x > 3265 THEN x := x - 1 END;
+IF x > 3266 THEN x := x - 1 END;
+IF x > 3267 THEN x := x - 1 END;
+IF x > 3268 THEN x := x - 1 END;
+IF x > 3269 THEN x := x - 1 END;
+IF x > 3270 THEN x := x - 1 END;
+IF x > 3271 THEN x := x - 1 END;
+IF x > 3272 THEN x := x - 1 END;
+IF x > 3273 THEN x := x - 1 END;
+IF x > 3274 THEN x := x - 1 END;
+IF x > 3275 THEN x := x - 1 END;
+IF x > 3276 THEN x := x - 1 END;
+IF x > 3277 THEN x := x - 1 END;
+IF x > 3278 THEN x := x - 1 END;
+IF x > 3279 THEN x := x - 1 END;
+IF x > 3280 THEN x := x - 1 END;
+IF x > 3281 THEN x := x - 1 END;
+IF x > 3282 THEN x := x - 1 END;
+IF x > 3283 THEN x := x - 1 END;
+IF x > 3284 THEN x := x - 1 END;
+IF x > 3285 THEN x := x - 1 END;
+IF x > 3286 THEN x := x - 1 END;
+IF x > 3287 THEN x := x - 1 END;
+IF x > 3288 THEN x := x - 1 END;
+IF x > 3289 THEN x := x - 1 END;
+IF x > 3290 THEN x := x - 1 END;
+IF x > 3291 THEN x := x - 1 END;
+IF x > 3292 THEN x := x - 1 END;
+IF x > 3293 THEN x := x - 1 END;
+IF x > 3294 THEN x := x - 1 END;
+IF x > 3295 THEN x := x - 1 END;
+IF x > 3296 THEN x := x - 1 END;
+IF x > 3297 THEN x := x - 1 END;
+IF x > 3298 THEN x := x - 1 END;
+IF x > 3299 THEN x := x - 1 END;
+IF x > 3300 THEN x := x - 1 END;
+IF x > 3301 THEN x := x - 1 END;
+IF x > 3302 THEN x := x - 1 END;
+IF x > 3303 THEN x := x - 1 END;
+IF x > 3304 THEN x := x - 1 END;
+IF x > 3305 THEN x := x - 1 END;
+IF x > 3306 THEN x := x - 1 END;
+IF x > 3307 THEN x := x - 1 END;
+IF x > 3308 THEN x := x - 1 END;
+IF x > 3309 THEN x := x - 1 END;
+IF x > 3310 THEN x := x - 1 END;
+IF x > 3311 THEN x := x - 1 END;
+IF x > 3312 THEN x := x - 1 END;
+IF x > 3313 THEN x := x - 1 END;
+IF x > 3314 THEN x := x - 1 END;
+IF x > 3315 THEN x := x - 1 END;
+IF x > 3316 THEN x := x - 1 END;
+IF x > 3317 THEN x := x - 1 END;
+IF x > 3318 THEN x := x - 1 END;
+IF x > 3319 THEN x := x - 1 END;
+IF x > 3320 THEN x := x - 1 END;
+IF x > 3321 THEN x := x - 1 END;
+IF x > 3322 THEN x := x - 1 END;
+IF x > 3323 THEN x := x - 1 END;
+IF x > 3324 THEN x := x - 1 END;
+IF x > 3325 THEN x := x - 1 END;
+IF x > 3326 THEN x := x - 1 END;
+IF x > 3327 THEN x := x - 1 END;
+IF x > 3328 THEN x := x - 1 END;
+IF x > 3329 THEN x := x - 1 END;
+IF x > 3330 THEN x := x - 1 END;
+IF x > 3331 THEN x := x - 1 END;
+IF x > 3332 THEN x := x - 1 END;
+IF x > 3333 THEN x := x - 1 END;
+IF x > 3334 THEN x := x - 1 END;
+IF x > 3335 THEN x := x - 1 END;
+IF x > 3336 THEN x := x - 1 END;
+IF x > 3337 THEN x := x - 1 END;
+IF x > 3338 THEN x := x - 1 END;
+IF x > 3339 THEN x := x - 1 END;
+IF x > 3340 THEN x := x - 1 END;
+IF x > 3341 THEN x := x - 1 END;
+IF x > 3342 THEN x := x - 1 END;
+IF x > 3343 THEN x := x - 1 END;
+IF x > 3344 THEN x := x - 1 END;
+IF x > 3345 THEN x := x - 1 END;
+IF x > 3346 THEN x := x - 1 END;
+IF x > 3347 THEN x := x - 1 END;
+IF x > 3348 THEN x := x - 1 END;
+IF x > 3349 THEN x := x - 1 END;
+IF x > 3350 THEN x := x - 1 END;
+IF x > 3351 THEN x := x - 1 END;
+IF x > 3352 THEN x := x - 1 END;
+IF x > 3353 THEN x := x - 1 END;
+IF x > 3354 THEN x := x - 1 END;
+IF x > 3355 THEN x := x - 1 END;
+IF x > 3356 THEN x := x - 1 END;
+IF x > 3357 THEN x := x - 1 END;
+IF x > 3358 THEN x := x - 1 END;
+IF x > 3359 THEN x := x - 1 END;
+IF x > 3360 THEN x := x - 1 END;
+IF x > 3361 THEN x := x - 1 END;
+IF x > 3362 THEN x := x - 1 END;
+IF x > 3363 THEN x := x - 1 END;
+IF x > 3364 THEN x := x - 1 END;
+IF x > 3365 THEN x := x - 1 END;
+IF x > 3366 THEN x := x - 1 END;
+IF x > 3367 THEN x := x - 1 END;
+IF x > 3368 THEN x := x - 1 END;
+IF x > 3369 THEN x := x - 1 END;
+IF x > 3370 THEN x := x - 1 END;
+IF x > 3371 THEN x := x - 1 END;
+IF x > 3372 THEN x := x - 1 END;
+IF x > 3373 THEN x := x - 1 END;
+IF x > 3374 THEN x := x - 1 END;
+IF x > 3375 THEN x := x - 1 END;
+IF x > 3376 THEN x := x - 1 END;
+IF x > 3377 THEN x := x - 1 END;
+IF x > 3378 THEN x := x - 1 END;
+IF x > 3379 THEN x := x - 1 END;
+IF x > 3380 THEN x := x - 1 END;
+IF x > 3381 THEN x := x - 1 END;
+IF x > 3382 THEN x := x - 1 END;
+IF x > 3383 THEN x := x - 1 END;
+IF x > 3384 THEN x := x - 1 END;
+IF x > 3385 THEN x := x - 1 END;
+IF x > 3386 THEN x := x - 1 END;
+IF x > 3387 THEN x := x - 1 END;
+IF x > 3388 THEN x := x - 1 END;
+IF x > 3389 THEN x := x - 1 END;
+IF x > 3390 THEN x := x - 1 END;
+IF x > 3391 THEN x := x - 1 END;
+IF x > 3392 THEN x := x - 1 END;
+IF x > 3393 THEN x := x - 1 END;
+IF x > 3394 THEN x := x - 1 END;
+IF x > 3395 THEN x := x - 1 END;
+IF x > 3396 THEN x := x - 1 END;
+IF x > 3397 THEN x := x - 1 END;
+IF x > 3398 THEN x := x - 1 END;
+IF x > 3399 THEN x := x - 1 END;
+IF x > 3400 THEN x := x - 1 END;
+IF x > 3401 THEN x := x - 1 END;
+IF x > 3402 THEN x := x - 1 END;
+IF x > 3403 THEN x := x - 1 END;
+IF x > 3404 THEN x := x - 1 END;
+IF x > 3405 THEN x := x - 1 END;
+IF x > 3406 THEN x := x - 1 END;
+IF x > 3407 THEN x := x - 1 END;
+IF x > 3408 THEN x := x - 1 END;
+IF x > 3409 THEN x := x - 1 END;
+IF x > 3410 THEN x := x - 1 END;
+IF x > 3411 THEN x := x - 1 END;
+IF x > 3412 THEN x := x - 1 END;
+IF x > 3413 THEN x := x - 1 END;
+IF x > 3414 THEN x := x - 1 END;
+IF x > 3415 THEN x := x - 1 END;
+IF x > 3416 THEN x := x - 1 END;
+IF x > 3417 THEN x := x - 1 END;
+IF x > 3418 THEN x := x - 1 END;
+IF x > 3419 THEN x := x - 1 END;
+IF x > 3420 THEN x := x - 1 END;
+IF x > 3421 THEN x := x - 1 END;
+IF x > 3422 THEN x := x - 1 END;
+IF x > 3423 THEN x := x - 1 END;
+IF x > 3424 THEN x := x - 1 END;
+IF x > 3425 THEN x := x - 1 END;
+IF x > 3426 THEN x := x - 1 END;
+IF x > 3427 THEN x := x - 1 END;
+IF x > 3428 THEN x := x - 1 END;
+IF x > 3429 THEN x := x - 1 END;
+IF x > 3430 THEN x := x - 1 END;
+IF x > 3431 THEN x := x - 1 END;
+IF x > 3432 THEN x := x - 1 END;
+IF x > 3433 THEN x := x - 1 END;
+IF x > 3434 THEN x := x - 1 END;
+IF x > 3435 THEN x := x - 1 END;
+IF x > 3436 THEN x := x - 1 END;
+IF x > 3437 THEN x := x - 1 END;
+IF x > 3438 THEN x := x - 1 END;
+IF x > 3439 THEN x := x - 1 END;
+IF x > 3440 THEN x := x - 1 END;
+IF x > 3441 THEN x := x - 1 END;
+IF x > 3442 THEN x := x - 1 END;
+IF x > 3443 THEN x := x - 1 END;
+IF x > 3444 THEN x := x - 1 END;
+IF x > 3445 THEN x := x - 1 END;
+IF x > 3446 THEN x := x - 1 END;
+IF x > 3447 THEN x := x - 1 END;
+IF x > 3448 THEN x := x - 1 END;
+IF x > 3449 THEN x := x - 1 END;
+IF x > 3450 THEN x := x - 1 END;
+IF x > 3451 THEN x := x - 1 END;
+IF x > 3452 THEN x := x - 1 END;
+IF x > 3453 THEN x := x - 1 END;
+IF x > 3454 THEN x := x - 1 END;
+IF x > 3455 THEN x := x - 1 END;
+IF x > 3456 THEN x := x - 1 END;
+IF x > 3457 THEN x := x - 1 END;
+IF x > 3458 THEN x := x - 1 END;
+IF x > 3459 THEN x := x - 1 END;
+IF x > 3460 THEN x := x - 1 END;
+IF x > 3461 THEN x := x - 1 END;
+IF x > 3462 THEN x := x - 1 END;
+IF x > 3463 THEN x := x - 1 END;
+IF x > 3464 THEN x := x - 1 END;
+IF x > 3465 THEN x := x - 1 END;
+IF x > 3466 THEN x := x - 1 END;
+IF x > 3467 THEN x := x - 1 END;
+IF x > 3468 THEN x := x - 1 END;
+IF x > 3469 THEN x := x - 1 END;
+IF x > 3470 THEN x := x - 1 END;
+IF x > 3471 THEN x := x - 1 END;
+IF x > 3472 THEN x := x - 1 END;
+IF x > 3473 THEN x := x - 1 END;
+IF x > 3474 THEN x := x - 1 END;
+IF x > 3475 THEN x := x - 1 END;
+IF x > 3476 THEN x := x - 1 END;
+IF x > 3477 THEN x := x - 1 END;
+IF x > 3478 THEN x := x - 1 END;
+IF x > 3479 THEN x := x - 1 END;
+IF x > 3480 THEN x := x - 1 END;
+IF x > 3481 THEN x := x - 1 END;
+IF x > 3482 THEN x := x - 1 END;
+IF x > 3483 THEN x := x - 1 END;
+IF x > 3484 THEN x := x - 1 END;
+IF x > 3485 THEN x := x - 1 END;
+IF x > 3486 THEN x := x - 1 END;
+IF x > 3487 THEN x := x - 1 END;
+IF x > 3488 THEN x := x - 1 END;
+IF x > 3489 THEN x := x - 1 END;
+IF x > 3490 THEN x := x - 1 END;
+IF x > 3491 THEN x := x - 1 END;
+IF x > 3492 THEN x := x - 1 END;
+IF x > 3493 THEN x := x - 1 END;
+IF x > 3494 THEN x := x - 1 END;
+IF x > 3495 THEN x := x - 1 END;
+IF x > 3496 THEN x := x - 1 END;
+IF x > 3497 THEN x := x - 1 END;
+IF x > 3498 THEN x := x - 1 END;
+IF x > 3499 THEN x := x - 1 END;
+IF x > 3500 THEN x := x - 1 END;
+IF x > 3501 THEN x := x - 1 END;
+IF x > 3502 THEN x := x - 1 END;
+IF x > 3503 THEN x := x - 1 END;
+IF x > 3504 THEN x := x - 1 END;
+IF x > 3505 THEN x := x - 1 END;
+IF x > 3506 THEN x := x - 1 END;
+IF x > 3507 THEN x := x - 1 END;
+IF x > 3508 THEN x := x - 1 END;
+IF x > 3509 THEN x := x - 1 END;
+IF x > 3510 THEN x := x - 1 END;
+IF x > 3511 THEN x := x - 1 END;
+IF x > 3512 THEN x := x - 1 END;
+IF x > 3513 THEN x := x - 1 END;
+IF x > 3514 THEN x := x - 1 END;
+IF x > 3515 THEN x := x - 1 END;
+IF x > 3516 THEN x := x - 1 END;
+IF x > 3517 THEN x := x - 1 END;
+IF x > 3518 THEN x := x - 1 END;
+IF x > 3519 THEN x := x - 1 END;
+IF x > 3520 THEN x := x - 1 END;
+IF x > 3521 THEN x := x - 1 END;
+IF x > 3522 THEN x := x - 1 END;
+IF x > 3523 THEN x := x - 1 END;
+IF x > 3524 THEN x := x - 1 END;
+IF x > 3525 THEN x := x - 1 END;
+IF x > 3526 THEN x := x - 1 END;
+IF x > 3527 THEN x := x - 1 END;
+IF x > 3528 THEN x := x - 1 END;
+IF x > 3529 THEN x := x - 1 END;
+IF x > 3530 THEN x := x - 1 END;
+IF x > 3531 THEN x := x - 1 END;
+IF x > 3532 THEN x := x - 1 END;
+IF x > 3533 THEN x := x - 1 END;
+IF x > 3534 THEN x := x - 1 END;
+IF x > 3535 THEN x := x - 1 END;
+IF x > 3536 THEN x := x - 1 END;
+IF x > 3537 THEN x := x - 1 END;
+IF x > 3538 THEN x := x - 1 END;
+IF x > 3539 THEN x := x - 1 END;
+IF x > 3540 THEN x := x - 1 END;
+IF x > 3541 THEN x := x - 1 END;
+IF x > 3542 THEN x := x - 1 END;
+IF x > 3543 THEN x := x - 1 END;
+IF x > 3544 THEN x := x - 1 END;
+IF x > 3545 THEN x := x - 1 END;
+IF x > 3546 THEN x := x - 1 END;
+IF x > 3547 THEN x := x - 1 END;
+IF x > 3548 THEN x := x - 1 END;
+IF x > 3549 THEN x := x - 1 END;
+IF x > 3550 THEN x := x - 1 END;
+IF x > 3551 THEN x := x - 1 END;
+IF x > 3552 THEN x := x - 1 END;
+IF x > 3553 THEN x := x - 1 END;
+IF x > 3554 THEN x := x - 1 END;
+IF x > 3555 THEN x := x - 1 END;
+IF x > 3556 THEN x := x - 1 END;
+IF x > 3557 THEN x := x - 1 END;
+IF x > 3558 THEN x := x - 1 END;
+IF x > 3559 THEN x := x - 1 END;
+IF x > 3560 THEN x := x - 1 END;
+IF x > 3561 THEN x := x - 1 END;
+IF x > 3562 THEN x := x - 1 END;
+IF x > 3563 THEN x := x - 1 END;
+IF x > 3564 THEN x := x - 1 END;
+IF x > 3565 THEN x := x - 1 END;
+IF x > 3566 THEN x := x - 1 END;
+IF x > 3567 THEN x := x - 1 END;
+IF x > 3568 THEN x := x - 1 END;
+IF x > 3569 THEN x := x - 1 END;
+IF x > 3570 THEN x := x - 1 END;
+IF x > 3571 THEN x := x - 1 END;
+IF x > 3572 THEN x := x - 1 END;
+IF x > 3573 THEN x := x - 1 END;
+IF x > 3574 THEN x := x - 1 END;
+IF x > 3575 THEN x := x - 1 END;
+IF x > 3576 THEN x := x - 1 END;
+IF x > 3577 THEN x := x - 1 END;
+IF x > 3578 THEN x := x - 1 END;
+IF x > 3579 THEN x := x - 1 END;
+IF x > 3580 THEN x := x - 1 END;
+IF x > 3581 THEN x := x - 1 END;
+IF x > 3582 THEN x := x - 1 END;
+IF x > 3583 THEN x := x - 1 END;
+IF x > 3584 THEN x := x - 1 END;
+IF x > 3585 THEN x := x - 1 END;
+IF x > 3586 THEN x := x - 1 END;
+IF x > 3587 THEN x := x - 1 END;
+IF x > 3588 THEN x := x - 1 END;
+IF x > 3589 THEN x := x - 1 END;
+IF x > 3590 THEN x := x - 1 END;
+IF x > 3591 THEN x := x - 1 END;
+IF x > 3592 THEN x := x - 1 END;
+IF x > 3593 THEN x := x - 1 END;
+IF x > 3594 THEN x := x - 1 END;
+IF x > 3595 THEN x := x - 1 END;
+IF x > 3596 THEN x := x - 1 END;
+IF x > 3597 THEN x := x - 1 END;
+IF x > 3598 THEN x := x - 1 END;
+IF x > 3599 THEN x := x - 1 END;
+IF x > 3600 THEN x := x - 1 END;
+IF x > 3601 THEN x := x - 1 END;
+IF x > 3602 THEN x := x - 1 END;
+IF x > 3603 THEN x := x - 1 END;
+IF x > 3604 THEN x := x - 1 END;
+IF x > 3605 THEN x := x - 1 END;
+IF x > 3606 THEN x := x - 1 END;
+IF x > 3607 THEN x := x - 1 END;
+IF x > 3608 THEN x := x - 1 END;
+IF x > 3609 THEN x := x - 1 END;
+IF x > 3610 THEN x := x - 1 END;
+IF x > 3611 THEN x := x - 1 END;
+IF x > 3612 THEN x := x - 1 END;
+IF x > 3613 THEN x := x - 1 END;
+IF x > 3614 THEN x := x - 1 END;
+IF x > 3615 THEN x := x - 1 END;
+IF x > 3616 THEN x := x - 1 END;
+IF x > 3617 THEN x := x - 1 END;
+IF x > 3618 THEN x := x - 1 END;
+IF x > 3619 THEN x := x - 1 END;
+IF x > 3620 THEN x := x - 1 END;
+IF x > 3621 THEN x := x - 1 END;
+IF x > 3622 THEN x := x - 1 END;
+IF x > 3623 THEN x := x - 1 END;
+IF x > 3624 THEN x := x - 1 END;
+IF x > 3625 THEN x := x - 1 END;
+IF x > 3626 THEN x := x - 1 END;
+IF x > 3627 THEN x := x - 1 END;
+IF x > 3628 THEN x := x - 1 END;
+IF x > 3629 THEN x := x - 1 END;
+IF x > 3630 THEN x := x - 1 END;
+IF x > 3631 THEN x := x - 1 END;
+IF x > 3632 THEN x := x - 1 END;
+IF x > 3633 THEN x := x - 1 END;
+IF x > 3634 THEN x := x - 1 END;
+IF x > 3635 THEN x := x - 1 END;
+IF x > 3636 THEN x := x - 1 END;
+IF x > 3637 THEN x := x - 1 END;
+IF x > 3638 THEN x := x - 1 END;
+IF x > 3639 THEN x := x - 1 END;
+IF x > 3640 THEN x := x - 1 END;
+IF x > 3641 THEN x := x - 1 END;
+IF x > 3642 THEN x := x - 1 END;
+IF x > 3643 THEN x := x - 1 END;
+IF x > 3644 THEN x := x - 1 END;
+IF x > 3645 THEN x := x - 1 END;
+IF x > 3646 THEN x := x - 1 END;
+IF x > 3647 THEN x := x - 1 END;
+IF x > 3648 THEN x := x - 1 END;
+IF x > 3649 THEN x := x - 1 END;
+IF x > 3650 THEN x := x - 1 END;
+IF x > 3651 THEN x := x - 1 END;
+IF x > 3652 THEN x := x - 1 END;
+IF x > 3653 THEN x := x - 1 END;
+IF x > 3654 THEN x := x - 1 END;
+IF x > 3655 THEN x := x - 1 END;
+IF x > 3656 THEN x := x - 1 END;
+IF x > 3657 THEN x := x - 1 END;
+IF x > 3658 THEN x := x - 1 END;
+IF x > 3659 THEN x := x - 1 END;
+IF x > 3660 THEN x := x - 1 END;
+IF x > 3661 THEN x := x - 1 END;
+IF x > 3662 THEN x := x - 1 END;
+IF x > 3663 THEN x := x - 1 END;
+IF x > 3664 THEN x := x - 1 END;
+IF x > 3665 THEN x := x - 1 END;
+IF x > 3666 THEN x := x - 1 END;
+IF x > 3667 THEN x := x - 1 END;
+IF x > 3668 THEN x := x - 1 END;
+IF x > 3669 THEN x := x - 1 END;
+IF x > 3670 THEN x := x - 1 END;
+IF x > 3671 THEN x := x - 1 END;
+IF x > 3672 THEN x := x - 1 END;
+IF x > 3673 THEN x := x - 1 END;
+IF x > 3674 THEN x := x - 1 END;
+IF x > 3675 THEN x := x - 1 END;
+IF x > 3676 THEN x := x - 1 END;
+IF x > 3677 THEN x := x - 1 END;
+IF x > 3678 THEN x := x - 1 END;
+IF x > 3679 THEN x := x - 1 END;
+IF x > 3680 THEN x := x - 1 END;
+IF x > 3681 THEN x := x - 1 END;
+IF x > 3682 THEN x := x - 1 END;
+IF x > 3683 THEN x := x - 1 END;
+IF x > 3684 THEN x := x - 1 END;
+IF x > 3685 THEN x := x - 1 END;
+IF x > 3686 THEN x := x - 1 END;
+IF x > 3687 THEN x := x - 1 END;
+IF x > 3688 THEN x := x - 1 END;
+IF x > 3689 THEN x := x - 1 END;
+IF x > 3690 THEN x := x - 1 END;
+IF x > 3691 THEN x := x - 1 END;
+IF x > 3692 THEN x := x - 1 END;
+IF x > 3693 THEN x := x - 1 END;
+IF x > 3694 THEN x := x - 1 END;
+IF x > 3695 THEN x := x - 1 END;
+IF x > 3696 THEN x := x - 1 END;
+IF x > 3697 THEN x := x - 1 END;
+IF x > 3698 THEN x := x - 1 END;
+IF x > 3699 THEN x := x - 1 END;
+IF x > 3700 THEN x := x - 1 END;
+IF x > 3701 THEN x := x - 1 END;
+IF x > 3702 THEN x := x - 1 END;
+IF x > 3703 THEN x := x - 1 END;
+IF x > 3704 THEN x := x - 1 END;
+IF x > 3705 THEN x := x - 1 END;
+IF x > 3706 THEN x := x - 1 END;
+IF x > 3707 THEN x := x - 1 END;
+IF x > 3708 THEN x := x - 1 END;
+IF x > 3709 THEN x := x - 1 END;
+IF x > 3710 THEN x := x - 1 END;
+IF x > 3711 THEN x := x - 1 END;
+IF x > 3712 THEN x := x - 1 END;
+IF x > 3713 THEN x := x - 1 END;
+IF x > 3714 THEN x := x - 1 END;
+IF x > 3715 THEN x := x - 1 END;
+IF x > 3716 THEN x := x - 1 END;
+IF x > 3717 THEN x := x - 1 END;
+IF x > 3718 THEN x := x - 1 END;
+IF x > 3719 THEN x := x - 1 END;
+IF x > 3720 THEN x := x - 1 END;
+IF x > 3721 THEN x := x - 1 END;
+IF x > 3722 THEN x := x - 1 END;
+IF x > 3723 THEN x := x - 1 END;
+IF x > 3724 THEN x := x - 1 END;
+IF x > 3725 THEN x := x - 1 END;
+IF x > 3726 THEN x := x - 1 END;
+IF x > 3727 THEN x := x - 1 END;
+IF x > 3728 THEN x := x - 1 END;
+IF x > 3729 THEN x := x - 1 END;
+IF x > 3730 THEN x := x - 1 END;
+IF x > 3731 THEN x := x - 1 END;
+IF x > 3732 THEN x := x - 1 END;
+IF x > 3733 THEN x := x - 1 END;
+IF x > 3734 THEN x := x - 1 END;
+IF x > 3735 THEN x := x - 1 END;
+IF x > 3736 THEN x := x - 1 END;
+IF x > 3737 THEN x := x - 1 END;
+IF x > 3738 THEN x := x - 1 END;
+IF x > 3739 THEN x := x - 1 END;
+IF x > 3740 THEN x := x - 1 END;
+IF x > 3741 THEN x := x - 1 END;
+IF x > 3742 THEN x := x - 1 END;
+IF x > 3743 THEN x := x - 1 END;
+IF x > 3744 THEN x := x - 1 END;
+IF x > 3745 THEN x := x - 1 END;
+IF x > 3746 THEN x := x - 1 END;
+IF x > 3747 THEN x := x - 1 END;
+IF x > 3748 THEN x := x - 1 END;
+IF x > 3749 THEN x := x - 1 END;
+IF x > 3750 THEN x := x - 1 END;
+IF x > 3751 THEN x := x - 1 END;
+IF x > 3752 THEN x := x - 1 END;
+IF x > 3753 THEN x := x - 1 END;
+IF x > 3754 THEN x := x - 1 END;
+IF x > 3755 THEN x := x - 1 END;
+IF x > 3756 THEN x := x - 1 END;
+IF x > 3757 THEN x := x - 1 END;
+IF x > 3758 THEN x := x - 1 END;
+IF x > 3759 THEN x := x - 1 END;
+IF x > 3760 THEN x := x - 1 END;
+IF x > 3761 THEN x := x - 1 END;
+IF x > 3762 THEN x := x - 1 END;
+IF x > 3763 THEN x := x - 1 END;
+IF x > 3764 THEN x := x - 1 END;
+IF x > 3765 THEN x := x - 1 END;
+IF x > 3766 THEN x := x - 1 END;
+IF x > 3767 THEN x := x - 1 END;
+IF x > 3768 THEN x := x - 1 END;
+IF x > 3769 THEN x := x - 1 END;
+IF x > 3770 THEN x := x - 1 END;
+IF x > 3771 THEN x := x - 1 END;
+IF x > 3772 THEN x := x - 1 END;
+IF x > 3773 THEN x := x - 1 END;
+IF x > 3774 THEN x := x - 1 END;
+IF x > 3775 THEN x := x - 1 END;
+IF x > 3776 THEN x := x - 1 END;
+IF x > 3777 THEN x := x - 1 END;
+IF x > 3778 THEN x := x - 1 END;
+IF x > 3779 THEN x := x - 1 END;
+IF x > 3780 THEN x := x - 1 END;
+IF x > 3781 THEN x := x - 1 END;
+IF x > 3782 THEN x := x - 1 END;
+IF x > 3783 THEN x := x - 1 END;
+IF x > 3784 THEN x := x - 1 END;
+IF x > 3785 THEN x := x - 1 END;
+IF x > 3786 THEN x := x - 1 END;
+IF x > 3787 THEN x := x - 1 END;
+IF x > 3788 THEN x := x - 1 END;
+IF x > 3789 THEN x := x - 1 END;
+IF x > 3790 THEN x := x - 1 END;
+IF x > 3791 THEN x := x - 1 END;
+IF x > 3792 THEN x := x - 1 END;
+IF x > 3793 THEN x := x - 1 END;
+IF x > 3794 THEN x := x - 1 END;
+IF x > 3795 THEN x := x - 1 END;
+IF x > 3796 THEN x := x - 1 END;
+IF x > 3797 THEN x := x - 1 END;
+IF x > 3798 THEN x := x - 1 END;
+IF x > 3799 THEN x := x - 1 END;
+IF x > 3800 THEN x := x - 1 END;
+IF x > 3801 THEN x := x - 1 END;
+IF x > 3802 THEN x := x - 1 END;
+IF x > 3803 THEN x := x - 1 END;
+IF x > 3804 THEN x := x - 1 END;
+IF x > 3805 THEN x := x - 1 END;
+IF x > 3806 THEN x := x - 1 END;
+IF x > 3807 THEN x := x - 1 END;
+IF x > 3808 THEN x := x - 1 END;
+IF x > 3809 THEN x := x - 1 END;
+IF x > 3810 THEN x := x - 1 END;
+IF x > 3811 THEN x := x - 1 END;
+IF x > 3812 THEN x := x - 1 END;
+IF x > 3813 THEN x := x - 1 END;
+IF x > 3814 THEN x := x - 1 END;
+IF x > 3815 THEN x := x - 1 END;
+IF x > 3816 THEN x := x - 1 END;
+IF x > 3817 THEN x := x - 1 END;
+IF x > 3818 THEN x := x - 1 END;
+IF x > 3819 THEN x := x - 1 END;
+IF x > 3820 THEN x := x - 1 END;
+IF x > 3821 THEN x := x - 1 END;
+IF x > 3822 THEN x := x - 1 END;
+IF x > 3823 THEN x := x - 1 END;
+IF x > 3824 THEN x := x - 1 END;
+IF x > 3825 THEN x := x - 1 END;
+IF x > 3826 THEN x := x - 1 END;
+IF x > 3827 THEN x := x - 1 END;
+IF x > 3828 THEN x := x - 1 END;
+IF x > 3829 THEN x := x - 1 END;
+IF x > 3830 THEN x := x - 1 END;
+IF x > 3831 THEN x := x - 1 END;
+IF x > 3832 THEN x := x - 1 END;
+IF x > 3833 THEN x := x - 1 END;
+IF x > 3834 THEN x := x - 1 END;
+IF x > 3835 THEN x := x - 1 END;
+IF x > 3836 THEN x := x - 1 END;
+IF x > 3837 THEN x := x - 1 END;
+IF x > 3838 THEN x := x - 1 END;
+IF x > 3839 THEN x := x - 1 END;
+IF x > 3840 THEN x := x - 1 END;
+IF x > 3841 THEN x := x - 1 END;
+IF x > 3842 THEN x := x - 1 END;
+IF x > 3843 THEN x := x - 1 END;
+IF x > 3844 THEN x := x - 1 END;
+IF x > 3845 THEN x := x - 1 END;
+IF x > 3846 THEN x := x - 1 END;
+IF x > 3847 THEN x := x - 1 END;
+IF x > 3848 THEN x := x - 1 END;
+IF x > 3849 THEN x := x - 1 END;
+IF x > 3850 THEN x := x - 1 END;
+IF x > 3851 THEN x := x - 1 END;
+IF x > 3852 THEN x := x - 1 END;
+IF x > 3853 THEN x := x - 1 END;
+IF x > 3854 THEN x := x - 1 END;
+IF x > 3855 THEN x := x - 1 END;
+IF x > 3856 THEN x := x - 1 END;
+IF x > 3857 THEN x := x - 1 END;
+IF x > 3858 THEN x := x - 1 END;
+IF x > 3859 THEN x := x - 1 END;
+IF x > 3860 THEN x := x - 1 END;
+IF x > 3861 THEN x := x - 1 END;
+IF x > 3862 THEN x := x - 1 END;
+IF x > 3863 THEN x := x - 1 END;
+IF x > 3864 THEN x := x - 1 END;
+IF x > 3865 THEN x := x - 1 END;
+IF x > 3866 THEN x := x - 1 END;
+IF x > 3867 THEN x := x - 1 END;
+IF x > 3868 THEN x := x - 1 END;
+IF x > 3869 THEN x := x - 1 END;
+IF x > 3870 THEN x := x - 1 END;
+IF x > 3871 THEN x := x - 1 END;
+IF x > 3872 THEN x := x - 1 END;
+IF x > 3873 THEN x := x - 1 END;
+IF x > 3874 THEN x := x - 1 END;
+IF x > 3875 THEN x := x - 1 END;
+IF x > 3876 THEN x := x - 1 END;
+IF x > 3877 THEN x := x - 1 END;
+IF x > 3878 THEN x := x - 1 END;
+IF x > 3879 THEN x := x - 1 END;
+IF x > 3880 THEN x := x - 1 END;
+IF x > 3881 THEN x := x - 1 END;
+IF x > 3882 THEN x := x - 1 END;
+IF x > 3883 THEN x := x - 1 END;
+IF x > 3884 THEN x := x - 1 END;
+IF x > 3885 THEN x := x - 1 END;
+IF x > 3886 THEN x := x - 1 END;
+IF x > 3887 THEN x := x - 1 END;
+IF x > 3888 THEN x := x - 1 END;
+IF x > 3889 THEN x := x - 1 END;
+IF x > 3890 THEN x := x - 1 END;
+IF x > 3891 THEN x := x - 1 END;
+IF x > 3892 THEN x := x - 1 END;
+IF x > 3893 THEN x := x - 1 END;
+IF x > 3894 THEN x := x - 1 END;
+IF x > 3895 THEN x := x - 1 END;
+IF x > 3896 THEN x := x - 1 END;
+IF x > 3897 THEN x := x - 1 END;
+IF x > 3898 THEN x := x - 1 END;
+IF x > 3899 THEN x := x - 1 END;
+IF x > 3900 THEN x := x - 1 END;
+IF x > 3901 THEN x := x - 1 END;
+IF x > 3902 THEN x := x - 1 END;
+IF x > 3903 THEN x := x - 1 END;
+IF x > 3904 THEN x := x - 1 END;
+IF x > 3905 THEN x := x - 1 END;
+IF x > 3906 THEN x := x - 1 END;
+IF x > 3907 THEN x := x - 1 END;
+IF x > 3908 THEN x := x - 1 END;
+IF x > 3909 THEN x := x - 1 END;
+IF x > 3910 THEN x := x - 1 END;
+IF x > 3911 THEN x := x - 1 END;
+IF x > 3912 THEN x := x - 1 END;
+IF x > 3913 THEN x := x - 1 END;
+IF x > 3914 THEN x := x - 1 END;
+IF x > 3915 THEN x := x - 1 END;
+IF x > 3916 THEN x := x - 1 END;
+IF x > 3917 THEN x := x - 1 END;
+IF x > 3918 THEN x := x - 1 END;
+IF x > 3919 THEN x := x - 1 END;
+IF x > 3920 THEN x := x - 1 END;
+IF x > 3921 THEN x := x - 1 END;
+IF x > 3922 THEN x := x - 1 END;
+IF x > 3923 THEN x := x - 1 END;
+IF x > 3924 THEN x := x - 1 END;
+IF x > 3925 THEN x := x - 1 END;
+IF x > 3926 THEN x := x - 1 END;
+IF x > 3927 THEN x := x - 1 END;
+IF x > 3928 THEN x := x - 1 END;
+IF x > 3929 THEN x := x - 1 END;
+IF x > 3930 THEN x := x - 1 END;
+IF x > 3931 THEN x := x - 1 END;
+IF x > 3932 THEN x := x - 1 END;
+IF x > 3933 THEN x := x - 1 END;
+IF x > 3934 THEN x := x - 1 END;
+IF x > 3935 THEN x := x - 1 END;
+IF x > 3936 THEN x := x - 1 END;
+IF x > 3937 THEN x := x - 1 END;
+IF x > 3938 THEN x := x - 1 END;
+IF x > 3939 THEN x := x - 1 END;
+IF x > 3940 THEN x := x - 1 END;
+IF x > 3941 THEN x := x - 1 END;
+IF x > 3942 THEN x := x - 1 END;
+IF x > 3943 THEN x := x - 1 END;
+IF x > 3944 THEN x := x - 1 END;
+IF x > 3945 THEN x := x - 1 END;
+IF x > 3946 THEN x := x - 1 END;
+IF x > 3947 THEN x := x - 1 END;
+IF x > 3948 THEN x := x - 1 END;
+IF x > 3949 THEN x := x - 1 END;
+IF x > 3950 THEN x := x - 1 END;
+IF x > 3951 THEN x := x - 1 END;
+IF x > 3952 THEN x := x - 1 END;
+IF x > 3953 THEN x := x - 1 END;
+IF x > 3954 THEN x := x - 1 END;
+IF x > 3955 THEN x := x - 1 END;
+IF x > 3956 THEN x := x - 1 END;
+IF x > 3957 THEN x := x - 1 END;
+IF x > 3958 THEN x := x - 1 END;
+IF x > 3959 THEN x := x - 1 END;
+IF x > 3960 THEN x := x - 1 END;
+IF x > 3961 THEN x := x - 1 END;
+IF x > 3962 THEN x := x - 1 END;
+IF x > 3963 THEN x := x - 1 END;
+IF x > 3964 THEN x := x - 1 END;
+IF x > 3965 THEN x := x - 1 END;
+IF x > 3966 THEN x := x - 1 END;
+IF x > 3967 THEN x := x - 1 END;
+IF x > 3968 THEN x := x - 1 END;
+IF x > 3969 THEN x := x - 1 END;
+IF x > 3970 THEN x := x - 1 END;
+IF x > 3971 THEN x := x - 1 END;
+IF x > 3972 THEN x := x - 1 END;
+IF x > 3973 THEN x := x - 1 END;
+IF x > 3974 THEN x := x - 1 END;
+IF x > 3975 THEN x := x - 1 END;
+IF x > 3976 THEN x := x - 1 END;
+IF x > 3977 THEN x := x - 1 END;
+IF x > 3978 THEN x := x - 1 END;
+IF x > 3979 THEN x := x - 1 END;
+IF x > 3980 THEN x := x - 1 END;
+IF x > 3981 THEN x := x - 1 END;
+IF x > 3982 THEN x := x - 1 END;
+IF x > 3983 THEN x := x - 1 END;
+IF x > 3984 THEN x := x - 1 END;
+IF x > 3985 THEN x := x - 1 END;
+IF x > 3986 THEN x := x - 1 END;
+IF x > 3987 THEN x := x - 1 END;
+IF x > 3988 THEN x := x - 1 END;
+IF x > 3989 THEN x := x - 1 END;
+IF x > 3990 THEN x := x - 1 END;
+IF x > 3991 THEN x := x - 1 END;
+IF x > 3992 THEN x := x - 1 END;
+IF x > 3993 THEN x := x - 1 END;
+IF x > 3994 THEN x := x - 1 END;
+IF x > 3995 THEN x := x - 1 END;
+IF x > 3996 THEN x := x - 1 END;
+IF x > 3997 THEN x := x - 1 END;
+IF x > 3998 THEN x := x - 1 END;
+IF x > 3999 THEN x := x - 1 END;
+IF x > 4000 THEN x := x - 1 END;
+IF x > 4001 THEN x := x - 1 END;
+IF x > 4002 THEN x := x - 1 END;
+IF x > 4003 THEN x := x - 1 END;
+IF x > 4004 THEN x := x - 1 END;
+IF x > 4005 THEN x := x - 1 END;
+IF x > 4006 THEN x := x - 1 END;
+IF x > 4007 THEN x := x - 1 END;
+IF x > 4008 THEN x := x - 1 END;
+IF x > 4009 THEN x := x - 1 END;
+IF x > 4010 THEN x := x - 1 END;
+IF x > 4011 THEN x := x - 1 END;
+IF x > 4012 THEN x := x - 1 END;
+IF x > 4013 THEN x := x - 1 END;
+IF x > 4014 THEN x := x - 1 END;
+IF x > 4015 THEN x := x - 1 END;
+IF x > 4016 THEN x := x - 1 END;
+IF x > 4017 THEN x := x - 1 END;
+IF x > 4018 THEN x := x - 1 END;
+IF x > 4019 THEN x := x - 1 END;
+IF x > 4020 THEN x := x - 1 END;
+IF x > 4021 THEN x := x - 1 END;
+IF x > 4022 THEN x := x - 1 END;
+IF x > 4023 THEN x := x - 1 END;
+IF x > 4024 THEN x := x - 1 END;
+IF x > 4025 THEN x := x - 1 END;
+IF x > 4026 THEN x := x - 1 END;
+IF x > 4027 THEN x := x - 1 END;
+IF x > 4028 THEN x := x - 1 END;
+IF x > 4029 THEN x := x - 1 END;
+IF x > 4030 THEN x := x - 1 END;
+IF x > 4031 THEN x := x - 1 END;
+IF x > 4032 THEN x := x - 1 END;
+IF x > 4033 THEN x := x - 1 END;
+IF x > 4034 THEN x := x - 1 END;
+IF x > 4035 THEN x := x - 1 END;
+IF x > 4036 THEN x := x - 1 END;
+IF x > 4037 THEN x := x - 1 END;
+IF x > 4038 THEN x := x - 1 END;
+IF x > 4039 THEN x := x - 1 END;
+IF x > 4040 THEN x := x - 1 END;
+IF x > 4041 THEN x := x - 1 END;
+IF x > 4042 THEN x := x - 1 END;
+IF x > 4043 THEN x := x - 1 END;
+IF x > 4044 THEN x := x - 1 END;
+IF x > 4045 THEN x := x - 1 END;
+IF x > 4046 THEN x := x - 1 END;
+IF x > 4047 THEN x := x - 1 END;
+IF x > 4048 THEN x := x - 1 END;
+IF x > 4049 THEN x := x - 1 END;
+IF x > 4050 THEN x := x - 1 END;
+IF x > 4051 THEN x := x - 1 END;
+IF x > 4052 THEN x := x - 1 END;
+IF x > 4053 THEN x := x - 1 END;
+IF x > 4054 THEN x := x - 1 END;
+IF x > 4055 THEN x := x - 1 END;
+IF x > 4056 THEN x := x - 1 END;
+IF x > 4057 THEN x := x - 1 END;
+IF x > 4058 THEN x := x - 1 END;
+IF x > 4059 THEN x := x - 1 END;
+IF x > 4060 THEN x := x - 1 END;
+IF x > 4061 THEN x := x - 1 END;
+IF x > 4062 THEN x := x - 1 END;
+IF x > 4063 THEN x := x - 1 END;
+IF x > 4064 THEN x := x - 1 END;
+IF x > 4065 THEN x := x - 1 END;
+IF x > 4066 THEN x := x - 1 END;
+IF x > 4067 THEN x := x - 1 END;
+IF x > 4068 THEN x := x - 1 END;
+IF x > 4069 THEN x := x - 1 END;
+IF x > 4070 THEN x := x - 1 END;
+IF x > 4071 THEN x := x - 1 END;
+IF x > 4072 THEN x := x - 1 END;
+IF x > 4073 THEN x := x - 1 END;
+IF x > 4074 THEN x := x - 1 END;
+IF x > 4075 THEN x := x - 1 END;
+IF x > 4076 THEN x := x - 1 END;
+IF x > 4077 THEN x := x - 1 END;
+IF x > 4078 THEN x := x - 1 END;
+IF x > 4079 THEN x := x - 1 END;
+IF x > 4080 THEN x := x - 1 END;
+IF x > 4081 THEN x := x - 1 END;
+IF x > 4082 THEN x := x - 1 END;
+IF x > 4083 THEN x := x - 1 END;
+IF x > 4084 THEN x := x - 1 END;
+IF x > 4085 THEN x := x - 1 END;
+IF x > 4086 THEN x := x - 1 END;
+IF x > 4087 THEN x := x - 1 END;
+IF x > 4088 THEN x := x - 1 END;
+IF x > 4089 THEN x := x - 1 END;
+IF x > 4090 THEN x := x - 1 END;
+IF x > 4091 THEN x := x - 1 END;
+IF x > 4092 THEN x := x - 1 END;
+IF x > 4093 THEN x := x - 1 END;
+IF x > 4094 THEN x := x - 1 END;
+IF x > 4095 THEN x := x - 1 END;
+IF x > 4096 THEN x := x - 1 END;
+IF x > 4097 THEN x := x - 1 END;
+IF x > 4098 THEN x := x - 1 END;
+IF x > 4099 THEN x := x - 1 END;
+IF x > 4100 THEN x := x - 1 END;
+IF x > 4101 THEN x := x - 1 END;
+IF x > 4102 THEN x := x - 1 END;
+IF x > 4103 THEN x := x - 1 END;
+IF x > 4104 THEN x := x - 1 END;
+IF x > 4105 THEN x := x - 1 END;
+IF x > 4106 THEN x := x - 1 END;
+IF x > 4107 THEN x := x - 1 END;
+IF x > 4108 THEN x := x - 1 END;
+IF x > 4109 THEN x := x - 1 END;
+IF x > 4110 THEN x := x - 1 END;
+IF x > 4111 THEN x := x - 1 END;
+IF x > 4112 THEN x := x - 1 END;
+IF x > 4113 THEN x := x - 1 END;
+IF x > 4114 THEN x := x - 1 END;
+IF x > 4115 THEN x := x - 1 END;
+IF x > 4116 THEN x := x - 1 END;
+IF x > 4117 THEN x := x - 1 END;
+IF x > 4118 THEN x := x - 1 END;
+IF x > 4119 THEN x := x - 1 END;
+IF x > 4120 THEN x := x - 1 END;
+IF x > 4121 THEN x := x - 1 END;
+IF x > 4122 THEN x := x - 1 END;
+IF x > 4123 THEN x := x - 1 END;
+IF x > 4124 THEN x := x - 1 END;
+IF x > 4125 THEN x := x - 1 END;
+IF x > 4126 THEN x := x - 1 END;
+IF x > 4127 THEN x := x - 1 END;
+IF x > 4128 THEN x := x - 1 END;
+IF x > 4129 THEN x := x - 1 END;
+IF x > 4130 THEN x := x - 1 END;
+IF x > 4131 THEN x := x - 1 END;
+IF x > 4132 THEN x := x - 1 END;
+IF x > 4133 THEN x := x - 1 END;
+IF x > 4134 THEN x := x - 1 END;
+IF x > 4135 THEN x := x - 1 END;
+IF x > 4136 THEN x := x - 1 END;
+IF x > 4137 THEN x := x - 1 END;
+IF x > 4138 THEN x := x - 1 END;
+IF x > 4139 THEN x := x - 1 END;
+IF x > 4140 THEN x := x - 1 END;
+IF x > 4141 THEN x := x - 1 END;
+IF x > 4142 THEN x := x - 1 END;
+IF x > 4143 THEN x := x - 1 END;
+IF x > 4144 THEN x := x - 1 END;
+IF x > 4145 THEN x := x - 1 END;
+IF x > 4146 THEN x := x - 1 END;
+IF x > 4147 THEN x := x - 1 END;
+IF x > 4148 THEN x := x - 1 END;
+IF x > 4149 THEN x := x - 1 END;
+IF x > 4150 THEN x := x - 1 END;
+IF x > 4151 THEN x := x - 1 END;
+IF x > 4152 THEN x := x - 1 END;
+IF x > 4153 THEN x := x - 1 END;
+IF x > 4154 THEN x := x - 1 END;
+IF x > 4155 THEN x := x - 1 END;
+IF x > 4156 THEN x := x - 1 END;
+IF x > 4157 THEN x := x - 1 END;
+IF x > 4158 THEN x := x - 1 END;
+IF x > 4159 THEN x := x - 1 END;
+IF x > 4160 THEN x := x - 1 END;
+IF x > 4161 THEN x := x - 1 END;
+IF x > 4162 THEN x := x - 1 END;
+IF x > 4163 THEN x := x - 1 END;
+IF x > 4164 THEN x := x - 1 END;
+IF x > 4165 THEN x := x - 1 END;
+IF x > 4166 THEN x := x - 1 END;
+IF x > 4167 THEN x := x - 1 END;
+IF x > 4168 THEN x := x - 1 END;
+IF x > 4169 THEN x := x - 1 END;
+IF x > 4170 THEN x := x - 1 END;
+IF x > 4171 THEN x := x - 1 END;
+IF x > 4172 THEN x := x - 1 END;
+IF x > 4173 THEN x := x - 1 END;
+IF x > 4174 THEN x := x - 1 END;
+IF x > 4175 THEN x := x - 1 END;
+IF x > 4176 THEN x := x - 1 END;
+IF x > 4177 THEN x := x - 1 END;
+IF x > 4178 THEN x := x - 1 END;
+IF x > 4179 THEN x := x - 1 END;
+IF x > 4180 THEN x := x - 1 END;
+IF x > 4181 THEN x := x - 1 END;
+IF x > 4182 THEN x := x - 1 END;
+IF x > 4183 THEN x := x - 1 END;
+IF x > 4184 THEN x := x - 1 END;
+IF x > 4185 THEN x := x - 1 END;
+IF x > 4186 THEN x := x - 1 END;
+IF x > 4187 THEN x := x - 1 END;
+IF x > 4188 THEN x := x - 1 END;
+IF x > 4189 THEN x := x - 1 END;
+IF x > 4190 THEN x := x - 1 END;
+IF x > 4191 THEN x := x - 1 END;
+IF x > 4192 THEN x := x - 1 END;
+IF x > 4193 THEN x := x - 1 END;
+IF x > 4194 THEN x := x - 1 END;
+IF x > 4195 THEN x := x - 1 END;
+IF x > 4196 THEN x := x - 1 END;
+IF x > 4197 THEN x := x - 1 END;
+IF x > 4198 THEN x := x - 1 END;
+IF x > 4199 THEN x := x - 1 END;
+IF x > 4200 THEN x := x - 1 END;
+IF x > 4201 THEN x := x - 1 END;
+IF x > 4202 THEN x := x - 1 END;
+IF x > 4203 THEN x := x - 1 END;
+IF x > 4204 THEN x := x - 1 END;
+IF x > 4205 THEN x := x - 1 END;
+IF x > 4206 THEN x := x - 1 END;
+IF x > 4207 THEN x := x - 1 END;
+IF x > 4208 THEN x := x - 1 END;
+IF x > 4209 THEN x := x - 1 END;
+IF x > 4210 THEN x := x - 1 END;
+IF x > 4211 THEN x := x - 1 END;
+IF x > 4212 THEN x := x - 1 END;
+IF x > 4213 THEN x := x - 1 END;
+IF x > 4214 THEN x := x - 1 END;
+IF x > 4215 THEN x := x - 1 END;
+IF x > 4216 THEN x := x - 1 END;
+IF x > 4217 THEN x := x - 1 END;
+IF x > 4218 THEN x := x - 1 END;
+IF x > 4219 THEN x := x - 1 END;
+IF x > 4220 THEN x := x - 1 END;
+IF x > 4221 THEN x := x - 1 END;
+IF x > 4222 THEN x := x - 1 END;
+IF x > 4223 THEN x := x - 1 END;
+IF x > 4224 THEN x := x - 1 END;
+IF x > 4225 THEN x := x - 1 END;
+IF x > 4226 THEN x := x - 1 END;
+IF x > 4227 THEN x := x - 1 END;
+IF x > 4228 THEN x := x - 1 END;
+IF x > 4229 THEN x := x - 1 END;
+IF x > 4230 THEN x := x - 1 END;
+IF x > 4231 THEN x := x - 1 END;
+IF x > 4232 THEN x := x - 1 END;
+IF x > 4233 THEN x := x - 1 END;
+IF x > 4234 THEN x := x - 1 END;
+IF x > 4235 THEN x := x - 1 END;
+IF x > 4236 THEN x := x - 1 END;
+IF x > 4237 THEN x := x - 1 END;
+IF x > 4238 THEN x := x - 1 END;
+IF x > 4239 THEN x := x - 1 END;
+IF x > 4240 THEN x := x - 1 END;
+IF x > 4241 THEN x := x - 1 END;
+IF x > 4242 THEN x := x - 1 END;
+IF x > 4243 THEN x := x - 1 END;
+IF x > 4244 THEN x := x - 1 END;
+IF x > 4245 THEN x := x - 1 END;
+IF x > 4246 THEN x := x - 1 END;
+IF x > 4247 THEN x := x - 1 END;
+IF x > 4248 THEN x := x - 1 END;
+IF x > 4249 THEN x := x - 1 END;
+IF x > 4250 THEN x := x - 1 END;
+IF x > 4251 THEN x := x - 1 END;
+IF x > 4252 THEN x := x - 1 END;
+IF x > 4253 THEN x := x - 1 END;
+IF x > 4254 THEN x := x - 1 END;
+IF x > 4255 THEN x := x - 1 END;
+IF x > 4256 THEN x := x - 1 END;
+IF x > 4257 THEN x := x - 1 END;
+IF x > 4258 THEN x := x - 1 END;
+IF x > 4259 THEN x := x - 1 END;
+IF x > 4260 THEN x := x - 1 END;
+IF x > 4261 THEN x := x - 1 END;
+IF x > 4262 THEN x := x - 1 END;
+IF x > 4263 THEN x := x - 1 END;
+IF x > 4264 THEN x := x - 1 END;
+IF x > 4265 THEN x := x - 1 END;
+IF x > 4266 THEN x := x - 1 END;
+IF x > 4267 THEN x := x - 1 END;
+IF x > 4268 THEN x := x - 1 END;
+IF x > 4269 THEN x := x - 1 END;
+IF x > 4270 THEN x := x - 1 END;
+IF x > 4271 THEN x := x - 1 END;
+IF x > 4272 THEN x := x - 1 END;
+IF x > 4273 THEN x := x - 1 END;
+IF x > 4274 THEN x := x - 1 END;
+IF x > 4275 THEN x := x - 1 END;
+IF x > 4276 THEN x := x - 1 END;
+IF x > 4277 THEN x := x - 1 END;
+IF x > 4278 THEN x := x - 1 END;
+IF x > 4279 THEN x := x - 1 END;
+IF x > 4280 THEN x := x - 1 END;
+IF x > 4281 THEN x := x - 1 END;
+IF x > 4282 THEN x := x - 1 END;
+IF x > 4283 THEN x := x - 1 END;
+IF x > 4284 THEN x := x - 1 END;
+IF x > 4285 THEN x := x - 1 END;
+IF x > 4286 THEN x := x - 1 END;
+IF x > 4287 THEN x := x - 1 END;
+IF x > 4288 THEN x := x - 1 END;
+IF x > 4289 THEN x := x - 1 END;
+IF x > 4290 THEN x := x - 1 END;
+IF x > 4291 THEN x := x - 1 END;
+IF x > 4292 THEN x := x - 1 END;
+IF x > 4293 THEN x := x - 1 END;
+IF x > 4294 THEN x := x - 1 END;
+IF x > 4295 THEN x := x - 1 END;
+IF x > 4296 THEN x := x - 1 END;
+IF x > 4297 THEN x := x - 1 END;
+IF x > 4298 THEN x := x - 1 END;
+IF x > 4299 THEN x := x - 1 END;
+IF x > 4300 THEN x := x - 1 END;
+IF x > 4301 THEN x := x - 1 END;
+IF x > 4302 THEN x := x - 1 END;
+IF x > 4303 THEN x := x - 1 END;
+IF x > 4304 THEN x := x - 1 END;
+IF x > 4305 THEN x := x - 1 END;
+IF x > 4306 THEN x := x - 1 END;
+IF x > 4307 THEN x := x - 1 END;
+IF x > 4308 THEN x := x - 1 END;
+IF x > 4309 THEN x := x - 1 END;
+IF x > 4310 THEN x := x - 1 END;
+IF x > 4311 THEN x := x - 1 END;
+IF x > 4312 THEN x := x - 1 END;
+IF x > 4313 THEN x := x - 1 END;
+IF x > 4314 THEN x := x - 1 END;
+IF x > 4315 THEN x := x - 1 END;
+IF x > 4316 THEN x := x - 1 END;
+IF x > 4317 THEN x := x - 1 END;
+IF x > 4318 THEN x := x - 1 END;
+IF x > 4319 THEN x := x - 1 END;
+IF x > 4320 THEN x := x - 1 END;
+IF x > 4321 THEN x := x - 1 END;
+IF x > 4322 THEN x := x - 1 END;
+IF x > 4323 THEN x := x - 1 END;
+IF x > 4324 THEN x := x - 1 END;
+IF x > 4325 THEN x := x - 1 END;
+IF x > 4326 THEN x := x - 1 END;
+IF x > 4327 THEN x := x - 1 END;
+IF x > 4328 THEN x := x - 1 END;
+IF x > 4329 THEN x := x - 1 END;
+IF x > 4330 THEN x := x - 1 END;
+IF x > 4331 THEN x := x - 1 END;
+IF x > 4332 THEN x := x - 1 END;
+IF x > 4333 THEN x := x - 1 END;
+IF x > 4334 THEN x := x - 1 END;
+IF x > 4335 THEN x := x - 1 END;
+IF x > 4336 THEN x := x - 1 END;
+IF x > 4337 THEN x := x - 1 END;
+IF x > 4338 THEN x := x - 1 END;
+IF x > 4339 THEN x := x - 1 END;
+IF x > 4340 THEN x := x - 1 END;
+IF x > 4341 THEN x := x - 1 END;
+IF x > 4342 THEN x := x - 1 END;
+IF x > 4343 THEN x := x - 1 END;
+IF x > 4344 THEN x := x - 1 END;
+IF x > 4345 THEN x := x - 1 END;
+IF x > 4346 THEN x := x - 1 END;
+IF x > 4347 THEN x := x - 1 END;
+IF x > 4348 THEN x := x - 1 END;
+IF x > 4349 THEN x := x - 1 END;
+IF x > 4350 THEN x := x - 1 END;
+IF x > 4351 THEN x := x - 1 END;
+IF x > 4352 THEN x := x - 1 END;
+IF x > 4353 THEN x := x - 1 END;
+IF x > 4354 THEN x := x - 1 END;
+IF x > 4355 THEN x := x - 1 END;
+IF x > 4356 THEN x := x - 1 END;
+IF x > 4357 THEN x := x - 1 END;
+IF x > 4358 THEN x := x - 1 END;
+IF x > 4359 THEN x := x - 1 END;
+IF x > 4360 THEN x := x - 1 END;
+IF x > 4361 THEN x := x - 1 END;
+IF x > 4362 THEN x := x - 1 END;
+IF x > 4363 THEN x := x - 1 END;
+IF x > 4364 THEN x := x - 1 END;
+IF x > 4365 THEN x := x - 1 END;
+IF x > 4366 THEN x := x - 1 END;
+IF x > 4367 THEN x := x - 1 END;
+IF x > 4368 THEN x := x - 1 END;
+IF x > 4369 THEN x := x - 1 END;
+IF x > 4370 THEN x := x - 1 END;
+IF x > 4371 THEN x := x - 1 END;
+IF x > 4372 THEN x := x - 1 END;
+IF x > 4373 THEN x := x - 1 END;
+IF x > 4374 THEN x := x - 1 END;
+IF x > 4375 THEN x := x - 1 END;
+IF x > 4376 THEN x := x - 1 END;
+IF x > 4377 THEN x := x - 1 END;
+IF x > 4378 THEN x := x - 1 END;
+IF x > 4379 THEN x := x - 1 END;
+IF x > 4380 THEN x := x - 1 END;
+IF x > 4381 THEN x := x - 1 END;
+IF x > 4382 THEN x := x - 1 END;
+IF x > 4383 THEN x := x - 1 END;
+IF x > 4384 THEN x := x - 1 END;
+IF x > 4385 THEN x := x - 1 END;
+IF x > 4386 THEN x := x - 1 END;
+IF x > 4387 THEN x := x - 1 END;
+IF x > 4388 THEN x := x - 1 END;
+IF x > 4389 THEN x := x - 1 END;
+IF x > 4390 THEN x := x - 1 END;
+IF x > 4391 THEN x := x - 1 END;
+IF x > 4392 THEN x := x - 1 END;
+IF x > 4393 THEN x := x - 1 END;
+IF x > 4394 THEN x := x - 1 END;
+IF x > 4395 THEN x := x - 1 END;
+IF x > 4396 THEN x := x - 1 END;
+IF x > 4397 THEN x := x - 1 END;
+IF x > 4398 THEN x := x - 1 END;
+IF x > 4399 THEN x := x - 1 END;
+IF x > 4400 THEN x := x - 1 END;
+IF x > 4401 THEN x := x - 1 END;
+IF x > 4402 THEN x := x - 1 END;
+IF x > 4403 THEN x := x - 1 END;
+IF x > 4404 THEN x := x - 1 END;
+IF x > 4405 THEN x := x - 1 END;
+IF x > 4406 THEN x := x - 1 END;
+IF x > 4407 THEN x := x - 1 END;
+IF x > 4408 THEN x := x - 1 END;
+IF x > 4409 THEN x := x - 1 END;
+IF x > 4410 THEN x := x - 1 END;
+IF x > 4411 THEN x := x - 1 END;
+IF x > 4412 THEN x := x - 1 END;
+IF x > 4413 THEN x := x - 1 END;
+IF x > 4414 THEN x := x - 1 END;
+IF x > 4415 THEN x := x - 1 END;
+IF x > 4416 THEN x := x - 1 END;
+IF x > 4417 THEN x := x - 1 END;
+IF x > 4418 THEN x := x - 1 END;
+IF x > 4419 THEN x := x - 1 END;
+IF x > 4420 THEN x := x - 1 END;
+IF x > 4421 THEN x := x - 1 END;
+IF x > 4422 THEN x := x - 1 END;
+IF x > 4423 THEN x := x - 1 END;
+IF x > 4424 THEN x := x - 1 END;
+IF x > 4425 THEN x := x - 1 END;
+IF x > 4426 THEN x := x - 1 END;
+IF x > 4427 THEN x := x - 1 END;
+IF x > 4428 THEN x := x - 1 END;
+IF x > 4429 THEN x := x - 1 END;
+IF x > 4430 THEN x := x - 1 END;
+IF x > 4431 THEN x := x - 1 END;
+IF x > 4432 THEN x := x - 1 END;
+IF x > 4433 THEN x := x - 1 END;
+IF x > 4434 THEN x := x - 1 END;
+IF x > 4435 THEN x := x - 1 END;
+IF x > 4436 THEN x := x - 1 END;
+IF x > 4437 THEN x := x - 1 END;
+IF x > 4438 THEN x := x - 1 END;
+IF x > 4439 THEN x := x - 1 END;
+IF x > 4440 THEN x := x - 1 END;
+IF x > 4441 THEN x := x - 1 END;
+IF x > 4442 THEN x := x - 1 END;
+IF x > 4443 THEN x := x - 1 END;
+IF x > 4444 THEN x := x - 1 END;
+IF x > 4445 THEN x := x - 1 END;
+IF x > 4446 THEN x := x - 1 END;
+IF x > 4447 THEN x := x - 1 END;
+IF x > 4448 THEN x := x - 1 END;
+IF x > 4449 THEN x := x - 1 END;
+IF x > 4450 THEN x := x - 1 END;
+IF x > 4451 THEN x := x - 1 END;
+IF x > 4452 THEN x := x - 1 END;
+IF x > 4453 THEN x := x - 1 END;
+IF x > 4454 THEN x := x - 1 END;
+IF x > 4455 THEN x := x - 1 END;
+IF x > 4456 THEN x := x - 1 END;
+IF x > 4457 THEN x := x - 1 END;
+IF x > 4458 THEN x := x - 1 END;
+IF x > 4459 THEN x := x - 1 END;
+IF x > 4460 THEN x := x - 1 END;
+IF x > 4461 THEN x := x - 1 END;
+IF x > 4462 THEN x := x - 1 END;
+IF x > 4463 THEN x := x - 1 END;
+IF x > 4464 THEN x := x - 1 END;
+IF x > 4465 THEN x := x - 1 END;
+IF x > 4466 THEN x := x - 1 END;
+IF x > 4467 THEN x := x - 1 END;
+IF x > 4468 THEN x := x - 1 END;
+IF x > 4469 THEN x := x - 1 END;
+IF x > 4470 THEN x := x - 1 END;
+IF x > 4471 THEN x := x - 1 END;
+IF x > 4472 THEN x := x - 1 END;
+IF x > 4473 THEN x := x - 1 END;
+IF x > 4474 THEN x := x - 1 END;
+IF x > 4475 THEN x := x - 1 END;
+IF x > 4476 THEN x := x - 1 END;
+IF x > 4477 THEN x := x - 1 END;
+IF x > 4478 THEN x := x - 1 END;
+IF x > 4479 THEN x := x - 1 END;
+IF x > 4480 THEN x := x - 1 END;
+IF x > 4481 THEN x := x - 1 END;
+IF x > 4482 THEN x := x - 1 END;
+IF x > 4483 THEN x := x - 1 END;
+IF x > 4484 THEN x := x - 1 END;
+IF x > 4485 THEN x := x - 1 END;
+IF x > 4486 THEN x := x - 1 END;
+IF x > 4487 THEN x := x - 1 END;
+IF x > 4488 THEN x := x - 1 END;
+IF x > 4489 THEN x := x - 1 END;
+IF x > 4490 THEN x := x - 1 END;
+IF x > 4491 THEN x := x - 1 END;
+IF x > 4492 THEN x := x - 1 END;
+IF x > 4493 THEN x := x - 1 END;
+IF x > 4494 THEN x := x - 1 END;
+IF x > 4495 THEN x := x - 1 END;
+IF x > 4496 THEN x := x - 1 END;
+IF x > 4497 THEN x := x - 1 END;
+IF x > 4498 THEN x := x - 1 END;
+IF x > 4499 THEN x := x - 1 END;
+IF x > 4500 THEN x := x - 1 END;
+IF x > 4501 THEN x := x - 1 END;
+IF x > 4502 THEN x := x - 1 END;
+IF x > 4503 THEN x := x - 1 END;
+IF x > 4504 THEN x := x - 1 END;
+IF x > 4505 THEN x := x - 1 END;
+IF x > 4506 THEN x := x - 1 END;
+IF x > 4507 THEN x := x - 1 END;
+IF x > 4508 THEN x := x - 1 END;
+IF x > 4509 THEN x := x - 1 END;
+IF x > 4510 THEN x := x - 1 END;
+IF x > 4511 THEN x := x - 1 END;
+IF x > 4512 THEN x := x - 1 END;
+IF x > 4513 THEN x := x - 1 END;
+IF x > 4514 THEN x := x - 1 END;
+IF x > 4515 THEN x := x - 1 END;
+IF x > 4516 THEN x := x - 1 END;
+IF x > 4517 THEN x := x - 1 END;
+IF x > 4518 THEN x := x - 1 END;
+IF x > 4519 THEN x := x - 1 END;
+IF x > 4520 THEN x := x - 1 END;
+IF x > 4521 THEN x := x - 1 END;
+IF x > 4522 THEN x := x - 1 END;
+IF x > 4523 THEN x := x - 1 END;
+IF x > 4524 THEN x := x - 1 END;
+IF x > 4525 THEN x := x - 1 END;
+IF x > 4526 THEN x := x - 1 END;
+IF x > 4527 THEN x := x - 1 END;
+IF x > 4528 THEN x := x - 1 END;
+IF x > 4529 THEN x := x - 1 END;
+IF x > 4530 THEN x := x - 1 END;
+IF x > 4531 THEN x := x - 1 END;
+IF x > 4532 THEN x := x - 1 END;
+IF x > 4533 THEN x := x - 1 END;
+IF x > 4534 THEN x := x - 1 END;
+IF x > 4535 THEN x := x - 1 END;
+IF x > 4536 THEN x := x - 1 END;
+IF x > 4537 THEN x := x - 1 END;
+IF x > 4538 THEN x := x - 1 END;
+IF x > 4539 THEN x := x - 1 END;
+IF x > 4540 THEN x := x - 1 END;
+IF x > 4541 THEN x := x - 1 END;
+IF x > 4542 THEN x := x - 1 END;
+IF x > 4543 THEN x := x - 1 END;
+IF x > 4544 THEN x := x - 1 END;
+IF x > 4545 THEN x := x - 1 END;
+IF x > 4546 THEN x := x - 1 END;
+IF x > 4547 THEN x := x - 1 END;
+IF x > 4548 THEN x := x - 1 END;
+IF x > 4549 THEN x := x - 1 END;
+IF x > 4550 THEN x := x - 1 END;
+IF x > 4551 THEN x := x - 1 END;
+IF x > 4552 THEN x := x - 1 END;
+IF x > 4553 THEN x := x - 1 END;
+IF x > 4554 THEN x := x - 1 END;
+IF x > 4555 THEN x := x - 1 END;
+IF x > 4556 THEN x := x - 1 END;
+IF x > 4557 THEN x := x - 1 END;
+IF x > 4558 THEN x := x - 1 END;
+IF x > 4559 THEN x := x - 1 END;
+IF x > 4560 THEN x := x - 1 END;
+IF x > 4561 THEN x := x - 1 END;
+IF x > 4562 THEN x := x - 1 END;
+IF x > 4563 THEN x := x - 1 END;
+IF x > 4564 THEN x := x - 1 END;
+IF x > 4565 THEN x := x - 1 END;
+IF x > 4566 THEN x := x - 1 END;
+IF x > 4567 THEN x := x - 1 END;
+IF x > 4568 THEN x := x - 1 END;
+IF x > 4569 THEN x := x - 1 END;
+IF x > 4570 THEN x := x - 1 END;
+IF x > 4571 THEN x := x - 1 END;
+IF x > 4572 THEN x := x - 1 END;
+IF x > 4573 THEN x := x - 1 END;
+IF x > 4574 THEN x := x - 1 END;
+IF x > 4575 THEN x := x - 1 END;
+IF x > 4576 THEN x := x - 1 END;
+IF x > 4577 THEN x := x - 1 END;
+IF x > 4578 THEN x := x - 1 END;
+IF x > 4579 THEN x := x - 1 END;
+IF x > 4580 THEN x := x - 1 END;
+IF x > 4581 THEN x := x - 1 END;
+IF x > 4582 THEN x := x - 1 END;
+IF x > 4583 THEN x := x - 1 END;
+IF x > 4584 THEN x := x - 1 END;
+IF x > 4585 THEN x := x - 1 END;
+IF x > 4586 THEN x := x - 1 END;
+IF x > 4587 THEN x := x - 1 END;
+IF x > 4588 THEN x := x - 1 END;
+IF x > 4589 THEN x := x - 1 END;
+IF x > 4590 THEN x := x - 1 END;
+IF x > 4591 THEN x := x - 1 END;
+IF x > 4592 THEN x := x - 1 END;
+IF x > 4593 THEN x := x - 1 END;
+IF x > 4594 THEN x := x - 1 END;
+IF x > 4595 THEN x := x - 1 END;
+IF x > 4596 THEN x := x - 1 END;
+IF x > 4597 THEN x := x - 1 END;
+IF x > 4598 THEN x := x - 1 END;
+IF x > 4599 THEN x := x - 1 END;
+IF x > 4600 THEN x := x - 1 END;
+IF x > 4601 THEN x := x - 1 END;
+IF x > 4602 THEN x := x - 1 END;
+IF x > 4603 THEN x := x - 1 END;
+IF x > 4604 THEN x := x - 1 END;
+IF x > 4605 THEN x := x - 1 END;
+IF x > 4606 THEN x := x - 1 END;
+IF x > 4607 THEN x := x - 1 END;
+IF x > 4608 THEN x := x - 1 END;
+IF x > 4609 THEN x := x - 1 END;
+IF x > 4610 THEN x := x - 1 END;
+IF x > 4611 THEN x := x - 1 END;
+IF x > 4612 THEN x := x - 1 END;
+IF x > 4613 THEN x := x - 1 END;
+IF x > 4614 THEN x := x - 1 END;
+IF x > 4615 THEN x := x - 1 END;
+IF x > 4616 THEN x := x - 1 END;
+IF x > 4617 THEN x := x - 1 END;
+IF x > 4618 THEN x := x - 1 END;
+IF x > 4619 THEN x := x - 1 END;
+IF x > 4620 THEN x := x - 1 END;
+IF x > 4621 THEN x := x - 1 END;
+IF x > 4622 THEN x := x - 1 END;
+IF x > 4623 THEN x := x - 1 END;
+IF x > 4624 THEN x := x - 1 END;
+IF x > 4625 THEN x := x - 1 END;
+IF x > 4626 THEN x := x - 1 END;
+IF x > 4627 THEN x := x - 1 END;
+IF x > 4628 THEN x := x - 1 END;
+IF x > 4629 THEN x := x - 1 END;
+IF x > 4630 THEN x := x - 1 END;
+IF x > 4631 THEN x := x - 1 END;
+IF x > 4632 THEN x := x - 1 END;
+IF x > 4633 THEN x := x - 1 END;
+IF x > 4634 THEN x := x - 1 END;
+IF x > 4635 THEN x := x - 1 END;
+IF x > 4636 THEN x := x - 1 END;
+IF x > 4637 THEN x := x - 1 END;
+IF x > 4638 THEN x := x - 1 END;
+IF x > 4639 THEN x := x - 1 END;
+IF x > 4640 THEN x := x - 1 END;
+IF x > 4641 THEN x := x - 1 END;
+IF x > 4642 THEN x := x - 1 END;
+IF x > 4643 THEN x := x - 1 END;
+IF x > 4644 THEN x := x - 1 END;
+IF x > 4645 THEN x := x - 1 END;
+IF x > 4646 THEN x := x - 1 END;
+IF x > 4647 THEN x := x - 1 END;
+IF x > 4648 THEN x := x - 1 END;
+IF x > 4649 THEN x := x - 1 END;
+IF x > 4650 THEN x := x - 1 END;
+IF x > 4651 THEN x := x - 1 END;
+IF x > 4652 THEN x := x - 1 END;
+IF x > 4653 THEN x := x - 1 END;
+IF x > 4654 THEN x := x - 1 END;
+IF x > 4655 THEN x := x - 1 END;
+IF x > 4656 THEN x := x - 1 END;
+IF x > 4657 THEN x := x - 1 END;
+IF x > 4658 THEN x := x - 1 END;
+IF x > 4659 THEN x := x - 1 END;
+IF x > 4660 THEN x := x - 1 END;
+IF x > 4661 THEN x := x - 1 END;
+IF x > 4662 THEN x := x - 1 END;
+IF x > 4663 THEN x := x - 1 END;
+IF x > 4664 THEN x := x - 1 END;
+IF x > 4665 THEN x := x - 1 END;
+IF x > 4666 THEN x := x - 1 END;
+IF x > 4667 THEN x := x - 1 END;
+IF x > 4668 THEN x := x - 1 END;
+IF x > 4669 THEN x := x - 1 END;
+IF x > 4670 THEN x := x - 1 END;
+IF x > 4671 THEN x := x - 1 END;
+IF x > 4672 THEN x := x - 1 END;
+IF x > 4673 THEN x := x - 1 END;
+IF x > 4674 THEN x := x - 1 END;
+IF x > 4675 THEN x := x - 1 END;
+IF x > 4676 THEN x := x - 1 END;
+IF x > 4677 THEN x := x - 1 END;
+IF x > 4678 THEN x := x - 1 END;
+IF x > 4679 THEN x := x - 1 END;
+IF x > 4680 THEN x := x - 1 END;
+IF x > 4681 THEN x := x - 1 END;
+IF x > 4682 THEN x := x - 1 END;
+IF x > 4683 THEN x := x - 1 END;
+IF x > 4684 THEN x := x - 1 END;
+IF x > 4685 THEN x := x - 1 END;
+IF x > 4686 THEN x := x - 1 END;
+IF x > 4687 THEN x := x - 1 END;
+IF x > 4688 THEN x := x - 1 END;
+IF x > 4689 THEN x := x - 1 END;
+IF x > 4690 THEN x := x - 1 END;
+IF x > 4691 THEN x := x - 1 END;
+IF x > 4692 THEN x := x - 1 END;
+IF x > 4693 THEN x := x - 1 END;
+IF x > 4694 THEN x := x - 1 END;
+IF x > 4695 THEN x := x - 1 END;
+IF x > 4696 THEN x := x - 1 END;
+IF x > 4697 THEN x := x - 1 END;
+IF x > 4698 THEN x := x - 1 END;
+IF x > 4699 THEN x := x - 1 END;
+IF x > 4700 THEN x := x - 1 END;
+IF x > 4701 THEN x := x - 1 END;
+IF x > 4702 THEN x := x - 1 END;
+IF x > 4703 THEN x := x - 1 END;
+IF x > 4704 THEN x := x - 1 END;
+IF x > 4705 THEN x := x - 1 END;
+IF x > 4706 THEN x := x - 1 END;
+IF x > 4707 THEN x := x - 1 END;
+IF x > 4708 THEN x := x - 1 END;
+IF x > 4709 THEN x := x - 1 END;
+IF x > 4710 THEN x := x - 1 END;
+IF x > 4711 THEN x := x - 1 END;
+IF x > 4712 THEN x := x - 1 END;
+IF x > 4713 THEN x := x - 1 END;
+IF x > 4714 THEN x := x - 1 END;
+IF x > 4715 THEN x := x - 1 END;
+IF x > 4716 THEN x := x - 1 END;
+IF x > 4717 THEN x := x - 1 END;
+IF x > 4718 THEN x := x - 1 END;
+IF x > 4719 THEN x := x - 1 END;
+IF x > 4720 THEN x := x - 1 END;
+IF x > 4721 THEN x := x - 1 END;
+IF x > 4722 THEN x := x - 1 END;
+IF x > 4723 THEN x := x - 1 END;
+IF x > 4724 THEN x := x - 1 END;
+IF x > 4725 THEN x := x - 1 END;
+IF x > 4726 THEN x := x - 1 END;
+IF x > 4727 THEN x := x - 1 END;
+IF x > 4728 THEN x := x - 1 END;
+IF x > 4729 THEN x := x - 1 END;
+IF x > 4730 THEN x := x - 1 END;
+IF x > 4731 THEN x := x - 1 END;
+IF x > 4732 THEN x := x - 1 END;
+IF x > 4733 THEN x := x - 1 END;
+IF x > 4734 THEN x := x - 1 END;
+IF x > 4735 THEN x := x - 1 END;
+IF x > 4736 THEN x := x - 1 END;
+IF x > 4737 THEN x := x - 1 END;
+IF x > 4738 THEN x := x - 1 END;
+IF x > 4739 THEN x := x - 1 END;
+IF x > 4740 THEN x := x - 1 END;
+IF x > 4741 THEN x := x - 1 END;
+IF x > 4742 THEN x := x - 1 END;
+IF x > 4743 THEN x := x - 1 END;
+IF x > 4744 THEN x := x - 1 END;
+IF x > 4745 THEN x := x - 1 END;
+IF x > 4746 THEN x := x - 1 END;
+IF x > 4747 THEN x := x - 1 END;
+IF x > 4748 THEN x := x - 1 END;
+IF x > 4749 THEN x := x - 1 END;
+IF x > 4750 THEN x := x - 1 END;
+IF x > 4751 THEN x := x - 1 END;
+IF x > 4752 THEN x := x - 1 END;
+IF x > 4753 THEN x := x - 1 END;
+IF x > 4754 THEN x := x - 1 END;
+IF x > 4755 THEN x := x - 1 END;
+IF x > 4756 THEN x := x - 1 END;
+IF x > 4757 THEN x := x - 1 END;
+IF x > 4758 THEN x := x - 1 END;
+IF x > 4759 THEN x := x - 1 END;
+IF x > 4760 THEN x := x - 1 END;
+IF x > 4761 THEN x := x - 1 END;
+IF x > 4762 THEN x := x - 1 END;
+IF x > 4763 THEN x := x - 1 END;
+IF x > 4764 THEN x := x - 1 END;
+IF x > 4765 THEN x := x - 1 END;
+IF x > 4766 THEN x := x - 1 END;
+IF x > 4767 THEN x := x - 1 END;
+IF x > 4768 THEN x := x - 1 END;
+IF x > 4769 THEN x := x - 1 END;
+IF x > 4770 THEN x := x - 1 END;
+IF x > 4771 THEN x := x - 1 END;
+IF x > 4772 THEN x := x - 1 END;
+IF x > 4773 THEN x := x - 1 END;
+IF x > 4774 THEN x := x - 1 END;
+IF x > 4775 THEN x := x - 1 END;
+IF x > 4776 THEN x := x - 1 END;
+IF x > 4777 THEN x := x - 1 END;
+IF x > 4778 THEN x := x - 1 END;
+IF x > 4779 THEN x := x - 1 END;
+IF x > 4780 THEN x := x - 1 END;
+IF x > 4781 THEN x := x - 1 END;
+IF x > 4782 THEN x := x - 1 END;
+IF x > 4783 THEN x := x - 1 END;
+IF x > 4784 THEN x := x - 1 END;
+IF x > 4785 THEN x := x - 1 END;
+IF x > 4786 THEN x := x - 1 END;
+IF x > 4787 THEN x := x - 1 END;
+IF x > 4788 THEN x := x - 1 END;
+IF x > 4789 THEN x := x - 1 END;
+IF x > 4790 THEN x := x - 1 END;
+IF x > 4791 THEN x := x - 1 END;
+IF x > 4792 THEN x := x - 1 END;
+IF x > 4793 THEN x := x - 1 END;
+IF x > 4794 THEN x := x - 1 END;
+IF x > 4795 THEN x := x - 1 END;
+IF x > 4796 THEN x := x - 1 END;
+IF x > 4797 THEN x := x - 1 END;
+IF x > 4798 THEN x := x - 1 END;
+IF x > 4799 THEN x := x - 1 END;
+IF x > 4800 THEN x := x - 1 END;
+IF x > 4801 THEN x := x - 1 END;
+IF x > 4802 THEN x := x - 1 END;
+IF x > 4803 THEN x := x - 1 END;
+IF x > 4804 THEN x := x - 1 END;
+IF x > 4805 THEN x := x - 1 END;
+IF x > 4806 THEN x := x - 1 END;
+IF x > 4807 THEN x := x - 1 END;
+IF x > 4808 THEN x := x - 1 END;
+IF x > 4809 THEN x := x - 1 END;
+IF x > 4810 THEN x := x - 1 END;
+IF x > 4811 THEN x := x - 1 END;
+IF x > 4812 THEN x := x - 1 END;
+IF x > 4813 THEN x := x - 1 END;
+IF x > 4814 THEN x := x - 1 END;
+IF x > 4815 THEN x := x - 1 END;
+IF x > 4816 THEN x := x - 1 END;
+IF x > 4817 THEN x := x - 1 END;
+IF x > 4818 THEN x := x - 1 END;
+IF x > 4819 THEN x := x - 1 END;
+IF x > 4820 THEN x := x - 1 END;
+IF x > 4821 THEN x := x - 1 END;
+IF x > 4822 THEN x := x - 1 END;
+IF x > 4823 THEN x := x - 1 END;
+IF x > 4824 THEN x := x - 1 END;
+IF x > 4825 THEN x := x - 1 END;
+IF x > 4826 THEN x := x - 1 END;
+IF x > 4827 THEN x := x - 1 END;
+IF x > 4828 THEN x := x - 1 END;
+IF x > 4829 THEN x := x - 1 END;
+IF x > 4830 THEN x := x - 1 END;
+IF x > 4831 THEN x := x - 1 END;
+IF x > 4832 THEN x := x - 1 END;
+IF x > 4833 THEN x := x - 1 END;
+IF x > 4834 THEN x := x - 1 END;
+IF x > 4835 THEN x := x - 1 END;
+IF x > 4836 THEN x := x - 1 END;
+IF x > 4837 THEN x := x - 1 END;
+IF x > 4838 THEN x := x - 1 END;
+IF x > 4839 THEN x := x - 1 END;
+IF x > 4840 THEN x := x - 1 END;
+IF x > 4841 THEN x := x - 1 END;
+IF x > 4842 THEN x := x - 1 END;
+IF x > 4843 THEN x := x - 1 END;
+IF x > 4844 THEN x := x - 1 END;
+IF x > 4845 THEN x := x - 1 END;
+IF x > 4846 THEN x := x - 1 END;
+IF x > 4847 THEN x := x - 1 END;
+IF x > 4848 THEN x := x - 1 END;
+IF x > 4849 THEN x := x - 1 END;
+IF x > 4850 THEN x := x - 1 END;
+IF x > 4851 THEN x := x - 1 END;
+IF x > 4852 THEN x := x - 1 END;
+IF x > 4853 THEN x := x - 1 END;
+IF x > 4854 THEN x := x - 1 END;
+IF x > 4855 THEN x := x - 1 END;
+IF x > 4856 THEN x := x - 1 END;
+IF x > 4857 THEN x := x - 1 END;
+IF x > 4858 THEN x := x - 1 END;
+IF x > 4859 THEN x := x - 1 END;
+IF x > 4860 THEN x := x - 1 END;
+IF x > 4861 THEN x := x - 1 END;
+IF x > 4862 THEN x := x - 1 END;
+IF x > 4863 THEN x := x - 1 END;
+IF x > 4864 THEN x := x - 1 END;
+IF x > 4865 THEN x := x - 1 END;
+IF x > 4866 THEN x := x - 1 END;
+IF x > 4867 THEN x := x - 1 END;
+IF x > 4868 THEN x := x - 1 END;
+IF x > 4869 THEN x := x - 1 END;
+IF x > 4870 THEN x := x - 1 END;
+IF x > 4871 THEN x := x - 1 END;
+IF x > 4872 THEN x := x - 1 END;
+IF x > 4873 THEN x := x - 1 END;
+IF x > 4874 THEN x := x - 1 END;
+IF x > 4875 THEN x := x - 1 END;
+IF x > 4876 THEN x := x - 1 END;
+IF x > 4877 THEN x := x - 1 END;
+IF x > 4878 THEN x := x - 1 END;
+IF x > 4879 THEN x := x - 1 END;
+IF x > 4880 THEN x := x - 1 END;
+IF x > 4881 THEN x := x - 1 END;
+IF x > 4882 THEN x := x - 1 END;
+IF x > 4883 THEN x := x - 1 END;
+IF x > 4884 THEN x := x - 1 END;
+IF x > 4885 THEN x := x - 1 END;
+IF x > 4886 THEN x := x - 1 END;
+IF x > 4887 THEN x := x - 1 END;
+IF x > 4888 THEN x := x - 1 END;
+IF x > 4889 THEN x := x - 1 END;
+IF x > 4890 THEN x := x - 1 END;
+IF x > 4891 THEN x := x - 1 END;
+IF x > 4892 THEN x := x - 1 END;
+IF x > 4893 THEN x := x - 1 END;
+IF x > 4894 THEN x := x - 1 END;
+IF x > 4895 THEN x := x - 1 END;
+IF x > 4896 THEN x := x - 1 END;
+IF x > 4897 THEN x := x - 1 END;
+IF x > 4898 THEN x := x - 1 END;
+IF x > 4899 THEN x := x - 1 END;
+IF x > 4900 THEN x := x - 1 END;
+IF x > 4901 THEN x := x - 1 END;
+IF x > 4902 THEN x := x - 1 END;
+IF x > 4903 THEN x := x - 1 END;
+IF x > 4904 THEN x := x - 1 END;
+IF x > 4905 THEN x := x - 1 END;
+IF x > 4906 THEN x := x - 1 END;
+IF x > 4907 THEN x := x - 1 END;
+IF x > 4908 THEN x := x - 1 END;
+IF x > 4909 THEN x := x - 1 END;
+IF x > 4910 THEN x := x - 1 END;
+IF x > 4911 THEN x := x - 1 END;
+IF x > 4912 THEN x := x - 1 END;
+IF x > 4913 THEN x := x - 1 END;
+IF x > 4914 THEN x := x - 1 END;
+IF x > 4915 THEN x := x - 1 END;
+IF x > 4916 THEN x := x - 1 END;
+IF x > 4917 THEN x := x - 1 END;
+IF x > 4918 THEN x := x - 1 END;
+IF x > 4919 THEN x := x - 1 END;
+IF x > 4920 THEN x := x - 1 END;
+IF x > 4921 THEN x := x - 1 END;
+IF x > 4922 THEN x := x - 1 END;
+IF x > 4923 THEN x := x - 1 END;
+IF x > 4924 THEN x := x - 1 END;
+IF x > 4925 THEN x := x - 1 END;
+IF x > 4926 THEN x := x - 1 END;
+IF x > 4927 THEN x := x - 1 END;
+IF x > 4928 THEN x := x - 1 END;
+IF x > 4929 THEN x := x - 1 END;
+IF x > 4930 THEN x := x - 1 END;
+IF x > 4931 THEN x := x - 1 END;
+IF x > 4932 THEN x := x - 1 END;
+IF x > 4933 THEN x := x - 1 END;
+IF x > 4934 THEN x := x - 1 END;
+IF x > 4935 THEN x := x - 1 END;
+IF x > 4936 THEN x := x - 1 END;
+IF x > 4937 THEN x := x - 1 END;
+IF x > 4938 THEN x := x - 1 END;
+IF x > 4939 THEN x := x - 1 END;
+IF x > 4940 THEN x := x - 1 END;
+IF x > 4941 THEN x := x - 1 END;
+IF x > 4942 THEN x := x - 1 END;
+IF x > 4943 THEN x := x - 1 END;
+IF x > 4944 THEN x := x - 1 END;
+IF x > 4945 THEN x := x - 1 END;
+IF x > 4946 THEN x := x - 1 END;
+IF x > 4947 THEN x := x - 1 END;
+IF x > 4948 THEN x := x - 1 END;
+IF x > 4949 THEN x := x - 1 END;
+IF x > 4950 THEN x := x - 1 END;
+IF x > 4951 THEN x := x - 1 END;
+IF x > 4952 THEN x := x - 1 END;
+IF x > 4953 THEN x := x - 1 END;
+IF x > 4954 THEN x := x - 1 END;
+IF x > 4955 THEN x := x - 1 END;
+IF x > 4956 THEN x := x - 1 END;
+IF x > 4957 THEN x := x - 1 END;
+IF x > 4958 THEN x := x - 1 END;
+IF x > 4959 THEN x := x - 1 END;
+IF x > 4960 THEN x := x - 1 END;
+IF x > 4961 THEN x := x - 1 END;
+IF x > 4962 THEN x := x - 1 END;
+IF x > 4963 THEN x := x - 1 END;
+IF x > 4964 THEN x := x - 1 END;
+IF x > 4965 THEN x := x - 1 END;
+IF x > 4966 THEN x := x - 1 END;
+IF x > 4967 THEN x := x - 1 END;
+IF x > 4968 THEN x := x - 1 END;
+IF x > 4969 THEN x := x - 1 END;
+IF x > 4970 THEN x := x - 1 END;
+IF x > 4971 THEN x := x - 1 END;
+IF x > 4972 THEN x := x - 1 END;
+IF x > 4973 THEN x := x - 1 END;
+IF x > 4974 THEN x := x - 1 END;
+IF x > 4975 THEN x := x - 1 END;
+IF x > 4976 THEN x := x - 1 END;
+IF x > 4977 THEN x := x - 1 END;
+IF x > 4978 THEN x := x - 1 END;
+IF x > 4979 THEN x := x - 1 END;
+IF x > 4980 THEN x := x - 1 END;
+IF x > 4981 THEN x := x - 1 END;
+IF x > 4982 THEN x := x - 1 END;
+IF x > 4983 THEN x := x - 1 END;
+IF x > 4984 THEN x := x - 1 END;
+IF x > 4985 THEN x := x - 1 END;
+IF x > 4986 THEN x := x - 1 END;
+IF x > 4987 THEN x := x - 1 END;
+IF x > 4988 THEN x := x - 1 END;
+IF x > 4989 THEN x := x - 1 END;
+IF x > 4990 THEN x := x - 1 END;
+IF x > 4991 THEN x := x - 1 END;
+IF x > 4992 THEN x := x - 1 END;
+IF x > 4993 THEN x := x - 1 END;
+IF x > 4994 THEN x := x - 1 END;
+IF x > 4995 THEN x := x - 1 END;
+IF x > 4996 THEN x := x - 1 END;
+IF x > 4997 THEN x := x - 1 END;
+IF x > 4998 THEN x := x - 1 END;
+IF x > 4999 THEN x := x - 1 END;
+IF x > 5000 THEN x := x - 1 END;
+IF x > 5001 THEN x := x - 1 END;
+IF x > 5002 THEN x := x - 1 END;
+IF x > 5003 THEN x := x - 1 END;
+IF x > 5004 THEN x := x - 1 END;
+IF x > 5005 THEN x := x - 1 END;
+IF x > 5006 THEN x := x - 1 END;
+IF x > 5007 THEN x := x - 1 END;
+IF x > 5008 THEN x := x - 1 END;
+IF x > 5009 THEN x := x - 1 END;
+IF x > 5010 THEN x := x - 1 END;
+IF x > 5011 THEN x := x - 1 END;
+IF x > 5012 THEN x := x - 1 END;
+IF x > 5013 THEN x := x - 1 END;
+IF x > 5014 THEN x := x - 1 END;
+IF x > 5015 THEN x := x - 1 END;
+IF x > 5016 THEN x := x - 1 END;
+IF x > 5017 THEN x := x - 1 END;
+IF x > 5018 THEN x := x - 1 END;
+IF x > 5019 THEN x := x - 1 END;
+IF x > 5020 THEN x := x - 1 END;
+IF x > 5021 THEN x := x - 1 END;
+IF x > 5022 THEN x := x - 1 END;
+IF x > 5023 THEN x := x - 1 END;
+IF x > 5024 THEN x := x - 1 END;
+IF x > 5025 THEN x := x - 1 END;
+IF x > 5026 THEN x := x - 1 END;
+IF x > 5027 THEN x := x - 1 END;
+IF x > 5028 THEN x := x - 1 END;
+IF x > 5029 THEN x := x - 1 END;
+IF x > 5030 THEN x := x - 1 END;
+IF x > 5031 THEN x := x - 1 END;
+IF x > 5032 THEN x := x - 1 END;
+IF x > 5033 THEN x := x - 1 END;
+IF x > 5034 THEN x := x - 1 END;
+IF x > 5035 THEN x := x - 1 END;
+IF x > 5036 THEN x := x - 1 END;
+IF x > 5037 THEN x := x - 1 END;
+IF x > 5038 THEN x := x - 1 END;
+IF x > 5039 THEN x := x - 1 END;
+IF x > 5040 THEN x := x - 1 END;
+IF x > 5041 THEN x := x - 1 END;
+IF x > 5042 THEN x := x - 1 END;
+IF x > 5043 THEN x := x - 1 END;
+IF x > 5044 THEN x := x - 1 END;
+IF x > 5045 THEN x := x - 1 END;
+IF x > 5046 THEN x := x - 1 END;
+IF x > 5047 THEN x := x - 1 END;
+IF x > 5048 THEN x := x - 1 END;
+IF x > 5049 THEN x := x - 1 END;
+IF x > 5050 THEN x := x - 1 END;
+IF x > 5051 THEN x := x - 1 END;
+IF x > 5052 THEN x := x - 1 END;
+IF x > 5053 THEN x := x - 1 END;
+IF x > 5054 THEN x := x - 1 END;
+IF x > 5055 THEN x := x - 1 END;
+IF x > 5056 THEN x := x - 1 END;
+IF x > 5057 THEN x := x - 1 END;
+IF x > 5058 THEN x := x - 1 END;
+IF x > 5059 THEN x := x - 1 END;
+IF x > 5060 THEN x := x - 1 END;
+IF x > 5061 THEN x := x - 1 END;
+IF x > 5062 THEN x := x - 1 END;
+IF x > 5063 THEN x := x - 1 END;
+IF x > 5064 THEN x := x - 1 END;
+IF x > 5065 THEN x := x - 1 END;
+IF x > 5066 THEN x := x - 1 END;
+IF x > 5067 THEN x := x - 1 END;
+IF x > 5068 THEN x := x - 1 END;
+IF x > 5069 THEN x := x - 1 END;
+IF x > 5070 THEN x := x - 1 END;
+IF x > 5071 THEN x := x - 1 END;
+IF x > 5072 THEN x := x - 1 END;
+IF x > 5073 THEN x := x - 1 END;
+IF x > 5074 THEN x := x - 1 END;
+IF x > 5075 THEN x := x - 1 END;
+IF x > 5076 THEN x := x - 1 END;
+IF x > 5077 THEN x := x - 1 END;
+IF x > 5078 THEN x := x - 1 END;
+IF x > 5079 THEN x := x - 1 END;
+IF x > 5080 THEN x := x - 1 END;
+IF x > 5081 THEN x := x - 1 END;
+IF x > 5082 THEN x := x - 1 END;
+IF x > 5083 THEN x := x - 1 END;
+IF x > 5084 THEN x := x - 1 END;
+IF x > 5085 THEN x := x - 1 END;
+IF x > 5086 THEN x := x - 1 END;
+IF x > 5087 THEN x := x - 1 END;
+IF x > 5088 THEN x := x - 1 END;
+IF x > 5089 THEN x := x - 1 END;
+IF x > 5090 THEN x := x - 1 END;
+IF x > 5091 THEN x := x - 1 END;
+IF x > 5092 THEN x := x - 1 END;
+IF x > 5093 THEN x := x - 1 END;
+IF x > 5094 THEN x := x - 1 END;
+IF x > 5095 THEN x := x - 1 END;
+IF x > 5096 THEN x := x - 1 END;
+IF x > 5097 THEN x := x - 1 END;
+IF x > 5098 THEN x := x - 1 END;
+IF x > 5099 THEN x := x - 1 END;
+IF x > 5100 THEN x := x - 1 END;
+IF x > 5101 THEN x := x - 1 END;
+IF x > 5102 THEN x := x - 1 END;
+IF x > 5103 THEN x := x - 1 END;
+IF x > 5104 THEN x := x - 1 END;
+IF x > 5105 THEN x := x - 1 END;
+IF x > 5106 THEN x := x - 1 END;
+IF x > 5107 THEN x := x - 1 END;
+IF x > 5108 THEN x := x - 1 END;
+IF x > 5109 THEN x := x - 1 END;
+IF x > 5110 THEN x := x - 1 END;
+IF x > 5111 THEN x := x - 1 END;
+IF x > 5112 THEN x := x - 1 END;
+IF x > 5113 THEN x := x - 1 END;
+IF x > 5114 THEN x := x - 1 END;
+IF x > 5115 THEN x := x - 1 END;
+IF x > 5116 THEN x := x - 1 END;
+IF x > 5117 THEN x := x - 1 END;
+IF x > 5118 THEN x := x - 1 END;
+IF x > 5119 THEN x := x - 1 END;
+IF x > 5120 THEN x := x - 1 END;
+IF x > 5121 THEN x := x - 1 END;
+IF x > 5122 THEN x := x - 1 END;
+IF x > 5123 THEN x := x - 1 END;
+IF x > 5124 THEN x := x - 1 END;
+IF x > 5125 THEN x := x - 1 END;
+IF x > 5126 THEN x := x - 1 END;
+IF x > 5127 THEN x := x - 1 END;
+IF x > 5128 THEN x := x - 1 END;
+IF x > 5129 THEN x := x - 1 END;
+IF x > 5130 THEN x := x - 1 END;
+IF x > 5131 THEN x := x - 1 END;
+IF x > 5132 THEN x := x - 1 END;
+IF x > 5133 THEN x := x - 1 END;
+IF x > 5134 THEN x := x - 1 END;
+IF x > 5135 THEN x := x - 1 END;
+IF x > 5136 THEN x := x - 1 END;
+IF x > 5137 THEN x := x - 1 END;
+IF x > 5138 THEN x := x - 1 END;
+IF x > 5139 THEN x := x - 1 END;
+IF x > 5140 THEN x := x - 1 END;
+IF x > 5141 THEN x := x - 1 END;
+IF x > 5142 THEN x := x - 1 END;
+IF x > 5143 THEN x := x - 1 END;
+IF x > 5144 THEN x := x - 1 END;
+IF x > 5145 THEN x := x - 1 END;
+IF x > 5146 THEN x := x - 1 END;
+IF x > 5147 THEN x := x - 1 END;
+IF x > 5148 THEN x := x - 1 END;
+IF x > 5149 THEN x := x - 1 END;
+IF x > 5150 THEN x := x - 1 END;
+IF x > 5151 THEN x := x - 1 END;
+IF x > 5152 THEN x := x - 1 END;
+IF x > 5153 THEN x := x - 1 END;
+IF x > 5154 THEN x := x - 1 END;
+IF x > 5155 THEN x := x - 1 END;
+IF x > 5156 THEN x := x - 1 END;
+IF x > 5157 THEN x := x - 1 END;
+IF x > 5158 THEN x := x - 1 END;
+IF x > 5159 THEN x := x - 1 END;
+IF x > 5160 THEN x := x - 1 END;
+IF x > 5161 THEN x := x - 1 END;
+IF x > 5162 THEN x := x - 1 END;
+IF x > 5163 THEN x := x - 1 END;
+IF x > 5164 THEN x := x - 1 END;
+IF x > 5165 THEN x := x - 1 END;
+IF x > 5166 THEN x := x - 1 END;
+IF x > 5167 THEN x := x - 1 END;
+IF x > 5168 THEN x := x - 1 END;
+IF x > 5169 THEN x := x - 1 END;
+IF x > 5170 THEN x := x - 1 END;
+IF x > 5171 THEN x := x - 1 END;
+IF x > 5172 THEN x := x - 1 END;
+IF x > 5173 THEN x := x - 1 END;
+IF x > 5174 THEN x := x - 1 END;
+IF x > 5175 THEN x := x - 1 END;
+IF x > 5176 THEN x := x - 1 END;
+IF x > 5177 THEN x := x - 1 END;
+IF x > 5178 THEN x := x - 1 END;
+IF x > 5179 THEN x := x - 1 END;
+IF x > 5180 THEN x := x - 1 END;
+IF x > 5181 THEN x := x - 1 END;
+IF x > 5182 THEN x := x - 1 END;
+IF x > 5183 THEN x := x - 1 END;
+IF x > 5184 THEN x := x - 1 END;
+IF x > 5185 THEN x := x - 1 END;
+IF x > 5186 THEN x := x - 1 END;
+IF x > 5187 THEN x := x - 1 END;
+IF x > 5188 THEN x := x - 1 END;
+IF x > 5189 THEN x := x - 1 END;
+IF x > 5190 THEN x := x - 1 END;
+IF x > 5191 THEN x := x - 1 END;
+IF x > 5192 THEN x := x - 1 END;
+IF x > 5193 THEN x := x - 1 END;
+IF x > 5194 THEN x := x - 1 END;
+IF x > 5195 THEN x := x - 1 END;
+IF x > 5196 THEN x := x - 1 END;
+IF x > 5197 THEN x := x - 1 END;
+IF x > 5198 THEN x := x - 1 END;
+IF x > 5199 THEN x := x - 1 END;
+IF x > 5200 THEN x := x - 1 END;
+IF x > 5201 THEN x := x - 1 END;
+IF x > 5202 THEN x := x - 1 END;
+IF x > 5203 THEN x := x - 1 END;
+IF x > 5204 THEN x := x - 1 END;
+IF x > 5205 THEN x := x - 1 END;
+IF x > 5206 THEN x := x - 1 END;
+IF x > 5207 THEN x := x - 1 END;
+IF x > 5208 THEN x := x - 1 END;
+IF x > 5209 THEN x := x - 1 END;
+IF x > 5210 THEN x := x - 1 END;
+IF x > 5211 THEN x := x - 1 END;
+IF x > 5212 THEN x := x - 1 END;
+IF x > 5213 THEN x := x - 1 END;
+IF x > 5214 THEN x := x - 1 END;
+IF x > 5215 THEN x := x - 1 END;
+IF x > 5216 THEN x := x - 1 END;
+IF x > 5217 THEN x := x - 1 END;
+IF x > 5218 THEN x := x - 1 END;
+IF x > 5219 THEN x := x - 1 END;
+IF x > 5220 THEN x := x - 1 END;
+IF x > 5221 THEN x := x - 1 END;
+IF x > 5222 THEN x := x - 1 END;
+IF x > 5223 THEN x := x - 1 END;
+IF x > 5224 THEN x := x - 1 END;
+IF x > 5225 THEN x := x - 1 END;
+IF x > 5226 THEN x := x - 1 END;
+IF x > 5227 THEN x := x - 1 END;
+IF x > 5228 THEN x := x - 1 END;
+IF x > 5229 THEN x := x - 1 END;
+IF x > 5230 THEN x := x - 1 END;
+IF x > 5231 THEN x := x - 1 END;
+IF x > 5232 THEN x := x - 1 END;
+IF x > 5233 THEN x := x - 1 END;
+IF x > 5234 THEN x := x - 1 END;
+IF x > 5235 THEN x := x - 1 END;
+IF x > 5236 THEN x := x - 1 END;
+IF x > 5237 THEN x := x - 1 END;
+IF x > 5238 THEN x := x - 1 END;
+IF x > 5239 THEN x := x - 1 END;
+IF x > 5240 THEN x := x - 1 END;
+IF x > 5241 THEN x := x - 1 END;
+IF x > 5242 THEN x := x - 1 END;
+IF x > 5243 THEN x := x - 1 END;
+IF x > 5244 THEN x := x - 1 END;
+IF x > 5245 THEN x := x - 1 END;
+IF x > 5246 THEN x := x - 1 END;
+IF x > 5247 THEN x := x - 1 END;
+IF x > 5248 THEN x := x - 1 END;
+IF x > 5249 THEN x := x - 1 END;
+IF x > 5250 THEN x := x - 1 END;
+IF x > 5251 THEN x := x - 1 END;
+IF x > 5252 THEN x := x - 1 END;
+IF x > 5253 THEN x := x - 1 END;
+IF x > 5254 THEN x := x - 1 END;
+IF x > 5255 THEN x := x - 1 END;
+IF x > 5256 THEN x := x - 1 END;
+IF x > 5257 THEN x := x - 1 END;
+IF x > 5258 THEN x := x - 1 END;
+IF x > 5259 THEN x := x - 1 END;
+IF x > 5260 THEN x := x - 1 END;
+IF x > 5261 THEN x := x - 1 END;
+IF x > 5262 THEN x := x - 1 END;
+IF x > 5263 THEN x := x - 1 END;
+IF x > 5264 THEN x := x - 1 END;
+IF x > 5265 THEN x := x - 1 END;
+IF x > 5266 THEN x := x - 1 END;
+IF x > 5267 THEN x := x - 1 END;
+IF x > 5268 THEN x := x - 1 END;
+IF x > 5269 THEN x := x - 1 END;
+IF x > 5270 THEN x := x - 1 END;
+IF x > 5271 THEN x := x - 1 END;
+IF x > 5272 THEN x := x - 1 END;
+IF x > 5273 THEN x := x - 1 END;
+IF x > 5274 THEN x := x - 1 END;
+IF x > 5275 THEN x := x - 1 END;
+IF x > 5276 THEN x := x - 1 END;
+IF x > 5277 THEN x := x - 1 END;
+IF x > 5278 THEN x := x - 1 END;
+IF x > 5279 THEN x := x - 1 END;
+IF x > 5280 THEN x := x - 1 END;
+IF x > 5281 THEN x := x - 1 END;
+IF x > 5282 THEN x := x - 1 END;
+IF x > 5283 THEN x := x - 1 END;
+IF x > 5284 THEN x := x - 1 END;
+IF x > 5285 THEN x := x - 1 END;
+IF x > 5286 THEN x := x - 1 END;
+IF x > 5287 THEN x := x - 1 END;
+IF x > 5288 THEN x := x - 1 END;
+IF x > 5289 THEN x := x - 1 END;
+IF x > 5290 THEN x := x - 1 END;
+IF x > 5291 THEN x := x - 1 END;
+IF x > 5292 THEN x := x - 1 END;
+IF x > 5293 THEN x := x - 1 END;
+IF x > 5294 THEN x := x - 1 END;
+IF x > 5295 THEN x := x - 1 END;
+IF x > 5296 THEN x := x - 1 END;
+IF x > 5297 THEN x := x - 1 END;
+IF x > 5298 THEN x := x - 1 END;
+IF x > 5299 THEN x := x - 1 END;
+IF x > 5300 THEN x := x - 1 END;
+IF x > 5301 THEN x := x - 1 END;
+IF x > 5302 THEN x := x - 1 END;
+IF x > 5303 THEN x := x - 1 END;
+IF x > 5304 THEN x := x - 1 END;
+IF x > 5305 THEN x := x - 1 END;
+IF x > 5306 THEN x := x - 1 END;
+IF x > 5307 THEN x := x - 1 END;
+IF x > 5308 THEN x := x - 1 END;
+IF x > 5309 THEN x := x - 1 END;
+IF x > 5310 THEN x := x - 1 END;
+IF x > 5311 THEN x := x - 1 END;
+IF x > 5312 THEN x := x - 1 END;
+IF x > 5313 THEN x := x - 1 END;
+IF x > 5314 THEN x := x - 1 END;
+IF x > 5315 THEN x := x - 1 END;
+IF x > 5316 THEN x := x - 1 END;
+IF x > 5317 THEN x := x - 1 END;
+IF x > 5318 THEN x := x - 1 END;
+IF x > 5319 THEN x := x - 1 END;
+IF x > 5320 THEN x := x - 1 END;
+IF x > 5321 THEN x := x - 1 END;
+IF x > 5322 THEN x := x - 1 END;
+IF x > 5323 THEN x := x - 1 END;
+IF x > 5324 THEN x := x - 1 END;
+IF x > 5325 THEN x := x - 1 END;
+IF x > 5326 THEN x := x - 1 END;
+IF x > 5327 THEN x := x - 1 END;
+IF x > 5328 THEN x := x - 1 END;
+IF x > 5329 THEN x := x - 1 END;
+IF x > 5330 THEN x := x - 1 END;
+IF x > 5331 THEN x := x - 1 END;
+IF x > 5332 THEN x := x - 1 END;
+IF x > 5333 THEN x := x - 1 END;
+IF x > 5334 THEN x := x - 1 END;
+IF x > 5335 THEN x := x - 1 END;
+IF x > 5336 THEN x := x - 1 END;
+IF x > 5337 THEN x := x - 1 END;
+IF x > 5338 THEN x := x - 1 END;
+IF x > 5339 THEN x := x - 1 END;
+IF x > 5340 THEN x := x - 1 END;
+IF x > 5341 THEN x := x - 1 END;
+IF x > 5342 THEN x := x - 1 END;
+IF x > 5343 THEN x := x - 1 END;
+IF x > 5344 THEN x := x - 1 END;
+IF x > 5345 THEN x := x - 1 END;
+IF x > 5346 THEN x := x - 1 END;
+IF x > 5347 THEN x := x - 1 END;
+IF x > 5348 THEN x := x - 1 END;
+IF x > 5349 THEN x := x - 1 END;
+IF x > 5350 THEN x := x - 1 END;
+IF x > 5351 THEN x := x - 1 END;
+IF x > 5352 THEN x := x - 1 END;
+IF x > 5353 THEN x := x - 1 END;
+IF x > 5354 THEN x := x - 1 END;
+IF x > 5355 THEN x := x - 1 END;
+IF x > 5356 THEN x := x - 1 END;
+IF x > 5357 THEN x := x - 1 END;
+IF x > 5358 THEN x := x - 1 END;
+IF x > 5359 THEN x := x - 1 END;
+IF x > 5360 THEN x := x - 1 END;
+IF x > 5361 THEN x := x - 1 END;
+IF x > 5362 THEN x := x - 1 END;
+IF x > 5363 THEN x := x - 1 END;
+IF x > 5364 THEN x := x - 1 END;
+IF x > 5365 THEN x := x - 1 END;
+IF x > 5366 THEN x := x - 1 END;
+IF x > 5367 THEN x := x - 1 END;
+IF x > 5368 THEN x := x - 1 END;
+IF x > 5369 THEN x := x - 1 END;
+IF x > 5370 THEN x := x - 1 END;
+IF x > 5371 THEN x := x - 1 END;
+IF x > 5372 THEN x := x - 1 END;
+IF x > 5373 THEN x := x - 1 END;
+IF x > 5374 THEN x := x - 1 END;
+IF x > 5375 THEN x := x - 1 END;
+IF x > 5376 THEN x := x - 1 END;
+IF x > 5377 THEN x := x - 1 END;
+IF x > 5378 THEN x := x - 1 END;
+IF x > 5379 THEN x := x - 1 END;
+IF x > 5380 THEN x := x - 1 END;
+IF x > 5381 THEN x := x - 1 END;
+IF x > 5382 THEN x := x - 1 END;
+IF x > 5383 THEN x := x - 1 END;
+IF x > 5384 THEN x := x - 1 END;
+IF x > 5385 THEN x := x - 1 END;
+IF x > 5386 THEN x := x - 1 END;
+IF x > 5387 THEN x := x - 1 END;
+IF x > 5388 THEN x := x - 1 END;
+IF x > 5389 THEN x := x - 1 END;
+IF x > 5390 THEN x := x - 1 END;
+IF x > 5391 THEN x := x - 1 END;
+IF x > 5392 THEN x := x - 1 END;
+IF x > 5393 THEN x := x - 1 END;
+IF x > 5394 THEN x := x - 1 END;
+IF x > 5395 THEN x := x - 1 END;
+IF x > 5396 THEN x := x - 1 END;
+IF x > 5397 THEN x := x - 1 END;
+IF x > 5398 THEN x := x - 1 END;
+IF x > 5399 THEN x := x - 1 END;
+IF x > 5400 THEN x := x - 1 END;
+IF x > 5401 THEN x := x - 1 END;
+IF x > 5402 THEN x := x - 1 END;
+IF x > 5403 THEN x := x - 1 END;
+IF x > 5404 THEN x := x - 1 END;
+IF x > 5405 THEN x := x - 1 END;
+IF x > 5406 THEN x := x - 1 END;
+IF x > 5407 THEN x := x - 1 END;
+IF x > 5408 THEN x := x - 1 END;
+IF x > 5409 THEN x := x - 1 END;
+IF x > 5410 THEN x := x - 1 END;
+IF x > 5411 THEN x := x - 1 END;
+IF x > 5412 THEN x := x - 1 END;
+IF x > 5413 THEN x := x - 1 END;
+IF x > 5414 THEN x := x - 1 END;
+IF x > 5415 THEN x := x - 1 END;
+IF x > 5416 THEN x := x - 1 END;
+IF x > 5417 THEN x := x - 1 END;
+IF x > 5418 THEN x := x - 1 END;
+IF x > 5419 THEN x := x - 1 END;
+IF x > 5420 THEN x := x - 1 END;
+IF x > 5421 THEN x := x - 1 END;
+IF x > 5422 THEN x := x - 1 END;
+IF x > 5423 THEN x := x - 1 END;
+IF x > 5424 THEN x := x - 1 END;
+IF x > 5425 THEN x := x - 1 END;
+IF x > 5426 THEN x := x - 1 END;
+IF x > 5427 THEN x := x - 1 END;
+IF x > 5428 THEN x := x - 1 END;
+IF x > 5429 THEN x := x - 1 END;
+IF x > 5430 THEN x := x - 1 END;
+IF x > 5431 THEN x := x - 1 END;
+IF x > 5432 THEN x := x - 1 END;
+IF x > 5433 THEN x := x - 1 END;
+IF x > 5434 THEN x := x - 1 END;
+IF x > 5435 THEN x := x - 1 END;
+IF x > 5436 THEN x := x - 1 END;
+IF x > 5437 THEN x := x - 1 END;
+IF x > 5438 THEN x := x - 1 END;
+IF x > 5439 THEN x := x - 1 END;
+IF x > 5440 THEN x := x - 1 END;
+IF x > 5441 THEN x := x - 1 END;
+IF x > 5442 THEN x := x - 1 END;
+IF x > 5443 THEN x := x - 1 END;
+IF x > 5444 THEN x := x - 1 END;
+IF x > 5445 THEN x := x - 1 END;
+IF x > 5446 THEN x := x - 1 END;
+IF x > 5447 THEN x := x - 1 END;
+IF x > 5448 THEN x := x - 1 END;
+IF x > 5449 THEN x := x - 1 END;
+IF x > 5450 THEN x := x - 1 END;
+IF x > 5451 THEN x := x - 1 END;
+IF x > 5452 THEN x := x - 1 END;
+IF x > 5453 THEN x := x - 1 END;
+IF x > 5454 THEN x := x - 1 END;
+IF x > 5455 THEN x := x - 1 END;
+IF x > 5456 THEN x := x - 1 END;
+IF x > 5457 THEN x := x - 1 END;
+IF x > 5458 THEN x := x - 1 END;
+IF x > 5459 THEN x := x - 1 END;
+IF x > 5460 THEN x := x - 1 END;
+IF x > 5461 THEN x := x - 1 END;
+IF x > 5462 THEN x := x - 1 END;
+IF x > 5463 THEN x := x - 1 END;
+IF x > 5464 THEN x := x - 1 END;
+IF x > 5465 THEN x := x - 1 END;
+IF x > 5466 THEN x := x - 1 END;
+IF x > 5467 THEN x := x - 1 END;
+IF x > 5468 THEN x := x - 1 END;
+IF x > 5469 THEN x := x - 1 END;
+IF x > 5470 THEN x := x - 1 END;
+IF x > 5471 THEN x := x - 1 END;
+IF x > 5472 THEN x := x - 1 END;
+IF x > 5473 THEN x := x - 1 END;
+IF x > 5474 THEN x := x - 1 END;
+IF x > 5475 THEN x := x - 1 END;
+IF x > 5476 THEN x := x - 1 END;
+IF x > 5477 THEN x := x - 1 END;
+IF x > 5478 THEN x := x - 1 END;
+IF x > 5479 THEN x := x - 1 END;
+IF x > 5480 THEN x := x - 1 END;
+IF x > 5481 THEN x := x - 1 END;
+IF x > 5482 THEN x := x - 1 END;
+IF x > 5483 THEN x := x - 1 END;
+IF x > 5484 THEN x := x - 1 END;
+IF x > 5485 THEN x := x - 1 END;
+IF x > 5486 THEN x := x - 1 END;
+IF x > 5487 THEN x := x - 1 END;
+IF x > 5488 THEN x := x - 1 END;
+IF x > 5489 THEN x := x - 1 END;
+IF x > 5490 THEN x := x - 1 END;
+IF x > 5491 THEN x := x - 1 END;
+IF x > 5492 THEN x := x - 1 END;
+IF x > 5493 THEN x := x - 1 END;
+IF x > 5494 THEN x := x - 1 END;
+IF x > 5495 THEN x := x - 1 END;
+IF x > 5496 THEN x := x - 1 END;
+IF x > 5497 THEN x := x - 1 END;
+IF x > 5498 THEN x := x - 1 END;
+IF x > 5499 THEN x := x - 1 END;
+IF x > 5500 THEN x := x - 1 END;
+IF x > 5501 THEN x := x - 1 END;
+IF x > 5502 THEN x := x - 1 END;
+IF x > 5503 THEN x := x - 1 END;
+IF x > 5504 THEN x := x - 1 END;
+IF x > 5505 THEN x := x - 1 END;
+IF x > 5506 THEN x := x - 1 END;
+IF x > 5507 THEN x := x - 1 END;
+IF x > 5508 THEN x := x - 1 END;
+IF x > 5509 THEN x := x - 1 END;
+IF x > 5510 THEN x := x - 1 END;
+IF x > 5511 THEN x := x - 1 END;
+IF x > 5512 THEN x := x - 1 END;
+IF x > 5513 THEN x := x - 1 END;
+IF x > 5514 THEN x := x - 1 END;
+IF x > 5515 THEN x := x - 1 END;
+IF x > 5516 THEN x := x - 1 END;
+IF x > 5517 THEN x := x - 1 END;
+IF x > 5518 THEN x := x - 1 END;
+IF x > 5519 THEN x := x - 1 END;
+IF x > 5520 THEN x := x - 1 END;
+IF x > 5521 THEN x := x - 1 END;
+IF x > 5522 THEN x := x - 1 END;
+IF x > 5523 THEN x := x - 1 END;
+IF x > 5524 THEN x := x - 1 END;
+IF x > 5525 THEN x := x - 1 END;
+IF x > 5526 THEN x := x - 1 END;
+IF x > 5527 THEN x := x - 1 END;
+IF x > 5528 THEN x := x - 1 END;
+IF x > 5529 THEN x := x - 1 END;
+IF x > 5530 THEN x := x - 1 END;
+IF x > 5531 THEN x := x - 1 END;
+IF x > 5532 THEN x := x - 1 END;
+IF x > 5533 THEN x := x - 1 END;
+IF x > 5534 THEN x := x - 1 END;
+IF x > 5535 THEN x := x - 1 END;
+IF x > 5536 THEN x := x - 1 END;
+IF x > 5537 THEN x := x - 1 END;
+IF x > 5538 THEN x := x - 1 END;
+IF x > 5539 THEN x := x - 1 END;
+IF x > 5540 THEN x := x - 1 END;
+IF x > 5541 THEN x := x - 1 END;
+IF x > 5542 THEN x := x - 1 END;
+IF x > 5543 THEN x := x - 1 END;
+IF x > 5544 THEN x := x - 1 END;
+IF x > 5545 THEN x := x - 1 END;
+IF x > 5546 THEN x := x - 1 END;
+IF x > 5547 THEN x := x - 1 END;
+IF x > 5548 THEN x := x - 1 END;
+IF x > 5549 THEN x := x - 1 END;
+IF x > 5550 THEN x := x - 1 END;
+IF x > 5551 THEN x := x - 1 END;
+IF x > 5552 THEN x := x - 1 END;
+IF x > 5553 THEN x := x - 1 END;
+IF x > 5554 THEN x := x - 1 END;
+IF x > 5555 THEN x := x - 1 END;
+IF x > 5556 THEN x := x - 1 END;
+IF x > 5557 THEN x := x - 1 END;
+IF x > 5558 THEN x := x - 1 END;
+IF x > 5559 THEN x := x - 1 END;
+IF x > 5560 THEN x := x - 1 END;
+IF x > 5561 THEN x := x - 1 END;
+IF x > 5562 THEN x := x - 1 END;
+IF x > 5563 THEN x := x - 1 END;
+IF x > 5564 THEN x := x - 1 END;
+IF x > 5565 THEN x := x - 1 END;
+IF x > 5566 THEN x := x - 1 END;
+IF x > 5567 THEN x := x - 1 END;
+IF x > 5568 THEN x := x - 1 END;
+IF x > 5569 THEN x := x - 1 END;
+IF x > 5570 THEN x := x - 1 END;
+IF x > 5571 THEN x := x - 1 END;
+IF x > 5572 THEN x := x - 1 END;
+IF x > 5573 THEN x := x - 1 END;
+IF x > 5574 THEN x := x - 1 END;
+IF x > 5575 THEN x := x - 1 END;
+IF x > 5576 THEN x := x - 1 END;
+IF x > 5577 THEN x := x - 1 END;
+IF x > 5578 THEN x := x - 1 END;
+IF x > 5579 THEN x := x - 1 END;
+IF x > 5580 THEN x := x - 1 END;
+IF x > 5581 THEN x := x - 1 END;
+IF x > 5582 THEN x := x - 1 END;
+IF x > 5583 THEN x := x - 1 END;
+IF x > 5584 THEN x := x - 1 END;
+IF x > 5585 THEN x := x - 1 END;
+IF x > 5586 THEN x := x - 1 END;
+IF x > 5587 THEN x := x - 1 END;
+IF x > 5588 THEN x := x - 1 END;
+IF x > 5589 THEN x := x - 1 END;
+IF x > 5590 THEN x := x - 1 END;
+IF x > 5591 THEN x := x - 1 END;
+IF x > 5592 THEN x := x - 1 END;
+IF x > 5593 THEN x := x - 1 END;
+IF x > 5594 THEN x := x - 1 END;
+IF x > 5595 THEN x := x - 1 END;
+IF x > 5596 THEN x := x - 1 END;
+IF x > 5597 THEN x := x - 1 END;
+IF x > 5598 THEN x := x - 1 END;
+IF x > 5599 THEN x := x - 1 END;
+IF x > 5600 THEN x := x - 1 END;
+IF x > 5601 THEN x := x - 1 END;
+IF x > 5602 THEN x := x - 1 END;
+IF x > 5603 THEN x := x - 1 END;
+IF x > 5604 THEN x := x - 1 END;
+IF x > 5605 THEN x := x - 1 END;
+IF x > 5606 THEN x := x - 1 END;
+IF x > 5607 THEN x := x - 1 END;
+IF x > 5608 THEN x := x - 1 END;
+IF x > 5609 THEN x := x - 1 END;
+IF x > 5610 THEN x := x - 1 END;
+IF x > 5611 THEN x := x - 1 END;
+IF x > 5612 THEN x := x - 1 END;
+IF x > 5613 THEN x := x - 1 END;
+IF x > 5614 THEN x := x - 1 END;
+IF x > 5615 THEN x := x - 1 END;
+IF x > 5616 THEN x := x - 1 END;
+IF x > 5617 THEN x := x - 1 END;
+IF x > 5618 THEN x := x - 1 END;
+IF x > 5619 THEN x := x - 1 END;
+IF x > 5620 THEN x := x - 1 END;
+IF x > 5621 THEN x := x - 1 END;
+IF x > 5622 THEN x := x - 1 END;
+IF x > 5623 THEN x := x - 1 END;
+IF x > 5624 THEN x := x - 1 END;
+IF x > 5625 THEN x := x - 1 END;
+IF x > 5626 THEN x := x - 1 END;
+IF x > 5627 THEN x := x - 1 END;
+IF x > 5628 THEN x := x - 1 END;
+IF x > 5629 THEN x := x - 1 END;
+IF x > 5630 THEN x := x - 1 END;
+IF x > 5631 THEN x := x - 1 END;
+IF x > 5632 THEN x := x - 1 END;
+IF x > 5633 THEN x := x - 1 END;
+IF x > 5634 THEN x := x - 1 END;
+IF x > 5635 THEN x := x - 1 END;
+IF x > 5636 THEN x := x - 1 END;
+IF x > 5637 THEN x := x - 1 END;
+IF x > 5638 THEN x := x - 1 END;
+IF x > 5639 THEN x := x - 1 END;
+IF x > 5640 THEN x := x - 1 END;
+IF x > 5641 THEN x := x - 1 END;
+IF x > 5642 THEN x := x - 1 END;
+IF x > 5643 THEN x := x - 1 END;
+IF x > 5644 THEN x := x - 1 END;
+IF x > 5645 THEN x := x - 1 END;
+IF x > 5646 THEN x := x - 1 END;
+IF x > 5647 THEN x := x - 1 END;
+IF x > 5648 THEN x := x - 1 END;
+IF x > 5649 THEN x := x - 1 END;
+IF x > 5650 THEN x := x - 1 END;
+IF x > 5651 THEN x := x - 1 END;
+IF x > 5652 THEN x := x - 1 END;
+IF x > 5653 THEN x := x - 1 END;
+IF x > 5654 THEN x := x - 1 END;
+IF x > 5655 THEN x := x - 1 END;
+IF x > 5656 THEN x := x - 1 END;
+IF x > 5657 THEN x := x - 1 END;
+IF x > 5658 THEN x := x - 1 END;
+IF x > 5659 THEN x := x - 1 END;
+IF x > 5660 THEN x := x - 1 END;
+IF x > 5661 THEN x := x - 1 END;
+IF x > 5662 THEN x := x - 1 END;
+IF x > 5663 THEN x := x - 1 END;
+IF x > 5664 THEN x := x - 1 END;
+IF x > 5665 THEN x := x - 1 END;
+IF x > 5666 THEN x := x - 1 END;
+IF x > 5667 THEN x := x - 1 END;
+IF x > 5668 THEN x := x - 1 END;
+IF x > 5669 THEN x := x - 1 END;
+IF x > 5670 THEN x := x - 1 END;
+IF x > 5671 THEN x := x - 1 END;
+IF x > 5672 THEN x := x - 1 END;
+IF x > 5673 THEN x := x - 1 END;
+IF x > 5674 THEN x := x - 1 END;
+IF x > 5675 THEN x := x - 1 END;
+IF x > 5676 THEN x := x - 1 END;
+IF x > 5677 THEN x := x - 1 END;
+IF x > 5678 THEN x := x - 1 END;
+IF x > 5679 THEN x := x - 1 END;
+IF x > 5680 THEN x := x - 1 END;
+IF x > 5681 THEN x := x - 1 END;
+IF x > 5682 THEN x := x - 1 END;
+IF x > 5683 THEN x := x - 1 END;
+IF x > 5684 THEN x := x - 1 END;
+IF x > 5685 THEN x := x - 1 END;
+IF x > 5686 THEN x := x - 1 END;
+IF x > 5687 THEN x := x - 1 END;
+IF x > 5688 THEN x := x - 1 END;
+IF x > 5689 THEN x := x - 1 END;
+IF x > 5690 THEN x := x - 1 END;
+IF x > 5691 THEN x := x - 1 END;
+IF x > 5692 THEN x := x - 1 END;
+IF x > 5693 THEN x := x - 1 END;
+IF x > 5694 THEN x := x - 1 END;
+IF x > 5695 THEN x := x - 1 END;
+IF x > 5696 THEN x := x - 1 END;
+IF x > 5697 THEN x := x - 1 END;
+IF x > 5698 THEN x := x - 1 END;
+IF x > 5699 THEN x := x - 1 END;
+IF x > 5700 THEN x := x - 1 END;
+IF x > 5701 THEN x := x - 1 END;
+IF x > 5702 THEN x := x - 1 END;
+IF x > 5703 THEN x := x - 1 END;
+IF x > 5704 THEN x := x - 1 END;
+IF x > 5705 THEN x := x - 1 END;
+IF x > 5706 THEN x := x - 1 END;
+IF x > 5707 THEN x := x - 1 END;
+IF x > 5708 THEN x := x - 1 END;
+IF x > 5709 THEN x := x - 1 END;
+IF x > 5710 THEN x := x - 1 END;
+IF x > 5711 THEN x := x - 1 END;
+IF x > 5712 THEN x := x - 1 END;
+IF x > 5713 THEN x := x - 1 END;
+IF x > 5714 THEN x := x - 1 END;
+IF x > 5715 THEN x := x - 1 END;
+IF x > 5716 THEN x := x - 1 END;
+IF x > 5717 THEN x := x - 1 END;
+IF x > 5718 THEN x := x - 1 END;
+IF x > 5719 THEN x := x - 1 END;
+IF x > 5720 THEN x := x - 1 END;
+IF x > 5721 THEN x := x - 1 END;
+IF x > 5722 THEN x := x - 1 END;
+IF x > 5723 THEN x := x - 1 END;
+IF x > 5724 THEN x := x - 1 END;
+IF x > 5725 THEN x := x - 1 END;
+IF x > 5726 THEN x := x - 1 END;
+IF x > 5727 THEN x := x - 1 END;
+IF x > 5728 THEN x := x - 1 END;
+IF x > 5729 THEN x := x - 1 END;
+IF x > 5730 THEN x := x - 1 END;
+IF x > 5731 THEN x := x - 1 END;
+IF x > 5732 THEN x := x - 1 END;
+IF x > 5733 THEN x := x - 1 END;
+IF x > 5734 THEN x := x - 1 END;
+IF x > 5735 THEN x := x - 1 END;
+IF x > 5736 THEN x := x - 1 END;
+IF x > 5737 THEN x := x - 1 END;
+IF x > 5738 THEN x := x - 1 END;
+IF x > 5739 THEN x := x - 1 END;
+IF x > 5740 THEN x := x - 1 END;
+IF x > 5741 THEN x := x - 1 END;
+IF x > 5742 THEN x := x - 1 END;
+IF x > 5743 THEN x := x - 1 END;
+IF x > 5744 THEN x := x - 1 END;
+IF x > 5745 THEN x := x - 1 END;
+IF x > 5746 THEN x := x - 1 END;
+IF x > 5747 THEN x := x - 1 END;
+IF x > 5748 THEN x := x - 1 END;
+IF x > 5749 THEN x := x - 1 END;
+IF x > 5750 THEN x := x - 1 END;
+IF x > 5751 THEN x := x - 1 END;
+IF x > 5752 THEN x := x - 1 END;
+IF x > 5753 THEN x := x - 1 END;
+IF x > 5754 THEN x := x - 1 END;
+IF x > 5755 THEN x := x - 1 END;
+IF x > 5756 THEN x := x - 1 END;
+IF x > 5757 THEN x := x - 1 END;
+IF x > 5758 THEN x := x - 1 END;
+IF x > 5759 THEN x := x - 1 END;
+IF x > 5760 THEN x := x - 1 END;
+IF x > 5761 THEN x := x - 1 END;
+IF x > 5762 THEN x := x - 1 END;
+IF x > 5763 THEN x := x - 1 END;
+IF x > 5764 THEN x := x - 1 END;
+IF x > 5765 THEN x := x - 1 END;
+IF x > 5766 THEN x := x - 1 END;
+IF x > 5767 THEN x := x - 1 END;
+IF x > 5768 THEN x := x - 1 END;
+IF x > 5769 THEN x := x - 1 END;
+IF x > 5770 THEN x := x - 1 END;
+IF x > 5771 THEN x := x - 1 END;
+IF x > 5772 THEN x := x - 1 END;
+IF x > 5773 THEN x := x - 1 END;
+IF x > 5774 THEN x := x - 1 END;
+IF x > 5775 THEN x := x - 1 END;
+IF x > 5776 THEN x := x - 1 END;
+IF x > 5777 THEN x := x - 1 END;
+IF x > 5778 THEN x := x - 1 END;
+IF x > 5779 THEN x := x - 1 END;
+IF x > 5780 THEN x := x - 1 END;
+IF x > 5781 THEN x := x - 1 END;
+IF x > 5782 THEN x := x - 1 END;
+IF x > 5783 THEN x := x - 1 END;
+IF x > 5784 THEN x := x - 1 END;
+IF x > 5785 THEN x := x - 1 END;
+IF x > 5786 THEN x := x - 1 END;
+IF x > 5787 THEN x := x - 1 END;
+IF x > 5788 THEN x := x - 1 END;
+IF x > 5789 THEN x := x - 1 END;
+IF x > 5790 THEN x := x - 1 END;
+IF x > 5791 THEN x := x - 1 END;
+IF x > 5792 THEN x := x - 1 END;
+IF x > 5793 THEN x := x - 1 END;
+IF x > 5794 THEN x := x - 1 END;
+IF x > 5795 THEN x := x - 1 END;
+IF x > 5796 THEN x := x - 1 END;
+IF x > 5797 THEN x := x - 1 END;
+IF x > 5798 THEN x := x - 1 END;
+IF x > 5799 THEN x := x - 1 END;
+IF x > 5800 THEN x := x - 1 END;
+IF x > 5801 THEN x := x - 1 END;
+IF x > 5802 THEN x := x - 1 END;
+IF x > 5803 THEN x := x - 1 END;
+IF x > 5804 THEN x := x - 1 END;
+IF x > 5805 THEN x := x - 1 END;
+IF x > 5806 THEN x := x - 1 END;
+IF x > 5807 THEN x := x - 1 END;
+IF x > 5808 THEN x := x - 1 END;
+IF x > 5809 THEN x := x - 1 END;
+IF x > 5810 THEN x := x - 1 END;
+IF x > 5811 THEN x := x - 1 END;
+IF x > 5812 THEN x := x - 1 END;
+IF x > 5813 THEN x := x - 1 END;
+IF x > 5814 THEN x := x - 1 END;
+IF x > 5815 THEN x := x - 1 END;
+IF x > 5816 THEN x := x - 1 END;
+IF x > 5817 THEN x := x - 1 END;
+IF x > 5818 THEN x := x - 1 END;
+IF x > 5819 THEN x := x - 1 END;
+IF x > 5820 THEN x := x - 1 END;
+IF x > 5821 THEN x := x - 1 END;
+IF x > 5822 THEN x := x - 1 END;
+IF x > 5823 THEN x := x - 1 END;
+IF x > 5824 THEN x := x - 1 END;
+IF x > 5825 THEN x := x - 1 END;
+IF x > 5826 THEN x := x - 1 END;
+IF x > 5827 THEN x := x - 1 END;
+IF x > 5828 THEN x := x - 1 END;
+IF x > 5829 THEN x := x - 1 END;
+IF x > 5830 THEN x := x - 1 END;
+IF x > 5831 THEN x := x - 1 END;
+IF x > 5832 THEN x := x - 1 END;
+IF x > 5833 THEN x := x - 1 END;
+IF x > 5834 THEN x := x - 1 END;
+IF x > 5835 THEN x := x - 1 END;
+IF x > 5836 THEN x := x - 1 END;
+IF x > 5837 THEN x := x - 1 END;
+IF x > 5838 THEN x := x - 1 END;
+IF x > 5839 THEN x := x - 1 END;
+IF x > 5840 THEN x := x - 1 END;
+IF x > 5841 THEN x := x - 1 END;
+IF x > 5842 THEN x := x - 1 END;
+IF x > 5843 THEN x := x - 1 END;
+IF x > 5844 THEN x := x - 1 END;
+IF x > 5845 THEN x := x - 1 END;
+IF x > 5846 THEN x := x - 1 END;
+IF x > 5847 THEN x := x - 1 END;
+IF x > 5848 THEN x := x - 1 END;
+IF x > 5849 THEN x := x - 1 END;
+IF x > 5850 THEN x := x - 1 END;
+IF x > 5851 THEN x := x - 1 END;
+IF x > 5852 THEN x := x - 1 END;
+IF x > 5853 THEN x := x - 1 END;
+IF x > 5854 THEN x := x - 1 END;
+IF x > 5855 THEN x := x - 1 END;
+IF x > 5856 THEN x := x - 1 END;
+IF x > 5857 THEN x := x - 1 END;
+IF x > 5858 THEN x := x - 1 END;
+IF x > 5859 THEN x := x - 1 END;
+IF x > 5860 THEN x := x - 1 END;
+IF x > 5861 THEN x := x - 1 END;
+IF x > 5862 THEN x := x - 1 END;
+IF x > 5863 THEN x := x - 1 END;
+IF x > 5864 THEN x := x - 1 END;
+IF x > 5865 THEN x := x - 1 END;
+IF x > 5866 THEN x := x - 1 END;
+IF x > 5867 THEN x := x - 1 END;
+IF x > 5868 THEN x := x - 1 END;
+IF x > 5869 THEN x := x - 1 END;
+IF x > 5870 THEN x := x - 1 END;
+IF x > 5871 THEN x := x - 1 END;
+IF x > 5872 THEN x := x - 1 END;
+IF x > 5873 THEN x := x - 1 END;
+IF x > 5874 THEN x := x - 1 END;
+IF x > 5875 THEN x := x - 1 END;
+IF x > 5876 THEN x := x - 1 END;
+IF x > 5877 THEN x := x - 1 END;
+IF x > 5878 THEN x := x - 1 END;
+IF x > 5879 THEN x := x - 1 END;
+IF x > 5880 THEN x := x - 1 END;
+IF x > 5881 THEN x := x - 1 END;
+IF x > 5882 THEN x := x - 1 END;
+IF x > 5883 THEN x := x - 1 END;
+IF x > 5884 THEN x := x - 1 END;
+IF x > 5885 THEN x := x - 1 END;
+IF x > 5886 THEN x := x - 1 END;
+IF x > 5887 THEN x := x - 1 END;
+IF x > 5888 THEN x := x - 1 END;
+IF x > 5889 THEN x := x - 1 END;
+IF x > 5890 THEN x := x - 1 END;
+IF x > 5891 THEN x := x - 1 END;
+IF x > 5892 THEN x := x - 1 END;
+IF x > 5893 THEN x := x - 1 END;
+IF x > 5894 THEN x := x - 1 END;
+IF x > 5895 THEN x := x - 1 END;
+IF x > 5896 THEN x := x - 1 END;
+IF x > 5897 THEN x := x - 1 END;
+IF x > 5898 THEN x := x - 1 END;
+IF x > 5899 THEN x := x - 1 END;
+IF x > 5900 THEN x := x - 1 END;
+IF x > 5901 THEN x := x - 1 END;
+IF x > 5902 THEN x := x - 1 END;
+IF x > 5903 THEN x := x - 1 END;
+IF x > 5904 THEN x := x - 1 END;
+IF x > 5905 THEN x := x - 1 END;
+IF x > 5906 THEN x := x - 1 END;
+IF x > 5907 THEN x := x - 1 END;
+IF x > 5908 THEN x := x - 1 END;
+IF x > 5909 THEN x := x - 1 END;
+IF x > 5910 THEN x := x - 1 END;
+IF x > 5911 THEN x := x - 1 END;
+IF x > 5912 THEN x := x - 1 END;
+IF x > 5913 THEN x := x - 1 END;
+IF x > 5914 THEN x := x - 1 END;
+IF x > 5915 THEN x := x - 1 END;
+IF x > 5916 THEN x := x - 1 END;
+IF x > 5917 THEN x := x - 1 END;
+IF x > 5918 THEN x := x - 1 END;
+IF x > 5919 THEN x := x - 1 END;
+IF x > 5920 THEN x := x - 1 END;
+IF x > 5921 THEN x := x - 1 END;
+IF x > 5922 THEN x := x - 1 END;
+IF x > 5923 THEN x := x - 1 END;
+IF x > 5924 THEN x := x - 1 END;
+IF x > 5925 THEN x := x - 1 END;
+IF x > 5926 THEN x := x - 1 END;
+IF x > 5927 THEN x := x - 1 END;
+IF x > 5928 THEN x := x - 1 END;
+IF x > 5929 THEN x := x - 1 END;
+IF x > 5930 THEN x := x - 1 END;
+IF x > 5931 THEN x := x - 1 END;
+IF x > 5932 THEN x := x - 1 END;
+IF x > 5933 THEN x := x - 1 END;
+IF x > 5934 THEN x := x - 1 END;
+IF x > 5935 THEN x := x - 1 END;
+IF x > 5936 THEN x := x - 1 END;
+IF x > 5937 THEN x := x - 1 END;
+IF x > 5938 THEN x := x - 1 END;
+IF x > 5939 THEN x := x - 1 END;
+IF x > 5940 THEN x := x - 1 END;
+IF x > 5941 THEN x := x - 1 END;
+IF x > 5942 THEN x := x - 1 END;
+IF x > 5943 THEN x := x - 1 END;
+IF x > 5944 THEN x := x - 1 END;
+IF x > 5945 THEN x := x - 1 END;
+IF x > 5946 THEN x := x - 1 END;
+IF x > 5947 THEN x := x - 1 END;
+IF x > 5948 THEN x := x - 1 END;
+IF x > 5949 THEN x := x - 1 END;
+IF x > 5950 THEN x := x - 1 END;
+IF x > 5951 THEN x := x - 1 END;
+IF x > 5952 THEN x := x - 1 END;
+IF x > 5953 THEN x := x - 1 END;
+IF x > 5954 THEN x := x - 1 END;
+IF x > 5955 THEN x := x - 1 END;
+IF x > 5956 THEN x := x - 1 END;
+IF x > 5957 THEN x := x - 1 END;
+IF x > 5958 THEN x := x - 1 END;
+IF x > 5959 THEN x := x - 1 END;
+IF x > 5960 THEN x := x - 1 END;
+IF x > 5961 THEN x := x - 1 END;
+IF x > 5962 THEN x := x - 1 END;
+IF x > 5963 THEN x := x - 1 END;
+IF x > 5964 THEN x := x - 1 END;
+IF x > 5965 THEN x := x - 1 END;
+IF x > 5966 THEN x := x - 1 END;
+IF x > 5967 THEN x := x - 1 END;
+IF x > 5968 THEN x := x - 1 END;
+IF x > 5969 THEN x := x - 1 END;
+IF x > 5970 THEN x := x - 1 END;
+IF x > 5971 THEN x := x - 1 END;
+IF x > 5972 THEN x := x - 1 END;
+IF x > 5973 THEN x := x - 1 END;
+IF x > 5974 THEN x := x - 1 END;
+IF x > 5975 THEN x := x - 1 END;
+IF x > 5976 THEN x := x - 1 END;
+IF x > 5977 THEN x := x - 1 END;
+IF x > 5978 THEN x := x - 1 END;
+IF x > 5979 THEN x := x - 1 END;
+IF x > 5980 THEN x := x - 1 END;
+IF x > 5981 THEN x := x - 1 END;
+IF x > 5982 THEN x := x - 1 END;
+IF x > 5983 THEN x := x - 1 END;
+IF x > 5984 THEN x := x - 1 END;
+IF x > 5985 THEN x := x - 1 END;
+IF x > 5986 THEN x := x - 1 END;
+IF x > 5987 THEN x := x - 1 END;
+IF x > 5988 THEN x := x - 1 END;
+IF x > 5989 THEN x := x - 1 END;
+IF x > 5990 THEN x := x - 1 END;
+IF x > 5991 THEN x := x - 1 END;
+IF x > 5992 THEN x := x - 1 END;
+IF x > 5993 THEN x := x - 1 END;
+IF x > 5994 THEN x := x - 1 END;
+IF x > 5995 THEN x := x - 1 END;
+IF x > 5996 THEN x := x - 1 END;
+IF x > 5997 THEN x := x - 1 END;
+IF x > 5998 THEN x := x - 1 END;
+IF x > 5999 THEN x := x - 1 END;
+IF x > 6000 THEN x := x - 1 END;
+IF x > 6001 THEN x := x - 1 END;
+IF x > 6002 THEN x := x - 1 END;
+IF x > 6003 THEN x := x - 1 END;
+IF x > 6004 THEN x := x - 1 END;
+IF x > 6005 THEN x := x - 1 END;
+IF x > 6006 THEN x := x - 1 END;
+IF x > 6007 THEN x := x - 1 END;
+IF x > 6008 THEN x := x - 1 END;
+IF x > 6009 THEN x := x - 1 END;
+IF x > 6010 THEN x := x - 1 END;
+IF x > 6011 THEN x := x - 1 END;
+IF x > 6012 THEN x := x - 1 END;
+IF x > 6013 THEN x := x - 1 END;
+IF x > 6014 THEN x := x - 1 END;
+IF x > 6015 THEN x := x - 1 END;
+IF x > 6016 THEN x := x - 1 END;
+IF x > 6017 THEN x := x - 1 END;
+IF x > 6018 THEN x := x - 1 END;
+IF x > 6019 THEN x := x - 1 END;
+IF x > 6020 THEN x := x - 1 END;
+IF x > 6021 THEN x := x - 1 END;
+IF x > 6022 THEN x := x - 1 END;
+IF x > 6023 THEN x := x - 1 END;
+IF x > 6024 THEN x := x - 1 END;
+IF x > 6025 THEN x := x - 1 END;
+IF x > 6026 THEN x := x - 1 END;
+IF x > 6027 THEN x := x - 1 END;
+IF x > 6028 THEN x := x - 1 END;
+IF x > 6029 THEN x := x - 1 END;
+IF x > 6030 THEN x := x - 1 END;
+IF x > 6031 THEN x := x - 1 END;
+IF x > 6032 THEN x := x - 1 END;
+IF x > 6033 THEN x := x - 1 END;
+IF x > 6034 THEN x := x - 1 END;
+IF x > 6035 THEN x := x - 1 END;
+IF x > 6036 THEN x := x - 1 END;
+IF x > 6037 THEN x := x - 1 END;
+IF x > 6038 THEN x := x - 1 END;
+IF x > 6039 THEN x := x - 1 END;
+IF x > 6040 THEN x := x - 1 END;
+IF x > 6041 THEN x := x - 1 END;
+IF x > 6042 THEN x := x - 1 END;
+IF x > 6043 THEN x := x - 1 END;
+IF x > 6044 THEN x := x - 1 END;
+IF x > 6045 THEN x := x - 1 END;
+IF x > 6046 THEN x := x - 1 END;
+IF x > 6047 THEN x := x - 1 END;
+IF x > 6048 THEN x := x - 1 END;
+IF x > 6049 THEN x := x - 1 END;
+IF x > 6050 THEN x := x - 1 END;
+IF x > 6051 THEN x := x - 1 END;
+IF x > 6052 THEN x := x - 1 END;
+IF x > 6053 THEN x := x - 1 END;
+IF x > 6054 THEN x := x - 1 END;
+IF x > 6055 THEN x := x - 1 END;
+IF x > 6056 THEN x := x - 1 END;
+IF x > 6057 THEN x := x - 1 END;
+IF x > 6058 THEN x := x - 1 END;
+IF x > 6059 THEN x := x - 1 END;
+IF x > 6060 THEN x := x - 1 END;
+IF x > 6061 THEN x := x - 1 END;
+IF x > 6062 THEN x := x - 1 END;
+IF x > 6063 THEN x := x - 1 END;
+IF x > 6064 THEN x := x - 1 END;
+IF x > 6065 THEN x := x - 1 END;
+IF x > 6066 THEN x := x - 1 END;
+IF x > 6067 THEN x := x - 1 END;
+IF x > 6068 THEN x := x - 1 END;
+IF x > 6069 THEN x := x - 1 END;
+IF x > 6070 THEN x := x - 1 END;
+IF x > 6071 THEN x := x - 1 END;
+IF x > 6072 THEN x := x - 1 END;
+IF x > 6073 THEN x := x - 1 END;
+IF x > 6074 THEN x := x - 1 END;
+IF x > 6075 THEN x := x - 1 END;
+IF x > 6076 THEN x := x - 1 END;
+IF x > 6077 THEN x := x - 1 END;
+IF x > 6078 THEN x := x - 1 END;
+IF x > 6079 THEN x := x - 1 END;
+IF x > 6080 THEN x := x - 1 END;
+IF x > 6081 THEN x := x - 1 END;
+IF x > 6082 THEN x := x - 1 END;
+IF x > 6083 THEN x := x - 1 END;
+IF x > 6084 THEN x := x - 1 END;
+IF x > 6085 THEN x := x - 1 END;
+IF x > 6086 THEN x := x - 1 END;
+IF x > 6087 THEN x := x - 1 END;
+IF x > 6088 THEN x := x - 1 END;
+IF x > 6089 THEN x := x - 1 END;
+IF x > 6090 THEN x := x - 1 END;
+IF x > 6091 THEN x := x - 1 END;
+IF x > 6092 THEN x := x - 1 END;
+IF x > 6093 THEN x := x - 1 END;
+IF x > 6094 THEN x := x - 1 END;
+IF x > 6095 THEN x := x - 1 END;
+IF x > 6096 THEN x := x - 1 END;
+IF x > 6097 THEN x := x - 1 END;
+IF x > 6098 THEN x := x - 1 END;
+IF x > 6099 THEN x := x - 1 END;
+IF x > 6100 THEN x := x - 1 END;
+IF x > 6101 THEN x := x - 1 END;
+IF x > 6102 THEN x := x - 1 END;
+IF x > 6103 THEN x := x - 1 END;
+IF x > 6104 THEN x := x - 1 END;
+IF x > 6105 THEN x := x - 1 END;
+IF x > 6106 THEN x := x - 1 END;
+IF x > 6107 THEN x := x - 1 END;
+IF x > 6108 THEN x := x - 1 END;
+IF x > 6109 THEN x := x - 1 END;
+IF x > 6110 THEN x := x - 1 END;
+IF x > 6111 THEN x := x - 1 END;
+IF x > 6112 THEN x := x - 1 END;
+IF x > 6113 THEN x := x - 1 END;
+IF x > 6114 THEN x := x - 1 END;
+IF x > 6115 THEN x := x - 1 END;
+IF x > 6116 THEN x := x - 1 END;
+IF x > 6117 THEN x := x - 1 END;
+IF x > 6118 THEN x := x - 1 END;
+IF x > 6119 THEN x := x - 1 END;
+IF x > 6120 THEN x := x - 1 END;
+IF x > 6121 THEN x := x - 1 END;
+IF x > 6122 THEN x := x - 1 END;
+IF x > 6123 THEN x := x - 1 END;
+IF x > 6124 THEN x := x - 1 END;
+IF x > 6125 THEN x := x - 1 END;
+IF x > 6126 THEN x := x - 1 END;
+IF x > 6127 THEN x := x - 1 END;
+IF x > 6128 THEN x := x - 1 END;
+IF x > 6129 THEN x := x - 1 END;
+IF x > 6130 THEN x := x - 1 END;
+IF x > 6131 THEN x := x - 1 END;
+IF x > 6132 THEN x := x - 1 END;
+IF x > 6133 THEN x := x - 1 END;
+IF x > 6134 THEN x := x - 1 END;
+IF x > 6135 THEN x := x - 1 END;
+IF x > 6136 THEN x := x - 1 END;
+IF x > 6137 THEN x := x - 1 END;
+IF x > 6138 THEN x := x - 1 END;
+IF x > 6139 THEN x := x - 1 END;
+IF x > 6140 THEN x := x - 1 END;
+IF x > 6141 THEN x := x - 1 END;
+IF x > 6142 THEN x := x - 1 END;
+IF x > 6143 THEN x := x - 1 END;
+IF x > 6144 THEN x := x - 1 END;
+IF x > 6145 THEN x := x - 1 END;
+IF x > 6146 THEN x := x - 1 END;
+IF x > 6147 THEN x := x - 1 END;
+IF x > 6148 THEN x := x - 1 END;
+IF x > 6149 THEN x := x - 1 END;
+IF x > 6150 THEN x := x - 1 END;
+IF x > 6151 THEN x := x - 1 END;
+IF x > 6152 THEN x := x - 1 END;
+IF x > 6153 THEN x := x - 1 END;
+IF x > 6154 THEN x := x - 1 END;
+IF x > 6155 THEN x := x - 1 END;
+IF x > 6156 THEN x := x - 1 END;
+IF x > 6157 THEN x := x - 1 END;
+IF x > 6158 THEN x := x - 1 END;
+IF x > 6159 THEN x := x - 1 END;
+IF x > 6160 THEN x := x - 1 END;
+IF x > 6161 THEN x := x - 1 END;
+IF x > 6162 THEN x := x - 1 END;
+IF x > 6163 THEN x := x - 1 END;
+IF x > 6164 THEN x := x - 1 END;
+IF x > 6165 THEN x := x - 1 END;
+IF x > 6166 THEN x := x - 1 END;
+IF x > 6167 THEN x := x - 1 END;
+IF x > 6168 THEN x := x - 1 END;
+IF x > 6169 THEN x := x - 1 END;
+IF x > 6170 THEN x := x - 1 END;
+IF x > 6171 THEN x := x - 1 END;
+IF x > 6172 THEN x := x - 1 END;
+IF x > 6173 THEN x := x - 1 END;
+IF x > 6174 THEN x := x - 1 END;
+IF x > 6175 THEN x := x - 1 END;
+IF x > 6176 THEN x := x - 1 END;
+IF x > 6177 THEN x := x - 1 END;
+IF x > 6178 THEN x := x - 1 END;
+IF x > 6179 THEN x := x - 1 END;
+IF x > 6180 THEN x := x - 1 END;
+IF x > 6181 THEN x := x - 1 END;
+IF x > 6182 THEN x := x - 1 END;
+IF x > 6183 THEN x := x - 1 END;
+IF x > 6184 THEN x := x - 1 END;
+IF x > 6185 THEN x := x - 1 END;
+IF x > 6186 THEN x := x - 1 END;
+IF x > 6187 THEN x := x - 1 END;
+IF x > 6188 THEN x := x - 1 END;
+IF x > 6189 THEN x := x - 1 END;
+IF x > 6190 THEN x := x - 1 END;
+IF x > 6191 THEN x := x - 1 END;
+IF x > 6192 THEN x := x - 1 END;
+IF x > 6193 THEN x := x - 1 END;
+IF x > 6194 THEN x := x - 1 END;
+IF x > 6195 THEN x := x - 1 END;
+IF x > 6196 THEN x := x - 1 END;
+IF x > 6197 THEN x := x - 1 END;
+IF x > 6198 THEN x := x - 1 END;
+IF x > 6199 THEN x := x - 1 END;
+IF x > 6200 THEN x := x - 1 END;
+IF x > 6201 THEN x := x - 1 END;
+IF x > 6202 THEN x := x - 1 END;
+IF x > 6203 THEN x := x - 1 END;
+IF x > 6204 THEN x := x - 1 END;
+IF x > 6205 THEN x := x - 1 END;
+IF x > 6206 THEN x := x - 1 END;
+IF x > 6207 THEN x := x - 1 END;
+IF x > 6208 THEN x := x - 1 END;
+IF x > 6209 THEN x := x - 1 END;
+IF x > 6210 THEN x := x - 1 END;
+IF x > 6211 THEN x := x - 1 END;
+IF x > 6212 THEN x := x - 1 END;
+IF x > 6213 THEN x := x - 1 END;
+IF x > 6214 THEN x := x - 1 END;
+IF x > 6215 THEN x := x - 1 END;
+IF x > 6216 THEN x := x - 1 END;
+IF x > 6217 THEN x := x - 1 END;
+IF x > 6218 THEN x := x - 1 END;
+IF x > 6219 THEN x := x - 1 END;
+IF x > 6220 THEN x := x - 1 END;
+IF x > 6221 THEN x := x - 1 END;
+IF x > 6222 THEN x := x - 1 END;
+IF x > 6223 THEN x := x - 1 END;
+IF x > 6224 THEN x := x - 1 END;
+IF x > 6225 THEN x := x - 1 END;
+IF x > 6226 THEN x := x - 1 END;
+IF x > 6227 THEN x := x - 1 END;
+IF x > 6228 THEN x := x - 1 END;
+IF x > 6229 THEN x := x - 1 END;
+IF x > 6230 THEN x := x - 1 END;
+IF x > 6231 THEN x := x - 1 END;
+IF x > 6232 THEN x := x - 1 END;
+IF x > 6233 THEN x := x - 1 END;
+IF x > 6234 THEN x := x - 1 END;
+IF x > 6235 THEN x := x - 1 END;
+IF x > 6236 THEN x := x - 1 END;
+IF x > 6237 THEN x := x - 1 END;
+IF x > 6238 THEN x := x - 1 END;
+IF x > 6239 THEN x := x - 1 END;
+IF x > 6240 THEN x := x - 1 END;
+IF x > 6241 THEN x := x - 1 END;
+IF x > 6242 THEN x := x - 1 END;
+IF x > 6243 THEN x := x - 1 END;
+IF x > 6244 THEN x := x - 1 END;
+IF x > 6245 THEN x := x - 1 END;
+IF x > 6246 THEN x := x - 1 END;
+IF x > 6247 THEN x := x - 1 END;
+IF x > 6248 THEN x := x - 1 END;
+IF x > 6249 THEN x := x - 1 END;
+IF x > 6250 THEN x := x - 1 END;
+IF x > 6251 THEN x := x - 1 END;
+IF x > 6252 THEN x := x - 1 END;
+IF x > 6253 THEN x := x - 1 END;
+IF x > 6254 THEN x := x - 1 END;
+IF x > 6255 THEN x := x - 1 END;
+IF x > 6256 THEN x := x - 1 END;
+IF x > 6257 THEN x := x - 1 END;
+IF x > 6258 THEN x := x - 1 END;
+IF x > 6259 THEN x := x - 1 END;
+IF x > 6260 THEN x := x - 1 END;
+IF x > 6261 THEN x := x - 1 END;
+IF x > 6262 THEN x := x - 1 END;
+IF x > 6263 THEN x := x - 1 END;
+IF x > 6264 THEN x := x - 1 END;
+IF x > 6265 THEN x := x - 1 END;
+IF x > 6266 THEN x := x - 1 END;
+IF x > 6267 THEN x := x - 1 END;
+IF x > 6268 THEN x := x - 1 END;
+IF x > 6269 THEN x := x - 1 END;
+IF x > 6270 THEN x := x - 1 END;
+IF x > 6271 THEN x := x - 1 END;
+IF x > 6272 THEN x := x - 1 END;
+IF x > 6273 THEN x := x - 1 END;
+IF x > 6274 THEN x := x - 1 END;
+IF x > 6275 THEN x := x - 1 END;
+IF x > 6276 THEN x := x - 1 END;
+IF x > 6277 THEN x := x - 1 END;
+IF x > 6278 THEN x := x - 1 END;
+IF x > 6279 THEN x := x - 1 END;
+IF x > 6280 THEN x := x - 1 END;
+IF x > 6281 THEN x := x - 1 END;
+IF x > 6282 THEN x := x - 1 END;
+IF x > 6283 THEN x := x - 1 END;
+IF x > 6284 THEN x := x - 1 END;
+IF x > 6285 THEN x := x - 1 END;
+IF x > 6286 THEN x := x - 1 END;
+IF x > 6287 THEN x := x - 1 END;
+IF x > 6288 THEN x := x - 1 END;
+IF x > 6289 THEN x := x - 1 END;
+IF x > 6290 THEN x := x - 1 END;
+IF x > 6291 THEN x := x - 1 END;
+IF x > 6292 THEN x := x - 1 END;
+IF x > 6293 THEN x := x - 1 END;
+IF x > 6294 THEN x := x - 1 END;
+IF x > 6295 THEN x := x - 1 END;
+IF x > 6296 THEN x := x - 1 END;
+IF x > 6297 THEN x := x - 1 END;
+IF x > 6298 THEN x := x - 1 END;
+IF x > 6299 THEN x := x - 1 END;
+IF x > 6300 THEN x := x - 1 END;
+IF x > 6301 THEN x := x - 1 END;
+IF x > 6302 THEN x := x - 1 END;
+IF x > 6303 THEN x := x - 1 END;
+IF x > 6304 THEN x := x - 1 END;
+IF x > 6305 THEN x := x - 1 END;
+IF x > 6306 THEN x := x - 1 END;
+IF x > 6307 THEN x := x - 1 END;
+IF x > 6308 THEN x := x - 1 END;
+IF x > 6309 THEN x := x - 1 END;
+IF x > 6310 THEN x := x - 1 END;
+IF x > 6311 THEN x := x - 1 END;
+IF x > 6312 THEN x := x - 1 END;
+IF x > 6313 THEN x := x - 1 END;
+IF x > 6314 THEN x := x - 1 END;
+IF x > 6315 THEN x := x - 1 END;
+IF x > 6316 THEN x := x - 1 END;
+IF x > 6317 THEN x := x - 1 END;
+IF x > 6318 THEN x := x - 1 END;
+IF x > 6319 THEN x := x - 1 END;
+IF x > 6320 THEN x := x - 1 END;
+IF x > 6321 THEN x := x - 1 END;
+IF x > 6322 THEN x := x - 1 END;
+IF x > 6323 THEN x := x - 1 END;
+IF x > 6324 THEN x := x - 1 END;
+IF x > 6325 THEN x := x - 1 END;
+IF x > 6326 THEN x := x - 1 END;
+IF x > 6327 THEN x := x - 1 END;
+IF x > 6328 THEN x := x - 1 END;
+IF x > 6329 THEN x := x - 1 END;
+IF x > 6330 THEN x := x - 1 END;
+IF x > 6331 THEN x := x - 1 END;
+IF x > 6332 THEN x := x - 1 END;
+IF x > 6333 THEN x := x - 1 END;
+IF x > 6334 THEN x := x - 1 END;
+IF x > 6335 THEN x := x - 1 END;
+IF x > 6336 THEN x := x - 1 END;
+IF x > 6337 THEN x := x - 1 END;
+IF x > 6338 THEN x := x - 1 END;
+IF x > 6339 THEN x := x - 1 END;
+IF x > 6340 THEN x := x - 1 END;
+IF x > 6341 THEN x := x - 1 END;
+IF x > 6342 THEN x := x - 1 END;
+IF x > 6343 THEN x := x - 1 END;
+IF x > 6344 THEN x := x - 1 END;
+IF x > 6345 THEN x := x - 1 END;
+IF x > 6346 THEN x := x - 1 END;
+IF x > 6347 THEN x := x - 1 END;
+IF x > 6348 THEN x := x - 1 END;
+IF x > 6349 THEN x := x - 1 END;
+IF x > 6350 THEN x := x - 1 END;
+IF x > 6351 THEN x := x - 1 END;
+IF x > 6352 THEN x := x - 1 END;
+IF x > 6353 THEN x := x - 1 END;
+IF x > 6354 THEN x := x - 1 END;
+IF x > 6355 THEN x := x - 1 END;
+IF x > 6356 THEN x := x - 1 END;
+IF x > 6357 THEN x := x - 1 END;
+IF x > 6358 THEN x := x - 1 END;
+IF x > 6359 THEN x := x - 1 END;
+IF x > 6360 THEN x := x - 1 END;
+IF x > 6361 THEN x := x - 1 END;
+IF x > 6362 THEN x := x - 1 END;
+IF x > 6363 THEN x := x - 1 END;
+IF x > 6364 THEN x := x - 1 END;
+IF x > 6365 THEN x := x - 1 END;
+IF x > 6366 THEN x := x - 1 END;
+IF x > 6367 THEN x := x - 1 END;
+IF x > 6368 THEN x := x - 1 END;
+IF x > 6369 THEN x := x - 1 END;
+IF x > 6370 THEN x := x - 1 END;
+IF x > 6371 THEN x := x - 1 END;
+IF x > 6372 THEN x := x - 1 END;
+IF x > 6373 THEN x := x - 1 END;
+IF x > 6374 THEN x := x - 1 END;
+IF x > 6375 THEN x := x - 1 END;
+IF x > 6376 THEN x := x - 1 END;
+IF x > 6377 THEN x := x - 1 END;
+IF x > 6378 THEN x := x - 1 END;
+IF x > 6379 THEN x := x - 1 END;
+IF x > 6380 THEN x := x - 1 END;
+IF x > 6381 THEN x := x - 1 END;
+IF x > 6382 THEN x := x - 1 END;
+IF x > 6383 THEN x := x - 1 END;
+IF x > 6384 THEN x := x - 1 END;
+IF x > 6385 THEN x := x - 1 END;
+IF x > 6386 THEN x := x - 1 END;
+IF x > 6387 THEN x := x - 1 END;
+IF x > 6388 THEN x := x - 1 END;
+IF x > 6389 THEN x := x - 1 END;
+IF x > 6390 THEN x := x - 1 END;
+IF x > 6391 THEN x := x - 1 END;
+IF x > 6392 THEN x := x - 1 END;
+IF x > 6393 THEN x := x - 1 END;
+IF x > 6394 THEN x := x - 1 END;
+IF x > 6395 THEN x := x - 1 END;
+IF x > 6396 THEN x := x - 1 END;
+IF x > 6397 THEN x := x - 1 END;
+IF x > 6398 THEN x := x - 1 END;
+IF x > 6399 THEN x := x - 1 END;
+IF x > 6400 THEN x := x - 1 END;
+IF x > 6401 THEN x := x - 1 END;
+IF x > 6402 THEN x := x - 1 END;
+IF x > 6403 THEN x := x - 1 END;
+IF x > 6404 THEN x := x - 1 END;
+IF x > 6405 THEN x := x - 1 END;
+IF x > 6406 THEN x := x - 1 END;
+IF x > 6407 THEN x := x - 1 END;
+IF x > 6408 THEN x := x - 1 END;
+IF x > 6409 THEN x := x - 1 END;
+IF x > 6410 THEN x := x - 1 END;
+IF x > 6411 THEN x := x - 1 END;
+IF x > 6412 THEN x := x - 1 END;
+IF x > 6413 THEN x := x - 1 END;
+IF x > 6414 THEN x := x - 1 END;
+IF x > 6415 THEN x := x - 1 END;
+IF x > 6416 THEN x := x - 1 END;
+IF x > 6417 THEN x := x - 1 END;
+IF x > 6418 THEN x := x - 1 END;
+IF x > 6419 THEN x := x - 1 END;
+IF x > 6420 THEN x := x - 1 END;
+IF x > 6421 THEN x := x - 1 END;
+IF x > 6422 THEN x := x - 1 END;
+IF x > 6423 THEN x := x - 1 END;
+IF x > 6424 THEN x := x - 1 END;
+IF x > 6425 THEN x := x - 1 END;
+IF x > 6426 THEN x := x - 1 END;
+IF x > 6427 THEN x := x - 1 END;
+IF x > 6428 THEN x := x - 1 END;
+IF x > 6429 THEN x := x - 1 END;
+IF x > 6430 THEN x := x - 1 END;
+IF x > 6431 THEN x := x - 1 END;
+IF x > 6432 THEN x := x - 1 END;
+IF x > 6433 THEN x := x - 1 END;
+IF x > 6434 THEN x := x - 1 END;
+IF x > 6435 THEN x := x - 1 END;
+IF x > 6436 THEN x := x - 1 END;
+IF x > 6437 THEN x := x - 1 END;
+IF x > 6438 THEN x := x - 1 END;
+IF x > 6439 THEN x := x - 1 END;
+IF x > 6440 THEN x := x - 1 END;
+IF x > 6441 THEN x := x - 1 END;
+IF x > 6442 THEN x := x - 1 END;
+IF x > 6443 THEN x := x - 1 END;
+IF x > 6444 THEN x := x - 1 END;
+IF x > 6445 THEN x := x - 1 END;
+IF x > 6446 THEN x := x - 1 END;
+IF x > 6447 THEN x := x - 1 END;
+IF x > 6448 THEN x := x - 1 END;
+IF x > 6449 THEN x := x - 1 END;
+IF x > 6450 THEN x := x - 1 END;
+IF x > 6451 THEN x := x - 1 END;
+IF x > 6452 THEN x := x - 1 END;
+IF x > 6453 THEN x := x - 1 END;
+IF x > 6454 THEN x := x - 1 END;
+IF x > 6455 THEN x := x - 1 END;
+IF x > 6456 THEN x := x - 1 END;
+IF x > 6457 THEN x := x - 1 END;
+IF x > 6458 THEN x := x - 1 END;
+IF x > 6459 THEN x := x - 1 END;
+IF x > 6460 THEN x := x - 1 END;
+IF x > 6461 THEN x := x - 1 END;
+IF x > 6462 THEN x := x - 1 END;
+IF x > 6463 THEN x := x - 1 END;
+IF x > 6464 THEN x := x - 1 END;
+IF x > 6465 THEN x := x - 1 END;
+IF x > 6466 THEN x := x - 1 END;
+IF x > 6467 THEN x := x - 1 END;
+IF x > 6468 THEN x := x - 1 END;
+IF x > 6469 THEN x := x - 1 END;
+IF x > 6470 THEN x := x - 1 END;
+IF x > 6471 THEN x := x - 1 END;
+IF x > 6472 THEN x := x - 1 END;
+IF x > 6473 THEN x := x - 1 END;
+IF x > 6474 THEN x := x - 1 END;
+IF x > 6475 THEN x := x - 1 END;
+IF x > 6476 THEN x := x - 1 END;
+IF x > 6477 THEN x := x - 1 END;
+IF x > 6478 THEN x := x - 1 END;
+IF x > 6479 THEN x := x - 1 END;
+IF x > 6480 THEN x := x - 1 END;
+IF x > 6481 THEN x := x - 1 END;
+IF x > 6482 THEN x := x - 1 END;
+IF x > 6483 THEN x := x - 1 END;
+IF x > 6484 THEN x := x - 1 END;
+IF x > 6485 THEN x := x - 1 END;
+IF x > 6486 THEN x := x - 1 END;
+IF x > 6487 THEN x := x - 1 END;
+IF x > 6488 THEN x := x - 1 END;
+IF x > 6489 THEN x := x - 1 END;
+IF x > 6490 THEN x := x - 1 END;
+IF x > 6491 THEN x := x - 1 END;
+IF x > 6492 THEN x := x - 1 END;
+IF x > 6493 THEN x := x - 1 END;
+IF x > 6494 THEN x := x - 1 END;
+IF x > 6495 THEN x := x - 1 END;
+IF x > 6496 THEN x := x - 1 END;
+IF x > 6497 THEN x := x - 1 END;
+IF x > 6498 THEN x := x - 1 END;
+IF x > 6499 THEN x := x - 1 END;
+IF x > 6500 THEN x := x - 1 END;
+IF x > 6501 THEN x := x - 1 END;
+IF x > 6502 THEN x := x - 1 END;
+IF x > 6503 THEN x := x - 1 END;
+IF x > 6504 THEN x := x - 1 END;
+IF x > 6505 THEN x := x - 1 END;
+IF x > 6506 THEN x := x - 1 END;
+IF x > 6507 THEN x := x - 1 END;
+IF x > 6508 THEN x := x - 1 END;
+IF x > 6509 THEN x := x - 1 END;
+IF x > 6510 THEN x := x - 1 END;
+IF x > 6511 THEN x := x - 1 END;
+IF x > 6512 THEN x := x - 1 END;
+IF x > 6513 THEN x := x - 1 END;
+IF x > 6514 THEN x := x - 1 END;
+IF x > 6515 THEN x := x - 1 END;
+IF x > 6516 THEN x := x - 1 END;
+IF x > 6517 THEN x := x - 1 END;
+IF x > 6518 THEN x := x - 1 END;
+IF x > 6519 THEN x := x - 1 END;
+IF x > 6520 THEN x := x - 1 END;
+IF x > 6521 THEN x := x - 1 END;
+IF x > 6522 THEN x := x - 1 END;
+IF x > 6523 THEN x := x - 1 END;
+IF x > 6524 THEN x := x - 1 END;
+IF x > 6525 THEN x := x - 1 END;
+IF x > 6526 THEN x := x - 1 END;
+IF x > 6527 THEN x := x - 1 END;
+IF x > 6528 THEN x := x - 1 END;
+IF x > 6529 THEN x := x - 1 END;
+IF x > 6530 THEN x := x - 1 END;
+IF x > 6531 THEN x := x - 1 END;
+IF x > 6532 THEN x := x - 1 END;
+IF x > 6533 THEN x := x - 1 END;
+IF x > 6534 THEN x := x - 1 END;
+IF x > 6535 THEN x := x - 1 END;
+IF x > 6536 THEN x := x - 1 END;
+IF x > 6537 THEN x := x - 1 END;
+IF x > 6538 THEN x := x - 1 END;
+IF x > 6539 THEN x := x - 1 END;
+IF x > 6540 THEN x := x - 1 END;
+IF x > 6541 THEN x := x - 1 END;
+IF x > 6542 THEN x := x - 1 END;
+IF x > 6543 THEN x := x - 1 END;
+IF x > 6544 THEN x := x - 1 END;
+IF x > 6545 THEN x := x - 1 END;
+IF x > 6546 THEN x := x - 1 END;
+IF x > 6547 THEN x := x - 1 END;
+IF x > 6548 THEN x := x - 1 END;
+IF x > 6549 THEN x := x - 1 END;
+IF x > 6550 THEN x := x - 1 END;
+IF x > 6551 THEN x := x - 1 END;
+IF x > 6552 THEN x := x - 1 END;
+IF x > 6553 THEN x := x - 1 END;
+IF x > 6554 THEN x := x - 1 END;
+IF x > 6555 THEN x := x - 1 END;
+IF x > 6556 THEN x := x - 1 END;
+IF x > 6557 THEN x := x - 1 END;
+IF x > 6558 THEN x := x - 1 END;
+IF x > 6559 THEN x := x - 1 END;
+IF x > 6560 THEN x := x - 1 END;
+IF x > 6561 THEN x := x - 1 END;
+IF x > 6562 THEN x := x - 1 END;
+IF x > 6563 THEN x := x - 1 END;
+IF x > 6564 THEN x := x - 1 END;
+IF x > 6565 THEN x := x - 1 END;
+IF x > 6566 THEN x := x - 1 END;
+IF x > 6567 THEN x := x - 1 END;
+IF x > 6568 THEN x := x - 1 END;
+IF x > 6569 THEN x := x - 1 END;
+IF x > 6570 THEN x := x - 1 END;
+IF x > 6571 THEN x := x - 1 END;
+IF x > 6572 THEN x := x - 1 END;
+IF x > 6573 THEN x := x - 1 END;
+IF x > 6574 THEN x := x - 1 END;
+IF x > 6575 THEN x := x - 1 END;
+IF x > 6576 THEN x := x - 1 END;
+IF x > 6577 THEN x := x - 1 END;
+IF x > 6578 THEN x := x - 1 END;
+IF x > 6579 THEN x := x - 1 END;
+IF x > 6580 THEN x := x - 1 END;
+IF x > 6581 THEN x := x - 1 END;
+IF x > 6582 THEN x := x - 1 END;
+IF x > 6583 THEN x := x - 1 END;
+IF x > 6584 THEN x := x - 1 END;
+IF x > 6585 THEN x := x - 1 END;
+IF x > 6586 THEN x := x - 1 END;
+IF x > 6587 THEN x := x - 1 END;
+IF x > 6588 THEN x := x - 1 END;
+IF x > 6589 THEN x := x - 1 END;
+IF x > 6590 THEN x := x - 1 END;
+IF x > 6591 THEN x := x - 1 END;
+IF x > 6592 THEN x := x - 1 END;
+IF x > 6593 THEN x := x - 1 END;
+IF x > 6594 THEN x := x - 1 END;
+IF x > 6595 THEN x := x - 1 END;
+IF x > 6596 THEN x := x - 1 END;
+IF x > 6597 THEN x := x - 1 END;
+IF x > 6598 THEN x := x - 1 END;
+IF x > 6599 THEN x := x - 1 END;
+IF x > 6600 THEN x := x - 1 END;
+IF x > 6601 THEN x := x - 1 END;
+IF x > 6602 THEN x := x - 1 END;
+IF x > 6603 THEN x := x - 1 END;
+IF x > 6604 THEN x := x - 1 END;
+IF x > 6605 THEN x := x - 1 END;
+IF x > 6606 THEN x := x - 1 END;
+IF x > 6607 THEN x := x - 1 END;
+IF x > 6608 THEN x := x - 1 END;
+IF x > 6609 THEN x := x - 1 END;
+IF x > 6610 THEN x := x - 1 END;
+IF x > 6611 THEN x := x - 1 END;
+IF x > 6612 THEN x := x - 1 END;
+IF x > 6613 THEN x := x - 1 END;
+IF x > 6614 THEN x := x - 1 END;
+IF x > 6615 THEN x := x - 1 END;
+IF x > 6616 THEN x := x - 1 END;
+IF x > 6617 THEN x := x - 1 END;
+IF x > 6618 THEN x := x - 1 END;
+IF x > 6619 THEN x := x - 1 END;
+IF x > 6620 THEN x := x - 1 END;
+IF x > 6621 THEN x := x - 1 END;
+IF x > 6622 THEN x := x - 1 END;
+IF x > 6623 THEN x := x - 1 END;
+IF x > 6624 THEN x := x - 1 END;
+IF x > 6625 THEN x := x - 1 END;
+IF x > 6626 THEN x := x - 1 END;
+IF x > 6627 THEN x := x - 1 END;
+IF x > 6628 THEN x := x - 1 END;
+IF x > 6629 THEN x := x - 1 END;
+IF x > 6630 THEN x := x - 1 END;
+IF x > 6631 THEN x := x - 1 END;
+IF x > 6632 THEN x := x - 1 END;
+IF x > 6633 THEN x := x - 1 END;
+IF x > 6634 THEN x := x - 1 END;
+IF x > 6635 THEN x := x - 1 END;
+IF x > 6636 THEN x := x - 1 END;
+IF x > 6637 THEN x := x - 1 END;
+IF x > 6638 THEN x := x - 1 END;
+IF x > 6639 THEN x := x - 1 END;
+IF x > 6640 THEN x := x - 1 END;
+IF x > 6641 THEN x := x - 1 END;
+IF x > 6642 THEN x := x - 1 END;
+IF x > 6643 THEN x := x - 1 END;
+IF x > 6644 THEN x := x - 1 END;
+IF x > 6645 THEN x := x - 1 END;
+IF x > 6646 THEN x := x - 1 END;
+IF x > 6647 THEN x := x - 1 END;
+IF x > 6648 THEN x := x - 1 END;
+IF x > 6649 THEN x := x - 1 END;
+IF x > 6650 THEN x := x - 1 END;
+IF x > 6651 THEN x := x - 1 END;
+IF x > 6652 THEN x := x - 1 END;
+IF x > 6653 THEN x := x - 1 END;
+IF x > 6654 THEN x := x - 1 END;
+IF x > 6655 THEN x := x - 1 END;
+IF x > 6656 THEN x := x - 1 END;
+IF x > 6657 THEN x := x - 1 END;
+IF x > 6658 THEN x := x - 1 END;
+IF x > 6659 THEN x := x - 1 END;
+IF x > 6660 THEN x := x - 1 END;
+IF x > 6661 THEN x := x - 1 END;
+IF x > 6662 THEN x := x - 1 END;
+IF x > 6663 THEN x := x - 1 END;
+IF x > 6664 THEN x := x - 1 END;
+IF x > 6665 THEN x := x - 1 END;
+IF x > 6666 THEN x := x - 1 END;
+IF x > 6667 THEN x := x - 1 END;
+IF x > 6668 THEN x := x - 1 END;
+IF x > 6669 THEN x := x - 1 END;
+IF x > 6670 THEN x := x - 1 END;
+IF x > 6671 THEN x := x - 1 END;
+IF x > 6672 THEN x := x - 1 END;
+IF x > 6673 THEN x := x - 1 END;
+IF x > 6674 THEN x := x - 1 END;
+IF x > 6675 THEN x := x - 1 END;
+IF x > 6676 THEN x := x - 1 END;
+IF x > 6677 THEN x := x - 1 END;
+IF x > 6678 THEN x := x - 1 END;
+IF x > 6679 THEN x := x - 1 END;
+IF x > 6680 THEN x := x - 1 END;
+IF x > 6681 THEN x := x - 1 END;
+IF x > 6682 THEN x := x - 1 END;
+IF x > 6683 THEN x := x - 1 END;
+IF x > 6684 THEN x := x - 1 END;
+IF x > 6685 THEN x := x - 1 END;
+IF x > 6686 THEN x := x - 1 END;
+IF x > 6687 THEN x := x - 1 END;
+IF x > 6688 THEN x := x - 1 END;
+IF x > 6689 THEN x := x - 1 END;
+IF x > 6690 THEN x := x - 1 END;
+IF x > 6691 THEN x := x - 1 END;
+IF x > 6692 THEN x := x - 1 END;
+IF x > 6693 THEN x := x - 1 END;
+IF x > 6694 THEN x := x - 1 END;
+IF x > 6695 THEN x := x - 1 END;
+IF x > 6696 THEN x := x - 1 END;
+IF x > 6697 THEN x := x - 1 END;
+IF x > 6698 THEN x := x - 1 END;
+IF x > 6699 THEN x := x - 1 END;
+IF x > 6700 THEN x := x - 1 END;
+IF x > 6701 THEN x := x - 1 END;
+IF x > 6702 THEN x := x - 1 END;
+IF x > 6703 THEN x := x - 1 END;
+IF x > 6704 THEN x := x - 1 END;
+IF x > 6705 THEN x := x - 1 END;
+IF x > 6706 THEN x := x - 1 END;
+IF x > 6707 THEN x := x - 1 END;
+IF x > 6708 THEN x := x - 1 END;
+IF x > 6709 THEN x := x - 1 END;
+IF x > 6710 THEN x := x - 1 END;
+IF x > 6711 THEN x := x - 1 END;
+IF x > 6712 THEN x := x - 1 END;
+IF x > 6713 THEN x := x - 1 END;
+IF x > 6714 THEN x := x - 1 END;
+IF x > 6715 THEN x := x - 1 END;
+IF x > 6716 THEN x := x - 1 END;
+IF x > 6717 THEN x := x - 1 END;
+IF x > 6718 THEN x := x - 1 END;
+IF x > 6719 THEN x := x - 1 END;
+IF x > 6720 THEN x := x - 1 END;
+IF x > 6721 THEN x := x - 1 END;
+IF x > 6722 THEN x := x - 1 END;
+IF x > 6723 THEN x := x - 1 END;
+IF x > 6724 THEN x := x - 1 END;
+IF x > 6725 THEN x := x - 1 END;
+IF x > 6726 THEN x := x - 1 END;
+IF x > 6727 THEN x := x - 1 END;
+IF x > 6728 THEN x := x - 1 END;
+IF x > 6729 THEN x := x - 1 END;
+IF x > 6730 THEN x := x - 1 END;
+IF x > 6731 THEN x := x - 1 END;
+IF x > 6732 THEN x := x - 1 END;
+IF x > 6733 THEN x := x - 1 END;
+IF x > 6734 THEN x := x - 1 END;
+IF x > 6735 THEN x := x - 1 END;
+IF x > 6736 THEN x := x - 1 END;
+IF x > 6737 THEN x := x - 1 END;
+IF x > 6738 THEN x := x - 1 END;
+IF x > 6739 THEN x := x - 1 END;
+IF x > 6740 THEN x := x - 1 END;
+IF x > 6741 THEN x := x - 1 END;
+IF x > 6742 THEN x := x - 1 END;
+IF x > 6743 THEN x := x - 1 END;
+IF x > 6744 THEN x := x - 1 END;
+IF x > 6745 THEN x := x - 1 END;
+IF x > 6746 THEN x := x - 1 END;
+IF x > 6747 THEN x := x - 1 END;
+IF x > 6748 THEN x := x - 1 END;
+IF x > 6749 THEN x := x - 1 END;
+IF x > 6750 THEN x := x - 1 END;
+IF x > 6751 THEN x := x - 1 END;
+IF x > 6752 THEN x := x - 1 END;
+IF x > 6753 THEN x := x - 1 END;
+IF x > 6754 THEN x := x - 1 END;
+IF x > 6755 THEN x := x - 1 END;
+IF x > 6756 THEN x := x - 1 END;
+IF x > 6757 THEN x := x - 1 END;
+IF x > 6758 THEN x := x - 1 END;
+IF x > 6759 THEN x := x - 1 END;
+IF x > 6760 THEN x := x - 1 END;
+IF x > 6761 THEN x := x - 1 END;
+IF x > 6762 THEN x := x - 1 END;
+IF x > 6763 THEN x := x - 1 END;
+IF x > 6764 THEN x := x - 1 END;
+IF x > 6765 THEN x := x - 1 END;
+IF x > 6766 THEN x := x - 1 END;
+IF x > 6767 THEN x := x - 1 END;
+IF x > 6768 THEN x := x - 1 END;
+IF x > 6769 THEN x := x - 1 END;
+IF x > 6770 THEN x := x - 1 END;
+IF x > 6771 THEN x := x - 1 END;
+IF x > 6772 THEN x := x - 1 END;
+IF x > 6773 THEN x := x - 1 END;
+IF x > 6774 THEN x := x - 1 END;
+IF x > 6775 THEN x := x - 1 END;
+IF x > 6776 THEN x := x - 1 END;
+IF x > 6777 THEN x := x - 1 END;
+IF x > 6778 THEN x := x - 1 END;
+IF x > 6779 THEN x := x - 1 END;
+IF x > 6780 THEN x := x - 1 END;
+IF x > 6781 THEN x := x - 1 END;
+IF x > 6782 THEN x := x - 1 END;
+IF x > 6783 THEN x := x - 1 END;
+IF x > 6784 THEN x := x - 1 END;
+IF x > 6785 THEN x := x - 1 END;
+IF x > 6786 THEN x := x - 1 END;
+IF x > 6787 THEN x := x - 1 END;
+IF x > 6788 THEN x := x - 1 END;
+IF x > 6789 THEN x := x - 1 END;
+IF x > 6790 THEN x := x - 1 END;
+IF x > 6791 THEN x := x - 1 END;
+IF x > 6792 THEN x := x - 1 END;
+IF x > 6793 THEN x := x - 1 END;
+IF x > 6794 THEN x := x - 1 END;
+IF x > 6795 THEN x := x - 1 END;
+IF x > 6796 THEN x := x - 1 END;
+IF x > 6797 THEN x := x - 1 END;
+IF x > 6798 THEN x := x - 1 END;
+IF x > 6799 THEN x := x - 1 END;
+IF x > 6800 THEN x := x - 1 END;
+IF x > 6801 THEN x := x - 1 END;
+IF x > 6802 THEN x := x - 1 END;
+IF x > 6803 THEN x := x - 1 END;
+IF x > 6804 THEN x := x - 1 END;
+IF x > 6805 THEN x := x - 1 END;
+IF x > 6806 THEN x := x - 1 END;
+IF x > 6807 THEN x := x - 1 END;
+IF x > 6808 THEN x := x - 1 END;
+IF x > 6809 THEN x := x - 1 END;
+IF x > 6810 THEN x := x - 1 END;
+IF x > 6811 THEN x := x - 1 END;
+IF x > 6812 THEN x := x - 1 END;
+IF x > 6813 THEN x := x - 1 END;
+IF x > 6814 THEN x := x - 1 END;
+IF x > 6815 THEN x := x - 1 END;
+IF x > 6816 THEN x := x - 1 END;
+IF x > 6817 THEN x := x - 1 END;
+IF x > 6818 THEN x := x - 1 END;
+IF x > 6819 THEN x := x - 1 END;
+IF x > 6820 THEN x := x - 1 END;
+IF x > 6821 THEN x := x - 1 END;
+IF x > 6822 THEN x := x - 1 END;
+IF x > 6823 THEN x := x - 1 END;
+IF x > 6824 THEN x := x - 1 END;
+IF x > 6825 THEN x := x - 1 END;
+IF x > 6826 THEN x := x - 1 END;
+IF x > 6827 THEN x := x - 1 END;
+IF x > 6828 THEN x := x - 1 END;
+IF x > 6829 THEN x := x - 1 END;
+IF x > 6830 THEN x := x - 1 END;
+IF x > 6831 THEN x := x - 1 END;
+IF x > 6832 THEN x := x - 1 END;
+IF x > 6833 THEN x := x - 1 END;
+IF x > 6834 THEN x := x - 1 END;
+IF x > 6835 THEN x := x - 1 END;
+IF x > 6836 THEN x := x - 1 END;
+IF x > 6837 THEN x := x - 1 END;
+IF x > 6838 THEN x := x - 1 END;
+IF x > 6839 THEN x := x - 1 END;
+IF x > 6840 THEN x := x - 1 END;
+IF x > 6841 THEN x := x - 1 END;
+IF x > 6842 THEN x := x - 1 END;
+IF x > 6843 THEN x := x - 1 END;
+IF x > 6844 THEN x := x - 1 END;
+IF x > 6845 THEN x := x - 1 END;
+IF x > 6846 THEN x := x - 1 END;
+IF x > 6847 THEN x := x - 1 END;
+IF x > 6848 THEN x := x - 1 END;
+IF x > 6849 THEN x := x - 1 END;
+IF x > 6850 THEN x := x - 1 END;
+IF x > 6851 THEN x := x - 1 END;
+IF x > 6852 THEN x := x - 1 END;
+IF x > 6853 THEN x := x - 1 END;
+IF x > 6854 THEN x := x - 1 END;
+IF x > 6855 THEN x := x - 1 END;
+IF x > 6856 THEN x := x - 1 END;
+IF x > 6857 THEN x := x - 1 END;
+IF x > 6858 THEN x := x - 1 END;
+IF x > 6859 THEN x := x - 1 END;
+IF x > 6860 THEN x := x - 1 END;
+IF x > 6861 THEN x := x - 1 END;
+IF x > 6862 THEN x := x - 1 END;
+IF x > 6863 THEN x := x - 1 END;
+IF x > 6864 THEN x := x - 1 END;
+IF x > 6865 THEN x := x - 1 END;
+IF x > 6866 THEN x := x - 1 END;
+IF x > 6867 THEN x := x - 1 END;
+IF x > 6868 THEN x := x - 1 END;
+IF x > 6869 THEN x := x - 1 END;
+IF x > 6870 THEN x := x - 1 END;
+IF x > 6871 THEN x := x - 1 END;
+IF x > 6872 THEN x := x - 1 END;
+IF x > 6873 THEN x := x - 1 END;
+IF x > 6874 THEN x := x - 1 END;
+IF x > 6875 THEN x := x - 1 END;
+IF x > 6876 THEN x := x - 1 END;
+IF x > 6877 THEN x := x - 1 END;
+IF x > 6878 THEN x := x - 1 END;
+IF x > 6879 THEN x := x - 1 END;
+IF x > 6880 THEN x := x - 1 END;
+IF x > 6881 THEN x := x - 1 END;
+IF x > 6882 THEN x := x - 1 END;
+IF x > 6883 THEN x := x - 1 END;
+IF x > 6884 THEN x := x - 1 END;
+IF x > 6885 THEN x := x - 1 END;
+IF x > 6886 THEN x := x - 1 END;
+IF x > 6887 THEN x := x - 1 END;
+IF x > 6888 THEN x := x - 1 END;
+IF x > 6889 THEN x := x - 1 END;
+IF x > 6890 THEN x := x - 1 END;
+IF x > 6891 THEN x := x - 1 END;
+IF x > 6892 THEN x := x - 1 END;
+IF x > 6893 THEN x := x - 1 END;
+IF x > 6894 THEN x := x - 1 END;
+IF x > 6895 THEN x := x - 1 END;
+IF x > 6896 THEN x := x - 1 END;
+IF x > 6897 THEN x := x - 1 END;
+IF x > 6898 THEN x := x - 1 END;
+IF x > 6899 THEN x := x - 1 END;
+IF x > 6900 THEN x := x - 1 END;
+IF x > 6901 THEN x := x - 1 END;
+IF x > 6902 THEN x := x - 1 END;
+IF x > 6903 THEN x := x - 1 END;
+IF x > 6904 THEN x := x - 1 END;
+IF x > 6905 THEN x := x - 1 END;
+IF x > 6906 THEN x := x - 1 END;
+IF x > 6907 THEN x := x - 1 END;
+IF x > 6908 THEN x := x - 1 END;
+IF x > 6909 THEN x := x - 1 END;
+IF x > 6910 THEN x := x - 1 END;
+IF x > 6911 THEN x := x - 1 END;
+IF x > 6912 THEN x := x - 1 END;
+IF x > 6913 THEN x := x - 1 END;
+IF x > 6914 THEN x := x - 1 END;
+IF x > 6915 THEN x := x - 1 END;
+IF x > 6916 THEN x := x - 1 END;
+IF x > 6917 THEN x := x - 1 END;
+IF x > 6918 THEN x := x - 1 END;
+IF x > 6919 THEN x := x - 1 END;
+IF x > 6920 THEN x := x - 1 END;
+IF x > 6921 THEN x := x - 1 END;
+IF x > 6922 THEN x := x - 1 END;
+IF x > 6923 THEN x := x - 1 END;
+IF x > 6924 THEN x := x - 1 END;
+IF x > 6925 THEN x := x - 1 END;
+IF x > 6926 THEN x := x - 1 END;
+IF x > 6927 THEN x := x - 1 END;
+IF x > 6928 THEN x := x - 1 END;
+IF x > 6929 THEN x := x - 1 END;
+IF x > 6930 THEN x := x - 1 END;
+IF x > 6931 THEN x := x - 1 END;
+IF x > 6932 THEN x := x - 1 END;
+IF x > 6933 THEN x := x - 1 END;
+IF x > 6934 THEN x := x - 1 END;
+IF x > 6935 THEN x := x - 1 END;
+IF x > 6936 THEN x := x - 1 END;
+IF x > 6937 THEN x := x - 1 END;
+IF x > 6938 THEN x := x - 1 END;
+IF x > 6939 THEN x := x - 1 END;
+IF x > 6940 THEN x := x - 1 END;
+IF x > 6941 THEN x := x - 1 END;
+IF x > 6942 THEN x := x - 1 END;
+IF x > 6943 THEN x := x - 1 END;
+IF x > 6944 THEN x := x - 1 END;
+IF x > 6945 THEN x := x - 1 END;
+IF x > 6946 THEN x := x - 1 END;
+IF x > 6947 THEN x := x - 1 END;
+IF x > 6948 THEN x := x - 1 END;
+IF x > 6949 THEN x := x - 1 END;
+IF x > 6950 THEN x := x - 1 END;
+IF x > 6951 THEN x := x - 1 END;
+IF x > 6952 THEN x := x - 1 END;
+IF x > 6953 THEN x := x - 1 END;
+IF x > 6954 THEN x := x - 1 END;
+IF x > 6955 THEN x := x - 1 END;
+IF x > 6956 THEN x := x - 1 END;
+IF x > 6957 THEN x := x - 1 END;
+IF x > 6958 THEN x := x - 1 END;
+IF x > 6959 THEN x := x - 1 END;
+IF x > 6960 THEN x := x - 1 END;
+IF x > 6961 THEN x := x - 1 END;
+IF x > 6962 THEN x := x - 1 END;
+IF x > 6963 THEN x := x - 1 END;
+IF x > 6964 THEN x := x - 1 END;
+IF x > 6965 THEN x := x - 1 END;
+IF x > 6966 THEN x := x - 1 END;
+IF x > 6967 THEN x := x - 1 END;
+IF x > 6968 THEN x := x - 1 END;
+IF x > 6969 THEN x := x - 1 END;
+IF x > 6970 THEN x := x - 1 END;
+IF x > 6971 THEN x := x - 1 END;
+IF x > 6972 THEN x := x - 1 END;
+IF x > 6973 THEN x := x - 1 END;
+IF x > 6974 THEN x := x - 1 END;
+IF x > 6975 THEN x := x - 1 END;
+IF x > 6976 THEN x := x - 1 END;
+IF x > 6977 THEN x := x - 1 END;
+IF x > 6978 THEN x := x - 1 END;
+IF x > 6979 THEN x := x - 1 END;
+IF x > 6980 THEN x := x - 1 END;
+IF x > 6981 THEN x := x - 1 END;
+IF x > 6982 THEN x := x - 1 END;
+IF x > 6983 THEN x := x - 1 END;
+IF x > 6984 THEN x := x - 1 END;
+IF x > 6985 THEN x := x - 1 END;
+IF x > 6986 THEN x := x - 1 END;
+IF x > 6987 THEN x := x - 1 END;
+IF x > 6988 THEN x := x - 1 END;
+IF x > 6989 THEN x := x - 1 END;
+IF x > 6990 THEN x := x - 1 END;
+IF x > 6991 THEN x := x - 1 END;
+IF x > 6992 THEN x := x - 1 END;
+IF x > 6993 THEN x := x - 1 END;
+IF x > 6994 THEN x := x - 1 END;
+IF x > 6995 THEN x := x - 1 END;
+IF x > 6996 THEN x := x - 1 END;
+IF x > 6997 THEN x := x - 1 END;
+IF x > 6998 THEN x := x - 1 END;
+IF x > 6999 THEN x := x - 1 END;
+IF x > 7000 THEN x := x - 1 END;
+IF x > 7001 THEN x := x - 1 END;
+IF x > 7002 THEN x := x - 1 END;
+IF x > 7003 THEN x := x - 1 END;
+IF x > 7004 THEN x := x - 1 END;
+IF x > 7005 THEN x := x - 1 END;
+IF x > 7006 THEN x := x - 1 END;
+IF x > 7007 THEN x := x - 1 END;
+IF x > 7008 THEN x := x - 1 END;
+IF x > 7009 THEN x := x - 1 END;
+IF x > 7010 THEN x := x - 1 END;
+IF x > 7011 THEN x := x - 1 END;
+IF x > 7012 THEN x := x - 1 END;
+IF x > 7013 THEN x := x - 1 END;
+IF x > 7014 THEN x := x - 1 END;
+IF x > 7015 THEN x := x - 1 END;
+IF x > 7016 THEN x := x - 1 END;
+IF x > 7017 THEN x := x - 1 END;
+IF x > 7018 THEN x := x - 1 END;
+IF x > 7019 THEN x := x - 1 END;
+IF x > 7020 THEN x := x - 1 END;
+IF x > 7021 THEN x := x - 1 END;
+IF x > 7022 THEN x := x - 1 END;
+IF x > 7023 THEN x := x - 1 END;
+IF x > 7024 THEN x := x - 1 END;
+IF x > 7025 THEN x := x - 1 END;
+IF x > 7026 THEN x := x - 1 END;
+IF x > 7027 THEN x := x - 1 END;
+IF x > 7028 THEN x := x - 1 END;
+IF x > 7029 THEN x := x - 1 END;
+IF x > 7030 THEN x := x - 1 END;
+IF x > 7031 THEN x := x - 1 END;
+IF x > 7032 THEN x := x - 1 END;
+IF x > 7033 THEN x := x - 1 END;
+IF x > 7034 THEN x := x - 1 END;
+IF x > 7035 THEN x := x - 1 END;
+IF x > 7036 THEN x := x - 1 END;
+IF x > 7037 THEN x := x - 1 END;
+IF x > 7038 THEN x := x - 1 END;
+IF x > 7039 THEN x := x - 1 END;
+IF x > 7040 THEN x := x - 1 END;
+IF x > 7041 THEN x := x - 1 END;
+IF x > 7042 THEN x := x - 1 END;
+IF x > 7043 THEN x := x - 1 END;
+IF x > 7044 THEN x := x - 1 END;
+IF x > 7045 THEN x := x - 1 END;
+IF x > 7046 THEN x := x - 1 END;
+IF x > 7047 THEN x := x - 1 END;
+IF x > 7048 THEN x := x - 1 END;
+IF x > 7049 THEN x := x - 1 END;
+IF x > 7050 THEN x := x - 1 END;
+IF x > 7051 THEN x := x - 1 END;
+IF x > 7052 THEN x := x - 1 END;
+IF x > 7053 THEN x := x - 1 END;
+IF x > 7054 THEN x := x - 1 END;
+IF x > 7055 THEN x := x - 1 END;
+IF x > 7056 THEN x := x - 1 END;
+IF x > 7057 THEN x := x - 1 END;
+IF x > 7058 THEN x := x - 1 END;
+IF x > 7059 THEN x := x - 1 END;
+IF x > 7060 THEN x := x - 1 END;
+IF x > 7061 THEN x := x - 1 END;
+IF x > 7062 THEN x := x - 1 END;
+IF x > 7063 THEN x := x - 1 END;
+IF x > 7064 THEN x := x - 1 END;
+IF x > 7065 THEN x := x - 1 END;
+IF x > 7066 THEN x := x - 1 END;
+IF x > 7067 THEN x := x - 1 END;
+IF x > 7068 THEN x := x - 1 END;
+IF x > 7069 THEN x := x - 1 END;
+IF x > 7070 THEN x := x - 1 END;
+IF x > 7071 THEN x := x - 1 END;
+IF x > 7072 THEN x := x - 1 END;
+IF x > 7073 THEN x := x - 1 END;
+IF x > 7074 THEN x := x - 1 END;
+IF x > 7075 THEN x := x - 1 END;
+IF x > 7076 THEN x := x - 1 END;
+IF x > 7077 THEN x := x - 1 END;
+IF x > 7078 THEN x := x - 1 END;
+IF x > 7079 THEN x := x - 1 END;
+IF x > 7080 THEN x := x - 1 END;
+IF x > 7081 THEN x := x - 1 END;
+IF x > 7082 THEN x := x - 1 END;
+IF x > 7083 THEN x := x - 1 END;
+IF x > 7084 THEN x := x - 1 END;
+IF x > 7085 THEN x := x - 1 END;
+IF x > 7086 THEN x := x - 1 END;
+IF x > 7087 THEN x := x - 1 END;
+IF x > 7088 THEN x := x - 1 END;
+IF x > 7089 THEN x := x - 1 END;
+IF x > 7090 THEN x := x - 1 END;
+IF x > 7091 THEN x := x - 1 END;
+IF x > 7092 THEN x := x - 1 END;
+IF x > 7093 THEN x := x - 1 END;
+IF x > 7094 THEN x := x - 1 END;
+IF x > 7095 THEN x := x - 1 END;
+IF x > 7096 THEN x := x - 1 END;
+IF x > 7097 THEN x := x - 1 END;
+IF x > 7098 THEN x := x - 1 END;
+IF x > 7099 THEN x := x - 1 END;
+IF x > 7100 THEN x := x - 1 END;
+IF x > 7101 THEN x := x - 1 END;
+IF x > 7102 THEN x := x - 1 END;
+IF x > 7103 THEN x := x - 1 END;
+IF x > 7104 THEN x := x - 1 END;
+IF x > 7105 THEN x := x - 1 END;
+IF x > 7106 THEN x := x - 1 END;
+IF x > 7107 THEN x := x - 1 END;
+IF x > 7108 THEN x := x - 1 END;
+IF x > 7109 THEN x := x - 1 END;
+IF x > 7110 THEN x := x - 1 END;
+IF x > 7111 THEN x := x - 1 END;
+IF x > 7112 THEN x := x - 1 END;
+IF x > 7113 THEN x := x - 1 END;
+IF x > 7114 THEN x := x - 1 END;
+IF x > 7115 THEN x := x - 1 END;
+IF x > 7116 THEN x := x - 1 END;
+IF x > 7117 THEN x := x - 1 END;
+IF x > 7118 THEN x := x - 1 END;
+IF x > 7119 THEN x := x - 1 END;
+IF x > 7120 THEN x := x - 1 END;
+IF x > 7121 THEN x := x - 1 END;
+IF x > 7122 THEN x := x - 1 END;
+IF x > 7123 THEN x := x - 1 END;
+IF x > 7124 THEN x := x - 1 END;
+IF x > 7125 THEN x := x - 1 END;
+IF x > 7126 THEN x := x - 1 END;
+IF x > 7127 THEN x := x - 1 END;
+IF x > 7128 THEN x := x - 1 END;
+IF x > 7129 THEN x := x - 1 END;
+IF x > 7130 THEN x := x - 1 END;
+IF x > 7131 THEN x := x - 1 END;
+IF x > 7132 THEN x := x - 1 END;
+IF x > 7133 THEN x := x - 1 END;
+IF x > 7134 THEN x := x - 1 END;
+IF x > 7135 THEN x := x - 1 END;
+IF x > 7136 THEN x := x - 1 END;
+IF x > 7137 THEN x := x - 1 END;
+IF x > 7138 THEN x := x - 1 END;
+IF x > 7139 THEN x := x - 1 END;
+IF x > 7140 THEN x := x - 1 END;
+IF x > 7141 THEN x := x - 1 END;
+IF x > 7142 THEN x := x - 1 END;
+IF x > 7143 THEN x := x - 1 END;
+IF x > 7144 THEN x := x - 1 END;
+IF x > 7145 THEN x := x - 1 END;
+IF x > 7146 THEN x := x - 1 END;
+IF x > 7147 THEN x := x - 1 END;
+IF x > 7148 THEN x := x - 1 END;
+IF x > 7149 THEN x := x - 1 END;
+IF x > 7150 THEN x := x - 1 END;
+IF x > 7151 THEN x := x - 1 END;
+IF x > 7152 THEN x := x - 1 END;
+IF x > 7153 THEN x := x - 1 END;
+IF x > 7154 THEN x := x - 1 END;
+IF x > 7155 THEN x := x - 1 END;
+IF x > 7156 THEN x := x - 1 END;
+IF x > 7157 THEN x := x - 1 END;
+IF x > 7158 THEN x := x - 1 END;
+IF x > 7159 THEN x := x - 1 END;
+IF x > 7160 THEN x := x - 1 END;
+IF x > 7161 THEN x := x - 1 END;
+IF x > 7162 THEN x := x - 1 END;
+IF x > 7163 THEN x := x - 1 END;
+IF x > 7164 THEN x := x - 1 END;
+IF x > 7165 THEN x := x - 1 END;
+IF x > 7166 THEN x := x - 1 END;
+IF x > 7167 THEN x := x - 1 END;
+IF x > 7168 THEN x := x - 1 END;
+IF x > 7169 THEN x := x - 1 END;
+IF x > 7170 THEN x := x - 1 END;
+IF x > 7171 THEN x := x - 1 END;
+IF x > 7172 THEN x := x - 1 END;
+IF x > 7173 THEN x := x - 1 END;
+IF x > 7174 THEN x := x - 1 END;
+IF x > 7175 THEN x := x - 1 END;
+IF x > 7176 THEN x := x - 1 END;
+IF x > 7177 THEN x := x - 1 END;
+IF x > 7178 THEN x := x - 1 END;
+IF x > 7179 THEN x := x - 1 END;
+IF x > 7180 THEN x := x - 1 END;
+IF x > 7181 THEN x := x - 1 END;
+IF x > 7182 THEN x := x - 1 END;
+IF x > 7183 THEN x := x - 1 END;
+IF x > 7184 THEN x := x - 1 END;
+IF x > 7185 THEN x := x - 1 END;
+IF x > 7186 THEN x := x - 1 END;
+IF x > 7187 THEN x := x - 1 END;
+IF x > 7188 THEN x := x - 1 END;
+IF x > 7189 THEN x := x - 1 END;
+IF x > 7190 THEN x := x - 1 END;
+IF x > 7191 THEN x := x - 1 END;
+IF x > 7192 THEN x := x - 1 END;
+IF x > 7193 THEN x := x - 1 END;
+IF x > 7194 THEN x := x - 1 END;
+IF x > 7195 THEN x := x - 1 END;
+IF x > 7196 THEN x := x - 1 END;
+IF x > 7197 THEN x := x - 1 END;
+IF x > 7198 THEN x := x - 1 END;
+IF x > 7199 THEN x := x - 1 END;
+IF x > 7200 THEN x := x - 1 END;
+IF x > 7201 THEN x := x - 1 END;
+IF x > 7202 THEN x := x - 1 END;
+IF x > 7203 THEN x := x - 1 END;
+IF x > 7204 THEN x := x - 1 END;
+IF x > 7205 THEN x := x - 1 END;
+IF x > 7206 THEN x := x - 1 END;
+IF x > 7207 THEN x := x - 1 END;
+IF x > 7208 THEN x := x - 1 END;
+IF x > 7209 THEN x := x - 1 END;
+IF x > 7210 THEN x := x - 1 END;
+IF x > 7211 THEN x := x - 1 END;
+IF x > 7212 THEN x := x - 1 END;
+IF x > 7213 THEN x := x - 1 END;
+IF x > 7214 THEN x := x - 1 END;
+IF x > 7215 THEN x := x - 1 END;
+IF x > 7216 THEN x := x - 1 END;
+IF x > 7217 THEN x := x - 1 END;
+IF x > 7218 THEN x := x - 1 END;
+IF x > 7219 THEN x := x - 1 END;
+IF x > 7220 THEN x := x - 1 END;
+IF x > 7221 THEN x := x - 1 END;
+IF x > 7222 THEN x := x - 1 END;
+IF x > 7223 THEN x := x - 1 END;
+IF x > 7224 THEN x := x - 1 END;
+IF x > 7225 THEN x := x - 1 END;
+IF x > 7226 THEN x := x - 1 END;
+IF x > 7227 THEN x := x - 1 END;
+IF x > 7228 THEN x := x - 1 END;
+IF x > 7229 THEN x := x - 1 END;
+IF x > 7230 THEN x := x - 1 END;
+IF x > 7231 THEN x := x - 1 END;
+IF x > 7232 THEN x := x - 1 END;
+IF x > 7233 THEN x := x - 1 END;
+IF x > 7234 THEN x := x - 1 END;
+IF x > 7235 THEN x := x - 1 END;
+IF x > 7236 THEN x := x - 1 END;
+IF x > 7237 THEN x := x - 1 END;
+IF x > 7238 THEN x := x - 1 END;
+IF x > 7239 THEN x := x - 1 END;
+IF x > 7240 THEN x := x - 1 END;
+IF x > 7241 THEN x := x - 1 END;
+IF x > 7242 THEN x := x - 1 END;
+IF x > 7243 THEN x := x - 1 END;
+IF x > 7244 THEN x := x - 1 END;
+IF x > 7245 THEN x := x - 1 END;
+IF x > 7246 THEN x := x - 1 END;
+IF x > 7247 THEN x := x - 1 END;
+IF x > 7248 THEN x := x - 1 END;
+IF x > 7249 THEN x := x - 1 END;
+IF x > 7250 THEN x := x - 1 END;
+IF x > 7251 THEN x := x - 1 END;
+IF x > 7252 THEN x := x - 1 END;
+IF x > 7253 THEN x := x - 1 END;
+IF x > 7254 THEN x := x - 1 END;
+IF x > 7255 THEN x := x - 1 END;
+IF x > 7256 THEN x := x - 1 END;
+IF x > 7257 THEN x := x - 1 END;
+IF x > 7258 THEN x := x - 1 END;
+IF x > 7259 THEN x := x - 1 END;
+IF x > 7260 THEN x := x - 1 END;
+IF x > 7261 THEN x := x - 1 END;
+IF x > 7262 THEN x := x - 1 END;
+IF x > 7263 THEN x := x - 1 END;
+IF x > 7264 THEN x := x - 1 END;
+IF x > 7265 THEN x := x - 1 END;
+IF x > 7266 THEN x := x - 1 END;
+IF x > 7267 THEN x := x - 1 END;
+IF x > 7268 THEN x := x - 1 END;
+IF x > 7269 THEN x := x - 1 END;
+IF x > 7270 THEN x := x - 1 END;
+IF x > 7271 THEN x := x - 1 END;
+IF x > 7272 THEN x := x - 1 END;
+IF x > 7273 THEN x := x - 1 END;
+IF x > 7274 THEN x := x - 1 END;
+IF x > 7275 THEN x := x - 1 END;
+IF x > 7276 THEN x := x - 1 END;
+IF x > 7277 THEN x := x - 1 END;
+IF x > 7278 THEN x := x - 1 END;
+IF x > 7279 THEN x := x - 1 END;
+IF x > 7280 THEN x := x - 1 END;
+IF x > 7281 THEN x := x - 1 END;
+IF x > 7282 THEN x := x - 1 END;
+IF x > 7283 THEN x := x - 1 END;
+IF x > 7284 THEN x := x - 1 END;
+IF x > 7285 THEN x := x - 1 END;
+IF x > 7286 THEN x := x - 1 END;
+IF x > 7287 THEN x := x - 1 END;
+IF x > 7288 THEN x := x - 1 END;
+IF x > 7289 THEN x := x - 1 END;
+IF x > 7290 THEN x := x - 1 END;
+IF x > 7291 THEN x := x - 1 END;
+IF x > 7292 THEN x := x - 1 END;
+IF x > 7293 THEN x := x - 1 END;
+IF x > 7294 THEN x := x - 1 END;
+IF x > 7295 THEN x := x - 1 END;
+IF x > 7296 THEN x := x - 1 END;
+IF x > 7297 THEN x := x - 1 END;
+IF x > 7298 THEN x := x - 1 END;
+IF x > 7299 THEN x := x - 1 END;
+IF x > 7300 THEN x := x - 1 END;
+IF x > 7301 THEN x := x - 1 END;
+IF x > 7302 THEN x := x - 1 END;
+IF x > 7303 THEN x := x - 1 END;
+IF x > 7304 THEN x := x - 1 END;
+IF x > 7305 THEN x := x - 1 END;
+IF x > 7306 THEN x := x - 1 END;
+IF x > 7307 THEN x := x - 1 END;
+IF x > 7308 THEN x := x - 1 END;
+IF x > 7309 THEN x := x - 1 END;
+IF x > 7310 THEN x := x - 1 END;
+IF x > 7311 THEN x := x - 1 END;
+IF x > 7312 THEN x := x - 1 END;
+IF x > 7313 THEN x := x - 1 END;
+IF x > 7314 THEN x := x - 1 END;
+IF x > 7315 THEN x := x - 1 END;
+IF x > 7316 THEN x := x - 1 END;
+IF x > 7317 THEN x := x - 1 END;
+IF x > 7318 THEN x := x - 1 END;
+IF x > 7319 THEN x := x - 1 END;
+IF x > 7320 THEN x := x - 1 END;
+IF x > 7321 THEN x := x - 1 END;
+IF x > 7322 THEN x := x - 1 END;
+IF x > 7323 THEN x := x - 1 END;
+IF x > 7324 THEN x := x - 1 END;
+IF x > 7325 THEN x := x - 1 END;
+IF x > 7326 THEN x := x - 1 END;
+IF x > 7327 THEN x := x - 1 END;
+IF x > 7328 THEN x := x - 1 END;
+IF x > 7329 THEN x := x - 1 END;
+IF x > 7330 THEN x := x - 1 END;
+IF x > 7331 THEN x := x - 1 END;
+IF x > 7332 THEN x := x - 1 END;
+IF x > 7333 THEN x := x - 1 END;
+IF x > 7334 THEN x := x - 1 END;
+IF x > 7335 THEN x := x - 1 END;
+IF x > 7336 THEN x := x - 1 END;
+IF x > 7337 THEN x := x - 1 END;
+IF x > 7338 THEN x := x - 1 END;
+IF x > 7339 THEN x := x - 1 END;
+IF x > 7340 THEN x := x - 1 END;
+IF x > 7341 THEN x := x - 1 END;
+IF x > 7342 THEN x := x - 1 END;
+IF x > 7343 THEN x := x - 1 END;
+IF x > 7344 THEN x := x - 1 END;
+IF x > 7345 THEN x := x - 1 END;
+IF x > 7346 THEN x := x - 1 END;
+IF x > 7347 THEN x := x - 1 END;
+IF x > 7348 THEN x := x - 1 END;
+IF x > 7349 THEN x := x - 1 END;
+IF x > 7350 THEN x := x - 1 END;
+IF x > 7351 THEN x := x - 1 END;
+IF x > 7352 THEN x := x - 1 END;
+IF x > 7353 THEN x := x - 1 END;
+IF x > 7354 THEN x := x - 1 END;
+IF x > 7355 THEN x := x - 1 END;
+IF x > 7356 THEN x := x - 1 END;
+IF x > 7357 THEN x := x - 1 END;
+IF x > 7358 THEN x := x - 1 END;
+IF x > 7359 THEN x := x - 1 END;
+IF x > 7360 THEN x := x - 1 END;
+IF x > 7361 THEN x := x - 1 END;
+IF x > 7362 THEN x := x - 1 END;
+IF x > 7363 THEN x := x - 1 END;
+IF x > 7364 THEN x := x - 1 END;
+IF x > 7365 THEN x := x - 1 END;
+IF x > 7366 THEN x := x - 1 END;
+IF x > 7367 THEN x := x - 1 END;
+IF x > 7368 THEN x := x - 1 END;
+IF x > 7369 THEN x := x - 1 END;
+IF x > 7370 THEN x := x - 1 END;
+IF x > 7371 THEN x := x - 1 END;
+IF x > 7372 THEN x := x - 1 END;
+IF x > 7373 THEN x := x - 1 END;
+IF x > 7374 THEN x := x - 1 END;
+IF x > 7375 THEN x := x - 1 END;
+IF x > 7376 THEN x := x - 1 END;
+IF x > 7377 THEN x := x - 1 END;
+IF x > 7378 THEN x := x - 1 END;
+IF x > 7379 THEN x := x - 1 END;
+IF x > 7380 THEN x := x - 1 END;
+IF x > 7381 THEN x := x - 1 END;
+IF x > 7382 THEN x := x - 1 END;
+IF x > 7383 THEN x := x - 1 END;
+IF x > 7384 THEN x := x - 1 END;
+IF x > 7385 THEN x := x - 1 END;
+IF x > 7386 THEN x := x - 1 END;
+IF x > 7387 THEN x := x - 1 END;
+IF x > 7388 THEN x := x - 1 END;
+IF x > 7389 THEN x := x - 1 END;
+IF x > 7390 THEN x := x - 1 END;
+IF x > 7391 THEN x := x - 1 END;
+IF x > 7392 THEN x := x - 1 END;
+IF x > 7393 THEN x := x - 1 END;
+IF x > 7394 THEN x := x - 1 END;
+IF x > 7395 THEN x := x - 1 END;
+IF x > 7396 THEN x := x - 1 END;
+IF x > 7397 THEN x := x - 1 END;
+IF x > 7398 THEN x := x - 1 END;
+IF x > 7399 THEN x := x - 1 END;
+IF x > 7400 THEN x := x - 1 END;
+IF x > 7401 THEN x := x - 1 END;
+IF x > 7402 THEN x := x - 1 END;
+IF x > 7403 THEN x := x - 1 END;
+IF x > 7404 THEN x := x - 1 END;
+IF x > 7405 THEN x := x - 1 END;
+IF x > 7406 THEN x := x - 1 END;
+IF x > 7407 THEN x := x - 1 END;
+IF x > 7408 THEN x := x - 1 END;
+IF x > 7409 THEN x := x - 1 END;
+IF x > 7410 THEN x := x - 1 END;
+IF x > 7411 THEN x := x - 1 END;
+IF x > 7412 THEN x := x - 1 END;
+IF x > 7413 THEN x := x - 1 END;
+IF x > 7414 THEN x := x - 1 END;
+IF x > 7415 THEN x := x - 1 END;
+IF x > 7416 THEN x := x - 1 END;
+IF x > 7417 THEN x := x - 1 END;
+IF x > 7418 THEN x := x - 1 END;
+IF x > 7419 THEN x := x - 1 END;
+IF x > 7420 THEN x := x - 1 END;
+IF x > 7421 THEN x := x - 1 END;
+IF x > 7422 THEN x := x - 1 END;
+IF x > 7423 THEN x := x - 1 END;
+IF x > 7424 THEN x := x - 1 END;
+IF x > 7425 THEN x := x - 1 END;
+IF x > 7426 THEN x := x - 1 END;
+IF x > 7427 THEN x := x - 1 END;
+IF x > 7428 THEN x := x - 1 END;
+IF x > 7429 THEN x := x - 1 END;
+IF x > 7430 THEN x := x - 1 END;
+IF x > 7431 THEN x := x - 1 END;
+IF x > 7432 THEN x := x - 1 END;
+IF x > 7433 THEN x := x - 1 END;
+IF x > 7434 THEN x := x - 1 END;
+IF x > 7435 THEN x := x - 1 END;
+IF x > 7436 THEN x := x - 1 END;
+IF x > 7437 THEN x := x - 1 END;
+IF x > 7438 THEN x := x - 1 END;
+IF x > 7439 THEN x := x - 1 END;
+IF x > 7440 THEN x := x - 1 END;
+IF x > 7441 THEN x := x - 1 END;
+IF x > 7442 THEN x := x - 1 END;
+IF x > 7443 THEN x := x - 1 END;
+IF x > 7444 THEN x := x - 1 END;
+IF x > 7445 THEN x := x - 1 END;
+IF x > 7446 THEN x := x - 1 END;
+IF x > 7447 THEN x := x - 1 END;
+IF x > 7448 THEN x := x - 1 END;
+IF x > 7449 THEN x := x - 1 END;
+IF x > 7450 THEN x := x - 1 END;
+IF x > 7451 THEN x := x - 1 END;
+IF x > 7452 THEN x := x - 1 END;
+IF x > 7453 THEN x := x - 1 END;
+IF x > 7454 THEN x := x - 1 END;
+IF x > 7455 THEN x := x - 1 END;
+IF x > 7456 THEN x := x - 1 END;
+IF x > 7457 THEN x := x - 1 END;
+IF x > 7458 THEN x := x - 1 END;
+IF x > 7459 THEN x := x - 1 END;
+IF x > 7460 THEN x := x - 1 END;
+IF x > 7461 THEN x := x - 1 END;
+IF x > 7462 THEN x := x - 1 END;
+IF x > 7463 THEN x := x - 1 END;
+IF x > 7464 THEN x := x - 1 END;
+IF x > 7465 THEN x := x - 1 END;
+IF x > 7466 THEN x := x - 1 END;
+IF x > 7467 THEN x := x - 1 END;
+IF x > 7468 THEN x := x - 1 END;
+IF x > 7469 THEN x := x - 1 END;
+IF x > 7470 THEN x := x - 1 END;
+IF x > 7471 THEN x := x - 1 END;
+IF x > 7472 THEN x := x - 1 END;
+IF x > 7473 THEN x := x - 1 END;
+IF x > 7474 THEN x := x - 1 END;
+IF x > 7475 THEN x := x - 1 END;
+IF x > 7476 THEN x := x - 1 END;
+IF x > 7477 THEN x := x - 1 END;
+IF x > 7478 THEN x := x - 1 END;
+IF x > 7479 THEN x := x - 1 END;
+IF x > 7480 THEN x := x - 1 END;
+IF x > 7481 THEN x := x - 1 END;
+IF x > 7482 THEN x := x - 1 END;
+IF x > 7483 THEN x := x - 1 END;
+IF x > 7484 THEN x := x - 1 END;
+IF x > 7485 THEN x := x - 1 END;
+IF x > 7486 THEN x := x - 1 END;
+IF x > 7487 THEN x := x - 1 END;
+IF x > 7488 THEN x := x - 1 END;
+IF x > 7489 THEN x := x - 1 END;
+IF x > 7490 THEN x := x - 1 END;
+IF x > 7491 THEN x := x - 1 END;
+IF x > 7492 THEN x := x - 1 END;
+IF x > 7493 THEN x := x - 1 END;
+IF x > 7494 THEN x := x - 1 END;
+IF x > 7495 THEN x := x - 1 END;
+IF x > 7496 THEN x := x - 1 END;
+IF x > 7497 THEN x := x - 1 END;
+IF x > 7498 THEN x := x - 1 END;
+IF x > 7499 THEN x := x - 1 END;
+IF x > 7500 THEN x := x - 1 END;
+IF x > 7501 THEN x := x - 1 END;
+IF x > 7502 THEN x := x - 1 END;
+IF x > 7503 THEN x := x - 1 END;
+IF x > 7504 THEN x := x - 1 END;
+IF x > 7505 THEN x := x - 1 END;
+IF x > 7506 THEN x := x - 1 END;
+IF x > 7507 THEN x := x - 1 END;
+IF x > 7508 THEN x := x - 1 END;
+IF x > 7509 THEN x := x - 1 END;
+IF x > 7510 THEN x := x - 1 END;
+IF x > 7511 THEN x := x - 1 END;
+IF x > 7512 THEN x := x - 1 END;
+IF x > 7513 THEN x := x - 1 END;
+IF x > 7514 THEN x := x - 1 END;
+IF x > 7515 THEN x := x - 1 END;
+IF x > 7516 THEN x := x - 1 END;
+IF x > 7517 THEN x := x - 1 END;
+IF x > 7518 THEN x := x - 1 END;
+IF x > 7519 THEN x := x - 1 END;
+IF x > 7520 THEN x := x - 1 END;
+IF x > 7521 THEN x := x - 1 END;
+IF x > 7522 THEN x := x - 1 END;
+IF x > 7523 THEN x := x - 1 END;
+IF x > 7524 THEN x := x - 1 END;
+IF x > 7525 THEN x := x - 1 END;
+IF x > 7526 THEN x := x - 1 END;
+IF x > 7527 THEN x := x - 1 END;
+IF x > 7528 THEN x := x - 1 END;
+IF x > 7529 THEN x := x - 1 END;
+IF x > 7530 THEN x := x - 1 END;
+IF x > 7531 THEN x := x - 1 END;
+IF x > 7532 THEN x := x - 1 END;
+IF x > 7533 THEN x := x - 1 END;
+IF x > 7534 THEN x := x - 1 END;
+IF x > 7535 THEN x := x - 1 END;
+IF x > 7536 THEN x := x - 1 END;
+IF x > 7537 THEN x := x - 1 END;
+IF x > 7538 THEN x := x - 1 END;
+IF x > 7539 THEN x := x - 1 END;
+IF x > 7540 THEN x := x - 1 END;
+IF x > 7541 THEN x := x - 1 END;
+IF x > 7542 THEN x := x - 1 END;
+IF x > 7543 THEN x := x - 1 END;
+IF x > 7544 THEN x := x - 1 END;
+IF x > 7545 THEN x := x - 1 END;
+IF x > 7546 THEN x := x - 1 END;
+IF x > 7547 THEN x := x - 1 END;
+IF x > 7548 THEN x := x - 1 END;
+IF x > 7549 THEN x := x - 1 END;
+IF x > 7550 THEN x := x - 1 END;
+IF x > 7551 THEN x := x - 1 END;
+IF x > 7552 THEN x := x - 1 END;
+IF x > 7553 THEN x := x - 1 END;
+IF x > 7554 THEN x := x - 1 END;
+IF x > 7555 THEN x := x - 1 END;
+IF x > 7556 THEN x := x - 1 END;
+IF x > 7557 THEN x := x - 1 END;
+IF x > 7558 THEN x := x - 1 END;
+IF x > 7559 THEN x := x - 1 END;
+IF x > 7560 THEN x := x - 1 END;
+IF x > 7561 THEN x := x - 1 END;
+IF x > 7562 THEN x := x - 1 END;
+IF x > 7563 THEN x := x - 1 END;
+IF x > 7564 THEN x := x - 1 END;
+IF x > 7565 THEN x := x - 1 END;
+IF x > 7566 THEN x := x - 1 END;
+IF x > 7567 THEN x := x - 1 END;
+IF x > 7568 THEN x := x - 1 END;
+IF x > 7569 THEN x := x - 1 END;
+IF x > 7570 THEN x := x - 1 END;
+IF x > 7571 THEN x := x - 1 END;
+IF x > 7572 THEN x := x - 1 END;
+IF x > 7573 THEN x := x - 1 END;
+IF x > 7574 THEN x := x - 1 END;
+IF x > 7575 THEN x := x - 1 END;
+IF x > 7576 THEN x := x - 1 END;
+IF x > 7577 THEN x := x - 1 END;
+IF x > 7578 THEN x := x - 1 END;
+IF x > 7579 THEN x := x - 1 END;
+IF x > 7580 THEN x := x - 1 END;
+IF x > 7581 THEN x := x - 1 END;
+IF x > 7582 THEN x := x - 1 END;
+IF x > 7583 THEN x := x - 1 END;
+IF x > 7584 THEN x := x - 1 END;
+IF x > 7585 THEN x := x - 1 END;
+IF x > 7586 THEN x := x - 1 END;
+IF x > 7587 THEN x := x - 1 END;
+IF x > 7588 THEN x := x - 1 END;
+IF x > 7589 THEN x := x - 1 END;
+IF x > 7590 THEN x := x - 1 END;
+IF x > 7591 THEN x := x - 1 END;
+IF x > 7592 THEN x := x - 1 END;
+IF x > 7593 THEN x := x - 1 END;
+IF x > 7594 THEN x := x - 1 END;
+IF x > 7595 THEN x := x - 1 END;
+IF x > 7596 THEN x := x - 1 END;
+IF x > 7597 THEN x := x - 1 END;
+IF x > 7598 THEN x := x - 1 END;
+IF x > 7599 THEN x := x - 1 END;
+IF x > 7600 THEN x := x - 1 END;
+IF x > 7601 THEN x := x - 1 END;
+IF x > 7602 THEN x := x - 1 END;
+IF x > 7603 THEN x := x - 1 END;
+IF x > 7604 THEN x := x - 1 END;
+IF x > 7605 THEN x := x - 1 END;
+IF x > 7606 THEN x := x - 1 END;
+IF x > 7607 THEN x := x - 1 END;
+IF x > 7608 THEN x := x - 1 END;
+IF x > 7609 THEN x := x - 1 END;
+IF x > 7610 THEN x := x - 1 END;
+IF x > 7611 THEN x := x - 1 END;
+IF x > 7612 THEN x := x - 1 END;
+IF x > 7613 THEN x := x - 1 END;
+IF x > 7614 THEN x := x - 1 END;
+IF x > 7615 THEN x := x - 1 END;
+IF x > 7616 THEN x := x - 1 END;
+IF x > 7617 THEN x := x - 1 END;
+IF x > 7618 THEN x := x - 1 END;
+IF x > 7619 THEN x := x - 1 END;
+IF x > 7620 THEN x := x - 1 END;
+IF x > 7621 THEN x := x - 1 END;
+IF x > 7622 THEN x := x - 1 END;
+IF x > 7623 THEN x := x - 1 END;
+IF x > 7624 THEN x := x - 1 END;
+IF x > 7625 THEN x := x - 1 END;
+IF x > 7626 THEN x := x - 1 END;
+IF x > 7627 THEN x := x - 1 END;
+IF x > 7628 THEN x := x - 1 END;
+IF x > 7629 THEN x := x - 1 END;
+IF x > 7630 THEN x := x - 1 END;
+IF x > 7631 THEN x := x - 1 END;
+IF x > 7632 THEN x := x - 1 END;
+IF x > 7633 THEN x := x - 1 END;
+IF x > 7634 THEN x := x - 1 END;
+IF x > 7635 THEN x := x - 1 END;
+IF x > 7636 THEN x := x - 1 END;
+IF x > 7637 THEN x := x - 1 END;
+IF x > 7638 THEN x := x - 1 END;
+IF x > 7639 THEN x := x - 1 END;
+IF x > 7640 THEN x := x - 1 END;
+IF x > 7641 THEN x := x - 1 END;
+IF x > 7642 THEN x := x - 1 END;
+IF x > 7643 THEN x := x - 1 END;
+IF x > 7644 THEN x := x - 1 END;
+IF x > 7645 THEN x := x - 1 END;
+IF x > 7646 THEN x := x - 1 END;
+IF x > 7647 THEN x := x - 1 END;
+IF x > 7648 THEN x := x - 1 END;
+IF x > 7649 THEN x := x - 1 END;
+IF x > 7650 THEN x := x - 1 END;
+IF x > 7651 THEN x := x - 1 END;
+IF x > 7652 THEN x := x - 1 END;
+IF x > 7653 THEN x := x - 1 END;
+IF x > 7654 THEN x := x - 1 END;
+IF x > 7655 THEN x := x - 1 END;
+IF x > 7656 THEN x := x - 1 END;
+IF x > 7657 THEN x := x - 1 END;
+IF x > 7658 THEN x := x - 1 END;
+IF x > 7659 THEN x := x - 1 END;
+IF x > 7660 THEN x := x - 1 END;
+IF x > 7661 THEN x := x - 1 END;
+IF x > 7662 THEN x := x - 1 END;
+IF x > 7663 THEN x := x - 1 END;
+IF x > 7664 THEN x := x - 1 END;
+IF x > 7665 THEN x := x - 1 END;
+IF x > 7666 THEN x := x - 1 END;
+IF x > 7667 THEN x := x - 1 END;
+IF x > 7668 THEN x := x - 1 END;
+IF x > 7669 THEN x := x - 1 END;
+IF x > 7670 THEN x := x - 1 END;
+IF x > 7671 THEN x := x - 1 END;
+IF x > 7672 THEN x := x - 1 END;
+IF x > 7673 THEN x := x - 1 END;
+IF x > 7674 THEN x := x - 1 END;
+IF x > 7675 THEN x := x - 1 END;
+IF x > 7676 THEN x := x - 1 END;
+IF x > 7677 THEN x := x - 1 END;
+IF x > 7678 THEN x := x - 1 END;
+IF x > 7679 THEN x := x - 1 END;
+IF x > 7680 THEN x := x - 1 END;
+IF x > 7681 THEN x := x - 1 END;
+IF x > 7682 THEN x := x - 1 END;
+IF x > 7683 THEN x := x - 1 END;
+IF x > 7684 THEN x := x - 1 END;
+IF x > 7685 THEN x := x - 1 END;
+IF x > 7686 THEN x := x - 1 END;
+IF x > 7687 THEN x := x - 1 END;
+IF x > 7688 THEN x := x - 1 END;
+IF x > 7689 THEN x := x - 1 END;
+IF x > 7690 THEN x := x - 1 END;
+IF x > 7691 THEN x := x - 1 END;
+IF x > 7692 THEN x := x - 1 END;
+IF x > 7693 THEN x := x - 1 END;
+IF x > 7694 THEN x := x - 1 END;
+IF x > 7695 THEN x := x - 1 END;
+IF x > 7696 THEN x := x - 1 END;
+IF x > 7697 THEN x := x - 1 END;
+IF x > 7698 THEN x := x - 1 END;
+IF x > 7699 THEN x := x - 1 END;
+IF x > 7700 THEN x := x - 1 END;
+IF x > 7701 THEN x := x - 1 END;
+IF x > 7702 THEN x := x - 1 END;
+IF x > 7703 THEN x := x - 1 END;
+IF x > 7704 THEN x := x - 1 END;
+IF x > 7705 THEN x := x - 1 END;
+IF x > 7706 THEN x := x - 1 END;
+IF x > 7707 THEN x := x - 1 END;
+IF x > 7708 THEN x := x - 1 END;
+IF x > 7709 THEN x := x - 1 END;
+IF x > 7710 THEN x := x - 1 END;
+IF x > 7711 THEN x := x - 1 END;
+IF x > 7712 THEN x := x - 1 END;
+IF x > 7713 THEN x := x - 1 END;
+IF x > 7714 THEN x := x - 1 END;
+IF x > 7715 THEN x := x - 1 END;
+IF x > 7716 THEN x := x - 1 END;
+IF x > 7717 THEN x := x - 1 END;
+IF x > 7718 THEN x := x - 1 END;
+IF x > 7719 THEN x := x - 1 END;
+IF x > 7720 THEN x := x - 1 END;
+IF x > 7721 THEN x := x - 1 END;
+IF x > 7722 THEN x := x - 1 END;
+IF x > 7723 THEN x := x - 1 END;
+IF x > 7724 THEN x := x - 1 END;
+IF x > 7725 THEN x := x - 1 END;
+IF x > 7726 THEN x := x - 1 END;
+IF x > 7727 THEN x := x - 1 END;
+IF x > 7728 THEN x := x - 1 END;
+IF x > 7729 THEN x := x - 1 END;
+IF x > 7730 THEN x := x - 1 END;
+IF x > 7731 THEN x := x - 1 END;
+IF x > 7732 THEN x := x - 1 END;
+IF x > 7733 THEN x := x - 1 END;
+IF x > 7734 THEN x := x - 1 END;
+IF x > 7735 THEN x := x - 1 END;
+IF x > 7736 THEN x := x - 1 END;
+IF x > 7737 THEN x := x - 1 END;
+IF x > 7738 THEN x := x - 1 END;
+IF x > 7739 THEN x := x - 1 END;
+IF x > 7740 THEN x := x - 1 END;
+IF x > 7741 THEN x := x - 1 END;
+IF x > 7742 THEN x := x - 1 END;
+IF x > 7743 THEN x := x - 1 END;
+IF x > 7744 THEN x := x - 1 END;
+IF x > 7745 THEN x := x - 1 END;
+IF x > 7746 THEN x := x - 1 END;
+IF x > 7747 THEN x := x - 1 END;
+IF x > 7748 THEN x := x - 1 END;
+IF x > 7749 THEN x := x - 1 END;
+IF x > 7750 THEN x := x - 1 END;
+IF x > 7751 THEN x := x - 1 END;
+IF x > 7752 THEN x := x - 1 END;
+IF x > 7753 THEN x := x - 1 END;
+IF x > 7754 THEN x := x - 1 END;
+IF x > 7755 THEN x := x - 1 END;
+IF x > 7756 THEN x := x - 1 END;
+IF x > 7757 THEN x := x - 1 END;
+IF x > 7758 THEN x := x - 1 END;
+IF x > 7759 THEN x := x - 1 END;
+IF x > 7760 THEN x := x - 1 END;
+IF x > 7761 THEN x := x - 1 END;
+IF x > 7762 THEN x := x - 1 END;
+IF x > 7763 THEN x := x - 1 END;
+IF x > 7764 THEN x := x - 1 END;
+IF x > 7765 THEN x := x - 1 END;
+IF x > 7766 THEN x := x - 1 END;
+IF x > 7767 THEN x := x - 1 END;
+IF x > 7768 THEN x := x - 1 END;
+IF x > 7769 THEN x := x - 1 END;
+IF x > 7770 THEN x := x - 1 END;
+IF x > 7771 THEN x := x - 1 END;
+IF x > 7772 THEN x := x - 1 END;
+IF x > 7773 THEN x := x - 1 END;
+IF x > 7774 THEN x := x - 1 END;
+IF x > 7775 THEN x := x - 1 END;
+IF x > 7776 THEN x := x - 1 END;
+IF x > 7777 THEN x := x - 1 END;
+IF x > 7778 THEN x := x - 1 END;
+IF x > 7779 THEN x := x - 1 END;
+IF x > 7780 THEN x := x - 1 END;
+IF x > 7781 THEN x := x - 1 END;
+IF x > 7782 THEN x := x - 1 END;
+IF x > 7783 THEN x := x - 1 END;
+IF x > 7784 THEN x := x - 1 END;
+IF x > 7785 THEN x := x - 1 END;
+IF x > 7786 THEN x := x - 1 END;
+IF x > 7787 THEN x := x - 1 END;
+IF x > 7788 THEN x := x - 1 END;
+IF x > 7789 THEN x := x - 1 END;
+IF x > 7790 THEN x := x - 1 END;
+IF x > 7791 THEN x := x - 1 END;
+IF x > 7792 THEN x := x - 1 END;
+IF x > 7793 THEN x := x - 1 END;
+IF x > 7794 THEN x := x - 1 END;
+IF x > 7795 THEN x := x - 1 END;
+IF x > 7796 THEN x := x - 1 END;
+IF x > 7797 THEN x := x - 1 END;
+IF x > 7798 THEN x := x - 1 END;
+IF x > 7799 THEN x := x - 1 END;
+IF x > 7800 THEN x := x - 1 END;
+IF x > 7801 THEN x := x - 1 END;
+IF x > 7802 THEN x := x - 1 END;
+IF x > 7803 THEN x := x - 1 END;
+IF x > 7804 THEN x := x - 1 END;
+IF x > 7805 THEN x := x - 1 END;
+IF x > 7806 THEN x := x - 1 END;
+IF x > 7807 THEN x := x - 1 END;
+IF x > 7808 THEN x := x - 1 END;
+IF x > 7809 THEN x := x - 1 END;
+IF x > 7810 THEN x := x - 1 END;
+IF x > 7811 THEN x := x - 1 END;
+IF x > 7812 THEN x := x - 1 END;
+IF x > 7813 THEN x := x - 1 END;
+IF x > 7814 THEN x := x - 1 END;
+IF x > 7815 THEN x := x - 1 END;
+IF x > 7816 THEN x := x - 1 END;
+IF x > 7817 THEN x := x - 1 END;
+IF x > 7818 THEN x := x - 1 END;
+IF x > 7819 THEN x := x - 1 END;
+IF x > 7820 THEN x := x - 1 END;
+IF x > 7821 THEN x := x - 1 END;
+IF x > 7822 THEN x := x - 1 END;
+IF x > 7823 THEN x := x - 1 END;
+IF x > 7824 THEN x := x - 1 END;
+IF x > 7825 THEN x := x - 1 END;
+IF x > 7826 THEN x := x - 1 END;
+IF x > 7827 THEN x := x - 1 END;
+IF x > 7828 THEN x := x - 1 END;
+IF x > 7829 THEN x := x - 1 END;
+IF x > 7830 THEN x := x - 1 END;
+IF x > 7831 THEN x := x - 1 END;
+IF x > 7832 THEN x := x - 1 END;
+IF x > 7833 THEN x := x - 1 END;
+IF x > 7834 THEN x := x - 1 END;
+IF x > 7835 THEN x := x - 1 END;
+IF x > 7836 THEN x := x - 1 END;
+IF x > 7837 THEN x := x - 1 END;
+IF x > 7838 THEN x := x - 1 END;
+IF x > 7839 THEN x := x - 1 END;
+IF x > 7840 THEN x := x - 1 END;
+IF x > 7841 THEN x := x - 1 END;
+IF x > 7842 THEN x := x - 1 END;
+IF x > 7843 THEN x := x - 1 END;
+IF x > 7844 THEN x := x - 1 END;
+IF x > 7845 THEN x := x - 1 END;
+IF x > 7846 THEN x := x - 1 END;
+IF x > 7847 THEN x := x - 1 END;
+IF x > 7848 THEN x := x - 1 END;
+IF x > 7849 THEN x := x - 1 END;
+IF x > 7850 THEN x := x - 1 END;
+IF x > 7851 THEN x := x - 1 END;
+IF x > 7852 THEN x := x - 1 END;
+IF x > 7853 THEN x := x - 1 END;
+IF x > 7854 THEN x := x - 1 END;
+IF x > 7855 THEN x := x - 1 END;
+IF x > 7856 THEN x := x - 1 END;
+IF x > 7857 THEN x := x - 1 END;
+IF x > 7858 THEN x := x - 1 END;
+IF x > 7859 THEN x := x - 1 END;
+IF x > 7860 THEN x := x - 1 END;
+IF x > 7861 THEN x := x - 1 END;
+IF x > 7862 THEN x := x - 1 END;
+IF x > 7863 THEN x := x - 1 END;
+IF x > 7864 THEN x := x - 1 END;
+IF x > 7865 THEN x := x - 1 END;
+IF x > 7866 THEN x := x - 1 END;
+IF x > 7867 THEN x := x - 1 END;
+IF x > 7868 THEN x := x - 1 END;
+IF x > 7869 THEN x := x - 1 END;
+IF x > 7870 THEN x := x - 1 END;
+IF x > 7871 THEN x := x - 1 END;
+IF x > 7872 THEN x := x - 1 END;
+IF x > 7873 THEN x := x - 1 END;
+IF x > 7874 THEN x := x - 1 END;
+IF x > 7875 THEN x := x - 1 END;
+IF x > 7876 THEN x := x - 1 END;
+IF x > 7877 THEN x := x - 1 END;
+IF x > 7878 THEN x := x - 1 END;
+IF x > 7879 THEN x := x - 1 END;
+IF x > 7880 THEN x := x - 1 END;
+IF x > 7881 THEN x := x - 1 END;
+IF x > 7882 THEN x := x - 1 END;
+IF x > 7883 THEN x := x - 1 END;
+IF x > 7884 THEN x := x - 1 END;
+IF x > 7885 THEN x := x - 1 END;
+IF x > 7886 THEN x := x - 1 END;
+IF x > 7887 THEN x := x - 1 END;
+IF x > 7888 THEN x := x - 1 END;
+IF x > 7889 THEN x := x - 1 END;
+IF x > 7890 THEN x := x - 1 END;
+IF x > 7891 THEN x := x - 1 END;
+IF x > 7892 THEN x := x - 1 END;
+IF x > 7893 THEN x := x - 1 END;
+IF x > 7894 THEN x := x - 1 END;
+IF x > 7895 THEN x := x - 1 END;
+IF x > 7896 THEN x := x - 1 END;
+IF x > 7897 THEN x := x - 1 END;
+IF x > 7898 THEN x := x - 1 END;
+IF x > 7899 THEN x := x - 1 END;
+IF x > 7900 THEN x := x - 1 END;
+IF x > 7901 THEN x := x - 1 END;
+IF x > 7902 THEN x := x - 1 END;
+IF x > 7903 THEN x := x - 1 END;
+IF x > 7904 THEN x := x - 1 END;
+IF x > 7905 THEN x := x - 1 END;
+IF x > 7906 THEN x := x - 1 END;
+IF x > 7907 THEN x := x - 1 END;
+IF x > 7908 THEN x := x - 1 END;
+IF x > 7909 THEN x := x - 1 END;
+IF x > 7910 THEN x := x - 1 END;
+IF x > 7911 THEN x := x - 1 END;
+IF x > 7912 THEN x := x - 1 END;
+IF x > 7913 THEN x := x - 1 END;
+IF x > 7914 THEN x := x - 1 END;
+IF x > 7915 THEN x := x - 1 END;
+IF x > 7916 THEN x := x - 1 END;
+IF x > 7917 THEN x := x - 1 END;
+IF x > 7918 THEN x := x - 1 END;
+IF x > 7919 THEN x := x - 1 END;
+IF x > 7920 THEN x := x - 1 END;
+IF x > 7921 THEN x := x - 1 END;
+IF x > 7922 THEN x := x - 1 END;
+IF x > 7923 THEN x := x - 1 END;
+IF x > 7924 THEN x := x - 1 END;
+IF x > 7925 THEN x := x - 1 END;
+IF x > 7926 THEN x := x - 1 END;
+IF x > 7927 THEN x := x - 1 END;
+IF x > 7928 THEN x := x - 1 END;
+IF x > 7929 THEN x := x - 1 END;
+IF x > 7930 THEN x := x - 1 END;
+IF x > 7931 THEN x := x - 1 END;
+IF x > 7932 THEN x := x - 1 END;
+IF x > 7933 THEN x := x - 1 END;
+IF x > 7934 THEN x := x - 1 END;
+IF x > 7935 THEN x := x - 1 END;
+IF x > 7936 THEN x := x - 1 END;
+IF x > 7937 THEN x := x - 1 END;
+IF x > 7938 THEN x := x - 1 END;
+IF x > 7939 THEN x := x - 1 END;
+IF x > 7940 THEN x := x - 1 END;
+IF x > 7941 THEN x := x - 1 END;
+IF x > 7942 THEN x := x - 1 END;
+IF x > 7943 THEN x := x - 1 END;
+IF x > 7944 THEN x := x - 1 END;
+IF x > 7945 THEN x := x - 1 END;
+IF x > 7946 THEN x := x - 1 END;
+IF x > 7947 THEN x := x - 1 END;
+IF x > 7948 THEN x := x - 1 END;
+IF x > 7949 THEN x := x - 1 END;
+IF x > 7950 THEN x := x - 1 END;
+IF x > 7951 THEN x := x - 1 END;
+IF x > 7952 THEN x := x - 1 END;
+IF x > 7953 THEN x := x - 1 END;
+IF x > 7954 THEN x := x - 1 END;
+IF x > 7955 THEN x := x - 1 END;
+IF x > 7956 THEN x := x - 1 END;
+IF x > 7957 THEN x := x - 1 END;
+IF x > 7958 THEN x := x - 1 END;
+IF x > 7959 THEN x := x - 1 END;
+IF x > 7960 THEN x := x - 1 END;
+IF x > 7961 THEN x := x - 1 END;
+IF x > 7962 THEN x := x - 1 END;
+IF x > 7963 THEN x := x - 1 END;
+IF x > 7964 THEN x := x - 1 END;
+IF x > 7965 THEN x := x - 1 END;
+IF x > 7966 THEN x := x - 1 END;
+IF x > 7967 THEN x := x - 1 END;
+IF x > 7968 THEN x := x - 1 END;
+IF x > 7969 THEN x := x - 1 END;
+IF x > 7970 THEN x := x - 1 END;
+IF x > 7971 THEN x := x - 1 END;
+IF x > 7972 THEN x := x - 1 END;
+IF x > 7973 THEN x := x - 1 END;
+IF x > 7974 THEN x := x - 1 END;
+IF x > 7975 THEN x := x - 1 END;
+IF x > 7976 THEN x := x - 1 END;
+IF x > 7977 THEN x := x - 1 END;
+IF x > 7978 THEN x := x - 1 END;
+IF x > 7979 THEN x := x - 1 END;
+IF x > 7980 THEN x := x - 1 END;
+IF x > 7981 THEN x := x - 1 END;
+IF x > 7982 THEN x := x - 1 END;
+IF x > 7983 THEN x := x - 1 END;
+IF x > 7984 THEN x := x - 1 END;
+IF x > 7985 THEN x := x - 1 END;
+IF x > 7986 THEN x := x - 1 END;
+IF x > 7987 THEN x := x - 1 END;
+IF x > 7988 THEN x := x - 1 END;
+IF x > 7989 THEN x := x - 1 END;
+IF x > 7990 THEN x := x - 1 END;
+IF x > 7991 THEN x := x - 1 END;
+IF x > 7992 THEN x := x - 1 END;
+IF x > 7993 THEN x := x - 1 END;
+IF x > 7994 THEN x := x - 1 END;
+IF x > 7995 THEN x := x - 1 END;
+IF x > 7996 THEN x := x - 1 END;
+IF x > 7997 THEN x := x - 1 END;
+IF x > 7998 THEN x := x - 1 END;
+IF x > 7999 THEN x := x - 1 END;
+IF x > 8000 THEN x := x - 1 END;
+IF x > 8001 THEN x := x - 1 END;
+IF x > 8002 THEN x := x - 1 END;
+IF x > 8003 THEN x := x - 1 END;
+IF x > 8004 THEN x := x - 1 END;
+IF x > 8005 THEN x := x - 1 END;
+IF x > 8006 THEN x := x - 1 END;
+IF x > 8007 THEN x := x - 1 END;
+IF x > 8008 THEN x := x - 1 END;
+IF x > 8009 THEN x := x - 1 END;
+IF x > 8010 THEN x := x - 1 END;
+IF x > 8011 THEN x := x - 1 END;
+IF x > 8012 THEN x := x - 1 END;
+IF x > 8013 THEN x := x - 1 END;
+IF x > 8014 THEN x := x - 1 END;
+IF x > 8015 THEN x := x - 1 END;
+IF x > 8016 THEN x := x - 1 END;
+IF x > 8017 THEN x := x - 1 END;
+IF x > 8018 THEN x := x - 1 END;
+IF x > 8019 THEN x := x - 1 END;
+IF x > 8020 THEN x := x - 1 END;
+IF x > 8021 THEN x := x - 1 END;
+IF x > 8022 THEN x := x - 1 END;
+IF x > 8023 THEN x := x - 1 END;
+IF x > 8024 THEN x := x - 1 END;
+IF x > 8025 THEN x := x - 1 END;
+IF x > 8026 THEN x := x - 1 END;
+IF x > 8027 THEN x := x - 1 END;
+IF x > 8028 THEN x := x - 1 END;
+IF x > 8029 THEN x := x - 1 END;
+IF x > 8030 THEN x := x - 1 END;
+IF x > 8031 THEN x := x - 1 END;
+IF x > 8032 THEN x := x - 1 END;
+IF x > 8033 THEN x := x - 1 END;
+IF x > 8034 THEN x := x - 1 END;
+IF x > 8035 THEN x := x - 1 END;
+IF x > 8036 THEN x := x - 1 END;
+IF x > 8037 THEN x := x - 1 END;
+IF x > 8038 THEN x := x - 1 END;
+IF x > 8039 THEN x := x - 1 END;
+IF x > 8040 THEN x := x - 1 END;
+IF x > 8041 THEN x := x - 1 END;
+IF x > 8042 THEN x := x - 1 END;
+IF x > 8043 THEN x := x - 1 END;
+IF x > 8044 THEN x := x - 1 END;
+IF x > 8045 THEN x := x - 1 END;
+IF x > 8046 THEN x := x - 1 END;
+IF x > 8047 THEN x := x - 1 END;
+IF x > 8048 THEN x := x - 1 END;
+IF x > 8049 THEN x := x - 1 END;
+IF x > 8050 THEN x := x - 1 END;
+IF x > 8051 THEN x := x - 1 END;
+IF x > 8052 THEN x := x - 1 END;
+IF x > 8053 THEN x := x - 1 END;
+IF x > 8054 THEN x := x - 1 END;
+IF x > 8055 THEN x := x - 1 END;
+IF x > 8056 THEN x := x - 1 END;
+IF x > 8057 THEN x := x - 1 END;
+IF x > 8058 THEN x := x - 1 END;
+IF x > 8059 THEN x := x - 1 END;
+IF x > 8060 THEN x := x - 1 END;
+IF x > 8061 THEN x := x - 1 END;
+IF x > 8062 THEN x := x - 1 END;
+IF x > 8063 THEN x := x - 1 END;
+IF x > 8064 THEN x := x - 1 END;
+IF x > 8065 THEN x := x - 1 END;
+IF x > 8066 THEN x := x - 1 END;
+IF x > 8067 THEN x := x - 1 END;
+IF x > 8068 THEN x := x - 1 END;
+IF x > 8069 THEN x := x - 1 END;
+IF x > 8070 THEN x := x - 1 END;
+IF x > 8071 THEN x := x - 1 END;
+IF x > 8072 THEN x := x - 1 END;
+IF x > 8073 THEN x := x - 1 END;
+IF x > 8074 THEN x := x - 1 END;
+IF x > 8075 THEN x := x - 1 END;
+IF x > 8076 THEN x := x - 1 END;
+IF x > 8077 THEN x := x - 1 END;
+IF x > 8078 THEN x := x - 1 END;
+IF x > 8079 THEN x := x - 1 END;
+IF x > 8080 THEN x := x - 1 END;
+IF x > 8081 THEN x := x - 1 END;
+IF x > 8082 THEN x := x - 1 END;
+IF x > 8083 THEN x := x - 1 END;
+IF x > 8084 THEN x := x - 1 END;
+IF x > 8085 THEN x := x - 1 END;
+IF x > 8086 THEN x := x - 1 END;
+IF x > 8087 THEN x := x - 1 END;
+IF x > 8088 THEN x := x - 1 END;
+IF x > 8089 THEN x := x - 1 END;
+IF x > 8090 THEN x := x - 1 END;
+IF x > 8091 THEN x := x - 1 END;
+IF x > 8092 THEN x := x - 1 END;
+IF x > 8093 THEN x := x - 1 END;
+IF x > 8094 THEN x := x - 1 END;
+IF x > 8095 THEN x := x - 1 END;
+IF x > 8096 THEN x := x - 1 END;
+IF x > 8097 THEN x := x - 1 END;
+IF x > 8098 THEN x := x - 1 END;
+IF x > 8099 THEN x := x - 1 END;
+IF x > 8100 THEN x := x - 1 END;
+IF x > 8101 THEN x := x - 1 END;
+IF x > 8102 THEN x := x - 1 END;
+IF x > 8103 THEN x := x - 1 END;
+IF x > 8104 THEN x := x - 1 END;
+IF x > 8105 THEN x := x - 1 END;
+IF x > 8106 THEN x := x - 1 END;
+IF x > 8107 THEN x := x - 1 END;
+IF x > 8108 THEN x := x - 1 END;
+IF x > 8109 THEN x := x - 1 END;
+IF x > 8110 THEN x := x - 1 END;
+IF x > 8111 THEN x := x - 1 END;
+IF x > 8112 THEN x := x - 1 END;
+IF x > 8113 THEN x := x - 1 END;
+IF x > 8114 THEN x := x - 1 END;
+IF x > 8115 THEN x := x - 1 END;
+IF x > 8116 THEN x := x - 1 END;
+IF x > 8117 THEN x := x - 1 END;
+IF x > 8118 THEN x := x - 1 END;
+IF x > 8119 THEN x := x - 1 END;
+IF x > 8120 THEN x := x - 1 END;
+IF x > 8121 THEN x := x - 1 END;
+IF x > 8122 THEN x := x - 1 END;
+IF x > 8123 THEN x := x - 1 END;
+IF x > 8124 THEN x := x - 1 END;
+IF x > 8125 THEN x := x - 1 END;
+IF x > 8126 THEN x := x - 1 END;
+IF x > 8127 THEN x := x - 1 END;
+IF x > 8128 THEN x := x - 1 END;
+IF x > 8129 THEN x := x - 1 END;
+IF x > 8130 THEN x := x - 1 END;
+IF x > 8131 THEN x := x - 1 END;
+IF x > 8132 THEN x := x - 1 END;
+IF x > 8133 THEN x := x - 1 END;
+IF x > 8134 THEN x := x - 1 END;
+IF x > 8135 THEN x := x - 1 END;
+IF x > 8136 THEN x := x - 1 END;
+IF x > 8137 THEN x := x - 1 END;
+IF x > 8138 THEN x := x - 1 END;
+IF x > 8139 THEN x := x - 1 END;
+IF x > 8140 THEN x := x - 1 END;
+IF x > 8141 THEN x := x - 1 END;
+IF x > 8142 THEN x := x - 1 END;
+IF x > 8143 THEN x := x - 1 END;
+IF x > 8144 THEN x := x - 1 END;
+IF x > 8145 THEN x := x - 1 END;
+IF x > 8146 THEN x := x - 1 END;
+IF x > 8147 THEN x := x - 1 END;
+IF x > 8148 THEN x := x - 1 END;
+IF x > 8149 THEN x := x - 1 END;
+IF x > 8150 THEN x := x - 1 END;
+IF x > 8151 THEN x := x - 1 END;
+IF x > 8152 THEN x := x - 1 END;
+IF x > 8153 THEN x := x - 1 END;
+IF x > 8154 THEN x := x - 1 END;
+IF x > 8155 THEN x := x - 1 END;
+IF x > 8156 THEN x := x - 1 END;
+IF x > 8157 THEN x := x - 1 END;
+IF x > 8158 THEN x := x - 1 END;
+IF x > 8159 THEN x := x - 1 END;
+IF x > 8160 THEN x := x - 1 END;
+IF x > 8161 THEN x := x - 1 END;
+IF x > 8162 THEN x := x - 1 END;
+IF x > 8163 THEN x := x - 1 END;
+IF x > 8164 THEN x := x - 1 END;
+IF x > 8165 THEN x := x - 1 END;
+IF x > 8166 THEN x := x - 1 END;
+IF x > 8167 THEN x := x - 1 END;
+IF x > 8168 THEN x := x - 1 END;
+IF x > 8169 THEN x := x - 1 END;
+IF x > 8170 THEN x := x - 1 END;
+IF x > 8171 THEN x := x - 1 END;
+IF x > 8172 THEN x := x - 1 END;
+IF x > 8173 THEN x := x - 1 END;
+IF x > 8174 THEN x := x - 1 END;
+IF x > 8175 THEN x := x - 1 END;
+IF x > 8176 THEN x := x - 1 END;
+IF x > 8177 THEN x := x - 1 END;
+IF x > 8178 THEN x := x - 1 END;
+IF x > 8179 THEN x := x - 1 END;
+IF x > 8180 THEN x := x - 1 END;
+IF x > 8181 THEN x := x - 1 END;
+IF x > 8182 THEN x := x - 1 END;
+IF x > 8183 THEN x := x - 1 END;
+IF x > 8184 THEN x := x - 1 END;
+IF x > 8185 THEN x := x - 1 END;
+IF x > 8186 THEN x := x - 1 END;
+IF x > 8187 THEN x := x - 1 END;
+IF x > 8188 THEN x := x - 1 END;
+IF x > 8189 THEN x := x - 1 END;
+IF x > 8190 THEN x := x - 1 END;
+IF x > 8191 THEN x := x - 1 END;
+IF x > 8192 THEN x := x - 1 END;
+IF x > 8193 THEN x := x - 1 END;
+IF x > 8194 THEN x := x - 1 END;
+IF x > 8195 THEN x := x - 1 END;
+IF x > 8196 THEN x := x - 1 END;
+IF x > 8197 THEN x := x - 1 END;
+IF x > 8198 THEN x := x - 1 END;
+IF x > 8199 THEN x := x - 1 END;
+IF x > 8200 THEN x := x - 1 END;
+IF x > 8201 THEN x := x - 1 END;
+IF x > 8202 THEN x := x - 1 END;
+IF x > 8203 THEN x := x - 1 END;
+IF x > 8204 THEN x := x - 1 END;
+IF x > 8205 THEN x := x - 1 END;
+IF x > 8206 THEN x := x - 1 END;
+IF x > 8207 THEN x := x - 1 END;
+IF x > 8208 THEN x := x - 1 END;
+IF x > 8209 THEN x := x - 1 END;
+IF x > 8210 THEN x := x - 1 END;
+IF x > 8211 THEN x := x - 1 END;
+IF x > 8212 THEN x := x - 1 END;
+IF x > 8213 THEN x := x - 1 END;
+IF x > 8214 THEN x := x - 1 END;
+IF x > 8215 THEN x := x - 1 END;
+IF x > 8216 THEN x := x - 1 END;
+IF x > 8217 THEN x := x - 1 END;
+IF x > 8218 THEN x := x - 1 END;
+IF x > 8219 THEN x := x - 1 END;
+IF x > 8220 THEN x := x - 1 END;
+IF x > 8221 THEN x := x - 1 END;
+IF x > 8222 THEN x := x - 1 END;
+IF x > 8223 THEN x := x - 1 END;
+IF x > 8224 THEN x := x - 1 END;
+IF x > 8225 THEN x := x - 1 END;
+IF x > 8226 THEN x := x - 1 END;
+IF x > 8227 THEN x := x - 1 END;
+IF x > 8228 THEN x := x - 1 END;
+IF x > 8229 THEN x := x - 1 END;
+IF x > 8230 THEN x := x - 1 END;
+IF x > 8231 THEN x := x - 1 END;
+IF x > 8232 THEN x := x - 1 END;
+IF x > 8233 THEN x := x - 1 END;
+IF x > 8234 THEN x := x - 1 END;
+IF x > 8235 THEN x := x - 1 END;
+IF x > 8236 THEN x := x - 1 END;
+IF x > 8237 THEN x := x - 1 END;
+IF x > 8238 THEN x := x - 1 END;
+IF x > 8239 THEN x := x - 1 END;
+IF x > 8240 THEN x := x - 1 END;
+IF x > 8241 THEN x := x - 1 END;
+IF x > 8242 THEN x := x - 1 END;
+IF x > 8243 THEN x := x - 1 END;
+IF x > 8244 THEN x := x - 1 END;
+IF x > 8245 THEN x := x - 1 END;
+IF x > 8246 THEN x := x - 1 END;
+IF x > 8247 THEN x := x - 1 END;
+IF x > 8248 THEN x := x - 1 END;
+IF x > 8249 THEN x := x - 1 END;
+IF x > 8250 THEN x := x - 1 END;
+IF x > 8251 THEN x := x - 1 END;
+IF x > 8252 THEN x := x - 1 END;
+IF x > 8253 THEN x := x - 1 END;
+IF x > 8254 THEN x := x - 1 END;
+IF x > 8255 THEN x := x - 1 END;
+IF x > 8256 THEN x := x - 1 END;
+IF x > 8257 THEN x := x - 1 END;
+IF x > 8258 THEN x := x - 1 END;
+IF x > 8259 THEN x := x - 1 END;
+IF x > 8260 THEN x := x - 1 END;
+IF x > 8261 THEN x := x - 1 END;
+IF x > 8262 THEN x := x - 1 END;
+IF x > 8263 THEN x := x - 1 END;
+IF x > 8264 THEN x := x - 1 END;
+IF x > 8265 THEN x := x - 1 END;
+IF x > 8266 THEN x := x - 1 END;
+IF x > 8267 THEN x := x - 1 END;
+IF x > 8268 THEN x := x - 1 END;
+IF x > 8269 THEN x := x - 1 END;
+IF x > 8270 THEN x := x - 1 END;
+IF x > 8271 THEN x := x - 1 END;
+IF x > 8272 THEN x := x - 1 END;
+IF x > 8273 THEN x := x - 1 END;
+IF x > 8274 THEN x := x - 1 END;
+IF x > 8275 THEN x := x - 1 END;
+IF x > 8276 THEN x := x - 1 END;
+IF x > 8277 THEN x := x - 1 END;
+IF x > 8278 THEN x := x - 1 END;
+IF x > 8279 THEN x := x - 1 END;
+IF x > 8280 THEN x := x - 1 END;
+IF x > 8281 THEN x := x - 1 END;
+IF x > 8282 THEN x := x - 1 END;
+IF x > 8283 THEN x := x - 1 END;
+IF x > 8284 THEN x := x - 1 END;
+IF x > 8285 THEN x := x - 1 END;
+IF x > 8286 THEN x := x - 1 END;
+IF x > 8287 THEN x := x - 1 END;
+IF x > 8288 THEN x := x - 1 END;
+IF x > 8289 THEN x := x - 1 END;
+IF x > 8290 THEN x := x - 1 END;
+IF x > 8291 THEN x := x - 1 END;
+IF x > 8292 THEN x := x - 1 END;
+IF x > 8293 THEN x := x - 1 END;
+IF x > 8294 THEN x := x - 1 END;
+IF x > 8295 THEN x := x - 1 END;
+IF x > 8296 THEN x := x - 1 END;
+IF x > 8297 THEN x := x - 1 END;
+IF x > 8298 THEN x := x - 1 END;
+IF x > 8299 THEN x := x - 1 END;
+IF x > 8300 THEN x := x - 1 END;
+IF x > 8301 THEN x := x - 1 END;
+IF x > 8302 THEN x := x - 1 END;
+IF x > 8303 THEN x := x - 1 END;
+IF x > 8304 THEN x := x - 1 END;
+IF x > 8305 THEN x := x - 1 END;
+IF x > 8306 THEN x := x - 1 END;
+IF x > 8307 THEN x := x - 1 END;
+IF x > 8308 THEN x := x - 1 END;
+IF x > 8309 THEN x := x - 1 END;
+IF x > 8310 THEN x := x - 1 END;
+IF x > 8311 THEN x := x - 1 END;
+IF x > 8312 THEN x := x - 1 END;
+IF x > 8313 THEN x := x - 1 END;
+IF x > 8314 THEN x := x - 1 END;
+IF x > 8315 THEN x := x - 1 END;
+IF x > 8316 THEN x := x - 1 END;
+IF x > 8317 THEN x := x - 1 END;
+IF x > 8318 THEN x := x - 1 END;
+IF x > 8319 THEN x := x - 1 END;
+IF x > 8320 THEN x := x - 1 END;
+IF x > 8321 THEN x := x - 1 END;
+IF x > 8322 THEN x := x - 1 END;
+IF x > 8323 THEN x := x - 1 END;
+IF x > 8324 THEN x := x - 1 END;
+IF x > 8325 THEN x := x - 1 END;
+IF x > 8326 THEN x := x - 1 END;
+IF x > 8327 THEN x := x - 1 END;
+IF x > 8328 THEN x := x - 1 END;
+IF x > 8329 THEN x := x - 1 END;
+IF x > 8330 THEN x := x - 1 END;
+IF x > 8331 THEN x := x - 1 END;
+IF x > 8332 THEN x := x - 1 END;
+IF x > 8333 THEN x := x - 1 END;
+IF x > 8334 THEN x := x - 1 END;
+IF x > 8335 THEN x := x - 1 END;
+IF x > 8336 THEN x := x - 1 END;
+IF x > 8337 THEN x := x - 1 END;
+IF x > 8338 THEN x := x - 1 END;
+IF x > 8339 THEN x := x - 1 END;
+IF x > 8340 THEN x := x - 1 END;
+IF x > 8341 THEN x := x - 1 END;
+IF x > 8342 THEN x := x - 1 END;
+IF x > 8343 THEN x := x - 1 END;
+IF x > 8344 THEN x := x - 1 END;
+IF x > 8345 THEN x := x - 1 END;
+IF x > 8346 THEN x := x - 1 END;
+IF x > 8347 THEN x := x - 1 END;
+IF x > 8348 THEN x := x - 1 END;
+IF x > 8349 THEN x := x - 1 END;
+IF x > 8350 THEN x := x - 1 END;
+IF x > 8351 THEN x := x - 1 END;
+IF x > 8352 THEN x := x - 1 END;
+IF x > 8353 THEN x := x - 1 END;
+IF x > 8354 THEN x := x - 1 END;
+IF x > 8355 THEN x := x - 1 END;
+IF x > 8356 THEN x := x - 1 END;
+IF x > 8357 THEN x := x - 1 END;
+IF x > 8358 THEN x := x - 1 END;
+IF x > 8359 THEN x := x - 1 END;
+IF x > 8360 THEN x := x - 1 END;
+IF x > 8361 THEN x := x - 1 END;
+IF x > 8362 THEN x := x - 1 END;
+IF x > 8363 THEN x := x - 1 END;
+IF x > 8364 THEN x := x - 1 END;
+IF x > 8365 THEN x := x - 1 END;
+IF x > 8366 THEN x := x - 1 END;
+IF x > 8367 THEN x := x - 1 END;
+IF x > 8368 THEN x := x - 1 END;
+IF x > 8369 THEN x := x - 1 END;
+IF x > 8370 THEN x := x - 1 END;
+IF x > 8371 THEN x := x - 1 END;
+IF x > 8372 THEN x := x - 1 END;
+IF x > 8373 THEN x := x - 1 END;
+IF x > 8374 THEN x := x - 1 END;
+IF x > 8375 THEN x := x - 1 END;
+IF x > 8376 THEN x := x - 1 END;
+IF x > 8377 THEN x := x - 1 END;
+IF x > 8378 THEN x := x - 1 END;
+IF x > 8379 THEN x := x - 1 END;
+IF x > 8380 THEN x := x - 1 END;
+IF x > 8381 THEN x := x - 1 END;
+IF x > 8382 THEN x := x - 1 END;
+IF x > 8383 THEN x := x - 1 END;
+IF x > 8384 THEN x := x - 1 END;
+IF x > 8385 THEN x := x - 1 END;
+IF x > 8386 THEN x := x - 1 END;
+IF x > 8387 THEN x := x - 1 END;
+IF x > 8388 THEN x := x - 1 END;
+IF x > 8389 THEN x := x - 1 END;
+IF x > 8390 THEN x := x - 1 END;
+IF x > 8391 THEN x := x - 1 END;
+IF x > 8392 THEN x := x - 1 END;
+IF x > 8393 THEN x := x - 1 END;
+IF x > 8394 THEN x := x - 1 END;
+IF x > 8395 THEN x := x - 1 END;
+IF x > 8396 THEN x := x - 1 END;
+IF x > 8397 THEN x := x - 1 END;
+IF x > 8398 THEN x := x - 1 END;
+IF x > 8399 THEN x := x - 1 END;
+IF x > 8400 THEN x := x - 1 END;
+IF x > 8401 THEN x := x - 1 END;
+IF x > 8402 THEN x := x - 1 END;
+IF x > 8403 THEN x := x - 1 END;
+IF x > 8404 THEN x := x - 1 END;
+IF x > 8405 THEN x := x - 1 END;
+IF x > 8406 THEN x := x - 1 END;
+IF x > 8407 THEN x := x - 1 END;
+IF x > 8408 THEN x := x - 1 END;
+IF x > 8409 THEN x := x - 1 END;
+IF x > 8410 THEN x := x - 1 END;
+IF x > 8411 THEN x := x - 1 END;
+IF x > 8412 THEN x := x - 1 END;
+IF x > 8413 THEN x := x - 1 END;
+IF x > 8414 THEN x := x - 1 END;
+IF x > 8415 THEN x := x - 1 END;
+IF x > 8416 THEN x := x - 1 END;
+IF x > 8417 THEN x := x - 1 END;
+IF x > 8418 THEN x := x - 1 END;
+IF x > 8419 THEN x := x - 1 END;
+IF x > 8420 THEN x := x - 1 END;
+IF x > 8421 THEN x := x - 1 END;
+IF x > 8422 THEN x := x - 1 END;
+IF x > 8423 THEN x := x - 1 END;
+IF x > 8424 THEN x := x - 1 END;
+IF x > 8425 THEN x := x - 1 END;
+IF x > 8426 THEN x := x - 1 END;
+IF x > 8427 THEN x := x - 1 END;
+IF x > 8428 THEN x := x - 1 END;
+IF x > 8429 THEN x := x - 1 END;
+IF x > 8430 THEN x := x - 1 END;
+IF x > 8431 THEN x := x - 1 END;
+IF x > 8432 THEN x := x - 1 END;
+IF x > 8433 THEN x := x - 1 END;
+IF x > 8434 THEN x := x - 1 END;
+IF x > 8435 THEN x := x - 1 END;
+IF x > 8436 THEN x := x - 1 END;
+IF x > 8437 THEN x := x - 1 END;
+IF x > 8438 THEN x := x - 1 END;
+IF x > 8439 THEN x := x - 1 END;
+IF x > 8440 THEN x := x - 1 END;
+IF x > 8441 THEN x := x - 1 END;
+IF x > 8442 THEN x := x - 1 END;
+IF x > 8443 THEN x := x - 1 END;
+IF x > 8444 THEN x := x - 1 END;
+IF x > 8445 THEN x := x - 1 END;
+IF x > 8446 THEN x := x - 1 END;
+IF x > 8447 THEN x := x - 1 END;
+IF x > 8448 THEN x := x - 1 END;
+IF x > 8449 THEN x := x - 1 END;
+IF x > 8450 THEN x := x - 1 END;
+IF x > 8451 THEN x := x - 1 END;
+IF x > 8452 THEN x := x - 1 END;
+IF x > 8453 THEN x := x - 1 END;
+IF x > 8454 THEN x := x - 1 END;
+IF x > 8455 THEN x := x - 1 END;
+IF x > 8456 THEN x := x - 1 END;
+IF x > 8457 THEN x := x - 1 END;
+IF x > 8458 THEN x := x - 1 END;
+IF x > 8459 THEN x := x - 1 END;
+IF x > 8460 THEN x := x - 1 END;
+IF x > 8461 THEN x := x - 1 END;
+IF x > 8462 THEN x := x - 1 END;
+IF x > 8463 THEN x := x - 1 END;
+IF x > 8464 THEN x := x - 1 END;
+IF x > 8465 THEN x := x - 1 END;
+IF x > 8466 THEN x := x - 1 END;
+IF x > 8467 THEN x := x - 1 END;
+IF x > 8468 THEN x := x - 1 END;
+IF x > 8469 THEN x := x - 1 END;
+IF x > 8470 THEN x := x - 1 END;
+IF x > 8471 THEN x := x - 1 END;
+IF x > 8472 THEN x := x - 1 END;
+IF x > 8473 THEN x := x - 1 END;
+IF x > 8474 THEN x := x - 1 END;
+IF x > 8475 THEN x := x - 1 END;
+IF x > 8476 THEN x := x - 1 END;
+IF x > 8477 THEN x := x - 1 END;
+IF x > 8478 THEN x := x - 1 END;
+IF x > 8479 THEN x := x - 1 END;
+IF x > 8480 THEN x := x - 1 END;
+IF x > 8481 THEN x := x - 1 END;
+IF x > 8482 THEN x := x - 1 END;
+IF x > 8483 THEN x := x - 1 END;
+IF x > 8484 THEN x := x - 1 END;
+IF x > 8485 THEN x := x - 1 END;
+IF x > 8486 THEN x := x - 1 END;
+IF x > 8487 THEN x := x - 1 END;
+IF x > 8488 THEN x := x - 1 END;
+IF x > 8489 THEN x := x - 1 END;
+IF x > 8490 THEN x := x - 1 END;
+IF x > 8491 THEN x := x - 1 END;
+IF x > 8492 THEN x := x - 1 END;
+IF x > 8493 THEN x := x - 1 END;
+IF x > 8494 THEN x := x - 1 END;
+IF x > 8495 THEN x := x - 1 END;
+IF x > 8496 THEN x := x - 1 END;
+IF x > 8497 THEN x := x - 1 END;
+IF x > 8498 THEN x := x - 1 END;
+IF x > 8499 THEN x := x - 1 END;
+IF x > 8500 THEN x := x - 1 END;
+IF x > 8501 THEN x := x - 1 END;
+IF x > 8502 THEN x := x - 1 END;
+IF x > 8503 THEN x := x - 1 END;
+IF x > 8504 THEN x := x - 1 END;
+IF x > 8505 THEN x := x - 1 END;
+IF x > 8506 THEN x := x - 1 END;
+IF x > 8507 THEN x := x - 1 END;
+IF x > 8508 THEN x := x - 1 END;
+IF x > 8509 THEN x := x - 1 END;
+IF x > 8510 THEN x := x - 1 END;
+IF x > 8511 THEN x := x - 1 END;
+IF x > 8512 THEN x := x - 1 END;
+IF x > 8513 THEN x := x - 1 END;
+IF x > 8514 THEN x := x - 1 END;
+IF x > 8515 THEN x := x - 1 END;
+IF x > 8516 THEN x := x - 1 END;
+IF x > 8517 THEN x := x - 1 END;
+IF x > 8518 THEN x := x - 1 END;
+IF x > 8519 THEN x := x - 1 END;
+IF x > 8520 THEN x := x - 1 END;
+IF x > 8521 THEN x := x - 1 END;
+IF x > 8522 THEN x := x - 1 END;
+IF x > 8523 THEN x := x - 1 END;
+IF x > 8524 THEN x := x - 1 END;
+IF x > 8525 THEN x := x - 1 END;
+IF x > 8526 THEN x := x - 1 END;
+IF x > 8527 THEN x := x - 1 END;
+IF x > 8528 THEN x := x - 1 END;
+IF x > 8529 THEN x := x - 1 END;
+IF x > 8530 THEN x := x - 1 END;
+IF x > 8531 THEN x := x - 1 END;
+IF x > 8532 THEN x := x - 1 END;
+IF x > 8533 THEN x := x - 1 END;
+IF x > 8534 THEN x := x - 1 END;
+IF x > 8535 THEN x := x - 1 END;
+IF x > 8536 THEN x := x - 1 END;
+IF x > 8537 THEN x := x - 1 END;
+IF x > 8538 THEN x := x - 1 END;
+IF x > 8539 THEN x := x - 1 END;
+IF x > 8540 THEN x := x - 1 END;
+IF x > 8541 THEN x := x - 1 END;
+IF x > 8542 THEN x := x - 1 END;
+IF x > 8543 THEN x := x - 1 END;
+IF x > 8544 THEN x := x - 1 END;
+IF x > 8545 THEN x := x - 1 END;
+IF x > 8546 THEN x := x - 1 END;
+IF x > 8547 THEN x := x - 1 END;
+IF x > 8548 THEN x := x - 1 END;
+IF x > 8549 THEN x := x - 1 END;
+IF x > 8550 THEN x := x - 1 END;
+IF x > 8551 THEN x := x - 1 END;
+IF x > 8552 THEN x := x - 1 END;
+IF x > 8553 THEN x := x - 1 END;
+IF x > 8554 THEN x := x - 1 END;
+IF x > 8555 THEN x := x - 1 END;
+IF x > 8556 THEN x := x - 1 END;
+IF x > 8557 THEN x := x - 1 END;
+IF x > 8558 THEN x := x - 1 END;
+IF x > 8559 THEN x := x - 1 END;
+IF x > 8560 THEN x := x - 1 END;
+IF x > 8561 THEN x := x - 1 END;
+IF x > 8562 THEN x := x - 1 END;
+IF x > 8563 THEN x := x - 1 END;
+IF x > 8564 THEN x := x - 1 END;
+IF x > 8565 THEN x := x - 1 END;
+IF x > 8566 THEN x := x - 1 END;
+IF x > 8567 THEN x := x - 1 END;
+IF x > 8568 THEN x := x - 1 END;
+IF x > 8569 THEN x := x - 1 END;
+IF x > 8570 THEN x := x - 1 END;
+IF x > 8571 THEN x := x - 1 END;
+IF x > 8572 THEN x := x - 1 END;
+IF x > 8573 THEN x := x - 1 END;
+IF x > 8574 THEN x := x - 1 END;
+IF x > 8575 THEN x := x - 1 END;
+IF x > 8576 THEN x := x - 1 END;
+IF x > 8577 THEN x := x - 1 END;
+IF x > 8578 THEN x := x - 1 END;
+IF x > 8579 THEN x := x - 1 END;
+IF x > 8580 THEN x := x - 1 END;
+IF x > 8581 THEN x := x - 1 END;
+IF x > 8582 THEN x := x - 1 END;
+IF x > 8583 THEN x := x - 1 END;
+IF x > 8584 THEN x := x - 1 END;
+IF x > 8585 THEN x := x - 1 END;
+IF x > 8586 THEN x := x - 1 END;
+IF x > 8587 THEN x := x - 1 END;
+IF x > 8588 THEN x := x - 1 END;
+IF x > 8589 THEN x := x - 1 END;
+IF x > 8590 THEN x := x - 1 END;
+IF x > 8591 THEN x := x - 1 END;
+IF x > 8592 THEN x := x - 1 END;
+IF x > 8593 THEN x := x - 1 END;
+IF x > 8594 THEN x := x - 1 END;
+IF x > 8595 THEN x := x - 1 END;
+IF x > 8596 THEN x := x - 1 END;
+IF x > 8597 THEN x := x - 1 END;
+IF x > 8598 THEN x := x - 1 END;
+IF x > 8599 THEN x := x - 1 END;
+IF x > 8600 THEN x := x - 1 END;
+IF x > 8601 THEN x := x - 1 END;
+IF x > 8602 THEN x := x - 1 END;
+IF x > 8603 THEN x := x - 1 END;
+IF x > 8604 THEN x := x - 1 END;
+IF x > 8605 THEN x := x - 1 END;
+IF x > 8606 THEN x := x - 1 END;
+IF x > 8607 THEN x := x - 1 END;
+IF x > 8608 THEN x := x - 1 END;
+IF x > 8609 THEN x := x - 1 END;
+IF x > 8610 THEN x := x - 1 END;
+IF x > 8611 THEN x := x - 1 END;
+IF x > 8612 THEN x := x - 1 END;
+IF x > 8613 THEN x := x - 1 END;
+IF x > 8614 THEN x := x - 1 END;
+IF x > 8615 THEN x := x - 1 END;
+IF x > 8616 THEN x := x - 1 END;
+IF x > 8617 THEN x := x - 1 END;
+IF x > 8618 THEN x := x - 1 END;
+IF x > 8619 THEN x := x - 1 END;
+IF x > 8620 THEN x := x - 1 END;
+IF x > 8621 THEN x := x - 1 END;
+IF x > 8622 THEN x := x - 1 END;
+IF x > 8623 THEN x := x - 1 END;
+IF x > 8624 THEN x := x - 1 END;
+IF x > 8625 THEN x := x - 1 END;
+IF x > 8626 THEN x := x - 1 END;
+IF x > 8627 THEN x := x - 1 END;
+IF x > 8628 THEN x := x - 1 END;
+IF x > 8629 THEN x := x - 1 END;
+IF x > 8630 THEN x := x - 1 END;
+IF x > 8631 THEN x := x - 1 END;
+IF x > 8632 THEN x := x - 1 END;
+IF x > 8633 THEN x := x - 1 END;
+IF x > 8634 THEN x := x - 1 END;
+IF x > 8635 THEN x := x - 1 END;
+IF x > 8636 THEN x := x - 1 END;
+IF x > 8637 THEN x := x - 1 END;
+IF x > 8638 THEN x := x - 1 END;
+IF x > 8639 THEN x := x - 1 END;
+IF x > 8640 THEN x := x - 1 END;
+IF x > 8641 THEN x := x - 1 END;
+IF x > 8642 THEN x := x - 1 END;
+IF x > 8643 THEN x := x - 1 END;
+IF x > 8644 THEN x := x - 1 END;
+IF x > 8645 THEN x := x - 1 END;
+IF x > 8646 THEN x := x - 1 END;
+IF x > 8647 THEN x := x - 1 END;
+IF x > 8648 THEN x := x - 1 END;
+IF x > 8649 THEN x := x - 1 END;
+IF x > 8650 THEN x := x - 1 END;
+IF x > 8651 THEN x := x - 1 END;
+IF x > 8652 THEN x := x - 1 END;
+IF x > 8653 THEN x := x - 1 END;
+IF x > 8654 THEN x := x - 1 END;
+IF x > 8655 THEN x := x - 1 END;
+IF x > 8656 THEN x := x - 1 END;
+IF x > 8657 THEN x := x - 1 END;
+IF x > 8658 THEN x := x - 1 END;
+IF x > 8659 THEN x := x - 1 END;
+IF x > 8660 THEN x := x - 1 END;
+IF x > 8661 THEN x := x - 1 END;
+IF x > 8662 THEN x := x - 1 END;
+IF x > 8663 THEN x := x - 1 END;
+IF x > 8664 THEN x := x - 1 END;
+IF x > 8665 THEN x := x - 1 END;
+IF x > 8666 THEN x := x - 1 END;
+IF x > 8667 THEN x := x - 1 END;
+IF x > 8668 THEN x := x - 1 END;
+IF x > 8669 THEN x := x - 1 END;
+IF x > 8670 THEN x := x - 1 END;
+IF x > 8671 THEN x := x - 1 END;
+IF x > 8672 THEN x := x - 1 END;
+IF x > 8673 THEN x := x - 1 END;
+IF x > 8674 THEN x := x - 1 END;
+IF x > 8675 THEN x := x - 1 END;
+IF x > 8676 THEN x := x - 1 END;
+IF x > 8677 THEN x := x - 1 END;
+IF x > 8678 THEN x := x - 1 END;
+IF x > 8679 THEN x := x - 1 END;
+IF x > 8680 THEN x := x - 1 END;
+IF x > 8681 THEN x := x - 1 END;
+IF x > 8682 THEN x := x - 1 END;
+IF x > 8683 THEN x := x - 1 END;
+IF x > 8684 THEN x := x - 1 END;
+IF x > 8685 THEN x := x - 1 END;
+IF x > 8686 THEN x := x - 1 END;
+IF x > 8687 THEN x := x - 1 END;
+IF x > 8688 THEN x := x - 1 END;
+IF x > 8689 THEN x := x - 1 END;
+IF x > 8690 THEN x := x - 1 END;
+IF x > 8691 THEN x := x - 1 END;
+IF x > 8692 THEN x := x - 1 END;
+IF x > 8693 THEN x := x - 1 END;
+IF x > 8694 THEN x := x - 1 END;
+IF x > 8695 THEN x := x - 1 END;
+IF x > 8696 THEN x := x - 1 END;
+IF x > 8697 THEN x := x - 1 END;
+IF x > 8698 THEN x := x - 1 END;
+IF x > 8699 THEN x := x - 1 END;
+IF x > 8700 THEN x := x - 1 END;
+IF x > 8701 THEN x := x - 1 END;
+IF x > 8702 THEN x := x - 1 END;
+IF x > 8703 THEN x := x - 1 END;
+IF x > 8704 THEN x := x - 1 END;
+IF x > 8705 THEN x := x - 1 END;
+IF x > 8706 THEN x := x - 1 END;
+IF x > 8707 THEN x := x - 1 END;
+IF x > 8708 THEN x := x - 1 END;
+IF x > 8709 THEN x := x - 1 END;
+IF x > 8710 THEN x := x - 1 END;
+IF x > 8711 THEN x := x - 1 END;
+IF x > 8712 THEN x := x - 1 END;
+IF x > 8713 THEN x := x - 1 END;
+IF x > 8714 THEN x := x - 1 END;
+IF x > 8715 THEN x := x - 1 END;
+IF x > 8716 THEN x := x - 1 END;
+IF x > 8717 THEN x := x - 1 END;
+IF x > 8718 THEN x := x - 1 END;
+IF x > 8719 THEN x := x - 1 END;
+IF x > 8720 THEN x := x - 1 END;
+IF x > 8721 THEN x := x - 1 END;
+IF x > 8722 THEN x := x - 1 END;
+IF x > 8723 THEN x := x - 1 END;
+IF x > 8724 THEN x := x - 1 END;
+IF x > 8725 THEN x := x - 1 END;
+IF x > 8726 THEN x := x - 1 END;
+IF x > 8727 THEN x := x - 1 END;
+IF x > 8728 THEN x := x - 1 END;
+IF x > 8729 THEN x := x - 1 END;
+IF x > 8730 THEN x := x - 1 END;
+IF x > 8731 THEN x := x - 1 END;
+IF x > 8732 THEN x := x - 1 END;
+IF x > 8733 THEN x := x - 1 END;
+IF x > 8734 THEN x := x - 1 END;
+IF x > 8735 THEN x := x - 1 END;
+IF x > 8736 THEN x := x - 1 END;
+IF x > 8737 THEN x := x - 1 END;
+IF x > 8738 THEN x := x - 1 END;
+IF x > 8739 THEN x := x - 1 END;
+IF x > 8740 THEN x := x - 1 END;
+IF x > 8741 THEN x := x - 1 END;
+IF x > 8742 THEN x := x - 1 END;
+IF x > 8743 THEN x := x - 1 END;
+IF x > 8744 THEN x := x - 1 END;
+IF x > 8745 THEN x := x - 1 END;
+IF x > 8746 THEN x := x - 1 END;
+IF x > 8747 THEN x := x - 1 END;
+IF x > 8748 THEN x := x - 1 END;
+IF x > 8749 THEN x := x - 1 END;
+IF x > 8750 THEN x := x - 1 END;
+IF x > 8751 THEN x := x - 1 END;
+IF x > 8752 THEN x := x - 1 END;
+IF x > 8753 THEN x := x - 1 END;
+IF x > 8754 THEN x := x - 1 END;
+IF x > 8755 THEN x := x - 1 END;
+IF x > 8756 THEN x := x - 1 END;
+IF x > 8757 THEN x := x - 1 END;
+IF x > 8758 THEN x := x - 1 END;
+IF x > 8759 THEN x := x - 1 END;
+IF x > 8760 THEN x := x - 1 END;
+IF x > 8761 THEN x := x - 1 END;
+IF x > 8762 THEN x := x - 1 END;
+IF x > 8763 THEN x := x - 1 END;
+IF x > 8764 THEN x := x - 1 END;
+IF x > 8765 THEN x := x - 1 END;
+IF x > 8766 THEN x := x - 1 END;
+IF x > 8767 THEN x := x - 1 END;
+IF x > 8768 THEN x := x - 1 END;
+IF x > 8769 THEN x := x - 1 END;
+IF x > 8770 THEN x := x - 1 END;
+IF x > 8771 THEN x := x - 1 END;
+IF x > 8772 THEN x := x - 1 END;
+IF x > 8773 THEN x := x - 1 END;
+IF x > 8774 THEN x := x - 1 END;
+IF x > 8775 THEN x := x - 1 END;
+IF x > 8776 THEN x := x - 1 END;
+IF x > 8777 THEN x := x - 1 END;
+IF x > 8778 THEN x := x - 1 END;
+IF x > 8779 THEN x := x - 1 END;
+IF x > 8780 THEN x := x - 1 END;
+IF x > 8781 THEN x := x - 1 END;
+IF x > 8782 THEN x := x - 1 END;
+IF x > 8783 THEN x := x - 1 END;
+IF x > 8784 THEN x := x - 1 END;
+IF x > 8785 THEN x := x - 1 END;
+IF x > 8786 THEN x := x - 1 END;
+IF x > 8787 THEN x := x - 1 END;
+IF x > 8788 THEN x := x - 1 END;
+IF x > 8789 THEN x := x - 1 END;
+IF x > 8790 THEN x := x - 1 END;
+IF x > 8791 THEN x := x - 1 END;
+IF x > 8792 THEN x := x - 1 END;
+IF x > 8793 THEN x := x - 1 END;
+IF x > 8794 THEN x := x - 1 END;
+IF x > 8795 THEN x := x - 1 END;
+IF x > 8796 THEN x := x - 1 END;
+IF x > 8797 THEN x := x - 1 END;
+IF x > 8798 THEN x := x - 1 END;
+IF x > 8799 THEN x := x - 1 END;
+IF x > 8800 THEN x := x - 1 END;
+IF x > 8801 THEN x := x - 1 END;
+IF x > 8802 THEN x := x - 1 END;
+IF x > 8803 THEN x := x - 1 END;
+IF x > 8804 THEN x := x - 1 END;
+IF x > 8805 THEN x := x - 1 END;
+IF x > 8806 THEN x := x - 1 END;
+IF x > 8807 THEN x := x - 1 END;
+IF x > 8808 THEN x := x - 1 END;
+IF x > 8809 THEN x := x - 1 END;
+IF x > 8810 THEN x := x - 1 END;
+IF x > 8811 THEN x := x - 1 END;
+IF x > 8812 THEN x := x - 1 END;
+IF x > 8813 THEN x := x - 1 END;
+IF x > 8814 THEN x := x - 1 END;
+IF x > 8815 THEN x := x - 1 END;
+IF x > 8816 THEN x := x - 1 END;
+IF x > 8817 THEN x := x - 1 END;
+IF x > 8818 THEN x := x - 1 END;
+IF x > 8819 THEN x := x - 1 END;
+IF x > 8820 THEN x := x - 1 END;
+IF x > 8821 THEN x := x - 1 END;
+IF x > 8822 THEN x := x - 1 END;
+IF x > 8823 THEN x := x - 1 END;
+IF x > 8824 THEN x := x - 1 END;
+IF x > 8825 THEN x := x - 1 END;
+IF x > 8826 THEN x := x - 1 END;
+IF x > 8827 THEN x := x - 1 END;
+IF x > 8828 THEN x := x - 1 END;
+IF x > 8829 THEN x := x - 1 END;
+IF x > 8830 THEN x := x - 1 END;
+IF x > 8831 THEN x := x - 1 END;
+IF x > 8832 THEN x := x - 1 END;
+IF x > 8833 THEN x := x - 1 END;
+IF x > 8834 THEN x := x - 1 END;
+IF x > 8835 THEN x := x - 1 END;
+IF x > 8836 THEN x := x - 1 END;
+IF x > 8837 THEN x := x - 1 END;
+IF x > 8838 THEN x := x - 1 END;
+IF x > 8839 THEN x := x - 1 END;
+IF x > 8840 THEN x := x - 1 END;
+IF x > 8841 THEN x := x - 1 END;
+IF x > 8842 THEN x := x - 1 END;
+IF x > 8843 THEN x := x - 1 END;
+IF x > 8844 THEN x := x - 1 END;
+IF x > 8845 THEN x := x - 1 END;
+IF x > 8846 THEN x := x - 1 END;
+IF x > 8847 THEN x := x - 1 END;
+IF x > 8848 THEN x := x - 1 END;
+IF x > 8849 THEN x := x - 1 END;
+IF x > 8850 THEN x := x - 1 END;
+IF x > 8851 THEN x := x - 1 END;
+IF x > 8852 THEN x := x - 1 END;
+IF x > 8853 THEN x := x - 1 END;
+IF x > 8854 THEN x := x - 1 END;
+IF x > 8855 THEN x := x - 1 END;
+IF x > 8856 THEN x := x - 1 END;
+IF x > 8857 THEN x := x - 1 END;
+IF x > 8858 THEN x := x - 1 END;
+IF x > 8859 THEN x := x - 1 END;
+IF x > 8860 THEN x := x - 1 END;
+IF x > 8861 THEN x := x - 1 END;
+IF x > 8862 THEN x := x - 1 END;
+IF x > 8863 THEN x := x - 1 END;
+IF x > 8864 THEN x := x - 1 END;
+IF x > 8865 THEN x := x - 1 END;
+IF x > 8866 THEN x := x - 1 END;
+IF x > 8867 THEN x := x - 1 END;
+IF x > 8868 THEN x := x - 1 END;
+IF x > 8869 THEN x := x - 1 END;
+IF x > 8870 THEN x := x - 1 END;
+IF x > 8871 THEN x := x - 1 END;
+IF x > 8872 THEN x := x - 1 END;
+IF x > 8873 THEN x := x - 1 END;
+IF x > 8874 THEN x := x - 1 END;
+IF x > 8875 THEN x := x - 1 END;
+IF x > 8876 THEN x := x - 1 END;
+IF x > 8877 THEN x := x - 1 END;
+IF x > 8878 THEN x := x - 1 END;
+IF x > 8879 THEN x := x - 1 END;
+IF x > 8880 THEN x := x - 1 END;
+IF x > 8881 THEN x := x - 1 END;
+IF x > 8882 THEN x := x - 1 END;
+IF x > 8883 THEN x := x - 1 END;
+IF x > 8884 THEN x := x - 1 END;
+IF x > 8885 THEN x := x - 1 END;
+IF x > 8886 THEN x := x - 1 END;
+IF x > 8887 THEN x := x - 1 END;
+IF x > 8888 THEN x := x - 1 END;
+IF x > 8889 THEN x := x - 1 END;
+IF x > 8890 THEN x := x - 1 END;
+IF x > 8891 THEN x := x - 1 END;
+IF x > 8892 THEN x := x - 1 END;
+IF x > 8893 THEN x := x - 1 END;
+IF x > 8894 THEN x := x - 1 END;
+IF x > 8895 THEN x := x - 1 END;
+IF x > 8896 THEN x := x - 1 END;
+IF x > 8897 THEN x := x - 1 END;
+IF x > 8898 THEN x := x - 1 END;
+IF x > 8899 THEN x := x - 1 END;
+IF x > 8900 THEN x := x - 1 END;
+IF x > 8901 THEN x := x - 1 END;
+IF x > 8902 THEN x := x - 1 END;
+IF x > 8903 THEN x := x - 1 END;
+IF x > 8904 THEN x := x - 1 END;
+IF x > 8905 THEN x := x - 1 END;
+IF x > 8906 THEN x := x - 1 END;
+IF x > 8907 THEN x := x - 1 END;
+IF x > 8908 THEN x := x - 1 END;
+IF x > 8909 THEN x := x - 1 END;
+IF x > 8910 THEN x := x - 1 END;
+IF x > 8911 THEN x := x - 1 END;
+IF x > 8912 THEN x := x - 1 END;
+IF x > 8913 THEN x := x - 1 END;
+IF x > 8914 THEN x := x - 1 END;
+IF x > 8915 THEN x := x - 1 END;
+IF x > 8916 THEN x := x - 1 END;
+IF x > 8917 THEN x := x - 1 END;
+IF x > 8918 THEN x := x - 1 END;
+IF x > 8919 THEN x := x - 1 END;
+IF x > 8920 THEN x := x - 1 END;
+IF x > 8921 THEN x := x - 1 END;
+IF x > 8922 THEN x := x - 1 END;
+IF x > 8923 THEN x := x - 1 END;
+IF x > 8924 THEN x := x - 1 END;
+IF x > 8925 THEN x := x - 1 END;
+IF x > 8926 THEN x := x - 1 END;
+IF x > 8927 THEN x := x - 1 END;
+IF x > 8928 THEN x := x - 1 END;
+IF x > 8929 THEN x := x - 1 END;
+IF x > 8930 THEN x := x - 1 END;
+IF x > 8931 THEN x := x - 1 END;
+IF x > 8932 THEN x := x - 1 END;
+IF x > 8933 THEN x := x - 1 END;
+IF x > 8934 THEN x := x - 1 END;
+IF x > 8935 THEN x := x - 1 END;
+IF x > 8936 THEN x := x - 1 END;
+IF x > 8937 THEN x := x - 1 END;
+IF x > 8938 THEN x := x - 1 END;
+IF x > 8939 THEN x := x - 1 END;
+IF x > 8940 THEN x := x - 1 END;
+IF x > 8941 THEN x := x - 1 END;
+IF x > 8942 THEN x := x - 1 END;
+IF x > 8943 THEN x := x - 1 END;
+IF x > 8944 THEN x := x - 1 END;
+IF x > 8945 THEN x := x - 1 END;
+IF x > 8946 THEN x := x - 1 END;
+IF x > 8947 THEN x := x - 1 END;
+IF x > 8948 THEN x := x - 1 END;
+IF x > 8949 THEN x := x - 1 END;
+IF x > 8950 THEN x := x - 1 END;
+IF x > 8951 THEN x := x - 1 END;
+IF x > 8952 THEN x := x - 1 END;
+IF x > 8953 THEN x := x - 1 END;
+IF x > 8954 THEN x := x - 1 END;
+IF x > 8955 THEN x := x - 1 END;
+IF x > 8956 THEN x := x - 1 END;
+IF x > 8957 THEN x := x - 1 END;
+IF x > 8958 THEN x := x - 1 END;
+IF x > 8959 THEN x := x - 1 END;
+IF x > 8960 THEN x := x - 1 END;
+IF x > 8961 THEN x := x - 1 END;
+IF x > 8962 THEN x := x - 1 END;
+IF x > 8963 THEN x := x - 1 END;
+IF x > 8964 THEN x := x - 1 END;
+IF x > 8965 THEN x := x - 1 END;
+IF x > 8966 THEN x := x - 1 END;
+IF x > 8967 THEN x := x - 1 END;
+IF x > 8968 THEN x := x - 1 END;
+IF x > 8969 THEN x := x - 1 END;
+IF x > 8970 THEN x := x - 1 END;
+IF x > 8971 THEN x := x - 1 END;
+IF x > 8972 THEN x := x - 1 END;
+IF x > 8973 THEN x := x - 1 END;
+IF x > 8974 THEN x := x - 1 END;
+IF x > 8975 THEN x := x - 1 END;
+IF x > 8976 THEN x := x - 1 END;
+IF x > 8977 THEN x := x - 1 END;
+IF x > 8978 THEN x := x - 1 END;
+IF x > 8979 THEN x := x - 1 END;
+IF x > 8980 THEN x := x - 1 END;
+IF x > 8981 THEN x := x - 1 END;
+IF x > 8982 THEN x := x - 1 END;
+IF x > 8983 THEN x := x - 1 END;
+IF x > 8984 THEN x := x - 1 END;
+IF x > 8985 THEN x := x - 1 END;
+IF x > 8986 THEN x := x - 1 END;
+IF x > 8987 THEN x := x - 1 END;
+IF x > 8988 THEN x := x - 1 END;
+IF x > 8989 THEN x := x - 1 END;
+IF x > 8990 THEN x := x - 1 END;
+IF x > 8991 THEN x := x - 1 END;
+IF x > 8992 THEN x := x - 1 END;
+IF x > 8993 THEN x := x - 1 END;
+IF x > 8994 THEN x := x - 1 END;
+IF x > 8995 THEN x := x - 1 END;
+IF x > 8996 THEN x := x - 1 END;
+IF x > 8997 THEN x := x - 1 END;
+IF x > 8998 THEN x := x - 1 END;
+IF x > 8999 THEN x := x - 1 END;
+IF x > 9000 THEN x := x - 1 END;
+IF x > 9001 THEN x := x - 1 END;
+IF x > 9002 THEN x := x - 1 END;
+IF x > 9003 THEN x := x - 1 END;
+IF x > 9004 THEN x := x - 1 END;
+IF x > 9005 THEN x := x - 1 END;
+IF x > 9006 THEN x := x - 1 END;
+IF x > 9007 THEN x := x - 1 END;
+IF x > 9008 THEN x := x - 1 END;
+IF x > 9009 THEN x := x - 1 END;
+IF x > 9010 THEN x := x - 1 END;
+IF x > 9011 THEN x := x - 1 END;
+IF x > 9012 THEN x := x - 1 END;
+IF x > 9013 THEN x := x - 1 END;
+IF x > 9014 THEN x := x - 1 END;
+IF x > 9015 THEN x := x - 1 END;
+IF x > 9016 THEN x := x - 1 END;
+IF x > 9017 THEN x := x - 1 END;
+IF x > 9018 THEN x := x - 1 END;
+IF x > 9019 THEN x := x - 1 END;
+IF x > 9020 THEN x := x - 1 END;
+IF x > 9021 THEN x := x - 1 END;
+IF x > 9022 THEN x := x - 1 END;
+IF x > 9023 THEN x := x - 1 END;
+IF x > 9024 THEN x := x - 1 END;
+IF x > 9025 THEN x := x - 1 END;
+IF x > 9026 THEN x := x - 1 END;
+IF x > 9027 THEN x := x - 1 END;
+IF x > 9028 THEN x := x - 1 END;
+IF x > 9029 THEN x := x - 1 END;
+IF x > 9030 THEN x := x - 1 END;
+IF x > 9031 THEN x := x - 1 END;
+IF x > 9032 THEN x := x - 1 END;
+IF x > 9033 THEN x := x - 1 END;
+IF x > 9034 THEN x := x - 1 END;
+IF x > 9035 THEN x := x - 1 END;
+IF x > 9036 THEN x := x - 1 END;
+IF x > 9037 THEN x := x - 1 END;
+IF x > 9038 THEN x := x - 1 END;
+IF x > 9039 THEN x := x - 1 END;
+IF x > 9040 THEN x := x - 1 END;
+IF x > 9041 THEN x := x - 1 END;
+IF x > 9042 THEN x := x - 1 END;
+IF x > 9043 THEN x := x - 1 END;
+IF x > 9044 THEN x := x - 1 END;
+IF x > 9045 THEN x := x - 1 END;
+IF x > 9046 THEN x := x - 1 END;
+IF x > 9047 THEN x := x - 1 END;
+IF x > 9048 THEN x := x - 1 END;
+IF x > 9049 THEN x := x - 1 END;
+IF x > 9050 THEN x := x - 1 END;
+IF x > 9051 THEN x := x - 1 END;
+IF x > 9052 THEN x := x - 1 END;
+IF x > 9053 THEN x := x - 1 END;
+IF x > 9054 THEN x := x - 1 END;
+IF x > 9055 THEN x := x - 1 END;
+IF x > 9056 THEN x := x - 1 END;
+IF x > 9057 THEN x := x - 1 END;
+IF x > 9058 THEN x := x - 1 END;
+IF x > 9059 THEN x := x - 1 END;
+IF x > 9060 THEN x := x - 1 END;
+IF x > 9061 THEN x := x - 1 END;
+IF x > 9062 THEN x := x - 1 END;
+IF x > 9063 THEN x := x - 1 END;
+IF x > 9064 THEN x := x - 1 END;
+IF x > 9065 THEN x := x - 1 END;
+IF x > 9066 THEN x := x - 1 END;
+IF x > 9067 THEN x := x - 1 END;
+IF x > 9068 THEN x := x - 1 END;
+IF x > 9069 THEN x := x - 1 END;
+IF x > 9070 THEN x := x - 1 END;
+IF x > 9071 THEN x := x - 1 END;
+IF x > 9072 THEN x := x - 1 END;
+IF x > 9073 THEN x := x - 1 END;
+IF x > 9074 THEN x := x - 1 END;
+IF x > 9075 THEN x := x - 1 END;
+IF x > 9076 THEN x := x - 1 END;
+IF x > 9077 THEN x := x - 1 END;
+IF x > 9078 THEN x := x - 1 END;
+IF x > 9079 THEN x := x - 1 END;
+IF x > 9080 THEN x := x - 1 END;
+IF x > 9081 THEN x := x - 1 END;
+IF x > 9082 THEN x := x - 1 END;
+IF x > 9083 THEN x := x - 1 END;
+IF x > 9084 THEN x := x - 1 END;
+IF x > 9085 THEN x := x - 1 END;
+IF x > 9086 THEN x := x - 1 END;
+IF x > 9087 THEN x := x - 1 END;
+IF x > 9088 THEN x := x - 1 END;
+IF x > 9089 THEN x := x - 1 END;
+IF x > 9090 THEN x := x - 1 END;
+IF x > 9091 THEN x := x - 1 END;
+IF x > 9092 THEN x := x - 1 END;
+IF x > 9093 THEN x := x - 1 END;
+IF x > 9094 THEN x := x - 1 END;
+IF x > 9095 THEN x := x - 1 END;
+IF x > 9096 THEN x := x - 1 END;
+IF x > 9097 THEN x := x - 1 END;
+IF x > 9098 THEN x := x - 1 END;
+IF x > 9099 THEN x := x - 1 END;
+IF x > 9100 THEN x := x - 1 END;
+IF x > 9101 THEN x := x - 1 END;
+IF x > 9102 THEN x := x - 1 END;
+IF x > 9103 THEN x := x - 1 END;
+IF x > 9104 THEN x := x - 1 END;
+IF x > 9105 THEN x := x - 1 END;
+IF x > 9106 THEN x := x - 1 END;
+IF x > 9107 THEN x := x - 1 END;
+IF x > 9108 THEN x := x - 1 END;
+IF x > 9109 THEN x := x - 1 END;
+IF x > 9110 THEN x := x - 1 END;
+IF x > 9111 THEN x := x - 1 END;
+IF x > 9112 THEN x := x - 1 END;
+IF x > 9113 THEN x := x - 1 END;
+IF x > 9114 THEN x := x - 1 END;
+IF x > 9115 THEN x := x - 1 END;
+IF x > 9116 THEN x := x - 1 END;
+IF x > 9117 THEN x := x - 1 END;
+IF x > 9118 THEN x := x - 1 END;
+IF x > 9119 THEN x := x - 1 END;
+IF x > 9120 THEN x := x - 1 END;
+IF x > 9121 THEN x := x - 1 END;
+IF x > 9122 THEN x := x - 1 END;
+IF x > 9123 THEN x := x - 1 END;
+IF x > 9124 THEN x := x - 1 END;
+IF x > 9125 THEN x := x - 1 END;
+IF x > 9126 THEN x := x - 1 END;
+IF x > 9127 THEN x := x - 1 END;
+IF x > 9128 THEN x := x - 1 END;
+IF x > 9129 THEN x := x - 1 END;
+IF x > 9130 THEN x := x - 1 END;
+IF x > 9131 THEN x := x - 1 END;
+IF x > 9132 THEN x := x - 1 END;
+IF x > 9133 THEN x := x - 1 END;
+IF x > 9134 THEN x := x - 1 END;
+IF x > 9135 THEN x := x - 1 END;
+IF x > 9136 THEN x := x - 1 END;
+IF x > 9137 THEN x := x - 1 END;
+IF x > 9138 THEN x := x - 1 END;
+IF x > 9139 THEN x := x - 1 END;
+IF x > 9140 THEN x := x - 1 END;
+IF x > 9141 THEN x := x - 1 END;
+IF x > 9142 THEN x := x - 1 END;
+IF x > 9143 THEN x := x - 1 END;
+IF x > 9144 THEN x := x - 1 END;
+IF x > 9145 THEN x := x - 1 END;
+IF x > 9146 THEN x := x - 1 END;
+IF x > 9147 THEN x := x - 1 END;
+IF x > 9148 THEN x := x - 1 END;
+IF x > 9149 THEN x := x - 1 END;
+IF x > 9150 THEN x := x - 1 END;
+IF x > 9151 THEN x := x - 1 END;
+IF x > 9152 THEN x := x - 1 END;
+IF x > 9153 THEN x := x - 1 END;
+IF x > 9154 THEN x := x - 1 END;
+IF x > 9155 THEN x := x - 1 END;
+IF x > 9156 THEN x := x - 1 END;
+IF x > 9157 THEN x := x - 1 END;
+IF x > 9158 THEN x := x - 1 END;
+IF x > 9159 THEN x := x - 1 END;
+IF x > 9160 THEN x := x - 1 END;
+IF x > 9161 THEN x := x - 1 END;
+IF x > 9162 THEN x := x - 1 END;
+IF x > 9163 THEN x := x - 1 END;
+IF x > 9164 THEN x := x - 1 END;
+IF x > 9165 THEN x := x - 1 END;
+IF x > 9166 THEN x := x - 1 END;
+IF x > 9167 THEN x := x - 1 END;
+IF x > 9168 THEN x := x - 1 END;
+IF x > 9169 THEN x := x - 1 END;
+IF x > 9170 THEN x := x - 1 END;
+IF x > 9171 THEN x := x - 1 END;
+IF x > 9172 THEN x := x - 1 END;
+IF x > 9173 THEN x := x - 1 END;
+IF x > 9174 THEN x := x - 1 END;
+IF x > 9175 THEN x := x - 1 END;
+IF x > 9176 THEN x := x - 1 END;
+IF x > 9177 THEN x := x - 1 END;
+IF x > 9178 THEN x := x - 1 END;
+IF x > 9179 THEN x := x - 1 END;
+IF x > 9180 THEN x := x - 1 END;
+IF x > 9181 THEN x := x - 1 END;
+IF x > 9182 THEN x := x - 1 END;
+IF x > 9183 THEN x := x - 1 END;
+IF x > 9184 THEN x := x - 1 END;
+IF x > 9185 THEN x := x - 1 END;
+IF x > 9186 THEN x := x - 1 END;
+IF x > 9187 THEN x := x - 1 END;
+IF x > 9188 THEN x := x - 1 END;
+IF x > 9189 THEN x := x - 1 END;
+IF x > 9190 THEN x := x - 1 END;
+IF x > 9191 THEN x := x - 1 END;
+IF x > 9192 THEN x := x - 1 END;
+IF x > 9193 THEN x := x - 1 END;
+IF x > 9194 THEN x := x - 1 END;
+IF x > 9195 THEN x := x - 1 END;
+IF x > 9196 THEN x := x - 1 END;
+IF x > 9197 THEN x := x - 1 END;
+IF x > 9198 THEN x := x - 1 END;
+IF x > 9199 THEN x := x - 1 END;
+IF x > 9200 THEN x := x - 1 END;
+IF x > 9201 THEN x := x - 1 END;
+IF x > 9202 THEN x := x - 1 END;
+IF x > 9203 THEN x := x - 1 END;
+IF x > 9204 THEN x := x - 1 END;
+IF x > 9205 THEN x := x - 1 END;
+IF x > 9206 THEN x := x - 1 END;
+IF x > 9207 THEN x := x - 1 END;
+IF x > 9208 THEN x := x - 1 END;
+IF x > 9209 THEN x := x - 1 END;
+IF x > 9210 THEN x := x - 1 END;
+IF x > 9211 THEN x := x - 1 END;
+IF x > 9212 THEN x := x - 1 END;
+IF x > 9213 THEN x := x - 1 END;
+IF x > 9214 THEN x := x - 1 END;
+IF x > 9215 THEN x := x - 1 END;
+IF x > 9216 THEN x := x - 1 END;
+IF x > 9217 THEN x := x - 1 END;
+IF x > 9218 THEN x := x - 1 END;
+IF x > 9219 THEN x := x - 1 END;
+IF x > 9220 THEN x := x - 1 END;
+IF x > 9221 THEN x := x - 1 END;
+IF x > 9222 THEN x := x - 1 END;
+IF x > 9223 THEN x := x - 1 END;
+IF x > 9224 THEN x := x - 1 END;
+IF x > 9225 THEN x := x - 1 END;
+IF x > 9226 THEN x := x - 1 END;
+IF x > 9227 THEN x := x - 1 END;
+IF x > 9228 THEN x := x - 1 END;
+IF x > 9229 THEN x := x - 1 END;
+IF x > 9230 THEN x := x - 1 END;
+IF x > 9231 THEN x := x - 1 END;
+IF x > 9232 THEN x := x - 1 END;
+IF x > 9233 THEN x := x - 1 END;
+IF x > 9234 THEN x := x - 1 END;
+IF x > 9235 THEN x := x - 1 END;
+IF x > 9236 THEN x := x - 1 END;
+IF x > 9237 THEN x := x - 1 END;
+IF x > 9238 THEN x := x - 1 END;
+IF x > 9239 THEN x := x - 1 END;
+IF x > 9240 THEN x := x - 1 END;
+IF x > 9241 THEN x := x - 1 END;
+IF x > 9242 THEN x := x - 1 END;
+IF x > 9243 THEN x := x - 1 END;
+IF x > 9244 THEN x := x - 1 END;
+IF x > 9245 THEN x := x - 1 END;
+IF x > 9246 THEN x := x - 1 END;
+IF x > 9247 THEN x := x - 1 END;
+IF x > 9248 THEN x := x - 1 END;
+IF x > 9249 THEN x := x - 1 END;
+IF x > 9250 THEN x := x - 1 END;
+IF x > 9251 THEN x := x - 1 END;
+IF x > 9252 THEN x := x - 1 END;
+IF x > 9253 THEN x := x - 1 END;
+IF x > 9254 THEN x := x - 1 END;
+IF x > 9255 THEN x := x - 1 END;
+IF x > 9256 THEN x := x - 1 END;
+IF x > 9257 THEN x := x - 1 END;
+IF x > 9258 THEN x := x - 1 END;
+IF x > 9259 THEN x := x - 1 END;
+IF x > 9260 THEN x := x - 1 END;
+IF x > 9261 THEN x := x - 1 END;
+IF x > 9262 THEN x := x - 1 END;
+IF x > 9263 THEN x := x - 1 END;
+IF x > 9264 THEN x := x - 1 END;
+IF x > 9265 THEN x := x - 1 END;
+IF x > 9266 THEN x := x - 1 END;
+IF x > 9267 THEN x := x - 1 END;
+IF x > 9268 THEN x := x - 1 END;
+IF x > 9269 THEN x := x - 1 END;
+IF x > 9270 THEN x := x - 1 END;
+IF x > 9271 THEN x := x - 1 END;
+IF x > 9272 THEN x := x - 1 END;
+IF x > 9273 THEN x := x - 1 END;
+IF x > 9274 THEN x := x - 1 END;
+IF x > 9275 THEN x := x - 1 END;
+IF x > 9276 THEN x := x - 1 END;
+IF x > 9277 THEN x := x - 1 END;
+IF x > 9278 THEN x := x - 1 END;
+IF x > 9279 THEN x := x - 1 END;
+IF x > 9280 THEN x := x - 1 END;
+IF x > 9281 THEN x := x - 1 END;
+IF x > 9282 THEN x := x - 1 END;
+IF x > 9283 THEN x := x - 1 END;
+IF x > 9284 THEN x := x - 1 END;
+IF x > 9285 THEN x := x - 1 END;
+IF x > 9286 THEN x := x - 1 END;
+IF x > 9287 THEN x := x - 1 END;
+IF x > 9288 THEN x := x - 1 END;
+IF x > 9289 THEN x := x - 1 END;
+IF x > 9290 THEN x := x - 1 END;
+IF x > 9291 THEN x := x - 1 END;
+IF x > 9292 THEN x := x - 1 END;
+IF x > 9293 THEN x := x - 1 END;
+IF x > 9294 THEN x := x - 1 END;
+IF x > 9295 THEN x := x - 1 END;
+IF x > 9296 THEN x := x - 1 END;
+IF x > 9297 THEN x := x - 1 END;
+IF x > 9298 THEN x := x - 1 END;
+IF x > 9299 THEN x := x - 1 END;
+IF x > 9300 THEN x := x - 1 END;
+IF x > 9301 THEN x := x - 1 END;
+IF x > 9302 THEN x := x - 1 END;
+IF x > 9303 THEN x := x - 1 END;
+IF x > 9304 THEN x := x - 1 END;
+IF x > 9305 THEN x := x - 1 END;
+IF x > 9306 THEN x := x - 1 END;
+IF x > 9307 THEN x := x - 1 END;
+IF x > 9308 THEN x := x - 1 END;
+IF x > 9309 THEN x := x - 1 END;
+IF x > 9310 THEN x := x - 1 END;
+IF x > 9311 THEN x := x - 1 END;
+IF x > 9312 THEN x := x - 1 END;
+IF x > 9313 THEN x := x - 1 END;
+IF x > 9314 THEN x := x - 1 END;
+IF x > 9315 THEN x := x - 1 END;
+IF x > 9316 THEN x := x - 1 END;
+IF x > 9317 THEN x := x - 1 END;
+IF x > 9318 THEN x := x - 1 END;
+IF x > 9319 THEN x := x - 1 END;
+IF x > 9320 THEN x := x - 1 END;
+IF x > 9321 THEN x := x - 1 END;
+IF x > 9322 THEN x := x - 1 END;
+IF x > 9323 THEN x := x - 1 END;
+IF x > 9324 THEN x := x - 1 END;
+IF x > 9325 THEN x := x - 1 END;
+IF x > 9326 THEN x := x - 1 END;
+IF x > 9327 THEN x := x - 1 END;
+IF x > 9328 THEN x := x - 1 END;
+IF x > 9329 THEN x := x - 1 END;
+IF x > 9330 THEN x := x - 1 END;
+IF x > 9331 THEN x := x - 1 END;
+IF x > 9332 THEN x := x - 1 END;
+IF x > 9333 THEN x := x - 1 END;
+IF x > 9334 THEN x := x - 1 END;
+IF x > 9335 THEN x := x - 1 END;
+IF x > 9336 THEN x := x - 1 END;
+IF x > 9337 THEN x := x - 1 END;
+IF x > 9338 THEN x := x - 1 END;
+IF x > 9339 THEN x := x - 1 END;
+IF x > 9340 THEN x := x - 1 END;
+IF x > 9341 THEN x := x - 1 END;
+IF x > 9342 THEN x := x - 1 END;
+IF x > 9343 THEN x := x - 1 END;
+IF x > 9344 THEN x := x - 1 END;
+IF x > 9345 THEN x := x - 1 END;
+IF x > 9346 THEN x := x - 1 END;
+IF x > 9347 THEN x := x - 1 END;
+IF x > 9348 THEN x := x - 1 END;
+IF x > 9349 THEN x := x - 1 END;
+IF x > 9350 THEN x := x - 1 END;
+IF x > 9351 THEN x := x - 1 END;
+IF x > 9352 THEN x := x - 1 END;
+IF x > 9353 THEN x := x - 1 END;
+IF x > 9354 THEN x := x - 1 END;
+IF x > 9355 THEN x := x - 1 END;
+IF x > 9356 THEN x := x - 1 END;
+IF x > 9357 THEN x := x - 1 END;
+IF x > 9358 THEN x := x - 1 END;
+IF x > 9359 THEN x := x - 1 END;
+IF x > 9360 THEN x := x - 1 END;
+IF x > 9361 THEN x := x - 1 END;
+IF x > 9362 THEN x := x - 1 END;
+IF x > 9363 THEN x := x - 1 END;
+IF x > 9364 THEN x := x - 1 END;
+IF x > 9365 THEN x := x - 1 END;
+IF x > 9366 THEN x := x - 1 END;
+IF x > 9367 THEN x := x - 1 END;
+IF x > 9368 THEN x := x - 1 END;
+IF x > 9369 THEN x := x - 1 END;
+IF x > 9370 THEN x := x - 1 END;
+IF x > 9371 THEN x := x - 1 END;
+IF x > 9372 THEN x := x - 1 END;
+IF x > 9373 THEN x := x - 1 END;
+IF x > 9374 THEN x := x - 1 END;
+IF x > 9375 THEN x := x - 1 END;
+IF x > 9376 THEN x := x - 1 END;
+IF x > 9377 THEN x := x - 1 END;
+IF x > 9378 THEN x := x - 1 END;
+IF x > 9379 THEN x := x - 1 END;
+IF x > 9380 THEN x := x - 1 END;
+IF x > 9381 THEN x := x - 1 END;
+IF x > 9382 THEN x := x - 1 END;
+IF x > 9383 THEN x := x - 1 END;
+IF x > 9384 THEN x := x - 1 END;
+IF x > 9385 THEN x := x - 1 END;
+IF x > 9386 THEN x := x - 1 END;
+IF x > 9387 THEN x := x - 1 END;
+IF x > 9388 THEN x := x - 1 END;
+IF x > 9389 THEN x := x - 1 END;
+IF x > 9390 THEN x := x - 1 END;
+IF x > 9391 THEN x := x - 1 END;
+IF x > 9392 THEN x := x - 1 END;
+IF x > 9393 THEN x := x - 1 END;
+IF x > 9394 THEN x := x - 1 END;
+IF x > 9395 THEN x := x - 1 END;
+IF x > 9396 THEN x := x - 1 END;
+IF x > 9397 THEN x := x - 1 END;
+IF x > 9398 THEN x := x - 1 END;
+IF x > 9399 THEN x := x - 1 END;
+IF x > 9400 THEN x := x - 1 END;
+IF x > 9401 THEN x := x - 1 END;
+IF x > 9402 THEN x := x - 1 END;
+IF x > 9403 THEN x := x - 1 END;
+IF x > 9404 THEN x := x - 1 END;
+IF x > 9405 THEN x := x - 1 END;
+IF x > 9406 THEN x := x - 1 END;
+IF x > 9407 THEN x := x - 1 END;
+IF x > 9408 THEN x := x - 1 END;
+IF x > 9409 THEN x := x - 1 END;
+IF x > 9410 THEN x := x - 1 END;
+IF x > 9411 THEN x := x - 1 END;
+IF x > 9412 THEN x := x - 1 END;
+IF x > 9413 THEN x := x - 1 END;
+IF x > 9414 THEN x := x - 1 END;
+IF x > 9415 THEN x := x - 1 END;
+IF x > 9416 THEN x := x - 1 END;
+IF x > 9417 THEN x := x - 1 END;
+IF x > 9418 THEN x := x - 1 END;
+IF x > 9419 THEN x := x - 1 END;
+IF x > 9420 THEN x := x - 1 END;
+IF x > 9421 THEN x := x - 1 END;
+IF x > 9422 THEN x := x - 1 END;
+IF x > 9423 THEN x := x - 1 END;
+IF x > 9424 THEN x := x - 1 END;
+IF x > 9425 THEN x := x - 1 END;
+IF x > 9426 THEN x := x - 1 END;
+IF x > 9427 THEN x := x - 1 END;
+IF x > 9428 THEN x := x - 1 END;
+IF x > 9429 THEN x := x - 1 END;
+IF x > 9430 THEN x := x - 1 END;
+IF x > 9431 THEN x := x - 1 END;
+IF x > 9432 THEN x := x - 1 END;
+IF x > 9433 THEN x := x - 1 END;
+IF x > 9434 THEN x := x - 1 END;
+IF x > 9435 THEN x := x - 1 END;
+IF x > 9436 THEN x := x - 1 END;
+IF x > 9437 THEN x := x - 1 END;
+IF x > 9438 THEN x := x - 1 END;
+IF x > 9439 THEN x := x - 1 END;
+IF x > 9440 THEN x := x - 1 END;
+IF x > 9441 THEN x := x - 1 END;
+IF x > 9442 THEN x := x - 1 END;
+IF x > 9443 THEN x := x - 1 END;
+IF x > 9444 THEN x := x - 1 END;
+IF x > 9445 THEN x := x - 1 END;
+IF x > 9446 THEN x := x - 1 END;
+IF x > 9447 THEN x := x - 1 END;
+IF x > 9448 THEN x := x - 1 END;
+IF x > 9449 THEN x := x - 1 END;
+IF x > 9450 THEN x := x - 1 END;
+IF x > 9451 THEN x := x - 1 END;
+IF x > 9452 THEN x := x - 1 END;
+IF x > 9453 THEN x := x - 1 END;
+IF x > 9454 THEN x := x - 1 END;
+IF x > 9455 THEN x := x - 1 END;
+IF x > 9456 THEN x := x - 1 END;
+IF x > 9457 THEN x := x - 1 END;
+IF x > 9458 THEN x := x - 1 END;
+IF x > 9459 THEN x := x - 1 END;
+IF x > 9460 THEN x := x - 1 END;
+IF x > 9461 THEN x := x - 1 END;
+IF x > 9462 THEN x := x - 1 END;
+IF x > 9463 THEN x := x - 1 END;
+IF x > 9464 THEN x := x - 1 END;
+IF x > 9465 THEN x := x - 1 END;
+IF x > 9466 THEN x := x - 1 END;
+IF x > 9467 THEN x := x - 1 END;
+IF x > 9468 THEN x := x - 1 END;
+IF x > 9469 THEN x := x - 1 END;
+IF x > 9470 THEN x := x - 1 END;
+IF x > 9471 THEN x := x - 1 END;
+IF x > 9472 THEN x := x - 1 END;
+IF x > 9473 THEN x := x - 1 END;
+IF x > 9474 THEN x := x - 1 END;
+IF x > 9475 THEN x := x - 1 END;
+IF x > 9476 THEN x := x - 1 END;
+IF x > 9477 THEN x := x - 1 END;
+IF x > 9478 THEN x := x - 1 END;
+IF x > 9479 THEN x := x - 1 END;
+IF x > 9480 THEN x := x - 1 END;
+IF x > 9481 THEN x := x - 1 END;
+IF x > 9482 THEN x := x - 1 END;
+IF x > 9483 THEN x := x - 1 END;
+IF x > 9484 THEN x := x - 1 END;
+IF x > 9485 THEN x := x - 1 END;
+IF x > 9486 THEN x := x - 1 END;
+IF x > 9487 THEN x := x - 1 END;
+IF x > 9488 THEN x := x - 1 END;
+IF x > 9489 THEN x := x - 1 END;
+IF x > 9490 THEN x := x - 1 END;
+IF x > 9491 THEN x := x - 1 END;
+IF x > 9492 THEN x := x - 1 END;
+IF x > 9493 THEN x := x - 1 END;
+IF x > 9494 THEN x := x - 1 END;
+IF x > 9495 THEN x := x - 1 END;
+IF x > 9496 THEN x := x - 1 END;
+IF x > 9497 THEN x := x - 1 END;
+IF x > 9498 THEN x := x - 1 END;
+IF x > 9499 THEN x := x - 1 END;
+IF x > 9500 THEN x := x - 1 END;
+IF x > 9501 THEN x := x - 1 END;
+IF x > 9502 THEN x := x - 1 END;
+IF x > 9503 THEN x := x - 1 END;
+IF x > 9504 THEN x := x - 1 END;
+IF x > 9505 THEN x := x - 1 END;
+IF x > 9506 THEN x := x - 1 END;
+IF x > 9507 THEN x := x - 1 END;
+IF x > 9508 THEN x := x - 1 END;
+IF x > 9509 THEN x := x - 1 END;
+IF x > 9510 THEN x := x - 1 END;
+IF x > 9511 THEN x := x - 1 END;
+IF x > 9512 THEN x := x - 1 END;
+IF x > 9513 THEN x := x - 1 END;
+IF x > 9514 THEN x := x - 1 END;
+IF x > 9515 THEN x := x - 1 END;
+IF x > 9516 THEN x := x - 1 END;
+IF x > 9517 THEN x := x - 1 END;
+IF x > 9518 THEN x := x - 1 END;
+IF x > 9519 THEN x := x - 1 END;
+IF x > 9520 THEN x := x - 1 END;
+IF x > 9521 THEN x := x - 1 END;
+IF x > 9522 THEN x := x - 1 END;
+IF x > 9523 THEN x := x - 1 END;
+IF x > 9524 THEN x := x - 1 END;
+IF x > 9525 THEN x := x - 1 END;
+IF x > 9526 THEN x := x - 1 END;
+IF x > 9527 THEN x := x - 1 END;
+IF x > 9528 THEN x := x - 1 END;
+IF x > 9529 THEN x := x - 1 END;
+IF x > 9530 THEN x := x - 1 END;
+IF x > 9531 THEN x := x - 1 END;
+IF x > 9532 THEN x := x - 1 END;
+IF x > 9533 THEN x := x - 1 END;
+IF x > 9534 THEN x := x - 1 END;
+IF x > 9535 THEN x := x - 1 END;
+IF x > 9536 THEN x := x - 1 END;
+IF x > 9537 THEN x := x - 1 END;
+IF x > 9538 THEN x := x - 1 END;
+IF x > 9539 THEN x := x - 1 END;
+IF x > 9540 THEN x := x - 1 END;
+IF x > 9541 THEN x := x - 1 END;
+IF x > 9542 THEN x := x - 1 END;
+IF x > 9543 THEN x := x - 1 END;
+IF x > 9544 THEN x := x - 1 END;
+IF x > 9545 THEN x := x - 1 END;
+IF x > 9546 THEN x := x - 1 END;
+IF x > 9547 THEN x := x - 1 END;
+IF x > 9548 THEN x := x - 1 END;
+IF x > 9549 THEN x := x - 1 END;
+IF x > 9550 THEN x := x - 1 END;
+IF x > 9551 THEN x := x - 1 END;
+IF x > 9552 THEN x := x - 1 END;
+IF x > 9553 THEN x := x - 1 END;
+IF x > 9554 THEN x := x - 1 END;
+IF x > 9555 THEN x := x - 1 END;
+IF x > 9556 THEN x := x - 1 END;
+IF x > 9557 THEN x := x - 1 END;
+IF x > 9558 THEN x := x - 1 END;
+IF x > 9559 THEN x := x - 1 END;
+IF x > 9560 THEN x := x - 1 END;
+IF x > 9561 THEN x := x - 1 END;
+IF x > 9562 THEN x := x - 1 END;
+IF x > 9563 THEN x := x - 1 END;
+IF x > 9564 THEN x := x - 1 END;
+IF x > 9565 THEN x := x - 1 END;
+IF x > 9566 THEN x := x - 1 END;
+IF x > 9567 THEN x := x - 1 END;
+IF x > 9568 THEN x := x - 1 END;
+IF x > 9569 THEN x := x - 1 END;
+IF x > 9570 THEN x := x - 1 END;
+IF x > 9571 THEN x := x - 1 END;
+IF x > 9572 THEN x := x - 1 END;
+IF x > 9573 THEN x := x - 1 END;
+IF x > 9574 THEN x := x - 1 END;
+IF x > 9575 THEN x := x - 1 END;
+IF x > 9576 THEN x := x - 1 END;
+IF x > 9577 THEN x := x - 1 END;
+IF x > 9578 THEN x := x - 1 END;
+IF x > 9579 THEN x := x - 1 END;
+IF x > 9580 THEN x := x - 1 END;
+IF x > 9581 THEN x := x - 1 END;
+IF x > 9582 THEN x := x - 1 END;
+IF x > 9583 THEN x := x - 1 END;
+IF x > 9584 THEN x := x - 1 END;
+IF x > 9585 THEN x := x - 1 END;
+IF x > 9586 THEN x := x - 1 END;
+IF x > 9587 THEN x := x - 1 END;
+IF x > 9588 THEN x := x - 1 END;
+IF x > 9589 THEN x := x - 1 END;
+IF x > 9590 THEN x := x - 1 END;
+IF x > 9591 THEN x := x - 1 END;
+IF x > 9592 THEN x := x - 1 END;
+IF x > 9593 THEN x := x - 1 END;
+IF x > 9594 THEN x := x - 1 END;
+IF x > 9595 THEN x := x - 1 END;
+IF x > 9596 THEN x := x - 1 END;
+IF x > 9597 THEN x := x - 1 END;
+IF x > 9598 THEN x := x - 1 END;
+IF x > 9599 THEN x := x - 1 END;
+IF x > 9600 THEN x := x - 1 END;
+IF x > 9601 THEN x := x - 1 END;
+IF x > 9602 THEN x := x - 1 END;
+IF x > 9603 THEN x := x - 1 END;
+IF x > 9604 THEN x := x - 1 END;
+IF x > 9605 THEN x := x - 1 END;
+IF x > 9606 THEN x := x - 1 END;
+IF x > 9607 THEN x := x - 1 END;
+IF x > 9608 THEN x := x - 1 END;
+IF x > 9609 THEN x := x - 1 END;
+IF x > 9610 THEN x := x - 1 END;
+IF x > 9611 THEN x := x - 1 END;
+IF x > 9612 THEN x := x - 1 END;
+IF x > 9613 THEN x := x - 1 END;
+IF x > 9614 THEN x := x - 1 END;
+IF x > 9615 THEN x := x - 1 END;
+IF x > 9616 THEN x := x - 1 END;
+IF x > 9617 THEN x := x - 1 END;
+IF x > 9618 THEN x := x - 1 END;
+IF x > 9619 THEN x := x - 1 END;
+IF x > 9620 THEN x := x - 1 END;
+IF x > 9621 THEN x := x - 1 END;
+IF x > 9622 THEN x := x - 1 END;
+IF x > 9623 THEN x := x - 1 END;
+IF x > 9624 THEN x := x - 1 END;
+IF x > 9625 THEN x := x - 1 END;
+IF x > 9626 THEN x := x - 1 END;
+IF x > 9627 THEN x := x - 1 END;
+IF x > 9628 THEN x := x - 1 END;
+IF x > 9629 THEN x := x - 1 END;
+IF x > 9630 THEN x := x - 1 END;
+IF x > 9631 THEN x := x - 1 END;
+IF x > 9632 THEN x := x - 1 END;
+IF x > 9633 THEN x := x - 1 END;
+IF x > 9634 THEN x := x - 1 END;
+IF x > 9635 THEN x := x - 1 END;
+IF x > 9636 THEN x := x - 1 END;
+IF x > 9637 THEN x := x - 1 END;
+IF x > 9638 THEN x := x - 1 END;
+IF x > 9639 THEN x := x - 1 END;
+IF x > 9640 THEN x := x - 1 END;
+IF x > 9641 THEN x := x - 1 END;
+IF x > 9642 THEN x := x - 1 END;
+IF x > 9643 THEN x := x - 1 END;
+IF x > 9644 THEN x := x - 1 END;
+IF x > 9645 THEN x := x - 1 END;
+IF x > 9646 THEN x := x - 1 END;
+IF x > 9647 THEN x := x - 1 END;
+IF x > 9648 THEN x := x - 1 END;
+IF x > 9649 THEN x := x - 1 END;
+IF x > 9650 THEN x := x - 1 END;
+IF x > 9651 THEN x := x - 1 END;
+IF x > 9652 THEN x := x - 1 END;
+IF x > 9653 THEN x := x - 1 END;
+IF x > 9654 THEN x := x - 1 END;
+IF x > 9655 THEN x := x - 1 END;
+IF x > 9656 THEN x := x - 1 END;
+IF x > 9657 THEN x := x - 1 END;
+IF x > 9658 THEN x := x - 1 END;
+IF x > 9659 THEN x := x - 1 END;
+IF x > 9660 THEN x := x - 1 END;
+IF x > 9661 THEN x := x - 1 END;
+IF x > 9662 THEN x := x - 1 END;
+IF x > 9663 THEN x := x - 1 END;
+IF x > 9664 THEN x := x - 1 END;
+IF x > 9665 THEN x := x - 1 END;
+IF x > 9666 THEN x := x - 1 END;
+IF x > 9667 THEN x := x - 1 END;
+IF x > 9668 THEN x := x - 1 END;
+IF x > 9669 THEN x := x - 1 END;
+IF x > 9670 THEN x := x - 1 END;
+IF x > 9671 THEN x := x - 1 END;
+IF x > 9672 THEN x := x - 1 END;
+IF x > 9673 THEN x := x - 1 END;
+IF x > 9674 THEN x := x - 1 END;
+IF x > 9675 THEN x := x - 1 END;
+IF x > 9676 THEN x := x - 1 END;
+IF x > 9677 THEN x := x - 1 END;
+IF x > 9678 THEN x := x - 1 END;
+IF x > 9679 THEN x := x - 1 END;
+IF x > 9680 THEN x := x - 1 END;
+IF x > 9681 THEN x := x - 1 END;
+IF x > 9682 THEN x := x - 1 END;
+IF x > 9683 THEN x := x - 1 END;
+IF x > 9684 THEN x := x - 1 END;
+IF x > 9685 THEN x := x - 1 END;
+IF x > 9686 THEN x := x - 1 END;
+IF x > 9687 THEN x := x - 1 END;
+IF x > 9688 THEN x := x - 1 END;
+IF x > 9689 THEN x := x - 1 END;
+IF x > 9690 THEN x := x - 1 END;
+IF x > 9691 THEN x := x - 1 END;
+IF x > 9692 THEN x := x - 1 END;
+IF x > 9693 THEN x := x - 1 END;
+IF x > 9694 THEN x := x - 1 END;
+IF x > 9695 THEN x := x - 1 END;
+IF x > 9696 THEN x := x - 1 END;
+IF x > 9697 THEN x := x - 1 END;
+IF x > 9698 THEN x := x - 1 END;
+IF x > 9699 THEN x := x - 1 END;
+IF x > 9700 THEN x := x - 1 END;
+IF x > 9701 THEN x := x - 1 END;
+IF x > 9702 THEN x := x - 1 END;
+IF x > 9703 THEN x := x - 1 END;
+IF x > 9704 THEN x := x - 1 END;
+IF x > 9705 THEN x := x - 1 END;
+IF x > 9706 THEN x := x - 1 END;
+IF x > 9707 THEN x := x - 1 END;
+IF x > 9708 THEN x := x - 1 END;
+IF x > 9709 THEN x := x - 1 END;
+IF x > 9710 THEN x := x - 1 END;
+IF x > 9711 THEN x := x - 1 END;
+IF x > 9712 THEN x := x - 1 END;
+IF x > 9713 THEN x := x - 1 END;
+IF x > 9714 THEN x := x - 1 END;
+IF x > 9715 THEN x := x - 1 END;
+IF x > 9716 THEN x := x - 1 END;
+IF x > 9717 THEN x := x - 1 END;
+IF x > 9718 THEN x := x - 1 END;
+IF x > 9719 THEN x := x - 1 END;
+IF x > 9720 THEN x := x - 1 END;
+IF x > 9721 THEN x := x - 1 END;
+IF x > 9722 THEN x := x - 1 END;
+IF x > 9723 THEN x := x - 1 END;
+IF x > 9724 THEN x := x - 1 END;
+IF x > 9725 THEN x := x - 1 END;
+IF x > 9726 THEN x := x - 1 END;
+IF x > 9727 THEN x := x - 1 END;
+IF x > 9728 THEN x := x - 1 END;
+IF x > 9729 THEN x := x - 1 END;
+IF x > 9730 THEN x := x - 1 END;
+IF x > 9731 THEN x := x - 1 END;
+IF x > 9732 THEN x := x - 1 END;
+IF x > 9733 THEN x := x - 1 END;
+IF x > 9734 THEN x := x - 1 END;
+IF x > 9735 THEN x := x - 1 END;
+IF x > 9736 THEN x := x - 1 END;
+IF x > 9737 THEN x := x - 1 END;
+IF x > 9738 THEN x := x - 1 END;
+IF x > 9739 THEN x := x - 1 END;
+IF x > 9740 THEN x := x - 1 END;
+IF x > 9741 THEN x := x - 1 END;
+IF x > 9742 THEN x := x - 1 END;
+IF x > 9743 THEN x := x - 1 END;
+IF x > 9744 THEN x := x - 1 END;
+IF x > 9745 THEN x := x - 1 END;
+IF x > 9746 THEN x := x - 1 END;
+IF x > 9747 THEN x := x - 1 END;
+IF x > 9748 THEN x := x - 1 END;
+IF x > 9749 THEN x := x - 1 END;
+IF x > 9750 THEN x := x - 1 END;
+IF x > 9751 THEN x := x - 1 END;
+IF x > 9752 THEN x := x - 1 END;
+IF x > 9753 THEN x := x - 1 END;
+IF x > 9754 THEN x := x - 1 END;
+IF x > 9755 THEN x := x - 1 END;
+IF x > 9756 THEN x := x - 1 END;
+IF x > 9757 THEN x := x - 1 END;
+IF x > 9758 THEN x := x - 1 END;
+IF x > 9759 THEN x := x - 1 END;
+IF x > 9760 THEN x := x - 1 END;
+IF x > 9761 THEN x := x - 1 END;
+IF x > 9762 THEN x := x - 1 END;
+IF x > 9763 THEN x := x - 1 END;
+IF x > 9764 THEN x := x - 1 END;
+IF x > 9765 THEN x := x - 1 END;
+IF x > 9766 THEN x := x - 1 END;
+IF x > 9767 THEN x := x - 1 END;
+IF x > 9768 THEN x := x - 1 END;
+IF x > 9769 THEN x := x - 1 END;
+IF x > 9770 THEN x := x - 1 END;
+IF x > 9771 THEN x := x - 1 END;
+IF x > 9772 THEN x := x - 1 END;
+IF x > 9773 THEN x := x - 1 END;
+IF x > 9774 THEN x := x - 1 END;
+IF x > 9775 THEN x := x - 1 END;
+IF x > 9776 THEN x := x - 1 END;
+IF x > 9777 THEN x := x - 1 END;
+IF x > 9778 THEN x := x - 1 END;
+IF x > 9779 THEN x := x - 1 END;
+IF x > 9780 THEN x := x - 1 END;
+IF x > 9781 THEN x := x - 1 END;
+IF x > 9782 THEN x := x - 1 END;
+IF x > 9783 THEN x := x - 1 END;
+IF x > 9784 THEN x := x - 1 END;
+IF x > 9785 THEN x := x - 1 END;
+IF x > 9786 THEN x := x - 1 END;
+IF x > 9787 THEN x := x - 1 END;
+IF x > 9788 THEN x := x - 1 END;
+IF x > 9789 THEN x := x - 1 END;
+IF x > 9790 THEN x := x - 1 END;
+IF x > 9791 THEN x := x - 1 END;
+IF x > 9792 THEN x := x - 1 END;
+IF x > 9793 THEN x := x - 1 END;
+IF x > 9794 THEN x := x - 1 END;
+IF x > 9795 THEN x := x - 1 END;
+IF x > 9796 THEN x := x - 1 END;
+IF x > 9797 THEN x := x - 1 END;
+IF x > 9798 THEN x := x - 1 END;
+IF x > 9799 THEN x := x - 1 END;
+IF x > 9800 THEN x := x - 1 END;
+IF x > 9801 THEN x := x - 1 END;
+IF x > 9802 THEN x := x - 1 END;
+IF x > 9803 THEN x := x - 1 END;
+IF x > 9804 THEN x := x - 1 END;
+IF x > 9805 THEN x := x - 1 END;
+IF x > 9806 THEN x := x - 1 END;
+IF x > 9807 THEN x := x - 1 END;
+IF x > 9808 THEN x := x - 1 END;
+IF x > 9809 THEN x := x - 1 END;
+IF x > 9810 THEN x := x - 1 END;
+IF x > 9811 THEN x := x - 1 END;
+IF x > 9812 THEN x := x - 1 END;
+IF x > 9813 THEN x := x - 1 END;
+IF x > 9814 THEN x := x - 1 END;
+IF x > 9815 THEN x := x - 1 END;
+IF x > 9816 THEN x := x - 1 END;
+IF x > 9817 THEN x := x - 1 END;
+IF x > 9818 THEN x := x - 1 END;
+IF x > 9819 THEN x := x - 1 END;
+IF x > 9820 THEN x := x - 1 END;
+IF x > 9821 THEN x := x - 1 END;
+IF x > 9822 THEN x := x - 1 END;
+IF x > 9823 THEN x := x - 1 END;
+IF x > 9824 THEN x := x - 1 END;
+IF x > 9825 THEN x := x - 1 END;
+IF x > 9826 THEN x := x - 1 END;
+IF x > 9827 THEN x := x - 1 END;
+IF x > 9828 THEN x := x - 1 END;
+IF x > 9829 THEN x := x - 1 END;
+IF x > 9830 THEN x := x - 1 END;
+IF x > 9831 THEN x := x - 1 END;
+IF x > 9832 THEN x := x - 1 END;
+IF x > 9833 THEN x := x - 1 END;
+IF x > 9834 THEN x := x - 1 END;
+IF x > 9835 THEN x := x - 1 END;
+IF x > 9836 THEN x := x - 1 END;
+IF x > 9837 THEN x := x - 1 END;
+IF x > 9838 THEN x := x - 1 END;
+IF x > 9839 THEN x := x - 1 END;
+IF x > 9840 THEN x := x - 1 END;
+IF x > 9841 THEN x := x - 1 END;
+IF x > 9842 THEN x := x - 1 END;
+IF x > 9843 THEN x := x - 1 END;
+IF x > 9844 THEN x := x - 1 END;
+IF x > 9845 THEN x := x - 1 END;
+IF x > 9846 THEN x := x - 1 END;
+IF x > 9847 THEN x := x - 1 END;
+IF x > 9848 THEN x := x - 1 END;
+IF x > 9849 THEN x := x - 1 END;
+IF x > 9850 THEN x := x - 1 END;
+IF x > 9851 THEN x := x - 1 END;
+IF x > 9852 THEN x := x - 1 END;
+IF x > 9853 THEN x := x - 1 END;
+IF x > 9854 THEN x := x - 1 END;
+IF x > 9855 THEN x := x - 1 END;
+IF x > 9856 THEN x := x - 1 END;
+IF x > 9857 THEN x := x - 1 END;
+IF x > 9858 THEN x := x - 1 END;
+IF x > 9859 THEN x := x - 1 END;
+IF x > 9860 THEN x := x - 1 END;
+IF x > 9861 THEN x := x - 1 END;
+IF x > 9862 THEN x := x - 1 END;
+IF x > 9863 THEN x := x - 1 END;
+IF x > 9864 THEN x := x - 1 END;
+IF x > 9865 THEN x := x - 1 END;
+IF x > 9866 THEN x := x - 1 END;
+IF x > 9867 THEN x := x - 1 END;
+IF x > 9868 THEN x := x - 1 END;
+IF x > 9869 THEN x := x - 1 END;
+IF x > 9870 THEN x := x - 1 END;
+IF x > 9871 THEN x := x - 1 END;
+IF x > 9872 THEN x := x - 1 END;
+IF x > 9873 THEN x := x - 1 END;
+IF x > 9874 THEN x := x - 1 END;
+IF x > 9875 THEN x := x - 1 END;
+IF x > 9876 THEN x := x - 1 END;
+IF x > 9877 THEN x := x - 1 END;
+IF x > 9878 THEN x := x - 1 END;
+IF x > 9879 THEN x := x - 1 END;
+IF x > 9880 THEN x := x - 1 END;
+IF x > 9881 THEN x := x - 1 END;
+IF x > 9882 THEN x := x - 1 END;
+IF x > 9883 THEN x := x - 1 END;
+IF x > 9884 THEN x := x - 1 END;
+IF x > 9885 THEN x := x - 1 END;
+IF x > 9886 THEN x := x - 1 END;
+IF x > 9887 THEN x := x - 1 END;
+IF x > 9888 THEN x := x - 1 END;
+IF x > 9889 THEN x := x - 1 END;
+IF x > 9890 THEN x := x - 1 END;
+IF x > 9891 THEN x := x - 1 END;
+IF x > 9892 THEN x := x - 1 END;
+IF x > 9893 THEN x := x - 1 END;
+IF x > 9894 THEN x := x - 1 END;
+IF x > 9895 THEN x := x - 1 END;
+IF x > 9896 THEN x := x - 1 END;
+IF x > 9897 THEN x := x - 1 END;
+IF x > 9898 THEN x := x - 1 END;
+IF x > 9899 THEN x := x - 1 END;
+IF x > 9900 THEN x := x - 1 END;
+IF x > 9901 THEN x := x - 1 END;
+IF x > 9902 THEN x := x - 1 END;
+IF x > 9903 THEN x := x - 1 END;
+IF x > 9904 THEN x := x - 1 END;
+IF x > 9905 THEN x := x - 1 END;
+IF x > 9906 THEN x := x - 1 END;
+IF x > 9907 THEN x := x - 1 END;
+IF x > 9908 THEN x := x - 1 END;
+IF x > 9909 THEN x := x - 1 END;
+IF x > 9910 THEN x := x - 1 END;
+IF x > 9911 THEN x := x - 1 END;
+IF x > 9912 THEN x := x - 1 END;
+IF x > 9913 THEN x := x - 1 END;
+IF x > 9914 THEN x := x - 1 END;
+IF x > 9915 THEN x := x - 1 END;
+IF x > 9916 THEN x := x - 1 END;
+IF x > 9917 THEN x := x - 1 END;
+IF x > 9918 THEN x := x - 1 END;
+IF x > 9919 THEN x := x - 1 END;
+IF x > 9920 THEN x := x - 1 END;
+IF x > 9921 THEN x := x - 1 END;
+IF x > 9922 THEN x := x - 1 END;
+IF x > 9923 THEN x := x - 1 END;
+IF x > 9924 THEN x := x - 1 END;
+IF x > 9925 THEN x := x - 1 END;
+IF x > 9926 THEN x := x - 1 END;
+IF x > 9927 THEN x := x - 1 END;
+IF x > 9928 THEN x := x - 1 END;
+IF x > 9929 THEN x := x - 1 END;
+IF x > 9930 THEN x := x - 1 END;
+IF x > 9931 THEN x := x - 1 END;
+IF x > 9932 THEN x := x - 1 END;
+IF x > 9933 THEN x := x - 1 END;
+IF x > 9934 THEN x := x - 1 END;
+IF x > 9935 THEN x := x - 1 END;
+IF x > 9936 THEN x := x - 1 END;
+IF x > 9937 THEN x := x - 1 END;
+IF x > 9938 THEN x := x - 1 END;
+IF x > 9939 THEN x := x - 1 END;
+IF x > 9940 THEN x := x - 1 END;
+IF x > 9941 THEN x := x - 1 END;
+IF x > 9942 THEN x := x - 1 END;
+IF x > 9943 THEN x := x - 1 END;
+IF x > 9944 THEN x := x - 1 END;
+IF x > 9945 THEN x := x - 1 END;
+IF x > 9946 THEN x := x - 1 END;
+IF x > 9947 THEN x := x - 1 END;
+IF x > 9948 THEN x := x - 1 END;
+IF x > 9949 THEN x := x - 1 END;
+IF x > 9950 THEN x := x - 1 END;
+IF x > 9951 THEN x := x - 1 END;
+IF x > 9952 THEN x := x - 1 END;
+IF x > 9953 THEN x := x - 1 END;
+IF x > 9954 THEN x := x - 1 END;
+IF x > 9955 THEN x := x - 1 END;
+IF x > 9956 THEN x := x - 1 END;
+IF x > 9957 THEN x := x - 1 END;
+IF x > 9958 THEN x := x - 1 END;
+IF x > 9959 THEN x := x - 1 END;
+IF x > 9960 THEN x := x - 1 END;
+IF x > 9961 THEN x := x - 1 END;
+IF x > 9962 THEN x := x - 1 END;
+IF x > 9963 THEN x := x - 1 END;
+IF x > 9964 THEN x := x - 1 END;
+IF x > 9965 THEN x := x - 1 END;
+IF x > 9966 THEN x := x - 1 END;
+IF x > 9967 THEN x := x - 1 END;
+IF x > 9968 THEN x := x - 1 END;
+IF x > 9969 THEN x := x - 1 END;
+IF x > 9970 THEN x := x - 1 END;
+IF x > 9971 THEN x := x - 1 END;
+IF x > 9972 THEN x := x - 1 END;
+IF x > 9973 THEN x := x - 1 END;
+IF x > 9974 THEN x := x - 1 END;
+IF x > 9975 THEN x := x - 1 END;
+IF x > 9976 THEN x := x - 1 END;
+IF x > 9977 THEN x := x - 1 END;
+IF x > 9978 THEN x := x - 1 END;
+IF x > 9979 THEN x := x - 1 END;
+IF x > 9980 THEN x := x - 1 END;
+IF x > 9981 THEN x := x - 1 END;
+IF x > 9982 THEN x := x - 1 END;
+IF x > 9983 THEN x := x - 1 END;
+IF x > 9984 THEN x := x - 1 END;
+IF x > 9985 THEN x := x - 1 END;
+IF x > 9986 THEN x := x - 1 END;
+IF x > 9987 THEN x := x - 1 END;
+IF x > 9988 THEN x := x - 1 END;
+IF x > 9989 THEN x := x - 1 END;
+IF x > 9990 THEN x := x - 1 END;
+IF x > 9991 THEN x := x - 1 END;
+IF x > 9992 THEN x := x - 1 END;
+IF x > 9993 THEN x := x - 1 END;
+IF x > 9994 THEN x := x - 1 END;
+IF x > 9995 THEN x := x - 1 END;
+IF x > 9996 THEN x := x - 1 END;
+IF x > 9997 THEN x := x - 1 END;
+IF x > 9998 THEN x := x - 1 END;
+IF x > 9999 THEN x := x - 1 END;
+IF x > 10000 THEN x := x - 1 END;
+IF x > 10001 THEN x := x - 1 END;
+IF x > 10002 THEN x := x - 1 END;
+IF x > 10003 THEN x := x - 1 END;
+IF x > 10004 THEN x := x - 1 END;
+IF x > 10005 THEN x := x - 1 END;
+IF x > 10006 THEN x := x - 1 END;
+IF x > 10007 THEN x := x - 1 END;
+IF x > 10008 THEN x := x - 1 END;
+IF x > 10009 THEN x := x - 1 END;
+IF x > 10010 THEN x := x - 1 END;
+IF x > 10011 THEN x := x - 1 END;
+IF x > 10012 THEN x := x - 1 END;
+IF x > 10013 THEN x := x - 1 END;
+IF x > 10014 THEN x := x - 1 END;
+IF x > 10015 THEN x := x - 1 END;
+IF x > 10016 THEN x := x - 1 END;
+IF x > 10017 THEN x := x - 1 END;
+IF x > 10018 THEN x := x - 1 END;
+IF x > 10019 THEN x := x - 1 END;
+IF x > 10020 THEN x := x - 1 END;
+IF x > 10021 THEN x := x - 1 END;
+IF x > 10022 THEN x := x - 1 END;
+IF x > 10023 THEN x := x - 1 END;
+IF x > 10024 THEN x := x - 1 END;
+IF x > 10025 THEN x := x - 1 END;
+IF x > 10026 THEN x := x - 1 END;
+IF x > 10027 THEN x := x - 1 END;
+IF x > 10028 THEN x := x - 1 END;
+IF x > 10029 THEN x := x - 1 END;
+IF x > 10030 THEN x := x - 1 END;
+IF x > 10031 THEN x := x - 1 END;
+IF x > 10032 THEN x := x - 1 END;
+IF x > 10033 THEN x := x - 1 END;
+IF x > 10034 THEN x := x - 1 END;
+IF x > 10035 THEN x := x - 1 END;
+IF x > 10036 THEN x := x - 1 END;
+IF x > 10037 THEN x := x - 1 END;
+IF x > 10038 THEN x := x - 1 END;
+IF x > 10039 THEN x := x - 1 END;
+IF x > 10040 THEN x := x - 1 END;
+IF x > 10041 THEN x := x - 1 END;
+IF x > 10042 THEN x := x - 1 END;
+IF x > 10043 THEN x := x - 1 END;
+IF x > 10044 THEN x := x - 1 END;
+IF x > 10045 THEN x := x - 1 END;
+IF x > 10046 THEN x := x - 1 END;
+IF x > 10047 THEN x := x - 1 END;
+IF x > 10048 THEN x := x - 1 END;
+IF x > 10049 THEN x := x - 1 END;
+IF x > 10050 THEN x := x - 1 END;
+IF x > 10051 THEN x := x - 1 END;
+IF x > 10052 THEN x := x - 1 END;
+IF x > 10053 THEN x := x - 1 END;
+IF x > 10054 THEN x := x - 1 END;
+IF x > 10055 THEN x := x - 1 END;
+IF x > 10056 THEN x := x - 1 END;
+IF x > 10057 THEN x := x - 1 END;
+IF x > 10058 THEN x := x - 1 END;
+IF x > 10059 THEN x := x - 1 END;
+IF x > 10060 THEN x := x - 1 END;
+IF x > 10061 THEN x := x - 1 END;
+IF x > 10062 THEN x := x - 1 END;
+IF x > 10063 THEN x := x - 1 END;
+IF x > 10064 THEN x := x - 1 END;
+IF x > 10065 THEN x := x - 1 END;
+IF x > 10066 THEN x := x - 1 END;
+IF x > 10067 THEN x := x - 1 END;
+IF x > 10068 THEN x := x - 1 END;
+IF x > 10069 THEN x := x - 1 END;
+IF x > 10070 THEN x := x - 1 END;
+IF x > 10071 THEN x := x - 1 END;
+IF x > 10072 THEN x := x - 1 END;
+IF x > 10073 THEN x := x - 1 END;
+IF x > 10074 THEN x := x - 1 END;
+IF x > 10075 THEN x := x - 1 END;
+IF x > 10076 THEN x := x - 1 END;
+IF x > 10077 THEN x := x - 1 END;
+IF x > 10078 THEN x := x - 1 END;
+IF x > 10079 THEN x := x - 1 END;
+IF x > 10080 THEN x := x - 1 END;
+IF x > 10081 THEN x := x - 1 END;
+IF x > 10082 THEN x := x - 1 END;
+IF x > 10083 THEN x := x - 1 END;
+IF x > 10084 THEN x := x - 1 END;
+IF x > 10085 THEN x := x - 1 END;
+IF x > 10086 THEN x := x - 1 END;
+IF x > 10087 THEN x := x - 1 END;
+IF x > 10088 THEN x := x - 1 END;
+IF x > 10089 THEN x := x - 1 END;
+IF x > 10090 THEN x := x - 1 END;
+IF x > 10091 THEN x := x - 1 END;
+IF x > 10092 THEN x := x - 1 END;
+IF x > 10093 THEN x := x - 1 END;
+IF x > 10094 THEN x := x - 1 END;
+IF x > 10095 THEN x := x - 1 END;
+IF x > 10096 THEN x := x - 1 END;
+IF x > 10097 THEN x := x - 1 END;
+IF x > 10098 THEN x := x - 1 END;
+IF x > 10099 THEN x := x - 1 END;
+IF x > 10100 THEN x := x - 1 END;
+IF x > 10101 THEN x := x - 1 END;
+IF x > 10102 THEN x := x - 1 END;
+IF x > 10103 THEN x := x - 1 END;
+IF x > 10104 THEN x := x - 1 END;
+IF x > 10105 THEN x := x - 1 END;
+IF x > 10106 THEN x := x - 1 END;
+IF x > 10107 THEN x := x - 1 END;
+IF x > 10108 THEN x := x - 1 END;
+IF x > 10109 THEN x := x - 1 END;
+IF x > 10110 THEN x := x - 1 END;
+IF x > 10111 THEN x := x - 1 END;
+IF x > 10112 THEN x := x - 1 END;
+IF x > 10113 THEN x := x - 1 END;
+IF x > 10114 THEN x := x - 1 END;
+IF x > 10115 THEN x := x - 1 END;
+IF x > 10116 THEN x := x - 1 END;
+IF x > 10117 THEN x := x - 1 END;
+IF x > 10118 THEN x := x - 1 END;
+IF x > 10119 THEN x := x - 1 END;
+IF x > 10120 THEN x := x - 1 END;
+IF x > 10121 THEN x := x - 1 END;
+IF x > 10122 THEN x := x - 1 END;
+IF x > 10123 THEN x := x - 1 END;
+IF x > 10124 THEN x := x - 1 END;
+IF x > 10125 THEN x := x - 1 END;
+IF x > 10126 THEN x := x - 1 END;
+IF x > 10127 THEN x := x - 1 END;
+IF x > 10128 THEN x := x - 1 END;
+IF x > 10129 THEN x := x - 1 END;
+IF x > 10130 THEN x := x - 1 END;
+IF x > 10131 THEN x := x - 1 END;
+IF x > 10132 THEN x := x - 1 END;
+IF x > 10133 THEN x := x - 1 END;
+IF x > 10134 THEN x := x - 1 END;
+IF x > 10135 THEN x := x - 1 END;
+IF x > 10136 THEN x := x - 1 END;
+IF x > 10137 THEN x := x - 1 END;
+IF x > 10138 THEN x := x - 1 END;
+IF x > 10139 THEN x := x - 1 END;
+IF x > 10140 THEN x := x - 1 END;
+IF x > 10141 THEN x := x - 1 END;
+IF x > 10142 THEN x := x - 1 END;
+IF x > 10143 THEN x := x - 1 END;
+IF x > 10144 THEN x := x - 1 END;
+IF x > 10145 THEN x := x - 1 END;
+IF x > 10146 THEN x := x - 1 END;
+IF x > 10147 THEN x := x - 1 END;
+IF x > 10148 THEN x := x - 1 END;
+IF x > 10149 THEN x := x - 1 END;
+IF x > 10150 THEN x := x - 1 END;
+IF x > 10151 THEN x := x - 1 END;
+IF x > 10152 THEN x := x - 1 END;
+IF x > 10153 THEN x := x - 1 END;
+IF x > 10154 THEN x := x - 1 END;
+IF x > 10155 THEN x := x - 1 END;
+IF x > 10156 THEN x := x - 1 END;
+IF x > 10157 THEN x := x - 1 END;
+IF x > 10158 THEN x := x - 1 END;
+IF x > 10159 THEN x := x - 1 END;
+IF x > 10160 THEN x := x - 1 END;
+IF x > 10161 THEN x := x - 1 END;
+IF x > 10162 THEN x := x - 1 END;
+IF x > 10163 THEN x := x - 1 END;
+IF x > 10164 THEN x := x - 1 END;
+IF x > 10165 THEN x := x - 1 END;
+IF x > 10166 THEN x := x - 1 END;
+IF x > 10167 THEN x := x - 1 END;
+IF x > 10168 THEN x := x - 1 END;
+IF x > 10169 THEN x := x - 1 END;
+IF x > 10170 THEN x := x - 1 END;
+IF x > 10171 THEN x := x - 1 END;
+IF x > 10172 THEN x := x - 1 END;
+IF x > 10173 THEN x := x - 1 END;
+IF x > 10174 THEN x := x - 1 END;
+IF x > 10175 THEN x := x - 1 END;
+IF x > 10176 THEN x := x - 1 END;
+IF x > 10177 THEN x := x - 1 END;
+IF x > 10178 THEN x := x - 1 END;
+IF x > 10179 THEN x := x - 1 END;
+IF x > 10180 THEN x := x - 1 END;
+IF x > 10181 THEN x := x - 1 END;
+IF x > 10182 THEN x := x - 1 END;
+IF x > 10183 THEN x := x - 1 END;
+IF x > 10184 THEN x := x - 1 END;
+IF x > 10185 THEN x := x - 1 END;
+IF x > 10186 THEN x := x - 1 END;
+IF x > 10187 THEN x := x - 1 END;
+IF x > 10188 THEN x := x - 1 END;
+IF x > 10189 THEN x := x - 1 END;
+IF x > 10190 THEN x := x - 1 END;
+IF x > 10191 THEN x := x - 1 END;
+IF x > 10192 THEN x := x - 1 END;
+IF x > 10193 THEN x := x - 1 END;
+IF x > 10194 THEN x := x - 1 END;
+IF x > 10195 THEN x := x - 1 END;
+IF x > 10196 THEN x := x - 1 END;
+IF x > 10197 THEN x := x - 1 END;
+IF x > 10198 THEN x := x - 1 END;
+IF x > 10199 THEN x := x - 1 END;
+IF x > 10200 THEN x := x - 1 END;
+IF x > 10201 THEN x := x - 1 END;
+IF x > 10202 THEN x := x - 1 END;
+IF x > 10203 THEN x := x - 1 END;
+IF x > 10204 THEN x := x - 1 END;
+IF x > 10205 THEN x := x - 1 END;
+IF x > 10206 THEN x := x - 1 END;
+IF x > 10207 THEN x := x - 1 END;
+IF x > 10208 THEN x := x - 1 END;
+IF x > 10209 THEN x := x - 1 END;
+IF x > 10210 THEN x := x - 1 END;
+IF x > 10211 THEN x := x - 1 END;
+IF x > 10212 THEN x := x - 1 END;
+IF x > 10213 THEN x := x - 1 END;
+IF x > 10214 THEN x := x - 1 END;
+IF x > 10215 THEN x := x - 1 END;
+IF x > 10216 THEN x := x - 1 END;
+IF x > 10217 THEN x := x - 1 END;
+IF x > 10218 THEN x := x - 1 END;
+IF x > 10219 THEN x := x - 1 END;
+IF x > 10220 THEN x := x - 1 END;
+IF x > 10221 THEN x := x - 1 END;
+IF x > 10222 THEN x := x - 1 END;
+IF x > 10223 THEN x := x - 1 END;
+IF x > 10224 THEN x := x - 1 END;
+IF x > 10225 THEN x := x - 1 END;
+IF x > 10226 THEN x := x - 1 END;
+IF x > 10227 THEN x := x - 1 END;
+IF x > 10228 THEN x := x - 1 END;
+IF x > 10229 THEN x := x - 1 END;
+IF x > 10230 THEN x := x - 1 END;
+IF x > 10231 THEN x := x - 1 END;
+IF x > 10232 THEN x := x - 1 END;
+IF x > 10233 THEN x := x - 1 END;
+IF x > 10234 THEN x := x - 1 END;
+IF x > 10235 THEN x := x - 1 END;
+IF x > 10236 THEN x := x - 1 END;
+IF x > 10237 THEN x := x - 1 END;
+IF x > 10238 THEN x := x - 1 END;
+IF x > 10239 THEN x := x - 1 END;
+IF x > 10240 THEN x := x - 1 END;
+IF x > 10241 THEN x := x - 1 END;
+IF x > 10242 THEN x := x - 1 END;
+IF x > 10243 THEN x := x - 1 END;
+IF x > 10244 THEN x := x - 1 END;
+IF x > 10245 THEN x := x - 1 END;
+IF x > 10246 THEN x := x - 1 END;
+IF x > 10247 THEN x := x - 1 END;
+IF x > 10248 THEN x := x - 1 END;
+IF x > 10249 THEN x := x - 1 END;
+IF x > 10250 THEN x := x - 1 END;
+IF x > 10251 THEN x := x - 1 END;
+IF x > 10252 THEN x := x - 1 END;
+IF x > 10253 THEN x := x - 1 END;
+IF x > 10254 THEN x := x - 1 END;
+IF x > 10255 THEN x := x - 1 END;
+IF x > 10256 THEN x := x - 1 END;
+IF x > 10257 THEN x := x - 1 END;
+IF x > 10258 THEN x := x - 1 END;
+IF x > 10259 THEN x := x - 1 END;
+IF x > 10260 THEN x := x - 1 END;
+IF x > 10261 THEN x := x - 1 END;
+IF x > 10262 THEN x := x - 1 END;
+IF x > 10263 THEN x := x - 1 END;
+IF x > 10264 THEN x := x - 1 END;
+IF x > 10265 THEN x := x - 1 END;
+IF x > 10266 THEN x := x - 1 END;
+IF x > 10267 THEN x := x - 1 END;
+IF x > 10268 THEN x := x - 1 END;
+IF x > 10269 THEN x := x - 1 END;
+IF x > 10270 THEN x := x - 1 END;
+IF x > 10271 THEN x := x - 1 END;
+IF x > 10272 THEN x := x - 1 END;
+IF x > 10273 THEN x := x - 1 END;
+IF x > 10274 THEN x := x - 1 END;
+IF x > 10275 THEN x := x - 1 END;
+IF x > 10276 THEN x := x - 1 END;
+IF x > 10277 THEN x := x - 1 END;
+IF x > 10278 THEN x := x - 1 END;
+IF x > 10279 THEN x := x - 1 END;
+IF x > 10280 THEN x := x - 1 END;
+IF x > 10281 THEN x := x - 1 END;
+IF x > 10282 THEN x := x - 1 END;
+IF x > 10283 THEN x := x - 1 END;
+IF x > 10284 THEN x := x - 1 END;
+IF x > 10285 THEN x := x - 1 END;
+IF x > 10286 THEN x := x - 1 END;
+IF x > 10287 THEN x := x - 1 END;
+IF x > 10288 THEN x := x - 1 END;
+IF x > 10289 THEN x := x - 1 END;
+IF x > 10290 THEN x := x - 1 END;
+IF x > 10291 THEN x := x - 1 END;
+IF x > 10292 THEN x := x - 1 END;
+IF x > 10293 THEN x := x - 1 END;
+IF x > 10294 THEN x := x - 1 END;
+IF x > 10295 THEN x := x - 1 END;
+IF x > 10296 THEN x := x - 1 END;
+IF x > 10297 THEN x := x - 1 END;
+IF x > 10298 THEN x := x - 1 END;
+IF x > 10299 THEN x := x - 1 END;
+IF x > 10300 THEN x := x - 1 END;
+IF x > 10301 THEN x := x - 1 END;
+IF x > 10302 THEN x := x - 1 END;
+IF x > 10303 THEN x := x - 1 END;
+IF x > 10304 THEN x := x - 1 END;
+IF x > 10305 THEN x := x - 1 END;
+IF x > 10306 THEN x := x - 1 END;
+IF x > 10307 THEN x := x - 1 END;
+IF x > 10308 THEN x := x - 1 END;
+IF x > 10309 THEN x := x - 1 END;
+IF x > 10310 THEN x := x - 1 END;
+IF x > 10311 THEN x := x - 1 END;
+IF x > 10312 THEN x := x - 1 END;
+IF x > 10313 THEN x := x - 1 END;
+IF x > 10314 THEN x := x - 1 END;
+IF x > 10315 THEN x := x - 1 END;
+IF x > 10316 THEN x := x - 1 END;
+IF x > 10317 THEN x := x - 1 END;
+IF x > 10318 THEN x := x - 1 END;
+IF x > 10319 THEN x := x - 1 END;
+IF x > 10320 THEN x := x - 1 END;
+IF x > 10321 THEN x := x - 1 END;
+IF x > 10322 THEN x := x - 1 END;
+IF x > 10323 THEN x := x - 1 END;
+IF x > 10324 THEN x := x - 1 END;
+IF x > 10325 THEN x := x - 1 END;
+IF x > 10326 THEN x := x - 1 END;
+IF x > 10327 THEN x := x - 1 END;
+IF x > 10328 THEN x := x - 1 END;
+IF x > 10329 THEN x := x - 1 END;
+IF x > 10330 THEN x := x - 1 END;
+IF x > 10331 THEN x := x - 1 END;
+IF x > 10332 THEN x := x - 1 END;
+IF x > 10333 THEN x := x - 1 END;
+IF x > 10334 THEN x := x - 1 END;
+IF x > 10335 THEN x := x - 1 END;
+IF x > 10336 THEN x := x - 1 END;
+IF x > 10337 THEN x := x - 1 END;
+IF x > 10338 THEN x := x - 1 END;
+IF x > 10339 THEN x := x - 1 END;
+IF x > 10340 THEN x := x - 1 END;
+IF x > 10341 THEN x := x - 1 END;
+IF x > 10342 THEN x := x - 1 END;
+IF x > 10343 THEN x := x - 1 END;
+IF x > 10344 THEN x := x - 1 END;
+IF x > 10345 THEN x := x - 1 END;
+IF x > 10346 THEN x := x - 1 END;
+IF x > 10347 THEN x := x - 1 END;
+IF x > 10348 THEN x := x - 1 END;
+IF x > 10349 THEN x := x - 1 END;
+IF x > 10350 THEN x := x - 1 END;
+IF x > 10351 THEN x := x - 1 END;
+IF x > 10352 THEN x := x - 1 END;
+IF x > 10353 THEN x := x - 1 END;
+IF x > 10354 THEN x := x - 1 END;
+IF x > 10355 THEN x := x - 1 END;
+IF x > 10356 THEN x := x - 1 END;
+IF x > 10357 THEN x := x - 1 END;
+IF x > 10358 THEN x := x - 1 END;
+IF x > 10359 THEN x := x - 1 END;
+IF x > 10360 THEN x := x - 1 END;
+IF x > 10361 THEN x := x - 1 END;
+IF x > 10362 THEN x := x - 1 END;
+IF x > 10363 THEN x := x - 1 END;
+IF x > 10364 THEN x := x - 1 END;
+IF x > 10365 THEN x := x - 1 END;
+IF x > 10366 THEN x := x - 1 END;
+IF x > 10367 THEN x := x - 1 END;
+IF x > 10368 THEN x := x - 1 END;
+IF x > 10369 THEN x := x - 1 END;
+IF x > 10370 THEN x := x - 1 END;
+IF x > 10371 THEN x := x - 1 END;
+IF x > 10372 THEN x := x - 1 END;
+IF x > 10373 THEN x := x - 1 END;
+IF x > 10374 THEN x := x - 1 END;
+IF x > 10375 THEN x := x - 1 END;
+IF x > 10376 THEN x := x - 1 END;
+IF x > 10377 THEN x := x - 1 END;
+IF x > 10378 THEN x := x - 1 END;
+IF x > 10379 THEN x := x - 1 END;
+IF x > 10380 THEN x := x - 1 END;
+IF x > 10381 THEN x := x - 1 END;
+IF x > 10382 THEN x := x - 1 END;
+IF x > 10383 THEN x := x - 1 END;
+IF x > 10384 THEN x := x - 1 END;
+IF x > 10385 THEN x := x - 1 END;
+IF x > 10386 THEN x := x - 1 END;
+IF x > 10387 THEN x := x - 1 END;
+IF x > 10388 THEN x := x - 1 END;
+IF x > 10389 THEN x := x - 1 END;
+IF x > 10390 THEN x := x - 1 END;
+IF x > 10391 THEN x := x - 1 END;
+IF x > 10392 THEN x := x - 1 END;
+IF x > 10393 THEN x := x - 1 END;
+IF x > 10394 THEN x := x - 1 END;
+IF x > 10395 THEN x := x - 1 END;
+IF x > 10396 THEN x := x - 1 END;
+IF x > 10397 THEN x := x - 1 END;
+IF x > 10398 THEN x := x - 1 END;
+IF x > 10399 THEN x := x - 1 END;
+IF x > 10400 THEN x := x - 1 END;
+IF x > 10401 THEN x := x - 1 END;
+IF x > 10402 THEN x := x - 1 END;
+IF x > 10403 THEN x := x - 1 END;
+IF x > 10404 THEN x := x - 1 END;
+IF x > 10405 THEN x := x - 1 END;
+IF x > 10406 THEN x := x - 1 END;
+IF x > 10407 THEN x := x - 1 END;
+IF x > 10408 THEN x := x - 1 END;
+IF x > 10409 THEN x := x - 1 END;
+IF x > 10410 THEN x := x - 1 END;
+IF x > 10411 THEN x := x - 1 END;
+IF x > 10412 THEN x := x - 1 END;
+IF x > 10413 THEN x := x - 1 END;
+IF x > 10414 THEN x := x - 1 END;
+IF x > 10415 THEN x := x - 1 END;
+IF x > 10416 THEN x := x - 1 END;
+IF x > 10417 THEN x := x - 1 END;
+IF x > 10418 THEN x := x - 1 END;
+IF x > 10419 THEN x := x - 1 END;
+IF x > 10420 THEN x := x - 1 END;
+IF x > 10421 THEN x := x - 1 END;
+IF x > 10422 THEN x := x - 1 END;
+IF x > 10423 THEN x := x - 1 END;
+IF x > 10424 THEN x := x - 1 END;
+IF x > 10425 THEN x := x - 1 END;
+IF x > 10426 THEN x := x - 1 END;
+IF x > 10427 THEN x := x - 1 END;
+IF x > 10428 THEN x := x - 1 END;
+IF x > 10429 THEN x := x - 1 END;
+IF x > 10430 THEN x := x - 1 END;
+IF x > 10431 THEN x := x - 1 END;
+IF x > 10432 THEN x := x - 1 END;
+IF x > 10433 THEN x := x - 1 END;
+IF x > 10434 THEN x := x - 1 END;
+IF x > 10435 THEN x := x - 1 END;
+IF x > 10436 THEN x := x - 1 END;
+IF x > 10437 THEN x := x - 1 END;
+IF x > 10438 THEN x := x - 1 END;
+IF x > 10439 THEN x := x - 1 END;
+IF x > 10440 THEN x := x - 1 END;
+IF x > 10441 THEN x := x - 1 END;
+IF x > 10442 THEN x := x - 1 END;
+IF x > 10443 THEN x := x - 1 END;
+IF x > 10444 THEN x := x - 1 END;
+IF x > 10445 THEN x := x - 1 END;
+IF x > 10446 THEN x := x - 1 END;
+IF x > 10447 THEN x := x - 1 END;
+IF x > 10448 THEN x := x - 1 END;
+IF x > 10449 THEN x := x - 1 END;
+IF x > 10450 THEN x := x - 1 END;
+IF x > 10451 THEN x := x - 1 END;
+IF x > 10452 THEN x := x - 1 END;
+IF x > 10453 THEN x := x - 1 END;
+IF x > 10454 THEN x := x - 1 END;
+IF x > 10455 THEN x := x - 1 END;
+IF x > 10456 THEN x := x - 1 END;
+IF x > 10457 THEN x := x - 1 END;
+IF x > 10458 THEN x := x - 1 END;
+IF x > 10459 THEN x := x - 1 END;
+IF x > 10460 THEN x := x - 1 END;
+IF x > 10461 THEN x := x - 1 END;
+IF x > 10462 THEN x := x - 1 END;
+IF x > 10463 THEN x := x - 1 END;
+IF x > 10464 THEN x := x - 1 END;
+IF x > 10465 THEN x := x - 1 END;
+IF x > 10466 THEN x := x - 1 END;
+IF x > 10467 THEN x := x - 1 END;
+IF x > 10468 THEN x := x - 1 END;
+IF x > 10469 THEN x := x - 1 END;
+IF x > 10470 THEN x := x - 1 END;
+IF x > 10471 THEN x := x - 1 END;
+IF x > 10472 THEN x := x - 1 END;
+IF x > 10473 THEN x := x - 1 END;
+IF x > 10474 THEN x := x - 1 END;
+IF x > 10475 THEN x := x - 1 END;
+IF x > 10476 THEN x := x - 1 END;
+IF x > 10477 THEN x := x - 1 END;
+IF x > 10478 THEN x := x - 1 END;
+IF x > 10479 THEN x := x - 1 END;
+IF x > 10480 THEN x := x - 1 END;
+IF x > 10481 THEN x := x - 1 END;
+IF x > 10482 THEN x := x - 1 END;
+IF x > 10483 THEN x := x - 1 END;
+IF x > 10484 THEN x := x - 1 END;
+IF x > 10485 THEN x := x - 1 END;
+IF x > 10486 THEN x := x - 1 END;
+IF x > 10487 THEN x := x - 1 END;
+IF x > 10488 THEN x := x - 1 END;
+IF x > 10489 THEN x := x - 1 END;
+IF x > 10490 THEN x := x - 1 END;
+IF x > 10491 THEN x := x - 1 END;
+IF x > 10492 THEN x := x - 1 END;
+IF x > 10493 THEN x := x - 1 END;
+IF x > 10494 THEN x := x - 1 END;
+IF x > 10495 THEN x := x - 1 END;
+IF x > 10496 THEN x := x - 1 END;
+IF x > 10497 THEN x := x - 1 END;
+IF x > 10498 THEN x := x - 1 END;
+IF x > 10499 THEN x := x - 1 END;
+IF x > 10500 THEN x := x - 1 END;
+IF x > 10501 THEN x := x - 1 END;
+IF x > 10502 THEN x := x - 1 END;
+IF x > 10503 THEN x := x - 1 END;
+IF x > 10504 THEN x := x - 1 END;
+IF x > 10505 THEN x := x - 1 END;
+IF x > 10506 THEN x := x - 1 END;
+IF x > 10507 THEN x := x - 1 END;
+IF x > 10508 THEN x := x - 1 END;
+IF x > 10509 THEN x := x - 1 END;
+IF x > 10510 THEN x := x - 1 END;
+IF x > 10511 THEN x := x - 1 END;
+IF x > 10512 THEN x := x - 1 END;
+IF x > 10513 THEN x := x - 1 END;
+IF x > 10514 THEN x := x - 1 END;
+IF x > 10515 THEN x := x - 1 END;
+IF x > 10516 THEN x := x - 1 END;
+IF x > 10517 THEN x := x - 1 END;
+IF x > 10518 THEN x := x - 1 END;
+IF x > 10519 THEN x := x - 1 END;
+IF x > 10520 THEN x := x - 1 END;
+IF x > 10521 THEN x := x - 1 END;
+IF x > 10522 THEN x := x - 1 END;
+IF x > 10523 THEN x := x - 1 END;
+IF x > 10524 THEN x := x - 1 END;
+IF x > 10525 THEN x := x - 1 END;
+IF x > 10526 THEN x := x - 1 END;
+IF x > 10527 THEN x := x - 1 END;
+IF x > 10528 THEN x := x - 1 END;
+IF x > 10529 THEN x := x - 1 END;
+IF x > 10530 THEN x := x - 1 END;
+IF x > 10531 THEN x := x - 1 END;
+IF x > 10532 THEN x := x - 1 END;
+IF x > 10533 THEN x := x - 1 END;
+IF x > 10534 THEN x := x - 1 END;
+IF x > 10535 THEN x := x - 1 END;
+IF x > 10536 THEN x := x - 1 END;
+IF x > 10537 THEN x := x - 1 END;
+IF x > 10538 THEN x := x - 1 END;
+IF x > 10539 THEN x := x - 1 END;
+IF x > 10540 THEN x := x - 1 END;
+IF x > 10541 THEN x := x - 1 END;
+IF x > 10542 THEN x := x - 1 END;
+IF x > 10543 THEN x := x - 1 END;
+IF x > 10544 THEN x := x - 1 END;
+IF x > 10545 THEN x := x - 1 END;
+IF x > 10546 THEN x := x - 1 END;
+IF x > 10547 THEN x := x - 1 END;
+IF x > 10548 THEN x := x - 1 END;
+IF x > 10549 THEN x := x - 1 END;
+IF x > 10550 THEN x := x - 1 END;
+IF x > 10551 THEN x := x - 1 END;
+IF x > 10552 THEN x := x - 1 END;
+IF x > 10553 THEN x := x - 1 END;
+IF x > 10554 THEN x := x - 1 END;
+IF x > 10555 THEN x := x - 1 END;
+IF x > 10556 THEN x := x - 1 END;
+IF x > 10557 THEN x := x - 1 END;
+IF x > 10558 THEN x := x - 1 END;
+IF x > 10559 THEN x := x - 1 END;
+IF x > 10560 THEN x := x - 1 END;
+IF x > 10561 THEN x := x - 1 END;
+IF x > 10562 THEN x := x - 1 END;
+IF x > 10563 THEN x := x - 1 END;
+IF x > 10564 THEN x := x - 1 END;
+IF x > 10565 THEN x := x - 1 END;
+IF x > 10566 THEN x := x - 1 END;
+IF x > 10567 THEN x := x - 1 END;
+IF x > 10568 THEN x := x - 1 END;
+IF x > 10569 THEN x := x - 1 END;
+IF x > 10570 THEN x := x - 1 END;
+IF x > 10571 THEN x := x - 1 END;
+IF x > 10572 THEN x := x - 1 END;
+IF x > 10573 THEN x := x - 1 END;
+IF x > 10574 THEN x := x - 1 END;
+IF x > 10575 THEN x := x - 1 END;
+IF x > 10576 THEN x := x - 1 END;
+IF x > 10577 THEN x := x - 1 END;
+IF x > 10578 THEN x := x - 1 END;
+IF x > 10579 THEN x := x - 1 END;
+IF x > 10580 THEN x := x - 1 END;
+IF x > 10581 THEN x := x - 1 END;
+IF x > 10582 THEN x := x - 1 END;
+IF x > 10583 THEN x := x - 1 END;
+IF x > 10584 THEN x := x - 1 END;
+IF x > 10585 THEN x := x - 1 END;
+IF x > 10586 THEN x := x - 1 END;
+IF x > 10587 THEN x := x - 1 END;
+IF x > 10588 THEN x := x - 1 END;
+IF x > 10589 THEN x := x - 1 END;
+IF x > 10590 THEN x := x - 1 END;
+IF x > 10591 THEN x := x - 1 END;
+IF x > 10592 THEN x := x - 1 END;
+IF x > 10593 THEN x := x - 1 END;
+IF x > 10594 THEN x := x - 1 END;
+IF x > 10595 THEN x := x - 1 END;
+IF x > 10596 THEN x := x - 1 END;
+IF x > 10597 THEN x := x - 1 END;
+IF x > 10598 THEN x := x - 1 END;
+IF x > 10599 THEN x := x - 1 END;
+IF x > 10600 THEN x := x - 1 END;
+IF x > 10601 THEN x := x - 1 END;
+IF x > 10602 THEN x := x - 1 END;
+IF x > 10603 THEN x := x - 1 END;
+IF x > 10604 THEN x := x - 1 END;
+IF x > 10605 THEN x := x - 1 END;
+IF x > 10606 THEN x := x - 1 END;
+IF x > 10607 THEN x := x - 1 END;
+IF x > 10608 THEN x := x - 1 END;
+IF x > 10609 THEN x := x - 1 END;
+IF x > 10610 THEN x := x - 1 END;
+IF x > 10611 THEN x := x - 1 END;
+IF x > 10612 THEN x := x - 1 END;
+IF x > 10613 THEN x := x - 1 END;
+IF x > 10614 THEN x := x - 1 END;
+IF x > 10615 THEN x := x - 1 END;
+IF x > 10616 THEN x := x - 1 END;
+IF x > 10617 THEN x := x - 1 END;
+IF x > 10618 THEN x := x - 1 END;
+IF x > 10619 THEN x := x - 1 END;
+IF x > 10620 THEN x := x - 1 END;
+IF x > 10621 THEN x := x - 1 END;
+IF x > 10622 THEN x := x - 1 END;
+IF x > 10623 THEN x := x - 1 END;
+IF x > 10624 THEN x := x - 1 END;
+IF x > 10625 THEN x := x - 1 END;
+IF x > 10626 THEN x := x - 1 END;
+IF x > 10627 THEN x := x - 1 END;
+IF x > 10628 THEN x := x - 1 END;
+IF x > 10629 THEN x := x - 1 END;
+IF x > 10630 THEN x := x - 1 END;
+IF x > 10631 THEN x := x - 1 END;
+IF x > 10632 THEN x := x - 1 END;
+IF x > 10633 THEN x := x - 1 END;
+IF x > 10634 THEN x := x - 1 END;
+IF x > 10635 THEN x := x - 1 END;
+IF x > 10636 THEN x := x - 1 END;
+IF x > 10637 THEN x := x - 1 END;
+IF x > 10638 THEN x := x - 1 END;
+IF x > 10639 THEN x := x - 1 END;
+IF x > 10640 THEN x := x - 1 END;
+IF x > 10641 THEN x := x - 1 END;
+IF x > 10642 THEN x := x - 1 END;
+IF x > 10643 THEN x := x - 1 END;
+IF x > 10644 THEN x := x - 1 END;
+IF x > 10645 THEN x := x - 1 END;
+IF x > 10646 THEN x := x - 1 END;
+IF x > 10647 THEN x := x - 1 END;
+IF x > 10648 THEN x := x - 1 END;
+IF x > 10649 THEN x := x - 1 END;
+IF x > 10650 THEN x := x - 1 END;
+IF x > 10651 THEN x := x - 1 END;
+IF x > 10652 THEN x := x - 1 END;
+IF x > 10653 THEN x := x - 1 END;
+IF x > 10654 THEN x := x - 1 END;
+IF x > 10655 THEN x := x - 1 END;
+IF x > 10656 THEN x := x - 1 END;
+IF x > 10657 THEN x := x - 1 END;
+IF x > 10658 THEN x := x - 1 END;
+IF x > 10659 THEN x := x - 1 END;
+IF x > 10660 THEN x := x - 1 END;
+IF x > 10661 THEN x := x - 1 END;
+IF x > 10662 THEN x := x - 1 END;
+IF x > 10663 THEN x := x - 1 END;
+IF x > 10664 THEN x := x - 1 END;
+IF x > 10665 THEN x := x - 1 END;
+IF x > 10666 THEN x := x - 1 END;
+IF x > 10667 THEN x := x - 1 END;
+IF x > 10668 THEN x := x - 1 END;
+IF x > 10669 THEN x := x - 1 END;
+IF x > 10670 THEN x := x - 1 END;
+IF x > 10671 THEN x := x - 1 END;
+IF x > 10672 THEN x := x - 1 END;
+IF x > 10673 THEN x := x - 1 END;
+IF x > 10674 THEN x := x - 1 END;
+IF x > 10675 THEN x := x - 1 END;
+IF x > 10676 THEN x := x - 1 END;
+IF x > 10677 THEN x := x - 1 END;
+IF x > 10678 THEN x := x - 1 END;
+IF x > 10679 THEN x := x - 1 END;
+IF x > 10680 THEN x := x - 1 END;
+IF x > 10681 THEN x := x - 1 END;
+IF x > 10682 THEN x := x - 1 END;
+IF x > 10683 THEN x := x - 1 END;
+IF x > 10684 THEN x := x - 1 END;
+IF x > 10685 THEN x := x - 1 END;
+IF x > 10686 THEN x := x - 1 END;
+IF x > 10687 THEN x := x - 1 END;
+IF x > 10688 THEN x := x - 1 END;
+IF x > 10689 THEN x := x - 1 END;
+IF x > 10690 THEN x := x - 1 END;
+IF x > 10691 THEN x := x - 1 END;
+IF x > 10692 THEN x := x - 1 END;
+IF x > 10693 THEN x := x - 1 END;
+IF x > 10694 THEN x := x - 1 END;
+IF x > 10695 THEN x := x - 1 END;
+IF x > 10696 THEN x := x - 1 END;
+IF x > 10697 THEN x := x - 1 END;
+IF x > 10698 THEN x := x - 1 END;
+IF x > 10699 THEN x := x - 1 END;
+IF x > 10700 THEN x := x - 1 END;
+IF x > 10701 THEN x := x - 1 END;
+IF x > 10702 THEN x := x - 1 END;
+IF x > 10703 THEN x := x - 1 END;
+IF x > 10704 THEN x := x - 1 END;
+IF x > 10705 THEN x := x - 1 END;
+IF x > 10706 THEN x := x - 1 END;
+IF x > 10707 THEN x := x - 1 END;
+IF x > 10708 THEN x := x - 1 END;
+IF x > 10709 THEN x := x - 1 END;
+IF x > 10710 THEN x := x - 1 END;
+IF x > 10711 THEN x := x - 1 END;
+IF x > 10712 THEN x := x - 1 END;
+IF x > 10713 THEN x := x - 1 END;
+IF x > 10714 THEN x := x - 1 END;
+IF x > 10715 THEN x := x - 1 END;
+IF x > 10716 THEN x := x - 1 END;
+IF x > 10717 THEN x := x - 1 END;
+IF x > 10718 THEN x := x - 1 END;
+IF x > 10719 THEN x := x - 1 END;
+IF x > 10720 THEN x := x - 1 END;
+IF x > 10721 THEN x := x - 1 END;
+IF x > 10722 THEN x := x - 1 END;
+IF x > 10723 THEN x := x - 1 END;
+IF x > 10724 THEN x := x - 1 END;
+IF x > 10725 THEN x := x - 1 END;
+IF x > 10726 THEN x := x - 1 END;
+IF x > 10727 THEN x := x - 1 END;
+IF x > 10728 THEN x := x - 1 END;
+IF x > 10729 THEN x := x - 1 END;
+IF x > 10730 THEN x := x - 1 END;
+IF x > 10731 THEN x := x - 1 END;
+IF x > 10732 THEN x := x - 1 END;
+IF x > 10733 THEN x := x - 1 END;
+IF x > 10734 THEN x := x - 1 END;
+IF x > 10735 THEN x := x - 1 END;
+IF x > 10736 THEN x := x - 1 END;
+IF x > 10737 THEN x := x - 1 END;
+IF x > 10738 THEN x := x - 1 END;
+IF x > 10739 THEN x := x - 1 END;
+IF x > 10740 THEN x := x - 1 END;
+IF x > 10741 THEN x := x - 1 END;
+IF x > 10742 THEN x := x - 1 END;
+IF x > 10743 THEN x := x - 1 END;
+IF x > 10744 THEN x := x - 1 END;
+IF x > 10745 THEN x := x - 1 END;
+IF x > 10746 THEN x := x - 1 END;
+IF x > 10747 THEN x := x - 1 END;
+IF x > 10748 THEN x := x - 1 END;
+IF x > 10749 THEN x := x - 1 END;
+IF x > 10750 THEN x := x - 1 END;
+IF x > 10751 THEN x := x - 1 END;
+IF x > 10752 THEN x := x - 1 END;
+IF x > 10753 THEN x := x - 1 END;
+IF x > 10754 THEN x := x - 1 END;
+IF x > 10755 THEN x := x - 1 END;
+IF x > 10756 THEN x := x - 1 END;
+IF x > 10757 THEN x := x - 1 END;
+IF x > 10758 THEN x := x - 1 END;
+IF x > 10759 THEN x := x - 1 END;
+IF x > 10760 THEN x := x - 1 END;
+IF x > 10761 THEN x := x - 1 END;
+IF x > 10762 THEN x := x - 1 END;
+IF x > 10763 THEN x := x - 1 END;
+IF x > 10764 THEN x := x - 1 END;
+IF x > 10765 THEN x := x - 1 END;
+IF x > 10766 THEN x := x - 1 END;
+IF x > 10767 THEN x := x - 1 END;
+IF x > 10768 THEN x := x - 1 END;
+IF x > 10769 THEN x := x - 1 END;
+IF x > 10770 THEN x := x - 1 END;
+IF x > 10771 THEN x := x - 1 END;
+IF x > 10772 THEN x := x - 1 END;
+IF x > 10773 THEN x := x - 1 END;
+IF x > 10774 THEN x := x - 1 END;
+IF x > 10775 THEN x := x - 1 END;
+IF x > 10776 THEN x := x - 1 END;
+IF x > 10777 THEN x := x - 1 END;
+IF x > 10778 THEN x := x - 1 END;
+IF x > 10779 THEN x := x - 1 END;
+IF x > 10780 THEN x := x - 1 END;
+IF x > 10781 THEN x := x - 1 END;
+IF x > 10782 THEN x := x - 1 END;
+IF x > 10783 THEN x := x - 1 END;
+IF x > 10784 THEN x := x - 1 END;
+IF x > 10785 THEN x := x - 1 END;
+IF x > 10786 THEN x := x - 1 END;
+IF x > 10787 THEN x := x - 1 END;
+IF x > 10788 THEN x := x - 1 END;
+IF x > 10789 THEN x := x - 1 END;
+IF x > 10790 THEN x := x - 1 END;
+IF x > 10791 THEN x := x - 1 END;
+IF x > 10792 THEN x := x - 1 END;
+IF x > 10793 THEN x := x - 1 END;
+IF x > 10794 THEN x := x - 1 END;
+IF x > 10795 THEN x := x - 1 END;
+IF x > 10796 THEN x := x - 1 END;
+IF x > 10797 THEN x := x - 1 END;
+IF x > 10798 THEN x := x - 1 END;
+IF x > 10799 THEN x := x - 1 END;
+IF x > 10800 THEN x := x - 1 END;
+IF x > 10801 THEN x := x - 1 END;
+IF x > 10802 THEN x := x - 1 END;
+IF x > 10803 THEN x := x - 1 END;
+IF x > 10804 THEN x := x - 1 END;
+IF x > 10805 THEN x := x - 1 END;
+IF x > 10806 THEN x := x - 1 END;
+IF x > 10807 THEN x := x - 1 END;
+IF x > 10808 THEN x := x - 1 END;
+IF x > 10809 THEN x := x - 1 END;
+IF x > 10810 THEN x := x - 1 END;
+IF x > 10811 THEN x := x - 1 END;
+IF x > 10812 THEN x := x - 1 END;
+IF x > 10813 THEN x := x - 1 END;
+IF x > 10814 THEN x := x - 1 END;
+IF x > 10815 THEN x := x - 1 END;
+IF x > 10816 THEN x := x - 1 END;
+IF x > 10817 THEN x := x - 1 END;
+IF x > 10818 THEN x := x - 1 END;
+IF x > 10819 THEN x := x - 1 END;
+IF x > 10820 THEN x := x - 1 END;
+IF x > 10821 THEN x := x - 1 END;
+IF x > 10822 THEN x := x - 1 END;
+IF x > 10823 THEN x := x - 1 END;
+IF x > 10824 THEN x := x - 1 END;
+IF x > 10825 THEN x := x - 1 END;
+IF x > 10826 THEN x := x - 1 END;
+IF x > 10827 THEN x := x - 1 END;
+IF x > 10828 THEN x := x - 1 END;
+IF x > 10829 THEN x := x - 1 END;
+IF x > 10830 THEN x := x - 1 END;
+IF x > 10831 THEN x := x - 1 END;
+IF x > 10832 THEN x := x - 1 END;
+IF x > 10833 THEN x := x - 1 END;
+IF x > 10834 THEN x := x - 1 END;
+IF x > 10835 THEN x := x - 1 END;
+IF x > 10836 THEN x := x - 1 END;
+IF x > 10837 THEN x := x - 1 END;
+IF x > 10838 THEN x := x - 1 END;
+IF x > 10839 THEN x := x - 1 END;
+IF x > 10840 THEN x := x - 1 END;
+IF x > 10841 THEN x := x - 1 END;
+IF x > 10842 THEN x := x - 1 END;
+IF x > 10843 THEN x := x - 1 END;
+IF x > 10844 THEN x := x - 1 END;
+IF x > 10845 THEN x := x - 1 END;
+IF x > 10846 THEN x := x - 1 END;
+IF x > 10847 THEN x := x - 1 END;
+IF x > 10848 THEN x := x - 1 END;
+IF x > 10849 THEN x := x - 1 END;
+IF x > 10850 THEN x := x - 1 END;
+IF x > 10851 THEN x := x - 1 END;
+IF x > 10852 THEN x := x - 1 END;
+IF x > 10853 THEN x := x - 1 END;
+IF x > 10854 THEN x := x - 1 END;
+IF x > 10855 THEN x := x - 1 END;
+IF x > 10856 THEN x := x - 1 END;
+IF x > 10857 THEN x := x - 1 END;
+IF x > 10858 THEN x := x - 1 END;
+IF x > 10859 THEN x := x - 1 END;
+IF x > 10860 THEN x := x - 1 END;
+IF x > 10861 THEN x := x - 1 END;
+IF x > 10862 THEN x := x - 1 END;
+IF x > 10863 THEN x := x - 1 END;
+IF x > 10864 THEN x := x - 1 END;
+IF x > 10865 THEN x := x - 1 END;
+IF x > 10866 THEN x := x - 1 END;
+IF x > 10867 THEN x := x - 1 END;
+IF x > 10868 THEN x := x - 1 END;
+IF x > 10869 THEN x := x - 1 END;
+IF x > 10870 THEN x := x - 1 END;
+IF x > 10871 THEN x := x - 1 END;
+IF x > 10872 THEN x := x - 1 END;
+IF x > 10873 THEN x := x - 1 END;
+IF x > 10874 THEN x := x - 1 END;
+IF x > 10875 THEN x := x - 1 END;
+IF x > 10876 THEN x := x - 1 END;
+IF x > 10877 THEN x := x - 1 END;
+IF x > 10878 THEN x := x - 1 END;
+IF x > 10879 THEN x := x - 1 END;
+IF x > 10880 THEN x := x - 1 END;
+IF x > 10881 THEN x := x - 1 END;
+IF x > 10882 THEN x := x - 1 END;
+IF x > 10883 THEN x := x - 1 END;
+IF x > 10884 THEN x := x - 1 END;
+IF x > 10885 THEN x := x - 1 END;
+IF x > 10886 THEN x := x - 1 END;
+IF x > 10887 THEN x := x - 1 END;
+IF x > 10888 THEN x := x - 1 END;
+IF x > 10889 THEN x := x - 1 END;
+IF x > 10890 THEN x := x - 1 END;
+IF x > 10891 THEN x := x - 1 END;
+IF x > 10892 THEN x := x - 1 END;
+IF x > 10893 THEN x := x - 1 END;
+IF x > 10894 THEN x := x - 1 END;
+IF x > 10895 THEN x := x - 1 END;
+IF x > 10896 THEN x := x - 1 END;
+IF x > 10897 THEN x := x - 1 END;
+IF x > 10898 THEN x := x - 1 END;
+IF x > 10899 THEN x := x - 1 END;
+IF x > 10900 THEN x := x - 1 END;
+IF x > 10901 THEN x := x - 1 END;
+IF x > 10902 THEN x := x - 1 END;
+IF x > 10903 THEN x := x - 1 END;
+IF x > 10904 THEN x := x - 1 END;
+IF x > 10905 THEN x := x - 1 END;
+IF x > 10906 THEN x := x - 1 END;
+IF x > 10907 THEN x := x - 1 END;
+IF x > 10908 THEN x := x - 1 END;
+IF x > 10909 THEN x := x - 1 END;
+IF x > 10910 THEN x := x - 1 END;
+IF x > 10911 THEN x := x - 1 END;
+IF x > 10912 THEN x := x - 1 END;
+IF x > 10913 THEN x := x - 1 END;
+IF x > 10914 THEN x := x - 1 END;
+IF x > 10915 THEN x := x - 1 END;
+IF x > 10916 THEN x := x - 1 END;
+IF x > 10917 THEN x := x - 1 END;
+IF x > 10918 THEN x := x - 1 END;
+IF x > 10919 THEN x := x - 1 END;
+IF x > 10920 THEN x := x - 1 END;
+IF x > 10921 THEN x := x - 1 END;
+IF x > 10922 THEN x := x - 1 END;
+IF x > 10923 THEN x := x - 1 END;
+IF x > 10924 THEN x := x - 1 END;
+IF x > 10925 THEN x := x - 1 END;
+IF x > 10926 THEN x := x - 1 END;
+IF x > 10927 THEN x := x - 1 END;
+IF x > 10928 THEN x := x - 1 END;
+IF x > 10929 THEN x := x - 1 END;
+IF x > 10930 THEN x := x - 1 END;
+IF x > 10931 THEN x := x - 1 END;
+IF x > 10932 THEN x := x - 1 END;
+IF x > 10933 THEN x := x - 1 END;
+IF x > 10934 THEN x := x - 1 END;
+IF x > 10935 THEN x := x - 1 END;
+IF x > 10936 THEN x := x - 1 END;
+IF x > 10937 THEN x := x - 1 END;
+IF x > 10938 THEN x := x - 1 END;
+IF x > 10939 THEN x := x - 1 END;
+IF x > 10940 THEN x := x - 1 END;
+IF x > 10941 THEN x := x - 1 END;
+IF x > 10942 THEN x := x - 1 END;
+IF x > 10943 THEN x := x - 1 END;
+IF x > 10944 THEN x := x - 1 END;
+IF x > 10945 THEN x := x - 1 END;
+IF x > 10946 THEN x := x - 1 END;
+IF x > 10947 THEN x := x - 1 END;
+IF x > 10948 THEN x := x - 1 END;
+IF x > 10949 THEN x := x - 1 END;
+IF x > 10950 THEN x := x - 1 END;
+IF x > 10951 THEN x := x - 1 END;
+IF x > 10952 THEN x := x - 1 END;
+IF x > 10953 THEN x := x - 1 END;
+IF x > 10954 THEN x := x - 1 END;
+IF x > 10955 THEN x := x - 1 END;
+IF x > 10956 THEN x := x - 1 END;
+IF x > 10957 THEN x := x - 1 END;
+IF x > 10958 THEN x := x - 1 END;
+IF x > 10959 THEN x := x - 1 END;
+IF x > 10960 THEN x := x - 1 END;
+IF x > 10961 THEN x := x - 1 END;
+IF x > 10962 THEN x := x - 1 END;
+IF x > 10963 THEN x := x - 1 END;
+IF x > 10964 THEN x := x - 1 END;
+IF x > 10965 THEN x := x - 1 END;
+IF x > 10966 THEN x := x - 1 END;
+IF x > 10967 THEN x := x - 1 END;
+IF x > 10968 THEN x := x - 1 END;
+IF x > 10969 THEN x := x - 1 END;
+IF x > 10970 THEN x := x - 1 END;
+IF x > 10971 THEN x := x - 1 END;
+IF x > 10972 THEN x := x - 1 END;
+IF x > 10973 THEN x := x - 1 END;
+IF x > 10974 THEN x := x - 1 END;
+IF x > 10975 THEN x := x - 1 END;
+IF x > 10976 THEN x := x - 1 END;
+IF x > 10977 THEN x := x - 1 END;
+IF x > 10978 THEN x := x - 1 END;
+IF x > 10979 THEN x := x - 1 END;
+IF x > 10980 THEN x := x - 1 END;
+IF x > 10981 THEN x := x - 1 END;
+IF x > 10982 THEN x := x - 1 END;
+IF x > 10983 THEN x := x - 1 END;
+IF x > 10984 THEN x := x - 1 END;
+IF x > 10985 THEN x := x - 1 END;
+IF x > 10986 THEN x := x - 1 END;
+IF x > 10987 THEN x := x - 1 END;
+IF x > 10988 THEN x := x - 1 END;
+IF x > 10989 THEN x := x - 1 END;
+IF x > 10990 THEN x := x - 1 END;
+IF x > 10991 THEN x := x - 1 END;
+IF x > 10992 THEN x := x - 1 END;
+IF x > 10993 THEN x := x - 1 END;
+IF x > 10994 THEN x := x - 1 END;
+IF x > 10995 THEN x := x - 1 END;
+IF x > 10996 THEN x := x - 1 END;
+IF x > 10997 THEN x := x - 1 END;
+IF x > 10998 THEN x := x - 1 END;
+IF x > 10999 THEN x := x - 1 END;
+IF x > 11000 THEN x := x - 1 END;
+IF x > 11001 THEN x := x - 1 END;
+IF x > 11002 THEN x := x - 1 END;
+IF x > 11003 THEN x := x - 1 END;
+IF x > 11004 THEN x := x - 1 END;
+IF x > 11005 THEN x := x - 1 END;
+IF x > 11006 THEN x := x - 1 END;
+IF x > 11007 THEN x := x - 1 END;
+IF x > 11008 THEN x := x - 1 END;
+IF x > 11009 THEN x := x - 1 END;
+IF x > 11010 THEN x := x - 1 END;
+IF x > 11011 THEN x := x - 1 END;
+IF x > 11012 THEN x := x - 1 END;
+IF x > 11013 THEN x := x - 1 END;
+IF x > 11014 THEN x := x - 1 END;
+IF x > 11015 THEN x := x - 1 END;
+IF x > 11016 THEN x := x - 1 END;
+IF x > 11017 THEN x := x - 1 END;
+IF x > 11018 THEN x := x - 1 END;
+IF x > 11019 THEN x := x - 1 END;
+IF x > 11020 THEN x := x - 1 END;
+IF x > 11021 THEN x := x - 1 END;
+IF x > 11022 THEN x := x - 1 END;
+IF x > 11023 THEN x := x - 1 END;
+IF x > 11024 THEN x := x - 1 END;
+IF x > 11025 THEN x := x - 1 END;
+IF x > 11026 THEN x := x - 1 END;
+IF x > 11027 THEN x := x - 1 END;
+IF x > 11028 THEN x := x - 1 END;
+IF x > 11029 THEN x := x - 1 END;
+IF x > 11030 THEN x := x - 1 END;
+IF x > 11031 THEN x := x - 1 END;
+IF x > 11032 THEN x := x - 1 END;
+IF x > 11033 THEN x := x - 1 END;
+IF x > 11034 THEN x := x - 1 END;
+IF x > 11035 THEN x := x - 1 END;
+IF x > 11036 THEN x := x - 1 END;
+IF x > 11037 THEN x := x - 1 END;
+IF x > 11038 THEN x := x - 1 END;
+IF x > 11039 THEN x := x - 1 END;
+IF x > 11040 THEN x := x - 1 END;
+IF x > 11041 THEN x := x - 1 END;
+IF x > 11042 THEN x := x - 1 END;
+IF x > 11043 THEN x := x - 1 END;
+IF x > 11044 THEN x := x - 1 END;
+IF x > 11045 THEN x := x - 1 END;
+IF x > 11046 THEN x := x - 1 END;
+IF x > 11047 THEN x := x - 1 END;
+IF x > 11048 THEN x := x - 1 END;
+IF x > 11049 THEN x := x - 1 END;
+IF x > 11050 THEN x := x - 1 END;
+IF x > 11051 THEN x := x - 1 END;
+IF x > 11052 THEN x := x - 1 END;
+IF x > 11053 THEN x := x - 1 END;
+IF x > 11054 THEN x := x - 1 END;
+IF x > 11055 THEN x := x - 1 END;
+IF x > 11056 THEN x := x - 1 END;
+IF x > 11057 THEN x := x - 1 END;
+IF x > 11058 THEN x := x - 1 END;
+IF x > 11059 THEN x := x - 1 END;
+IF x > 11060 THEN x := x - 1 END;
+IF x > 11061 THEN x := x - 1 END;
+IF x > 11062 THEN x := x - 1 END;
+IF x > 11063 THEN x := x - 1 END;
+IF x > 11064 THEN x := x - 1 END;
+IF x > 11065 THEN x := x - 1 END;
+IF x > 11066 THEN x := x - 1 END;
+IF x > 11067 THEN x := x - 1 END;
+IF x > 11068 THEN x := x - 1 END;
+IF x > 11069 THEN x := x - 1 END;
+IF x > 11070 THEN x := x - 1 END;
+IF x > 11071 THEN x := x - 1 END;
+IF x > 11072 THEN x := x - 1 END;
+IF x > 11073 THEN x := x - 1 END;
+IF x > 11074 THEN x := x - 1 END;
+IF x > 11075 THEN x := x - 1 END;
+IF x > 11076 THEN x := x - 1 END;
+IF x > 11077 THEN x := x - 1 END;
+IF x > 11078 THEN x := x - 1 END;
+IF x > 11079 THEN x := x - 1 END;
+IF x > 11080 THEN x := x - 1 END;
+IF x > 11081 THEN x := x - 1 END;
+IF x > 11082 THEN x := x - 1 END;
+IF x > 11083 THEN x := x - 1 END;
+IF x > 11084 THEN x := x - 1 END;
+IF x > 11085 THEN x := x - 1 END;
+IF x > 11086 THEN x := x - 1 END;
+IF x > 11087 THEN x := x - 1 END;
+IF x > 11088 THEN x := x - 1 END;
+IF x > 11089 THEN x := x - 1 END;
+IF x > 11090 THEN x := x - 1 END;
+IF x > 11091 THEN x := x - 1 END;
+IF x > 11092 THEN x := x - 1 END;
+IF x > 11093 THEN x := x - 1 END;
+IF x > 11094 THEN x := x - 1 END;
+IF x > 11095 THEN x := x - 1 END;
+IF x > 11096 THEN x := x - 1 END;
+IF x > 11097 THEN x := x - 1 END;
+IF x > 11098 THEN x := x - 1 END;
+IF x > 11099 THEN x := x - 1 END;
+IF x > 11100 THEN x := x - 1 END;
+IF x > 11101 THEN x := x - 1 END;
+IF x > 11102 THEN x := x - 1 END;
+IF x > 11103 THEN x := x - 1 END;
+IF x > 11104 THEN x := x - 1 END;
+IF x > 11105 THEN x := x - 1 END;
+IF x > 11106 THEN x := x - 1 END;
+IF x > 11107 THEN x := x - 1 END;
+IF x > 11108 THEN x := x - 1 END;
+IF x > 11109 THEN x := x - 1 END;
+IF x > 11110 THEN x := x - 1 END;
+IF x > 11111 THEN x := x - 1 END;
+IF x > 11112 THEN x := x - 1 END;
+IF x > 11113 THEN x := x - 1 END;
+IF x > 11114 THEN x := x - 1 END;
+IF x > 11115 THEN x := x - 1 END;
+IF x > 11116 THEN x := x - 1 END;
+IF x > 11117 THEN x := x - 1 END;
+IF x > 11118 THEN x := x - 1 END;
+IF x > 11119 THEN x := x - 1 END;
+IF x > 11120 THEN x := x - 1 END;
+IF x > 11121 THEN x := x - 1 END;
+IF x > 11122 THEN x := x - 1 END;
+IF x > 11123 THEN x := x - 1 END;
+IF x > 11124 THEN x := x - 1 END;
+IF x > 11125 THEN x := x - 1 END;
+IF x > 11126 THEN x := x - 1 END;
+IF x > 11127 THEN x := x - 1 END;
+IF x > 11128 THEN x := x - 1 END;
+IF x > 11129 THEN x := x - 1 END;
+IF x > 11130 THEN x := x - 1 END;
+IF x > 11131 THEN x := x - 1 END;
+IF x > 11132 THEN x := x - 1 END;
+IF x > 11133 THEN x := x - 1 END;
+IF x > 11134 THEN x := x - 1 END;
+IF x > 11135 THEN x := x - 1 END;
+IF x > 11136 THEN x := x - 1 END;
+IF x > 11137 THEN x := x - 1 END;
+IF x > 11138 THEN x := x - 1 END;
+IF x > 11139 THEN x := x - 1 END;
+IF x > 11140 THEN x := x - 1 END;
+IF x > 11141 THEN x := x - 1 END;
+IF x > 11142 THEN x := x - 1 END;
+IF x > 11143 THEN x := x - 1 END;
+IF x > 11144 THEN x := x - 1 END;
+IF x > 11145 THEN x := x - 1 END;
+IF x > 11146 THEN x := x - 1 END;
+IF x > 11147 THEN x := x - 1 END;
+IF x > 11148 THEN x := x - 1 END;
+IF x > 11149 THEN x := x - 1 END;
+IF x > 11150 THEN x := x - 1 END;
+IF x > 11151 THEN x := x - 1 END;
+IF x > 11152 THEN x := x - 1 END;
+IF x > 11153 THEN x := x - 1 END;
+IF x > 11154 THEN x := x - 1 END;
+IF x > 11155 THEN x := x - 1 END;
+IF x > 11156 THEN x := x - 1 END;
+IF x > 11157 THEN x := x - 1 END;
+IF x > 11158 THEN x := x - 1 END;
+IF x > 11159 THEN x := x - 1 END;
+IF x > 11160 THEN x := x - 1 END;
+IF x > 11161 THEN x := x - 1 END;
+IF x > 11162 THEN x := x - 1 END;
+IF x > 11163 THEN x := x - 1 END;
+IF x > 11164 THEN x := x - 1 END;
+IF x > 11165 THEN x := x - 1 END;
+IF x > 11166 THEN x := x - 1 END;
+IF x > 11167 THEN x := x - 1 END;
+IF x > 11168 THEN x := x - 1 END;
+IF x > 11169 THEN x := x - 1 END;
+IF x > 11170 THEN x := x - 1 END;
+IF x > 11171 THEN x := x - 1 END;
+IF x > 11172 THEN x := x - 1 END;
+IF x > 11173 THEN x := x - 1 END;
+IF x > 11174 THEN x := x - 1 END;
+IF x > 11175 THEN x := x - 1 END;
+IF x > 11176 THEN x := x - 1 END;
+IF x > 11177 THEN x := x - 1 END;
+IF x > 11178 THEN x := x - 1 END;
+IF x > 11179 THEN x := x - 1 END;
+IF x > 11180 THEN x := x - 1 END;
+IF x > 11181 THEN x := x - 1 END;
+IF x > 11182 THEN x := x - 1 END;
+IF x > 11183 THEN x := x - 1 END;
+IF x > 11184 THEN x := x - 1 END;
+IF x > 11185 THEN x := x - 1 END;
+IF x > 11186 THEN x := x - 1 END;
+IF x > 11187 THEN x := x - 1 END;
+IF x > 11188 THEN x := x - 1 END;
+IF x > 11189 THEN x := x - 1 END;
+IF x > 11190 THEN x := x - 1 END;
+IF x > 11191 THEN x := x - 1 END;
+IF x > 11192 THEN x := x - 1 END;
+IF x > 11193 THEN x := x - 1 END;
+IF x > 11194 THEN x := x - 1 END;
+IF x > 11195 THEN x := x - 1 END;
+IF x > 11196 THEN x := x - 1 END;
+IF x > 11197 THEN x := x - 1 END;
+IF x > 11198 THEN x := x - 1 END;
+IF x > 11199 THEN x := x - 1 END;
+IF x > 11200 THEN x := x - 1 END;
+IF x > 11201 THEN x := x - 1 END;
+IF x > 11202 THEN x := x - 1 END;
+IF x > 11203 THEN x := x - 1 END;
+IF x > 11204 THEN x := x - 1 END;
+IF x > 11205 THEN x := x - 1 END;
+IF x > 11206 THEN x := x - 1 END;
+IF x > 11207 THEN x := x - 1 END;
+IF x > 11208 THEN x := x - 1 END;
+IF x > 11209 THEN x := x - 1 END;
+IF x > 11210 THEN x := x - 1 END;
+IF x > 11211 THEN x := x - 1 END;
+IF x > 11212 THEN x := x - 1 END;
+IF x > 11213 THEN x := x - 1 END;
+IF x > 11214 THEN x := x - 1 END;
+IF x > 11215 THEN x := x - 1 END;
+IF x > 11216 THEN x := x - 1 END;
+IF x > 11217 THEN x := x - 1 END;
+IF x > 11218 THEN x := x - 1 END;
+IF x > 11219 THEN x := x - 1 END;
+IF x > 11220 THEN x := x - 1 END;
+IF x > 11221 THEN x := x - 1 END;
+IF x > 11222 THEN x := x - 1 END;
+IF x > 11223 THEN x := x - 1 END;
+IF x > 11224 THEN x := x - 1 END;
+IF x > 11225 THEN x := x - 1 END;
+IF x > 11226 THEN x := x - 1 END;
+IF x > 11227 THEN x := x - 1 END;
+IF x > 11228 THEN x := x - 1 END;
+IF x > 11229 THEN x := x - 1 END;
+IF x > 11230 THEN x := x - 1 END;
+IF x > 11231 THEN x := x - 1 END;
+IF x > 11232 THEN x := x - 1 END;
+IF x > 11233 THEN x := x - 1 END;
+IF x > 11234 THEN x := x - 1 END;
+IF x > 11235 THEN x := x - 1 END;
+IF x > 11236 THEN x := x - 1 END;
+IF x > 11237 THEN x := x - 1 END;
+IF x > 11238 THEN x := x - 1 END;
+IF x > 11239 THEN x := x - 1 END;
+IF x > 11240 THEN x := x - 1 END;
+IF x > 11241 THEN x := x - 1 END;
+IF x > 11242 THEN x := x - 1 END;
+IF x > 11243 THEN x := x - 1 END;
+IF x > 11244 THEN x := x - 1 END;
+IF x > 11245 THEN x := x - 1 END;
+IF x > 11246 THEN x := x - 1 END;
+IF x > 11247 THEN x := x - 1 END;
+IF x > 11248 THEN x := x - 1 END;
+IF x > 11249 THEN x := x - 1 END;
+IF x > 11250 THEN x := x - 1 END;
+IF x > 11251 THEN x := x - 1 END;
+IF x > 11252 THEN x := x - 1 END;
+IF x > 11253 THEN x := x - 1 END;
+IF x > 11254 THEN x := x - 1 END;
+IF x > 11255 THEN x := x - 1 END;
+IF x > 11256 THEN x := x - 1 END;
+IF x > 11257 THEN x := x - 1 END;
+IF x > 11258 THEN x := x - 1 END;
+IF x > 11259 THEN x := x - 1 END;
+IF x > 11260 THEN x := x - 1 END;
+IF x > 11261 THEN x := x - 1 END;
+IF x > 11262 THEN x := x - 1 END;
+IF x > 11263 THEN x := x - 1 END;
+IF x > 11264 THEN x := x - 1 END;
+IF x > 11265 THEN x := x - 1 END;
+IF x > 11266 THEN x := x - 1 END;
+IF x > 11267 THEN x := x - 1 END;
+IF x > 11268 THEN x := x - 1 END;
+IF x > 11269 THEN x := x - 1 END;
+IF x > 11270 THEN x := x - 1 END;
+IF x > 11271 THEN x := x - 1 END;
+IF x > 11272 THEN x := x - 1 END;
+IF x > 11273 THEN x := x - 1 END;
+IF x > 11274 THEN x := x - 1 END;
+IF x > 11275 THEN x := x - 1 END;
+IF x > 11276 THEN x := x - 1 END;
+IF x > 11277 THEN x := x - 1 END;
+IF x > 11278 THEN x := x - 1 END;
+IF x > 11279 THEN x := x - 1 END;
+IF x > 11280 THEN x := x - 1 END;
+IF x > 11281 THEN x := x - 1 END;
+IF x > 11282 THEN x := x - 1 END;
+IF x > 11283 THEN x := x - 1 END;
+IF x > 11284 THEN x := x - 1 END;
+IF x > 11285 THEN x := x - 1 END;
+IF x > 11286 THEN x := x - 1 END;
+IF x > 11287 THEN x := x - 1 END;
+IF x > 11288 THEN x := x - 1 END;
+IF x > 11289 THEN x := x - 1 END;
+IF x > 11290 THEN x := x - 1 END;
+IF x > 11291 THEN x := x - 1 END;
+IF x > 11292 THEN x := x - 1 END;
+IF x > 11293 THEN x := x - 1 END;
+IF x > 11294 THEN x := x - 1 END;
+IF x > 11295 THEN x := x - 1 END;
+IF x > 11296 THEN x := x - 1 END;
+IF x > 11297 THEN x := x - 1 END;
+IF x > 11298 THEN x := x - 1 END;
+IF x > 11299 THEN x := x - 1 END;
+IF x > 11300 THEN x := x - 1 END;
+IF x > 11301 THEN x := x - 1 END;
+IF x > 11302 THEN x := x - 1 END;
+IF x > 11303 THEN x := x - 1 END;
+IF x > 11304 THEN x := x - 1 END;
+IF x > 11305 THEN x := x - 1 END;
+IF x > 11306 THEN x := x - 1 END;
+IF x > 11307 THEN x := x - 1 END;
+IF x > 11308 THEN x := x - 1 END;
+IF x > 11309 THEN x := x - 1 END;
+IF x > 11310 THEN x := x - 1 END;
+IF x > 11311 THEN x := x - 1 END;
+IF x > 11312 THEN x := x - 1 END;
+IF x > 11313 THEN x := x - 1 END;
+IF x > 11314 THEN x := x - 1 END;
+IF x > 11315 THEN x := x - 1 END;
+IF x > 11316 THEN x := x - 1 END;
+IF x > 11317 THEN x := x - 1 END;
+IF x > 11318 THEN x := x - 1 END;
+IF x > 11319 THEN x := x - 1 END;
+IF x > 11320 THEN x := x - 1 END;
+IF x > 11321 THEN x := x - 1 END;
+IF x > 11322 THEN x := x - 1 END;
+IF x > 11323 THEN x := x - 1 END;
+IF x > 11324 THEN x := x - 1 END;
+IF x > 11325 THEN x := x - 1 END;
+IF x > 11326 THEN x := x - 1 END;
+IF x > 11327 THEN x := x - 1 END;
+IF x > 11328 THEN x := x - 1 END;
+IF x > 11329 THEN x := x - 1 END;
+IF x > 11330 THEN x := x - 1 END;
+IF x > 11331 THEN x := x - 1 END;
+IF x > 11332 THEN x := x - 1 END;
+IF x > 11333 THEN x := x - 1 END;
+IF x > 11334 THEN x := x - 1 END;
+IF x > 11335 THEN x := x - 1 END;
+IF x > 11336 THEN x := x - 1 END;
+IF x > 11337 THEN x := x - 1 END;
+IF x > 11338 THEN x := x - 1 END;
+IF x > 11339 THEN x := x - 1 END;
+IF x > 11340 THEN x := x - 1 END;
+IF x > 11341 THEN x := x - 1 END;
+IF x > 11342 THEN x := x - 1 END;
+IF x > 11343 THEN x := x - 1 END;
+IF x > 11344 THEN x := x - 1 END;
+IF x > 11345 THEN x := x - 1 END;
+IF x > 11346 THEN x := x - 1 END;
+IF x > 11347 THEN x := x - 1 END;
+IF x > 11348 THEN x := x - 1 END;
+IF x > 11349 THEN x := x - 1 END;
+IF x > 11350 THEN x := x - 1 END;
+IF x > 11351 THEN x := x - 1 END;
+IF x > 11352 THEN x := x - 1 END;
+IF x > 11353 THEN x := x - 1 END;
+IF x > 11354 THEN x := x - 1 END;
+IF x > 11355 THEN x := x - 1 END;
+IF x > 11356 THEN x := x - 1 END;
+IF x > 11357 THEN x := x - 1 END;
+IF x > 11358 THEN x := x - 1 END;
+IF x > 11359 THEN x := x - 1 END;
+IF x > 11360 THEN x := x - 1 END;
+IF x > 11361 THEN x := x - 1 END;
+IF x > 11362 THEN x := x - 1 END;
+IF x > 11363 THEN x := x - 1 END;
+IF x > 11364 THEN x := x - 1 END;
+IF x > 11365 THEN x := x - 1 END;
+IF x > 11366 THEN x := x - 1 END;
+IF x > 11367 THEN x := x - 1 END;
+IF x > 11368 THEN x := x - 1 END;
+IF x > 11369 THEN x := x - 1 END;
+IF x > 11370 THEN x := x - 1 END;
+IF x > 11371 THEN x := x - 1 END;
+IF x > 11372 THEN x := x - 1 END;
+IF x > 11373 THEN x := x - 1 END;
+IF x > 11374 THEN x := x - 1 END;
+IF x > 11375 THEN x := x - 1 END;
+IF x > 11376 THEN x := x - 1 END;
+IF x > 11377 THEN x := x - 1 END;
+IF x > 11378 THEN x := x - 1 END;
+IF x > 11379 THEN x := x - 1 END;
+IF x > 11380 THEN x := x - 1 END;
+IF x > 11381 THEN x := x - 1 END;
+IF x > 11382 THEN x := x - 1 END;
+IF x > 11383 THEN x := x - 1 END;
+IF x > 11384 THEN x := x - 1 END;
+IF x > 11385 THEN x := x - 1 END;
+IF x > 11386 THEN x := x - 1 END;
+IF x > 11387 THEN x := x - 1 END;
+IF x > 11388 THEN x := x - 1 END;
+IF x > 11389 THEN x := x - 1 END;
+IF x > 11390 THEN x := x - 1 END;
+IF x > 11391 THEN x := x - 1 END;
+IF x > 11392 THEN x := x - 1 END;
+IF x > 11393 THEN x := x - 1 END;
+IF x > 11394 THEN x := x - 1 END;
+IF x > 11395 THEN x := x - 1 END;
+IF x > 11396 THEN x := x - 1 END;
+IF x > 11397 THEN x := x - 1 END;
+IF x > 11398 THEN x := x - 1 END;
+IF x > 11399 THEN x := x - 1 END;
+IF x > 11400 THEN x := x - 1 END;
+IF x > 11401 THEN x := x - 1 END;
+IF x > 11402 THEN x := x - 1 END;
+IF x > 11403 THEN x := x - 1 END;
+IF x > 11404 THEN x := x - 1 END;
+IF x > 11405 THEN x := x - 1 END;
+IF x > 11406 THEN x := x - 1 END;
+IF x > 11407 THEN x := x - 1 END;
+IF x > 11408 THEN x := x - 1 END;
+IF x > 11409 THEN x := x - 1 END;
+IF x > 11410 THEN x := x - 1 END;
+IF x > 11411 THEN x := x - 1 END;
+IF x > 11412 THEN x := x - 1 END;
+IF x > 11413 THEN x := x - 1 END;
+IF x > 11414 THEN x := x - 1 END;
+IF x > 11415 THEN x := x - 1 END;
+IF x > 11416 THEN x := x - 1 END;
+IF x > 11417 THEN x := x - 1 END;
+IF x > 11418 THEN x := x - 1 END;
+IF x > 11419 THEN x := x - 1 END;
+IF x > 11420 THEN x := x - 1 END;
+IF x > 11421 THEN x := x - 1 END;
+IF x > 11422 THEN x := x - 1 END;
+IF x > 11423 THEN x := x - 1 END;
+IF x > 11424 THEN x := x - 1 END;
+IF x > 11425 THEN x := x - 1 END;
+IF x > 11426 THEN x := x - 1 END;
+IF x > 11427 THEN x := x - 1 END;
+IF x > 11428 THEN x := x - 1 END;
+IF x > 11429 THEN x := x - 1 END;
+IF x > 11430 THEN x := x - 1 END;
+IF x > 11431 THEN x := x - 1 END;
+IF x > 11432 THEN x := x - 1 END;
+IF x > 11433 THEN x := x - 1 END;
+IF x > 11434 THEN x := x - 1 END;
+IF x > 11435 THEN x := x - 1 END;
+IF x > 11436 THEN x := x - 1 END;
+IF x > 11437 THEN x := x - 1 END;
+IF x > 11438 THEN x := x - 1 END;
+IF x > 11439 THEN x := x - 1 END;
+IF x > 11440 THEN x := x - 1 END;
+IF x > 11441 THEN x := x - 1 END;
+IF x > 11442 THEN x := x - 1 END;
+IF x > 11443 THEN x := x - 1 END;
+IF x > 11444 THEN x := x - 1 END;
+IF x > 11445 THEN x := x - 1 END;
+IF x > 11446 THEN x := x - 1 END;
+IF x > 11447 THEN x := x - 1 END;
+IF x > 11448 THEN x := x - 1 END;
+IF x > 11449 THEN x := x - 1 END;
+IF x > 11450 THEN x := x - 1 END;
+IF x > 11451 THEN x := x - 1 END;
+IF x > 11452 THEN x := x - 1 END;
+IF x > 11453 THEN x := x - 1 END;
+IF x > 11454 THEN x := x - 1 END;
+IF x > 11455 THEN x := x - 1 END;
+IF x > 11456 THEN x := x - 1 END;
+IF x > 11457 THEN x := x - 1 END;
+IF x > 11458 THEN x := x - 1 END;
+IF x > 11459 THEN x := x - 1 END;
+IF x > 11460 THEN x := x - 1 END;
+IF x > 11461 THEN x := x - 1 END;
+IF x > 11462 THEN x := x - 1 END;
+IF x > 11463 THEN x := x - 1 END;
+IF x > 11464 THEN x := x - 1 END;
+IF x > 11465 THEN x := x - 1 END;
+IF x > 11466 THEN x := x - 1 END;
+IF x > 11467 THEN x := x - 1 END;
+IF x > 11468 THEN x := x - 1 END;
+IF x > 11469 THEN x := x - 1 END;
+IF x > 11470 THEN x := x - 1 END;
+IF x > 11471 THEN x := x - 1 END;
+IF x > 11472 THEN x := x - 1 END;
+IF x > 11473 THEN x := x - 1 END;
+IF x > 11474 THEN x := x - 1 END;
+IF x > 11475 THEN x := x - 1 END;
+IF x > 11476 THEN x := x - 1 END;
+IF x > 11477 THEN x := x - 1 END;
+IF x > 11478 THEN x := x - 1 END;
+IF x > 11479 THEN x := x - 1 END;
+IF x > 11480 THEN x := x - 1 END;
+IF x > 11481 THEN x := x - 1 END;
+IF x > 11482 THEN x := x - 1 END;
+IF x > 11483 THEN x := x - 1 END;
+IF x > 11484 THEN x := x - 1 END;
+IF x > 11485 THEN x := x - 1 END;
+IF x > 11486 THEN x := x - 1 END;
+IF x > 11487 THEN x := x - 1 END;
+IF x > 11488 THEN x := x - 1 END;
+IF x > 11489 THEN x := x - 1 END;
+IF x > 11490 THEN x := x - 1 END;
+IF x > 11491 THEN x := x - 1 END;
+IF x > 11492 THEN x := x - 1 END;
+IF x > 11493 THEN x := x - 1 END;
+IF x > 11494 THEN x := x - 1 END;
+IF x > 11495 THEN x := x - 1 END;
+IF x > 11496 THEN x := x - 1 END;
+IF x > 11497 THEN x := x - 1 END;
+IF x > 11498 THEN x := x - 1 END;
+IF x > 11499 THEN x := x - 1 END;
+IF x > 11500 THEN x := x - 1 END;
+IF x > 11501 THEN x := x - 1 END;
+IF x > 11502 THEN x := x - 1 END;
+IF x > 11503 THEN x := x - 1 END;
+IF x > 11504 THEN x := x - 1 END;
+IF x > 11505 THEN x := x - 1 END;
+IF x > 11506 THEN x := x - 1 END;
+IF x > 11507 THEN x := x - 1 END;
+IF x > 11508 THEN x := x - 1 END;
+IF x > 11509 THEN x := x - 1 END;
+IF x > 11510 THEN x := x - 1 END;
+IF x > 11511 THEN x := x - 1 END;
+IF x > 11512 THEN x := x - 1 END;
+IF x > 11513 THEN x := x - 1 END;
+IF x > 11514 THEN x := x - 1 END;
+IF x > 11515 THEN x := x - 1 END;
+IF x > 11516 THEN x := x - 1 END;
+IF x > 11517 THEN x := x - 1 END;
+IF x > 11518 THEN x := x - 1 END;
+IF x > 11519 THEN x := x - 1 END;
+IF x > 11520 THEN x := x - 1 END;
+IF x > 11521 THEN x := x - 1 END;
+IF x > 11522 THEN x := x - 1 END;
+IF x > 11523 THEN x := x - 1 END;
+IF x > 11524 THEN x := x - 1 END;
+IF x > 11525 THEN x := x - 1 END;
+IF x > 11526 THEN x := x - 1 END;
+IF x > 11527 THEN x := x - 1 END;
+IF x > 11528 THEN x := x - 1 END;
+IF x > 11529 THEN x := x - 1 END;
+IF x > 11530 THEN x := x - 1 END;
+IF x > 11531 THEN x := x - 1 END;
+IF x > 11532 THEN x := x - 1 END;
+IF x > 11533 THEN x := x - 1 END;
+IF x > 11534 THEN x := x - 1 END;
+IF x > 11535 THEN x := x - 1 END;
+IF x > 11536 THEN x := x - 1 END;
+IF x > 11537 THEN x := x - 1 END;
+IF x > 11538 THEN x := x - 1 END;
+IF x > 11539 THEN x := x - 1 END;
+IF x > 11540 THEN x := x - 1 END;
+IF x > 11541 THEN x := x - 1 END;
+IF x > 11542 THEN x := x - 1 END;
+IF x > 11543 THEN x := x - 1 END;
+IF x > 11544 THEN x := x - 1 END;
+IF x > 11545 THEN x := x - 1 END;
+IF x > 11546 THEN x := x - 1 END;
+IF x > 11547 THEN x := x - 1 END;
+IF x > 11548 THEN x := x - 1 END;
+IF x > 11549 THEN x := x - 1 END;
+IF x > 11550 THEN x := x - 1 END;
+IF x > 11551 THEN x := x - 1 END;
+IF x > 11552 THEN x := x - 1 END;
+IF x > 11553 THEN x := x - 1 END;
+IF x > 11554 THEN x := x - 1 END;
+IF x > 11555 THEN x := x - 1 END;
+IF x > 11556 THEN x := x - 1 END;
+IF x > 11557 THEN x := x - 1 END;
+IF x > 11558 THEN x := x - 1 END;
+IF x > 11559 THEN x := x - 1 END;
+IF x > 11560 THEN x := x - 1 END;
+IF x > 11561 THEN x := x - 1 END;
+IF x > 11562 THEN x := x - 1 END;
+IF x > 11563 THEN x := x - 1 END;
+IF x > 11564 THEN x := x - 1 END;
+IF x > 11565 THEN x := x - 1 END;
+IF x > 11566 THEN x := x - 1 END;
+IF x > 11567 THEN x := x - 1 END;
+IF x > 11568 THEN x := x - 1 END;
+IF x > 11569 THEN x := x - 1 END;
+IF x > 11570 THEN x := x - 1 END;
+IF x > 11571 THEN x := x - 1 END;
+IF x > 11572 THEN x := x - 1 END;
+IF x > 11573 THEN x := x - 1 END;
+IF x > 11574 THEN x := x - 1 END;
+IF x > 11575 THEN x := x - 1 END;
+IF x > 11576 THEN x := x - 1 END;
+IF x > 11577 THEN x := x - 1 END;
+IF x > 11578 THEN x := x - 1 END;
+IF x > 11579 THEN x := x - 1 END;
+IF x > 11580 THEN x := x - 1 END;
+IF x > 11581 THEN x := x - 1 END;
+IF x > 11582 THEN x := x - 1 END;
+IF x > 11583 THEN x := x - 1 END;
+IF x > 11584 THEN x := x - 1 END;
+IF x > 11585 THEN x := x - 1 END;
+IF x > 11586 THEN x := x - 1 END;
+IF x > 11587 THEN x := x - 1 END;
+IF x > 11588 THEN x := x - 1 END;
+IF x > 11589 THEN x := x - 1 END;
+IF x > 11590 THEN x := x - 1 END;
+IF x > 11591 THEN x := x - 1 END;
+IF x > 11592 THEN x := x - 1 END;
+IF x > 11593 THEN x := x - 1 END;
+IF x > 11594 THEN x := x - 1 END;
+IF x > 11595 THEN x := x - 1 END;
+IF x > 11596 THEN x := x - 1 END;
+IF x > 11597 THEN x := x - 1 END;
+IF x > 11598 THEN x := x - 1 END;
+IF x > 11599 THEN x := x - 1 END;
+IF x > 11600 THEN x := x - 1 END;
+IF x > 11601 THEN x := x - 1 END;
+IF x > 11602 THEN x := x - 1 END;
+IF x > 11603 THEN x := x - 1 END;
+IF x > 11604 THEN x := x - 1 END;
+IF x > 11605 THEN x := x - 1 END;
+IF x > 11606 THEN x := x - 1 END;
+IF x > 11607 THEN x := x - 1 END;
+IF x > 11608 THEN x := x - 1 END;
+IF x > 11609 THEN x := x - 1 END;
+IF x > 11610 THEN x := x - 1 END;
+IF x > 11611 THEN x := x - 1 END;
+IF x > 11612 THEN x := x - 1 END;
+IF x > 11613 THEN x := x - 1 END;
+IF x > 11614 THEN x := x - 1 END;
+IF x > 11615 THEN x := x - 1 END;
+IF x > 11616 THEN x := x - 1 END;
+IF x > 11617 THEN x := x - 1 END;
+IF x > 11618 THEN x := x - 1 END;
+IF x > 11619 THEN x := x - 1 END;
+IF x > 11620 THEN x := x - 1 END;
+IF x > 11621 THEN x := x - 1 END;
+IF x > 11622 THEN x := x - 1 END;
+IF x > 11623 THEN x := x - 1 END;
+IF x > 11624 THEN x := x - 1 END;
+IF x > 11625 THEN x := x - 1 END;
+IF x > 11626 THEN x := x - 1 END;
+IF x > 11627 THEN x := x - 1 END;
+IF x > 11628 THEN x := x - 1 END;
+IF x > 11629 THEN x := x - 1 END;
+IF x > 11630 THEN x := x - 1 END;
+IF x > 11631 THEN x := x - 1 END;
+IF x > 11632 THEN x := x - 1 END;
+IF x > 11633 THEN x := x - 1 END;
+IF x > 11634 THEN x := x - 1 END;
+IF x > 11635 THEN x := x - 1 END;
+IF x > 11636 THEN x := x - 1 END;
+IF x > 11637 THEN x := x - 1 END;
+IF x > 11638 THEN x := x - 1 END;
+IF x > 11639 THEN x := x - 1 END;
+IF x > 11640 THEN x := x - 1 END;
+IF x > 11641 THEN x := x - 1 END;
+IF x > 11642 THEN x := x - 1 END;
+IF x > 11643 THEN x := x - 1 END;
+IF x > 11644 THEN x := x - 1 END;
+IF x > 11645 THEN x := x - 1 END;
+IF x > 11646 THEN x := x - 1 END;
+IF x > 11647 THEN x := x - 1 END;
+IF x > 11648 THEN x := x - 1 END;
+IF x > 11649 THEN x := x - 1 END;
+IF x > 11650 THEN x := x - 1 END;
+IF x > 11651 THEN x := x - 1 END;
+IF x > 11652 THEN x := x - 1 END;
+IF x > 11653 THEN x := x - 1 END;
+IF x > 11654 THEN x := x - 1 END;
+IF x > 11655 THEN x := x - 1 END;
+IF x > 11656 THEN x := x - 1 END;
+IF x > 11657 THEN x := x - 1 END;
+IF x > 11658 THEN x := x - 1 END;
+IF x > 11659 THEN x := x - 1 END;
+IF x > 11660 THEN x := x - 1 END;
+IF x > 11661 THEN x := x - 1 END;
+IF x > 11662 THEN x := x - 1 END;
+IF x > 11663 THEN x := x - 1 END;
+IF x > 11664 THEN x := x - 1 END;
+IF x > 11665 THEN x := x - 1 END;
+IF x > 11666 THEN x := x - 1 END;
+IF x > 11667 THEN x := x - 1 END;
+IF x > 11668 THEN x := x - 1 END;
+IF x > 11669 THEN x := x - 1 END;
+IF x > 11670 THEN x := x - 1 END;
+IF x > 11671 THEN x := x - 1 END;
+IF x > 11672 THEN x := x - 1 END;
+IF x > 11673 THEN x := x - 1 END;
+IF x > 11674 THEN x := x - 1 END;
+IF x > 11675 THEN x := x - 1 END;
+IF x > 11676 THEN x := x - 1 END;
+IF x > 11677 THEN x := x - 1 END;
+IF x > 11678 THEN x := x - 1 END;
+IF x > 11679 THEN x := x - 1 END;
+IF x > 11680 THEN x := x - 1 END;
+IF x > 11681 THEN x := x - 1 END;
+IF x > 11682 THEN x := x - 1 END;
+IF x > 11683 THEN x := x - 1 END;
+IF x > 11684 THEN x := x - 1 END;
+IF x > 11685 THEN x := x - 1 END;
+IF x > 11686 THEN x := x - 1 END;
+IF x > 11687 THEN x := x - 1 END;
+IF x > 11688 THEN x := x - 1 END;
+IF x > 11689 THEN x := x - 1 END;
+IF x > 11690 THEN x := x - 1 END;
+IF x > 11691 THEN x := x - 1 END;
+IF x > 11692 THEN x := x - 1 END;
+IF x > 11693 THEN x := x - 1 END;
+IF x > 11694 THEN x := x - 1 END;
+IF x > 11695 THEN x := x - 1 END;
+IF x > 11696 THEN x := x - 1 END;
+IF x > 11697 THEN x := x - 1 END;
+IF x > 11698 THEN x := x - 1 END;
+IF x > 11699 THEN x := x - 1 END;
+IF x > 11700 THEN x := x - 1 END;
+IF x > 11701 THEN x := x - 1 END;
+IF x > 11702 THEN x := x - 1 END;
+IF x > 11703 THEN x := x - 1 END;
+IF x > 11704 THEN x := x - 1 END;
+IF x > 11705 THEN x := x - 1 END;
+IF x > 11706 THEN x := x - 1 END;
+IF x > 11707 THEN x := x - 1 END;
+IF x > 11708 THEN x := x - 1 END;
+IF x > 11709 THEN x := x - 1 END;
+IF x > 11710 THEN x := x - 1 END;
+IF x > 11711 THEN x := x - 1 END;
+IF x > 11712 THEN x := x - 1 END;
+IF x > 11713 THEN x := x - 1 END;
+IF x > 11714 THEN x := x - 1 END;
+IF x > 11715 THEN x := x - 1 END;
+IF x > 11716 THEN x := x - 1 END;
+IF x > 11717 THEN x := x - 1 END;
+IF x > 11718 THEN x := x - 1 END;
+IF x > 11719 THEN x := x - 1 END;
+IF x > 11720 THEN x := x - 1 END;
+IF x > 11721 THEN x := x - 1 END;
+IF x > 11722 THEN x := x - 1 END;
+IF x > 11723 THEN x := x - 1 END;
+IF x > 11724 THEN x := x - 1 END;
+IF x > 11725 THEN x := x - 1 END;
+IF x > 11726 THEN x := x - 1 END;
+IF x > 11727 THEN x := x - 1 END;
+IF x > 11728 THEN x := x - 1 END;
+IF x > 11729 THEN x := x - 1 END;
+IF x > 11730 THEN x := x - 1 END;
+IF x > 11731 THEN x := x - 1 END;
+IF x > 11732 THEN x := x - 1 END;
+IF x > 11733 THEN x := x - 1 END;
+IF x > 11734 THEN x := x - 1 END;
+IF x > 11735 THEN x := x - 1 END;
+IF x > 11736 THEN x := x - 1 END;
+IF x > 11737 THEN x := x - 1 END;
+IF x > 11738 THEN x := x - 1 END;
+IF x > 11739 THEN x := x - 1 END;
+IF x > 11740 THEN x := x - 1 END;
+IF x > 11741 THEN x := x - 1 END;
+IF x > 11742 THEN x := x - 1 END;
+IF x > 11743 THEN x := x - 1 END;
+IF x > 11744 THEN x := x - 1 END;
+IF x > 11745 THEN x := x - 1 END;
+IF x > 11746 THEN x := x - 1 END;
+IF x > 11747 THEN x := x - 1 END;
+IF x > 11748 THEN x := x - 1 END;
+IF x > 11749 THEN x := x - 1 END;
+IF x > 11750 THEN x := x - 1 END;
+IF x > 11751 THEN x := x - 1 END;
+IF x > 11752 THEN x := x - 1 END;
+IF x > 11753 THEN x := x - 1 END;
+IF x > 11754 THEN x := x - 1 END;
+IF x > 11755 THEN x := x - 1 END;
+IF x > 11756 THEN x := x - 1 END;
+IF x > 11757 THEN x := x - 1 END;
+IF x > 11758 THEN x := x - 1 END;
+IF x > 11759 THEN x := x - 1 END;
+IF x > 11760 THEN x := x - 1 END;
+IF x > 11761 THEN x := x - 1 END;
+IF x > 11762 THEN x := x - 1 END;
+IF x > 11763 THEN x := x - 1 END;
+IF x > 11764 THEN x := x - 1 END;
+IF x > 11765 THEN x := x - 1 END;
+IF x > 11766 THEN x := x - 1 END;
+IF x > 11767 THEN x := x - 1 END;
+IF x > 11768 THEN x := x - 1 END;
+IF x > 11769 THEN x := x - 1 END;
+IF x > 11770 THEN x := x - 1 END;
+IF x > 11771 THEN x := x - 1 END;
+IF x > 11772 THEN x := x - 1 END;
+IF x > 11773 THEN x := x - 1 END;
+IF x > 11774 THEN x := x - 1 END;
+IF x > 11775 THEN x := x - 1 END;
+IF x > 11776 THEN x := x - 1 END;
+IF x > 11777 THEN x := x - 1 END;
+IF x > 11778 THEN x := x - 1 END;
+IF x > 11779 THEN x := x - 1 END;
+IF x > 11780 THEN x := x - 1 END;
+IF x > 11781 THEN x := x - 1 END;
+IF x > 11782 THEN x := x - 1 END;
+IF x > 11783 THEN x := x - 1 END;
+IF x > 11784 THEN x := x - 1 END;
+IF x > 11785 THEN x := x - 1 END;
+IF x > 11786 THEN x := x - 1 END;
+IF x > 11787 THEN x := x - 1 END;
+IF x > 11788 THEN x := x - 1 END;
+IF x > 11789 THEN x := x - 1 END;
+IF x > 11790 THEN x := x - 1 END;
+IF x > 11791 THEN x := x - 1 END;
+IF x > 11792 THEN x := x - 1 END;
+IF x > 11793 THEN x := x - 1 END;
+IF x > 11794 THEN x := x - 1 END;
+IF x > 11795 THEN x := x - 1 END;
+IF x > 11796 THEN x := x - 1 END;
+IF x > 11797 THEN x := x - 1 END;
+IF x > 11798 THEN x := x - 1 END;
+IF x > 11799 THEN x := x - 1 END;
+IF x > 11800 THEN x := x - 1 END;
+IF x > 11801 THEN x := x - 1 END;
+IF x > 11802 THEN x := x - 1 END;
+IF x > 11803 THEN x := x - 1 END;
+IF x > 11804 THEN x := x - 1 END;
+IF x > 11805 THEN x := x - 1 END;
+IF x > 11806 THEN x := x - 1 END;
+IF x > 11807 THEN x := x - 1 END;
+IF x > 11808 THEN x := x - 1 END;
+IF x > 11809 THEN x := x - 1 END;
+IF x > 11810 THEN x := x - 1 END;
+IF x > 11811 THEN x := x - 1 END;
+IF x > 11812 THEN x := x - 1 END;
+IF x > 11813 THEN x := x - 1 END;
+IF x > 11814 THEN x := x - 1 END;
+IF x > 11815 THEN x := x - 1 END;
+IF x > 11816 THEN x := x - 1 END;
+IF x > 11817 THEN x := x - 1 END;
+IF x > 11818 THEN x := x - 1 END;
+IF x > 11819 THEN x := x - 1 END;
+IF x > 11820 THEN x := x - 1 END;
+IF x > 11821 THEN x := x - 1 END;
+IF x > 11822 THEN x := x - 1 END;
+IF x > 11823 THEN x := x - 1 END;
+IF x > 11824 THEN x := x - 1 END;
+IF x > 11825 THEN x := x - 1 END;
+IF x > 11826 THEN x := x - 1 END;
+IF x > 11827 THEN x := x - 1 END;
+IF x > 11828 THEN x := x - 1 END;
+IF x > 11829 THEN x := x - 1 END;
+IF x > 11830 THEN x := x - 1 END;
+IF x > 11831 THEN x := x - 1 END;
+IF x > 11832 THEN x := x - 1 END;
+IF x > 11833 THEN x := x - 1 END;
+IF x > 11834 THEN x := x - 1 END;
+IF x > 11835 THEN x := x - 1 END;
+IF x > 11836 THEN x := x - 1 END;
+IF x > 11837 THEN x := x - 1 END;
+IF x > 11838 THEN x := x - 1 END;
+IF x > 11839 THEN x := x - 1 END;
+IF x > 11840 THEN x := x - 1 END;
+IF x > 11841 THEN x := x - 1 END;
+IF x > 11842 THEN x := x - 1 END;
+IF x > 11843 THEN x := x - 1 END;
+IF x > 11844 THEN x := x - 1 END;
+IF x > 11845 THEN x := x - 1 END;
+IF x > 11846 THEN x := x - 1 END;
+IF x > 11847 THEN x := x - 1 END;
+IF x > 11848 THEN x := x - 1 END;
+IF x > 11849 THEN x := x - 1 END;
+IF x > 11850 THEN x := x - 1 END;
+IF x > 11851 THEN x := x - 1 END;
+IF x > 11852 THEN x := x - 1 END;
+IF x > 11853 THEN x := x - 1 END;
+IF x > 11854 THEN x := x - 1 END;
+IF x > 11855 THEN x := x - 1 END;
+IF x > 11856 THEN x := x - 1 END;
+IF x > 11857 THEN x := x - 1 END;
+IF x > 11858 THEN x := x - 1 END;
+IF x > 11859 THEN x := x - 1 END;
+IF x > 11860 THEN x := x - 1 END;
+IF x > 11861 THEN x := x - 1 END;
+IF x > 11862 THEN x := x - 1 END;
+IF x > 11863 THEN x := x - 1 END;
+IF x > 11864 THEN x := x - 1 END;
+IF x > 11865 THEN x := x - 1 END;
+IF x > 11866 THEN x := x - 1 END;
+IF x > 11867 THEN x := x - 1 END;
+IF x > 11868 THEN x := x - 1 END;
+IF x > 11869 THEN x := x - 1 END;
+IF x > 11870 THEN x := x - 1 END;
+IF x > 11871 THEN x := x - 1 END;
+IF x > 11872 THEN x := x - 1 END;
+IF x > 11873 THEN x := x - 1 END;
+IF x > 11874 THEN x := x - 1 END;
+IF x > 11875 THEN x := x - 1 END;
+IF x > 11876 THEN x := x - 1 END;
+IF x > 11877 THEN x := x - 1 END;
+IF x > 11878 THEN x := x - 1 END;
+IF x > 11879 THEN x := x - 1 END;
+IF x > 11880 THEN x := x - 1 END;
+IF x > 11881 THEN x := x - 1 END;
+IF x > 11882 THEN x := x - 1 END;
+IF x > 11883 THEN x := x - 1 END;
+IF x > 11884 THEN x := x - 1 END;
+IF x > 11885 THEN x := x - 1 END;
+IF x > 11886 THEN x := x - 1 END;
+IF x > 11887 THEN x := x - 1 END;
+IF x > 11888 THEN x := x - 1 END;
+IF x > 11889 THEN x := x - 1 END;
+IF x > 11890 THEN x := x - 1 END;
+IF x > 11891 THEN x := x - 1 END;
+IF x > 11892 THEN x := x - 1 END;
+IF x > 11893 THEN x := x - 1 END;
+IF x > 11894 THEN x := x - 1 END;
+IF x > 11895 THEN x := x - 1 END;
+IF x > 11896 THEN x := x - 1 END;
+IF x > 11897 THEN x := x - 1 END;
+IF x > 11898 THEN x := x - 1 END;
+IF x > 11899 THEN x := x - 1 END;
+IF x > 11900 THEN x := x - 1 END;
+IF x > 11901 THEN x := x - 1 END;
+IF x > 11902 THEN x := x - 1 END;
+IF x > 11903 THEN x := x - 1 END;
+IF x > 11904 THEN x := x - 1 END;
+IF x > 11905 THEN x := x - 1 END;
+IF x > 11906 THEN x := x - 1 END;
+IF x > 11907 THEN x := x - 1 END;
+IF x > 11908 THEN x := x - 1 END;
+IF x > 11909 THEN x := x - 1 END;
+IF x > 11910 THEN x := x - 1 END;
+IF x > 11911 THEN x := x - 1 END;
+IF x > 11912 THEN x := x - 1 END;
+IF x > 11913 THEN x := x - 1 END;
+IF x > 11914 THEN x := x - 1 END;
+IF x > 11915 THEN x := x - 1 END;
+IF x > 11916 THEN x := x - 1 END;
+IF x > 11917 THEN x := x - 1 END;
+IF x > 11918 THEN x := x - 1 END;
+IF x > 11919 THEN x := x - 1 END;
+IF x > 11920 THEN x := x - 1 END;
+IF x > 11921 THEN x := x - 1 END;
+IF x > 11922 THEN x := x - 1 END;
+IF x > 11923 THEN x := x - 1 END;
+IF x > 11924 THEN x := x - 1 END;
+IF x > 11925 THEN x := x - 1 END;
+IF x > 11926 THEN x := x - 1 END;
+IF x > 11927 THEN x := x - 1 END;
+IF x > 11928 THEN x := x - 1 END;
+IF x > 11929 THEN x := x - 1 END;
+IF x > 11930 THEN x := x - 1 END;
+IF x > 11931 THEN x := x - 1 END;
+IF x > 11932 THEN x := x - 1 END;
+IF x > 11933 THEN x := x - 1 END;
+IF x > 11934 THEN x := x - 1 END;
+IF x > 11935 THEN x := x - 1 END;
+IF x > 11936 THEN x := x - 1 END;
+IF x > 11937 THEN x := x - 1 END;
+IF x > 11938 THEN x := x - 1 END;
+IF x > 11939 THEN x := x - 1 END;
+IF x > 11940 THEN x := x - 1 END;
+IF x > 11941 THEN x := x - 1 END;
+IF x > 11942 THEN x := x - 1 END;
+IF x > 11943 THEN x := x - 1 END;
+IF x > 11944 THEN x := x - 1 END;
+IF x > 11945 THEN x := x - 1 END;
+IF x > 11946 THEN x := x - 1 END;
+IF x > 11947 THEN x := x - 1 END;
+IF x > 11948 THEN x := x - 1 END;
+IF x > 11949 THEN x := x - 1 END;
+IF x > 11950 THEN x := x - 1 END;
+IF x > 11951 THEN x := x - 1 END;
+IF x > 11952 THEN x := x - 1 END;
+IF x > 11953 THEN x := x - 1 END;
+IF x > 11954 THEN x := x - 1 END;
+IF x > 11955 THEN x := x - 1 END;
+IF x > 11956 THEN x := x - 1 END;
+IF x > 11957 THEN x := x - 1 END;
+IF x > 11958 THEN x := x - 1 END;
+IF x > 11959 THEN x := x - 1 END;
+IF x > 11960 THEN x := x - 1 END;
+IF x > 11961 THEN x := x - 1 END;
+IF x > 11962 THEN x := x - 1 END;
+IF x > 11963 THEN x := x - 1 END;
+IF x > 11964 THEN x := x - 1 END;
+IF x > 11965 THEN x := x - 1 END;
+IF x > 11966 THEN x := x - 1 END;
+IF x > 11967 THEN x := x - 1 END;
+IF x > 11968 THEN x := x - 1 END;
+IF x > 11969 THEN x := x - 1 END;
+IF x > 11970 THEN x := x - 1 END;
+IF x > 11971 THEN x := x - 1 END;
+IF x > 11972 THEN x := x - 1 END;
+IF x > 11973 THEN x := x - 1 END;
+IF x > 11974 THEN x := x - 1 END;
+IF x > 11975 THEN x := x - 1 END;
+IF x > 11976 THEN x := x - 1 END;
+IF x > 11977 THEN x := x - 1 END;
+IF x > 11978 THEN x := x - 1 END;
+IF x > 11979 THEN x := x - 1 END;
+IF x > 11980 THEN x := x - 1 END;
+IF x > 11981 THEN x := x - 1 END;
+IF x > 11982 THEN x := x - 1 END;
+IF x > 11983 THEN x := x - 1 END;
+IF x > 11984 THEN x := x - 1 END;
+IF x > 11985 THEN x := x - 1 END;
+IF x > 11986 THEN x := x - 1 END;
+IF x > 11987 THEN x := x - 1 END;
+IF x > 11988 THEN x := x - 1 END;
+IF x > 11989 THEN x := x - 1 END;
+IF x > 11990 THEN x := x - 1 END;
+IF x > 11991 THEN x := x - 1 END;
+IF x > 11992 THEN x := x - 1 END;
+IF x > 11993 THEN x := x - 1 END;
+IF x > 11994 THEN x := x - 1 END;
+IF x > 11995 THEN x := x - 1 END;
+IF x > 11996 THEN x := x - 1 END;
+IF x > 11997 THEN x := x - 1 END;
+IF x > 11998 THEN x := x - 1 END;
+IF x > 11999 THEN x := x - 1 END;
+IF x > 12000 THEN x := x - 1 END;
+IF x > 12001 THEN x := x - 1 END;
+IF x > 12002 THEN x := x - 1 END;
+IF x > 12003 THEN x := x - 1 END;
+IF x > 12004 THEN x := x - 1 END;
+IF x > 12005 THEN x := x - 1 END;
+IF x > 12006 THEN x := x - 1 END;
+IF x > 12007 THEN x := x - 1 END;
+IF x > 12008 THEN x := x - 1 END;
+IF x > 12009 THEN x := x - 1 END;
+IF x > 12010 THEN x := x - 1 END;
+IF x > 12011 THEN x := x - 1 END;
+IF x > 12012 THEN x := x - 1 END;
+IF x > 12013 THEN x := x - 1 END;
+IF x > 12014 THEN x := x - 1 END;
+IF x > 12015 THEN x := x - 1 END;
+IF x > 12016 THEN x := x - 1 END;
+IF x > 12017 THEN x := x - 1 END;
+IF x > 12018 THEN x := x - 1 END;
+IF x > 12019 THEN x := x - 1 END;
+IF x > 12020 THEN x := x - 1 END;
+IF x > 12021 THEN x := x - 1 END;
+IF x > 12022 THEN x := x - 1 END;
+IF x > 12023 THEN x := x - 1 END;
+IF x > 12024 THEN x := x - 1 END;
+IF x > 12025 THEN x := x - 1 END;
+IF x > 12026 THEN x := x - 1 END;
+IF x > 12027 THEN x := x - 1 END;
+IF x > 12028 THEN x := x - 1 END;
+IF x > 12029 THEN x := x - 1 END;
+IF x > 12030 THEN x := x - 1 END;
+IF x > 12031 THEN x := x - 1 END;
+IF x > 12032 THEN x := x - 1 END;
+IF x > 12033 THEN x := x - 1 END;
+IF x > 12034 THEN x := x - 1 END;
+IF x > 12035 THEN x := x - 1 END;
+IF x > 12036 THEN x := x - 1 END;
+IF x > 12037 THEN x := x - 1 END;
+IF x > 12038 THEN x := x - 1 END;
+IF x > 12039 THEN x := x - 1 END;
+IF x > 12040 THEN x := x - 1 END;
+IF x > 12041 THEN x := x - 1 END;
+IF x > 12042 THEN x := x - 1 END;
+IF x > 12043 THEN x := x - 1 END;
+IF x > 12044 THEN x := x - 1 END;
+IF x > 12045 THEN x := x - 1 END;
+IF x > 12046 THEN x := x - 1 END;
+IF x > 12047 THEN x := x - 1 END;
+IF x > 12048 THEN x := x - 1 END;
+IF x > 12049 THEN x := x - 1 END;
+IF x > 12050 THEN x := x - 1 END;
+IF x > 12051 THEN x := x - 1 END;
+IF x > 12052 THEN x := x - 1 END;
+IF x > 12053 THEN x := x - 1 END;
+IF x > 12054 THEN x := x - 1 END;
+IF x > 12055 THEN x := x - 1 END;
+IF x > 12056 THEN x := x - 1 END;
+IF x > 12057 THEN x := x - 1 END;
+IF x > 12058 THEN x := x - 1 END;
+IF x > 12059 THEN x := x - 1 END;
+IF x > 12060 THEN x := x - 1 END;
+IF x > 12061 THEN x := x - 1 END;
+IF x > 12062 THEN x := x - 1 END;
+IF x > 12063 THEN x := x - 1 END;
+IF x > 12064 THEN x := x - 1 END;
+IF x > 12065 THEN x := x - 1 END;
+IF x > 12066 THEN x := x - 1 END;
+IF x > 12067 THEN x := x - 1 END;
+IF x > 12068 THEN x := x - 1 END;
+IF x > 12069 THEN x := x - 1 END;
+IF x > 12070 THEN x := x - 1 END;
+IF x > 12071 THEN x := x - 1 END;
+IF x > 12072 THEN x := x - 1 END;
+IF x > 12073 THEN x := x - 1 END;
+IF x > 12074 THEN x := x - 1 END;
+IF x > 12075 THEN x := x - 1 END;
+IF x > 12076 THEN x := x - 1 END;
+IF x > 12077 THEN x := x - 1 END;
+IF x > 12078 THEN x := x - 1 END;
+IF x > 12079 THEN x := x - 1 END;
+IF x > 12080 THEN x := x - 1 END;
+IF x > 12081 THEN x := x - 1 END;
+IF x > 12082 THEN x := x - 1 END;
+IF x > 12083 THEN x := x - 1 END;
+IF x > 12084 THEN x := x - 1 END;
+IF x > 12085 THEN x := x - 1 END;
+IF x > 12086 THEN x := x - 1 END;
+IF x > 12087 THEN x := x - 1 END;
+IF x > 12088 THEN x := x - 1 END;
+IF x > 12089 THEN x := x - 1 END;
+IF x > 12090 THEN x := x - 1 END;
+IF x > 12091 THEN x := x - 1 END;
+IF x > 12092 THEN x := x - 1 END;
+IF x > 12093 THEN x := x - 1 END;
+IF x > 12094 THEN x := x - 1 END;
+IF x > 12095 THEN x := x - 1 END;
+IF x > 12096 THEN x := x - 1 END;
+IF x > 12097 THEN x := x - 1 END;
+IF x > 12098 THEN x := x - 1 END;
+IF x > 12099 THEN x := x - 1 END;
+IF x > 12100 THEN x := x - 1 END;
+IF x > 12101 THEN x := x - 1 END;
+IF x > 12102 THEN x := x - 1 END;
+IF x > 12103 THEN x := x - 1 END;
+IF x > 12104 THEN x := x - 1 END;
+IF x > 12105 THEN x := x - 1 END;
+IF x > 12106 THEN x := x - 1 END;
+IF x > 12107 THEN x := x - 1 END;
+IF x > 12108 THEN x := x - 1 END;
+IF x > 12109 THEN x := x - 1 END;
+IF x > 12110 THEN x := x - 1 END;
+IF x > 12111 THEN x := x - 1 END;
+IF x > 12112 THEN x := x - 1 END;
+IF x > 12113 THEN x := x - 1 END;
+IF x > 12114 THEN x := x - 1 END;
+IF x > 12115 THEN x := x - 1 END;
+IF x > 12116 THEN x := x - 1 END;
+IF x > 12117 THEN x := x - 1 END;
+IF x > 12118 THEN x := x - 1 END;
+IF x > 12119 THEN x := x - 1 END;
+IF x > 12120 THEN x := x - 1 END;
+IF x > 12121 THEN x := x - 1 END;
+IF x > 12122 THEN x := x - 1 END;
+IF x > 12123 THEN x := x - 1 END;
+IF x > 12124 THEN x := x - 1 END;
+IF x > 12125 THEN x := x - 1 END;
+IF x > 12126 THEN x := x - 1 END;
+IF x > 12127 THEN x := x - 1 END;
+IF x > 12128 THEN x := x - 1 END;
+IF x > 12129 THEN x := x - 1 END;
+IF x > 12130 THEN x := x - 1 END;
+IF x > 12131 THEN x := x - 1 END;
+IF x > 12132 THEN x := x - 1 END;
+IF x > 12133 THEN x := x - 1 END;
+IF x > 12134 THEN x := x - 1 END;
+IF x > 12135 THEN x := x - 1 END;
+IF x > 12136 THEN x := x - 1 END;
+IF x > 12137 THEN x := x - 1 END;
+IF x > 12138 THEN x := x - 1 END;
+IF x > 12139 THEN x := x - 1 END;
+IF x > 12140 THEN x := x - 1 END;
+IF x > 12141 THEN x := x - 1 END;
+IF x > 12142 THEN x := x - 1 END;
+IF x > 12143 THEN x := x - 1 END;
+IF x > 12144 THEN x := x - 1 END;
+IF x > 12145 THEN x := x - 1 END;
+IF x > 12146 THEN x := x - 1 END;
+IF x > 12147 THEN x := x - 1 END;
+IF x > 12148 THEN x := x - 1 END;
+IF x > 12149 THEN x := x - 1 END;
+IF x > 12150 THEN x := x - 1 END;
+IF x > 12151 THEN x := x - 1 END;
+IF x > 12152 THEN x := x - 1 END;
+IF x > 12153 THEN x := x - 1 END;
+IF x > 12154 THEN x := x - 1 END;
+IF x > 12155 THEN x := x - 1 END;
+IF x > 12156 THEN x := x - 1 END;
+IF x > 12157 THEN x := x - 1 END;
+IF x > 12158 THEN x := x - 1 END;
+IF x > 12159 THEN x := x - 1 END;
+IF x > 12160 THEN x := x - 1 END;
+IF x > 12161 THEN x := x - 1 END;
+IF x > 12162 THEN x := x - 1 END;
+IF x > 12163 THEN x := x - 1 END;
+IF x > 12164 THEN x := x - 1 END;
+IF x > 12165 THEN x := x - 1 END;
+IF x > 12166 THEN x := x - 1 END;
+IF x > 12167 THEN x := x - 1 END;
+IF x > 12168 THEN x := x - 1 END;
+IF x > 12169 THEN x := x - 1 END;
+IF x > 12170 THEN x := x - 1 END;
+IF x > 12171 THEN x := x - 1 END;
+IF x > 12172 THEN x := x - 1 END;
+IF x > 12173 THEN x := x - 1 END;
+IF x > 12174 THEN x := x - 1 END;
+IF x > 12175 THEN x := x - 1 END;
+IF x > 12176 THEN x := x - 1 END;
+IF x > 12177 THEN x := x - 1 END;
+IF x > 12178 THEN x := x - 1 END;
+IF x > 12179 THEN x := x - 1 END;
+IF x > 12180 THEN x := x - 1 END;
+IF x > 12181 THEN x := x - 1 END;
+IF x > 12182 THEN x := x - 1 END;
+IF x > 12183 THEN x := x - 1 END;
+IF x > 12184 THEN x := x - 1 END;
+IF x > 12185 THEN x := x - 1 END;
+IF x > 12186 THEN x := x - 1 END;
+IF x > 12187 THEN x := x - 1 END;
+IF x > 12188 THEN x := x - 1 END;
+IF x > 12189 THEN x := x - 1 END;
+IF x > 12190 THEN x := x - 1 END;
+IF x > 12191 THEN x := x - 1 END;
+IF x > 12192 THEN x := x - 1 END;
+IF x > 12193 THEN x := x - 1 END;
+IF x > 12194 THEN x := x - 1 END;
+IF x > 12195 THEN x := x - 1 END;
+IF x > 12196 THEN x := x - 1 END;
+IF x > 12197 THEN x := x - 1 END;
+IF x > 12198 THEN x := x - 1 END;
+IF x > 12199 THEN x := x - 1 END;
+IF x > 12200 THEN x := x - 1 END;
+IF x > 12201 THEN x := x - 1 END;
+IF x > 12202 THEN x := x - 1 END;
+IF x > 12203 THEN x := x - 1 END;
+IF x > 12204 THEN x := x - 1 END;
+IF x > 12205 THEN x := x - 1 END;
+IF x > 12206 THEN x := x - 1 END;
+IF x > 12207 THEN x := x - 1 END;
+IF x > 12208 THEN x := x - 1 END;
+IF x > 12209 THEN x := x - 1 END;
+IF x > 12210 THEN x := x - 1 END;
+IF x > 12211 THEN x := x - 1 END;
+IF x > 12212 THEN x := x - 1 END;
+IF x > 12213 THEN x := x - 1 END;
+IF x > 12214 THEN x := x - 1 END;
+IF x > 12215 THEN x := x - 1 END;
+IF x > 12216 THEN x := x - 1 END;
+IF x > 12217 THEN x := x - 1 END;
+IF x > 12218 THEN x := x - 1 END;
+IF x > 12219 THEN x := x - 1 END;
+IF x > 12220 THEN x := x - 1 END;
+IF x > 12221 THEN x := x - 1 END;
+IF x > 12222 THEN x := x - 1 END;
+IF x > 12223 THEN x := x - 1 END;
+IF x > 12224 THEN x := x - 1 END;
+IF x > 12225 THEN x := x - 1 END;
+IF x > 12226 THEN x := x - 1 END;
+IF x > 12227 THEN x := x - 1 END;
+IF x > 12228 THEN x := x - 1 END;
+IF x > 12229 THEN x := x - 1 END;
+IF x > 12230 THEN x := x - 1 END;
+IF x > 12231 THEN x := x - 1 END;
+IF x > 12232 THEN x := x - 1 END;
+IF x > 12233 THEN x := x - 1 END;
+IF x > 12234 THEN x := x - 1 END;
+IF x > 12235 THEN x := x - 1 END;
+IF x > 12236 THEN x := x - 1 END;
+IF x > 12237 THEN x := x - 1 END;
+IF x > 12238 THEN x := x - 1 END;
+IF x > 12239 THEN x := x - 1 END;
+IF x > 12240 THEN x := x - 1 END;
+IF x > 12241 THEN x := x - 1 END;
+IF x > 12242 THEN x := x - 1 END;
+IF x > 12243 THEN x := x - 1 END;
+IF x > 12244 THEN x := x - 1 END;
+IF x > 12245 THEN x := x - 1 END;
+IF x > 12246 THEN x := x - 1 END;
+IF x > 12247 THEN x := x - 1 END;
+IF x > 12248 THEN x := x - 1 END;
+IF x > 12249 THEN x := x - 1 END;
+IF x > 12250 THEN x := x - 1 END;
+IF x > 12251 THEN x := x - 1 END;
+IF x > 12252 THEN x := x - 1 END;
+IF x > 12253 THEN x := x - 1 END;
+IF x > 12254 THEN x := x - 1 END;
+IF x > 12255 THEN x := x - 1 END;
+IF x > 12256 THEN x := x - 1 END;
+IF x > 12257 THEN x := x - 1 END;
+IF x > 12258 THEN x := x - 1 END;
+IF x > 12259 THEN x := x - 1 END;
+IF x > 12260 THEN x := x - 1 END;
+IF x > 12261 THEN x := x - 1 END;
+IF x > 12262 THEN x := x - 1 END;
+IF x > 12263 THEN x := x - 1 END;
+IF x > 12264 THEN x := x - 1 END;
+IF x > 12265 THEN x := x - 1 END;
+IF x > 12266 THEN x := x - 1 END;
+IF x > 12267 THEN x := x - 1 END;
+IF x > 12268 THEN x := x - 1 END;
+IF x > 12269 THEN x := x - 1 END;
+IF x > 12270 THEN x := x - 1 END;
+IF x > 12271 THEN x := x - 1 END;
+IF x > 12272 THEN x := x - 1 END;
+IF x > 12273 THEN x := x - 1 END;
+IF x > 12274 THEN x := x - 1 END;
+IF x > 12275 THEN x := x - 1 END;
+IF x > 12276 THEN x := x - 1 END;
+IF x > 12277 THEN x := x - 1 END;
+IF x > 12278 THEN x := x - 1 END;
+IF x > 12279 THEN x := x - 1 END;
+IF x > 12280 THEN x := x - 1 END;
+IF x > 12281 THEN x := x - 1 END;
+IF x > 12282 THEN x := x - 1 END;
+IF x > 12283 THEN x := x - 1 END;
+IF x > 12284 THEN x := x - 1 END;
+IF x > 12285 THEN x := x - 1 END;
+IF x > 12286 THEN x := x - 1 END;
+IF x > 12287 THEN x := x - 1 END;
+IF x > 12288 THEN x := x - 1 END;
+IF x > 12289 THEN x := x - 1 END;
+IF x > 12290 THEN x := x - 1 END;
+IF x > 12291 THEN x := x - 1 END;
+IF x > 12292 THEN x := x - 1 END;
+IF x > 12293 THEN x := x - 1 END;
+IF x > 12294 THEN x := x - 1 END;
+IF x > 12295 THEN x := x - 1 END;
+IF x > 12296 THEN x := x - 1 END;
+IF x > 12297 THEN x := x - 1 END;
+IF x > 12298 THEN x := x - 1 END;
+IF x > 12299 THEN x := x - 1 END;
+IF x > 12300 THEN x := x - 1 END;
+IF x > 12301 THEN x := x - 1 END;
+IF x > 12302 THEN x := x - 1 END;
+IF x > 12303 THEN x := x - 1 END;
+IF x > 12304 THEN x := x - 1 END;
+IF x > 12305 THEN x := x - 1 END;
+IF x > 12306 THEN x := x - 1 END;
+IF x > 12307 THEN x := x - 1 END;
+IF x > 12308 THEN x := x - 1 END;
+IF x > 12309 THEN x := x - 1 END;
+IF x > 12310 THEN x := x - 1 END;
+IF x > 12311 THEN x := x - 1 END;
+IF x > 12312 THEN x := x - 1 END;
+IF x > 12313 THEN x := x - 1 END;
+IF x > 12314 THEN x := x - 1 END;
+IF x > 12315 THEN x := x - 1 END;
+IF x > 12316 THEN x := x - 1 END;
+IF x > 12317 THEN x := x - 1 END;
+IF x > 12318 THEN x := x - 1 END;
+IF x > 12319 THEN x := x - 1 END;
+IF x > 12320 THEN x := x - 1 END;
+IF x > 12321 THEN x := x - 1 END;
+IF x > 12322 THEN x := x - 1 END;
+IF x > 12323 THEN x := x - 1 END;
+IF x > 12324 THEN x := x - 1 END;
+IF x > 12325 THEN x := x - 1 END;
+IF x > 12326 THEN x := x - 1 END;
+IF x > 12327 THEN x := x - 1 END;
+IF x > 12328 THEN x := x - 1 END;
+IF x > 12329 THEN x := x - 1 END;
+IF x > 12330 THEN x := x - 1 END;
+IF x > 12331 THEN x := x - 1 END;
+IF x > 12332 THEN x := x - 1 END;
+IF x > 12333 THEN x := x - 1 END;
+IF x > 12334 THEN x := x - 1 END;
+IF x > 12335 THEN x := x - 1 END;
+IF x > 12336 THEN x := x - 1 END;
+IF x > 12337 THEN x := x - 1 END;
+IF x > 12338 THEN x := x - 1 END;
+IF x > 12339 THEN x := x - 1 END;
+IF x > 12340 THEN x := x - 1 END;
+IF x > 12341 THEN x := x - 1 END;
+IF x > 12342 THEN x := x - 1 END;
+IF x > 12343 THEN x := x - 1 END;
+IF x > 12344 THEN x := x - 1 END;
+IF x > 12345 THEN x := x - 1 END;
+IF x > 12346 THEN x := x - 1 END;
+IF x > 12347 THEN x := x - 1 END;
+IF x > 12348 THEN x := x - 1 END;
+IF x > 12349 THEN x := x - 1 END;
+IF x > 12350 THEN x := x - 1 END;
+IF x > 12351 THEN x := x - 1 END;
+IF x > 12352 THEN x := x - 1 END;
+IF x > 12353 THEN x := x - 1 END;
+IF x > 12354 THEN x := x - 1 END;
+IF x > 12355 THEN x := x - 1 END;
+IF x > 12356 THEN x := x - 1 END;
+IF x > 12357 THEN x := x - 1 END;
+IF x > 12358 THEN x := x - 1 END;
+IF x > 12359 THEN x := x - 1 END;
+IF x > 12360 THEN x := x - 1 END;
+IF x > 12361 THEN x := x - 1 END;
+IF x > 12362 THEN x := x - 1 END;
+IF x > 12363 THEN x := x - 1 END;
+IF x > 12364 THEN x := x - 1 END;
+IF x > 12365 THEN x := x - 1 END;
+IF x > 12366 THEN x := x - 1 END;
+IF x > 12367 THEN x := x - 1 END;
+IF x > 12368 THEN x := x - 1 END;
+IF x > 12369 THEN x := x - 1 END;
+IF x > 12370 THEN x := x - 1 END;
+IF x > 12371 THEN x := x - 1 END;
+IF x > 12372 THEN x := x - 1 END;
+IF x > 12373 THEN x := x - 1 END;
+IF x > 12374 THEN x := x - 1 END;
+IF x > 12375 THEN x := x - 1 END;
+IF x > 12376 THEN x := x - 1 END;
+IF x > 12377 THEN x := x - 1 END;
+IF x > 12378 THEN x := x - 1 END;
+IF x > 12379 THEN x := x - 1 END;
+IF x > 12380 THEN x := x - 1 END;
+IF x > 12381 THEN x := x - 1 END;
+IF x > 12382 THEN x := x - 1 END;
+IF x > 12383 THEN x := x - 1 END;
+IF x > 12384 THEN x := x - 1 END;
+IF x > 12385 THEN x := x - 1 END;
+IF x > 12386 THEN x := x - 1 END;
+IF x > 12387 THEN x := x - 1 END;
+IF x > 12388 THEN x := x - 1 END;
+IF x > 12389 THEN x := x - 1 END;
+IF x > 12390 THEN x := x - 1 END;
+IF x > 12391 THEN x := x - 1 END;
+IF x > 12392 THEN x := x - 1 END;
+IF x > 12393 THEN x := x - 1 END;
+IF x > 12394 THEN x := x - 1 END;
+IF x > 12395 THEN x := x - 1 END;
+IF x > 12396 THEN x := x - 1 END;
+IF x > 12397 THEN x := x - 1 END;
+IF x > 12398 THEN x := x - 1 END;
+IF x > 12399 THEN x := x - 1 END;
+IF x > 12400 THEN x := x - 1 END;
+IF x > 12401 THEN x := x - 1 END;
+IF x > 12402 THEN x := x - 1 END;
+IF x > 12403 THEN x := x - 1 END;
+IF x > 12404 THEN x := x - 1 END;
+IF x > 12405 THEN x := x - 1 END;
+IF x > 12406 THEN x := x - 1 END;
+IF x > 12407 THEN x := x - 1 END;
+IF x > 12408 THEN x := x - 1 END;
+IF x > 12409 THEN x := x - 1 END;
+IF x > 12410 THEN x := x - 1 END;
+IF x > 12411 THEN x := x - 1 END;
+IF x > 12412 THEN x := x - 1 END;
+IF x > 12413 THEN x := x - 1 END;
+IF x > 12414 THEN x := x - 1 END;
+IF x > 12415 THEN x := x - 1 END;
+IF x > 12416 THEN x := x - 1 END;
+IF x > 12417 THEN x := x - 1 END;
+IF x > 12418 THEN x := x - 1 END;
+IF x > 12419 THEN x := x - 1 END;
+IF x > 12420 THEN x := x - 1 END;
+IF x > 12421 THEN x := x - 1 END;
+IF x > 12422 THEN x := x - 1 END;
+IF x > 12423 THEN x := x - 1 END;
+IF x > 12424 THEN x := x - 1 END;
+IF x > 12425 THEN x := x - 1 END;
+IF x > 12426 THEN x := x - 1 END;
+IF x > 12427 THEN x := x - 1 END;
+IF x > 12428 THEN x := x - 1 END;
+IF x > 12429 THEN x := x - 1 END;
+IF x > 12430 THEN x := x - 1 END;
+IF x > 12431 THEN x := x - 1 END;
+IF x > 12432 THEN x := x - 1 END;
+IF x > 12433 THEN x := x - 1 END;
+IF x > 12434 THEN x := x - 1 END;
+IF x > 12435 THEN x := x - 1 END;
+IF x > 12436 THEN x := x - 1 END;
+IF x > 12437 THEN x := x - 1 END;
+IF x > 12438 THEN x := x - 1 END;
+IF x > 12439 THEN x := x - 1 END;
+IF x > 12440 THEN x := x - 1 END;
+IF x > 12441 THEN x := x - 1 END;
+IF x > 12442 THEN x := x - 1 END;
+IF x > 12443 THEN x := x - 1 END;
+IF x > 12444 THEN x := x - 1 END;
+IF x > 12445 THEN x := x - 1 END;
+IF x > 12446 THEN x := x - 1 END;
+IF x > 12447 THEN x := x - 1 END;
+IF x > 12448 THEN x := x - 1 END;
+IF x > 12449 THEN x := x - 1 END;
+IF x > 12450 THEN x := x - 1 END;
+IF x > 12451 THEN x := x - 1 END;
+IF x > 12452 THEN x := x - 1 END;
+IF x > 12453 THEN x := x - 1 END;
+IF x > 12454 THEN x := x - 1 END;
+IF x > 12455 THEN x := x - 1 END;
+IF x > 12456 THEN x := x - 1 END;
+IF x > 12457 THEN x := x - 1 END;
+IF x > 12458 THEN x := x - 1 END;
+IF x > 12459 THEN x := x - 1 END;
+IF x > 12460 THEN x := x - 1 END;
+IF x > 12461 THEN x := x - 1 END;
+IF x > 12462 THEN x := x - 1 END;
+IF x > 12463 THEN x := x - 1 END;
+IF x > 12464 THEN x := x - 1 END;
+IF x > 12465 THEN x := x - 1 END;
+IF x > 12466 THEN x := x - 1 END;
+IF x > 12467 THEN x := x - 1 END;
+IF x > 12468 THEN x := x - 1 END;
+IF x > 12469 THEN x := x - 1 END;
+IF x > 12470 THEN x := x - 1 END;
+IF x > 12471 THEN x := x - 1 END;
+IF x > 12472 THEN x := x - 1 END;
+IF x > 12473 THEN x := x - 1 END;
+IF x > 12474 THEN x := x - 1 END;
+IF x > 12475 THEN x := x - 1 END;
+IF x > 12476 THEN x := x - 1 END;
+IF x > 12477 THEN x := x - 1 END;
+IF x > 12478 THEN x := x - 1 END;
+IF x > 12479 THEN x := x - 1 END;
+IF x > 12480 THEN x := x - 1 END;
+IF x > 12481 THEN x := x - 1 END;
+IF x > 12482 THEN x := x - 1 END;
+IF x > 12483 THEN x := x - 1 END;
+IF x > 12484 THEN x := x - 1 END;
+IF x > 12485 THEN x := x - 1 END;
+IF x > 12486 THEN x := x - 1 END;
+IF x > 12487 THEN x := x - 1 END;
+IF x > 12488 THEN x := x - 1 END;
+IF x > 12489 THEN x := x - 1 END;
+IF x > 12490 THEN x := x - 1 END;
+IF x > 12491 THEN x := x - 1 END;
+IF x > 12492 THEN x := x - 1 END;
+IF x > 12493 THEN x := x - 1 END;
+IF x > 12494 THEN x := x - 1 END;
+IF x > 12495 THEN x := x - 1 END;
+IF x > 12496 THEN x := x - 1 END;
+IF x > 12497 THEN x := x - 1 END;
+IF x > 12498 THEN x := x - 1 END;
+IF x > 12499 THEN x := x - 1 END;
+IF x > 12500 THEN x := x - 1 END;
+IF x > 12501 THEN x := x - 1 END;
+IF x > 12502 THEN x := x - 1 END;
+IF x > 12503 THEN x := x - 1 END;
+IF x > 12504 THEN x := x - 1 END;
+IF x > 12505 THEN x := x - 1 END;
+IF x > 12506 THEN x := x - 1 END;
+IF x > 12507 THEN x := x - 1 END;
+IF x > 12508 THEN x := x - 1 END;
+IF x > 12509 THEN x := x - 1 END;
+IF x > 12510 THEN x := x - 1 END;
+IF x > 12511 THEN x := x - 1 END;
+IF x > 12512 THEN x := x - 1 END;
+IF x > 12513 THEN x := x - 1 END;
+IF x > 12514 THEN x := x - 1 END;
+IF x > 12515 THEN x := x - 1 END;
+IF x > 12516 THEN x := x - 1 END;
+IF x > 12517 THEN x := x - 1 END;
+IF x > 12518 THEN x := x - 1 END;
+IF x > 12519 THEN x := x - 1 END;
+IF x > 12520 THEN x := x - 1 END;
+IF x > 12521 THEN x := x - 1 END;
+IF x > 12522 THEN x := x - 1 END;
+IF x > 12523 THEN x := x - 1 END;
+IF x > 12524 THEN x := x - 1 END;
+IF x > 12525 THEN x := x - 1 END;
+IF x > 12526 THEN x := x - 1 END;
+IF x > 12527 THEN x := x - 1 END;
+IF x > 12528 THEN x := x - 1 END;
+IF x > 12529 THEN x := x - 1 END;
+IF x > 12530 THEN x := x - 1 END;
+IF x > 12531 THEN x := x - 1 END;
+IF x > 12532 THEN x := x - 1 END;
+IF x > 12533 THEN x := x - 1 END;
+IF x > 12534 THEN x := x - 1 END;
+IF x > 12535 THEN x := x - 1 END;
+IF x > 12536 THEN x := x - 1 END;
+IF x > 12537 THEN x := x - 1 END;
+IF x > 12538 THEN x := x - 1 END;
+IF x > 12539 THEN x := x - 1 END;
+IF x > 12540 THEN x := x - 1 END;
+IF x > 12541 THEN x := x - 1 END;
+IF x > 12542 THEN x := x - 1 END;
+IF x > 12543 THEN x := x - 1 END;
+IF x > 12544 THEN x := x - 1 END;
+IF x > 12545 THEN x := x - 1 END;
+IF x > 12546 THEN x := x - 1 END;
+IF x > 12547 THEN x := x - 1 END;
+IF x > 12548 THEN x := x - 1 END;
+IF x > 12549 THEN x := x - 1 END;
+IF x > 12550 THEN x := x - 1 END;
+IF x > 12551 THEN x := x - 1 END;
+IF x > 12552 THEN x := x - 1 END;
+IF x > 12553 THEN x := x - 1 END;
+IF x > 12554 THEN x := x - 1 END;
+IF x > 12555 THEN x := x - 1 END;
+IF x > 12556 THEN x := x - 1 END;
+IF x > 12557 THEN x := x - 1 END;
+IF x > 12558 THEN x := x - 1 END;
+IF x > 12559 THEN x := x - 1 END;
+IF x > 12560 THEN x := x - 1 END;
+IF x > 12561 THEN x := x - 1 END;
+IF x > 12562 THEN x := x - 1 END;
+IF x > 12563 THEN x := x - 1 END;
+IF x > 12564 THEN x := x - 1 END;
+IF x > 12565 THEN x := x - 1 END;
+IF x > 12566 THEN x := x - 1 END;
+IF x > 12567 THEN x := x - 1 END;
+IF x > 12568 THEN x := x - 1 END;
+IF x > 12569 THEN x := x - 1 END;
+IF x > 12570 THEN x := x - 1 END;
+IF x > 12571 THEN x := x - 1 END;
+IF x > 12572 THEN x := x - 1 END;
+IF x > 12573 THEN x := x - 1 END;
+IF x > 12574 THEN x := x - 1 END;
+IF x > 12575 THEN x := x - 1 END;
+IF x > 12576 THEN x := x - 1 END;
+IF x > 12577 THEN x := x - 1 END;
+IF x > 12578 THEN x := x - 1 END;
+IF x > 12579 THEN x := x - 1 END;
+IF x > 12580 THEN x := x - 1 END;
+IF x > 12581 THEN x := x - 1 END;
+IF x > 12582 THEN x := x - 1 END;
+IF x > 12583 THEN x := x - 1 END;
+IF x > 12584 THEN x := x - 1 END;
+IF x > 12585 THEN x := x - 1 END;
+IF x > 12586 THEN x := x - 1 END;
+IF x > 12587 THEN x := x - 1 END;
+IF x > 12588 THEN x := x - 1 END;
+IF x > 12589 THEN x := x - 1 END;
+IF x > 12590 THEN x := x - 1 END;
+IF x > 12591 THEN x := x - 1 END;
+IF x > 12592 THEN x := x - 1 END;
+IF x > 12593 THEN x := x - 1 END;
+IF x > 12594 THEN x := x - 1 END;
+IF x > 12595 THEN x := x - 1 END;
+IF x > 12596 THEN x := x - 1 END;
+IF x > 12597 THEN x := x - 1 END;
+IF x > 12598 THEN x := x - 1 END;
+IF x > 12599 THEN x := x - 1 END;
+IF x > 12600 THEN x := x - 1 END;
+IF x > 12601 THEN x := x - 1 END;
+IF x > 12602 THEN x := x - 1 END;
+IF x > 12603 THEN x := x - 1 END;
+IF x > 12604 THEN x := x - 1 END;
+IF x > 12605 THEN x := x - 1 END;
+IF x > 12606 THEN x := x - 1 END;
+IF x > 12607 THEN x := x - 1 END;
+IF x > 12608 THEN x := x - 1 END;
+IF x > 12609 THEN x := x - 1 END;
+IF x > 12610 THEN x := x - 1 END;
+IF x > 12611 THEN x := x - 1 END;
+IF x > 12612 THEN x := x - 1 END;
+IF x > 12613 THEN x := x - 1 END;
+IF x > 12614 THEN x := x - 1 END;
+IF x > 12615 THEN x := x - 1 END;
+IF x > 12616 THEN x := x - 1 END;
+IF x > 12617 THEN x := x - 1 END;
+IF x > 12618 THEN x := x - 1 END;
+IF x > 12619 THEN x := x - 1 END;
+IF x > 12620 THEN x := x - 1 END;
+IF x > 12621 THEN x := x - 1 END;
+IF x > 12622 THEN x := x - 1 END;
+IF x > 12623 THEN x := x - 1 END;
+IF x > 12624 THEN x := x - 1 END;
+IF x > 12625 THEN x := x - 1 END;
+IF x > 12626 THEN x := x - 1 END;
+IF x > 12627 THEN x := x - 1 END;
+IF x > 12628 THEN x := x - 1 END;
+IF x > 12629 THEN x := x - 1 END;
+IF x > 12630 THEN x := x - 1 END;
+IF x > 12631 THEN x := x - 1 END;
+IF x > 12632 THEN x := x - 1 END;
+IF x > 12633 THEN x := x - 1 END;
+IF x > 12634 THEN x := x - 1 END;
+IF x > 12635 THEN x := x - 1 END;
+IF x > 12636 THEN x := x - 1 END;
+IF x > 12637 THEN x := x - 1 END;
+IF x > 12638 THEN x := x - 1 END;
+IF x > 12639 THEN x := x - 1 END;
+IF x > 12640 THEN x := x - 1 END;
+IF x > 12641 THEN x := x - 1 END;
+IF x > 12642 THEN x := x - 1 END;
+IF x > 12643 THEN x := x - 1 END;
+IF x > 12644 THEN x := x - 1 END;
+IF x > 12645 THEN x := x - 1 END;
+IF x > 12646 THEN x := x - 1 END;
+IF x > 12647 THEN x := x - 1 END;
+IF x > 12648 THEN x := x - 1 END;
+IF x > 12649 THEN x := x - 1 END;
+IF x > 12650 THEN x := x - 1 END;
+IF x > 12651 THEN x := x - 1 END;
+IF x > 12652 THEN x := x - 1 END;
+IF x > 12653 THEN x := x - 1 END;
+IF x > 12654 THEN x := x - 1 END;
+IF x > 12655 THEN x := x - 1 END;
+IF x > 12656 THEN x := x - 1 END;
+IF x > 12657 THEN x := x - 1 END;
+IF x > 12658 THEN x := x - 1 END;
+IF x > 12659 THEN x := x - 1 END;
+IF x > 12660 THEN x := x - 1 END;
+IF x > 12661 THEN x := x - 1 END;
+IF x > 12662 THEN x := x - 1 END;
+IF x > 12663 THEN x := x - 1 END;
+IF x > 12664 THEN x := x - 1 END;
+IF x > 12665 THEN x := x - 1 END;
+IF x > 12666 THEN x := x - 1 END;
+IF x > 12667 THEN x := x - 1 END;
+IF x > 12668 THEN x := x - 1 END;
+IF x > 12669 THEN x := x - 1 END;
+IF x > 12670 THEN x := x - 1 END;
+IF x > 12671 THEN x := x - 1 END;
+IF x > 12672 THEN x := x - 1 END;
+IF x > 12673 THEN x := x - 1 END;
+IF x > 12674 THEN x := x - 1 END;
+IF x > 12675 THEN x := x - 1 END;
+IF x > 12676 THEN x := x - 1 END;
+IF x > 12677 THEN x := x - 1 END;
+IF x > 12678 THEN x := x - 1 END;
+IF x > 12679 THEN x := x - 1 END;
+IF x > 12680 THEN x := x - 1 END;
+IF x > 12681 THEN x := x - 1 END;
+IF x > 12682 THEN x := x - 1 END;
+IF x > 12683 THEN x := x - 1 END;
+IF x > 12684 THEN x := x - 1 END;
+IF x > 12685 THEN x := x - 1 END;
+IF x > 12686 THEN x := x - 1 END;
+IF x > 12687 THEN x := x - 1 END;
+IF x > 12688 THEN x := x - 1 END;
+IF x > 12689 THEN x := x - 1 END;
+IF x > 12690 THEN x := x - 1 END;
+IF x > 12691 THEN x := x - 1 END;
+IF x > 12692 THEN x := x - 1 END;
+IF x > 12693 THEN x := x - 1 END;
+IF x > 12694 THEN x := x - 1 END;
+IF x > 12695 THEN x := x - 1 END;
+IF x > 12696 THEN x := x - 1 END;
+IF x > 12697 THEN x := x - 1 END;
+IF x > 12698 THEN x := x - 1 END;
+IF x > 12699 THEN x := x - 1 END;
+IF x > 12700 THEN x := x - 1 END;
+IF x > 12701 THEN x := x - 1 END;
+IF x > 12702 THEN x := x - 1 END;
+IF x > 12703 THEN x := x - 1 END;
+IF x > 12704 THEN x := x - 1 END;
+IF x > 12705 THEN x := x - 1 END;
+IF x > 12706 THEN x := x - 1 END;
+IF x > 12707 THEN x := x - 1 END;
+IF x > 12708 THEN x := x - 1 END;
+IF x > 12709 THEN x := x - 1 END;
+IF x > 12710 THEN x := x - 1 END;
+IF x > 12711 THEN x := x - 1 END;
+IF x > 12712 THEN x := x - 1 END;
+IF x > 12713 THEN x := x - 1 END;
+IF x > 12714 THEN x := x - 1 END;
+IF x > 12715 THEN x := x - 1 END;
+IF x > 12716 THEN x := x - 1 END;
+IF x > 12717 THEN x := x - 1 END;
+IF x > 12718 THEN x := x - 1 END;
+IF x > 12719 THEN x := x - 1 END;
+IF x > 12720 THEN x := x - 1 END;
+IF x > 12721 THEN x := x - 1 END;
+IF x > 12722 THEN x := x - 1 END;
+IF x > 12723 THEN x := x - 1 END;
+IF x > 12724 THEN x := x - 1 END;
+IF x > 12725 THEN x := x - 1 END;
+IF x > 12726 THEN x := x - 1 END;
+IF x > 12727 THEN x := x - 1 END;
+IF x > 12728 THEN x := x - 1 END;
+IF x > 12729 THEN x := x - 1 END;
+IF x > 12730 THEN x := x - 1 END;
+IF x > 12731 THEN x := x - 1 END;
+IF x > 12732 THEN x := x - 1 END;
+IF x > 12733 THEN x := x - 1 END;
+IF x > 12734 THEN x := x - 1 END;
+IF x > 12735 THEN x := x - 1 END;
+IF x > 12736 THEN x := x - 1 END;
+IF x > 12737 THEN x := x - 1 END;
+IF x > 12738 THEN x := x - 1 END;
+IF x > 12739 THEN x := x - 1 END;
+IF x > 12740 THEN x := x - 1 END;
+IF x > 12741 THEN x := x - 1 END;
+IF x > 12742 THEN x := x - 1 END;
+IF x > 12743 THEN x := x - 1 END;
+IF x > 12744 THEN x := x - 1 END;
+IF x > 12745 THEN x := x - 1 END;
+IF x > 12746 THEN x := x - 1 END;
+IF x > 12747 THEN x := x - 1 END;
+IF x > 12748 THEN x := x - 1 END;
+IF x > 12749 THEN x := x - 1 END;
+IF x > 12750 THEN x := x - 1 END;
+IF x > 12751 THEN x := x - 1 END;
+IF x > 12752 THEN x := x - 1 END;
+IF x > 12753 THEN x := x - 1 END;
+IF x > 12754 THEN x := x - 1 END;
+IF x > 12755 THEN x := x - 1 END;
+IF x > 12756 THEN x := x - 1 END;
+IF x > 12757 THEN x := x - 1 END;
+IF x > 12758 THEN x := x - 1 END;
+IF x > 12759 THEN x := x - 1 END;
+IF x > 12760 THEN x := x - 1 END;
+IF x > 12761 THEN x := x - 1 END;
+IF x > 12762 THEN x := x - 1 END;
+IF x > 12763 THEN x := x - 1 END;
+IF x > 12764 THEN x := x - 1 END;
+IF x > 12765 THEN x := x - 1 END;
+IF x > 12766 THEN x := x - 1 END;
+IF x > 12767 THEN x := x - 1 END;
+IF x > 12768 THEN x := x - 1 END;
+IF x > 12769 THEN x := x - 1 END;
+IF x > 12770 THEN x := x - 1 END;
+IF x > 12771 THEN x := x - 1 END;
+IF x > 12772 THEN x := x - 1 END;
+IF x > 12773 THEN x := x - 1 END;
+IF x > 12774 THEN x := x - 1 END;
+IF x > 12775 THEN x := x - 1 END;
+IF x > 12776 THEN x := x - 1 END;
+IF x > 12777 THEN x := x - 1 END;
+IF x > 12778 THEN x := x - 1 END;
+IF x > 12779 THEN x := x - 1 END;
+IF x > 12780 THEN x := x - 1 END;
+IF x > 12781 THEN x := x - 1 END;
+IF x > 12782 THEN x := x - 1 END;
+IF x > 12783 THEN x := x - 1 END;
+IF x > 12784 THEN x := x - 1 END;
+IF x > 12785 THEN x := x - 1 END;
+IF x > 12786 THEN x := x - 1 END;
+IF x > 12787 THEN x := x - 1 END;
+IF x > 12788 THEN x := x - 1 END;
+IF x > 12789 THEN x := x - 1 END;
+IF x > 12790 THEN x := x - 1 END;
+IF x > 12791 THEN x := x - 1 END;
+IF x > 12792 THEN x := x - 1 END;
+IF x > 12793 THEN x := x - 1 END;
+IF x > 12794 THEN x := x - 1 END;
+IF x > 12795 THEN x := x - 1 END;
+IF x > 12796 THEN x := x - 1 END;
+IF x > 12797 THEN x := x - 1 END;
+IF x > 12798 THEN x := x - 1 END;
+IF x > 12799 THEN x := x - 1 END;
+IF x > 12800 THEN x := x - 1 END;
+IF x > 12801 THEN x := x - 1 END;
+IF x > 12802 THEN x := x - 1 END;
+IF x > 12803 THEN x := x - 1 END;
+IF x > 12804 THEN x := x - 1 END;
+IF x > 12805 THEN x := x - 1 END;
+IF x > 12806 THEN x := x - 1 END;
+IF x > 12807 THEN x := x - 1 END;
+IF x > 12808 THEN x := x - 1 END;
+IF x > 12809 THEN x := x - 1 END;
+IF x > 12810 THEN x := x - 1 END;
+IF x > 12811 THEN x := x - 1 END;
+IF x > 12812 THEN x := x - 1 END;
+IF x > 12813 THEN x := x - 1 END;
+IF x > 12814 THEN x := x - 1 END;
+IF x > 12815 THEN x := x - 1 END;
+IF x > 12816 THEN x := x - 1 END;
+IF x > 12817 THEN x := x - 1 END;
+IF x > 12818 THEN x := x - 1 END;
+IF x > 12819 THEN x := x - 1 END;
+IF x > 12820 THEN x := x - 1 END;
+IF x > 12821 THEN x := x - 1 END;
+IF x > 12822 THEN x := x - 1 END;
+IF x > 12823 THEN x := x - 1 END;
+IF x > 12824 THEN x := x - 1 END;
+IF x > 12825 THEN x := x - 1 END;
+IF x > 12826 THEN x := x - 1 END;
+IF x > 12827 THEN x := x - 1 END;
+IF x > 12828 THEN x := x - 1 END;
+IF x > 12829 THEN x := x - 1 END;
+IF x > 12830 THEN x := x - 1 END;
+IF x > 12831 THEN x := x - 1 END;
+IF x > 12832 THEN x := x - 1 END;
+IF x > 12833 THEN x := x - 1 END;
+IF x > 12834 THEN x := x - 1 END;
+IF x > 12835 THEN x := x - 1 END;
+IF x > 12836 THEN x := x - 1 END;
+IF x > 12837 THEN x := x - 1 END;
+IF x > 12838 THEN x := x - 1 END;
+IF x > 12839 THEN x := x - 1 END;
+IF x > 12840 THEN x := x - 1 END;
+IF x > 12841 THEN x := x - 1 END;
+IF x > 12842 THEN x := x - 1 END;
+IF x > 12843 THEN x := x - 1 END;
+IF x > 12844 THEN x := x - 1 END;
+IF x > 12845 THEN x := x - 1 END;
+IF x > 12846 THEN x := x - 1 END;
+IF x > 12847 THEN x := x - 1 END;
+IF x > 12848 THEN x := x - 1 END;
+IF x > 12849 THEN x := x - 1 END;
+IF x > 12850 THEN x := x - 1 END;
+IF x > 12851 THEN x := x - 1 END;
+IF x > 12852 THEN x := x - 1 END;
+IF x > 12853 THEN x := x - 1 END;
+IF x > 12854 THEN x := x - 1 END;
+IF x > 12855 THEN x := x - 1 END;
+IF x > 12856 THEN x := x - 1 END;
+IF x > 12857 THEN x := x - 1 END;
+IF x > 12858 THEN x := x - 1 END;
+IF x > 12859 THEN x := x - 1 END;
+IF x > 12860 THEN x := x - 1 END;
+IF x > 12861 THEN x := x - 1 END;
+IF x > 12862 THEN x := x - 1 END;
+IF x > 12863 THEN x := x - 1 END;
+IF x > 12864 THEN x := x - 1 END;
+IF x > 12865 THEN x := x - 1 END;
+IF x > 12866 THEN x := x - 1 END;
+IF x > 12867 THEN x := x - 1 END;
+IF x > 12868 THEN x := x - 1 END;
+IF x > 12869 THEN x := x - 1 END;
+IF x > 12870 THEN x := x - 1 END;
+IF x > 12871 THEN x := x - 1 END;
+IF x > 12872 THEN x := x - 1 END;
+IF x > 12873 THEN x := x - 1 END;
+IF x > 12874 THEN x := x - 1 END;
+IF x > 12875 THEN x := x - 1 END;
+IF x > 12876 THEN x := x - 1 END;
+IF x > 12877 THEN x := x - 1 END;
+IF x > 12878 THEN x := x - 1 END;
+IF x > 12879 THEN x := x - 1 END;
+IF x > 12880 THEN x := x - 1 END;
+IF x > 12881 THEN x := x - 1 END;
+IF x > 12882 THEN x := x - 1 END;
+IF x > 12883 THEN x := x - 1 END;
+IF x > 12884 THEN x := x - 1 END;
+IF x > 12885 THEN x := x - 1 END;
+IF x > 12886 THEN x := x - 1 END;
+IF x > 12887 THEN x := x - 1 END;
+IF x > 12888 THEN x := x - 1 END;
+IF x > 12889 THEN x := x - 1 END;
+IF x > 12890 THEN x := x - 1 END;
+IF x > 12891 THEN x := x - 1 END;
+IF x > 12892 THEN x := x - 1 END;
+IF x > 12893 THEN x := x - 1 END;
+IF x > 12894 THEN x := x - 1 END;
+IF x > 12895 THEN x := x - 1 END;
+IF x > 12896 THEN x := x - 1 END;
+IF x > 12897 THEN x := x - 1 END;
+IF x > 12898 THEN x := x - 1 END;
+IF x > 12899 THEN x := x - 1 END;
+IF x > 12900 THEN x := x - 1 END;
+IF x > 12901 THEN x := x - 1 END;
+IF x > 12902 THEN x := x - 1 END;
+IF x > 12903 THEN x := x - 1 END;
+IF x > 12904 THEN x := x - 1 END;
+IF x > 12905 THEN x := x - 1 END;
+IF x > 12906 THEN x := x - 1 END;
+IF x > 12907 THEN x := x - 1 END;
+IF x > 12908 THEN x := x - 1 END;
+IF x > 12909 THEN x := x - 1 END;
+IF x > 12910 THEN x := x - 1 END;
+IF x > 12911 THEN x := x - 1 END;
+IF x > 12912 THEN x := x - 1 END;
+IF x > 12913 THEN x := x - 1 END;
+IF x > 12914 THEN x := x - 1 END;
+IF x > 12915 THEN x := x - 1 END;
+IF x > 12916 THEN x := x - 1 END;
+IF x > 12917 THEN x := x - 1 END;
+IF x > 12918 THEN x := x - 1 END;
+IF x > 12919 THEN x := x - 1 END;
+IF x > 12920 THEN x := x - 1 END;
+IF x > 12921 THEN x := x - 1 END;
+IF x > 12922 THEN x := x - 1 END;
+IF x > 12923 THEN x := x - 1 END;
+IF x > 12924 THEN x := x - 1 END;
+IF x > 12925 THEN x := x - 1 END;
+IF x > 12926 THEN x := x - 1 END;
+IF x > 12927 THEN x := x - 1 END;
+IF x > 12928 THEN x := x - 1 END;
+IF x > 12929 THEN x := x - 1 END;
+IF x > 12930 THEN x := x - 1 END;
+IF x > 12931 THEN x := x - 1 END;
+IF x > 12932 THEN x := x - 1 END;
+IF x > 12933 THEN x := x - 1 END;
+IF x > 12934 THEN x := x - 1 END;
+IF x > 12935 THEN x := x - 1 END;
+IF x > 12936 THEN x := x - 1 END;
+IF x > 12937 THEN x := x - 1 END;
+IF x > 12938 THEN x := x - 1 END;
+IF x > 12939 THEN x := x - 1 END;
+IF x > 12940 THEN x := x - 1 END;
+IF x > 12941 THEN x := x - 1 END;
+IF x > 12942 THEN x := x - 1 END;
+IF x > 12943 THEN x := x - 1 END;
+IF x > 12944 THEN x := x - 1 END;
+IF x > 12945 THEN x := x - 1 END;
+IF x > 12946 THEN x := x - 1 END;
+IF x > 12947 THEN x := x - 1 END;
+IF x > 12948 THEN x := x - 1 END;
+IF x > 12949 THEN x := x - 1 END;
+IF x > 12950 THEN x := x - 1 END;
+IF x > 12951 THEN x := x - 1 END;
+IF x > 12952 THEN x := x - 1 END;
+IF x > 12953 THEN x := x - 1 END;
+IF x > 12954 THEN x := x - 1 END;
+IF x > 12955 THEN x := x - 1 END;
+IF x > 12956 THEN x := x - 1 END;
+IF x > 12957 THEN x := x - 1 END;
+IF x > 12958 THEN x := x - 1 END;
+IF x > 12959 THEN x := x - 1 END;
+IF x > 12960 THEN x := x - 1 END;
+IF x > 12961 THEN x := x - 1 END;
+IF x > 12962 THEN x := x - 1 END;
+IF x > 12963 THEN x := x - 1 END;
+IF x > 12964 THEN x := x - 1 END;
+IF x > 12965 THEN x := x - 1 END;
+IF x > 12966 THEN x := x - 1 END;
+IF x > 12967 THEN x := x - 1 END;
+IF x > 12968 THEN x := x - 1 END;
+IF x > 12969 THEN x := x - 1 END;
+IF x > 12970 THEN x := x - 1 END;
+IF x > 12971 THEN x := x - 1 END;
+IF x > 12972 THEN x := x - 1 END;
+IF x > 12973 THEN x := x - 1 END;
+IF x > 12974 THEN x := x - 1 END;
+IF x > 12975 THEN x := x - 1 END;
+IF x > 12976 THEN x := x - 1 END;
+IF x > 12977 THEN x := x - 1 END;
+IF x > 12978 THEN x := x - 1 END;
+IF x > 12979 THEN x := x - 1 END;
+IF x > 12980 THEN x := x - 1 END;
+IF x > 12981 THEN x := x - 1 END;
+IF x > 12982 THEN x := x - 1 END;
+IF x > 12983 THEN x := x - 1 END;
+IF x > 12984 THEN x := x - 1 END;
+IF x > 12985 THEN x := x - 1 END;
+IF x > 12986 THEN x := x - 1 END;
+IF x > 12987 THEN x := x - 1 END;
+IF x > 12988 THEN x := x - 1 END;
+IF x > 12989 THEN x := x - 1 END;
+IF x > 12990 THEN x := x - 1 END;
+IF x > 12991 THEN x := x - 1 END;
+IF x > 12992 THEN x := x - 1 END;
+IF x > 12993 THEN x := x - 1 END;
+IF x > 12994 THEN x := x - 1 END;
+IF x > 12995 THEN x := x - 1 END;
+IF x > 12996 THEN x := x - 1 END;
+IF x > 12997 THEN x := x - 1 END;
+IF x > 12998 THEN x := x - 1 END;
+IF x > 12999 THEN x := x - 1 END;
+IF x > 13000 THEN x := x - 1 END;
+IF x > 13001 THEN x := x - 1 END;
+IF x > 13002 THEN x := x - 1 END;
+IF x > 13003 THEN x := x - 1 END;
+IF x > 13004 THEN x := x - 1 END;
+IF x > 13005 THEN x := x - 1 END;
+IF x > 13006 THEN x := x - 1 END;
+IF x > 13007 THEN x := x - 1 END;
+IF x > 13008 THEN x := x - 1 END;
+IF x > 13009 THEN x := x - 1 END;
+IF x > 13010 THEN x := x - 1 END;
+IF x > 13011 THEN x := x - 1 END;
+IF x > 13012 THEN x := x - 1 END;
+IF x > 13013 THEN x := x - 1 END;
+IF x > 13014 THEN x := x - 1 END;
+IF x > 13015 THEN x := x - 1 END;
+IF x > 13016 THEN x := x - 1 END;
+IF x > 13017 THEN x := x - 1 END;
+IF x > 13018 THEN x := x - 1 END;
+IF x > 13019 THEN x := x - 1 END;
+IF x > 13020 THEN x := x - 1 END;
+IF x > 13021 THEN x := x - 1 END;
+IF x > 13022 THEN x := x - 1 END;
+IF x > 13023 THEN x := x - 1 END;
+IF x > 13024 THEN x := x - 1 END;
+IF x > 13025 THEN x := x - 1 END;
+IF x > 13026 THEN x := x - 1 END;
+IF x > 13027 THEN x := x - 1 END;
+IF x > 13028 THEN x := x - 1 END;
+IF x > 13029 THEN x := x - 1 END;
+IF x > 13030 THEN x := x - 1 END;
+IF x > 13031 THEN x := x - 1 END;
+IF x > 13032 THEN x := x - 1 END;
+IF x > 13033 THEN x := x - 1 END;
+IF x > 13034 THEN x := x - 1 END;
+IF x > 13035 THEN x := x - 1 END;
+IF x > 13036 THEN x := x - 1 END;
+IF x > 13037 THEN x := x - 1 END;
+IF x > 13038 THEN x := x - 1 END;
+IF x > 13039 THEN x := x - 1 END;
+IF x > 13040 THEN x := x - 1 END;
+IF x > 13041 THEN x := x - 1 END;
+IF x > 13042 THEN x := x - 1 END;
+IF x > 13043 THEN x := x - 1 END;
+IF x > 13044 THEN x := x - 1 END;
+IF x > 13045 THEN x := x - 1 END;
+IF x > 13046 THEN x := x - 1 END;
+IF x > 13047 THEN x := x - 1 END;
+IF x > 13048 THEN x := x - 1 END;
+IF x > 13049 THEN x := x - 1 END;
+IF x > 13050 THEN x := x - 1 END;
+IF x > 13051 THEN x := x - 1 END;
+IF x > 13052 THEN x := x - 1 END;
+IF x > 13053 THEN x := x - 1 END;
+IF x > 13054 THEN x := x - 1 END;
+IF x > 13055 THEN x := x - 1 END;
+IF x > 13056 THEN x := x - 1 END;
+IF x > 13057 THEN x := x - 1 END;
+IF x > 13058 THEN x := x - 1 END;
+IF x > 13059 THEN x := x - 1 END;
+IF x > 13060 THEN x := x - 1 END;
+IF x > 13061 THEN x := x - 1 END;
+IF x > 13062 THEN x := x - 1 END;
+IF x > 13063 THEN x := x - 1 END;
+IF x > 13064 THEN x := x - 1 END;
+IF x > 13065 THEN x := x - 1 END;
+IF x > 13066 THEN x := x - 1 END;
+IF x > 13067 THEN x := x - 1 END;
+IF x > 13068 THEN x := x - 1 END;
+IF x > 13069 THEN x := x - 1 END;
+IF x > 13070 THEN x := x - 1 END;
+IF x > 13071 THEN x := x - 1 END;
+IF x > 13072 THEN x := x - 1 END;
+IF x > 13073 THEN x := x - 1 END;
+IF x > 13074 THEN x := x - 1 END;
+IF x > 13075 THEN x := x - 1 END;
+IF x > 13076 THEN x := x - 1 END;
+IF x > 13077 THEN x := x - 1 END;
+IF x > 13078 THEN x := x - 1 END;
+IF x > 13079 THEN x := x - 1 END;
+IF x > 13080 THEN x := x - 1 END;
+IF x > 13081 THEN x := x - 1 END;
+IF x > 13082 THEN x := x - 1 END;
+IF x > 13083 THEN x := x - 1 END;
+IF x > 13084 THEN x := x - 1 END;
+IF x > 13085 THEN x := x - 1 END;
+IF x > 13086 THEN x := x - 1 END;
+IF x > 13087 THEN x := x - 1 END;
+IF x > 13088 THEN x := x - 1 END;
+IF x > 13089 THEN x := x - 1 END;
+IF x > 13090 THEN x := x - 1 END;
+IF x > 13091 THEN x := x - 1 END;
+IF x > 13092 THEN x := x - 1 END;
+IF x > 13093 THEN x := x - 1 END;
+IF x > 13094 THEN x := x - 1 END;
+IF x > 13095 THEN x := x - 1 END;
+IF x > 13096 THEN x := x - 1 END;
+IF x > 13097 THEN x := x - 1 END;
+IF x > 13098 THEN x := x - 1 END;
+IF x > 13099 THEN x := x - 1 END;
+IF x > 13100 THEN x := x - 1 END;
+IF x > 13101 THEN x := x - 1 END;
+IF x > 13102 THEN x := x - 1 END;
+IF x > 13103 THEN x := x - 1 END;
+IF x > 13104 THEN x := x - 1 END;
+IF x > 13105 THEN x := x - 1 END;
+IF x > 13106 THEN x := x - 1 END;
+IF x > 13107 THEN x := x - 1 END;
+IF x > 13108 THEN x := x - 1 END;
+IF x > 13109 THEN x := x - 1 END;
+IF x > 13110 THEN x := x - 1 END;
+IF x > 13111 THEN x := x - 1 END;
+IF x > 13112 THEN x := x - 1 END;
+IF x > 13113 THEN x := x - 1 END;
+IF x > 13114 THEN x := x - 1 END;
+IF x > 13115 THEN x := x - 1 END;
+IF x > 13116 THEN x := x - 1 END;
+IF x > 13117 THEN x := x - 1 END;
+IF x > 13118 THEN x := x - 1 END;
+IF x > 13119 THEN x := x - 1 END;
+IF x > 13120 THEN x := x - 1 END;
+IF x > 13121 THEN x := x - 1 END;
+IF x > 13122 THEN x := x - 1 END;
+IF x > 13123 THEN x := x - 1 END;
+IF x > 13124 THEN x := x - 1 END;
+IF x > 13125 THEN x := x - 1 END;
+IF x > 13126 THEN x := x - 1 END;
+IF x > 13127 THEN x := x - 1 END;
+IF x > 13128 THEN x := x - 1 END;
+IF x > 13129 THEN x := x - 1 END;
+IF x > 13130 THEN x := x - 1 END;
+IF x > 13131 THEN x := x - 1 END;
+IF x > 13132 THEN x := x - 1 END;
+IF x > 13133 THEN x := x - 1 END;
+IF x > 13134 THEN x := x - 1 END;
+IF x > 13135 THEN x := x - 1 END;
+IF x > 13136 THEN x := x - 1 END;
+IF x > 13137 THEN x := x - 1 END;
+IF x > 13138 THEN x := x - 1 END;
+IF x > 13139 THEN x := x - 1 END;
+IF x > 13140 THEN x := x - 1 END;
+IF x > 13141 THEN x := x - 1 END;
+IF x > 13142 THEN x := x - 1 END;
+IF x > 13143 THEN x := x - 1 END;
+IF x > 13144 THEN x := x - 1 END;
+IF x > 13145 THEN x := x - 1 END;
+IF x > 13146 THEN x := x - 1 END;
+IF x > 13147 THEN x := x - 1 END;
+IF x > 13148 THEN x := x - 1 END;
+IF x > 13149 THEN x := x - 1 END;
+IF x > 13150 THEN x := x - 1 END;
+IF x > 13151 THEN x := x - 1 END;
+IF x > 13152 THEN x := x - 1 END;
+IF x > 13153 THEN x := x - 1 END;
+IF x > 13154 THEN x := x - 1 END;
+IF x > 13155 THEN x := x - 1 END;
+IF x > 13156 THEN x := x - 1 END;
+IF x > 13157 THEN x := x - 1 END;
+IF x > 13158 THEN x := x - 1 END;
+IF x > 13159 THEN x := x - 1 END;
+IF x > 13160 THEN x := x - 1 END;
+IF x > 13161 THEN x := x - 1 END;
+IF x > 13162 THEN x := x - 1 END;
+IF x > 13163 THEN x := x - 1 END;
+IF x > 13164 THEN x := x - 1 END;
+IF x > 13165 THEN x := x - 1 END;
+IF x > 13166 THEN x := x - 1 END;
+IF x > 13167 THEN x := x - 1 END;
+IF x > 13168 THEN x := x - 1 END;
+IF x > 13169 THEN x := x - 1 END;
+IF x > 13170 THEN x := x - 1 END;
+IF x > 13171 THEN x := x - 1 END;
+IF x > 13172 THEN x := x - 1 END;
+IF x > 13173 THEN x := x - 1 END;
+IF x > 13174 THEN x := x - 1 END;
+IF x > 13175 THEN x := x - 1 END;
+IF x > 13176 THEN x := x - 1 END;
+IF x > 13177 THEN x := x - 1 END;
+IF x > 13178 THEN x := x - 1 END;
+IF x > 13179 THEN x := x - 1 END;
+IF x > 13180 THEN x := x - 1 END;
+IF x > 13181 THEN x := x - 1 END;
+IF x > 13182 THEN x := x - 1 END;
+IF x > 13183 THEN x := x - 1 END;
+IF x > 13184 THEN x := x - 1 END;
+IF x > 13185 THEN x := x - 1 END;
+IF x > 13186 THEN x := x - 1 END;
+IF x > 13187 THEN x := x - 1 END;
+IF x > 13188 THEN x := x - 1 END;
+IF x > 13189 THEN x := x - 1 END;
+IF x > 13190 THEN x := x - 1 END;
+IF x > 13191 THEN x := x - 1 END;
+IF x > 13192 THEN x := x - 1 END;
+IF x > 13193 THEN x := x - 1 END;
+IF x > 13194 THEN x := x - 1 END;
+IF x > 13195 THEN x := x - 1 END;
+IF x > 13196 THEN x := x - 1 END;
+IF x > 13197 THEN x := x - 1 END;
+IF x > 13198 THEN x := x - 1 END;
+IF x > 13199 THEN x := x - 1 END;
+IF x > 13200 THEN x := x - 1 END;
+IF x > 13201 THEN x := x - 1 END;
+IF x > 13202 THEN x := x - 1 END;
+IF x > 13203 THEN x := x - 1 END;
+IF x > 13204 THEN x := x - 1 END;
+IF x > 13205 THEN x := x - 1 END;
+IF x > 13206 THEN x := x - 1 END;
+IF x > 13207 THEN x := x - 1 END;
+IF x > 13208 THEN x := x - 1 END;
+IF x > 13209 THEN x := x - 1 END;
+IF x > 13210 THEN x := x - 1 END;
+IF x > 13211 THEN x := x - 1 END;
+IF x > 13212 THEN x := x - 1 END;
+IF x > 13213 THEN x := x - 1 END;
+IF x > 13214 THEN x := x - 1 END;
+IF x > 13215 THEN x := x - 1 END;
+IF x > 13216 THEN x := x - 1 END;
+IF x > 13217 THEN x := x - 1 END;
+IF x > 13218 THEN x := x - 1 END;
+IF x > 13219 THEN x := x - 1 END;
+IF x > 13220 THEN x := x - 1 END;
+IF x > 13221 THEN x := x - 1 END;
+IF x > 13222 THEN x := x - 1 END;
+IF x > 13223 THEN x := x - 1 END;
+IF x > 13224 THEN x := x - 1 END;
+IF x > 13225 THEN x := x - 1 END;
+IF x > 13226 THEN x := x - 1 END;
+IF x > 13227 THEN x := x - 1 END;
+IF x > 13228 THEN x := x - 1 END;
+IF x > 13229 THEN x := x - 1 END;
+IF x > 13230 THEN x := x - 1 END;
+IF x > 13231 THEN x := x - 1 END;
+IF x > 13232 THEN x := x - 1 END;
+IF x > 13233 THEN x := x - 1 END;
+IF x > 13234 THEN x := x - 1 END;
+IF x > 13235 THEN x := x - 1 END;
+IF x > 13236 THEN x := x - 1 END;
+IF x > 13237 THEN x := x - 1 END;
+IF x > 13238 THEN x := x - 1 END;
+IF x > 13239 THEN x := x - 1 END;
+IF x > 13240 THEN x := x - 1 END;
+IF x > 13241 THEN x := x - 1 END;
+IF x > 13242 THEN x := x - 1 END;
+IF x > 13243 THEN x := x - 1 END;
+IF x > 13244 THEN x := x - 1 END;
+IF x > 13245 THEN x := x - 1 END;
+IF x > 13246 THEN x := x - 1 END;
+IF x > 13247 THEN x := x - 1 END;
+IF x > 13248 THEN x := x - 1 END;
+IF x > 13249 THEN x := x - 1 END;
+IF x > 13250 THEN x := x - 1 END;
+IF x > 13251 THEN x := x - 1 END;
+IF x > 13252 THEN x := x - 1 END;
+IF x > 13253 THEN x := x - 1 END;
+IF x > 13254 THEN x := x - 1 END;
+IF x > 13255 THEN x := x - 1 END;
+IF x > 13256 THEN x := x - 1 END;
+IF x > 13257 THEN x := x - 1 END;
+IF x > 13258 THEN x := x - 1 END;
+IF x > 13259 THEN x := x - 1 END;
+IF x > 13260 THEN x := x - 1 END;
+IF x > 13261 THEN x := x - 1 END;
+IF x > 13262 THEN x := x - 1 END;
+IF x > 13263 THEN x := x - 1 END;
+IF x > 13264 THEN x := x - 1 END;
+IF x > 13265 THEN x := x - 1 END;
+IF x > 13266 THEN x := x - 1 END;
+IF x > 13267 THEN x := x - 1 END;
+IF x > 13268 THEN x := x - 1 END;
+IF x > 13269 THEN x := x - 1 END;
+IF x > 13270 THEN x := x - 1 END;
+IF x > 13271 THEN x := x - 1 END;
+IF x > 13272 THEN x := x - 1 END;
+IF x > 13273 THEN x := x - 1 END;
+IF x > 13274 THEN x := x - 1 END;
+IF x > 13275 THEN x := x - 1 END;
+IF x > 13276 THEN x := x - 1 END;
+IF x > 13277 THEN x := x - 1 END;
+IF x > 13278 THEN x := x - 1 END;
+IF x > 13279 THEN x := x - 1 END;
+IF x > 13280 THEN x := x - 1 END;
+IF x > 13281 THEN x := x - 1 END;
+IF x > 13282 THEN x := x - 1 END;
+IF x > 13283 THEN x := x - 1 END;
+IF x > 13284 THEN x := x - 1 END;
+IF x > 13285 THEN x := x - 1 END;
+IF x > 13286 THEN x := x - 1 END;
+IF x > 13287 THEN x := x - 1 END;
+IF x > 13288 THEN x := x - 1 END;
+IF x > 13289 THEN x := x - 1 END;
+IF x > 13290 THEN x := x - 1 END;
+IF x > 13291 THEN x := x - 1 END;
+IF x > 13292 THEN x := x - 1 END;
+IF x > 13293 THEN x := x - 1 END;
+IF x > 13294 THEN x := x - 1 END;
+IF x > 13295 THEN x := x - 1 END;
+IF x > 13296 THEN x := x - 1 END;
+IF x > 13297 THEN x := x - 1 END;
+IF x > 13298 THEN x := x - 1 END;
+IF x > 13299 THEN x := x - 1 END;
+IF x > 13300 THEN x := x - 1 END;
+IF x > 13301 THEN x := x - 1 END;
+IF x > 13302 THEN x := x - 1 END;
+IF x > 13303 THEN x := x - 1 END;
+IF x > 13304 THEN x := x - 1 END;
+IF x > 13305 THEN x := x - 1 END;
+IF x > 13306 THEN x := x - 1 END;
+IF x > 13307 THEN x := x - 1 END;
+IF x > 13308 THEN x := x - 1 END;
+IF x > 13309 THEN x := x - 1 END;
+IF x > 13310 THEN x := x - 1 END;
+IF x > 13311 THEN x := x - 1 END;
+IF x > 13312 THEN x := x - 1 END;
+IF x > 13313 THEN x := x - 1 END;
+IF x > 13314 THEN x := x - 1 END;
+IF x > 13315 THEN x := x - 1 END;
+IF x > 13316 THEN x := x - 1 END;
+IF x > 13317 THEN x := x - 1 END;
+IF x > 13318 THEN x := x - 1 END;
+IF x > 13319 THEN x := x - 1 END;
+IF x > 13320 THEN x := x - 1 END;
+IF x > 13321 THEN x := x - 1 END;
+IF x > 13322 THEN x := x - 1 END;
+IF x > 13323 THEN x := x - 1 END;
+IF x > 13324 THEN x := x - 1 END;
+IF x > 13325 THEN x := x - 1 END;
+IF x > 13326 THEN x := x - 1 END;
+IF x > 13327 THEN x := x - 1 END;
+IF x > 13328 THEN x := x - 1 END;
+IF x > 13329 THEN x := x - 1 END;
+IF x > 13330 THEN x := x - 1 END;
+IF x > 13331 THEN x := x - 1 END;
+IF x > 13332 THEN x := x - 1 END;
+IF x > 13333 THEN x := x - 1 END;
+IF x > 13334 THEN x := x - 1 END;
+IF x > 13335 THEN x := x - 1 END;
+IF x > 13336 THEN x := x - 1 END;
+IF x > 13337 THEN x := x - 1 END;
+IF x > 13338 THEN x := x - 1 END;
+IF x > 13339 THEN x := x - 1 END;
+IF x > 13340 THEN x := x - 1 END;
+IF x > 13341 THEN x := x - 1 END;
+IF x > 13342 THEN x := x - 1 END;
+IF x > 13343 THEN x := x - 1 END;
+IF x > 13344 THEN x := x - 1 END;
+IF x > 13345 THEN x := x - 1 END;
+IF x > 13346 THEN x := x - 1 END;
+IF x > 13347 THEN x := x - 1 END;
+IF x > 13348 THEN x := x - 1 END;
+IF x > 13349 THEN x := x - 1 END;
+IF x > 13350 THEN x := x - 1 END;
+IF x > 13351 THEN x := x - 1 END;
+IF x > 13352 THEN x := x - 1 END;
+IF x > 13353 THEN x := x - 1 END;
+IF x > 13354 THEN x := x - 1 END;
+IF x > 13355 THEN x := x - 1 END;
+IF x > 13356 THEN x := x - 1 END;
+IF x > 13357 THEN x := x - 1 END;
+IF x > 13358 THEN x := x - 1 END;
+IF x > 13359 THEN x := x - 1 END;
+IF x > 13360 THEN x := x - 1 END;
+IF x > 13361 THEN x := x - 1 END;
+IF x > 13362 THEN x := x - 1 END;
+IF x > 13363 THEN x := x - 1 END;
+IF x > 13364 THEN x := x - 1 END;
+IF x > 13365 THEN x := x - 1 END;
+IF x > 13366 THEN x := x - 1 END;
+IF x > 13367 THEN x := x - 1 END;
+IF x > 13368 THEN x := x - 1 END;
+IF x > 13369 THEN x := x - 1 END;
+IF x > 13370 THEN x := x - 1 END;
+IF x > 13371 THEN x := x - 1 END;
+IF x > 13372 THEN x := x - 1 END;
+IF x > 13373 THEN x := x - 1 END;
+IF x > 13374 THEN x := x - 1 END;
+IF x > 13375 THEN x := x - 1 END;
+IF x > 13376 THEN x := x - 1 END;
+IF x > 13377 THEN x := x - 1 END;
+IF x > 13378 THEN x := x - 1 END;
+IF x > 13379 THEN x := x - 1 END;
+IF x > 13380 THEN x := x - 1 END;
+IF x > 13381 THEN x := x - 1 END;
+IF x > 13382 THEN x := x - 1 END;
+IF x > 13383 THEN x := x - 1 END;
+IF x > 13384 THEN x := x - 1 END;
+IF x > 13385 THEN x := x - 1 END;
+IF x > 13386 THEN x := x - 1 END;
+IF x > 13387 THEN x := x - 1 END;
+IF x > 13388 THEN x := x - 1 END;
+IF x > 13389 THEN x := x - 1 END;
+IF x > 13390 THEN x := x - 1 END;
+IF x > 13391 THEN x := x - 1 END;
+IF x > 13392 THEN x := x - 1 END;
+IF x > 13393 THEN x := x - 1 END;
+IF x > 13394 THEN x := x - 1 END;
+IF x > 13395 THEN x := x - 1 END;
+IF x > 13396 THEN x := x - 1 END;
+IF x > 13397 THEN x := x - 1 END;
+IF x > 13398 THEN x := x - 1 END;
+IF x > 13399 THEN x := x - 1 END;
+IF x > 13400 THEN x := x - 1 END;
+IF x > 13401 THEN x := x - 1 END;
+IF x > 13402 THEN x := x - 1 END;
+IF x > 13403 THEN x := x - 1 END;
+IF x > 13404 THEN x := x - 1 END;
+IF x > 13405 THEN x := x - 1 END;
+IF x > 13406 THEN x := x - 1 END;
+IF x > 13407 THEN x := x - 1 END;
+IF x > 13408 THEN x := x - 1 END;
+IF x > 13409 THEN x := x - 1 END;
+IF x > 13410 THEN x := x - 1 END;
+IF x > 13411 THEN x := x - 1 END;
+IF x > 13412 THEN x := x - 1 END;
+IF x > 13413 THEN x := x - 1 END;
+IF x > 13414 THEN x := x - 1 END;
+IF x > 13415 THEN x := x - 1 END;
+IF x > 13416 THEN x := x - 1 END;
+IF x > 13417 THEN x := x - 1 END;
+IF x > 13418 THEN x := x - 1 END;
+IF x > 13419 THEN x := x - 1 END;
+IF x > 13420 THEN x := x - 1 END;
+IF x > 13421 THEN x := x - 1 END;
+IF x > 13422 THEN x := x - 1 END;
+IF x > 13423 THEN x := x - 1 END;
+IF x > 13424 THEN x := x - 1 END;
+IF x > 13425 THEN x := x - 1 END;
+IF x > 13426 THEN x := x - 1 END;
+IF x > 13427 THEN x := x - 1 END;
+IF x > 13428 THEN x := x - 1 END;
+IF x > 13429 THEN x := x - 1 END;
+IF x > 13430 THEN x := x - 1 END;
+IF x > 13431 THEN x := x - 1 END;
+IF x > 13432 THEN x := x - 1 END;
+IF x > 13433 THEN x := x - 1 END;
+IF x > 13434 THEN x := x - 1 END;
+IF x > 13435 THEN x := x - 1 END;
+IF x > 13436 THEN x := x - 1 END;
+IF x > 13437 THEN x := x - 1 END;
+IF x > 13438 THEN x := x - 1 END;
+IF x > 13439 THEN x := x - 1 END;
+IF x > 13440 THEN x := x - 1 END;
+IF x > 13441 THEN x := x - 1 END;
+IF x > 13442 THEN x := x - 1 END;
+IF x > 13443 THEN x := x - 1 END;
+IF x > 13444 THEN x := x - 1 END;
+IF x > 13445 THEN x := x - 1 END;
+IF x > 13446 THEN x := x - 1 END;
+IF x > 13447 THEN x := x - 1 END;
+IF x > 13448 THEN x := x - 1 END;
+IF x > 13449 THEN x := x - 1 END;
+IF x > 13450 THEN x := x - 1 END;
+IF x > 13451 THEN x := x - 1 END;
+IF x > 13452 THEN x := x - 1 END;
+IF x > 13453 THEN x := x - 1 END;
+IF x > 13454 THEN x := x - 1 END;
+IF x > 13455 THEN x := x - 1 END;
+IF x > 13456 THEN x := x - 1 END;
+IF x > 13457 THEN x := x - 1 END;
+IF x > 13458 THEN x := x - 1 END;
+IF x > 13459 THEN x := x - 1 END;
+IF x > 13460 THEN x := x - 1 END;
+IF x > 13461 THEN x := x - 1 END;
+IF x > 13462 THEN x := x - 1 END;
+IF x > 13463 THEN x := x - 1 END;
+IF x > 13464 THEN x := x - 1 END;
+IF x > 13465 THEN x := x - 1 END;
+IF x > 13466 THEN x := x - 1 END;
+IF x > 13467 THEN x := x - 1 END;
+IF x > 13468 THEN x := x - 1 END;
+IF x > 13469 THEN x := x - 1 END;
+IF x > 13470 THEN x := x - 1 END;
+IF x > 13471 THEN x := x - 1 END;
+IF x > 13472 THEN x := x - 1 END;
+IF x > 13473 THEN x := x - 1 END;
+IF x > 13474 THEN x := x - 1 END;
+IF x > 13475 THEN x := x - 1 END;
+IF x > 13476 THEN x := x - 1 END;
+IF x > 13477 THEN x := x - 1 END;
+IF x > 13478 THEN x := x - 1 END;
+IF x > 13479 THEN x := x - 1 END;
+IF x > 13480 THEN x := x - 1 END;
+IF x > 13481 THEN x := x - 1 END;
+IF x > 13482 THEN x := x - 1 END;
+IF x > 13483 THEN x := x - 1 END;
+IF x > 13484 THEN x := x - 1 END;
+IF x > 13485 THEN x := x - 1 END;
+IF x > 13486 THEN x := x - 1 END;
+IF x > 13487 THEN x := x - 1 END;
+IF x > 13488 THEN x := x - 1 END;
+IF x > 13489 THEN x := x - 1 END;
+IF x > 13490 THEN x := x - 1 END;
+IF x > 13491 THEN x := x - 1 END;
+IF x > 13492 THEN x := x - 1 END;
+IF x > 13493 THEN x := x - 1 END;
+IF x > 13494 THEN x := x - 1 END;
+IF x > 13495 THEN x := x - 1 END;
+IF x > 13496 THEN x := x - 1 END;
+IF x > 13497 THEN x := x - 1 END;
+IF x > 13498 THEN x := x - 1 END;
+IF x > 13499 THEN x := x - 1 END;
+IF x > 13500 THEN x := x - 1 END;
+IF x > 13501 THEN x := x - 1 END;
+IF x > 13502 THEN x := x - 1 END;
+IF x > 13503 THEN x := x - 1 END;
+IF x > 13504 THEN x := x - 1 END;
+IF x > 13505 THEN x := x - 1 END;
+IF x > 13506 THEN x := x - 1 END;
+IF x > 13507 THEN x := x - 1 END;
+IF x > 13508 THEN x := x - 1 END;
+IF x > 13509 THEN x := x - 1 END;
+IF x > 13510 THEN x := x - 1 END;
+IF x > 13511 THEN x := x - 1 END;
+IF x > 13512 THEN x := x - 1 END;
+IF x > 13513 THEN x := x - 1 END;
+IF x > 13514 THEN x := x - 1 END;
+IF x > 13515 THEN x := x - 1 END;
+IF x > 13516 THEN x := x - 1 END;
+IF x > 13517 THEN x := x - 1 END;
+IF x > 13518 THEN x := x - 1 END;
+IF x > 13519 THEN x := x - 1 END;
+IF x > 13520 THEN x := x - 1 END;
+IF x > 13521 THEN x := x - 1 END;
+IF x > 13522 THEN x := x - 1 END;
+IF x > 13523 THEN x := x - 1 END;
+IF x > 13524 THEN x := x - 1 END;
+IF x > 13525 THEN x := x - 1 END;
+IF x > 13526 THEN x := x - 1 END;
+IF x > 13527 THEN x := x - 1 END;
+IF x > 13528 THEN x := x - 1 END;
+IF x > 13529 THEN x := x - 1 END;
+IF x > 13530 THEN x := x - 1 END;
+IF x > 13531 THEN x := x - 1 END;
+IF x > 13532 THEN x := x - 1 END;
+IF x > 13533 THEN x := x - 1 END;
+IF x > 13534 THEN x := x - 1 END;
+IF x > 13535 THEN x := x - 1 END;
+IF x > 13536 THEN x := x - 1 END;
+IF x > 13537 THEN x := x - 1 END;
+IF x > 13538 THEN x := x - 1 END;
+IF x > 13539 THEN x := x - 1 END;
+IF x > 13540 THEN x := x - 1 END;
+IF x > 13541 THEN x := x - 1 END;
+IF x > 13542 THEN x := x - 1 END;
+IF x > 13543 THEN x := x - 1 END;
+IF x > 13544 THEN x := x - 1 END;
+IF x > 13545 THEN x := x - 1 END;
+IF x > 13546 THEN x := x - 1 END;
+IF x > 13547 THEN x := x - 1 END;
+IF x > 13548 THEN x := x - 1 END;
+IF x > 13549 THEN x := x - 1 END;
+IF x > 13550 THEN x := x - 1 END;
+IF x > 13551 THEN x := x - 1 END;
+IF x > 13552 THEN x := x - 1 END;
+IF x > 13553 THEN x := x - 1 END;
+IF x > 13554 THEN x := x - 1 END;
+IF x > 13555 THEN x := x - 1 END;
+IF x > 13556 THEN x := x - 1 END;
+IF x > 13557 THEN x := x - 1 END;
+IF x > 13558 THEN x := x - 1 END;
+IF x > 13559 THEN x := x - 1 END;
+IF x > 13560 THEN x := x - 1 END;
+IF x > 13561 THEN x := x - 1 END;
+IF x > 13562 THEN x := x - 1 END;
+IF x > 13563 THEN x := x - 1 END;
+IF x > 13564 THEN x := x - 1 END;
+IF x > 13565 THEN x := x - 1 END;
+IF x > 13566 THEN x := x - 1 END;
+IF x > 13567 THEN x := x - 1 END;
+IF x > 13568 THEN x := x - 1 END;
+IF x > 13569 THEN x := x - 1 END;
+IF x > 13570 THEN x := x - 1 END;
+IF x > 13571 THEN x := x - 1 END;
+IF x > 13572 THEN x := x - 1 END;
+IF x > 13573 THEN x := x - 1 END;
+IF x > 13574 THEN x := x - 1 END;
+IF x > 13575 THEN x := x - 1 END;
+IF x > 13576 THEN x := x - 1 END;
+IF x > 13577 THEN x := x - 1 END;
+IF x > 13578 THEN x := x - 1 END;
+IF x > 13579 THEN x := x - 1 END;
+IF x > 13580 THEN x := x - 1 END;
+IF x > 13581 THEN x := x - 1 END;
+IF x > 13582 THEN x := x - 1 END;
+IF x > 13583 THEN x := x - 1 END;
+IF x > 13584 THEN x := x - 1 END;
+IF x > 13585 THEN x := x - 1 END;
+IF x > 13586 THEN x := x - 1 END;
+IF x > 13587 THEN x := x - 1 END;
+IF x > 13588 THEN x := x - 1 END;
+IF x > 13589 THEN x := x - 1 END;
+IF x > 13590 THEN x := x - 1 END;
+IF x > 13591 THEN x := x - 1 END;
+IF x > 13592 THEN x := x - 1 END;
+IF x > 13593 THEN x := x - 1 END;
+IF x > 13594 THEN x := x - 1 END;
+IF x > 13595 THEN x := x - 1 END;
+IF x > 13596 THEN x := x - 1 END;
+IF x > 13597 THEN x := x - 1 END;
+IF x > 13598 THEN x := x - 1 END;
+IF x > 13599 THEN x := x - 1 END;
+IF x > 13600 THEN x := x - 1 END;
+IF x > 13601 THEN x := x - 1 END;
+IF x > 13602 THEN x := x - 1 END;
+IF x > 13603 THEN x := x - 1 END;
+IF x > 13604 THEN x := x - 1 END;
+IF x > 13605 THEN x := x - 1 END;
+IF x > 13606 THEN x := x - 1 END;
+IF x > 13607 THEN x := x - 1 END;
+IF x > 13608 THEN x := x - 1 END;
+IF x > 13609 THEN x := x - 1 END;
+IF x > 13610 THEN x := x - 1 END;
+IF x > 13611 THEN x := x - 1 END;
+IF x > 13612 THEN x := x - 1 END;
+IF x > 13613 THEN x := x - 1 END;
+IF x > 13614 THEN x := x - 1 END;
+IF x > 13615 THEN x := x - 1 END;
+IF x > 13616 THEN x := x - 1 END;
+IF x > 13617 THEN x := x - 1 END;
+IF x > 13618 THEN x := x - 1 END;
+IF x > 13619 THEN x := x - 1 END;
+IF x > 13620 THEN x := x - 1 END;
+IF x > 13621 THEN x := x - 1 END;
+IF x > 13622 THEN x := x - 1 END;
+IF x > 13623 THEN x := x - 1 END;
+IF x > 13624 THEN x := x - 1 END;
+IF x > 13625 THEN x := x - 1 END;
+IF x > 13626 THEN x := x - 1 END;
+IF x > 13627 THEN x := x - 1 END;
+IF x > 13628 THEN x := x - 1 END;
+IF x > 13629 THEN x := x - 1 END;
+IF x > 13630 THEN x := x - 1 END;
+IF x > 13631 THEN x := x - 1 END;
+IF x > 13632 THEN x := x - 1 END;
+IF x > 13633 THEN x := x - 1 END;
+IF x > 13634 THEN x := x - 1 END;
+IF x > 13635 THEN x := x - 1 END;
+IF x > 13636 THEN x := x - 1 END;
+IF x > 13637 THEN x := x - 1 END;
+IF x > 13638 THEN x := x - 1 END;
+IF x > 13639 THEN x := x - 1 END;
+IF x > 13640 THEN x := x - 1 END;
+IF x > 13641 THEN x := x - 1 END;
+IF x > 13642 THEN x := x - 1 END;
+IF x > 13643 THEN x := x - 1 END;
+IF x > 13644 THEN x := x - 1 END;
+IF x > 13645 THEN x := x - 1 END;
+IF x > 13646 THEN x := x - 1 END;
+IF x > 13647 THEN x := x - 1 END;
+IF x > 13648 THEN x := x - 1 END;
+IF x > 13649 THEN x := x - 1 END;
+IF x > 13650 THEN x := x - 1 END;
+IF x > 13651 THEN x := x - 1 END;
+IF x > 13652 THEN x := x - 1 END;
+IF x > 13653 THEN x := x - 1 END;
+IF x > 13654 THEN x := x - 1 END;
+IF x > 13655 THEN x := x - 1 END;
+IF x > 13656 THEN x := x - 1 END;
+IF x > 13657 THEN x := x - 1 END;
+IF x > 13658 THEN x := x - 1 END;
+IF x > 13659 THEN x := x - 1 END;
+IF x > 13660 THEN x := x - 1 END;
+IF x > 13661 THEN x := x - 1 END;
+IF x > 13662 THEN x := x - 1 END;
+IF x > 13663 THEN x := x - 1 END;
+IF x > 13664 THEN x := x - 1 END;
+IF x > 13665 THEN x := x - 1 END;
+IF x > 13666 THEN x := x - 1 END;
+IF x > 13667 THEN x := x - 1 END;
+IF x > 13668 THEN x := x - 1 END;
+IF x > 13669 THEN x := x - 1 END;
+IF x > 13670 THEN x := x - 1 END;
+IF x > 13671 THEN x := x - 1 END;
+IF x > 13672 THEN x := x - 1 END;
+IF x > 13673 THEN x := x - 1 END;
+IF x > 13674 THEN x := x - 1 END;
+IF x > 13675 THEN x := x - 1 END;
+IF x > 13676 THEN x := x - 1 END;
+IF x > 13677 THEN x := x - 1 END;
+IF x > 13678 THEN x := x - 1 END;
+IF x > 13679 THEN x := x - 1 END;
+IF x > 13680 THEN x := x - 1 END;
+IF x > 13681 THEN x := x - 1 END;
+IF x > 13682 THEN x := x - 1 END;
+IF x > 13683 THEN x := x - 1 END;
+IF x > 13684 THEN x := x - 1 END;
+IF x > 13685 THEN x := x - 1 END;
+IF x > 13686 THEN x := x - 1 END;
+IF x > 13687 THEN x := x - 1 END;
+IF x > 13688 THEN x := x - 1 END;
+IF x > 13689 THEN x := x - 1 END;
+IF x > 13690 THEN x := x - 1 END;
+IF x > 13691 THEN x := x - 1 END;
+IF x > 13692 THEN x := x - 1 END;
+IF x > 13693 THEN x := x - 1 END;
+IF x > 13694 THEN x := x - 1 END;
+IF x > 13695 THEN x := x - 1 END;
+IF x > 13696 THEN x := x - 1 END;
+IF x > 13697 THEN x := x - 1 END;
+IF x > 13698 THEN x := x - 1 END;
+IF x > 13699 THEN x := x - 1 END;
+IF x > 13700 THEN x := x - 1 END;
+IF x > 13701 THEN x := x - 1 END;
+IF x > 13702 THEN x := x - 1 END;
+IF x > 13703 THEN x := x - 1 END;
+IF x > 13704 THEN x := x - 1 END;
+IF x > 13705 THEN x := x - 1 END;
+IF x > 13706 THEN x := x - 1 END;
+IF x > 13707 THEN x := x - 1 END;
+IF x > 13708 THEN x := x - 1 END;
+IF x > 13709 THEN x := x - 1 END;
+IF x > 13710 THEN x := x - 1 END;
+IF x > 13711 THEN x := x - 1 END;
+IF x > 13712 THEN x := x - 1 END;
+IF x > 13713 THEN x := x - 1 END;
+IF x > 13714 THEN x := x - 1 END;
+IF x > 13715 THEN x := x - 1 END;
+IF x > 13716 THEN x := x - 1 END;
+IF x > 13717 THEN x := x - 1 END;
+IF x > 13718 THEN x := x - 1 END;
+IF x > 13719 THEN x := x - 1 END;
+IF x > 13720 THEN x := x - 1 END;
+IF x > 13721 THEN x := x - 1 END;
+IF x > 13722 THEN x := x - 1 END;
+IF x > 13723 THEN x := x - 1 END;
+IF x > 13724 THEN x := x - 1 END;
+IF x > 13725 THEN x := x - 1 END;
+IF x > 13726 THEN x := x - 1 END;
+IF x > 13727 THEN x := x - 1 END;
+IF x > 13728 THEN x := x - 1 END;
+IF x > 13729 THEN x := x - 1 END;
+IF x > 13730 THEN x := x - 1 END;
+IF x > 13731 THEN x := x - 1 END;
+IF x > 13732 THEN x := x - 1 END;
+IF x > 13733 THEN x := x - 1 END;
+IF x > 13734 THEN x := x - 1 END;
+IF x > 13735 THEN x := x - 1 END;
+IF x > 13736 THEN x := x - 1 END;
+IF x > 13737 THEN x := x - 1 END;
+IF x > 13738 THEN x := x - 1 END;
+IF x > 13739 THEN x := x - 1 END;
+IF x > 13740 THEN x := x - 1 END;
+IF x > 13741 THEN x := x - 1 END;
+IF x > 13742 THEN x := x - 1 END;
+IF x > 13743 THEN x := x - 1 END;
+IF x > 13744 THEN x := x - 1 END;
+IF x > 13745 THEN x := x - 1 END;
+IF x > 13746 THEN x := x - 1 END;
+IF x > 13747 THEN x := x - 1 END;
+IF x > 13748 THEN x := x - 1 END;
+IF x > 13749 THEN x := x - 1 END;
+IF x > 13750 THEN x := x - 1 END;
+IF x > 13751 THEN x := x - 1 END;
+IF x > 13752 THEN x := x - 1 END;
+IF x > 13753 THEN x := x - 1 END;
+IF x > 13754 THEN x := x - 1 END;
+IF x > 13755 THEN x := x - 1 END;
+IF x > 13756 THEN x := x - 1 END;
+IF x > 13757 THEN x := x - 1 END;
+IF x > 13758 THEN x := x - 1 END;
+IF x > 13759 THEN x := x - 1 END;
+IF x > 13760 THEN x := x - 1 END;
+IF x > 13761 THEN x := x - 1 END;
+IF x > 13762 THEN x := x - 1 END;
+IF x > 13763 THEN x := x - 1 END;
+IF x > 13764 THEN x := x - 1 END;
+IF x > 13765 THEN x := x - 1 END;
+IF x > 13766 THEN x := x - 1 END;
+IF x > 13767 THEN x := x - 1 END;
+IF x > 13768 THEN x := x - 1 END;
+IF x > 13769 THEN x := x - 1 END;
+IF x > 13770 THEN x := x - 1 END;
+IF x > 13771 THEN x := x - 1 END;
+IF x > 13772 THEN x := x - 1 END;
+IF x > 13773 THEN x := x - 1 END;
+IF x > 13774 THEN x := x - 1 END;
+IF x > 13775 THEN x := x - 1 END;
+IF x > 13776 THEN x := x - 1 END;
+IF x > 13777 THEN x := x - 1 END;
+IF x > 13778 THEN x := x - 1 END;
+IF x > 13779 THEN x := x - 1 END;
+IF x > 13780 THEN x := x - 1 END;
+IF x > 13781 THEN x := x - 1 END;
+IF x > 13782 THEN x := x - 1 END;
+IF x > 13783 THEN x := x - 1 END;
+IF x > 13784 THEN x := x - 1 END;
+IF x > 13785 THEN x := x - 1 END;
+IF x > 13786 THEN x := x - 1 END;
+IF x > 13787 THEN x := x - 1 END;
+IF x > 13788 THEN x := x - 1 END;
+IF x > 13789 THEN x := x - 1 END;
+IF x > 13790 THEN x := x - 1 END;
+IF x > 13791 THEN x := x - 1 END;
+IF x > 13792 THEN x := x - 1 END;
+IF x > 13793 THEN x := x - 1 END;
+IF x > 13794 THEN x := x - 1 END;
+IF x > 13795 THEN x := x - 1 END;
+IF x > 13796 THEN x := x - 1 END;
+IF x > 13797 THEN x := x - 1 END;
+IF x > 13798 THEN x := x - 1 END;
+IF x > 13799 THEN x := x - 1 END;
+IF x > 13800 THEN x := x - 1 END;
+IF x > 13801 THEN x := x - 1 END;
+IF x > 13802 THEN x := x - 1 END;
+IF x > 13803 THEN x := x - 1 END;
+IF x > 13804 THEN x := x - 1 END;
+IF x > 13805 THEN x := x - 1 END;
+IF x > 13806 THEN x := x - 1 END;
+IF x > 13807 THEN x := x - 1 END;
+IF x > 13808 THEN x := x - 1 END;
+IF x > 13809 THEN x := x - 1 END;
+IF x > 13810 THEN x := x - 1 END;
+IF x > 13811 THEN x := x - 1 END;
+IF x > 13812 THEN x := x - 1 END;
+IF x > 13813 THEN x := x - 1 END;
+IF x > 13814 THEN x := x - 1 END;
+IF x > 13815 THEN x := x - 1 END;
+IF x > 13816 THEN x := x - 1 END;
+IF x > 13817 THEN x := x - 1 END;
+IF x > 13818 THEN x := x - 1 END;
+IF x > 13819 THEN x := x - 1 END;
+IF x > 13820 THEN x := x - 1 END;
+IF x > 13821 THEN x := x - 1 END;
+IF x > 13822 THEN x := x - 1 END;
+IF x > 13823 THEN x := x - 1 END;
+IF x > 13824 THEN x := x - 1 END;
+IF x > 13825 THEN x := x - 1 END;
+IF x > 13826 THEN x := x - 1 END;
+IF x > 13827 THEN x := x - 1 END;
+IF x > 13828 THEN x := x - 1 END;
+IF x > 13829 THEN x := x - 1 END;
+IF x > 13830 THEN x := x - 1 END;
+IF x > 13831 THEN x := x - 1 END;
+IF x > 13832 THEN x := x - 1 END;
+IF x > 13833 THEN x := x - 1 END;
+IF x > 13834 THEN x := x - 1 END;
+IF x > 13835 THEN x := x - 1 END;
+IF x > 13836 THEN x := x - 1 END;
+IF x > 13837 THEN x := x - 1 END;
+IF x > 13838 THEN x := x - 1 END;
+IF x > 13839 THEN x := x - 1 END;
+IF x > 13840 THEN x := x - 1 END;
+IF x > 13841 THEN x := x - 1 END;
+IF x > 13842 THEN x := x - 1 END;
+IF x > 13843 THEN x := x - 1 END;
+IF x > 13844 THEN x := x - 1 END;
+IF x > 13845 THEN x := x - 1 END;
+IF x > 13846 THEN x := x - 1 END;
+IF x > 13847 THEN x := x - 1 END;
+IF x > 13848 THEN x := x - 1 END;
+IF x > 13849 THEN x := x - 1 END;
+IF x > 13850 THEN x := x - 1 END;
+IF x > 13851 THEN x := x - 1 END;
+IF x > 13852 THEN x := x - 1 END;
+IF x > 13853 THEN x := x - 1 END;
+IF x > 13854 THEN x := x - 1 END;
+IF x > 13855 THEN x := x - 1 END;
+IF x > 13856 THEN x := x - 1 END;
+IF x > 13857 THEN x := x - 1 END;
+IF x > 13858 THEN x := x - 1 END;
+IF x > 13859 THEN x := x - 1 END;
+IF x > 13860 THEN x := x - 1 END;
+IF x > 13861 THEN x := x - 1 END;
+IF x > 13862 THEN x := x - 1 END;
+IF x > 13863 THEN x := x - 1 END;
+IF x > 13864 THEN x := x - 1 END;
+IF x > 13865 THEN x := x - 1 END;
+IF x > 13866 THEN x := x - 1 END;
+IF x > 13867 THEN x := x - 1 END;
+IF x > 13868 THEN x := x - 1 END;
+IF x > 13869 THEN x := x - 1 END;
+IF x > 13870 THEN x := x - 1 END;
+IF x > 13871 THEN x := x - 1 END;
+IF x > 13872 THEN x := x - 1 END;
+IF x > 13873 THEN x := x - 1 END;
+IF x > 13874 THEN x := x - 1 END;
+IF x > 13875 THEN x := x - 1 END;
+IF x > 13876 THEN x := x - 1 END;
+IF x > 13877 THEN x := x - 1 END;
+IF x > 13878 THEN x := x - 1 END;
+IF x > 13879 THEN x := x - 1 END;
+IF x > 13880 THEN x := x - 1 END;
+IF x > 13881 THEN x := x - 1 END;
+IF x > 13882 THEN x := x - 1 END;
+IF x > 13883 THEN x := x - 1 END;
+IF x > 13884 THEN x := x - 1 END;
+IF x > 13885 THEN x := x - 1 END;
+IF x > 13886 THEN x := x - 1 END;
+IF x > 13887 THEN x := x - 1 END;
+IF x > 13888 THEN x := x - 1 END;
+IF x > 13889 THEN x := x - 1 END;
+IF x > 13890 THEN x := x - 1 END;
+IF x > 13891 THEN x := x - 1 END;
+IF x > 13892 THEN x := x - 1 END;
+IF x > 13893 THEN x := x - 1 END;
+IF x > 13894 THEN x := x - 1 END;
+IF x > 13895 THEN x := x - 1 END;
+IF x > 13896 THEN x := x - 1 END;
+IF x > 13897 THEN x := x - 1 END;
+IF x > 13898 THEN x := x - 1 END;
+IF x > 13899 THEN x := x - 1 END;
+IF x > 13900 THEN x := x - 1 END;
+IF x > 13901 THEN x := x - 1 END;
+IF x > 13902 THEN x := x - 1 END;
+IF x > 13903 THEN x := x - 1 END;
+IF x > 13904 THEN x := x - 1 END;
+IF x > 13905 THEN x := x - 1 END;
+IF x > 13906 THEN x := x - 1 END;
+IF x > 13907 THEN x := x - 1 END;
+IF x > 13908 THEN x := x - 1 END;
+IF x > 13909 THEN x := x - 1 END;
+IF x > 13910 THEN x := x - 1 END;
+IF x > 13911 THEN x := x - 1 END;
+IF x > 13912 THEN x := x - 1 END;
+IF x > 13913 THEN x := x - 1 END;
+IF x > 13914 THEN x := x - 1 END;
+IF x > 13915 THEN x := x - 1 END;
+IF x > 13916 THEN x := x - 1 END;
+IF x > 13917 THEN x := x - 1 END;
+IF x > 13918 THEN x := x - 1 END;
+IF x > 13919 THEN x := x - 1 END;
+IF x > 13920 THEN x := x - 1 END;
+IF x > 13921 THEN x := x - 1 END;
+IF x > 13922 THEN x := x - 1 END;
+IF x > 13923 THEN x := x - 1 END;
+IF x > 13924 THEN x := x - 1 END;
+IF x > 13925 THEN x := x - 1 END;
+IF x > 13926 THEN x := x - 1 END;
+IF x > 13927 THEN x := x - 1 END;
+IF x > 13928 THEN x := x - 1 END;
+IF x > 13929 THEN x := x - 1 END;
+IF x > 13930 THEN x := x - 1 END;
+IF x > 13931 THEN x := x - 1 END;
+IF x > 13932 THEN x := x - 1 END;
+IF x > 13933 THEN x := x - 1 END;
+IF x > 13934 THEN x := x - 1 END;
+IF x > 13935 THEN x := x - 1 END;
+IF x > 13936 THEN x := x - 1 END;
+IF x > 13937 THEN x := x - 1 END;
+IF x > 13938 THEN x := x - 1 END;
+IF x > 13939 THEN x := x - 1 END;
+IF x > 13940 THEN x := x - 1 END;
+IF x > 13941 THEN x := x - 1 END;
+IF x > 13942 THEN x := x - 1 END;
+IF x > 13943 THEN x := x - 1 END;
+IF x > 13944 THEN x := x - 1 END;
+IF x > 13945 THEN x := x - 1 END;
+IF x > 13946 THEN x := x - 1 END;
+IF x > 13947 THEN x := x - 1 END;
+IF x > 13948 THEN x := x - 1 END;
+IF x > 13949 THEN x := x - 1 END;
+IF x > 13950 THEN x := x - 1 END;
+IF x > 13951 THEN x := x - 1 END;
+IF x > 13952 THEN x := x - 1 END;
+IF x > 13953 THEN x := x - 1 END;
+IF x > 13954 THEN x := x - 1 END;
+IF x > 13955 THEN x := x - 1 END;
+IF x > 13956 THEN x := x - 1 END;
+IF x > 13957 THEN x := x - 1 END;
+IF x > 13958 THEN x := x - 1 END;
+IF x > 13959 THEN x := x - 1 END;
+IF x > 13960 THEN x := x - 1 END;
+IF x > 13961 THEN x := x - 1 END;
+IF x > 13962 THEN x := x - 1 END;
+IF x > 13963 THEN x := x - 1 END;
+IF x > 13964 THEN x := x - 1 END;
+IF x > 13965 THEN x := x - 1 END;
+IF x > 13966 THEN x := x - 1 END;
+IF x > 13967 THEN x := x - 1 END;
+IF x > 13968 THEN x := x - 1 END;
+IF x > 13969 THEN x := x - 1 END;
+IF x > 13970 THEN x := x - 1 END;
+IF x > 13971 THEN x := x - 1 END;
+IF x > 13972 THEN x := x - 1 END;
+IF x > 13973 THEN x := x - 1 END;
+IF x > 13974 THEN x := x - 1 END;
+IF x > 13975 THEN x := x - 1 END;
+IF x > 13976 THEN x := x - 1 END;
+IF x > 13977 THEN x := x - 1 END;
+IF x > 13978 THEN x := x - 1 END;
+IF x > 13979 THEN x := x - 1 END;
+IF x > 13980 THEN x := x - 1 END;
+IF x > 13981 THEN x := x - 1 END;
+IF x > 13982 THEN x := x - 1 END;
+IF x > 13983 THEN x := x - 1 END;
+IF x > 13984 THEN x := x - 1 END;
+IF x > 13985 THEN x := x - 1 END;
+IF x > 13986 THEN x := x - 1 END;
+IF x > 13987 THEN x := x - 1 END;
+IF x > 13988 THEN x := x - 1 END;
+IF x > 13989 THEN x := x - 1 END;
+IF x > 13990 THEN x := x - 1 END;
+IF x > 13991 THEN x := x - 1 END;
+IF x > 13992 THEN x := x - 1 END;
+IF x > 13993 THEN x := x - 1 END;
+IF x > 13994 THEN x := x - 1 END;
+IF x > 13995 THEN x := x - 1 END;
+IF x > 13996 THEN x := x - 1 END;
+IF x > 13997 THEN x := x - 1 END;
+IF x > 13998 THEN x := x - 1 END;
+IF x > 13999 THEN x := x - 1 END;
+IF x > 14000 THEN x := x - 1 END;
+IF x > 14001 THEN x := x - 1 END;
+IF x > 14002 THEN x := x - 1 END;
+IF x > 14003 THEN x := x - 1 END;
+IF x > 14004 THEN x := x - 1 END;
+IF x > 14005 THEN x := x - 1 END;
+IF x > 14006 THEN x := x - 1 END;
+IF x > 14007 THEN x := x - 1 END;
+IF x > 14008 THEN x := x - 1 END;
+IF x > 14009 THEN x := x - 1 END;
+IF x > 14010 THEN x := x - 1 END;
+IF x > 14011 THEN x := x - 1 END;
+IF x > 14012 THEN x := x - 1 END;
+IF x > 14013 THEN x := x - 1 END;
+IF x > 14014 THEN x := x - 1 END;
+IF x > 14015 THEN x := x - 1 END;
+IF x > 14016 THEN x := x - 1 END;
+IF x > 14017 THEN x := x - 1 END;
+IF x > 14018 THEN x := x - 1 END;
+IF x > 14019 THEN x := x - 1 END;
+IF x > 14020 THEN x := x - 1 END;
+IF x > 14021 THEN x := x - 1 END;
+IF x > 14022 THEN x := x - 1 END;
+IF x > 14023 THEN x := x - 1 END;
+IF x > 14024 THEN x := x - 1 END;
+IF x > 14025 THEN x := x - 1 END;
+IF x > 14026 THEN x := x - 1 END;
+IF x > 14027 THEN x := x - 1 END;
+IF x > 14028 THEN x := x - 1 END;
+IF x > 14029 THEN x := x - 1 END;
+IF x > 14030 THEN x := x - 1 END;
+IF x > 14031 THEN x := x - 1 END;
+IF x > 14032 THEN x := x - 1 END;
+IF x > 14033 THEN x := x - 1 END;
+IF x > 14034 THEN x := x - 1 END;
+IF x > 14035 THEN x := x - 1 END;
+IF x > 14036 THEN x := x - 1 END;
+IF x > 14037 THEN x := x - 1 END;
+IF x > 14038 THEN x := x - 1 END;
+IF x > 14039 THEN x := x - 1 END;
+IF x > 14040 THEN x := x - 1 END;
+IF x > 14041 THEN x := x - 1 END;
+IF x > 14042 THEN x := x - 1 END;
+IF x > 14043 THEN x := x - 1 END;
+IF x > 14044 THEN x := x - 1 END;
+IF x > 14045 THEN x := x - 1 END;
+IF x > 14046 THEN x := x - 1 END;
+IF x > 14047 THEN x := x - 1 END;
+IF x > 14048 THEN x := x - 1 END;
+IF x > 14049 THEN x := x - 1 END;
+IF x > 14050 THEN x := x - 1 END;
+IF x > 14051 THEN x := x - 1 END;
+IF x > 14052 THEN x := x - 1 END;
+IF x > 14053 THEN x := x - 1 END;
+IF x > 14054 THEN x := x - 1 END;
+IF x > 14055 THEN x := x - 1 END;
+IF x > 14056 THEN x := x - 1 END;
+IF x > 14057 THEN x := x - 1 END;
+IF x > 14058 THEN x := x - 1 END;
+IF x > 14059 THEN x := x - 1 END;
+IF x > 14060 THEN x := x - 1 END;
+IF x > 14061 THEN x := x - 1 END;
+IF x > 14062 THEN x := x - 1 END;
+IF x > 14063 THEN x := x - 1 END;
+IF x > 14064 THEN x := x - 1 END;
+IF x > 14065 THEN x := x - 1 END;
+IF x > 14066 THEN x := x - 1 END;
+IF x > 14067 THEN x := x - 1 END;
+IF x > 14068 THEN x := x - 1 END;
+IF x > 14069 THEN x := x - 1 END;
+IF x > 14070 THEN x := x - 1 END;
+IF x > 14071 THEN x := x - 1 END;
+IF x > 14072 THEN x := x - 1 END;
+IF x > 14073 THEN x := x - 1 END;
+IF x > 14074 THEN x := x - 1 END;
+IF x > 14075 THEN x := x - 1 END;
+IF x > 14076 THEN x := x - 1 END;
+IF x > 14077 THEN x := x - 1 END;
+IF x > 14078 THEN x := x - 1 END;
+IF x > 14079 THEN x := x - 1 END;
+IF x > 14080 THEN x := x - 1 END;
+IF x > 14081 THEN x := x - 1 END;
+IF x > 14082 THEN x := x - 1 END;
+IF x > 14083 THEN x := x - 1 END;
+IF x > 14084 THEN x := x - 1 END;
+IF x > 14085 THEN x := x - 1 END;
+IF x > 14086 THEN x := x - 1 END;
+IF x > 14087 THEN x := x - 1 END;
+IF x > 14088 THEN x := x - 1 END;
+IF x > 14089 THEN x := x - 1 END;
+IF x > 14090 THEN x := x - 1 END;
+IF x > 14091 THEN x := x - 1 END;
+IF x > 14092 THEN x := x - 1 END;
+IF x > 14093 THEN x := x - 1 END;
+IF x > 14094 THEN x := x - 1 END;
+IF x > 14095 THEN x := x - 1 END;
+IF x > 14096 THEN x := x - 1 END;
+IF x > 14097 THEN x := x - 1 END;
+IF x > 14098 THEN x := x - 1 END;
+IF x > 14099 THEN x := x - 1 END;
+IF x > 14100 THEN x := x - 1 END;
+IF x > 14101 THEN x := x - 1 END;
+IF x > 14102 THEN x := x - 1 END;
+IF x > 14103 THEN x := x - 1 END;
+IF x > 14104 THEN x := x - 1 END;
+IF x > 14105 THEN x := x - 1 END;
+IF x > 14106 THEN x := x - 1 END;
+IF x > 14107 THEN x := x - 1 END;
+IF x > 14108 THEN x := x - 1 END;
+IF x > 14109 THEN x := x - 1 END;
+IF x > 14110 THEN x := x - 1 END;
+IF x > 14111 THEN x := x - 1 END;
+IF x > 14112 THEN x := x - 1 END;
+IF x > 14113 THEN x := x - 1 END;
+IF x > 14114 THEN x := x - 1 END;
+IF x > 14115 THEN x := x - 1 END;
+IF x > 14116 THEN x := x - 1 END;
+IF x > 14117 THEN x := x - 1 END;
+IF x > 14118 THEN x := x - 1 END;
+IF x > 14119 THEN x := x - 1 END;
+IF x > 14120 THEN x := x - 1 END;
+IF x > 14121 THEN x := x - 1 END;
+IF x > 14122 THEN x := x - 1 END;
+IF x > 14123 THEN x := x - 1 END;
+IF x > 14124 THEN x := x - 1 END;
+IF x > 14125 THEN x := x - 1 END;
+IF x > 14126 THEN x := x - 1 END;
+IF x > 14127 THEN x := x - 1 END;
+IF x > 14128 THEN x := x - 1 END;
+IF x > 14129 THEN x := x - 1 END;
+IF x > 14130 THEN x := x - 1 END;
+IF x > 14131 THEN x := x - 1 END;
+IF x > 14132 THEN x := x - 1 END;
+IF x > 14133 THEN x := x - 1 END;
+IF x > 14134 THEN x := x - 1 END;
+IF x > 14135 THEN x := x - 1 END;
+IF x > 14136 THEN x := x - 1 END;
+IF x > 14137 THEN x := x - 1 END;
+IF x > 14138 THEN x := x - 1 END;
+IF x > 14139 THEN x := x - 1 END;
+IF x > 14140 THEN x := x - 1 END;
+IF x > 14141 THEN x := x - 1 END;
+IF x > 14142 THEN x := x - 1 END;
+IF x > 14143 THEN x := x - 1 END;
+IF x > 14144 THEN x := x - 1 END;
+IF x > 14145 THEN x := x - 1 END;
+IF x > 14146 THEN x := x - 1 END;
+IF x > 14147 THEN x := x - 1 END;
+IF x > 14148 THEN x := x - 1 END;
+IF x > 14149 THEN x := x - 1 END;
+IF x > 14150 THEN x := x - 1 END;
+IF x > 14151 THEN x := x - 1 END;
+IF x > 14152 THEN x := x - 1 END;
+IF x > 14153 THEN x := x - 1 END;
+IF x > 14154 THEN x := x - 1 END;
+IF x > 14155 THEN x := x - 1 END;
+IF x > 14156 THEN x := x - 1 END;
+IF x > 14157 THEN x := x - 1 END;
+IF x > 14158 THEN x := x - 1 END;
+IF x > 14159 THEN x := x - 1 END;
+IF x > 14160 THEN x := x - 1 END;
+IF x > 14161 THEN x := x - 1 END;
+IF x > 14162 THEN x := x - 1 END;
+IF x > 14163 THEN x := x - 1 END;
+IF x > 14164 THEN x := x - 1 END;
+IF x > 14165 THEN x := x - 1 END;
+IF x > 14166 THEN x := x - 1 END;
+IF x > 14167 THEN x := x - 1 END;
+IF x > 14168 THEN x := x - 1 END;
+IF x > 14169 THEN x := x - 1 END;
+IF x > 14170 THEN x := x - 1 END;
+IF x > 14171 THEN x := x - 1 END;
+IF x > 14172 THEN x := x - 1 END;
+IF x > 14173 THEN x := x - 1 END;
+IF x > 14174 THEN x := x - 1 END;
+IF x > 14175 THEN x := x - 1 END;
+IF x > 14176 THEN x := x - 1 END;
+IF x > 14177 THEN x := x - 1 END;
+IF x > 14178 THEN x := x - 1 END;
+IF x > 14179 THEN x := x - 1 END;
+IF x > 14180 THEN x := x - 1 END;
+IF x > 14181 THEN x := x - 1 END;
+IF x > 14182 THEN x := x - 1 END;
+IF x > 14183 THEN x := x - 1 END;
+IF x > 14184 THEN x := x - 1 END;
+IF x > 14185 THEN x := x - 1 END;
+IF x > 14186 THEN x := x - 1 END;
+IF x > 14187 THEN x := x - 1 END;
+IF x > 14188 THEN x := x - 1 END;
+IF x > 14189 THEN x := x - 1 END;
+IF x > 14190 THEN x := x - 1 END;
+IF x > 14191 THEN x := x - 1 END;
+IF x > 14192 THEN x := x - 1 END;
+IF x > 14193 THEN x := x - 1 END;
+IF x > 14194 THEN x := x - 1 END;
+IF x > 14195 THEN x := x - 1 END;
+IF x > 14196 THEN x := x - 1 END;
+IF x > 14197 THEN x := x - 1 END;
+IF x > 14198 THEN x := x - 1 END;
+IF x > 14199 THEN x := x - 1 END;
+IF x > 14200 THEN x := x - 1 END;
+IF x > 14201 THEN x := x - 1 END;
+IF x > 14202 THEN x := x - 1 END;
+IF x > 14203 THEN x := x - 1 END;
+IF x > 14204 THEN x := x - 1 END;
+IF x > 14205 THEN x := x - 1 END;
+IF x > 14206 THEN x := x - 1 END;
+IF x > 14207 THEN x := x - 1 END;
+IF x > 14208 THEN x := x - 1 END;
+IF x > 14209 THEN x := x - 1 END;
+IF x > 14210 THEN x := x - 1 END;
+IF x > 14211 THEN x := x - 1 END;
+IF x > 14212 THEN x := x - 1 END;
+IF x > 14213 THEN x := x - 1 END;
+IF x > 14214 THEN x := x - 1 END;
+IF x > 14215 THEN x := x - 1 END;
+IF x > 14216 THEN x := x - 1 END;
+IF x > 14217 THEN x := x - 1 END;
+IF x > 14218 THEN x := x - 1 END;
+IF x > 14219 THEN x := x - 1 END;
+IF x > 14220 THEN x := x - 1 END;
+IF x > 14221 THEN x := x - 1 END;
+IF x > 14222 THEN x := x - 1 END;
+IF x > 14223 THEN x := x - 1 END;
+IF x > 14224 THEN x := x - 1 END;
+IF x > 14225 THEN x := x - 1 END;
+IF x > 14226 THEN x := x - 1 END;
+IF x > 14227 THEN x := x - 1 END;
+IF x > 14228 THEN x := x - 1 END;
+IF x > 14229 THEN x := x - 1 END;
+IF x > 14230 THEN x := x - 1 END;
+IF x > 14231 THEN x := x - 1 END;
+IF x > 14232 THEN x := x - 1 END;
+IF x > 14233 THEN x := x - 1 END;
+IF x > 14234 THEN x := x - 1 END;
+IF x > 14235 THEN x := x - 1 END;
+IF x > 14236 THEN x := x - 1 END;
+IF x > 14237 THEN x := x - 1 END;
+IF x > 14238 THEN x := x - 1 END;
+IF x > 14239 THEN x := x - 1 END;
+IF x > 14240 THEN x := x - 1 END;
+IF x > 14241 THEN x := x - 1 END;
+IF x > 14242 THEN x := x - 1 END;
+IF x > 14243 THEN x := x - 1 END;
+IF x > 14244 THEN x := x - 1 END;
+IF x > 14245 THEN x := x - 1 END;
+IF x > 14246 THEN x := x - 1 END;
+IF x > 14247 THEN x := x - 1 END;
+IF x > 14248 THEN x := x - 1 END;
+IF x > 14249 THEN x := x - 1 END;
+IF x > 14250 THEN x := x - 1 END;
+IF x > 14251 THEN x := x - 1 END;
+IF x > 14252 THEN x := x - 1 END;
+IF x > 14253 THEN x := x - 1 END;
+IF x > 14254 THEN x := x - 1 END;
+IF x > 14255 THEN x := x - 1 END;
+IF x > 14256 THEN x := x - 1 END;
+IF x > 14257 THEN x := x - 1 END;
+IF x > 14258 THEN x := x - 1 END;
+IF x > 14259 THEN x := x - 1 END;
+IF x > 14260 THEN x := x - 1 END;
+IF x > 14261 THEN x := x - 1 END;
+IF x > 14262 THEN x := x - 1 END;
+IF x > 14263 THEN x := x - 1 END;
+IF x > 14264 THEN x := x - 1 END;
+IF x > 14265 THEN x := x - 1 END;
+IF x > 14266 THEN x := x - 1 END;
+IF x > 14267 THEN x := x - 1 END;
+IF x > 14268 THEN x := x - 1 END;
+IF x > 14269 THEN x := x - 1 END;
+IF x > 14270 THEN x := x - 1 END;
+IF x > 14271 THEN x := x - 1 END;
+IF x > 14272 THEN x := x - 1 END;
+IF x > 14273 THEN x := x - 1 END;
+IF x > 14274 THEN x := x - 1 END;
+IF x > 14275 THEN x := x - 1 END;
+IF x > 14276 THEN x := x - 1 END;
+IF x > 14277 THEN x := x - 1 END;
+IF x > 14278 THEN x := x - 1 END;
+IF x > 14279 THEN x := x - 1 END;
+IF x > 14280 THEN x := x - 1 END;
+IF x > 14281 THEN x := x - 1 END;
+IF x > 14282 THEN x := x - 1 END;
+IF x > 14283 THEN x := x - 1 END;
+IF x > 14284 THEN x := x - 1 END;
+IF x > 14285 THEN x := x - 1 END;
+IF x > 14286 THEN x := x - 1 END;
+IF x > 14287 THEN x := x - 1 END;
+IF x > 14288 THEN x := x - 1 END;
+IF x > 14289 THEN x := x - 1 END;
+IF x > 14290 THEN x := x - 1 END;
+IF x > 14291 THEN x := x - 1 END;
+IF x > 14292 THEN x := x - 1 END;
+IF x > 14293 THEN x := x - 1 END;
+IF x > 14294 THEN x := x - 1 END;
+IF x > 14295 THEN x := x - 1 END;
+IF x > 14296 THEN x := x - 1 END;
+IF x > 14297 THEN x := x - 1 END;
+IF x > 14298 THEN x := x - 1 END;
+IF x > 14299 THEN x := x - 1 END;
+IF x > 14300 THEN x := x - 1 END;
+IF x > 14301 THEN x := x - 1 END;
+IF x > 14302 THEN x := x - 1 END;
+IF x > 14303 THEN x := x - 1 END;
+IF x > 14304 THEN x := x - 1 END;
+IF x > 14305 THEN x := x - 1 END;
+IF x > 14306 THEN x := x - 1 END;
+IF x > 14307 THEN x := x - 1 END;
+IF x > 14308 THEN x := x - 1 END;
+IF x > 14309 THEN x := x - 1 END;
+IF x > 14310 THEN x := x - 1 END;
+IF x > 14311 THEN x := x - 1 END;
+IF x > 14312 THEN x := x - 1 END;
+IF x > 14313 THEN x := x - 1 END;
+IF x > 14314 THEN x := x - 1 END;
+IF x > 14315 THEN x := x - 1 END;
+IF x > 14316 THEN x := x - 1 END;
+IF x > 14317 THEN x := x - 1 END;
+IF x > 14318 THEN x := x - 1 END;
+IF x > 14319 THEN x := x - 1 END;
+IF x > 14320 THEN x := x - 1 END;
+IF x > 14321 THEN x := x - 1 END;
+IF x > 14322 THEN x := x - 1 END;
+IF x > 14323 THEN x := x - 1 END;
+IF x > 14324 THEN x := x - 1 END;
+IF x > 14325 THEN x := x - 1 END;
+IF x > 14326 THEN x := x - 1 END;
+IF x > 14327 THEN x := x - 1 END;
+IF x > 14328 THEN x := x - 1 END;
+IF x > 14329 THEN x := x - 1 END;
+IF x > 14330 THEN x := x - 1 END;
+IF x > 14331 THEN x := x - 1 END;
+IF x > 14332 THEN x := x - 1 END;
+IF x > 14333 THEN x := x - 1 END;
+IF x > 14334 THEN x := x - 1 END;
+IF x > 14335 THEN x := x - 1 END;
+IF x > 14336 THEN x := x - 1 END;
+IF x > 14337 THEN x := x - 1 END;
+IF x > 14338 THEN x := x - 1 END;
+IF x > 14339 THEN x := x - 1 END;
+IF x > 14340 THEN x := x - 1 END;
+IF x > 14341 THEN x := x - 1 END;
+IF x > 14342 THEN x := x - 1 END;
+IF x > 14343 THEN x := x - 1 END;
+IF x > 14344 THEN x := x - 1 END;
+IF x > 14345 THEN x := x - 1 END;
+IF x > 14346 THEN x := x - 1 END;
+IF x > 14347 THEN x := x - 1 END;
+IF x > 14348 THEN x := x - 1 END;
+IF x > 14349 THEN x := x - 1 END;
+IF x > 14350 THEN x := x - 1 END;
+IF x > 14351 THEN x := x - 1 END;
+IF x > 14352 THEN x := x - 1 END;
+IF x > 14353 THEN x := x - 1 END;
+IF x > 14354 THEN x := x - 1 END;
+IF x > 14355 THEN x := x - 1 END;
+IF x > 14356 THEN x := x - 1 END;
+IF x > 14357 THEN x := x - 1 END;
+IF x > 14358 THEN x := x - 1 END;
+IF x > 14359 THEN x := x - 1 END;
+IF x > 14360 THEN x := x - 1 END;
+IF x > 14361 THEN x := x - 1 END;
+IF x > 14362 THEN x := x - 1 END;
+IF x > 14363 THEN x := x - 1 END;
+IF x > 14364 THEN x := x - 1 END;
+IF x > 14365 THEN x := x - 1 END;
+IF x > 14366 THEN x := x - 1 END;
+IF x > 14367 THEN x := x - 1 END;
+IF x > 14368 THEN x := x - 1 END;
+IF x > 14369 THEN x := x - 1 END;
+IF x > 14370 THEN x := x - 1 END;
+IF x > 14371 THEN x := x - 1 END;
+IF x > 14372 THEN x := x - 1 END;
+IF x > 14373 THEN x := x - 1 END;
+IF x > 14374 THEN x := x - 1 END;
+IF x > 14375 THEN x := x - 1 END;
+IF x > 14376 THEN x := x - 1 END;
+IF x > 14377 THEN x := x - 1 END;
+IF x > 14378 THEN x := x - 1 END;
+IF x > 14379 THEN x := x - 1 END;
+IF x > 14380 THEN x := x - 1 END;
+IF x > 14381 THEN x := x - 1 END;
+IF x > 14382 THEN x := x - 1 END;
+IF x > 14383 THEN x := x - 1 END;
+IF x > 14384 THEN x := x - 1 END;
+IF x > 14385 THEN x := x - 1 END;
+IF x > 14386 THEN x := x - 1 END;
+IF x > 14387 THEN x := x - 1 END;
+IF x > 14388 THEN x := x - 1 END;
+IF x > 14389 THEN x := x - 1 END;
+IF x > 14390 THEN x := x - 1 END;
+IF x > 14391 THEN x := x - 1 END;
+IF x > 14392 THEN x := x - 1 END;
+IF x > 14393 THEN x := x - 1 END;
+IF x > 14394 THEN x := x - 1 END;
+IF x > 14395 THEN x := x - 1 END;
+IF x > 14396 THEN x := x - 1 END;
+IF x > 14397 THEN x := x - 1 END;
+IF x > 14398 THEN x := x - 1 END;
+IF x > 14399 THEN x := x - 1 END;
+IF x > 14400 THEN x := x - 1 END;
+IF x > 14401 THEN x := x - 1 END;
+IF x > 14402 THEN x := x - 1 END;
+IF x > 14403 THEN x := x - 1 END;
+IF x > 14404 THEN x := x - 1 END;
+IF x > 14405 THEN x := x - 1 END;
+IF x > 14406 THEN x := x - 1 END;
+IF x > 14407 THEN x := x - 1 END;
+IF x > 14408 THEN x := x - 1 END;
+IF x > 14409 THEN x := x - 1 END;
+IF x > 14410 THEN x := x - 1 END;
+IF x > 14411 THEN x := x - 1 END;
+IF x > 14412 THEN x := x - 1 END;
+IF x > 14413 THEN x := x - 1 END;
+IF x > 14414 THEN x := x - 1 END;
+IF x > 14415 THEN x := x - 1 END;
+IF x > 14416 THEN x := x - 1 END;
+IF x > 14417 THEN x := x - 1 END;
+IF x > 14418 THEN x := x - 1 END;
+IF x > 14419 THEN x := x - 1 END;
+IF x > 14420 THEN x := x - 1 END;
+IF x > 14421 THEN x := x - 1 END;
+IF x > 14422 THEN x := x - 1 END;
+IF x > 14423 THEN x := x - 1 END;
+IF x > 14424 THEN x := x - 1 END;
+IF x > 14425 THEN x := x - 1 END;
+IF x > 14426 THEN x := x - 1 END;
+IF x > 14427 THEN x := x - 1 END;
+IF x > 14428 THEN x := x - 1 END;
+IF x > 14429 THEN x := x - 1 END;
+IF x > 14430 THEN x := x - 1 END;
+IF x > 14431 THEN x := x - 1 END;
+IF x > 14432 THEN x := x - 1 END;
+IF x > 14433 THEN x := x - 1 END;
+IF x > 14434 THEN x := x - 1 END;
+IF x > 14435 THEN x := x - 1 END;
+IF x > 14436 THEN x := x - 1 END;
+IF x > 14437 THEN x := x - 1 END;
+IF x > 14438 THEN x := x - 1 END;
+IF x > 14439 THEN x := x - 1 END;
+IF x > 14440 THEN x := x - 1 END;
+IF x > 14441 THEN x := x - 1 END;
+IF x > 14442 THEN x := x - 1 END;
+IF x > 14443 THEN x := x - 1 END;
+IF x > 14444 THEN x := x - 1 END;
+IF x > 14445 THEN x := x - 1 END;
+IF x > 14446 THEN x := x - 1 END;
+IF x > 14447 THEN x := x - 1 END;
+IF x > 14448 THEN x := x - 1 END;
+IF x > 14449 THEN x := x - 1 END;
+IF x > 14450 THEN x := x - 1 END;
+IF x > 14451 THEN x := x - 1 END;
+IF x > 14452 THEN x := x - 1 END;
+IF x > 14453 THEN x := x - 1 END;
+IF x > 14454 THEN x := x - 1 END;
+IF x > 14455 THEN x := x - 1 END;
+IF x > 14456 THEN x := x - 1 END;
+IF x > 14457 THEN x := x - 1 END;
+IF x > 14458 THEN x := x - 1 END;
+IF x > 14459 THEN x := x - 1 END;
+IF x > 14460 THEN x := x - 1 END;
+IF x > 14461 THEN x := x - 1 END;
+IF x > 14462 THEN x := x - 1 END;
+IF x > 14463 THEN x := x - 1 END;
+IF x > 14464 THEN x := x - 1 END;
+IF x > 14465 THEN x := x - 1 END;
+IF x > 14466 THEN x := x - 1 END;
+IF x > 14467 THEN x := x - 1 END;
+IF x > 14468 THEN x := x - 1 END;
+IF x > 14469 THEN x := x - 1 END;
+IF x > 14470 THEN x := x - 1 END;
+IF x > 14471 THEN x := x - 1 END;
+IF x > 14472 THEN x := x - 1 END;
+IF x > 14473 THEN x := x - 1 END;
+IF x > 14474 THEN x := x - 1 END;
+IF x > 14475 THEN x := x - 1 END;
+IF x > 14476 THEN x := x - 1 END;
+IF x > 14477 THEN x := x - 1 END;
+IF x > 14478 THEN x := x - 1 END;
+IF x > 14479 THEN x := x - 1 END;
+IF x > 14480 THEN x := x - 1 END;
+IF x > 14481 THEN x := x - 1 END;
+IF x > 14482 THEN x := x - 1 END;
+IF x > 14483 THEN x := x - 1 END;
+IF x > 14484 THEN x := x - 1 END;
+IF x > 14485 THEN x := x - 1 END;
+IF x > 14486 THEN x := x - 1 END;
+IF x > 14487 THEN x := x - 1 END;
+IF x > 14488 THEN x := x - 1 END;
+IF x > 14489 THEN x := x - 1 END;
+IF x > 14490 THEN x := x - 1 END;
+IF x > 14491 THEN x := x - 1 END;
+IF x > 14492 THEN x := x - 1 END;
+IF x > 14493 THEN x := x - 1 END;
+IF x > 14494 THEN x := x - 1 END;
+IF x > 14495 THEN x := x - 1 END;
+IF x > 14496 THEN x := x - 1 END;
+IF x > 14497 THEN x := x - 1 END;
+IF x > 14498 THEN x := x - 1 END;
+IF x > 14499 THEN x := x - 1 END;
+IF x > 14500 THEN x := x - 1 END;
+IF x > 14501 THEN x := x - 1 END;
+IF x > 14502 THEN x := x - 1 END;
+IF x > 14503 THEN x := x - 1 END;
+IF x > 14504 THEN x := x - 1 END;
+IF x > 14505 THEN x := x - 1 END;
+IF x > 14506 THEN x := x - 1 END;
+IF x > 14507 THEN x := x - 1 END;
+IF x > 14508 THEN x := x - 1 END;
+IF x > 14509 THEN x := x - 1 END;
+IF x > 14510 THEN x := x - 1 END;
+IF x > 14511 THEN x := x - 1 END;
+IF x > 14512 THEN x := x - 1 END;
+IF x > 14513 THEN x := x - 1 END;
+IF x > 14514 THEN x := x - 1 END;
+IF x > 14515 THEN x := x - 1 END;
+IF x > 14516 THEN x := x - 1 END;
+IF x > 14517 THEN x := x - 1 END;
+IF x > 14518 THEN x := x - 1 END;
+IF x > 14519 THEN x := x - 1 END;
+IF x > 14520 THEN x := x - 1 END;
+IF x > 14521 THEN x := x - 1 END;
+IF x > 14522 THEN x := x - 1 END;
+IF x > 14523 THEN x := x - 1 END;
+IF x > 14524 THEN x := x - 1 END;
+IF x > 14525 THEN x := x - 1 END;
+IF x > 14526 THEN x := x - 1 END;
+IF x > 14527 THEN x := x - 1 END;
+IF x > 14528 THEN x := x - 1 END;
+IF x > 14529 THEN x := x - 1 END;
+IF x > 14530 THEN x := x - 1 END;
+IF x > 14531 THEN x := x - 1 END;
+IF x > 14532 THEN x := x - 1 END;
+IF x > 14533 THEN x := x - 1 END;
+IF x > 14534 THEN x := x - 1 END;
+IF x > 14535 THEN x := x - 1 END;
+IF x > 14536 THEN x := x - 1 END;
+IF x > 14537 THEN x := x - 1 END;
+IF x > 14538 THEN x := x - 1 END;
+IF x > 14539 THEN x := x - 1 END;
+IF x > 14540 THEN x := x - 1 END;
+IF x > 14541 THEN x := x - 1 END;
+IF x > 14542 THEN x := x - 1 END;
+IF x > 14543 THEN x := x - 1 END;
+IF x > 14544 THEN x := x - 1 END;
+IF x > 14545 THEN x := x - 1 END;
+IF x > 14546 THEN x := x - 1 END;
+IF x > 14547 THEN x := x - 1 END;
+IF x > 14548 THEN x := x - 1 END;
+IF x > 14549 THEN x := x - 1 END;
+IF x > 14550 THEN x := x - 1 END;
+IF x > 14551 THEN x := x - 1 END;
+IF x > 14552 THEN x := x - 1 END;
+IF x > 14553 THEN x := x - 1 END;
+IF x > 14554 THEN x := x - 1 END;
+IF x > 14555 THEN x := x - 1 END;
+IF x > 14556 THEN x := x - 1 END;
+IF x > 14557 THEN x := x - 1 END;
+IF x > 14558 THEN x := x - 1 END;
+IF x > 14559 THEN x := x - 1 END;
+IF x > 14560 THEN x := x - 1 END;
+IF x > 14561 THEN x := x - 1 END;
+IF x > 14562 THEN x := x - 1 END;
+IF x > 14563 THEN x := x - 1 END;
+IF x > 14564 THEN x := x - 1 END;
+IF x > 14565 THEN x := x - 1 END;
+IF x > 14566 THEN x := x - 1 END;
+IF x > 14567 THEN x := x - 1 END;
+IF x > 14568 THEN x := x - 1 END;
+IF x > 14569 THEN x := x - 1 END;
+IF x > 14570 THEN x := x - 1 END;
+IF x > 14571 THEN x := x - 1 END;
+IF x > 14572 THEN x := x - 1 END;
+IF x > 14573 THEN x := x - 1 END;
+IF x > 14574 THEN x := x - 1 END;
+IF x > 14575 THEN x := x - 1 END;
+IF x > 14576 THEN x := x - 1 END;
+IF x > 14577 THEN x := x - 1 END;
+IF x > 14578 THEN x := x - 1 END;
+IF x > 14579 THEN x := x - 1 END;
+IF x > 14580 THEN x := x - 1 END;
+IF x > 14581 THEN x := x - 1 END;
+IF x > 14582 THEN x := x - 1 END;
+IF x > 14583 THEN x := x - 1 END;
+IF x > 14584 THEN x := x - 1 END;
+IF x > 14585 THEN x := x - 1 END;
+IF x > 14586 THEN x := x - 1 END;
+IF x > 14587 THEN x := x - 1 END;
+IF x > 14588 THEN x := x - 1 END;
+IF x > 14589 THEN x := x - 1 END;
+IF x > 14590 THEN x := x - 1 END;
+IF x > 14591 THEN x := x - 1 END;
+IF x > 14592 THEN x := x - 1 END;
+IF x > 14593 THEN x := x - 1 END;
+IF x > 14594 THEN x := x - 1 END;
+IF x > 14595 THEN x := x - 1 END;
+IF x > 14596 THEN x := x - 1 END;
+IF x > 14597 THEN x := x - 1 END;
+IF x > 14598 THEN x := x - 1 END;
+IF x > 14599 THEN x := x - 1 END;
+IF x > 14600 THEN x := x - 1 END;
+IF x > 14601 THEN x := x - 1 END;
+IF x > 14602 THEN x := x - 1 END;
+IF x > 14603 THEN x := x - 1 END;
+IF x > 14604 THEN x := x - 1 END;
+IF x > 14605 THEN x := x - 1 END;
+IF x > 14606 THEN x := x - 1 END;
+IF x > 14607 THEN x := x - 1 END;
+IF x > 14608 THEN x := x - 1 END;
+IF x > 14609 THEN x := x - 1 END;
+IF x > 14610 THEN x := x - 1 END;
+IF x > 14611 THEN x := x - 1 END;
+IF x > 14612 THEN x := x - 1 END;
+IF x > 14613 THEN x := x - 1 END;
+IF x > 14614 THEN x := x - 1 END;
+IF x > 14615 THEN x := x - 1 END;
+IF x > 14616 THEN x := x - 1 END;
+IF x > 14617 THEN x := x - 1 END;
+IF x > 14618 THEN x := x - 1 END;
+IF x > 14619 THEN x := x - 1 END;
+IF x > 14620 THEN x := x - 1 END;
+IF x > 14621 THEN x := x - 1 END;
+IF x > 14622 THEN x := x - 1 END;
+IF x > 14623 THEN x := x - 1 END;
+IF x > 14624 THEN x := x - 1 END;
+IF x > 14625 THEN x := x - 1 END;
+IF x > 14626 THEN x := x - 1 END;
+IF x > 14627 THEN x := x - 1 END;
+IF x > 14628 THEN x := x - 1 END;
+IF x > 14629 THEN x := x - 1 END;
+IF x > 14630 THEN x := x - 1 END;
+IF x > 14631 THEN x := x - 1 END;
+IF x > 14632 THEN x := x - 1 END;
+IF x > 14633 THEN x := x - 1 END;
+IF x > 14634 THEN x := x - 1 END;
+IF x > 14635 THEN x := x - 1 END;
+IF x > 14636 THEN x := x - 1 END;
+IF x > 14637 THEN x := x - 1 END;
+IF x > 14638 THEN x := x - 1 END;
+IF x > 14639 THEN x := x - 1 END;
+IF x > 14640 THEN x := x - 1 END;
+IF x > 14641 THEN x := x - 1 END;
+IF x > 14642 THEN x := x - 1 END;
+IF x > 14643 THEN x := x - 1 END;
+IF x > 14644 THEN x := x - 1 END;
+IF x > 14645 THEN x := x - 1 END;
+IF x > 14646 THEN x := x - 1 END;
+IF x > 14647 THEN x := x - 1 END;
+IF x > 14648 THEN x := x - 1 END;
+IF x > 14649 THEN x := x - 1 END;
+IF x > 14650 THEN x := x - 1 END;
+IF x > 14651 THEN x := x - 1 END;
+IF x > 14652 THEN x := x - 1 END;
+IF x > 14653 THEN x := x - 1 END;
+IF x > 14654 THEN x := x - 1 END;
+IF x > 14655 THEN x := x - 1 END;
+IF x > 14656 THEN x := x - 1 END;
+IF x > 14657 THEN x := x - 1 END;
+IF x > 14658 THEN x := x - 1 END;
+IF x > 14659 THEN x := x - 1 END;
+IF x > 14660 THEN x := x - 1 END;
+IF x > 14661 THEN x := x - 1 END;
+IF x > 14662 THEN x := x - 1 END;
+IF x > 14663 THEN x := x - 1 END;
+IF x > 14664 THEN x := x - 1 END;
+IF x > 14665 THEN x := x - 1 END;
+IF x > 14666 THEN x := x - 1 END;
+IF x > 14667 THEN x := x - 1 END;
+IF x > 14668 THEN x := x - 1 END;
+IF x > 14669 THEN x := x - 1 END;
+IF x > 14670 THEN x := x - 1 END;
+IF x > 14671 THEN x := x - 1 END;
+IF x > 14672 THEN x := x - 1 END;
+IF x > 14673 THEN x := x - 1 END;
+IF x > 14674 THEN x := x - 1 END;
+IF x > 14675 THEN x := x - 1 END;
+IF x > 14676 THEN x := x - 1 END;
+IF x > 14677 THEN x := x - 1 END;
+IF x > 14678 THEN x := x - 1 END;
+IF x > 14679 THEN x := x - 1 END;
+IF x > 14680 THEN x := x - 1 END;
+IF x > 14681 THEN x := x - 1 END;
+IF x > 14682 THEN x := x - 1 END;
+IF x > 14683 THEN x := x - 1 END;
+IF x > 14684 THEN x := x - 1 END;
+IF x > 14685 THEN x := x - 1 END;
+IF x > 14686 THEN x := x - 1 END;
+IF x > 14687 THEN x := x - 1 END;
+IF x > 14688 THEN x := x - 1 END;
+IF x > 14689 THEN x := x - 1 END;
+IF x > 14690 THEN x := x - 1 END;
+IF x > 14691 THEN x := x - 1 END;
+IF x > 14692 THEN x := x - 1 END;
+IF x > 14693 THEN x := x - 1 END;
+IF x > 14694 THEN x := x - 1 END;
+IF x > 14695 THEN x := x - 1 END;
+IF x > 14696 THEN x := x - 1 END;
+IF x > 14697 THEN x := x - 1 END;
+IF x > 14698 THEN x := x - 1 END;
+IF x > 14699 THEN x := x - 1 END;
+IF x > 14700 THEN x := x - 1 END;
+IF x > 14701 THEN x := x - 1 END;
+IF x > 14702 THEN x := x - 1 END;
+IF x > 14703 THEN x := x - 1 END;
+IF x > 14704 THEN x := x - 1 END;
+IF x > 14705 THEN x := x - 1 END;
+IF x > 14706 THEN x := x - 1 END;
+IF x > 14707 THEN x := x - 1 END;
+IF x > 14708 THEN x := x - 1 END;
+IF x > 14709 THEN x := x - 1 END;
+IF x > 14710 THEN x := x - 1 END;
+IF x > 14711 THEN x := x - 1 END;
+IF x > 14712 THEN x := x - 1 END;
+IF x > 14713 THEN x := x - 1 END;
+IF x > 14714 THEN x := x - 1 END;
+IF x > 14715 THEN x := x - 1 END;
+IF x > 14716 THEN x := x - 1 END;
+IF x > 14717 THEN x := x - 1 END;
+IF x > 14718 THEN x := x - 1 END;
+IF x > 14719 THEN x := x - 1 END;
+IF x > 14720 THEN x := x - 1 END;
+IF x > 14721 THEN x := x - 1 END;
+IF x > 14722 THEN x := x - 1 END;
+IF x > 14723 THEN x := x - 1 END;
+IF x > 14724 THEN x := x - 1 END;
+IF x > 14725 THEN x := x - 1 END;
+IF x > 14726 THEN x := x - 1 END;
+IF x > 14727 THEN x := x - 1 END;
+IF x > 14728 THEN x := x - 1 END;
+IF x > 14729 THEN x := x - 1 END;
+IF x > 14730 THEN x := x - 1 END;
+IF x > 14731 THEN x := x - 1 END;
+IF x > 14732 THEN x := x - 1 END;
+IF x > 14733 THEN x := x - 1 END;
+IF x > 14734 THEN x := x - 1 END;
+IF x > 14735 THEN x := x - 1 END;
+IF x > 14736 THEN x := x - 1 END;
+IF x > 14737 THEN x := x - 1 END;
+IF x > 14738 THEN x := x - 1 END;
+IF x > 14739 THEN x := x - 1 END;
+IF x > 14740 THEN x := x - 1 END;
+IF x > 14741 THEN x := x - 1 END;
+IF x > 14742 THEN x := x - 1 END;
+IF x > 14743 THEN x := x - 1 END;
+IF x > 14744 THEN x := x - 1 END;
+IF x > 14745 THEN x := x - 1 END;
+IF x > 14746 THEN x := x - 1 END;
+IF x > 14747 THEN x := x - 1 END;
+IF x > 14748 THEN x := x - 1 END;
+IF x > 14749 THEN x := x - 1 END;
+IF x > 14750 THEN x := x - 1 END;
+IF x > 14751 THEN x := x - 1 END;
+IF x > 14752 THEN x := x - 1 END;
+IF x > 14753 THEN x := x - 1 END;
+IF x > 14754 THEN x := x - 1 END;
+IF x > 14755 THEN x := x - 1 END;
+IF x > 14756 THEN x := x - 1 END;
+IF x > 14757 THEN x := x - 1 END;
+IF x > 14758 THEN x := x - 1 END;
+IF x > 14759 THEN x := x - 1 END;
+IF x > 14760 THEN x := x - 1 END;
+IF x > 14761 THEN x := x - 1 END;
+IF x > 14762 THEN x := x - 1 END;
+IF x > 14763 THEN x := x - 1 END;
+IF x > 14764 THEN x := x - 1 END;
+IF x > 14765 THEN x := x - 1 END;
+IF x > 14766 THEN x := x - 1 END;
+IF x > 14767 THEN x := x - 1 END;
+IF x > 14768 THEN x := x - 1 END;
+IF x > 14769 THEN x := x - 1 END;
+IF x > 14770 THEN x := x - 1 END;
+IF x > 14771 THEN x := x - 1 END;
+IF x > 14772 THEN x := x - 1 END;
+IF x > 14773 THEN x := x - 1 END;
+IF x > 14774 THEN x := x - 1 END;
+IF x > 14775 THEN x := x - 1 END;
+IF x > 14776 THEN x := x - 1 END;
+IF x > 14777 THEN x := x - 1 END;
+IF x > 14778 THEN x := x - 1 END;
+IF x > 14779 THEN x := x - 1 END;
+IF x > 14780 THEN x := x - 1 END;
+IF x > 14781 THEN x := x - 1 END;
+IF x > 14782 THEN x := x - 1 END;
+IF x > 14783 THEN x := x - 1 END;
+IF x > 14784 THEN x := x - 1 END;
+IF x > 14785 THEN x := x - 1 END;
+IF x > 14786 THEN x := x - 1 END;
+IF x > 14787 THEN x := x - 1 END;
+IF x > 14788 THEN x := x - 1 END;
+IF x > 14789 THEN x := x - 1 END;
+IF x > 14790 THEN x := x - 1 END;
+IF x > 14791 THEN x := x - 1 END;
+IF x > 14792 THEN x := x - 1 END;
+IF x > 14793 THEN x := x - 1 END;
+IF x > 14794 THEN x := x - 1 END;
+IF x > 14795 THEN x := x - 1 END;
+IF x > 14796 THEN x := x - 1 END;
+IF x > 14797 THEN x := x - 1 END;
+IF x > 14798 THEN x := x - 1 END;
+IF x > 14799 THEN x := x - 1 END;
+IF x > 14800 THEN x := x - 1 END;
+IF x > 14801 THEN x := x - 1 END;
+IF x > 14802 THEN x := x - 1 END;
+IF x > 14803 THEN x := x - 1 END;
+IF x > 14804 THEN x := x - 1 END;
+IF x > 14805 THEN x := x - 1 END;
+IF x > 14806 THEN x := x - 1 END;
+IF x > 14807 THEN x := x - 1 END;
+IF x > 14808 THEN x := x - 1 END;
+IF x > 14809 THEN x := x - 1 END;
+IF x > 14810 THEN x := x - 1 END;
+IF x > 14811 THEN x := x - 1 END;
+IF x > 14812 THEN x := x - 1 END;
+IF x > 14813 THEN x := x - 1 END;
+IF x > 14814 THEN x := x - 1 END;
+IF x > 14815 THEN x := x - 1 END;
+IF x > 14816 THEN x := x - 1 END;
+IF x > 14817 THEN x := x - 1 END;
+IF x > 14818 THEN x := x - 1 END;
+IF x > 14819 THEN x := x - 1 END;
+IF x > 14820 THEN x := x - 1 END;
+IF x > 14821 THEN x := x - 1 END;
+IF x > 14822 THEN x := x - 1 END;
+IF x > 14823 THEN x := x - 1 END;
+IF x > 14824 THEN x := x - 1 END;
+IF x > 14825 THEN x := x - 1 END;
+IF x > 14826 THEN x := x - 1 END;
+IF x > 14827 THEN x := x - 1 END;
+IF x > 14828 THEN x := x - 1 END;
+IF x > 14829 THEN x := x - 1 END;
+IF x > 14830 THEN x := x - 1 END;
+IF x > 14831 THEN x := x - 1 END;
+IF x > 14832 THEN x := x - 1 END;
+IF x > 14833 THEN x := x - 1 END;
+IF x > 14834 THEN x := x - 1 END;
+IF x > 14835 THEN x := x - 1 END;
+IF x > 14836 THEN x := x - 1 END;
+IF x > 14837 THEN x := x - 1 END;
+IF x > 14838 THEN x := x - 1 END;
+IF x > 14839 THEN x := x - 1 END;
+IF x > 14840 THEN x := x - 1 END;
+IF x > 14841 THEN x := x - 1 END;
+IF x > 14842 THEN x := x - 1 END;
+IF x > 14843 THEN x := x - 1 END;
+IF x > 14844 THEN x := x - 1 END;
+IF x > 14845 THEN x := x - 1 END;
+IF x > 14846 THEN x := x - 1 END;
+IF x > 14847 THEN x := x - 1 END;
+IF x > 14848 THEN x := x - 1 END;
+IF x > 14849 THEN x := x - 1 END;
+IF x > 14850 THEN x := x - 1 END;
+IF x > 14851 THEN x := x - 1 END;
+IF x > 14852 THEN x := x - 1 END;
+IF x > 14853 THEN x := x - 1 END;
+IF x > 14854 THEN x := x - 1 END;
+IF x > 14855 THEN x := x - 1 END;
+IF x > 14856 THEN x := x - 1 END;
+IF x > 14857 THEN x := x - 1 END;
+IF x > 14858 THEN x := x - 1 END;
+IF x > 14859 THEN x := x - 1 END;
+IF x > 14860 THEN x := x - 1 END;
+IF x > 14861 THEN x := x - 1 END;
+IF x > 14862 THEN x := x - 1 END;
+IF x > 14863 THEN x := x - 1 END;
+IF x > 14864 THEN x := x - 1 END;
+IF x > 14865 THEN x := x - 1 END;
+IF x > 14866 THEN x := x - 1 END;
+IF x > 14867 THEN x := x - 1 END;
+IF x > 14868 THEN x := x - 1 END;
+IF x > 14869 THEN x := x - 1 END;
+IF x > 14870 THEN x := x - 1 END;
+IF x > 14871 THEN x := x - 1 END;
+IF x > 14872 THEN x := x - 1 END;
+IF x > 14873 THEN x := x - 1 END;
+IF x > 14874 THEN x := x - 1 END;
+IF x > 14875 THEN x := x - 1 END;
+IF x > 14876 THEN x := x - 1 END;
+IF x > 14877 THEN x := x - 1 END;
+IF x > 14878 THEN x := x - 1 END;
+IF x > 14879 THEN x := x - 1 END;
+IF x > 14880 THEN x := x - 1 END;
+IF x > 14881 THEN x := x - 1 END;
+IF x > 14882 THEN x := x - 1 END;
+IF x > 14883 THEN x := x - 1 END;
+IF x > 14884 THEN x := x - 1 END;
+IF x > 14885 THEN x := x - 1 END;
+IF x > 14886 THEN x := x - 1 END;
+IF x > 14887 THEN x := x - 1 END;
+IF x > 14888 THEN x := x - 1 END;
+IF x > 14889 THEN x := x - 1 END;
+IF x > 14890 THEN x := x - 1 END;
+IF x > 14891 THEN x := x - 1 END;
+IF x > 14892 THEN x := x - 1 END;
+IF x > 14893 THEN x := x - 1 END;
+IF x > 14894 THEN x := x - 1 END;
+IF x > 14895 THEN x := x - 1 END;
+IF x > 14896 THEN x := x - 1 END;
+IF x > 14897 THEN x := x - 1 END;
+IF x > 14898 THEN x := x - 1 END;
+IF x > 14899 THEN x := x - 1 END;
+IF x > 14900 THEN x := x - 1 END;
+IF x > 14901 THEN x := x - 1 END;
+IF x > 14902 THEN x := x - 1 END;
+IF x > 14903 THEN x := x - 1 END;
+IF x > 14904 THEN x := x - 1 END;
+IF x > 14905 THEN x := x - 1 END;
+IF x > 14906 THEN x := x - 1 END;
+IF x > 14907 THEN x := x - 1 END;
+IF x > 14908 THEN x := x - 1 END;
+IF x > 14909 THEN x := x - 1 END;
+IF x > 14910 THEN x := x - 1 END;
+IF x > 14911 THEN x := x - 1 END;
+IF x > 14912 THEN x := x - 1 END;
+IF x > 14913 THEN x := x - 1 END;
+IF x > 14914 THEN x := x - 1 END;
+IF x > 14915 THEN x := x - 1 END;
+IF x > 14916 THEN x := x - 1 END;
+IF x > 14917 THEN x := x - 1 END;
+IF x > 14918 THEN x := x - 1 END;
+IF x > 14919 THEN x := x - 1 END;
+IF x > 14920 THEN x := x - 1 END;
+IF x > 14921 THEN x := x - 1 END;
+IF x > 14922 THEN x := x - 1 END;
+IF x > 14923 THEN x := x - 1 END;
+IF x > 14924 THEN x := x - 1 END;
+IF x > 14925 THEN x := x - 1 END;
+IF x > 14926 THEN x := x - 1 END;
+IF x > 14927 THEN x := x - 1 END;
+IF x > 14928 THEN x := x - 1 END;
+IF x > 14929 THEN x := x - 1 END;
+IF x > 14930 THEN x := x - 1 END;
+IF x > 14931 THEN x := x - 1 END;
+IF x > 14932 THEN x := x - 1 END;
+IF x > 14933 THEN x := x - 1 END;
+IF x > 14934 THEN x := x - 1 END;
+IF x > 14935 THEN x := x - 1 END;
+IF x > 14936 THEN x := x - 1 END;
+IF x > 14937 THEN x := x - 1 END;
+IF x > 14938 THEN x := x - 1 END;
+IF x > 14939 THEN x := x - 1 END;
+IF x > 14940 THEN x := x - 1 END;
+IF x > 14941 THEN x := x - 1 END;
+IF x > 14942 THEN x := x - 1 END;
+IF x > 14943 THEN x := x - 1 END;
+IF x > 14944 THEN x := x - 1 END;
+IF x > 14945 THEN x := x - 1 END;
+IF x > 14946 THEN x := x - 1 END;
+IF x > 14947 THEN x := x - 1 END;
+IF x > 14948 THEN x := x - 1 END;
+IF x > 14949 THEN x := x - 1 END;
+IF x > 14950 THEN x := x - 1 END;
+IF x > 14951 THEN x := x - 1 END;
+IF x > 14952 THEN x := x - 1 END;
+IF x > 14953 THEN x := x - 1 END;
+IF x > 14954 THEN x := x - 1 END;
+IF x > 14955 THEN x := x - 1 END;
+IF x > 14956 THEN x := x - 1 END;
+IF x > 14957 THEN x := x - 1 END;
+IF x > 14958 THEN x := x - 1 END;
+IF x > 14959 THEN x := x - 1 END;
+IF x > 14960 THEN x := x - 1 END;
+IF x > 14961 THEN x := x - 1 END;
+IF x > 14962 THEN x := x - 1 END;
+IF x > 14963 THEN x := x - 1 END;
+IF x > 14964 THEN x := x - 1 END;
+IF x > 14965 THEN x := x - 1 END;
+IF x > 14966 THEN x := x - 1 END;
+IF x > 14967 THEN x := x - 1 END;
+IF x > 14968 THEN x := x - 1 END;
+IF x > 14969 THEN x := x - 1 END;
+IF x > 14970 THEN x := x - 1 END;
+IF x > 14971 THEN x := x - 1 END;
+IF x > 14972 THEN x := x - 1 END;
+IF x > 14973 THEN x := x - 1 END;
+IF x > 14974 THEN x := x - 1 END;
+IF x > 14975 THEN x := x - 1 END;
+IF x > 14976 THEN x := x - 1 END;
+IF x > 14977 THEN x := x - 1 END;
+IF x > 14978 THEN x := x - 1 END;
+IF x > 14979 THEN x := x - 1 END;
+IF x > 14980 THEN x := x - 1 END;
+IF x > 14981 THEN x := x - 1 END;
+IF x > 14982 THEN x := x - 1 END;
+IF x > 14983 THEN x := x - 1 END;
+IF x > 14984 THEN x := x - 1 END;
+IF x > 14985 THEN x := x - 1 END;
+IF x > 14986 THEN x := x - 1 END;
+IF x > 14987 THEN x := x - 1 END;
+IF x > 14988 THEN x := x - 1 END;
+IF x > 14989 THEN x := x - 1 END;
+IF x > 14990 THEN x := x - 1 END;
+IF x > 14991 THEN x := x - 1 END;
+IF x > 14992 THEN x := x - 1 END;
+IF x > 14993 THEN x := x - 1 END;
+IF x > 14994 THEN x := x - 1 END;
+IF x > 14995 THEN x := x - 1 END;
+IF x > 14996 THEN x := x - 1 END;
+IF x > 14997 THEN x := x - 1 END;
+IF x > 14998 THEN x := x - 1 END;
+IF x > 14999 THEN x := x - 1 END;
+IF x > 15000 THEN x := x - 1 END;
+IF x > 15001 THEN x := x - 1 END;
+IF x > 15002 THEN x := x - 1 END;
+IF x > 15003 THEN x := x - 1 END;
+IF x > 15004 THEN x := x - 1 END;
+IF x > 15005 THEN x := x - 1 END;
+IF x > 15006 THEN x := x - 1 END;
+IF x > 15007 THEN x := x - 1 END;
+IF x > 15008 THEN x := x - 1 END;
+IF x > 15009 THEN x := x - 1 END;
+IF x > 15010 THEN x := x - 1 END;
+IF x > 15011 THEN x := x - 1 END;
+IF x > 15012 THEN x := x - 1 END;
+IF x > 15013 THEN x := x - 1 END;
+IF x > 15014 THEN x := x - 1 END;
+IF x > 15015 THEN x := x - 1 END;
+IF x > 15016 THEN x := x - 1 END;
+IF x > 15017 THEN x := x - 1 END;
+IF x > 15018 THEN x := x - 1 END;
+IF x > 15019 THEN x := x - 1 END;
+IF x > 15020 THEN x := x - 1 END;
+IF x > 15021 THEN x := x - 1 END;
+IF x > 15022 THEN x := x - 1 END;
+IF x > 15023 THEN x := x - 1 END;
+IF x > 15024 THEN x := x - 1 END;
+IF x > 15025 THEN x := x - 1 END;
+IF x > 15026 THEN x := x - 1 END;
+IF x > 15027 THEN x := x - 1 END;
+IF x > 15028 THEN x := x - 1 END;
+IF x > 15029 THEN x := x - 1 END;
+IF x > 15030 THEN x := x - 1 END;
+IF x > 15031 THEN x := x - 1 END;
+IF x > 15032 THEN x := x - 1 END;
+IF x > 15033 THEN x := x - 1 END;
+IF x > 15034 THEN x := x - 1 END;
+IF x > 15035 THEN x := x - 1 END;
+IF x > 15036 THEN x := x - 1 END;
+IF x > 15037 THEN x := x - 1 END;
+IF x > 15038 THEN x := x - 1 END;
+IF x > 15039 THEN x := x - 1 END;
+IF x > 15040 THEN x := x - 1 END;
+IF x > 15041 THEN x := x - 1 END;
+IF x > 15042 THEN x := x - 1 END;
+IF x > 15043 THEN x := x - 1 END;
+IF x > 15044 THEN x := x - 1 END;
+IF x > 15045 THEN x := x - 1 END;
+IF x > 15046 THEN x := x - 1 END;
+IF x > 15047 THEN x := x - 1 END;
+IF x > 15048 THEN x := x - 1 END;
+IF x > 15049 THEN x := x - 1 END;
+IF x > 15050 THEN x := x - 1 END;
+IF x > 15051 THEN x := x - 1 END;
+IF x > 15052 THEN x := x - 1 END;
+IF x > 15053 THEN x := x - 1 END;
+IF x > 15054 THEN x := x - 1 END;
+IF x > 15055 THEN x := x - 1 END;
+IF x > 15056 THEN x := x - 1 END;
+IF x > 15057 THEN x := x - 1 END;
+IF x > 15058 THEN x := x - 1 END;
+IF x > 15059 THEN x := x - 1 END;
+IF x > 15060 THEN x := x - 1 END;
+IF x > 15061 THEN x := x - 1 END;
+IF x > 15062 THEN x := x - 1 END;
+IF x > 15063 THEN x := x - 1 END;
+IF x > 15064 THEN x := x - 1 END;
+IF x > 15065 THEN x := x - 1 END;
+IF x > 15066 THEN x := x - 1 END;
+IF x > 15067 THEN x := x - 1 END;
+IF x > 15068 THEN x := x - 1 END;
+IF x > 15069 THEN x := x - 1 END;
+IF x > 15070 THEN x := x - 1 END;
+IF x > 15071 THEN x := x - 1 END;
+IF x > 15072 THEN x := x - 1 END;
+IF x > 15073 THEN x := x - 1 END;
+IF x > 15074 THEN x := x - 1 END;
+IF x > 15075 THEN x := x - 1 END;
+IF x > 15076 THEN x := x - 1 END;
+IF x > 15077 THEN x := x - 1 END;
+IF x > 15078 THEN x := x - 1 END;
+IF x > 15079 THEN x := x - 1 END;
+IF x > 15080 THEN x := x - 1 END;
+IF x > 15081 THEN x := x - 1 END;
+IF x > 15082 THEN x := x - 1 END;
+IF x > 15083 THEN x := x - 1 END;
+IF x > 15084 THEN x := x - 1 END;
+IF x > 15085 THEN x := x - 1 END;
+IF x > 15086 THEN x := x - 1 END;
+IF x > 15087 THEN x := x - 1 END;
+IF x > 15088 THEN x := x - 1 END;
+IF x > 15089 THEN x := x - 1 END;
+IF x > 15090 THEN x := x - 1 END;
+IF x > 15091 THEN x := x - 1 END;
+IF x > 15092 THEN x := x - 1 END;
+IF x > 15093 THEN x := x - 1 END;
+IF x > 15094 THEN x := x - 1 END;
+IF x > 15095 THEN x := x - 1 END;
+IF x > 15096 THEN x := x - 1 END;
+IF x > 15097 THEN x := x - 1 END;
+IF x > 15098 THEN x := x - 1 END;
+IF x > 15099 THEN x := x - 1 END;
+IF x > 15100 THEN x := x - 1 END;
+IF x > 15101 THEN x := x - 1 END;
+IF x > 15102 THEN x := x - 1 END;
+IF x > 15103 THEN x := x - 1 END;
+IF x > 15104 THEN x := x - 1 END;
+IF x > 15105 THEN x := x - 1 END;
+IF x > 15106 THEN x := x - 1 END;
+IF x > 15107 THEN x := x - 1 END;
+IF x > 15108 THEN x := x - 1 END;
+IF x > 15109 THEN x := x - 1 END;
+IF x > 15110 THEN x := x - 1 END;
+IF x > 15111 THEN x := x - 1 END;
+IF x > 15112 THEN x := x - 1 END;
+IF x > 15113 THEN x := x - 1 END;
+IF x > 15114 THEN x := x - 1 END;
+IF x > 15115 THEN x := x - 1 END;
+IF x > 15116 THEN x := x - 1 END;
+IF x > 15117 THEN x := x - 1 END;
+IF x > 15118 THEN x := x - 1 END;
+IF x > 15119 THEN x := x - 1 END;
+IF x > 15120 THEN x := x - 1 END;
+IF x > 15121 THEN x := x - 1 END;
+IF x > 15122 THEN x := x - 1 END;
+IF x > 15123 THEN x := x - 1 END;
+IF x > 15124 THEN x := x - 1 END;
+IF x > 15125 THEN x := x - 1 END;
+IF x > 15126 THEN x := x - 1 END;
+IF x > 15127 THEN x := x - 1 END;
+IF x > 15128 THEN x := x - 1 END;
+IF x > 15129 THEN x := x - 1 END;
+IF x > 15130 THEN x := x - 1 END;
+IF x > 15131 THEN x := x - 1 END;
+IF x > 15132 THEN x := x - 1 END;
+IF x > 15133 THEN x := x - 1 END;
+IF x > 15134 THEN x := x - 1 END;
+IF x > 15135 THEN x := x - 1 END;
+IF x > 15136 THEN x := x - 1 END;
+IF x > 15137 THEN x := x - 1 END;
+IF x > 15138 THEN x := x - 1 END;
+IF x > 15139 THEN x := x - 1 END;
+IF x > 15140 THEN x := x - 1 END;
+IF x > 15141 THEN x := x - 1 END;
+IF x > 15142 THEN x := x - 1 END;
+IF x > 15143 THEN x := x - 1 END;
+IF x > 15144 THEN x := x - 1 END;
+IF x > 15145 THEN x := x - 1 END;
+IF x > 15146 THEN x := x - 1 END;
+IF x > 15147 THEN x := x - 1 END;
+IF x > 15148 THEN x := x - 1 END;
+IF x > 15149 THEN x := x - 1 END;
+IF x > 15150 THEN x := x - 1 END;
+IF x > 15151 THEN x := x - 1 END;
+IF x > 15152 THEN x := x - 1 END;
+IF x > 15153 THEN x := x - 1 END;
+IF x > 15154 THEN x := x - 1 END;
+IF x > 15155 THEN x := x - 1 END;
+IF x > 15156 THEN x := x - 1 END;
+IF x > 15157 THEN x := x - 1 END;
+IF x > 15158 THEN x := x - 1 END;
+IF x > 15159 THEN x := x - 1 END;
+IF x > 15160 THEN x := x - 1 END;
+IF x > 15161 THEN x := x - 1 END;
+IF x > 15162 THEN x := x - 1 END;
+IF x > 15163 THEN x := x - 1 END;
+IF x > 15164 THEN x := x - 1 END;
+IF x > 15165 THEN x := x - 1 END;
+IF x > 15166 THEN x := x - 1 END;
+IF x > 15167 THEN x := x - 1 END;
+IF x > 15168 THEN x := x - 1 END;
+IF x > 15169 THEN x := x - 1 END;
+IF x > 15170 THEN x := x - 1 END;
+IF x > 15171 THEN x := x - 1 END;
+IF x > 15172 THEN x := x - 1 END;
+IF x > 15173 THEN x := x - 1 END;
+IF x > 15174 THEN x := x - 1 END;
+IF x > 15175 THEN x := x - 1 END;
+IF x > 15176 THEN x := x - 1 END;
+IF x > 15177 THEN x := x - 1 END;
+IF x > 15178 THEN x := x - 1 END;
+IF x > 15179 THEN x := x - 1 END;
+IF x > 15180 THEN x := x - 1 END;
+IF x > 15181 THEN x := x - 1 END;
+IF x > 15182 THEN x := x - 1 END;
+IF x > 15183 THEN x := x - 1 END;
+IF x > 15184 THEN x := x - 1 END;
+IF x > 15185 THEN x := x - 1 END;
+IF x > 15186 THEN x := x - 1 END;
+IF x > 15187 THEN x := x - 1 END;
+IF x > 15188 THEN x := x - 1 END;
+IF x > 15189 THEN x := x - 1 END;
+IF x > 15190 THEN x := x - 1 END;
+IF x > 15191 THEN x := x - 1 END;
+IF x > 15192 THEN x := x - 1 END;
+IF x > 15193 THEN x := x - 1 END;
+IF x > 15194 THEN x := x - 1 END;
+IF x > 15195 THEN x := x - 1 END;
+IF x > 15196 THEN x := x - 1 END;
+IF x > 15197 THEN x := x - 1 END;
+IF x > 15198 THEN x := x - 1 END;
+IF x > 15199 THEN x := x - 1 END;
+IF x > 15200 THEN x := x - 1 END;
+IF x > 15201 THEN x := x - 1 END;
+IF x > 15202 THEN x := x - 1 END;
+IF x > 15203 THEN x := x - 1 END;
+IF x > 15204 THEN x := x - 1 END;
+IF x > 15205 THEN x := x - 1 END;
+IF x > 15206 THEN x := x - 1 END;
+IF x > 15207 THEN x := x - 1 END;
+IF x > 15208 THEN x := x - 1 END;
+IF x > 15209 THEN x := x - 1 END;
+IF x > 15210 THEN x := x - 1 END;
+IF x > 15211 THEN x := x - 1 END;
+IF x > 15212 THEN x := x - 1 END;
+IF x > 15213 THEN x := x - 1 END;
+IF x > 15214 THEN x := x - 1 END;
+IF x > 15215 THEN x := x - 1 END;
+IF x > 15216 THEN x := x - 1 END;
+IF x > 15217 THEN x := x - 1 END;
+IF x > 15218 THEN x := x - 1 END;
+IF x > 15219 THEN x := x - 1 END;
+IF x > 15220 THEN x := x - 1 END;
+IF x > 15221 THEN x := x - 1 END;
+IF x > 15222 THEN x := x - 1 END;
+IF x > 15223 THEN x := x - 1 END;
+IF x > 15224 THEN x := x - 1 END;
+IF x > 15225 THEN x := x - 1 END;
+IF x > 15226 THEN x := x - 1 END;
+IF x > 15227 THEN x := x - 1 END;
+IF x > 15228 THEN x := x - 1 END;
+IF x > 15229 THEN x := x - 1 END;
+IF x > 15230 THEN x := x - 1 END;
+IF x > 15231 THEN x := x - 1 END;
+IF x > 15232 THEN x := x - 1 END;
+IF x > 15233 THEN x := x - 1 END;
+IF x > 15234 THEN x := x - 1 END;
+IF x > 15235 THEN x := x - 1 END;
+IF x > 15236 THEN x := x - 1 END;
+IF x > 15237 THEN x := x - 1 END;
+IF x > 15238 THEN x := x - 1 END;
+IF x > 15239 THEN x := x - 1 END;
+IF x > 15240 THEN x := x - 1 END;
+IF x > 15241 THEN x := x - 1 END;
+IF x > 15242 THEN x := x - 1 END;
+IF x > 15243 THEN x := x - 1 END;
+IF x > 15244 THEN x := x - 1 END;
+IF x > 15245 THEN x := x - 1 END;
+IF x > 15246 THEN x := x - 1 END;
+IF x > 15247 THEN x := x - 1 END;
+IF x > 15248 THEN x := x - 1 END;
+IF x > 15249 THEN x := x - 1 END;
+IF x > 15250 THEN x := x - 1 END;
+IF x > 15251 THEN x := x - 1 END;
+IF x > 15252 THEN x := x - 1 END;
+IF x > 15253 THEN x := x - 1 END;
+IF x > 15254 THEN x := x - 1 END;
+IF x > 15255 THEN x := x - 1 END;
+IF x > 15256 THEN x := x - 1 END;
+IF x > 15257 THEN x := x - 1 END;
+IF x > 15258 THEN x := x - 1 END;
+IF x > 15259 THEN x := x - 1 END;
+IF x > 15260 THEN x := x - 1 END;
+IF x > 15261 THEN x := x - 1 END;
+IF x > 15262 THEN x := x - 1 END;
+IF x > 15263 THEN x := x - 1 END;
+IF x > 15264 THEN x := x - 1 END;
+IF x > 15265 THEN x := x - 1 END;
+IF x > 15266 THEN x := x - 1 END;
+IF x > 15267 THEN x := x - 1 END;
+IF x > 15268 THEN x := x - 1 END;
+IF x > 15269 THEN x := x - 1 END;
+IF x > 15270 THEN x := x - 1 END;
+IF x > 15271 THEN x := x - 1 END;
+IF x > 15272 THEN x := x - 1 END;
+IF x > 15273 THEN x := x - 1 END;
+IF x > 15274 THEN x := x - 1 END;
+IF x > 15275 THEN x := x - 1 END;
+IF x > 15276 THEN x := x - 1 END;
+IF x > 15277 THEN x := x - 1 END;
+IF x > 15278 THEN x := x - 1 END;
+IF x > 15279 THEN x := x - 1 END;
+IF x > 15280 THEN x := x - 1 END;
+IF x > 15281 THEN x := x - 1 END;
+IF x > 15282 THEN x := x - 1 END;
+IF x > 15283 THEN x := x - 1 END;
+IF x > 15284 THEN x := x - 1 END;
+IF x > 15285 THEN x := x - 1 END;
+IF x > 15286 THEN x := x - 1 END;
+IF x > 15287 THEN x := x - 1 END;
+IF x > 15288 THEN x := x - 1 END;
+IF x > 15289 THEN x := x - 1 END;
+IF x > 15290 THEN x := x - 1 END;
+IF x > 15291 THEN x := x - 1 END;
+IF x > 15292 THEN x := x - 1 END;
+IF x > 15293 THEN x := x - 1 END;
+IF x > 15294 THEN x := x - 1 END;
+IF x > 15295 THEN x := x - 1 END;
+IF x > 15296 THEN x := x - 1 END;
+IF x > 15297 THEN x := x - 1 END;
+IF x > 15298 THEN x := x - 1 END;
+IF x > 15299 THEN x := x - 1 END;
+IF x > 15300 THEN x := x - 1 END;
+IF x > 15301 THEN x := x - 1 END;
+IF x > 15302 THEN x := x - 1 END;
+IF x > 15303 THEN x := x - 1 END;
+IF x > 15304 THEN x := x - 1 END;
+IF x > 15305 THEN x := x - 1 END;
+IF x > 15306 THEN x := x - 1 END;
+IF x > 15307 THEN x := x - 1 END;
+IF x > 15308 THEN x := x - 1 END;
+IF x > 15309 THEN x := x - 1 END;
+IF x > 15310 THEN x := x - 1 END;
+IF x > 15311 THEN x := x - 1 END;
+IF x > 15312 THEN x := x - 1 END;
+IF x > 15313 THEN x := x - 1 END;
+IF x > 15314 THEN x := x - 1 END;
+IF x > 15315 THEN x := x - 1 END;
+IF x > 15316 THEN x := x - 1 END;
+IF x > 15317 THEN x := x - 1 END;
+IF x > 15318 THEN x := x - 1 END;
+IF x > 15319 THEN x := x - 1 END;
+IF x > 15320 THEN x := x - 1 END;
+IF x > 15321 THEN x := x - 1 END;
+IF x > 15322 THEN x := x - 1 END;
+IF x > 15323 THEN x := x - 1 END;
+IF x > 15324 THEN x := x - 1 END;
+IF x > 15325 THEN x := x - 1 END;
+IF x > 15326 THEN x := x - 1 END;
+IF x > 15327 THEN x := x - 1 END;
+IF x > 15328 THEN x := x - 1 END;
+IF x > 15329 THEN x := x - 1 END;
+IF x > 15330 THEN x := x - 1 END;
+IF x > 15331 THEN x := x - 1 END;
+IF x > 15332 THEN x := x - 1 END;
+IF x > 15333 THEN x := x - 1 END;
+IF x > 15334 THEN x := x - 1 END;
+IF x > 15335 THEN x := x - 1 END;
+IF x > 15336 THEN x := x - 1 END;
+IF x > 15337 THEN x := x - 1 END;
+IF x > 15338 THEN x := x - 1 END;
+IF x > 15339 THEN x := x - 1 END;
+IF x > 15340 THEN x := x - 1 END;
+IF x > 15341 THEN x := x - 1 END;
+IF x > 15342 THEN x := x - 1 END;
+IF x > 15343 THEN x := x - 1 END;
+IF x > 15344 THEN x := x - 1 END;
+IF x > 15345 THEN x := x - 1 END;
+IF x > 15346 THEN x := x - 1 END;
+IF x > 15347 THEN x := x - 1 END;
+IF x > 15348 THEN x := x - 1 END;
+IF x > 15349 THEN x := x - 1 END;
+IF x > 15350 THEN x := x - 1 END;
+IF x > 15351 THEN x := x - 1 END;
+IF x > 15352 THEN x := x - 1 END;
+IF x > 15353 THEN x := x - 1 END;
+IF x > 15354 THEN x := x - 1 END;
+IF x > 15355 THEN x := x - 1 END;
+IF x > 15356 THEN x := x - 1 END;
+IF x > 15357 THEN x := x - 1 END;
+IF x > 15358 THEN x := x - 1 END;
+IF x > 15359 THEN x := x - 1 END;
+IF x > 15360 THEN x := x - 1 END;
+IF x > 15361 THEN x := x - 1 END;
+IF x > 15362 THEN x := x - 1 END;
+IF x > 15363 THEN x := x - 1 END;
+IF x > 15364 THEN x := x - 1 END;
+IF x > 15365 THEN x := x - 1 END;
+IF x > 15366 THEN x := x - 1 END;
+IF x > 15367 THEN x := x - 1 END;
+IF x > 15368 THEN x := x - 1 END;
+IF x > 15369 THEN x := x - 1 END;
+IF x > 15370 THEN x := x - 1 END;
+IF x > 15371 THEN x := x - 1 END;
+IF x > 15372 THEN x := x - 1 END;
+IF x > 15373 THEN x := x - 1 END;
+IF x > 15374 THEN x := x - 1 END;
+IF x > 15375 THEN x := x - 1 END;
+IF x > 15376 THEN x := x - 1 END;
+IF x > 15377 THEN x := x - 1 END;
+IF x > 15378 THEN x := x - 1 END;
+IF x > 15379 THEN x := x - 1 END;
+IF x > 15380 THEN x := x - 1 END;
+IF x > 15381 THEN x := x - 1 END;
+IF x > 15382 THEN x := x - 1 END;
+IF x > 15383 THEN x := x - 1 END;
+IF x > 15384 THEN x := x - 1 END;
+IF x > 15385 THEN x := x - 1 END;
+IF x > 15386 THEN x := x - 1 END;
+IF x > 15387 THEN x := x - 1 END;
+IF x > 15388 THEN x := x - 1 END;
+IF x > 15389 THEN x := x - 1 END;
+IF x > 15390 THEN x := x - 1 END;
+IF x > 15391 THEN x := x - 1 END;
+IF x > 15392 THEN x := x - 1 END;
+IF x > 15393 THEN x := x - 1 END;
+IF x > 15394 THEN x := x - 1 END;
+IF x > 15395 THEN x := x - 1 END;
+IF x > 15396 THEN x := x - 1 END;
+IF x > 15397 THEN x := x - 1 END;
+IF x > 15398 THEN x := x - 1 END;
+IF x > 15399 THEN x := x - 1 END;
+IF x > 15400 THEN x := x - 1 END;
+IF x > 15401 THEN x := x - 1 END;
+IF x > 15402 THEN x := x - 1 END;
+IF x > 15403 THEN x := x - 1 END;
+IF x > 15404 THEN x := x - 1 END;
+IF x > 15405 THEN x := x - 1 END;
+IF x > 15406 THEN x := x - 1 END;
+IF x > 15407 THEN x := x - 1 END;
+IF x > 15408 THEN x := x - 1 END;
+IF x > 15409 THEN x := x - 1 END;
+IF x > 15410 THEN x := x - 1 END;
+IF x > 15411 THEN x := x - 1 END;
+IF x > 15412 THEN x := x - 1 END;
+IF x > 15413 THEN x := x - 1 END;
+IF x > 15414 THEN x := x - 1 END;
+IF x > 15415 THEN x := x - 1 END;
+IF x > 15416 THEN x := x - 1 END;
+IF x > 15417 THEN x := x - 1 END;
+IF x > 15418 THEN x := x - 1 END;
+IF x > 15419 THEN x := x - 1 END;
+IF x > 15420 THEN x := x - 1 END;
+IF x > 15421 THEN x := x - 1 END;
+IF x > 15422 THEN x := x - 1 END;
+IF x > 15423 THEN x := x - 1 END;
+IF x > 15424 THEN x := x - 1 END;
+IF x > 15425 THEN x := x - 1 END;
+IF x > 15426 THEN x := x - 1 END;
+IF x > 15427 THEN x := x - 1 END;
+IF x > 15428 THEN x := x - 1 END;
+IF x > 15429 THEN x := x - 1 END;
+IF x > 15430 THEN x := x - 1 END;
+IF x > 15431 THEN x := x - 1 END;
+IF x > 15432 THEN x := x - 1 END;
+IF x > 15433 THEN x := x - 1 END;
+IF x > 15434 THEN x := x - 1 END;
+IF x > 15435 THEN x := x - 1 END;
+IF x > 15436 THEN x := x - 1 END;
+IF x > 15437 THEN x := x - 1 END;
+IF x > 15438 THEN x := x - 1 END;
+IF x > 15439 THEN x := x - 1 END;
+IF x > 15440 THEN x := x - 1 END;
+IF x > 15441 THEN x := x - 1 END;
+IF x > 15442 THEN x := x - 1 END;
+IF x > 15443 THEN x := x - 1 END;
+IF x > 15444 THEN x := x - 1 END;
+IF x > 15445 THEN x := x - 1 END;
+IF x > 15446 THEN x := x - 1 END;
+IF x > 15447 THEN x := x - 1 END;
+IF x > 15448 THEN x := x - 1 END;
+IF x > 15449 THEN x := x - 1 END;
+IF x > 15450 THEN x := x - 1 END;
+IF x > 15451 THEN x := x - 1 END;
+IF x > 15452 THEN x := x - 1 END;
+IF x > 15453 THEN x := x - 1 END;
+IF x > 15454 THEN x := x - 1 END;
+IF x > 15455 THEN x := x - 1 END;
+IF x > 15456 THEN x := x - 1 END;
+IF x > 15457 THEN x := x - 1 END;
+IF x > 15458 THEN x := x - 1 END;
+IF x > 15459 THEN x := x - 1 END;
+IF x > 15460 THEN x := x - 1 END;
+IF x > 15461 THEN x := x - 1 END;
+IF x > 15462 THEN x := x - 1 END;
+IF x > 15463 THEN x := x - 1 END;
+IF x > 15464 THEN x := x - 1 END;
+IF x > 15465 THEN x := x - 1 END;
+IF x > 15466 THEN x := x - 1 END;
+IF x > 15467 THEN x := x - 1 END;
+IF x > 15468 THEN x := x - 1 END;
+IF x > 15469 THEN x := x - 1 END;
+IF x > 15470 THEN x := x - 1 END;
+IF x > 15471 THEN x := x - 1 END;
+IF x > 15472 THEN x := x - 1 END;
+IF x > 15473 THEN x := x - 1 END;
+IF x > 15474 THEN x := x - 1 END;
+IF x > 15475 THEN x := x - 1 END;
+IF x > 15476 THEN x := x - 1 END;
+IF x > 15477 THEN x := x - 1 END;
+IF x > 15478 THEN x := x - 1 END;
+IF x > 15479 THEN x := x - 1 END;
+IF x > 15480 THEN x := x - 1 END;
+IF x > 15481 THEN x := x - 1 END;
+IF x > 15482 THEN x := x - 1 END;
+IF x > 15483 THEN x := x - 1 END;
+IF x > 15484 THEN x := x - 1 END;
+IF x > 15485 THEN x := x - 1 END;
+IF x > 15486 THEN x := x - 1 END;
+IF x > 15487 THEN x := x - 1 END;
+IF x > 15488 THEN x := x - 1 END;
+IF x > 15489 THEN x := x - 1 END;
+IF x > 15490 THEN x := x - 1 END;
+IF x > 15491 THEN x := x - 1 END;
+IF x > 15492 THEN x := x - 1 END;
+IF x > 15493 THEN x := x - 1 END;
+IF x > 15494 THEN x := x - 1 END;
+IF x > 15495 THEN x := x - 1 END;
+IF x > 15496 THEN x := x - 1 END;
+IF x > 15497 THEN x := x - 1 END;
+IF x > 15498 THEN x := x - 1 END;
+IF x > 15499 THEN x := x - 1 END;
+IF x > 15500 THEN x := x - 1 END;
+IF x > 15501 THEN x := x - 1 END;
+IF x > 15502 THEN x := x - 1 END;
+IF x > 15503 THEN x := x - 1 END;
+IF x > 15504 THEN x := x - 1 END;
+IF x > 15505 THEN x := x - 1 END;
+IF x > 15506 THEN x := x - 1 END;
+IF x > 15507 THEN x := x - 1 END;
+IF x > 15508 THEN x := x - 1 END;
+IF x > 15509 THEN x := x - 1 END;
+IF x > 15510 THEN x := x - 1 END;
+IF x > 15511 THEN x := x - 1 END;
+IF x > 15512 THEN x := x - 1 END;
+IF x > 15513 THEN x := x - 1 END;
+IF x > 15514 THEN x := x - 1 END;
+IF x > 15515 THEN x := x - 1 END;
+IF x > 15516 THEN x := x - 1 END;
+IF x > 15517 THEN x := x - 1 END;
+IF x > 15518 THEN x := x - 1 END;
+IF x > 15519 THEN x := x - 1 END;
+IF x > 15520 THEN x := x - 1 END;
+IF x > 15521 THEN x := x - 1 END;
+IF x > 15522 THEN x := x - 1 END;
+IF x > 15523 THEN x := x - 1 END;
+IF x > 15524 THEN x := x - 1 END;
+IF x > 15525 THEN x := x - 1 END;
+IF x > 15526 THEN x := x - 1 END;
+IF x > 15527 THEN x := x - 1 END;
+IF x > 15528 THEN x := x - 1 END;
+IF x > 15529 THEN x := x - 1 END;
+IF x > 15530 THEN x := x - 1 END;
+IF x > 15531 THEN x := x - 1 END;
+IF x > 15532 THEN x := x - 1 END;
+IF x > 15533 THEN x := x - 1 END;
+IF x > 15534 THEN x := x - 1 END;
+IF x > 15535 THEN x := x - 1 END;
+IF x > 15536 THEN x := x - 1 END;
+IF x > 15537 THEN x := x - 1 END;
+IF x > 15538 THEN x := x - 1 END;
+IF x > 15539 THEN x := x - 1 END;
+IF x > 15540 THEN x := x - 1 END;
+IF x > 15541 THEN x := x - 1 END;
+IF x > 15542 THEN x := x - 1 END;
+IF x > 15543 THEN x := x - 1 END;
+IF x > 15544 THEN x := x - 1 END;
+IF x > 15545 THEN x := x - 1 END;
+IF x > 15546 THEN x := x - 1 END;
+IF x > 15547 THEN x := x - 1 END;
+IF x > 15548 THEN x := x - 1 END;
+IF x > 15549 THEN x := x - 1 END;
+IF x > 15550 THEN x := x - 1 END;
+IF x > 15551 THEN x := x - 1 END;
+IF x > 15552 THEN x := x - 1 END;
+IF x > 15553 THEN x := x - 1 END;
+IF x > 15554 THEN x := x - 1 END;
+IF x > 15555 THEN x := x - 1 END;
+IF x > 15556 THEN x := x - 1 END;
+IF x > 15557 THEN x := x - 1 END;
+IF x > 15558 THEN x := x - 1 END;
+IF x > 15559 THEN x := x - 1 END;
+IF x > 15560 THEN x := x - 1 END;
+IF x > 15561 THEN x := x - 1 END;
+IF x > 15562 THEN x := x - 1 END;
+IF x > 15563 THEN x := x - 1 END;
+IF x > 15564 THEN x := x - 1 END;
+IF x > 15565 THEN x := x - 1 END;
+IF x > 15566 THEN x := x - 1 END;
+IF x > 15567 THEN x := x - 1 END;
+IF x > 15568 THEN x := x - 1 END;
+IF x > 15569 THEN x := x - 1 END;
+IF x > 15570 THEN x := x - 1 END;
+IF x > 15571 THEN x := x - 1 END;
+IF x > 15572 THEN x := x - 1 END;
+IF x > 15573 THEN x := x - 1 END;
+IF x > 15574 THEN x := x - 1 END;
+IF x > 15575 THEN x := x - 1 END;
+IF x > 15576 THEN x := x - 1 END;
+IF x > 15577 THEN x := x - 1 END;
+IF x > 15578 THEN x := x - 1 END;
+IF x > 15579 THEN x := x - 1 END;
+IF x > 15580 THEN x := x - 1 END;
+IF x > 15581 THEN x := x - 1 END;
+IF x > 15582 THEN x := x - 1 END;
+IF x > 15583 THEN x := x - 1 END;
+IF x > 15584 THEN x := x - 1 END;
+IF x > 15585 THEN x := x - 1 END;
+IF x > 15586 THEN x := x - 1 END;
+IF x > 15587 THEN x := x - 1 END;
+IF x > 15588 THEN x := x - 1 END;
+IF x > 15589 THEN x := x - 1 END;
+IF x > 15590 THEN x := x - 1 END;
+IF x > 15591 THEN x := x - 1 END;
+IF x > 15592 THEN x := x - 1 END;
+IF x > 15593 THEN x := x - 1 END;
+IF x > 15594 THEN x := x - 1 END;
+IF x > 15595 THEN x := x - 1 END;
+IF x > 15596 THEN x := x - 1 END;
+IF x > 15597 THEN x := x - 1 END;
+IF x > 15598 THEN x := x - 1 END;
+IF x > 15599 THEN x := x - 1 END;
+IF x > 15600 THEN x := x - 1 END;
+IF x > 15601 THEN x := x - 1 END;
+IF x > 15602 THEN x := x - 1 END;
+IF x > 15603 THEN x := x - 1 END;
+IF x > 15604 THEN x := x - 1 END;
+IF x > 15605 THEN x := x - 1 END;
+IF x > 15606 THEN x := x - 1 END;
+IF x > 15607 THEN x := x - 1 END;
+IF x > 15608 THEN x := x - 1 END;
+IF x > 15609 THEN x := x - 1 END;
+IF x > 15610 THEN x := x - 1 END;
+IF x > 15611 THEN x := x - 1 END;
+IF x > 15612 THEN x := x - 1 END;
+IF x > 15613 THEN x := x - 1 END;
+IF x > 15614 THEN x := x - 1 END;
+IF x > 15615 THEN x := x - 1 END;
+IF x > 15616 THEN x := x - 1 END;
+IF x > 15617 THEN x := x - 1 END;
+IF x > 15618 THEN x := x - 1 END;
+IF x > 15619 THEN x := x - 1 END;
+IF x > 15620 THEN x := x - 1 END;
+IF x > 15621 THEN x := x - 1 END;
+IF x > 15622 THEN x := x - 1 END;
+IF x > 15623 THEN x := x - 1 END;
+IF x > 15624 THEN x := x - 1 END;
+IF x > 15625 THEN x := x - 1 END;
+IF x > 15626 THEN x := x - 1 END;
+IF x > 15627 THEN x := x - 1 END;
+IF x > 15628 THEN x := x - 1 END;
+IF x > 15629 THEN x := x - 1 END;
+IF x > 15630 THEN x := x - 1 END;
+IF x > 15631 THEN x := x - 1 END;
+IF x > 15632 THEN x := x - 1 END;
+IF x > 15633 THEN x := x - 1 END;
+IF x > 15634 THEN x := x - 1 END;
+IF x > 15635 THEN x := x - 1 END;
+IF x > 15636 THEN x := x - 1 END;
+IF x > 15637 THEN x := x - 1 END;
+IF x > 15638 THEN x := x - 1 END;
+IF x > 15639 THEN x := x - 1 END;
+IF x > 15640 THEN x := x - 1 END;
+IF x > 15641 THEN x := x - 1 END;
+IF x > 15642 THEN x := x - 1 END;
+IF x > 15643 THEN x := x - 1 END;
+IF x > 15644 THEN x := x - 1 END;
+IF x > 15645 THEN x := x - 1 END;
+IF x > 15646 THEN x := x - 1 END;
+IF x > 15647 THEN x := x - 1 END;
+IF x > 15648 THEN x := x - 1 END;
+IF x > 15649 THEN x := x - 1 END;
+IF x > 15650 THEN x := x - 1 END;
+IF x > 15651 THEN x := x - 1 END;
+IF x > 15652 THEN x := x - 1 END;
+IF x > 15653 THEN x := x - 1 END;
+IF x > 15654 THEN x := x - 1 END;
+IF x > 15655 THEN x := x - 1 END;
+IF x > 15656 THEN x := x - 1 END;
+IF x > 15657 THEN x := x - 1 END;
+IF x > 15658 THEN x := x - 1 END;
+IF x > 15659 THEN x := x - 1 END;
+IF x > 15660 THEN x := x - 1 END;
+IF x > 15661 THEN x := x - 1 END;
+IF x > 15662 THEN x := x - 1 END;
+IF x > 15663 THEN x := x - 1 END;
+IF x > 15664 THEN x := x - 1 END;
+IF x > 15665 THEN x := x - 1 END;
+IF x > 15666 THEN x := x - 1 END;
+IF x > 15667 THEN x := x - 1 END;
+IF x > 15668 THEN x := x - 1 END;
+IF x > 15669 THEN x := x - 1 END;
+IF x > 15670 THEN x := x - 1 END;
+IF x > 15671 THEN x := x - 1 END;
+IF x > 15672 THEN x := x - 1 END;
+IF x > 15673 THEN x := x - 1 END;
+IF x > 15674 THEN x := x - 1 END;
+IF x > 15675 THEN x := x - 1 END;
+IF x > 15676 THEN x := x - 1 END;
+IF x > 15677 THEN x := x - 1 END;
+IF x > 15678 THEN x := x - 1 END;
+IF x > 15679 THEN x := x - 1 END;
+IF x > 15680 THEN x := x - 1 END;
+IF x > 15681 THEN x := x - 1 END;
+IF x > 15682 THEN x := x - 1 END;
+IF x > 15683 THEN x := x - 1 END;
+IF x > 15684 THEN x := x - 1 END;
+IF x > 15685 THEN x := x - 1 END;
+IF x > 15686 THEN x := x - 1 END;
+IF x > 15687 THEN x := x - 1 END;
+IF x > 15688 THEN x := x - 1 END;
+IF x > 15689 THEN x := x - 1 END;
+IF x > 15690 THEN x := x - 1 END;
+IF x > 15691 THEN x := x - 1 END;
+IF x > 15692 THEN x := x - 1 END;
+IF x > 15693 THEN x := x - 1 END;
+IF x > 15694 THEN x := x - 1 END;
+IF x > 15695 THEN x := x - 1 END;
+IF x > 15696 THEN x := x - 1 END;
+IF x > 15697 THEN x := x - 1 END;
+IF x > 15698 THEN x := x - 1 END;
+IF x > 15699 THEN x := x - 1 END;
+IF x > 15700 THEN x := x - 1 END;
+IF x > 15701 THEN x := x - 1 END;
+IF x > 15702 THEN x := x - 1 END;
+IF x > 15703 THEN x := x - 1 END;
+IF x > 15704 THEN x := x - 1 END;
+IF x > 15705 THEN x := x - 1 END;
+IF x > 15706 THEN x := x - 1 END;
+IF x > 15707 THEN x := x - 1 END;
+IF x > 15708 THEN x := x - 1 END;
+IF x > 15709 THEN x := x - 1 END;
+IF x > 15710 THEN x := x - 1 END;
+IF x > 15711 THEN x := x - 1 END;
+IF x > 15712 THEN x := x - 1 END;
+IF x > 15713 THEN x := x - 1 END;
+IF x > 15714 THEN x := x - 1 END;
+IF x > 15715 THEN x := x - 1 END;
+IF x > 15716 THEN x := x - 1 END;
+IF x > 15717 THEN x := x - 1 END;
+IF x > 15718 THEN x := x - 1 END;
+IF x > 15719 THEN x := x - 1 END;
+IF x > 15720 THEN x := x - 1 END;
+IF x > 15721 THEN x := x - 1 END;
+IF x > 15722 THEN x := x - 1 END;
+IF x > 15723 THEN x := x - 1 END;
+IF x > 15724 THEN x := x - 1 END;
+IF x > 15725 THEN x := x - 1 END;
+IF x > 15726 THEN x := x - 1 END;
+IF x > 15727 THEN x := x - 1 END;
+IF x > 15728 THEN x := x - 1 END;
+IF x > 15729 THEN x := x - 1 END;
+IF x > 15730 THEN x := x - 1 END;
+IF x > 15731 THEN x := x - 1 END;
+IF x > 15732 THEN x := x - 1 END;
+IF x > 15733 THEN x := x - 1 END;
+IF x > 15734 THEN x := x - 1 END;
+IF x > 15735 THEN x := x - 1 END;
+IF x > 15736 THEN x := x - 1 END;
+IF x > 15737 THEN x := x - 1 END;
+IF x > 15738 THEN x := x - 1 END;
+IF x > 15739 THEN x := x - 1 END;
+IF x > 15740 THEN x := x - 1 END;
+IF x > 15741 THEN x := x - 1 END;
+IF x > 15742 THEN x := x - 1 END;
+IF x > 15743 THEN x := x - 1 END;
+IF x > 15744 THEN x := x - 1 END;
+IF x > 15745 THEN x := x - 1 END;
+IF x > 15746 THEN x := x - 1 END;
+IF x > 15747 THEN x := x - 1 END;
+IF x > 15748 THEN x := x - 1 END;
+IF x > 15749 THEN x := x - 1 END;
+IF x > 15750 THEN x := x - 1 END;
+IF x > 15751 THEN x := x - 1 END;
+IF x > 15752 THEN x := x - 1 END;
+IF x > 15753 THEN x := x - 1 END;
+IF x > 15754 THEN x := x - 1 END;
+IF x > 15755 THEN x := x - 1 END;
+IF x > 15756 THEN x := x - 1 END;
+IF x > 15757 THEN x := x - 1 END;
+IF x > 15758 THEN x := x - 1 END;
+IF x > 15759 THEN x := x - 1 END;
+IF x > 15760 THEN x := x - 1 END;
+IF x > 15761 THEN x := x - 1 END;
+IF x > 15762 THEN x := x - 1 END;
+IF x > 15763 THEN x := x - 1 END;
+IF x > 15764 THEN x := x - 1 END;
+IF x > 15765 THEN x := x - 1 END;
+IF x > 15766 THEN x := x - 1 END;
+IF x > 15767 THEN x := x - 1 END;
+IF x > 15768 THEN x := x - 1 END;
+IF x > 15769 THEN x := x - 1 END;
+IF x > 15770 THEN x := x - 1 END;
+IF x > 15771 THEN x := x - 1 END;
+IF x > 15772 THEN x := x - 1 END;
+IF x > 15773 THEN x := x - 1 END;
+IF x > 15774 THEN x := x - 1 END;
+IF x > 15775 THEN x := x - 1 END;
+IF x > 15776 THEN x := x - 1 END;
+IF x > 15777 THEN x := x - 1 END;
+IF x > 15778 THEN x := x - 1 END;
+IF x > 15779 THEN x := x - 1 END;
+IF x > 15780 THEN x := x - 1 END;
+IF x > 15781 THEN x := x - 1 END;
+IF x > 15782 THEN x := x - 1 END;
+IF x > 15783 THEN x := x - 1 END;
+IF x > 15784 THEN x := x - 1 END;
+IF x > 15785 THEN x := x - 1 END;
+IF x > 15786 THEN x := x - 1 END;
+IF x > 15787 THEN x := x - 1 END;
+IF x > 15788 THEN x := x - 1 END;
+IF x > 15789 THEN x := x - 1 END;
+IF x > 15790 THEN x := x - 1 END;
+IF x > 15791 THEN x := x - 1 END;
+IF x > 15792 THEN x := x - 1 END;
+IF x > 15793 THEN x := x - 1 END;
+IF x > 15794 THEN x := x - 1 END;
+IF x > 15795 THEN x := x - 1 END;
+IF x > 15796 THEN x := x - 1 END;
+IF x > 15797 THEN x := x - 1 END;
+IF x > 15798 THEN x := x - 1 END;
+IF x > 15799 THEN x := x - 1 END;
+IF x > 15800 THEN x := x - 1 END;
+IF x > 15801 THEN x := x - 1 END;
+IF x > 15802 THEN x := x - 1 END;
+IF x > 15803 THEN x := x - 1 END;
+IF x > 15804 THEN x := x - 1 END;
+IF x > 15805 THEN x := x - 1 END;
+IF x > 15806 THEN x := x - 1 END;
+IF x > 15807 THEN x := x - 1 END;
+IF x > 15808 THEN x := x - 1 END;
+IF x > 15809 THEN x := x - 1 END;
+IF x > 15810 THEN x := x - 1 END;
+IF x > 15811 THEN x := x - 1 END;
+IF x > 15812 THEN x := x - 1 END;
+IF x > 15813 THEN x := x - 1 END;
+IF x > 15814 THEN x := x - 1 END;
+IF x > 15815 THEN x := x - 1 END;
+IF x > 15816 THEN x := x - 1 END;
+IF x > 15817 THEN x := x - 1 END;
+IF x > 15818 THEN x := x - 1 END;
+IF x > 15819 THEN x := x - 1 END;
+IF x > 15820 THEN x := x - 1 END;
+IF x > 15821 THEN x := x - 1 END;
+IF x > 15822 THEN x := x - 1 END;
+IF x > 15823 THEN x := x - 1 END;
+IF x > 15824 THEN x := x - 1 END;
+IF x > 15825 THEN x := x - 1 END;
+IF x > 15826 THEN x := x - 1 END;
+IF x > 15827 THEN x := x - 1 END;
+IF x > 15828 THEN x := x - 1 END;
+IF x > 15829 THEN x := x - 1 END;
+IF x > 15830 THEN x := x - 1 END;
+IF x > 15831 THEN x := x - 1 END;
+IF x > 15832 THEN x := x - 1 END;
+IF x > 15833 THEN x := x - 1 END;
+IF x > 15834 THEN x := x - 1 END;
+IF x > 15835 THEN x := x - 1 END;
+IF x > 15836 THEN x := x - 1 END;
+IF x > 15837 THEN x := x - 1 END;
+IF x > 15838 THEN x := x - 1 END;
+IF x > 15839 THEN x := x - 1 END;
+IF x > 15840 THEN x := x - 1 END;
+IF x > 15841 THEN x := x - 1 END;
+IF x > 15842 THEN x := x - 1 END;
+IF x > 15843 THEN x := x - 1 END;
+IF x > 15844 THEN x := x - 1 END;
+IF x > 15845 THEN x := x - 1 END;
+IF x > 15846 THEN x := x - 1 END;
+IF x > 15847 THEN x := x - 1 END;
+IF x > 15848 THEN x := x - 1 END;
+IF x > 15849 THEN x := x - 1 END;
+IF x > 15850 THEN x := x - 1 END;
+IF x > 15851 THEN x := x - 1 END;
+IF x > 15852 THEN x := x - 1 END;
+IF x > 15853 THEN x := x - 1 END;
+IF x > 15854 THEN x := x - 1 END;
+IF x > 15855 THEN x := x - 1 END;
+IF x > 15856 THEN x := x - 1 END;
+IF x > 15857 THEN x := x - 1 END;
+IF x > 15858 THEN x := x - 1 END;
+IF x > 15859 THEN x := x - 1 END;
+IF x > 15860 THEN x := x - 1 END;
+IF x > 15861 THEN x := x - 1 END;
+IF x > 15862 THEN x := x - 1 END;
+IF x > 15863 THEN x := x - 1 END;
+IF x > 15864 THEN x := x - 1 END;
+IF x > 15865 THEN x := x - 1 END;
+IF x > 15866 THEN x := x - 1 END;
+IF x > 15867 THEN x := x - 1 END;
+IF x > 15868 THEN x := x - 1 END;
+IF x > 15869 THEN x := x - 1 END;
+IF x > 15870 THEN x := x - 1 END;
+IF x > 15871 THEN x := x - 1 END;
+IF x > 15872 THEN x := x - 1 END;
+IF x > 15873 THEN x := x - 1 END;
+IF x > 15874 THEN x := x - 1 END;
+IF x > 15875 THEN x := x - 1 END;
+IF x > 15876 THEN x := x - 1 END;
+IF x > 15877 THEN x := x - 1 END;
+IF x > 15878 THEN x := x - 1 END;
+IF x > 15879 THEN x := x - 1 END;
+IF x > 15880 THEN x := x - 1 END;
+IF x > 15881 THEN x := x - 1 END;
+IF x > 15882 THEN x := x - 1 END;
+IF x > 15883 THEN x := x - 1 END;
+IF x > 15884 THEN x := x - 1 END;
+IF x > 15885 THEN x := x - 1 END;
+IF x > 15886 THEN x := x - 1 END;
+IF x > 15887 THEN x := x - 1 END;
+IF x > 15888 THEN x := x - 1 END;
+IF x > 15889 THEN x := x - 1 END;
+IF x > 15890 THEN x := x - 1 END;
+IF x > 15891 THEN x := x - 1 END;
+IF x > 15892 THEN x := x - 1 END;
+IF x > 15893 THEN x := x - 1 END;
+IF x > 15894 THEN x := x - 1 END;
+IF x > 15895 THEN x := x - 1 END;
+IF x > 15896 THEN x := x - 1 END;
+IF x > 15897 THEN x := x - 1 END;
+IF x > 15898 THEN x := x - 1 END;
+IF x > 15899 THEN x := x - 1 END;
+IF x > 15900 THEN x := x - 1 END;
+IF x > 15901 THEN x := x - 1 END;
+IF x > 15902 THEN x := x - 1 END;
+IF x > 15903 THEN x := x - 1 END;
+IF x > 15904 THEN x := x - 1 END;
+IF x > 15905 THEN x := x - 1 END;
+IF x > 15906 THEN x := x - 1 END;
+IF x > 15907 THEN x := x - 1 END;
+IF x > 15908 THEN x := x - 1 END;
+IF x > 15909 THEN x := x - 1 END;
+IF x > 15910 THEN x := x - 1 END;
+IF x > 15911 THEN x := x - 1 END;
+IF x > 15912 THEN x := x - 1 END;
+IF x > 15913 THEN x := x - 1 END;
+IF x > 15914 THEN x := x - 1 END;
+IF x > 15915 THEN x := x - 1 END;
+IF x > 15916 THEN x := x - 1 END;
+IF x > 15917 THEN x := x - 1 END;
+IF x > 15918 THEN x := x - 1 END;
+IF x > 15919 THEN x := x - 1 END;
+IF x > 15920 THEN x := x - 1 END;
+IF x > 15921 THEN x := x - 1 END;
+IF x > 15922 THEN x := x - 1 END;
+IF x > 15923 THEN x := x - 1 END;
+IF x > 15924 THEN x := x - 1 END;
+IF x > 15925 THEN x := x - 1 END;
+IF x > 15926 THEN x := x - 1 END;
+IF x > 15927 THEN x := x - 1 END;
+IF x > 15928 THEN x := x - 1 END;
+IF x > 15929 THEN x := x - 1 END;
+IF x > 15930 THEN x := x - 1 END;
+IF x > 15931 THEN x := x - 1 END;
+IF x > 15932 THEN x := x - 1 END;
+IF x > 15933 THEN x := x - 1 END;
+IF x > 15934 THEN x := x - 1 END;
+IF x > 15935 THEN x := x - 1 END;
+IF x > 15936 THEN x := x - 1 END;
+IF x > 15937 THEN x := x - 1 END;
+IF x > 15938 THEN x := x - 1 END;
+IF x > 15939 THEN x := x - 1 END;
+IF x > 15940 THEN x := x - 1 END;
+IF x > 15941 THEN x := x - 1 END;
+IF x > 15942 THEN x := x - 1 END;
+IF x > 15943 THEN x := x - 1 END;
+IF x > 15944 THEN x := x - 1 END;
+IF x > 15945 THEN x := x - 1 END;
+IF x > 15946 THEN x := x - 1 END;
+IF x > 15947 THEN x := x - 1 END;
+IF x > 15948 THEN x := x - 1 END;
+IF x > 15949 THEN x := x - 1 END;
+IF x > 15950 THEN x := x - 1 END;
+IF x > 15951 THEN x := x - 1 END;
+IF x > 15952 THEN x := x - 1 END;
+IF x > 15953 THEN x := x - 1 END;
+IF x > 15954 THEN x := x - 1 END;
+IF x > 15955 THEN x := x - 1 END;
+IF x > 15956 THEN x := x - 1 END;
+IF x > 15957 THEN x := x - 1 END;
+IF x > 15958 THEN x := x - 1 END;
+IF x > 15959 THEN x := x - 1 END;
+IF x > 15960 THEN x := x - 1 END;
+IF x > 15961 THEN x := x - 1 END;
+IF x > 15962 THEN x := x - 1 END;
+IF x > 15963 THEN x := x - 1 END;
+IF x > 15964 THEN x := x - 1 END;
+IF x > 15965 THEN x := x - 1 END;
+IF x > 15966 THEN x := x - 1 END;
+IF x > 15967 THEN x := x - 1 END;
+IF x > 15968 THEN x := x - 1 END;
+IF x > 15969 THEN x := x - 1 END;
+IF x > 15970 THEN x := x - 1 END;
+IF x > 15971 THEN x := x - 1 END;
+IF x > 15972 THEN x := x - 1 END;
+IF x > 15973 THEN x := x - 1 END;
+IF x > 15974 THEN x := x - 1 END;
+IF x > 15975 THEN x := x - 1 END;
+IF x > 15976 THEN x := x - 1 END;
+IF x > 15977 THEN x := x - 1 END;
+IF x > 15978 THEN x := x - 1 END;
+IF x > 15979 THEN x := x - 1 END;
+IF x > 15980 THEN x := x - 1 END;
+IF x > 15981 THEN x := x - 1 END;
+IF x > 15982 THEN x := x - 1 END;
+IF x > 15983 THEN x := x - 1 END;
+IF x > 15984 THEN x := x - 1 END;
+IF x > 15985 THEN x := x - 1 END;
+IF x > 15986 THEN x := x - 1 END;
+IF x > 15987 THEN x := x - 1 END;
+IF x > 15988 THEN x := x - 1 END;
+IF x > 15989 THEN x := x - 1 END;
+IF x > 15990 THEN x := x - 1 END;
+IF x > 15991 THEN x := x - 1 END;
+IF x > 15992 THEN x := x - 1 END;
+IF x > 15993 THEN x := x - 1 END;
+IF x > 15994 THEN x := x - 1 END;
+IF x > 15995 THEN x := x - 1 END;
+IF x > 15996 THEN x := x - 1 END;
+IF x > 15997 THEN x := x - 1 END;
+IF x > 15998 THEN x := x - 1 END;
+IF x > 15999 THEN x := x - 1 END;
+IF x > 16000 THEN x := x - 1 END;
+IF x > 16001 THEN x := x - 1 END;
+IF x > 16002 THEN x := x - 1 END;
+IF x > 16003 THEN x := x - 1 END;
+IF x > 16004 THEN x := x - 1 END;
+IF x > 16005 THEN x := x - 1 END;
+IF x > 16006 THEN x := x - 1 END;
+IF x > 16007 THEN x := x - 1 END;
+IF x > 16008 THEN x := x - 1 END;
+IF x > 16009 THEN x := x - 1 END;
+IF x > 16010 THEN x := x - 1 END;
+IF x > 16011 THEN x := x - 1 END;
+IF x > 16012 THEN x := x - 1 END;
+IF x > 16013 THEN x := x - 1 END;
+IF x > 16014 THEN x := x - 1 END;
+IF x > 16015 THEN x := x - 1 END;
+IF x > 16016 THEN x := x - 1 END;
+IF x > 16017 THEN x := x - 1 END;
+IF x > 16018 THEN x := x - 1 END;
+IF x > 16019 THEN x := x - 1 END;
+IF x > 16020 THEN x := x - 1 END;
+IF x > 16021 THEN x := x - 1 END;
+IF x > 16022 THEN x := x - 1 END;
+IF x > 16023 THEN x := x - 1 END;
+IF x > 16024 THEN x := x - 1 END;
+IF x > 16025 THEN x := x - 1 END;
+IF x > 16026 THEN x := x - 1 END;
+IF x > 16027 THEN x := x - 1 END;
+IF x > 16028 THEN x := x - 1 END;
+IF x > 16029 THEN x := x - 1 END;
+IF x > 16030 THEN x := x - 1 END;
+IF x > 16031 THEN x := x - 1 END;
+IF x > 16032 THEN x := x - 1 END;
+IF x > 16033 THEN x := x - 1 END;
+IF x > 16034 THEN x := x - 1 END;
+IF x > 16035 THEN x := x - 1 END;
+IF x > 16036 THEN x := x - 1 END;
+IF x > 16037 THEN x := x - 1 END;
+IF x > 16038 THEN x := x - 1 END;
+IF x > 16039 THEN x := x - 1 END;
+IF x > 16040 THEN x := x - 1 END;
+IF x > 16041 THEN x := x - 1 END;
+IF x > 16042 THEN x := x - 1 END;
+IF x > 16043 THEN x := x - 1 END;
+IF x > 16044 THEN x := x - 1 END;
+IF x > 16045 THEN x := x - 1 END;
+IF x > 16046 THEN x := x - 1 END;
+IF x > 16047 THEN x := x - 1 END;
+IF x > 16048 THEN x := x - 1 END;
+IF x > 16049 THEN x := x - 1 END;
+IF x > 16050 THEN x := x - 1 END;
+IF x > 16051 THEN x := x - 1 END;
+IF x > 16052 THEN x := x - 1 END;
+IF x > 16053 THEN x := x - 1 END;
+IF x > 16054 THEN x := x - 1 END;
+IF x > 16055 THEN x := x - 1 END;
+IF x > 16056 THEN x := x - 1 END;
+IF x > 16057 THEN x := x - 1 END;
+IF x > 16058 THEN x := x - 1 END;
+IF x > 16059 THEN x := x - 1 END;
+IF x > 16060 THEN x := x - 1 END;
+IF x > 16061 THEN x := x - 1 END;
+IF x > 16062 THEN x := x - 1 END;
+IF x > 16063 THEN x := x - 1 END;
+IF x > 16064 THEN x := x - 1 END;
+IF x > 16065 THEN x := x - 1 END;
+IF x > 16066 THEN x := x - 1 END;
+IF x > 16067 THEN x := x - 1 END;
+IF x > 16068 THEN x := x - 1 END;
+IF x > 16069 THEN x := x - 1 END;
+IF x > 16070 THEN x := x - 1 END;
+IF x > 16071 THEN x := x - 1 END;
+IF x > 16072 THEN x := x - 1 END;
+IF x > 16073 THEN x := x - 1 END;
+IF x > 16074 THEN x := x - 1 END;
+IF x > 16075 THEN x := x - 1 END;
+IF x > 16076 THEN x := x - 1 END;
+IF x > 16077 THEN x := x - 1 END;
+IF x > 16078 THEN x := x - 1 END;
+IF x > 16079 THEN x := x - 1 END;
+IF x > 16080 THEN x := x - 1 END;
+IF x > 16081 THEN x := x - 1 END;
+IF x > 16082 THEN x := x - 1 END;
+IF x > 16083 THEN x := x - 1 END;
+IF x > 16084 THEN x := x - 1 END;
+IF x > 16085 THEN x := x - 1 END;
+IF x > 16086 THEN x := x - 1 END;
+IF x > 16087 THEN x := x - 1 END;
+IF x > 16088 THEN x := x - 1 END;
+IF x > 16089 THEN x := x - 1 END;
+IF x > 16090 THEN x := x - 1 END;
+IF x > 16091 THEN x := x - 1 END;
+IF x > 16092 THEN x := x - 1 END;
+IF x > 16093 THEN x := x - 1 END;
+IF x > 16094 THEN x := x - 1 END;
+IF x > 16095 THEN x := x - 1 END;
+IF x > 16096 THEN x := x - 1 END;
+IF x > 16097 THEN x := x - 1 END;
+IF x > 16098 THEN x := x - 1 END;
+IF x > 16099 THEN x := x - 1 END;
+IF x > 16100 THEN x := x - 1 END;
+IF x > 16101 THEN x := x - 1 END;
+IF x > 16102 THEN x := x - 1 END;
+IF x > 16103 THEN x := x - 1 END;
+IF x > 16104 THEN x := x - 1 END;
+IF x > 16105 THEN x := x - 1 END;
+IF x > 16106 THEN x := x - 1 END;
+IF x > 16107 THEN x := x - 1 END;
+IF x > 16108 THEN x := x - 1 END;
+IF x > 16109 THEN x := x - 1 END;
+IF x > 16110 THEN x := x - 1 END;
+IF x > 16111 THEN x := x - 1 END;
+IF x > 16112 THEN x := x - 1 END;
+IF x > 16113 THEN x := x - 1 END;
+IF x > 16114 THEN x := x - 1 END;
+IF x > 16115 THEN x := x - 1 END;
+IF x > 16116 THEN x := x - 1 END;
+IF x > 16117 THEN x := x - 1 END;
+IF x > 16118 THEN x := x - 1 END;
+IF x > 16119 THEN x := x - 1 END;
+IF x > 16120 THEN x := x - 1 END;
+IF x > 16121 THEN x := x - 1 END;
+IF x > 16122 THEN x := x - 1 END;
+IF x > 16123 THEN x := x - 1 END;
+IF x > 16124 THEN x := x - 1 END;
+IF x > 16125 THEN x := x - 1 END;
+IF x > 16126 THEN x := x - 1 END;
+IF x > 16127 THEN x := x - 1 END;
+IF x > 16128 THEN x := x - 1 END;
+IF x > 16129 THEN x := x - 1 END;
+IF x > 16130 THEN x := x - 1 END;
+IF x > 16131 THEN x := x - 1 END;
+IF x > 16132 THEN x := x - 1 END;
+IF x > 16133 THEN x := x - 1 END;
+IF x > 16134 THEN x := x - 1 END;
+IF x > 16135 THEN x := x - 1 END;
+IF x > 16136 THEN x := x - 1 END;
+IF x > 16137 THEN x := x - 1 END;
+IF x > 16138 THEN x := x - 1 END;
+IF x > 16139 THEN x := x - 1 END;
+IF x > 16140 THEN x := x - 1 END;
+IF x > 16141 THEN x := x - 1 END;
+IF x > 16142 THEN x := x - 1 END;
+IF x > 16143 THEN x := x - 1 END;
+IF x > 16144 THEN x := x - 1 END;
+IF x > 16145 THEN x := x - 1 END;
+IF x > 16146 THEN x := x - 1 END;
+IF x > 16147 THEN x := x - 1 END;
+IF x > 16148 THEN x := x - 1 END;
+IF x > 16149 THEN x := x - 1 END;
+IF x > 16150 THEN x := x - 1 END;
+IF x > 16151 THEN x := x - 1 END;
+IF x > 16152 THEN x := x - 1 END;
+IF x > 16153 THEN x := x - 1 END;
+IF x > 16154 THEN x := x - 1 END;
+IF x > 16155 THEN x := x - 1 END;
+IF x > 16156 THEN x := x - 1 END;
+IF x > 16157 THEN x := x - 1 END;
+IF x > 16158 THEN x := x - 1 END;
+IF x > 16159 THEN x := x - 1 END;
+IF x > 16160 THEN x := x - 1 END;
+IF x > 16161 THEN x := x - 1 END;
+IF x > 16162 THEN x := x - 1 END;
+IF x > 16163 THEN x := x - 1 END;
+IF x > 16164 THEN x := x - 1 END;
+IF x > 16165 THEN x := x - 1 END;
+IF x > 16166 THEN x := x - 1 END;
+IF x > 16167 THEN x := x - 1 END;
+IF x > 16168 THEN x := x - 1 END;
+IF x > 16169 THEN x := x - 1 END;
+IF x > 16170 THEN x := x - 1 END;
+IF x > 16171 THEN x := x - 1 END;
+IF x > 16172 THEN x := x - 1 END;
+IF x > 16173 THEN x := x - 1 END;
+IF x > 16174 THEN x := x - 1 END;
+IF x > 16175 THEN x := x - 1 END;
+IF x > 16176 THEN x := x - 1 END;
+IF x > 16177 THEN x := x - 1 END;
+IF x > 16178 THEN x := x - 1 END;
+IF x > 16179 THEN x := x - 1 END;
+IF x > 16180 THEN x := x - 1 END;
+IF x > 16181 THEN x := x - 1 END;
+IF x > 16182 THEN x := x - 1 END;
+IF x > 16183 THEN x := x - 1 END;
+IF x > 16184 THEN x := x - 1 END;
+IF x > 16185 THEN x := x - 1 END;
+IF x > 16186 THEN x := x - 1 END;
+IF x > 16187 THEN x := x - 1 END;
+IF x > 16188 THEN x := x - 1 END;
+IF x > 16189 THEN x := x - 1 END;
+IF x > 16190 THEN x := x - 1 END;
+IF x > 16191 THEN x := x - 1 END;
+IF x > 16192 THEN x := x - 1 END;
+IF x > 16193 THEN x := x - 1 END;
+IF x > 16194 THEN x := x - 1 END;
+IF x > 16195 THEN x := x - 1 END;
+IF x > 16196 THEN x := x - 1 END;
+IF x > 16197 THEN x := x - 1 END;
+IF x > 16198 THEN x := x - 1 END;
+IF x > 16199 THEN x := x - 1 END;
+IF x > 16200 THEN x := x - 1 END;
+IF x > 16201 THEN x := x - 1 END;
+IF x > 16202 THEN x := x - 1 END;
+IF x > 16203 THEN x := x - 1 END;
+IF x > 16204 THEN x := x - 1 END;
+IF x > 16205 THEN x := x - 1 END;
+IF x > 16206 THEN x := x - 1 END;
+IF x > 16207 THEN x := x - 1 END;
+IF x > 16208 THEN x := x - 1 END;
+IF x > 16209 THEN x := x - 1 END;
+IF x > 16210 THEN x := x - 1 END;
+IF x > 16211 THEN x := x - 1 END;
+IF x > 16212 THEN x := x - 1 END;
+IF x > 16213 THEN x := x - 1 END;
+IF x > 16214 THEN x := x - 1 END;
+IF x > 16215 THEN x := x - 1 END;
+IF x > 16216 THEN x := x - 1 END;
+IF x > 16217 THEN x := x - 1 END;
+IF x > 16218 THEN x := x - 1 END;
+IF x > 16219 THEN x := x - 1 END;
+IF x > 16220 THEN x := x - 1 END;
+IF x > 16221 THEN x := x - 1 END;
+IF x > 16222 THEN x := x - 1 END;
+IF x > 16223 THEN x := x - 1 END;
+IF x > 16224 THEN x := x - 1 END;
+IF x > 16225 THEN x := x - 1 END;
+IF x > 16226 THEN x := x - 1 END;
+IF x > 16227 THEN x := x - 1 END;
+IF x > 16228 THEN x := x - 1 END;
+IF x > 16229 THEN x := x - 1 END;
+IF x > 16230 THEN x := x - 1 END;
+IF x > 16231 THEN x := x - 1 END;
+IF x > 16232 THEN x := x - 1 END;
+IF x > 16233 THEN x := x - 1 END;
+IF x > 16234 THEN x := x - 1 END;
+IF x > 16235 THEN x := x - 1 END;
+IF x > 16236 THEN x := x - 1 END;
+IF x > 16237 THEN x := x - 1 END;
+IF x > 16238 THEN x := x - 1 END;
+IF x > 16239 THEN x := x - 1 END;
+IF x > 16240 THEN x := x - 1 END;
+IF x > 16241 THEN x := x - 1 END;
+IF x > 16242 THEN x := x - 1 END;
+IF x > 16243 THEN x := x - 1 END;
+IF x > 16244 THEN x := x - 1 END;
+IF x > 16245 THEN x := x - 1 END;
+IF x > 16246 THEN x := x - 1 END;
+IF x > 16247 THEN x := x - 1 END;
+IF x > 16248 THEN x := x - 1 END;
+IF x > 16249 THEN x := x - 1 END;
+IF x > 16250 THEN x := x - 1 END;
+IF x > 16251 THEN x := x - 1 END;
+IF x > 16252 THEN x := x - 1 END;
+IF x > 16253 THEN x := x - 1 END;
+IF x > 16254 THEN x := x - 1 END;
+IF x > 16255 THEN x := x - 1 END;
+IF x > 16256 THEN x := x - 1 END;
+IF x > 16257 THEN x := x - 1 END;
+IF x > 16258 THEN x := x - 1 END;
+IF x > 16259 THEN x := x - 1 END;
+IF x > 16260 THEN x := x - 1 END;
+IF x > 16261 THEN x := x - 1 END;
+IF x > 16262 THEN x := x - 1 END;
+IF x > 16263 THEN x := x - 1 END;
+IF x > 16264 THEN x := x - 1 END;
+IF x > 16265 THEN x := x - 1 END;
+IF x > 16266 THEN x := x - 1 END;
+IF x > 16267 THEN x := x - 1 END;
+IF x > 16268 THEN x := x - 1 END;
+IF x > 16269 THEN x := x - 1 END;
+IF x > 16270 THEN x := x - 1 END;
+IF x > 16271 THEN x := x - 1 END;
+IF x > 16272 THEN x := x - 1 END;
+IF x > 16273 THEN x := x - 1 END;
+IF x > 16274 THEN x := x - 1 END;
+IF x > 16275 THEN x := x - 1 END;
+IF x > 16276 THEN x := x - 1 END;
+IF x > 16277 THEN x := x - 1 END;
+IF x > 16278 THEN x := x - 1 END;
+IF x > 16279 THEN x := x - 1 END;
+IF x > 16280 THEN x := x - 1 END;
+IF x > 16281 THEN x := x - 1 END;
+IF x > 16282 THEN x := x - 1 END;
+IF x > 16283 THEN x := x - 1 END;
+IF x > 16284 THEN x := x - 1 END;
+IF x > 16285 THEN x := x - 1 END;
+IF x > 16286 THEN x := x - 1 END;
+IF x > 16287 THEN x := x - 1 END;
+IF x > 16288 THEN x := x - 1 END;
+IF x > 16289 THEN x := x - 1 END;
+IF x > 16290 THEN x := x - 1 END;
+IF x > 16291 THEN x := x - 1 END;
+IF x > 16292 THEN x := x - 1 END;
+IF x > 16293 THEN x := x - 1 END;
+IF x > 16294 THEN x := x - 1 END;
+IF x > 16295 THEN x := x - 1 END;
+IF x > 16296 THEN x := x - 1 END;
+IF x > 16297 THEN x := x - 1 END;
+IF x > 16298 THEN x := x - 1 END;
+IF x > 16299 THEN x := x - 1 END;
+IF x > 16300 THEN x := x - 1 END;
+IF x > 16301 THEN x := x - 1 END;
+IF x > 16302 THEN x := x - 1 END;
+IF x > 16303 THEN x := x - 1 END;
+IF x > 16304 THEN x := x - 1 END;
+IF x > 16305 THEN x := x - 1 END;
+IF x > 16306 THEN x := x - 1 END;
+IF x > 16307 THEN x := x - 1 END;
+IF x > 16308 THEN x := x - 1 END;
+IF x > 16309 THEN x := x - 1 END;
+IF x > 16310 THEN x := x - 1 END;
+IF x > 16311 THEN x := x - 1 END;
+IF x > 16312 THEN x := x - 1 END;
+IF x > 16313 THEN x := x - 1 END;
+IF x > 16314 THEN x := x - 1 END;
+IF x > 16315 THEN x := x - 1 END;
+IF x > 16316 THEN x := x - 1 END;
+IF x > 16317 THEN x := x - 1 END;
+IF x > 16318 THEN x := x - 1 END;
+IF x > 16319 THEN x := x - 1 END;
+IF x > 16320 THEN x := x - 1 END;
+IF x > 16321 THEN x := x - 1 END;
+IF x > 16322 THEN x := x - 1 END;
+IF x > 16323 THEN x := x - 1 END;
+IF x > 16324 THEN x := x - 1 END;
+IF x > 16325 THEN x := x - 1 END;
+IF x > 16326 THEN x := x - 1 END;
+IF x > 16327 THEN x := x - 1 END;
+IF x > 16328 THEN x := x - 1 END;
+IF x > 16329 THEN x := x - 1 END;
+IF x > 16330 THEN x := x - 1 END;
+IF x > 16331 THEN x := x - 1 END;
+IF x > 16332 THEN x := x - 1 END;
+IF x > 16333 THEN x := x - 1 END;
+IF x > 16334 THEN x := x - 1 END;
+IF x > 16335 THEN x := x - 1 END;
+IF x > 16336 THEN x := x - 1 END;
+IF x > 16337 THEN x := x - 1 END;
+IF x > 16338 THEN x := x - 1 END;
+IF x > 16339 THEN x := x - 1 END;
+IF x > 16340 THEN x := x - 1 END;
+IF x > 16341 THEN x := x - 1 END;
+IF x > 16342 THEN x := x - 1 END;
+IF x > 16343 THEN x := x - 1 END;
+IF x > 16344 THEN x := x - 1 END;
+IF x > 16345 THEN x := x - 1 END;
+IF x > 16346 THEN x := x - 1 END;
+IF x > 16347 THEN x := x - 1 END;
+IF x > 16348 THEN x := x - 1 END;
+IF x > 16349 THEN x := x - 1 END;
+IF x > 16350 THEN x := x - 1 END;
+IF x > 16351 THEN x := x - 1 END;
+IF x > 16352 THEN x := x - 1 END;
+IF x > 16353 THEN x := x - 1 END;
+IF x > 16354 THEN x := x - 1 END;
+IF x > 16355 THEN x := x - 1 END;
+IF x > 16356 THEN x := x - 1 END;
+IF x > 16357 THEN x := x - 1 END;
+IF x > 16358 THEN x := x - 1 END;
+IF x > 16359 THEN x := x - 1 END;
+IF x > 16360 THEN x := x - 1 END;
+IF x > 16361 THEN x := x - 1 END;
+IF x > 16362 THEN x := x - 1 END;
+IF x > 16363 THEN x := x - 1 END;
+IF x > 16364 THEN x := x - 1 END;
+IF x > 16365 THEN x := x - 1 END;
+IF x > 16366 THEN x := x - 1 END;
+IF x > 16367 THEN x := x - 1 END;
+IF x > 16368 THEN x := x - 1 END;
+IF x > 16369 THEN x := x - 1 END;
+IF x > 16370 THEN x := x - 1 END;
+IF x > 16371 THEN x := x - 1 END;
+IF x > 16372 THEN x := x - 1 END;
+IF x > 16373 THEN x := x - 1 END;
+IF x > 16374 THEN x := x - 1 END;
+IF x > 16375 THEN x := x - 1 END;
+IF x > 16376 THEN x := x - 1 END;
+IF x > 16377 THEN x := x - 1 END;
+IF x > 16378 THEN x := x - 1 END;
+IF x > 16379 THEN x := x - 1 END;
+IF x > 16380 THEN x := x - 1 END;
+IF x > 16381 THEN x := x - 1 END;
+IF x > 16382 THEN x := x - 1 END;
+IF x > 16383 THEN x := x - 1 END;
+IF x > 16384 THEN x := x - 1 END;
+IF x > 16385 THEN x := x - 1 END;
+IF x > 16386 THEN x := x - 1 END;
+IF x > 16387 THEN x := x - 1 END;
+IF x > 16388 THEN x := x - 1 END;
+IF x > 16389 THEN x := x - 1 END;
+IF x > 16390 THEN x := x - 1 END;
+IF x > 16391 THEN x := x - 1 END;
+IF x > 16392 THEN x := x - 1 END;
+IF x > 16393 THEN x := x - 1 END;
+IF x > 16394 THEN x := x - 1 END;
+IF x > 16395 THEN x := x - 1 END;
+IF x > 16396 THEN x := x - 1 END;
+IF x > 16397 THEN x := x - 1 END;
+IF x > 16398 THEN x := x - 1 END;
+IF x > 16399 THEN x := x - 1 END;
+IF x > 16400 THEN x := x - 1 END;
+IF x > 16401 THEN x := x - 1 END;
+IF x > 16402 THEN x := x - 1 END;
+IF x > 16403 THEN x := x - 1 END;
+IF x > 16404 THEN x := x - 1 END;
+IF x > 16405 THEN x := x - 1 END;
+IF x > 16406 THEN x := x - 1 END;
+IF x > 16407 THEN x := x - 1 END;
+IF x > 16408 THEN x := x - 1 END;
+IF x > 16409 THEN x := x - 1 END;
+IF x > 16410 THEN x := x - 1 END;
+IF x > 16411 THEN x := x - 1 END;
+IF x > 16412 THEN x := x - 1 END;
+IF x > 16413 THEN x := x - 1 END;
+IF x > 16414 THEN x := x - 1 END;
+IF x > 16415 THEN x := x - 1 END;
+IF x > 16416 THEN x := x - 1 END;
+IF x > 16417 THEN x := x - 1 END;
+IF x > 16418 THEN x := x - 1 END;
+IF x > 16419 THEN x := x - 1 END;
+IF x > 16420 THEN x := x - 1 END;
+IF x > 16421 THEN x := x - 1 END;
+IF x > 16422 THEN x := x - 1 END;
+IF x > 16423 THEN x := x - 1 END;
+IF x > 16424 THEN x := x - 1 END;
+IF x > 16425 THEN x := x - 1 END;
+IF x > 16426 THEN x := x - 1 END;
+IF x > 16427 THEN x := x - 1 END;
+IF x > 16428 THEN x := x - 1 END;
+IF x > 16429 THEN x := x - 1 END;
+IF x > 16430 THEN x := x - 1 END;
+IF x > 16431 THEN x := x - 1 END;
+IF x > 16432 THEN x := x - 1 END;
+IF x > 16433 THEN x := x - 1 END;
+IF x > 16434 THEN x := x - 1 END;
+IF x > 16435 THEN x := x - 1 END;
+IF x > 16436 THEN x := x - 1 END;
+IF x > 16437 THEN x := x - 1 END;
+IF x > 16438 THEN x := x - 1 END;
+IF x > 16439 THEN x := x - 1 END;
+IF x > 16440 THEN x := x - 1 END;
+IF x > 16441 THEN x := x - 1 END;
+IF x > 16442 THEN x := x - 1 END;
+IF x > 16443 THEN x := x - 1 END;
+IF x > 16444 THEN x := x - 1 END;
+IF x > 16445 THEN x := x - 1 END;
+IF x > 16446 THEN x := x - 1 END;
+IF x > 16447 THEN x := x - 1 END;
+IF x > 16448 THEN x := x - 1 END;
+IF x > 16449 THEN x := x - 1 END;
+IF x > 16450 THEN x := x - 1 END;
+IF x > 16451 THEN x := x - 1 END;
+IF x > 16452 THEN x := x - 1 END;
+IF x > 16453 THEN x := x - 1 END;
+IF x > 16454 THEN x := x - 1 END;
+IF x > 16455 THEN x := x - 1 END;
+IF x > 16456 THEN x := x - 1 END;
+IF x > 16457 THEN x := x - 1 END;
+IF x > 16458 THEN x := x - 1 END;
+IF x > 16459 THEN x := x - 1 END;
+IF x > 16460 THEN x := x - 1 END;
+IF x > 16461 THEN x := x - 1 END;
+IF x > 16462 THEN x := x - 1 END;
+IF x > 16463 THEN x := x - 1 END;
+IF x > 16464 THEN x := x - 1 END;
+IF x > 16465 THEN x := x - 1 END;
+IF x > 16466 THEN x := x - 1 END;
+IF x > 16467 THEN x := x - 1 END;
+IF x > 16468 THEN x := x - 1 END;
+IF x > 16469 THEN x := x - 1 END;
+IF x > 16470 THEN x := x - 1 END;
+IF x > 16471 THEN x := x - 1 END;
+IF x > 16472 THEN x := x - 1 END;
+IF x > 16473 THEN x := x - 1 END;
+IF x > 16474 THEN x := x - 1 END;
+IF x > 16475 THEN x := x - 1 END;
+IF x > 16476 THEN x := x - 1 END;
+IF x > 16477 THEN x := x - 1 END;
+IF x > 16478 THEN x := x - 1 END;
+IF x > 16479 THEN x := x - 1 END;
+IF x > 16480 THEN x := x - 1 END;
+IF x > 16481 THEN x := x - 1 END;
+IF x > 16482 THEN x := x - 1 END;
+IF x > 16483 THEN x := x - 1 END;
+IF x > 16484 THEN x := x - 1 END;
+IF x > 16485 THEN x := x - 1 END;
+IF x > 16486 THEN x := x - 1 END;
+IF x > 16487 THEN x := x - 1 END;
+IF x > 16488 THEN x := x - 1 END;
+IF x > 16489 THEN x := x - 1 END;
+IF x > 16490 THEN x := x - 1 END;
+IF x > 16491 THEN x := x - 1 END;
+IF x > 16492 THEN x := x - 1 END;
+IF x > 16493 THEN x := x - 1 END;
+IF x > 16494 THEN x := x - 1 END;
+IF x > 16495 THEN x := x - 1 END;
+IF x > 16496 THEN x := x - 1 END;
+IF x > 16497 THEN x := x - 1 END;
+IF x > 16498 THEN x := x - 1 END;
+IF x > 16499 THEN x := x - 1 END;
+IF x > 16500 THEN x := x - 1 END;
+IF x > 16501 THEN x := x - 1 END;
+IF x > 16502 THEN x := x - 1 END;
+IF x > 16503 THEN x := x - 1 END;
+IF x > 16504 THEN x := x - 1 END;
+IF x > 16505 THEN x := x - 1 END;
+IF x > 16506 THEN x := x - 1 END;
+IF x > 16507 THEN x := x - 1 END;
+IF x > 16508 THEN x := x - 1 END;
+IF x > 16509 THEN x := x - 1 END;
+IF x > 16510 THEN x := x - 1 END;
+IF x > 16511 THEN x := x - 1 END;
+IF x > 16512 THEN x := x - 1 END;
+IF x > 16513 THEN x := x - 1 END;
+IF x > 16514 THEN x := x - 1 END;
+IF x > 16515 THEN x := x - 1 END;
+IF x > 16516 THEN x := x - 1 END;
+IF x > 16517 THEN x := x - 1 END;
+IF x > 16518 THEN x := x - 1 END;
+IF x > 16519 THEN x := x - 1 END;
+IF x > 16520 THEN x := x - 1 END;
+IF x > 16521 THEN x := x - 1 END;
+IF x > 16522 THEN x := x - 1 END;
+IF x > 16523 THEN x := x - 1 END;
+IF x > 16524 THEN x := x - 1 END;
+IF x > 16525 THEN x := x - 1 END;
+IF x > 16526 THEN x := x - 1 END;
+IF x > 16527 THEN x := x - 1 END;
+IF x > 16528 THEN x := x - 1 END;
+IF x > 16529 THEN x := x - 1 END;
+IF x > 16530 THEN x := x - 1 END;
+IF x > 16531 THEN x := x - 1 END;
+IF x > 16532 THEN x := x - 1 END;
+IF x > 16533 THEN x := x - 1 END;
+IF x > 16534 THEN x := x - 1 END;
+IF x > 16535 THEN x := x - 1 END;
+IF x > 16536 THEN x := x - 1 END;
+IF x > 16537 THEN x := x - 1 END;
+IF x > 16538 THEN x := x - 1 END;
+IF x > 16539 THEN x := x - 1 END;
+IF x > 16540 THEN x := x - 1 END;
+IF x > 16541 THEN x := x - 1 END;
+IF x > 16542 THEN x := x - 1 END;
+IF x > 16543 THEN x := x - 1 END;
+IF x > 16544 THEN x := x - 1 END;
+IF x > 16545 THEN x := x - 1 END;
+IF x > 16546 THEN x := x - 1 END;
+IF x > 16547 THEN x := x - 1 END;
+IF x > 16548 THEN x := x - 1 END;
+IF x > 16549 THEN x := x - 1 END;
+IF x > 16550 THEN x := x - 1 END;
+IF x > 16551 THEN x := x - 1 END;
+IF x > 16552 THEN x := x - 1 END;
+IF x > 16553 THEN x := x - 1 END;
+IF x > 16554 THEN x := x - 1 END;
+IF x > 16555 THEN x := x - 1 END;
+IF x > 16556 THEN x := x - 1 END;
+IF x > 16557 THEN x := x - 1 END;
+IF x > 16558 THEN x := x - 1 END;
+IF x > 16559 THEN x := x - 1 END;
+IF x > 16560 THEN x := x - 1 END;
+IF x > 16561 THEN x := x - 1 END;
+IF x > 16562 THEN x := x - 1 END;
+IF x > 16563 THEN x := x - 1 END;
+IF x > 16564 THEN x := x - 1 END;
+IF x > 16565 THEN x := x - 1 END;
+IF x > 16566 THEN x := x - 1 END;
+IF x > 16567 THEN x := x - 1 END;
+IF x > 16568 THEN x := x - 1 END;
+IF x > 16569 THEN x := x - 1 END;
+IF x > 16570 THEN x := x - 1 END;
+IF x > 16571 THEN x := x - 1 END;
+IF x > 16572 THEN x := x - 1 END;
+IF x > 16573 THEN x := x - 1 END;
+IF x > 16574 THEN x := x - 1 END;
+IF x > 16575 THEN x := x - 1 END;
+IF x > 16576 THEN x := x - 1 END;
+IF x > 16577 THEN x := x - 1 END;
+IF x > 16578 THEN x := x - 1 END;
+IF x > 16579 THEN x := x - 1 END;
+IF x > 16580 THEN x := x - 1 END;
+IF x > 16581 THEN x := x - 1 END;
+IF x > 16582 THEN x := x - 1 END;
+IF x > 16583 THEN x := x - 1 END;
+IF x > 16584 THEN x := x - 1 END;
+IF x > 16585 THEN x := x - 1 END;
+IF x > 16586 THEN x := x - 1 END;
+IF x > 16587 THEN x := x - 1 END;
+IF x > 16588 THEN x := x - 1 END;
+IF x > 16589 THEN x := x - 1 END;
+IF x > 16590 THEN x := x - 1 END;
+IF x > 16591 THEN x := x - 1 END;
+IF x > 16592 THEN x := x - 1 END;
+IF x > 16593 THEN x := x - 1 END;
+IF x > 16594 THEN x := x - 1 END;
+IF x > 16595 THEN x := x - 1 END;
+IF x > 16596 THEN x := x - 1 END;
+IF x > 16597 THEN x := x - 1 END;
+IF x > 16598 THEN x := x - 1 END;
+IF x > 16599 THEN x := x - 1 END;
+IF x > 16600 THEN x := x - 1 END;
+IF x > 16601 THEN x := x - 1 END;
+IF x > 16602 THEN x := x - 1 END;
+IF x > 16603 THEN x := x - 1 END;
+IF x > 16604 THEN x := x - 1 END;
+IF x > 16605 THEN x := x - 1 END;
+IF x > 16606 THEN x := x - 1 END;
+IF x > 16607 THEN x := x - 1 END;
+IF x > 16608 THEN x := x - 1 END;
+IF x > 16609 THEN x := x - 1 END;
+IF x > 16610 THEN x := x - 1 END;
+IF x > 16611 THEN x := x - 1 END;
+IF x > 16612 THEN x := x - 1 END;
+IF x > 16613 THEN x := x - 1 END;
+IF x > 16614 THEN x := x - 1 END;
+IF x > 16615 THEN x := x - 1 END;
+IF x > 16616 THEN x := x - 1 END;
+IF x > 16617 THEN x := x - 1 END;
+IF x > 16618 THEN x := x - 1 END;
+IF x > 16619 THEN x := x - 1 END;
+IF x > 16620 THEN x := x - 1 END;
+IF x > 16621 THEN x := x - 1 END;
+IF x > 16622 THEN x := x - 1 END;
+IF x > 16623 THEN x := x - 1 END;
+IF x > 16624 THEN x := x - 1 END;
+IF x > 16625 THEN x := x - 1 END;
+IF x > 16626 THEN x := x - 1 END;
+IF x > 16627 THEN x := x - 1 END;
+IF x > 16628 THEN x := x - 1 END;
+IF x > 16629 THEN x := x - 1 END;
+IF x > 16630 THEN x := x - 1 END;
+IF x > 16631 THEN x := x - 1 END;
+IF x > 16632 THEN x := x - 1 END;
+IF x > 16633 THEN x := x - 1 END;
+IF x > 16634 THEN x := x - 1 END;
+IF x > 16635 THEN x := x - 1 END;
+IF x > 16636 THEN x := x - 1 END;
+IF x > 16637 THEN x := x - 1 END;
+IF x > 16638 THEN x := x - 1 END;
+IF x > 16639 THEN x := x - 1 END;
+IF x > 16640 THEN x := x - 1 END;
+IF x > 16641 THEN x := x - 1 END;
+IF x > 16642 THEN x := x - 1 END;
+IF x > 16643 THEN x := x - 1 END;
+IF x > 16644 THEN x := x - 1 END;
+IF x > 16645 THEN x := x - 1 END;
+IF x > 16646 THEN x := x - 1 END;
+IF x > 16647 THEN x := x - 1 END;
+IF x > 16648 THEN x := x - 1 END;
+IF x > 16649 THEN x := x - 1 END;
+IF x > 16650 THEN x := x - 1 END;
+IF x > 16651 THEN x := x - 1 END;
+IF x > 16652 THEN x := x - 1 END;
+IF x > 16653 THEN x := x - 1 END;
+IF x > 16654 THEN x := x - 1 END;
+IF x > 16655 THEN x := x - 1 END;
+IF x > 16656 THEN x := x - 1 END;
+IF x > 16657 THEN x := x - 1 END;
+IF x > 16658 THEN x := x - 1 END;
+IF x > 16659 THEN x := x - 1 END;
+IF x > 16660 THEN x := x - 1 END;
+IF x > 16661 THEN x := x - 1 END;
+IF x > 16662 THEN x := x - 1 END;
+IF x > 16663 THEN x := x - 1 END;
+IF x > 16664 THEN x := x - 1 END;
+IF x > 16665 THEN x := x - 1 END;
+IF x > 16666 THEN x := x - 1 END;
+IF x > 16667 THEN x := x - 1 END;
+IF x > 16668 THEN x := x - 1 END;
+IF x > 16669 THEN x := x - 1 END;
+IF x > 16670 THEN x := x - 1 END;
+IF x > 16671 THEN x := x - 1 END;
+IF x > 16672 THEN x := x - 1 END;
+IF x > 16673 THEN x := x - 1 END;
+IF x > 16674 THEN x := x - 1 END;
+IF x > 16675 THEN x := x - 1 END;
+IF x > 16676 THEN x := x - 1 END;
+IF x > 16677 THEN x := x - 1 END;
+IF x > 16678 THEN x := x - 1 END;
+IF x > 16679 THEN x := x - 1 END;
+IF x > 16680 THEN x := x - 1 END;
+IF x > 16681 THEN x := x - 1 END;
+IF x > 16682 THEN x := x - 1 END;
+IF x > 16683 THEN x := x - 1 END;
+IF x > 16684 THEN x := x - 1 END;
+IF x > 16685 THEN x := x - 1 END;
+IF x > 16686 THEN x := x - 1 END;
+IF x > 16687 THEN x := x - 1 END;
+IF x > 16688 THEN x := x - 1 END;
+IF x > 16689 THEN x := x - 1 END;
+IF x > 16690 THEN x := x - 1 END;
+IF x > 16691 THEN x := x - 1 END;
+IF x > 16692 THEN x := x - 1 END;
+IF x > 16693 THEN x := x - 1 END;
+IF x > 16694 THEN x := x - 1 END;
+IF x > 16695 THEN x := x - 1 END;
+IF x > 16696 THEN x := x - 1 END;
+IF x > 16697 THEN x := x - 1 END;
+IF x > 16698 THEN x := x - 1 END;
+IF x > 16699 THEN x := x - 1 END;
+IF x > 16700 THEN x := x - 1 END;
+IF x > 16701 THEN x := x - 1 END;
+IF x > 16702 THEN x := x - 1 END;
+IF x > 16703 THEN x := x - 1 END;
+IF x > 16704 THEN x := x - 1 END;
+IF x > 16705 THEN x := x - 1 END;
+IF x > 16706 THEN x := x - 1 END;
+IF x > 16707 THEN x := x - 1 END;
+IF x > 16708 THEN x := x - 1 END;
+IF x > 16709 THEN x := x - 1 END;
+IF x > 16710 THEN x := x - 1 END;
+IF x > 16711 THEN x := x - 1 END;
+IF x > 16712 THEN x := x - 1 END;
+IF x > 16713 THEN x := x - 1 END;
+IF x > 16714 THEN x := x - 1 END;
+IF x > 16715 THEN x := x - 1 END;
+IF x > 16716 THEN x := x - 1 END;
+IF x > 16717 THEN x := x - 1 END;
+IF x > 16718 THEN x := x - 1 END;
+IF x > 16719 THEN x := x - 1 END;
+IF x > 16720 THEN x := x - 1 END;
+IF x > 16721 THEN x := x - 1 END;
+IF x > 16722 THEN x := x - 1 END;
+IF x > 16723 THEN x := x - 1 END;
+IF x > 16724 THEN x := x - 1 END;
+IF x > 16725 THEN x := x - 1 END;
+IF x > 16726 THEN x := x - 1 END;
+IF x > 16727 THEN x := x - 1 END;
+IF x > 16728 THEN x := x - 1 END;
+IF x > 16729 THEN x := x - 1 END;
+IF x > 16730 THEN x := x - 1 END;
+IF x > 16731 THEN x := x - 1 END;
+IF x > 16732 THEN x := x - 1 END;
+IF x > 16733 THEN x := x - 1 END;
+IF x > 16734 THEN x := x - 1 END;
+IF x > 16735 THEN x := x - 1 END;
+IF x > 16736 THEN x := x - 1 END;
+IF x > 16737 THEN x := x - 1 END;
+IF x > 16738 THEN x := x - 1 END;
+IF x > 16739 THEN x := x - 1 END;
+IF x > 16740 THEN x := x - 1 END;
+IF x > 16741 THEN x := x - 1 END;
+IF x > 16742 THEN x := x - 1 END;
+IF x > 16743 THEN x := x - 1 END;
+IF x > 16744 THEN x := x - 1 END;
+IF x > 16745 THEN x := x - 1 END;
+IF x > 16746 THEN x := x - 1 END;
+IF x > 16747 THEN x := x - 1 END;
+IF x > 16748 THEN x := x - 1 END;
+IF x > 16749 THEN x := x - 1 END;
+IF x > 16750 THEN x := x - 1 END;
+IF x > 16751 THEN x := x - 1 END;
+IF x > 16752 THEN x := x - 1 END;
+IF x > 16753 THEN x := x - 1 END;
+IF x > 16754 THEN x := x - 1 END;
+IF x > 16755 THEN x := x - 1 END;
+IF x > 16756 THEN x := x - 1 END;
+IF x > 16757 THEN x := x - 1 END;
+IF x > 16758 THEN x := x - 1 END;
+IF x > 16759 THEN x := x - 1 END;
+IF x > 16760 THEN x := x - 1 END;
+IF x > 16761 THEN x := x - 1 END;
+IF x > 16762 THEN x := x - 1 END;
+IF x > 16763 THEN x := x - 1 END;
+IF x > 16764 THEN x := x - 1 END;
+IF x > 16765 THEN x := x - 1 END;
+IF x > 16766 THEN x := x - 1 END;
+IF x > 16767 THEN x := x - 1 END;
+IF x > 16768 THEN x := x - 1 END;
+IF x > 16769 THEN x := x - 1 END;
+IF x > 16770 THEN x := x - 1 END;
+IF x > 16771 THEN x := x - 1 END;
+IF x > 16772 THEN x := x - 1 END;
+IF x > 16773 THEN x := x - 1 END;
+IF x > 16774 THEN x := x - 1 END;
+IF x > 16775 THEN x := x - 1 END;
+IF x > 16776 THEN x := x - 1 END;
+IF x > 16777 THEN x := x - 1 END;
+IF x > 16778 THEN x := x - 1 END;
+IF x > 16779 THEN x := x - 1 END;
+IF x > 16780 THEN x := x - 1 END;
+IF x > 16781 THEN x := x - 1 END;
+IF x > 16782 THEN x := x - 1 END;
+IF x > 16783 THEN x := x - 1 END;
+IF x > 16784 THEN x := x - 1 END;
+IF x > 16785 THEN x := x - 1 END;
+IF x > 16786 THEN x := x - 1 END;
+IF x > 16787 THEN x := x - 1 END;
+IF x > 16788 THEN x := x - 1 END;
+IF x > 16789 THEN x := x - 1 END;
+IF x > 16790 THEN x := x - 1 END;
+IF x > 16791 THEN x := x - 1 END;
+IF x > 16792 THEN x := x - 1 END;
+IF x > 16793 THEN x := x - 1 END;
+IF x > 16794 THEN x := x - 1 END;
+IF x > 16795 THEN x := x - 1 END;
+IF x > 16796 THEN x := x - 1 END;
+IF x > 16797 THEN x := x - 1 END;
+IF x > 16798 THEN x := x - 1 END;
+IF x > 16799 THEN x := x - 1 END;
+IF x > 16800 THEN x := x - 1 END;
+IF x > 16801 THEN x := x - 1 END;
+IF x > 16802 THEN x := x - 1 END;
+IF x > 16803 THEN x := x - 1 END;
+IF x > 16804 THEN x := x - 1 END;
+IF x > 16805 THEN x := x - 1 END;
+IF x > 16806 THEN x := x - 1 END;
+IF x > 16807 THEN x := x - 1 END;
+IF x > 16808 THEN x := x - 1 END;
+IF x > 16809 THEN x := x - 1 END;
+IF x > 16810 THEN x := x - 1 END;
+IF x > 16811 THEN x := x - 1 END;
+IF x > 16812 THEN x := x - 1 END;
+IF x > 16813 THEN x := x - 1 END;
+IF x > 16814 THEN x := x - 1 END;
+IF x > 16815 THEN x := x - 1 END;
+IF x > 16816 THEN x := x - 1 END;
+IF x > 16817 THEN x := x - 1 END;
+IF x > 16818 THEN x := x - 1 END;
+IF x > 16819 THEN x := x - 1 END;
+IF x > 16820 THEN x := x - 1 END;
+IF x > 16821 THEN x := x - 1 END;
+IF x > 16822 THEN x := x - 1 END;
+IF x > 16823 THEN x := x - 1 END;
+IF x > 16824 THEN x := x - 1 END;
+IF x > 16825 THEN x := x - 1 END;
+IF x > 16826 THEN x := x - 1 END;
+IF x > 16827 THEN x := x - 1 END;
+IF x > 16828 THEN x := x - 1 END;
+IF x > 16829 THEN x := x - 1 END;
+IF x > 16830 THEN x := x - 1 END;
+IF x > 16831 THEN x := x - 1 END;
+IF x > 16832 THEN x := x - 1 END;
+IF x > 16833 THEN x := x - 1 END;
+IF x > 16834 THEN x := x - 1 END;
+IF x > 16835 THEN x := x - 1 END;
+IF x > 16836 THEN x := x - 1 END;
+IF x > 16837 THEN x := x - 1 END;
+IF x > 16838 THEN x := x - 1 END;
+IF x > 16839 THEN x := x - 1 END;
+IF x > 16840 THEN x := x - 1 END;
+IF x > 16841 THEN x := x - 1 END;
+IF x > 16842 THEN x := x - 1 END;
+IF x > 16843 THEN x := x - 1 END;
+IF x > 16844 THEN x := x - 1 END;
+IF x > 16845 THEN x := x - 1 END;
+IF x > 16846 THEN x := x - 1 END;
+IF x > 16847 THEN x := x - 1 END;
+IF x > 16848 THEN x := x - 1 END;
+IF x > 16849 THEN x := x - 1 END;
+IF x > 16850 THEN x := x - 1 END;
+IF x > 16851 THEN x := x - 1 END;
+IF x > 16852 THEN x := x - 1 END;
+IF x > 16853 THEN x := x - 1 END;
+IF x > 16854 THEN x := x - 1 END;
+IF x > 16855 THEN x := x - 1 END;
+IF x > 16856 THEN x := x - 1 END;
+IF x > 16857 THEN x := x - 1 END;
+IF x > 16858 THEN x := x - 1 END;
+IF x > 16859 THEN x := x - 1 END;
+IF x > 16860 THEN x := x - 1 END;
+IF x > 16861 THEN x := x - 1 END;
+IF x > 16862 THEN x := x - 1 END;
+IF x > 16863 THEN x := x - 1 END;
+IF x > 16864 THEN x := x - 1 END;
+IF x > 16865 THEN x := x - 1 END;
+IF x > 16866 THEN x := x - 1 END;
+IF x > 16867 THEN x := x - 1 END;
+IF x > 16868 THEN x := x - 1 END;
+IF x > 16869 THEN x := x - 1 END;
+IF x > 16870 THEN x := x - 1 END;
+IF x > 16871 THEN x := x - 1 END;
+IF x > 16872 THEN x := x - 1 END;
+IF x > 16873 THEN x := x - 1 END;
+IF x > 16874 THEN x := x - 1 END;
+IF x > 16875 THEN x := x - 1 END;
+IF x > 16876 THEN x := x - 1 END;
+IF x > 16877 THEN x := x - 1 END;
+IF x > 16878 THEN x := x - 1 END;
+IF x > 16879 THEN x := x - 1 END;
+IF x > 16880 THEN x := x - 1 END;
+IF x > 16881 THEN x := x - 1 END;
+IF x > 16882 THEN x := x - 1 END;
+IF x > 16883 THEN x := x - 1 END;
+IF x > 16884 THEN x := x - 1 END;
+IF x > 16885 THEN x := x - 1 END;
+IF x > 16886 THEN x := x - 1 END;
+IF x > 16887 THEN x := x - 1 END;
+IF x > 16888 THEN x := x - 1 END;
+IF x > 16889 THEN x := x - 1 END;
+IF x > 16890 THEN x := x - 1 END;
+IF x > 16891 THEN x := x - 1 END;
+IF x > 16892 THEN x := x - 1 END;
+IF x > 16893 THEN x := x - 1 END;
+IF x > 16894 THEN x := x - 1 END;
+IF x > 16895 THEN x := x - 1 END;
+IF x > 16896 THEN x := x - 1 END;
+IF x > 16897 THEN x := x - 1 END;
+IF x > 16898 THEN x := x - 1 END;
+IF x > 16899 THEN x := x - 1 END;
+IF x > 16900 THEN x := x - 1 END;
+IF x > 16901 THEN x := x - 1 END;
+IF x > 16902 THEN x := x - 1 END;
+IF x > 16903 THEN x := x - 1 END;
+IF x > 16904 THEN x := x - 1 END;
+IF x > 16905 THEN x := x - 1 END;
+IF x > 16906 THEN x := x - 1 END;
+IF x > 16907 THEN x := x - 1 END;
+IF x > 16908 THEN x := x - 1 END;
+IF x > 16909 THEN x := x - 1 END;
+IF x > 16910 THEN x := x - 1 END;
+IF x > 16911 THEN x := x - 1 END;
+IF x > 16912 THEN x := x - 1 END;
+IF x > 16913 THEN x := x - 1 END;
+IF x > 16914 THEN x := x - 1 END;
+IF x > 16915 THEN x := x - 1 END;
+IF x > 16916 THEN x := x - 1 END;
+IF x > 16917 THEN x := x - 1 END;
+IF x > 16918 THEN x := x - 1 END;
+IF x > 16919 THEN x := x - 1 END;
+IF x > 16920 THEN x := x - 1 END;
+IF x > 16921 THEN x := x - 1 END;
+IF x > 16922 THEN x := x - 1 END;
+IF x > 16923 THEN x := x - 1 END;
+IF x > 16924 THEN x := x - 1 END;
+IF x > 16925 THEN x := x - 1 END;
+IF x > 16926 THEN x := x - 1 END;
+IF x > 16927 THEN x := x - 1 END;
+IF x > 16928 THEN x := x - 1 END;
+IF x > 16929 THEN x := x - 1 END;
+IF x > 16930 THEN x := x - 1 END;
+IF x > 16931 THEN x := x - 1 END;
+IF x > 16932 THEN x := x - 1 END;
+IF x > 16933 THEN x := x - 1 END;
+IF x > 16934 THEN x := x - 1 END;
+IF x > 16935 THEN x := x - 1 END;
+IF x > 16936 THEN x := x - 1 END;
+IF x > 16937 THEN x := x - 1 END;
+IF x > 16938 THEN x := x - 1 END;
+IF x > 16939 THEN x := x - 1 END;
+IF x > 16940 THEN x := x - 1 END;
+IF x > 16941 THEN x := x - 1 END;
+IF x > 16942 THEN x := x - 1 END;
+IF x > 16943 THEN x := x - 1 END;
+IF x > 16944 THEN x := x - 1 END;
+IF x > 16945 THEN x := x - 1 END;
+IF x > 16946 THEN x := x - 1 END;
+IF x > 16947 THEN x := x - 1 END;
+IF x > 16948 THEN x := x - 1 END;
+IF x > 16949 THEN x := x - 1 END;
+IF x > 16950 THEN x := x - 1 END;
+IF x > 16951 THEN x := x - 1 END;
+IF x > 16952 THEN x := x - 1 END;
+IF x > 16953 THEN x := x - 1 END;
+IF x > 16954 THEN x := x - 1 END;
+IF x > 16955 THEN x := x - 1 END;
+IF x > 16956 THEN x := x - 1 END;
+IF x > 16957 THEN x := x - 1 END;
+IF x > 16958 THEN x := x - 1 END;
+IF x > 16959 THEN x := x - 1 END;
+IF x > 16960 THEN x := x - 1 END;
+IF x > 16961 THEN x := x - 1 END;
+IF x > 16962 THEN x := x - 1 END;
+IF x > 16963 THEN x := x - 1 END;
+IF x > 16964 THEN x := x - 1 END;
+IF x > 16965 THEN x := x - 1 END;
+IF x > 16966 THEN x := x - 1 END;
+IF x > 16967 THEN x := x - 1 END;
+IF x > 16968 THEN x := x - 1 END;
+IF x > 16969 THEN x := x - 1 END;
+IF x > 16970 THEN x := x - 1 END;
+IF x > 16971 THEN x := x - 1 END;
+IF x > 16972 THEN x := x - 1 END;
+IF x > 16973 THEN x := x - 1 END;
+IF x > 16974 THEN x := x - 1 END;
+IF x > 16975 THEN x := x - 1 END;
+IF x > 16976 THEN x := x - 1 END;
+IF x > 16977 THEN x := x - 1 END;
+IF x > 16978 THEN x := x - 1 END;
+IF x > 16979 THEN x := x - 1 END;
+IF x > 16980 THEN x := x - 1 END;
+IF x > 16981 THEN x := x - 1 END;
+IF x > 16982 THEN x := x - 1 END;
+IF x > 16983 THEN x := x - 1 END;
+IF x > 16984 THEN x := x - 1 END;
+IF x > 16985 THEN x := x - 1 END;
+IF x > 16986 THEN x := x - 1 END;
+IF x > 16987 THEN x := x - 1 END;
+IF x > 16988 THEN x := x - 1 END;
+IF x > 16989 THEN x := x - 1 END;
+IF x > 16990 THEN x := x - 1 END;
+IF x > 16991 THEN x := x - 1 END;
+IF x > 16992 THEN x := x - 1 END;
+IF x > 16993 THEN x := x - 1 END;
+IF x > 16994 THEN x := x - 1 END;
+IF x > 16995 THEN x := x - 1 END;
+IF x > 16996 THEN x := x - 1 END;
+IF x > 16997 THEN x := x - 1 END;
+IF x > 16998 THEN x := x - 1 END;
+IF x > 16999 THEN x := x - 1 END;
+IF x > 17000 THEN x := x - 1 END;
+IF x > 17001 THEN x := x - 1 END;
+IF x > 17002 THEN x := x - 1 END;
+IF x > 17003 THEN x := x - 1 END;
+IF x > 17004 THEN x := x - 1 END;
+IF x > 17005 THEN x := x - 1 END;
+IF x > 17006 THEN x := x - 1 END;
+IF x > 17007 THEN x := x - 1 END;
+IF x > 17008 THEN x := x - 1 END;
+IF x > 17009 THEN x := x - 1 END;
+IF x > 17010 THEN x := x - 1 END;
+IF x > 17011 THEN x := x - 1 END;
+IF x > 17012 THEN x := x - 1 END;
+IF x > 17013 THEN x := x - 1 END;
+IF x > 17014 THEN x := x - 1 END;
+IF x > 17015 THEN x := x - 1 END;
+IF x > 17016 THEN x := x - 1 END;
+IF x > 17017 THEN x := x - 1 END;
+IF x > 17018 THEN x := x - 1 END;
+IF x > 17019 THEN x := x - 1 END;
+IF x > 17020 THEN x := x - 1 END;
+IF x > 17021 THEN x := x - 1 END;
+IF x > 17022 THEN x := x - 1 END;
+IF x > 17023 THEN x := x - 1 END;
+IF x > 17024 THEN x := x - 1 END;
+IF x > 17025 THEN x := x - 1 END;
+IF x > 17026 THEN x := x - 1 END;
+IF x > 17027 THEN x := x - 1 END;
+IF x > 17028 THEN x := x - 1 END;
+IF x > 17029 THEN x := x - 1 END;
+IF x > 17030 THEN x := x - 1 END;
+IF x > 17031 THEN x := x - 1 END;
+IF x > 17032 THEN x := x - 1 END;
+IF x > 17033 THEN x := x - 1 END;
+IF x > 17034 THEN x := x - 1 END;
+IF x > 17035 THEN x := x - 1 END;
+IF x > 17036 THEN x := x - 1 END;
+IF x > 17037 THEN x := x - 1 END;
+IF x > 17038 THEN x := x - 1 END;
+IF x > 17039 THEN x := x - 1 END;
+IF x > 17040 THEN x := x - 1 END;
+IF x > 17041 THEN x := x - 1 END;
+IF x > 17042 THEN x := x - 1 END;
+IF x > 17043 THEN x := x - 1 END;
+IF x > 17044 THEN x := x - 1 END;
+IF x > 17045 THEN x := x - 1 END;
+IF x > 17046 THEN x := x - 1 END;
+IF x > 17047 THEN x := x - 1 END;
+IF x > 17048 THEN x := x - 1 END;
+IF x > 17049 THEN x := x - 1 END;
+IF x > 17050 THEN x := x - 1 END;
+IF x > 17051 THEN x := x - 1 END;
+IF x > 17052 THEN x := x - 1 END;
+IF x > 17053 THEN x := x - 1 END;
+IF x > 17054 THEN x := x - 1 END;
+IF x > 17055 THEN x := x - 1 END;
+IF x > 17056 THEN x := x - 1 END;
+IF x > 17057 THEN x := x - 1 END;
+IF x > 17058 THEN x := x - 1 END;
+IF x > 17059 THEN x := x - 1 END;
+IF x > 17060 THEN x := x - 1 END;
+IF x > 17061 THEN x := x - 1 END;
+IF x > 17062 THEN x := x - 1 END;
+IF x > 17063 THEN x := x - 1 END;
+IF x > 17064 THEN x := x - 1 END;
+IF x > 17065 THEN x := x - 1 END;
+IF x > 17066 THEN x := x - 1 END;
+IF x > 17067 THEN x := x - 1 END;
+IF x > 17068 THEN x := x - 1 END;
+IF x > 17069 THEN x := x - 1 END;
+IF x > 17070 THEN x := x - 1 END;
+IF x > 17071 THEN x := x - 1 END;
+IF x > 17072 THEN x := x - 1 END;
+IF x > 17073 THEN x := x - 1 END;
+IF x > 17074 THEN x := x - 1 END;
+IF x > 17075 THEN x := x - 1 END;
+IF x > 17076 THEN x := x - 1 END;
+IF x > 17077 THEN x := x - 1 END;
+IF x > 17078 THEN x := x - 1 END;
+IF x > 17079 THEN x := x - 1 END;
+IF x > 17080 THEN x := x - 1 END;
+IF x > 17081 THEN x := x - 1 END;
+IF x > 17082 THEN x := x - 1 END;
+IF x > 17083 THEN x := x - 1 END;
+IF x > 17084 THEN x := x - 1 END;
+IF x > 17085 THEN x := x - 1 END;
+IF x > 17086 THEN x := x - 1 END;
+IF x > 17087 THEN x := x - 1 END;
+IF x > 17088 THEN x := x - 1 END;
+IF x > 17089 THEN x := x - 1 END;
+IF x > 17090 THEN x := x - 1 END;
+IF x > 17091 THEN x := x - 1 END;
+IF x > 17092 THEN x := x - 1 END;
+IF x > 17093 THEN x := x - 1 END;
+IF x > 17094 THEN x := x - 1 END;
+IF x > 17095 THEN x := x - 1 END;
+IF x > 17096 THEN x := x - 1 END;
+IF x > 17097 THEN x := x - 1 END;
+IF x > 17098 THEN x := x - 1 END;
+IF x > 17099 THEN x := x - 1 END;
+IF x > 17100 THEN x := x - 1 END;
+IF x > 17101 THEN x := x - 1 END;
+IF x > 17102 THEN x := x - 1 END;
+IF x > 17103 THEN x := x - 1 END;
+IF x > 17104 THEN x := x - 1 END;
+IF x > 17105 THEN x := x - 1 END;
+IF x > 17106 THEN x := x - 1 END;
+IF x > 17107 THEN x := x - 1 END;
+IF x > 17108 THEN x := x - 1 END;
+IF x > 17109 THEN x := x - 1 END;
+IF x > 17110 THEN x := x - 1 END;
+IF x > 17111 THEN x := x - 1 END;
+IF x > 17112 THEN x := x - 1 END;
+IF x > 17113 THEN x := x - 1 END;
+IF x > 17114 THEN x := x - 1 END;
+IF x > 17115 THEN x := x - 1 END;
+IF x > 17116 THEN x := x - 1 END;
+IF x > 17117 THEN x := x - 1 END;
+IF x > 17118 THEN x := x - 1 END;
+IF x > 17119 THEN x := x - 1 END;
+IF x > 17120 THEN x := x - 1 END;
+IF x > 17121 THEN x := x - 1 END;
+IF x > 17122 THEN x := x - 1 END;
+IF x > 17123 THEN x := x - 1 END;
+IF x > 17124 THEN x := x - 1 END;
+IF x > 17125 THEN x := x - 1 END;
+IF x > 17126 THEN x := x - 1 END;
+IF x > 17127 THEN x := x - 1 END;
+IF x > 17128 THEN x := x - 1 END;
+IF x > 17129 THEN x := x - 1 END;
+IF x > 17130 THEN x := x - 1 END;
+IF x > 17131 THEN x := x - 1 END;
+IF x > 17132 THEN x := x - 1 END;
+IF x > 17133 THEN x := x - 1 END;
+IF x > 17134 THEN x := x - 1 END;
+IF x > 17135 THEN x := x - 1 END;
+IF x > 17136 THEN x := x - 1 END;
+IF x > 17137 THEN x := x - 1 END;
+IF x > 17138 THEN x := x - 1 END;
+IF x > 17139 THEN x := x - 1 END;
+IF x > 17140 THEN x := x - 1 END;
+IF x > 17141 THEN x := x - 1 END;
+IF x > 17142 THEN x := x - 1 END;
+IF x > 17143 THEN x := x - 1 END;
+IF x > 17144 THEN x := x - 1 END;
+IF x > 17145 THEN x := x - 1 END;
+IF x > 17146 THEN x := x - 1 END;
+IF x > 17147 THEN x := x - 1 END;
+IF x > 17148 THEN x := x - 1 END;
+IF x > 17149 THEN x := x - 1 END;
+IF x > 17150 THEN x := x - 1 END;
+IF x > 17151 THEN x := x - 1 END;
+IF x > 17152 THEN x := x - 1 END;
+IF x > 17153 THEN x := x - 1 END;
+IF x > 17154 THEN x := x - 1 END;
+IF x > 17155 THEN x := x - 1 END;
+IF x > 17156 THEN x := x - 1 END;
+IF x > 17157 THEN x := x - 1 END;
+IF x > 17158 THEN x := x - 1 END;
+IF x > 17159 THEN x := x - 1 END;
+IF x > 17160 THEN x := x - 1 END;
+IF x > 17161 THEN x := x - 1 END;
+IF x > 17162 THEN x := x - 1 END;
+IF x > 17163 THEN x := x - 1 END;
+IF x > 17164 THEN x := x - 1 END;
+IF x > 17165 THEN x := x - 1 END;
+IF x > 17166 THEN x := x - 1 END;
+IF x > 17167 THEN x := x - 1 END;
+IF x > 17168 THEN x := x - 1 END;
+IF x > 17169 THEN x := x - 1 END;
+IF x > 17170 THEN x := x - 1 END;
+IF x > 17171 THEN x := x - 1 END;
+IF x > 17172 THEN x := x - 1 END;
+IF x > 17173 THEN x := x - 1 END;
+IF x > 17174 THEN x := x - 1 END;
+IF x > 17175 THEN x := x - 1 END;
+IF x > 17176 THEN x := x - 1 END;
+IF x > 17177 THEN x := x - 1 END;
+IF x > 17178 THEN x := x - 1 END;
+IF x > 17179 THEN x := x - 1 END;
+IF x > 17180 THEN x := x - 1 END;
+IF x > 17181 THEN x := x - 1 END;
+IF x > 17182 THEN x := x - 1 END;
+IF x > 17183 THEN x := x - 1 END;
+IF x > 17184 THEN x := x - 1 END;
+IF x > 17185 THEN x := x - 1 END;
+IF x > 17186 THEN x := x - 1 END;
+IF x > 17187 THEN x := x - 1 END;
+IF x > 17188 THEN x := x - 1 END;
+IF x > 17189 THEN x := x - 1 END;
+IF x > 17190 THEN x := x - 1 END;
+IF x > 17191 THEN x := x - 1 END;
+IF x > 17192 THEN x := x - 1 END;
+IF x > 17193 THEN x := x - 1 END;
+IF x > 17194 THEN x := x - 1 END;
+IF x > 17195 THEN x := x - 1 END;
+IF x > 17196 THEN x := x - 1 END;
+IF x > 17197 THEN x := x - 1 END;
+IF x > 17198 THEN x := x - 1 END;
+IF x > 17199 THEN x := x - 1 END;
+IF x > 17200 THEN x := x - 1 END;
+IF x > 17201 THEN x := x - 1 END;
+IF x > 17202 THEN x := x - 1 END;
+IF x > 17203 THEN x := x - 1 END;
+IF x > 17204 THEN x := x - 1 END;
+IF x > 17205 THEN x := x - 1 END;
+IF x > 17206 THEN x := x - 1 END;
+IF x > 17207 THEN x := x - 1 END;
+IF x > 17208 THEN x := x - 1 END;
+IF x > 17209 THEN x := x - 1 END;
+IF x > 17210 THEN x := x - 1 END;
+IF x > 17211 THEN x := x - 1 END;
+IF x > 17212 THEN x := x - 1 END;
+IF x > 17213 THEN x := x - 1 END;
+IF x > 17214 THEN x := x - 1 END;
+IF x > 17215 THEN x := x - 1 END;
+IF x > 17216 THEN x := x - 1 END;
+IF x > 17217 THEN x := x - 1 END;
+IF x > 17218 THEN x := x - 1 END;
+IF x > 17219 THEN x := x - 1 END;
+IF x > 17220 THEN x := x - 1 END;
+IF x > 17221 THEN x := x - 1 END;
+IF x > 17222 THEN x := x - 1 END;
+IF x > 17223 THEN x := x - 1 END;
+IF x > 17224 THEN x := x - 1 END;
+IF x > 17225 THEN x := x - 1 END;
+IF x > 17226 THEN x := x - 1 END;
+IF x > 17227 THEN x := x - 1 END;
+IF x > 17228 THEN x := x - 1 END;
+IF x > 17229 THEN x := x - 1 END;
+IF x > 17230 THEN x := x - 1 END;
+IF x > 17231 THEN x := x - 1 END;
+IF x > 17232 THEN x := x - 1 END;
+IF x > 17233 THEN x := x - 1 END;
+IF x > 17234 THEN x := x - 1 END;
+IF x > 17235 THEN x := x - 1 END;
+IF x > 17236 THEN x := x - 1 END;
+IF x > 17237 THEN x := x - 1 END;
+IF x > 17238 THEN x := x - 1 END;
+IF x > 17239 THEN x := x - 1 END;
+IF x > 17240 THEN x := x - 1 END;
+IF x > 17241 THEN x := x - 1 END;
+IF x > 17242 THEN x := x - 1 END;
+IF x > 17243 THEN x := x - 1 END;
+IF x > 17244 THEN x := x - 1 END;
+IF x > 17245 THEN x := x - 1 END;
+IF x > 17246 THEN x := x - 1 END;
+IF x > 17247 THEN x := x - 1 END;
+IF x > 17248 THEN x := x - 1 END;
+IF x > 17249 THEN x := x - 1 END;
+IF x > 17250 THEN x := x - 1 END;
+IF x > 17251 THEN x := x - 1 END;
+IF x > 17252 THEN x := x - 1 END;
+IF x > 17253 THEN x := x - 1 END;
+IF x > 17254 THEN x := x - 1 END;
+IF x > 17255 THEN x := x - 1 END;
+IF x > 17256 THEN x := x - 1 END;
+IF x > 17257 THEN x := x - 1 END;
+IF x > 17258 THEN x := x - 1 END;
+IF x > 17259 THEN x := x - 1 END;
+IF x > 17260 THEN x := x - 1 END;
+IF x > 17261 THEN x := x - 1 END;
+IF x > 17262 THEN x := x - 1 END;
+IF x > 17263 THEN x := x - 1 END;
+IF x > 17264 THEN x := x - 1 END;
+IF x > 17265 THEN x := x - 1 END;
+IF x > 17266 THEN x := x - 1 END;
+IF x > 17267 THEN x := x - 1 END;
+IF x > 17268 THEN x := x - 1 END;
+IF x > 17269 THEN x := x - 1 END;
+IF x > 17270 THEN x := x - 1 END;
+IF x > 17271 THEN x := x - 1 END;
+IF x > 17272 THEN x := x - 1 END;
+IF x > 17273 THEN x := x - 1 END;
+IF x > 17274 THEN x := x - 1 END;
+IF x > 17275 THEN x := x - 1 END;
+IF x > 17276 THEN x := x - 1 END;
+IF x > 17277 THEN x := x - 1 END;
+IF x > 17278 THEN x := x - 1 END;
+IF x > 17279 THEN x := x - 1 END;
+IF x > 17280 THEN x := x - 1 END;
+IF x > 17281 THEN x := x - 1 END;
+IF x > 17282 THEN x := x - 1 END;
+IF x > 17283 THEN x := x - 1 END;
+IF x > 17284 THEN x := x - 1 END;
+IF x > 17285 THEN x := x - 1 END;
+IF x > 17286 THEN x := x - 1 END;
+IF x > 17287 THEN x := x - 1 END;
+IF x > 17288 THEN x := x - 1 END;
+IF x > 17289 THEN x := x - 1 END;
+IF x > 17290 THEN x := x - 1 END;
+IF x > 17291 THEN x := x - 1 END;
+IF x > 17292 THEN x := x - 1 END;
+IF x > 17293 THEN x := x - 1 END;
+IF x > 17294 THEN x := x - 1 END;
+IF x > 17295 THEN x := x - 1 END;
+IF x > 17296 THEN x := x - 1 END;
+IF x > 17297 THEN x := x - 1 END;
+IF x > 17298 THEN x := x - 1 END;
+IF x > 17299 THEN x := x - 1 END;
+IF x > 17300 THEN x := x - 1 END;
+IF x > 17301 THEN x := x - 1 END;
+IF x > 17302 THEN x := x - 1 END;
+IF x > 17303 THEN x := x - 1 END;
+IF x > 17304 THEN x := x - 1 END;
+IF x > 17305 THEN x := x - 1 END;
+IF x > 17306 THEN x := x - 1 END;
+IF x > 17307 THEN x := x - 1 END;
+IF x > 17308 THEN x := x - 1 END;
+IF x > 17309 THEN x := x - 1 END;
+IF x > 17310 THEN x := x - 1 END;
+IF x > 17311 THEN x := x - 1 END;
+IF x > 17312 THEN x := x - 1 END;
+IF x > 17313 THEN x := x - 1 END;
+IF x > 17314 THEN x := x - 1 END;
+IF x > 17315 THEN x := x - 1 END;
+IF x > 17316 THEN x := x - 1 END;
+IF x > 17317 THEN x := x - 1 END;
+IF x > 17318 THEN x := x - 1 END;
+IF x > 17319 THEN x := x - 1 END;
+IF x > 17320 THEN x := x - 1 END;
+IF x > 17321 THEN x := x - 1 END;
+IF x > 17322 THEN x := x - 1 END;
+IF x > 17323 THEN x := x - 1 END;
+IF x > 17324 THEN x := x - 1 END;
+IF x > 17325 THEN x := x - 1 END;
+IF x > 17326 THEN x := x - 1 END;
+IF x > 17327 THEN x := x - 1 END;
+IF x > 17328 THEN x := x - 1 END;
+IF x > 17329 THEN x := x - 1 END;
+IF x > 17330 THEN x := x - 1 END;
+IF x > 17331 THEN x := x - 1 END;
+IF x > 17332 THEN x := x - 1 END;
+IF x > 17333 THEN x := x - 1 END;
+IF x > 17334 THEN x := x - 1 END;
+IF x > 17335 THEN x := x - 1 END;
+IF x > 17336 THEN x := x - 1 END;
+IF x > 17337 THEN x := x - 1 END;
+IF x > 17338 THEN x := x - 1 END;
+IF x > 17339 THEN x := x - 1 END;
+IF x > 17340 THEN x := x - 1 END;
+IF x > 17341 THEN x := x - 1 END;
+IF x > 17342 THEN x := x - 1 END;
+IF x > 17343 THEN x := x - 1 END;
+IF x > 17344 THEN x := x - 1 END;
+IF x > 17345 THEN x := x - 1 END;
+IF x > 17346 THEN x := x - 1 END;
+IF x > 17347 THEN x := x - 1 END;
+IF x > 17348 THEN x := x - 1 END;
+IF x > 17349 THEN x := x - 1 END;
+IF x > 17350 THEN x := x - 1 END;
+IF x > 17351 THEN x := x - 1 END;
+IF x > 17352 THEN x := x - 1 END;
+IF x > 17353 THEN x := x - 1 END;
+IF x > 17354 THEN x := x - 1 END;
+IF x > 17355 THEN x := x - 1 END;
+IF x > 17356 THEN x := x - 1 END;
+IF x > 17357 THEN x := x - 1 END;
+IF x > 17358 THEN x := x - 1 END;
+IF x > 17359 THEN x := x - 1 END;
+IF x > 17360 THEN x := x - 1 END;
+IF x > 17361 THEN x := x - 1 END;
+IF x > 17362 THEN x := x - 1 END;
+IF x > 17363 THEN x := x - 1 END;
+IF x > 17364 THEN x := x - 1 END;
+IF x > 17365 THEN x := x - 1 END;
+IF x > 17366 THEN x := x - 1 END;
+IF x > 17367 THEN x := x - 1 END;
+IF x > 17368 THEN x := x - 1 END;
+IF x > 17369 THEN x := x - 1 END;
+IF x > 17370 THEN x := x - 1 END;
+IF x > 17371 THEN x := x - 1 END;
+IF x > 17372 THEN x := x - 1 END;
+IF x > 17373 THEN x := x - 1 END;
+IF x > 17374 THEN x := x - 1 END;
+IF x > 17375 THEN x := x - 1 END;
+IF x > 17376 THEN x := x - 1 END;
+IF x > 17377 THEN x := x - 1 END;
+IF x > 17378 THEN x := x - 1 END;
+IF x > 17379 THEN x := x - 1 END;
+IF x > 17380 THEN x := x - 1 END;
+IF x > 17381 THEN x := x - 1 END;
+IF x > 17382 THEN x := x - 1 END;
+IF x > 17383 THEN x := x - 1 END;
+IF x > 17384 THEN x := x - 1 END;
+IF x > 17385 THEN x := x - 1 END;
+IF x > 17386 THEN x := x - 1 END;
+IF x > 17387 THEN x := x - 1 END;
+IF x > 17388 THEN x := x - 1 END;
+IF x > 17389 THEN x := x - 1 END;
+IF x > 17390 THEN x := x - 1 END;
+IF x > 17391 THEN x := x - 1 END;
+IF x > 17392 THEN x := x - 1 END;
+IF x > 17393 THEN x := x - 1 END;
+IF x > 17394 THEN x := x - 1 END;
+IF x > 17395 THEN x := x - 1 END;
+IF x > 17396 THEN x := x - 1 END;
+IF x > 17397 THEN x := x - 1 END;
+IF x > 17398 THEN x := x - 1 END;
+IF x > 17399 THEN x := x - 1 END;
+IF x > 17400 THEN x := x - 1 END;
+IF x > 17401 THEN x := x - 1 END;
+IF x > 17402 THEN x := x - 1 END;
+IF x > 17403 THEN x := x - 1 END;
+IF x > 17404 THEN x := x - 1 END;
+IF x > 17405 THEN x := x - 1 END;
+IF x > 17406 THEN x := x - 1 END;
+IF x > 17407 THEN x := x - 1 END;
+IF x > 17408 THEN x := x - 1 END;
+IF x > 17409 THEN x := x - 1 END;
+IF x > 17410 THEN x := x - 1 END;
+IF x > 17411 THEN x := x - 1 END;
+IF x > 17412 THEN x := x - 1 END;
+IF x > 17413 THEN x := x - 1 END;
+IF x > 17414 THEN x := x - 1 END;
+IF x > 17415 THEN x := x - 1 END;
+IF x > 17416 THEN x := x - 1 END;
+IF x > 17417 THEN x := x - 1 END;
+IF x > 17418 THEN x := x - 1 END;
+IF x > 17419 THEN x := x - 1 END;
+IF x > 17420 THEN x := x - 1 END;
+IF x > 17421 THEN x := x - 1 END;
+IF x > 17422 THEN x := x - 1 END;
+IF x > 17423 THEN x := x - 1 END;
+IF x > 17424 THEN x := x - 1 END;
+IF x > 17425 THEN x := x - 1 END;
+IF x > 17426 THEN x := x - 1 END;
+IF x > 17427 THEN x := x - 1 END;
+IF x > 17428 THEN x := x - 1 END;
+IF x > 17429 THEN x := x - 1 END;
+IF x > 17430 THEN x := x - 1 END;
+IF x > 17431 THEN x := x - 1 END;
+IF x > 17432 THEN x := x - 1 END;
+IF x > 17433 THEN x := x - 1 END;
+IF x > 17434 THEN x := x - 1 END;
+IF x > 17435 THEN x := x - 1 END;
+IF x > 17436 THEN x := x - 1 END;
+IF x > 17437 THEN x := x - 1 END;
+IF x > 17438 THEN x := x - 1 END;
+IF x > 17439 THEN x := x - 1 END;
+IF x > 17440 THEN x := x - 1 END;
+IF x > 17441 THEN x := x - 1 END;
+IF x > 17442 THEN x := x - 1 END;
+IF x > 17443 THEN x := x - 1 END;
+IF x > 17444 THEN x := x - 1 END;
+IF x > 17445 THEN x := x - 1 END;
+IF x > 17446 THEN x := x - 1 END;
+IF x > 17447 THEN x := x - 1 END;
+IF x > 17448 THEN x := x - 1 END;
+IF x > 17449 THEN x := x - 1 END;
+IF x > 17450 THEN x := x - 1 END;
+IF x > 17451 THEN x := x - 1 END;
+IF x > 17452 THEN x := x - 1 END;
+IF x > 17453 THEN x := x - 1 END;
+IF x > 17454 THEN x := x - 1 END;
+IF x > 17455 THEN x := x - 1 END;
+IF x > 17456 THEN x := x - 1 END;
+IF x > 17457 THEN x := x - 1 END;
+IF x > 17458 THEN x := x - 1 END;
+IF x > 17459 THEN x := x - 1 END;
+IF x > 17460 THEN x := x - 1 END;
+IF x > 17461 THEN x := x - 1 END;
+IF x > 17462 THEN x := x - 1 END;
+IF x > 17463 THEN x := x - 1 END;
+IF x > 17464 THEN x := x - 1 END;
+IF x > 17465 THEN x := x - 1 END;
+IF x > 17466 THEN x := x - 1 END;
+IF x > 17467 THEN x := x - 1 END;
+IF x > 17468 THEN x := x - 1 END;
+IF x > 17469 THEN x := x - 1 END;
+IF x > 17470 THEN x := x - 1 END;
+IF x > 17471 THEN x := x - 1 END;
+IF x > 17472 THEN x := x - 1 END;
+IF x > 17473 THEN x := x - 1 END;
+IF x > 17474 THEN x := x - 1 END;
+IF x > 17475 THEN x := x - 1 END;
+IF x > 17476 THEN x := x - 1 END;
+IF x > 17477 THEN x := x - 1 END;
+IF x > 17478 THEN x := x - 1 END;
+IF x > 17479 THEN x := x - 1 END;
+IF x > 17480 THEN x := x - 1 END;
+IF x > 17481 THEN x := x - 1 END;
+IF x > 17482 THEN x := x - 1 END;
+IF x > 17483 THEN x := x - 1 END;
+IF x > 17484 THEN x := x - 1 END;
+IF x > 17485 THEN x := x - 1 END;
+IF x > 17486 THEN x := x - 1 END;
+IF x > 17487 THEN x := x - 1 END;
+IF x > 17488 THEN x := x - 1 END;
+IF x > 17489 THEN x := x - 1 END;
+IF x > 17490 THEN x := x - 1 END;
+IF x > 17491 THEN x := x - 1 END;
+IF x > 17492 THEN x := x - 1 END;
+IF x > 17493 THEN x := x - 1 END;
+IF x > 17494 THEN x := x - 1 END;
+IF x > 17495 THEN x := x - 1 END;
+IF x > 17496 THEN x := x - 1 END;
+IF x > 17497 THEN x := x - 1 END;
+IF x > 17498 THEN x := x - 1 END;
+IF x > 17499 THEN x := x - 1 END;
+IF x > 17500 THEN x := x - 1 END;
+IF x > 17501 THEN x := x - 1 END;
+IF x > 17502 THEN x := x - 1 END;
+IF x > 17503 THEN x := x - 1 END;
+IF x > 17504 THEN x := x - 1 END;
+IF x > 17505 THEN x := x - 1 END;
+IF x > 17506 THEN x := x - 1 END;
+IF x > 17507 THEN x := x - 1 END;
+IF x > 17508 THEN x := x - 1 END;
+IF x > 17509 THEN x := x - 1 END;
+IF x > 17510 THEN x := x - 1 END;
+IF x > 17511 THEN x := x - 1 END;
+IF x > 17512 THEN x := x - 1 END;
+IF x > 17513 THEN x := x - 1 END;
+IF x > 17514 THEN x := x - 1 END;
+IF x > 17515 THEN x := x - 1 END;
+IF x > 17516 THEN x := x - 1 END;
+IF x > 17517 THEN x := x - 1 END;
+IF x > 17518 THEN x := x - 1 END;
+IF x > 17519 THEN x := x - 1 END;
+IF x > 17520 THEN x := x - 1 END;
+IF x > 17521 THEN x := x - 1 END;
+IF x > 17522 THEN x := x - 1 END;
+IF x > 17523 THEN x := x - 1 END;
+IF x > 17524 THEN x := x - 1 END;
+IF x > 17525 THEN x := x - 1 END;
+IF x > 17526 THEN x := x - 1 END;
+IF x > 17527 THEN x := x - 1 END;
+IF x > 17528 THEN x := x - 1 END;
+IF x > 17529 THEN x := x - 1 END;
+IF x > 17530 THEN x := x - 1 END;
+IF x > 17531 THEN x := x - 1 END;
+IF x > 17532 THEN x := x - 1 END;
+IF x > 17533 THEN x := x - 1 END;
+IF x > 17534 THEN x := x - 1 END;
+IF x > 17535 THEN x := x - 1 END;
+IF x > 17536 THEN x := x - 1 END;
+IF x > 17537 THEN x := x - 1 END;
+IF x > 17538 THEN x := x - 1 END;
+IF x > 17539 THEN x := x - 1 END;
+IF x > 17540 THEN x := x - 1 END;
+IF x > 17541 THEN x := x - 1 END;
+IF x > 17542 THEN x := x - 1 END;
+IF x > 17543 THEN x := x - 1 END;
+IF x > 17544 THEN x := x - 1 END;
+IF x > 17545 THEN x := x - 1 END;
+IF x > 17546 THEN x := x - 1 END;
+IF x > 17547 THEN x := x - 1 END;
+IF x > 17548 THEN x := x - 1 END;
+IF x > 17549 THEN x := x - 1 END;
+IF x > 17550 THEN x := x - 1 END;
+IF x > 17551 THEN x := x - 1 END;
+IF x > 17552 THEN x := x - 1 END;
+IF x > 17553 THEN x := x - 1 END;
+IF x > 17554 THEN x := x - 1 END;
+IF x > 17555 THEN x := x - 1 END;
+IF x > 17556 THEN x := x - 1 END;
+IF x > 17557 THEN x := x - 1 END;
+IF x > 17558 THEN x := x - 1 END;
+IF x > 17559 THEN x := x - 1 END;
+IF x > 17560 THEN x := x - 1 END;
+IF x > 17561 THEN x := x - 1 END;
+IF x > 17562 THEN x := x - 1 END;
+IF x > 17563 THEN x := x - 1 END;
+IF x > 17564 THEN x := x - 1 END;
+IF x > 17565 THEN x := x - 1 END;
+IF x > 17566 THEN x := x - 1 END;
+IF x > 17567 THEN x := x - 1 END;
+IF x > 17568 THEN x := x - 1 END;
+IF x > 17569 THEN x := x - 1 END;
+IF x > 17570 THEN x := x - 1 END;
+IF x > 17571 THEN x := x - 1 END;
+IF x > 17572 THEN x := x - 1 END;
+IF x > 17573 THEN x := x - 1 END;
+IF x > 17574 THEN x := x - 1 END;
+IF x > 17575 THEN x := x - 1 END;
+IF x > 17576 THEN x := x - 1 END;
+IF x > 17577 THEN x := x - 1 END;
+IF x > 17578 THEN x := x - 1 END;
+IF x > 17579 THEN x := x - 1 END;
+IF x > 17580 THEN x := x - 1 END;
+IF x > 17581 THEN x := x - 1 END;
+IF x > 17582 THEN x := x - 1 END;
+IF x > 17583 THEN x := x - 1 END;
+IF x > 17584 THEN x := x - 1 END;
+IF x > 17585 THEN x := x - 1 END;
+IF x > 17586 THEN x := x - 1 END;
+IF x > 17587 THEN x := x - 1 END;
+IF x > 17588 THEN x := x - 1 END;
+IF x > 17589 THEN x := x - 1 END;
+IF x > 17590 THEN x := x - 1 END;
+IF x > 17591 THEN x := x - 1 END;
+IF x > 17592 THEN x := x - 1 END;
+IF x > 17593 THEN x := x - 1 END;
+IF x > 17594 THEN x := x - 1 END;
+IF x > 17595 THEN x := x - 1 END;
+IF x > 17596 THEN x := x - 1 END;
+IF x > 17597 THEN x := x - 1 END;
+IF x > 17598 THEN x := x - 1 END;
+IF x > 17599 THEN x := x - 1 END;
+IF x > 17600 THEN x := x - 1 END;
+IF x > 17601 THEN x := x - 1 END;
+IF x > 17602 THEN x := x - 1 END;
+IF x > 17603 THEN x := x - 1 END;
+IF x > 17604 THEN x := x - 1 END;
+IF x > 17605 THEN x := x - 1 END;
+IF x > 17606 THEN x := x - 1 END;
+IF x > 17607 THEN x := x - 1 END;
+IF x > 17608 THEN x := x - 1 END;
+IF x > 17609 THEN x := x - 1 END;
+IF x > 17610 THEN x := x - 1 END;
+IF x > 17611 THEN x := x - 1 END;
+IF x > 17612 THEN x := x - 1 END;
+IF x > 17613 THEN x := x - 1 END;
+IF x > 17614 THEN x := x - 1 END;
+IF x > 17615 THEN x := x - 1 END;
+IF x > 17616 THEN x := x - 1 END;
+IF x > 17617 THEN x := x - 1 END;
+IF x > 17618 THEN x := x - 1 END;
+IF x > 17619 THEN x := x - 1 END;
+IF x > 17620 THEN x := x - 1 END;
+IF x > 17621 THEN x := x - 1 END;
+IF x > 17622 THEN x := x - 1 END;
+IF x > 17623 THEN x := x - 1 END;
+IF x > 17624 THEN x := x - 1 END;
+IF x > 17625 THEN x := x - 1 END;
+IF x > 17626 THEN x := x - 1 END;
+IF x > 17627 THEN x := x - 1 END;
+IF x > 17628 THEN x := x - 1 END;
+IF x > 17629 THEN x := x - 1 END;
+IF x > 17630 THEN x := x - 1 END;
+IF x > 17631 THEN x := x - 1 END;
+IF x > 17632 THEN x := x - 1 END;
+IF x > 17633 THEN x := x - 1 END;
+IF x > 17634 THEN x := x - 1 END;
+IF x > 17635 THEN x := x - 1 END;
+IF x > 17636 THEN x := x - 1 END;
+IF x > 17637 THEN x := x - 1 END;
+IF x > 17638 THEN x := x - 1 END;
+IF x > 17639 THEN x := x - 1 END;
+IF x > 17640 THEN x := x - 1 END;
+IF x > 17641 THEN x := x - 1 END;
+IF x > 17642 THEN x := x - 1 END;
+IF x > 17643 THEN x := x - 1 END;
+IF x > 17644 THEN x := x - 1 END;
+IF x > 17645 THEN x := x - 1 END;
+IF x > 17646 THEN x := x - 1 END;
+IF x > 17647 THEN x := x - 1 END;
+IF x > 17648 THEN x := x - 1 END;
+IF x > 17649 THEN x := x - 1 END;
+IF x > 17650 THEN x := x - 1 END;
+IF x > 17651 THEN x := x - 1 END;
+IF x > 17652 THEN x := x - 1 END;
+IF x > 17653 THEN x := x - 1 END;
+IF x > 17654 THEN x := x - 1 END;
+IF x > 17655 THEN x := x - 1 END;
+IF x > 17656 THEN x := x - 1 END;
+IF x > 17657 THEN x := x - 1 END;
+IF x > 17658 THEN x := x - 1 END;
+IF x > 17659 THEN x := x - 1 END;
+IF x > 17660 THEN x := x - 1 END;
+IF x > 17661 THEN x := x - 1 END;
+IF x > 17662 THEN x := x - 1 END;
+IF x > 17663 THEN x := x - 1 END;
+IF x > 17664 THEN x := x - 1 END;
+IF x > 17665 THEN x := x - 1 END;
+IF x > 17666 THEN x := x - 1 END;
+IF x > 17667 THEN x := x - 1 END;
+IF x > 17668 THEN x := x - 1 END;
+IF x > 17669 THEN x := x - 1 END;
+IF x > 17670 THEN x := x - 1 END;
+IF x > 17671 THEN x := x - 1 END;
+IF x > 17672 THEN x := x - 1 END;
+IF x > 17673 THEN x := x - 1 END;
+IF x > 17674 THEN x := x - 1 END;
+IF x > 17675 THEN x := x - 1 END;
+IF x > 17676 THEN x := x - 1 END;
+IF x > 17677 THEN x := x - 1 END;
+IF x > 17678 THEN x := x - 1 END;
+IF x > 17679 THEN x := x - 1 END;
+IF x > 17680 THEN x := x - 1 END;
+IF x > 17681 THEN x := x - 1 END;
+IF x > 17682 THEN x := x - 1 END;
+IF x > 17683 THEN x := x - 1 END;
+IF x > 17684 THEN x := x - 1 END;
+IF x > 17685 THEN x := x - 1 END;
+IF x > 17686 THEN x := x - 1 END;
+IF x > 17687 THEN x := x - 1 END;
+IF x > 17688 THEN x := x - 1 END;
+IF x > 17689 THEN x := x - 1 END;
+IF x > 17690 THEN x := x - 1 END;
+IF x > 17691 THEN x := x - 1 END;
+IF x > 17692 THEN x := x - 1 END;
+IF x > 17693 THEN x := x - 1 END;
+IF x > 17694 THEN x := x - 1 END;
+IF x > 17695 THEN x := x - 1 END;
+IF x > 17696 THEN x := x - 1 END;
+IF x > 17697 THEN x := x - 1 END;
+IF x > 17698 THEN x := x - 1 END;
+IF x > 17699 THEN x := x - 1 END;
+IF x > 17700 THEN x := x - 1 END;
+IF x > 17701 THEN x := x - 1 END;
+IF x > 17702 THEN x := x - 1 END;
+IF x > 17703 THEN x := x - 1 END;
+IF x > 17704 THEN x := x - 1 END;
+IF x > 17705 THEN x := x - 1 END;
+IF x > 17706 THEN x := x - 1 END;
+IF x > 17707 THEN x := x - 1 END;
+IF x > 17708 THEN x := x - 1 END;
+IF x > 17709 THEN x := x - 1 END;
+IF x > 17710 THEN x := x - 1 END;
+IF x > 17711 THEN x := x - 1 END;
+IF x > 17712 THEN x := x - 1 END;
+IF x > 17713 THEN x := x - 1 END;
+IF x > 17714 THEN x := x - 1 END;
+IF x > 17715 THEN x := x - 1 END;
+IF x > 17716 THEN x := x - 1 END;
+IF x > 17717 THEN x := x - 1 END;
+IF x > 17718 THEN x := x - 1 END;
+IF x > 17719 THEN x := x - 1 END;
+IF x > 17720 THEN x := x - 1 END;
+IF x > 17721 THEN x := x - 1 END;
+IF x > 17722 THEN x := x - 1 END;
+IF x > 17723 THEN x := x - 1 END;
+IF x > 17724 THEN x := x - 1 END;
+IF x > 17725 THEN x := x - 1 END;
+IF x > 17726 THEN x := x - 1 END;
+IF x > 17727 THEN x := x - 1 END;
+IF x > 17728 THEN x := x - 1 END;
+IF x > 17729 THEN x := x - 1 END;
+IF x > 17730 THEN x := x - 1 END;
+IF x > 17731 THEN x := x - 1 END;
+IF x > 17732 THEN x := x - 1 END;
+IF x > 17733 THEN x := x - 1 END;
+IF x > 17734 THEN x := x - 1 END;
+IF x > 17735 THEN x := x - 1 END;
+IF x > 17736 THEN x := x - 1 END;
+IF x > 17737 THEN x := x - 1 END;
+IF x > 17738 THEN x := x - 1 END;
+IF x > 17739 THEN x := x - 1 END;
+IF x > 17740 THEN x := x - 1 END;
+IF x > 17741 THEN x := x - 1 END;
+IF x > 17742 THEN x := x - 1 END;
+IF x > 17743 THEN x := x - 1 END;
+IF x > 17744 THEN x := x - 1 END;
+IF x > 17745 THEN x := x - 1 END;
+IF x > 17746 THEN x := x - 1 END;
+IF x > 17747 THEN x := x - 1 END;
+IF x > 17748 THEN x := x - 1 END;
+IF x > 17749 THEN x := x - 1 END;
+IF x > 17750 THEN x := x - 1 END;
+IF x > 17751 THEN x := x - 1 END;
+IF x > 17752 THEN x := x - 1 END;
+IF x > 17753 THEN x := x - 1 END;
+IF x > 17754 THEN x := x - 1 END;
+IF x > 17755 THEN x := x - 1 END;
+IF x > 17756 THEN x := x - 1 END;
+IF x > 17757 THEN x := x - 1 END;
+IF x > 17758 THEN x := x - 1 END;
+IF x > 17759 THEN x := x - 1 END;
+IF x > 17760 THEN x := x - 1 END;
+IF x > 17761 THEN x := x - 1 END;
+IF x > 17762 THEN x := x - 1 END;
+IF x > 17763 THEN x := x - 1 END;
+IF x > 17764 THEN x := x - 1 END;
+IF x > 17765 THEN x := x - 1 END;
+IF x > 17766 THEN x := x - 1 END;
+IF x > 17767 THEN x := x - 1 END;
+IF x > 17768 THEN x := x - 1 END;
+IF x > 17769 THEN x := x - 1 END;
+IF x > 17770 THEN x := x - 1 END;
+IF x > 17771 THEN x := x - 1 END;
+IF x > 17772 THEN x := x - 1 END;
+IF x > 17773 THEN x := x - 1 END;
+IF x > 17774 THEN x := x - 1 END;
+IF x > 17775 THEN x := x - 1 END;
+IF x > 17776 THEN x := x - 1 END;
+IF x > 17777 THEN x := x - 1 END;
+IF x > 17778 THEN x := x - 1 END;
+IF x > 17779 THEN x := x - 1 END;
+IF x > 17780 THEN x := x - 1 END;
+IF x > 17781 THEN x := x - 1 END;
+IF x > 17782 THEN x := x - 1 END;
+IF x > 17783 THEN x := x - 1 END;
+IF x > 17784 THEN x := x - 1 END;
+IF x > 17785 THEN x := x - 1 END;
+IF x > 17786 THEN x := x - 1 END;
+IF x > 17787 THEN x := x - 1 END;
+IF x > 17788 THEN x := x - 1 END;
+IF x > 17789 THEN x := x - 1 END;
+IF x > 17790 THEN x := x - 1 END;
+IF x > 17791 THEN x := x - 1 END;
+IF x > 17792 THEN x := x - 1 END;
+IF x > 17793 THEN x := x - 1 END;
+IF x > 17794 THEN x := x - 1 END;
+IF x > 17795 THEN x := x - 1 END;
+IF x > 17796 THEN x := x - 1 END;
+IF x > 17797 THEN x := x - 1 END;
+IF x > 17798 THEN x := x - 1 END;
+IF x > 17799 THEN x := x - 1 END;
+IF x > 17800 THEN x := x - 1 END;
+IF x > 17801 THEN x := x - 1 END;
+IF x > 17802 THEN x := x - 1 END;
+IF x > 17803 THEN x := x - 1 END;
+IF x > 17804 THEN x := x - 1 END;
+IF x > 17805 THEN x := x - 1 END;
+IF x > 17806 THEN x := x - 1 END;
+IF x > 17807 THEN x := x - 1 END;
+IF x > 17808 THEN x := x - 1 END;
+IF x > 17809 THEN x := x - 1 END;
+IF x > 17810 THEN x := x - 1 END;
+IF x > 17811 THEN x := x - 1 END;
+IF x > 17812 THEN x := x - 1 END;
+IF x > 17813 THEN x := x - 1 END;
+IF x > 17814 THEN x := x - 1 END;
+IF x > 17815 THEN x := x - 1 END;
+IF x > 17816 THEN x := x - 1 END;
+IF x > 17817 THEN x := x - 1 END;
+IF x > 17818 THEN x := x - 1 END;
+IF x > 17819 THEN x := x - 1 END;
+IF x > 17820 THEN x := x - 1 END;
+IF x > 17821 THEN x := x - 1 END;
+IF x > 17822 THEN x := x - 1 END;
+IF x > 17823 THEN x := x - 1 END;
+IF x > 17824 THEN x := x - 1 END;
+IF x > 17825 THEN x := x - 1 END;
+IF x > 17826 THEN x := x - 1 END;
+IF x > 17827 THEN x := x - 1 END;
+IF x > 17828 THEN x := x - 1 END;
+IF x > 17829 THEN x := x - 1 END;
+IF x > 17830 THEN x := x - 1 END;
+IF x > 17831 THEN x := x - 1 END;
+IF x > 17832 THEN x := x - 1 END;
+IF x > 17833 THEN x := x - 1 END;
+IF x > 17834 THEN x := x - 1 END;
+IF x > 17835 THEN x := x - 1 END;
+IF x > 17836 THEN x := x - 1 END;
+IF x > 17837 THEN x := x - 1 END;
+IF x > 17838 THEN x := x - 1 END;
+IF x > 17839 THEN x := x - 1 END;
+IF x > 17840 THEN x := x - 1 END;
+IF x > 17841 THEN x := x - 1 END;
+IF x > 17842 THEN x := x - 1 END;
+IF x > 17843 THEN x := x - 1 END;
+IF x > 17844 THEN x := x - 1 END;
+IF x > 17845 THEN x := x - 1 END;
+IF x > 17846 THEN x := x - 1 END;
+IF x > 17847 THEN x := x - 1 END;
+IF x > 17848 THEN x := x - 1 END;
+IF x > 17849 THEN x := x - 1 END;
+IF x > 17850 THEN x := x - 1 END;
+IF x > 17851 THEN x := x - 1 END;
+IF x > 17852 THEN x := x - 1 END;
+IF x > 17853 THEN x := x - 1 END;
+IF x > 17854 THEN x := x - 1 END;
+IF x > 17855 THEN x := x - 1 END;
+IF x > 17856 THEN x := x - 1 END;
+IF x > 17857 THEN x := x - 1 END;
+IF x > 17858 THEN x := x - 1 END;
+IF x > 17859 THEN x := x - 1 END;
+IF x > 17860 THEN x := x - 1 END;
+IF x > 17861 THEN x := x - 1 END;
+IF x > 17862 THEN x := x - 1 END;
+IF x > 17863 THEN x := x - 1 END;
+IF x > 17864 THEN x := x - 1 END;
+IF x > 17865 THEN x := x - 1 END;
+IF x > 17866 THEN x := x - 1 END;
+IF x > 17867 THEN x := x - 1 END;
+IF x > 17868 THEN x := x - 1 END;
+IF x > 17869 THEN x := x - 1 END;
+IF x > 17870 THEN x := x - 1 END;
+IF x > 17871 THEN x := x - 1 END;
+IF x > 17872 THEN x := x - 1 END;
+IF x > 17873 THEN x := x - 1 END;
+IF x > 17874 THEN x := x - 1 END;
+IF x > 17875 THEN x := x - 1 END;
+IF x > 17876 THEN x := x - 1 END;
+IF x > 17877 THEN x := x - 1 END;
+IF x > 17878 THEN x := x - 1 END;
+IF x > 17879 THEN x := x - 1 END;
+IF x > 17880 THEN x := x - 1 END;
+IF x > 17881 THEN x := x - 1 END;
+IF x > 17882 THEN x := x - 1 END;
+IF x > 17883 THEN x := x - 1 END;
+IF x > 17884 THEN x := x - 1 END;
+IF x > 17885 THEN x := x - 1 END;
+IF x > 17886 THEN x := x - 1 END;
+IF x > 17887 THEN x := x - 1 END;
+IF x > 17888 THEN x := x - 1 END;
+IF x > 17889 THEN x := x - 1 END;
+IF x > 17890 THEN x := x - 1 END;
+IF x > 17891 THEN x := x - 1 END;
+IF x > 17892 THEN x := x - 1 END;
+IF x > 17893 THEN x := x - 1 END;
+IF x > 17894 THEN x := x - 1 END;
+IF x > 17895 THEN x := x - 1 END;
+IF x > 17896 THEN x := x - 1 END;
+IF x > 17897 THEN x := x - 1 END;
+IF x > 17898 THEN x := x - 1 END;
+IF x > 17899 THEN x := x - 1 END;
+IF x > 17900 THEN x := x - 1 END;
+IF x > 17901 THEN x := x - 1 END;
+IF x > 17902 THEN x := x - 1 END;
+IF x > 17903 THEN x := x - 1 END;
+IF x > 17904 THEN x := x - 1 END;
+IF x > 17905 THEN x := x - 1 END;
+IF x > 17906 THEN x := x - 1 END;
+IF x > 17907 THEN x := x - 1 END;
+IF x > 17908 THEN x := x - 1 END;
+IF x > 17909 THEN x := x - 1 END;
+IF x > 17910 THEN x := x - 1 END;
+IF x > 17911 THEN x := x - 1 END;
+IF x > 17912 THEN x := x - 1 END;
+IF x > 17913 THEN x := x - 1 END;
+IF x > 17914 THEN x := x - 1 END;
+IF x > 17915 THEN x := x - 1 END;
+IF x > 17916 THEN x := x - 1 END;
+IF x > 17917 THEN x := x - 1 END;
+IF x > 17918 THEN x := x - 1 END;
+IF x > 17919 THEN x := x - 1 END;
+IF x > 17920 THEN x := x - 1 END;
+IF x > 17921 THEN x := x - 1 END;
+IF x > 17922 THEN x := x - 1 END;
+IF x > 17923 THEN x := x - 1 END;
+IF x > 17924 THEN x := x - 1 END;
+IF x > 17925 THEN x := x - 1 END;
+IF x > 17926 THEN x := x - 1 END;
+IF x > 17927 THEN x := x - 1 END;
+IF x > 17928 THEN x := x - 1 END;
+IF x > 17929 THEN x := x - 1 END;
+IF x > 17930 THEN x := x - 1 END;
+IF x > 17931 THEN x := x - 1 END;
+IF x > 17932 THEN x := x - 1 END;
+IF x > 17933 THEN x := x - 1 END;
+IF x > 17934 THEN x := x - 1 END;
+IF x > 17935 THEN x := x - 1 END;
+IF x > 17936 THEN x := x - 1 END;
+IF x > 17937 THEN x := x - 1 END;
+IF x > 17938 THEN x := x - 1 END;
+IF x > 17939 THEN x := x - 1 END;
+IF x > 17940 THEN x := x - 1 END;
+IF x > 17941 THEN x := x - 1 END;
+IF x > 17942 THEN x := x - 1 END;
+IF x > 17943 THEN x := x - 1 END;
+IF x > 17944 THEN x := x - 1 END;
+IF x > 17945 THEN x := x - 1 END;
+IF x > 17946 THEN x := x - 1 END;
+IF x > 17947 THEN x := x - 1 END;
+IF x > 17948 THEN x := x - 1 END;
+IF x > 17949 THEN x := x - 1 END;
+IF x > 17950 THEN x := x - 1 END;
+IF x > 17951 THEN x := x - 1 END;
+IF x > 17952 THEN x := x - 1 END;
+IF x > 17953 THEN x := x - 1 END;
+IF x > 17954 THEN x := x - 1 END;
+IF x > 17955 THEN x := x - 1 END;
+IF x > 17956 THEN x := x - 1 END;
+IF x > 17957 THEN x := x - 1 END;
+IF x > 17958 THEN x := x - 1 END;
+IF x > 17959 THEN x := x - 1 END;
+IF x > 17960 THEN x := x - 1 END;
+IF x > 17961 THEN x := x - 1 END;
+IF x > 17962 THEN x := x - 1 END;
+IF x > 17963 THEN x := x - 1 END;
+IF x > 17964 THEN x := x - 1 END;
+IF x > 17965 THEN x := x - 1 END;
+IF x > 17966 THEN x := x - 1 END;
+IF x > 17967 THEN x := x - 1 END;
+IF x > 17968 THEN x := x - 1 END;
+IF x > 17969 THEN x := x - 1 END;
+IF x > 17970 THEN x := x - 1 END;
+IF x > 17971 THEN x := x - 1 END;
+IF x > 17972 THEN x := x - 1 END;
+IF x > 17973 THEN x := x - 1 END;
+IF x > 17974 THEN x := x - 1 END;
+IF x > 17975 THEN x := x - 1 END;
+IF x > 17976 THEN x := x - 1 END;
+IF x > 17977 THEN x := x - 1 END;
+IF x > 17978 THEN x := x - 1 END;
+IF x > 17979 THEN x := x - 1 END;
+IF x > 17980 THEN x := x - 1 END;
+IF x > 17981 THEN x := x - 1 END;
+IF x > 17982 THEN x := x - 1 END;
+IF x > 17983 THEN x := x - 1 END;
+IF x > 17984 THEN x := x - 1 END;
+IF x > 17985 THEN x := x - 1 END;
+IF x > 17986 THEN x := x - 1 END;
+IF x > 17987 THEN x := x - 1 END;
+IF x > 17988 THEN x := x - 1 END;
+IF x > 17989 THEN x := x - 1 END;
+IF x > 17990 THEN x := x - 1 END;
+IF x > 17991 THEN x := x - 1 END;
+IF x > 17992 THEN x := x - 1 END;
+IF x > 17993 THEN x := x - 1 END;
+IF x > 17994 THEN x := x - 1 END;
+IF x > 17995 THEN x := x - 1 END;
+IF x > 17996 THEN x := x - 1 END;
+IF x > 17997 THEN x := x - 1 END;
+IF x > 17998 THEN x := x - 1 END;
+IF x > 17999 THEN x := x - 1 END;
+IF x > 18000 THEN x := x - 1 END;
+IF x > 18001 THEN x := x - 1 END;
+IF x > 18002 THEN x := x - 1 END;
+IF x > 18003 THEN x := x - 1 END;
+IF x > 18004 THEN x := x - 1 END;
+IF x > 18005 THEN x := x - 1 END;
+IF x > 18006 THEN x := x - 1 END;
+IF x > 18007 THEN x := x - 1 END;
+IF x > 18008 THEN x := x - 1 END;
+IF x > 18009 THEN x := x - 1 END;
+IF x > 18010 THEN x := x - 1 END;
+IF x > 18011 THEN x := x - 1 END;
+IF x > 18012 THEN x := x - 1 END;
+IF x > 18013 THEN x := x - 1 END;
+IF x > 18014 THEN x := x - 1 END;
+IF x > 18015 THEN x := x - 1 END;
+IF x > 18016 THEN x := x - 1 END;
+IF x > 18017 THEN x := x - 1 END;
+IF x > 18018 THEN x := x - 1 END;
+IF x > 18019 THEN x := x - 1 END;
+IF x > 18020 THEN x := x - 1 END;
+IF x > 18021 THEN x := x - 1 END;
+IF x > 18022 THEN x := x - 1 END;
+IF x > 18023 THEN x := x - 1 END;
+IF x > 18024 THEN x := x - 1 END;
+IF x > 18025 THEN x := x - 1 END;
+IF x > 18026 THEN x := x - 1 END;
+IF x > 18027 THEN x := x - 1 END;
+IF x > 18028 THEN x := x - 1 END;
+IF x > 18029 THEN x := x - 1 END;
+IF x > 18030 THEN x := x - 1 END;
+IF x > 18031 THEN x := x - 1 END;
+IF x > 18032 THEN x := x - 1 END;
+IF x > 18033 THEN x := x - 1 END;
+IF x > 18034 THEN x := x - 1 END;
+IF x > 18035 THEN x := x - 1 END;
+IF x > 18036 THEN x := x - 1 END;
+IF x > 18037 THEN x := x - 1 END;
+IF x > 18038 THEN x := x - 1 END;
+IF x > 18039 THEN x := x - 1 END;
+IF x > 18040 THEN x := x - 1 END;
+IF x > 18041 THEN x := x - 1 END;
+IF x > 18042 THEN x := x - 1 END;
+IF x > 18043 THEN x := x - 1 END;
+IF x > 18044 THEN x := x - 1 END;
+IF x > 18045 THEN x := x - 1 END;
+IF x > 18046 THEN x := x - 1 END;
+IF x > 18047 THEN x := x - 1 END;
+IF x > 18048 THEN x := x - 1 END;
+IF x > 18049 THEN x := x - 1 END;
+IF x > 18050 THEN x := x - 1 END;
+IF x > 18051 THEN x := x - 1 END;
+IF x > 18052 THEN x := x - 1 END;
+IF x > 18053 THEN x := x - 1 END;
+IF x > 18054 THEN x := x - 1 END;
+IF x > 18055 THEN x := x - 1 END;
+IF x > 18056 THEN x := x - 1 END;
+IF x > 18057 THEN x := x - 1 END;
+IF x > 18058 THEN x := x - 1 END;
+IF x > 18059 THEN x := x - 1 END;
+IF x > 18060 THEN x := x - 1 END;
+IF x > 18061 THEN x := x - 1 END;
+IF x > 18062 THEN x := x - 1 END;
+IF x > 18063 THEN x := x - 1 END;
+IF x > 18064 THEN x := x - 1 END;
+IF x > 18065 THEN x := x - 1 END;
+IF x > 18066 THEN x := x - 1 END;
+IF x > 18067 THEN x := x - 1 END;
+IF x > 18068 THEN x := x - 1 END;
+IF x > 18069 THEN x := x - 1 END;
+IF x > 18070 THEN x := x - 1 END;
+IF x > 18071 THEN x := x - 1 END;
+IF x > 18072 THEN x := x - 1 END;
+IF x > 18073 THEN x := x - 1 END;
+IF x > 18074 THEN x := x - 1 END;
+IF x > 18075 THEN x := x - 1 END;
+IF x > 18076 THEN x := x - 1 END;
+IF x > 18077 THEN x := x - 1 END;
+IF x > 18078 THEN x := x - 1 END;
+IF x > 18079 THEN x := x - 1 END;
+IF x > 18080 THEN x := x - 1 END;
+IF x > 18081 THEN x := x - 1 END;
+IF x > 18082 THEN x := x - 1 END;
+IF x > 18083 THEN x := x - 1 END;
+IF x > 18084 THEN x := x - 1 END;
+IF x > 18085 THEN x := x - 1 END;
+IF x > 18086 THEN x := x - 1 END;
+IF x > 18087 THEN x := x - 1 END;
+IF x > 18088 THEN x := x - 1 END;
+IF x > 18089 THEN x := x - 1 END;
+IF x > 18090 THEN x := x - 1 END;
+IF x > 18091 THEN x := x - 1 END;
+IF x > 18092 THEN x := x - 1 END;
+IF x > 18093 THEN x := x - 1 END;
+IF x > 18094 THEN x := x - 1 END;
+IF x > 18095 THEN x := x - 1 END;
+IF x > 18096 THEN x := x - 1 END;
+IF x > 18097 THEN x := x - 1 END;
+IF x > 18098 THEN x := x - 1 END;
+IF x > 18099 THEN x := x - 1 END;
+IF x > 18100 THEN x := x - 1 END;
+IF x > 18101 THEN x := x - 1 END;
+IF x > 18102 THEN x := x - 1 END;
+IF x > 18103 THEN x := x - 1 END;
+IF x > 18104 THEN x := x - 1 END;
+IF x > 18105 THEN x := x - 1 END;
+IF x > 18106 THEN x := x - 1 END;
+IF x > 18107 THEN x := x - 1 END;
+IF x > 18108 THEN x := x - 1 END;
+IF x > 18109 THEN x := x - 1 END;
+IF x > 18110 THEN x := x - 1 END;
+IF x > 18111 THEN x := x - 1 END;
+IF x > 18112 THEN x := x - 1 END;
+IF x > 18113 THEN x := x - 1 END;
+IF x > 18114 THEN x := x - 1 END;
+IF x > 18115 THEN x := x - 1 END;
+IF x > 18116 THEN x := x - 1 END;
+IF x > 18117 THEN x := x - 1 END;
+IF x > 18118 THEN x := x - 1 END;
+IF x > 18119 THEN x := x - 1 END;
+IF x > 18120 THEN x := x - 1 END;
+IF x > 18121 THEN x := x - 1 END;
+IF x > 18122 THEN x := x - 1 END;
+IF x > 18123 THEN x := x - 1 END;
+IF x > 18124 THEN x := x - 1 END;
+IF x > 18125 THEN x := x - 1 END;
+IF x > 18126 THEN x := x - 1 END;
+IF x > 18127 THEN x := x - 1 END;
+IF x > 18128 THEN x := x - 1 END;
+IF x > 18129 THEN x := x - 1 END;
+IF x > 18130 THEN x := x - 1 END;
+IF x > 18131 THEN x := x - 1 END;
+IF x > 18132 THEN x := x - 1 END;
+IF x > 18133 THEN x := x - 1 END;
+IF x > 18134 THEN x := x - 1 END;
+IF x > 18135 THEN x := x - 1 END;
+IF x > 18136 THEN x := x - 1 END;
+IF x > 18137 THEN x := x - 1 END;
+IF x > 18138 THEN x := x - 1 END;
+IF x > 18139 THEN x := x - 1 END;
+IF x > 18140 THEN x := x - 1 END;
+IF x > 18141 THEN x := x - 1 END;
+IF x > 18142 THEN x := x - 1 END;
+IF x > 18143 THEN x := x - 1 END;
+IF x > 18144 THEN x := x - 1 END;
+IF x > 18145 THEN x := x - 1 END;
+IF x > 18146 THEN x := x - 1 END;
+IF x > 18147 THEN x := x - 1 END;
+IF x > 18148 THEN x := x - 1 END;
+IF x > 18149 THEN x := x - 1 END;
+IF x > 18150 THEN x := x - 1 END;
+IF x > 18151 THEN x := x - 1 END;
+IF x > 18152 THEN x := x - 1 END;
+IF x > 18153 THEN x := x - 1 END;
+IF x > 18154 THEN x := x - 1 END;
+IF x > 18155 THEN x := x - 1 END;
+IF x > 18156 THEN x := x - 1 END;
+IF x > 18157 THEN x := x - 1 END;
+IF x > 18158 THEN x := x - 1 END;
+IF x > 18159 THEN x := x - 1 END;
+IF x > 18160 THEN x := x - 1 END;
+IF x > 18161 THEN x := x - 1 END;
+IF x > 18162 THEN x := x - 1 END;
+IF x > 18163 THEN x := x - 1 END;
+IF x > 18164 THEN x := x - 1 END;
+IF x > 18165 THEN x := x - 1 END;
+IF x > 18166 THEN x := x - 1 END;
+IF x > 18167 THEN x := x - 1 END;
+IF x > 18168 THEN x := x - 1 END;
+IF x > 18169 THEN x := x - 1 END;
+IF x > 18170 THEN x := x - 1 END;
+IF x > 18171 THEN x := x - 1 END;
+IF x > 18172 THEN x := x - 1 END;
+IF x > 18173 THEN x := x - 1 END;
+IF x > 18174 THEN x := x - 1 END;
+IF x > 18175 THEN x := x - 1 END;
+IF x > 18176 THEN x := x - 1 END;
+IF x > 18177 THEN x := x - 1 END;
+IF x > 18178 THEN x := x - 1 END;
+IF x > 18179 THEN x := x - 1 END;
+IF x > 18180 THEN x := x - 1 END;
+IF x > 18181 THEN x := x - 1 END;
+IF x > 18182 THEN x := x - 1 END;
+IF x > 18183 THEN x := x - 1 END;
+IF x > 18184 THEN x := x - 1 END;
+IF x > 18185 THEN x := x - 1 END;
+IF x > 18186 THEN x := x - 1 END;
+IF x > 18187 THEN x := x - 1 END;
+IF x > 18188 THEN x := x - 1 END;
+IF x > 18189 THEN x := x - 1 END;
+IF x > 18190 THEN x := x - 1 END;
+IF x > 18191 THEN x := x - 1 END;
+IF x > 18192 THEN x := x - 1 END;
+IF x > 18193 THEN x := x - 1 END;
+IF x > 18194 THEN x := x - 1 END;
+IF x > 18195 THEN x := x - 1 END;
+IF x > 18196 THEN x := x - 1 END;
+IF x > 18197 THEN x := x - 1 END;
+IF x > 18198 THEN x := x - 1 END;
+IF x > 18199 THEN x := x - 1 END;
+IF x > 18200 THEN x := x - 1 END;
+IF x > 18201 THEN x := x - 1 END;
+IF x > 18202 THEN x := x - 1 END;
+IF x > 18203 THEN x := x - 1 END;
+IF x > 18204 THEN x := x - 1 END;
+IF x > 18205 THEN x := x - 1 END;
+IF x > 18206 THEN x := x - 1 END;
+IF x > 18207 THEN x := x - 1 END;
+IF x > 18208 THEN x := x - 1 END;
+IF x > 18209 THEN x := x - 1 END;
+IF x > 18210 THEN x := x - 1 END;
+IF x > 18211 THEN x := x - 1 END;
+IF x > 18212 THEN x := x - 1 END;
+IF x > 18213 THEN x := x - 1 END;
+IF x > 18214 THEN x := x - 1 END;
+IF x > 18215 THEN x := x - 1 END;
+IF x > 18216 THEN x := x - 1 END;
+IF x > 18217 THEN x := x - 1 END;
+IF x > 18218 THEN x := x - 1 END;
+IF x > 18219 THEN x := x - 1 END;
+IF x > 18220 THEN x := x - 1 END;
+IF x > 18221 THEN x := x - 1 END;
+IF x > 18222 THEN x := x - 1 END;
+IF x > 18223 THEN x := x - 1 END;
+IF x > 18224 THEN x := x - 1 END;
+IF x > 18225 THEN x := x - 1 END;
+IF x > 18226 THEN x := x - 1 END;
+IF x > 18227 THEN x := x - 1 END;
+IF x > 18228 THEN x := x - 1 END;
+IF x > 18229 THEN x := x - 1 END;
+IF x > 18230 THEN x := x - 1 END;
+IF x > 18231 THEN x := x - 1 END;
+IF x > 18232 THEN x := x - 1 END;
+IF x > 18233 THEN x := x - 1 END;
+IF x > 18234 THEN x := x - 1 END;
+IF x > 18235 THEN x := x - 1 END;
+IF x > 18236 THEN x := x - 1 END;
+IF x > 18237 THEN x := x - 1 END;
+IF x > 18238 THEN x := x - 1 END;
+IF x > 18239 THEN x := x - 1 END;
+IF x > 18240 THEN x := x - 1 END;
+IF x > 18241 THEN x := x - 1 END;
+IF x > 18242 THEN x := x - 1 END;
+IF x > 18243 THEN x := x - 1 END;
+IF x > 18244 THEN x := x - 1 END;
+IF x > 18245 THEN x := x - 1 END;
+IF x > 18246 THEN x := x - 1 END;
+IF x > 18247 THEN x := x - 1 END;
+IF x > 18248 THEN x := x - 1 END;
+IF x > 18249 THEN x := x - 1 END;
+IF x > 18250 THEN x := x - 1 END;
+IF x > 18251 THEN x := x - 1 END;
+IF x > 18252 THEN x := x - 1 END;
+IF x > 18253 THEN x := x - 1 END;
+IF x > 18254 THEN x := x - 1 END;
+IF x > 18255 THEN x := x - 1 END;
+IF x > 18256 THEN x := x - 1 END;
+IF x > 18257 THEN x := x - 1 END;
+IF x > 18258 THEN x := x - 1 END;
+IF x > 18259 THEN x := x - 1 END;
+IF x > 18260 THEN x := x - 1 END;
+IF x > 18261 THEN x := x - 1 END;
+IF x > 18262 THEN x := x - 1 END;
+IF x > 18263 THEN x := x - 1 END;
+IF x > 18264 THEN x := x - 1 END;
+IF x > 18265 THEN x := x - 1 END;
+IF x > 18266 THEN x := x - 1 END;
+IF x > 18267 THEN x := x - 1 END;
+IF x > 18268 THEN x := x - 1 END;
+IF x > 18269 THEN x := x - 1 END;
+IF x > 18270 THEN x := x - 1 END;
+IF x > 18271 THEN x := x - 1 END;
+IF x > 18272 THEN x := x - 1 END;
+IF x > 18273 THEN x := x - 1 END;
+IF x > 18274 THEN x := x - 1 END;
+IF x > 18275 THEN x := x - 1 END;
+IF x > 18276 THEN x := x - 1 END;
+IF x > 18277 THEN x := x - 1 END;
+IF x > 18278 THEN x := x - 1 END;
+IF x > 18279 THEN x := x - 1 END;
+IF x > 18280 THEN x := x - 1 END;
+IF x > 18281 THEN x := x - 1 END;
+IF x > 18282 THEN x := x - 1 END;
+IF x > 18283 THEN x := x - 1 END;
+IF x > 18284 THEN x := x - 1 END;
+IF x > 18285 THEN x := x - 1 END;
+IF x > 18286 THEN x := x - 1 END;
+IF x > 18287 THEN x := x - 1 END;
+IF x > 18288 THEN x := x - 1 END;
+IF x > 18289 THEN x := x - 1 END;
+IF x > 18290 THEN x := x - 1 END;
+IF x > 18291 THEN x := x - 1 END;
+IF x > 18292 THEN x := x - 1 END;
+IF x > 18293 THEN x := x - 1 END;
+IF x > 18294 THEN x := x - 1 END;
+IF x > 18295 THEN x := x - 1 END;
+IF x > 18296 THEN x := x - 1 END;
+IF x > 18297 THEN x := x - 1 END;
+IF x > 18298 THEN x := x - 1 END;
+IF x > 18299 THEN x := x - 1 END;
+IF x > 18300 THEN x := x - 1 END;
+IF x > 18301 THEN x := x - 1 END;
+IF x > 18302 THEN x := x - 1 END;
+IF x > 18303 THEN x := x - 1 END;
+IF x > 18304 THEN x := x - 1 END;
+IF x > 18305 THEN x := x - 1 END;
+IF x > 18306 THEN x := x - 1 END;
+IF x > 18307 THEN x := x - 1 END;
+IF x > 18308 THEN x := x - 1 END;
+IF x > 18309 THEN x := x - 1 END;
+IF x > 18310 THEN x := x - 1 END;
+IF x > 18311 THEN x := x - 1 END;
+IF x > 18312 THEN x := x - 1 END;
+IF x > 18313 THEN x := x - 1 END;
+IF x > 18314 THEN x := x - 1 END;
+IF x > 18315 THEN x := x - 1 END;
+IF x > 18316 THEN x := x - 1 END;
+IF x > 18317 THEN x := x - 1 END;
+IF x > 18318 THEN x := x - 1 END;
+IF x > 18319 THEN x := x - 1 END;
+IF x > 18320 THEN x := x - 1 END;
+IF x > 18321 THEN x := x - 1 END;
+IF x > 18322 THEN x := x - 1 END;
+IF x > 18323 THEN x := x - 1 END;
+IF x > 18324 THEN x := x - 1 END;
+IF x > 18325 THEN x := x - 1 END;
+IF x > 18326 THEN x := x - 1 END;
+IF x > 18327 THEN x := x - 1 END;
+IF x > 18328 THEN x := x - 1 END;
+IF x > 18329 THEN x := x - 1 END;
+IF x > 18330 THEN x := x - 1 END;
+IF x > 18331 THEN x := x - 1 END;
+IF x > 18332 THEN x := x - 1 END;
+IF x > 18333 THEN x := x - 1 END;
+IF x > 18334 THEN x := x - 1 END;
+IF x > 18335 THEN x := x - 1 END;
+IF x > 18336 THEN x := x - 1 END;
+IF x > 18337 THEN x := x - 1 END;
+IF x > 18338 THEN x := x - 1 END;
+IF x > 18339 THEN x := x - 1 END;
+IF x > 18340 THEN x := x - 1 END;
+IF x > 18341 THEN x := x - 1 END;
+IF x > 18342 THEN x := x - 1 END;
+IF x > 18343 THEN x := x - 1 END;
+IF x > 18344 THEN x := x - 1 END;
+IF x > 18345 THEN x := x - 1 END;
+IF x > 18346 THEN x := x - 1 END;
+IF x > 18347 THEN x := x - 1 END;
+IF x > 18348 THEN x := x - 1 END;
+IF x > 18349 THEN x := x - 1 END;
+IF x > 18350 THEN x := x - 1 END;
+IF x > 18351 THEN x := x - 1 END;
+IF x > 18352 THEN x := x - 1 END;
+IF x > 18353 THEN x := x - 1 END;
+IF x > 18354 THEN x := x - 1 END;
+IF x > 18355 THEN x := x - 1 END;
+IF x > 18356 THEN x := x - 1 END;
+IF x > 18357 THEN x := x - 1 END;
+IF x > 18358 THEN x := x - 1 END;
+IF x > 18359 THEN x := x - 1 END;
+IF x > 18360 THEN x := x - 1 END;
+IF x > 18361 THEN x := x - 1 END;
+IF x > 18362 THEN x := x - 1 END;
+IF x > 18363 THEN x := x - 1 END;
+IF x > 18364 THEN x := x - 1 END;
+IF x > 18365 THEN x := x - 1 END;
+IF x > 18366 THEN x := x - 1 END;
+IF x > 18367 THEN x := x - 1 END;
+IF x > 18368 THEN x := x - 1 END;
+IF x > 18369 THEN x := x - 1 END;
+IF x > 18370 THEN x := x - 1 END;
+IF x > 18371 THEN x := x - 1 END;
+IF x > 18372 THEN x := x - 1 END;
+IF x > 18373 THEN x := x - 1 END;
+IF x > 18374 THEN x := x - 1 END;
+IF x > 18375 THEN x := x - 1 END;
+IF x > 18376 THEN x := x - 1 END;
+IF x > 18377 THEN x := x - 1 END;
+IF x > 18378 THEN x := x - 1 END;
+IF x > 18379 THEN x := x - 1 END;
+IF x > 18380 THEN x := x - 1 END;
+IF x > 18381 THEN x := x - 1 END;
+IF x > 18382 THEN x := x - 1 END;
+IF x > 18383 THEN x := x - 1 END;
+IF x > 18384 THEN x := x - 1 END;
+IF x > 18385 THEN x := x - 1 END;
+IF x > 18386 THEN x := x - 1 END;
+IF x > 18387 THEN x := x - 1 END;
+IF x > 18388 THEN x := x - 1 END;
+IF x > 18389 THEN x := x - 1 END;
+IF x > 18390 THEN x := x - 1 END;
+IF x > 18391 THEN x := x - 1 END;
+IF x > 18392 THEN x := x - 1 END;
+IF x > 18393 THEN x := x - 1 END;
+IF x > 18394 THEN x := x - 1 END;
+IF x > 18395 THEN x := x - 1 END;
+IF x > 18396 THEN x := x - 1 END;
+IF x > 18397 THEN x := x - 1 END;
+IF x > 18398 THEN x := x - 1 END;
+IF x > 18399 THEN x := x - 1 END;
+IF x > 18400 THEN x := x - 1 END;
+IF x > 18401 THEN x := x - 1 END;
+IF x > 18402 THEN x := x - 1 END;
+IF x > 18403 THEN x := x - 1 END;
+IF x > 18404 THEN x := x - 1 END;
+IF x > 18405 THEN x := x - 1 END;
+IF x > 18406 THEN x := x - 1 END;
+IF x > 18407 THEN x := x - 1 END;
+IF x > 18408 THEN x := x - 1 END;
+IF x > 18409 THEN x := x - 1 END;
+IF x > 18410 THEN x := x - 1 END;
+IF x > 18411 THEN x := x - 1 END;
+IF x > 18412 THEN x := x - 1 END;
+IF x > 18413 THEN x := x - 1 END;
+IF x > 18414 THEN x := x - 1 END;
+IF x > 18415 THEN x := x - 1 END;
+IF x > 18416 THEN x := x - 1 END;
+IF x > 18417 THEN x := x - 1 END;
+IF x > 18418 THEN x := x - 1 END;
+IF x > 18419 THEN x := x - 1 END;
+IF x > 18420 THEN x := x - 1 END;
+IF x > 18421 THEN x := x - 1 END;
+IF x > 18422 THEN x := x - 1 END;
+IF x > 18423 THEN x := x - 1 END;
+IF x > 18424 THEN x := x - 1 END;
+IF x > 18425 THEN x := x - 1 END;
+IF x > 18426 THEN x := x - 1 END;
+IF x > 18427 THEN x := x - 1 END;
+IF x > 18428 THEN x := x - 1 END;
+IF x > 18429 THEN x := x - 1 END;
+IF x > 18430 THEN x := x - 1 END;
+IF x > 18431 THEN x := x - 1 END;
+IF x > 18432 THEN x := x - 1 END;
+IF x > 18433 THEN x := x - 1 END;
+IF x > 18434 THEN x := x - 1 END;
+IF x > 18435 THEN x := x - 1 END;
+IF x > 18436 THEN x := x - 1 END;
+IF x > 18437 THEN x := x - 1 END;
+IF x > 18438 THEN x := x - 1 END;
+IF x > 18439 THEN x := x - 1 END;
+IF x > 18440 THEN x := x - 1 END;
+IF x > 18441 THEN x := x - 1 END;
+IF x > 18442 THEN x := x - 1 END;
+IF x > 18443 THEN x := x - 1 END;
+IF x > 18444 THEN x := x - 1 END;
+IF x > 18445 THEN x := x - 1 END;
+IF x > 18446 THEN x := x - 1 END;
+IF x > 18447 THEN x := x - 1 END;
+IF x > 18448 THEN x := x - 1 END;
+IF x > 18449 THEN x := x - 1 END;
+IF x > 18450 THEN x := x - 1 END;
+IF x > 18451 THEN x := x - 1 END;
+IF x > 18452 THEN x := x - 1 END;
+IF x > 18453 THEN x := x - 1 END;
+IF x > 18454 THEN x := x - 1 END;
+IF x > 18455 THEN x := x - 1 END;
+IF x > 18456 THEN x := x - 1 END;
+IF x > 18457 THEN x := x - 1 END;
+IF x > 18458 THEN x := x - 1 END;
+IF x > 18459 THEN x := x - 1 END;
+IF x > 18460 THEN x := x - 1 END;
+IF x > 18461 THEN x := x - 1 END;
+IF x > 18462 THEN x := x - 1 END;
+IF x > 18463 THEN x := x - 1 END;
+IF x > 18464 THEN x := x - 1 END;
+IF x > 18465 THEN x := x - 1 END;
+IF x > 18466 THEN x := x - 1 END;
+IF x > 18467 THEN x := x - 1 END;
+IF x > 18468 THEN x := x - 1 END;
+IF x > 18469 THEN x := x - 1 END;
+IF x > 18470 THEN x := x - 1 END;
+IF x > 18471 THEN x := x - 1 END;
+IF x > 18472 THEN x := x - 1 END;
+IF x > 18473 THEN x := x - 1 END;
+IF x > 18474 THEN x := x - 1 END;
+IF x > 18475 THEN x := x - 1 END;
+IF x > 18476 THEN x := x - 1 END;
+IF x > 18477 THEN x := x - 1 END;
+IF x > 18478 THEN x := x - 1 END;
+IF x > 18479 THEN x := x - 1 END;
+IF x > 18480 THEN x := x - 1 END;
+IF x > 18481 THEN x := x - 1 END;
+IF x > 18482 THEN x := x - 1 END;
+IF x > 18483 THEN x := x - 1 END;
+IF x > 18484 THEN x := x - 1 END;
+IF x > 18485 THEN x := x - 1 END;
+IF x > 18486 THEN x := x - 1 END;
+IF x > 18487 THEN x := x - 1 END;
+IF x > 18488 THEN x := x - 1 END;
+IF x > 18489 THEN x := x - 1 END;
+IF x > 18490 THEN x := x - 1 END;
+IF x > 18491 THEN x := x - 1 END;
+IF x > 18492 THEN x := x - 1 END;
+IF x > 18493 THEN x := x - 1 END;
+IF x > 18494 THEN x := x - 1 END;
+IF x > 18495 THEN x := x - 1 END;
+IF x > 18496 THEN x := x - 1 END;
+IF x > 18497 THEN x := x - 1 END;
+IF x > 18498 THEN x := x - 1 END;
+IF x > 18499 THEN x := x - 1 END;
+IF x > 18500 THEN x := x - 1 END;
+IF x > 18501 THEN x := x - 1 END;
+IF x > 18502 THEN x := x - 1 END;
+IF x > 18503 THEN x := x - 1 END;
+IF x > 18504 THEN x := x - 1 END;
+IF x > 18505 THEN x := x - 1 END;
+IF x > 18506 THEN x := x - 1 END;
+IF x > 18507 THEN x := x - 1 END;
+IF x > 18508 THEN x := x - 1 END;
+IF x > 18509 THEN x := x - 1 END;
+IF x > 18510 THEN x := x - 1 END;
+IF x > 18511 THEN x := x - 1 END;
+IF x > 18512 THEN x := x - 1 END;
+IF x > 18513 THEN x := x - 1 END;
+IF x > 18514 THEN x := x - 1 END;
+IF x > 18515 THEN x := x - 1 END;
+IF x > 18516 THEN x := x - 1 END;
+IF x > 18517 THEN x := x - 1 END;
+IF x > 18518 THEN x := x - 1 END;
+IF x > 18519 THEN x := x - 1 END;
+IF x > 18520 THEN x := x - 1 END;
+IF x > 18521 THEN x := x - 1 END;
+IF x > 18522 THEN x := x - 1 END;
+IF x > 18523 THEN x := x - 1 END;
+IF x > 18524 THEN x := x - 1 END;
+IF x > 18525 THEN x := x - 1 END;
+IF x > 18526 THEN x := x - 1 END;
+IF x > 18527 THEN x := x - 1 END;
+IF x > 18528 THEN x := x - 1 END;
+IF x > 18529 THEN x := x - 1 END;
+IF x > 18530 THEN x := x - 1 END;
+IF x > 18531 THEN x := x - 1 END;
+IF x > 18532 THEN x := x - 1 END;
+IF x > 18533 THEN x := x - 1 END;
+IF x > 18534 THEN x := x - 1 END;
+IF x > 18535 THEN x := x - 1 END;
+IF x > 18536 THEN x := x - 1 END;
+IF x > 18537 THEN x := x - 1 END;
+IF x > 18538 THEN x := x - 1 END;
+IF x > 18539 THEN x := x - 1 END;
+IF x > 18540 THEN x := x - 1 END;
+IF x > 18541 THEN x := x - 1 END;
+IF x > 18542 THEN x := x - 1 END;
+IF x > 18543 THEN x := x - 1 END;
+IF x > 18544 THEN x := x - 1 END;
+IF x > 18545 THEN x := x - 1 END;
+IF x > 18546 THEN x := x - 1 END;
+IF x > 18547 THEN x := x - 1 END;
+IF x > 18548 THEN x := x - 1 END;
+IF x > 18549 THEN x := x - 1 END;
+IF x > 18550 THEN x := x - 1 END;
+IF x > 18551 THEN x := x - 1 END;
+IF x > 18552 THEN x := x - 1 END;
+IF x > 18553 THEN x := x - 1 END;
+IF x > 18554 THEN x := x - 1 END;
+IF x > 18555 THEN x := x - 1 END;
+IF x > 18556 THEN x := x - 1 END;
+IF x > 18557 THEN x := x - 1 END;
+IF x > 18558 THEN x := x - 1 END;
+IF x > 18559 THEN x := x - 1 END;
+IF x > 18560 THEN x := x - 1 END;
+IF x > 18561 THEN x := x - 1 END;
+IF x > 18562 THEN x := x - 1 END;
+IF x > 18563 THEN x := x - 1 END;
+IF x > 18564 THEN x := x - 1 END;
+IF x > 18565 THEN x := x - 1 END;
+IF x > 18566 THEN x := x - 1 END;
+IF x > 18567 THEN x := x - 1 END;
+IF x > 18568 THEN x := x - 1 END;
+IF x > 18569 THEN x := x - 1 END;
+IF x > 18570 THEN x := x - 1 END;
+IF x > 18571 THEN x := x - 1 END;
+IF x > 18572 THEN x := x - 1 END;
+IF x > 18573 THEN x := x - 1 END;
+IF x > 18574 THEN x := x - 1 END;
+IF x > 18575 THEN x := x - 1 END;
+IF x > 18576 THEN x := x - 1 END;
+IF x > 18577 THEN x := x - 1 END;
+IF x > 18578 THEN x := x - 1 END;
+IF x > 18579 THEN x := x - 1 END;
+IF x > 18580 THEN x := x - 1 END;
+IF x > 18581 THEN x := x - 1 END;
+IF x > 18582 THEN x := x - 1 END;
+IF x > 18583 THEN x := x - 1 END;
+IF x > 18584 THEN x := x - 1 END;
+IF x > 18585 THEN x := x - 1 END;
+IF x > 18586 THEN x := x - 1 END;
+IF x > 18587 THEN x := x - 1 END;
+IF x > 18588 THEN x := x - 1 END;
+IF x > 18589 THEN x := x - 1 END;
+IF x > 18590 THEN x := x - 1 END;
+IF x > 18591 THEN x := x - 1 END;
+IF x > 18592 THEN x := x - 1 END;
+IF x > 18593 THEN x := x - 1 END;
+IF x > 18594 THEN x := x - 1 END;
+IF x > 18595 THEN x := x - 1 END;
+IF x > 18596 THEN x := x - 1 END;
+IF x > 18597 THEN x := x - 1 END;
+IF x > 18598 THEN x := x - 1 END;
+IF x > 18599 THEN x := x - 1 END;
+IF x > 18600 THEN x := x - 1 END;
+IF x > 18601 THEN x := x - 1 END;
+IF x > 18602 THEN x := x - 1 END;
+IF x > 18603 THEN x := x - 1 END;
+IF x > 18604 THEN x := x - 1 END;
+IF x > 18605 THEN x := x - 1 END;
+IF x > 18606 THEN x := x - 1 END;
+IF x > 18607 THEN x := x - 1 END;
+IF x > 18608 THEN x := x - 1 END;
+IF x > 18609 THEN x := x - 1 END;
+IF x > 18610 THEN x := x - 1 END;
+IF x > 18611 THEN x := x - 1 END;
+IF x > 18612 THEN x := x - 1 END;
+IF x > 18613 THEN x := x - 1 END;
+IF x > 18614 THEN x := x - 1 END;
+IF x > 18615 THEN x := x - 1 END;
+IF x > 18616 THEN x := x - 1 END;
+IF x > 18617 THEN x := x - 1 END;
+IF x > 18618 THEN x := x - 1 END;
+IF x > 18619 THEN x := x - 1 END;
+IF x > 18620 THEN x := x - 1 END;
+IF x > 18621 THEN x := x - 1 END;
+IF x > 18622 THEN x := x - 1 END;
+IF x > 18623 THEN x := x - 1 END;
+IF x > 18624 THEN x := x - 1 END;
+IF x > 18625 THEN x := x - 1 END;
+IF x > 18626 THEN x := x - 1 END;
+IF x > 18627 THEN x := x - 1 END;
+IF x > 18628 THEN x := x - 1 END;
+IF x > 18629 THEN x := x - 1 END;
+IF x > 18630 THEN x := x - 1 END;
+IF x > 18631 THEN x := x - 1 END;
+IF x > 18632 THEN x := x - 1 END;
+IF x > 18633 THEN x := x - 1 END;
+IF x > 18634 THEN x := x - 1 END;
+IF x > 18635 THEN x := x - 1 END;
+IF x > 18636 THEN x := x - 1 END;
+IF x > 18637 THEN x := x - 1 END;
+IF x > 18638 THEN x := x - 1 END;
+IF x > 18639 THEN x := x - 1 END;
+IF x > 18640 THEN x := x - 1 END;
+IF x > 18641 THEN x := x - 1 END;
+IF x > 18642 THEN x := x - 1 END;
+IF x > 18643 THEN x := x - 1 END;
+IF x > 18644 THEN x := x - 1 END;
+IF x > 18645 THEN x := x - 1 END;
+IF x > 18646 THEN x := x - 1 END;
+IF x > 18647 THEN x := x - 1 END;
+IF x > 18648 THEN x := x - 1 END;
+IF x > 18649 THEN x := x - 1 END;
+IF x > 18650 THEN x := x - 1 END;
+IF x > 18651 THEN x := x - 1 END;
+IF x > 18652 THEN x := x - 1 END;
+IF x > 18653 THEN x := x - 1 END;
+IF x > 18654 THEN x := x - 1 END;
+IF x > 18655 THEN x := x - 1 END;
+IF x > 18656 THEN x := x - 1 END;
+IF x > 18657 THEN x := x - 1 END;
+IF x > 18658 THEN x := x - 1 END;
+IF x > 18659 THEN x := x - 1 END;
+IF x > 18660 THEN x := x - 1 END;
+IF x > 18661 THEN x := x - 1 END;
+IF x > 18662 THEN x := x - 1 END;
+IF x > 18663 THEN x := x - 1 END;
+IF x > 18664 THEN x := x - 1 END;
+IF x > 18665 THEN x := x - 1 END;
+IF x > 18666 THEN x := x - 1 END;
+IF x > 18667 THEN x := x - 1 END;
+IF x > 18668 THEN x := x - 1 END;
+IF x > 18669 THEN x := x - 1 END;
+IF x > 18670 THEN x := x - 1 END;
+IF x > 18671 THEN x := x - 1 END;
+IF x > 18672 THEN x := x - 1 END;
+IF x > 18673 THEN x := x - 1 END;
+IF x > 18674 THEN x := x - 1 END;
+IF x > 18675 THEN x := x - 1 END;
+IF x > 18676 THEN x := x - 1 END;
+IF x > 18677 THEN x := x - 1 END;
+IF x > 18678 THEN x := x - 1 END;
+IF x > 18679 THEN x := x - 1 END;
+IF x > 18680 THEN x := x - 1 END;
+IF x > 18681 THEN x := x - 1 END;
+IF x > 18682 THEN x := x - 1 END;
+IF x > 18683 THEN x := x - 1 END;
+IF x > 18684 THEN x := x - 1 END;
+IF x > 18685 THEN x := x - 1 END;
+IF x > 18686 THEN x := x - 1 END;
+IF x > 18687 THEN x := x - 1 END;
+IF x > 18688 THEN x := x - 1 END;
+IF x > 18689 THEN x := x - 1 END;
+IF x > 18690 THEN x := x - 1 END;
+IF x > 18691 THEN x := x - 1 END;
+IF x > 18692 THEN x := x - 1 END;
+IF x > 18693 THEN x := x - 1 END;
+IF x > 18694 THEN x := x - 1 END;
+IF x > 18695 THEN x := x - 1 END;
+IF x > 18696 THEN x := x - 1 END;
+IF x > 18697 THEN x := x - 1 END;
+IF x > 18698 THEN x := x - 1 END;
+IF x > 18699 THEN x := x - 1 END;
+IF x > 18700 THEN x := x - 1 END;
+IF x > 18701 THEN x := x - 1 END;
+IF x > 18702 THEN x := x - 1 END;
+IF x > 18703 THEN x := x - 1 END;
+IF x > 18704 THEN x := x - 1 END;
+IF x > 18705 THEN x := x - 1 END;
+IF x > 18706 THEN x := x - 1 END;
+IF x > 18707 THEN x := x - 1 END;
+IF x > 18708 THEN x := x - 1 END;
+IF x > 18709 THEN x := x - 1 END;
+IF x > 18710 THEN x := x - 1 END;
+IF x > 18711 THEN x := x - 1 END;
+IF x > 18712 THEN x := x - 1 END;
+IF x > 18713 THEN x := x - 1 END;
+IF x > 18714 THEN x := x - 1 END;
+IF x > 18715 THEN x := x - 1 END;
+IF x > 18716 THEN x := x - 1 END;
+IF x > 18717 THEN x := x - 1 END;
+IF x > 18718 THEN x := x - 1 END;
+IF x > 18719 THEN x := x - 1 END;
+IF x > 18720 THEN x := x - 1 END;
+IF x > 18721 THEN x := x - 1 END;
+IF x > 18722 THEN x := x - 1 END;
+IF x > 18723 THEN x := x - 1 END;
+IF x > 18724 THEN x := x - 1 END;
+IF x > 18725 THEN x := x - 1 END;
+IF x > 18726 THEN x := x - 1 END;
+IF x > 18727 THEN x := x - 1 END;
+IF x > 18728 THEN x := x - 1 END;
+IF x > 18729 THEN x := x - 1 END;
+IF x > 18730 THEN x := x - 1 END;
+IF x > 18731 THEN x := x - 1 END;
+IF x > 18732 THEN x := x - 1 END;
+IF x > 18733 THEN x := x - 1 END;
+IF x > 18734 THEN x := x - 1 END;
+IF x > 18735 THEN x := x - 1 END;
+IF x > 18736 THEN x := x - 1 END;
+IF x > 18737 THEN x := x - 1 END;
+IF x > 18738 THEN x := x - 1 END;
+IF x > 18739 THEN x := x - 1 END;
+IF x > 18740 THEN x := x - 1 END;
+IF x > 18741 THEN x := x - 1 END;
+IF x > 18742 THEN x := x - 1 END;
+IF x > 18743 THEN x := x - 1 END;
+IF x > 18744 THEN x := x - 1 END;
+IF x > 18745 THEN x := x - 1 END;
+IF x > 18746 THEN x := x - 1 END;
+IF x > 18747 THEN x := x - 1 END;
+IF x > 18748 THEN x := x - 1 END;
+IF x > 18749 THEN x := x - 1 END;
+IF x > 18750 THEN x := x - 1 END;
+IF x > 18751 THEN x := x - 1 END;
+IF x > 18752 THEN x := x - 1 END;
+IF x > 18753 THEN x := x - 1 END;
+IF x > 18754 THEN x := x - 1 END;
+IF x > 18755 THEN x := x - 1 END;
+IF x > 18756 THEN x := x - 1 END;
+IF x > 18757 THEN x := x - 1 END;
+IF x > 18758 THEN x := x - 1 END;
+IF x > 18759 THEN x := x - 1 END;
+IF x > 18760 THEN x := x - 1 END;
+IF x > 18761 THEN x := x - 1 END;
+IF x > 18762 THEN x := x - 1 END;
+IF x > 18763 THEN x := x - 1 END;
+IF x > 18764 THEN x := x - 1 END;
+IF x > 18765 THEN x := x - 1 END;
+IF x > 18766 THEN x := x - 1 END;
+IF x > 18767 THEN x := x - 1 END;
+IF x > 18768 THEN x := x - 1 END;
+IF x > 18769 THEN x := x - 1 END;
+IF x > 18770 THEN x := x - 1 END;
+IF x > 18771 THEN x := x - 1 END;
+IF x > 18772 THEN x := x - 1 END;
+IF x > 18773 THEN x := x - 1 END;
+IF x > 18774 THEN x := x - 1 END;
+IF x > 18775 THEN x := x - 1 END;
+IF x > 18776 THEN x := x - 1 END;
+IF x > 18777 THEN x := x - 1 END;
+IF x > 18778 THEN x := x - 1 END;
+IF x > 18779 THEN x := x - 1 END;
+IF x > 18780 THEN x := x - 1 END;
+IF x > 18781 THEN x := x - 1 END;
+IF x > 18782 THEN x := x - 1 END;
+IF x > 18783 THEN x := x - 1 END;
+IF x > 18784 THEN x := x - 1 END;
+IF x > 18785 THEN x := x - 1 END;
+IF x > 18786 THEN x := x - 1 END;
+IF x > 18787 THEN x := x - 1 END;
+IF x > 18788 THEN x := x - 1 END;
+IF x > 18789 THEN x := x - 1 END;
+IF x > 18790 THEN x := x - 1 END;
+IF x > 18791 THEN x := x - 1 END;
+IF x > 18792 THEN x := x - 1 END;
+IF x > 18793 THEN x := x - 1 END;
+IF x > 18794 THEN x := x - 1 END;
+IF x > 18795 THEN x := x - 1 END;
+IF x > 18796 THEN x := x - 1 END;
+IF x > 18797 THEN x := x - 1 END;
+IF x > 18798 THEN x := x - 1 END;
+IF x > 18799 THEN x := x - 1 END;
+IF x > 18800 THEN x := x - 1 END;
+IF x > 18801 THEN x := x - 1 END;
+IF x > 18802 THEN x := x - 1 END;
+IF x > 18803 THEN x := x - 1 END;
+IF x > 18804 THEN x := x - 1 END;
+IF x > 18805 THEN x := x - 1 END;
+IF x > 18806 THEN x := x - 1 END;
+IF x > 18807 THEN x := x - 1 END;
+IF x > 18808 THEN x := x - 1 END;
+IF x > 18809 THEN x := x - 1 END;
+IF x > 18810 THEN x := x - 1 END;
+IF x > 18811 THEN x := x - 1 END;
+IF x > 18812 THEN x := x - 1 END;
+IF x > 18813 THEN x := x - 1 END;
+IF x > 18814 THEN x := x - 1 END;
+IF x > 18815 THEN x := x - 1 END;
+IF x > 18816 THEN x := x - 1 END;
+IF x > 18817 THEN x := x - 1 END;
+IF x > 18818 THEN x := x - 1 END;
+IF x > 18819 THEN x := x - 1 END;
+IF x > 18820 THEN x := x - 1 END;
+IF x > 18821 THEN x := x - 1 END;
+IF x > 18822 THEN x := x - 1 END;
+IF x > 18823 THEN x := x - 1 END;
+IF x > 18824 THEN x := x - 1 END;
+IF x > 18825 THEN x := x - 1 END;
+IF x > 18826 THEN x := x - 1 END;
+IF x > 18827 THEN x := x - 1 END;
+IF x > 18828 THEN x := x - 1 END;
+IF x > 18829 THEN x := x - 1 END;
+IF x > 18830 THEN x := x - 1 END;
+IF x > 18831 THEN x := x - 1 END;
+IF x > 18832 THEN x := x - 1 END;
+IF x > 18833 THEN x := x - 1 END;
+IF x > 18834 THEN x := x - 1 END;
+IF x > 18835 THEN x := x - 1 END;
+IF x > 18836 THEN x := x - 1 END;
+IF x > 18837 THEN x := x - 1 END;
+IF x > 18838 THEN x := x - 1 END;
+IF x > 18839 THEN x := x - 1 END;
+IF x > 18840 THEN x := x - 1 END;
+IF x > 18841 THEN x := x - 1 END;
+IF x > 18842 THEN x := x - 1 END;
+IF x > 18843 THEN x := x - 1 END;
+IF x > 18844 THEN x := x - 1 END;
+IF x > 18845 THEN x := x - 1 END;
+IF x > 18846 THEN x := x - 1 END;
+IF x > 18847 THEN x := x - 1 END;
+IF x > 18848 THEN x := x - 1 END;
+IF x > 18849 THEN x := x - 1 END;
+IF x > 18850 THEN x := x - 1 END;
+IF x > 18851 THEN x := x - 1 END;
+IF x > 18852 THEN x := x - 1 END;
+IF x > 18853 THEN x := x - 1 END;
+IF x > 18854 THEN x := x - 1 END;
+IF x > 18855 THEN x := x - 1 END;
+IF x > 18856 THEN x := x - 1 END;
+IF x > 18857 THEN x := x - 1 END;
+IF x > 18858 THEN x := x - 1 END;
+IF x > 18859 THEN x := x - 1 END;
+IF x > 18860 THEN x := x - 1 END;
+IF x > 18861 THEN x := x - 1 END;
+IF x > 18862 THEN x := x - 1 END;
+IF x > 18863 THEN x := x - 1 END;
+IF x > 18864 THEN x := x - 1 END;
+IF x > 18865 THEN x := x - 1 END;
+IF x > 18866 THEN x := x - 1 END;
+IF x > 18867 THEN x := x - 1 END;
+IF x > 18868 THEN x := x - 1 END;
+IF x > 18869 THEN x := x - 1 END;
+IF x > 18870 THEN x := x - 1 END;
+IF x > 18871 THEN x := x - 1 END;
+IF x > 18872 THEN x := x - 1 END;
+IF x > 18873 THEN x := x - 1 END;
+IF x > 18874 THEN x := x - 1 END;
+IF x > 18875 THEN x := x - 1 END;
+IF x > 18876 THEN x := x - 1 END;
+IF x > 18877 THEN x := x - 1 END;
+IF x > 18878 THEN x := x - 1 END;
+IF x > 18879 THEN x := x - 1 END;
+IF x > 18880 THEN x := x - 1 END;
+IF x > 18881 THEN x := x - 1 END;
+IF x > 18882 THEN x := x - 1 END;
+IF x > 18883 THEN x := x - 1 END;
+IF x > 18884 THEN x := x - 1 END;
+IF x > 18885 THEN x := x - 1 END;
+IF x > 18886 THEN x := x - 1 END;
+IF x > 18887 THEN x := x - 1 END;
+IF x > 18888 THEN x := x - 1 END;
+IF x > 18889 THEN x := x - 1 END;
+IF x > 18890 THEN x := x - 1 END;
+IF x > 18891 THEN x := x - 1 END;
+IF x > 18892 THEN x := x - 1 END;
+IF x > 18893 THEN x := x - 1 END;
+IF x > 18894 THEN x := x - 1 END;
+IF x > 18895 THEN x := x - 1 END;
+IF x > 18896 THEN x := x - 1 END;
+IF x > 18897 THEN x := x - 1 END;
+IF x > 18898 THEN x := x - 1 END;
+IF x > 18899 THEN x := x - 1 END;
+IF x > 18900 THEN x := x - 1 END;
+IF x > 18901 THEN x := x - 1 END;
+IF x > 18902 THEN x := x - 1 END;
+IF x > 18903 THEN x := x - 1 END;
+IF x > 18904 THEN x := x - 1 END;
+IF x > 18905 THEN x := x - 1 END;
+IF x > 18906 THEN x := x - 1 END;
+IF x > 18907 THEN x := x - 1 END;
+IF x > 18908 THEN x := x - 1 END;
+IF x > 18909 THEN x := x - 1 END;
+IF x > 18910 THEN x := x - 1 END;
+IF x > 18911 THEN x := x - 1 END;
+IF x > 18912 THEN x := x - 1 END;
+IF x > 18913 THEN x := x - 1 END;
+IF x > 18914 THEN x := x - 1 END;
+IF x > 18915 THEN x := x - 1 END;
+IF x > 18916 THEN x := x - 1 END;
+IF x > 18917 THEN x := x - 1 END;
+IF x > 18918 THEN x := x - 1 END;
+IF x > 18919 THEN x := x - 1 END;
+IF x > 18920 THEN x := x - 1 END;
+IF x > 18921 THEN x := x - 1 END;
+IF x > 18922 THEN x := x - 1 END;
+IF x > 18923 THEN x := x - 1 END;
+IF x > 18924 THEN x := x - 1 END;
+IF x > 18925 THEN x := x - 1 END;
+IF x > 18926 THEN x := x - 1 END;
+IF x > 18927 THEN x := x - 1 END;
+IF x > 18928 THEN x := x - 1 END;
+IF x > 18929 THEN x := x - 1 END;
+IF x > 18930 THEN x := x - 1 END;
+IF x > 18931 THEN x := x - 1 END;
+IF x > 18932 THEN x := x - 1 END;
+IF x > 18933 THEN x := x - 1 END;
+IF x > 18934 THEN x := x - 1 END;
+IF x > 18935 THEN x := x - 1 END;
+IF x > 18936 THEN x := x - 1 END;
+IF x > 18937 THEN x := x - 1 END;
+IF x > 18938 THEN x := x - 1 END;
+IF x > 18939 THEN x := x - 1 END;
+IF x > 18940 THEN x := x - 1 END;
+IF x > 18941 THEN x := x - 1 END;
+IF x > 18942 THEN x := x - 1 END;
+IF x > 18943 THEN x := x - 1 END;
+IF x > 18944 THEN x := x - 1 END;
+IF x > 18945 THEN x := x - 1 END;
+IF x > 18946 THEN x := x - 1 END;
+IF x > 18947 THEN x := x - 1 END;
+IF x > 18948 THEN x := x - 1 END;
+IF x > 18949 THEN x := x - 1 END;
+IF x > 18950 THEN x := x - 1 END;
+IF x > 18951 THEN x := x - 1 END;
+IF x > 18952 THEN x := x - 1 END;
+IF x > 18953 THEN x := x - 1 END;
+IF x > 18954 THEN x := x - 1 END;
+IF x > 18955 THEN x := x - 1 END;
+IF x > 18956 THEN x := x - 1 END;
+IF x > 18957 THEN x := x - 1 END;
+IF x > 18958 THEN x := x - 1 END;
+IF x > 18959 THEN x := x - 1 END;
+IF x > 18960 THEN x := x - 1 END;
+IF x > 18961 THEN x := x - 1 END;
+IF x > 18962 THEN x := x - 1 END;
+IF x > 18963 THEN x := x - 1 END;
+IF x > 18964 THEN x := x - 1 END;
+IF x > 18965 THEN x := x - 1 END;
+IF x > 18966 THEN x := x - 1 END;
+IF x > 18967 THEN x := x - 1 END;
+IF x > 18968 THEN x := x - 1 END;
+IF x > 18969 THEN x := x - 1 END;
+IF x > 18970 THEN x := x - 1 END;
+IF x > 18971 THEN x := x - 1 END;
+IF x > 18972 THEN x := x - 1 END;
+IF x > 18973 THEN x := x - 1 END;
+IF x > 18974 THEN x := x - 1 END;
+IF x > 18975 THEN x := x - 1 END;
+IF x > 18976 THEN x := x - 1 END;
+IF x > 18977 THEN x := x - 1 END;
+IF x > 18978 THEN x := x - 1 END;
+IF x > 18979 THEN x := x - 1 END;
+IF x > 18980 THEN x := x - 1 END;
+IF x > 18981 THEN x := x - 1 END;
+IF x > 18982 THEN x := x - 1 END;
+IF x > 18983 THEN x := x - 1 END;
+IF x > 18984 THEN x := x - 1 END;
+IF x > 18985 THEN x := x - 1 END;
+IF x > 18986 THEN x := x - 1 END;
+IF x > 18987 THEN x := x - 1 END;
+IF x > 18988 THEN x := x - 1 END;
+IF x > 18989 THEN x := x - 1 END;
+IF x > 18990 THEN x := x - 1 END;
+IF x > 18991 THEN x := x - 1 END;
+IF x > 18992 THEN x := x - 1 END;
+IF x > 18993 THEN x := x - 1 END;
+IF x > 18994 THEN x := x - 1 END;
+IF x > 18995 THEN x := x - 1 END;
+IF x > 18996 THEN x := x - 1 END;
+IF x > 18997 THEN x := x - 1 END;
+IF x > 18998 THEN x := x - 1 END;
+IF x > 18999 THEN x := x - 1 END;
+IF x > 19000 THEN x := x - 1 END;
+IF x > 19001 THEN x := x - 1 END;
+IF x > 19002 THEN x := x - 1 END;
+IF x > 19003 THEN x := x - 1 END;
+IF x > 19004 THEN x := x - 1 END;
+IF x > 19005 THEN x := x - 1 END;
+IF x > 19006 THEN x := x - 1 END;
+IF x > 19007 THEN x := x - 1 END;
+IF x > 19008 THEN x := x - 1 END;
+IF x > 19009 THEN x := x - 1 END;
+IF x > 19010 THEN x := x - 1 END;
+IF x > 19011 THEN x := x - 1 END;
+IF x > 19012 THEN x := x - 1 END;
+IF x > 19013 THEN x := x - 1 END;
+IF x > 19014 THEN x := x - 1 END;
+IF x > 19015 THEN x := x - 1 END;
+IF x > 19016 THEN x := x - 1 END;
+IF x > 19017 THEN x := x - 1 END;
+IF x > 19018 THEN x := x - 1 END;
+IF x > 19019 THEN x := x - 1 END;
+IF x > 19020 THEN x := x - 1 END;
+IF x > 19021 THEN x := x - 1 END;
+IF x > 19022 THEN x := x - 1 END;
+IF x > 19023 THEN x := x - 1 END;
+IF x > 19024 THEN x := x - 1 END;
+IF x > 19025 THEN x := x - 1 END;
+IF x > 19026 THEN x := x - 1 END;
+IF x > 19027 THEN x := x - 1 END;
+IF x > 19028 THEN x := x - 1 END;
+IF x > 19029 THEN x := x - 1 END;
+IF x > 19030 THEN x := x - 1 END;
+IF x > 19031 THEN x := x - 1 END;
+IF x > 19032 THEN x := x - 1 END;
+IF x > 19033 THEN x := x - 1 END;
+IF x > 19034 THEN x := x - 1 END;
+IF x > 19035 THEN x := x - 1 END;
+IF x > 19036 THEN x := x - 1 END;
+IF x > 19037 THEN x := x - 1 END;
+IF x > 19038 THEN x := x - 1 END;
+IF x > 19039 THEN x := x - 1 END;
+IF x > 19040 THEN x := x - 1 END;
+IF x > 19041 THEN x := x - 1 END;
+IF x > 19042 THEN x := x - 1 END;
+IF x > 19043 THEN x := x - 1 END;
+IF x > 19044 THEN x := x - 1 END;
+IF x > 19045 THEN x := x - 1 END;
+IF x > 19046 THEN x := x - 1 END;
+IF x > 19047 THEN x := x - 1 END;
+IF x > 19048 THEN x := x - 1 END;
+IF x > 19049 THEN x := x - 1 END;
+IF x > 19050 THEN x := x - 1 END;
+IF x > 19051 THEN x := x - 1 END;
+IF x > 19052 THEN x := x - 1 END;
+IF x > 19053 THEN x := x - 1 END;
+IF x > 19054 THEN x := x - 1 END;
+IF x > 19055 THEN x := x - 1 END;
+IF x > 19056 THEN x := x - 1 END;
+IF x > 19057 THEN x := x - 1 END;
+IF x > 19058 THEN x := x - 1 END;
+IF x > 19059 THEN x := x - 1 END;
+IF x > 19060 THEN x := x - 1 END;
+IF x > 19061 THEN x := x - 1 END;
+IF x > 19062 THEN x := x - 1 END;
+IF x > 19063 THEN x := x - 1 END;
+IF x > 19064 THEN x := x - 1 END;
+IF x > 19065 THEN x := x - 1 END;
+IF x > 19066 THEN x := x - 1 END;
+IF x > 19067 THEN x := x - 1 END;
+IF x > 19068 THEN x := x - 1 END;
+IF x > 19069 THEN x := x - 1 END;
+IF x > 19070 THEN x := x - 1 END;
+IF x > 19071 THEN x := x - 1 END;
+IF x > 19072 THEN x := x - 1 END;
+IF x > 19073 THEN x := x - 1 END;
+IF x > 19074 THEN x := x - 1 END;
+IF x > 19075 THEN x := x - 1 END;
+IF x > 19076 THEN x := x - 1 END;
+IF x > 19077 THEN x := x - 1 END;
+IF x > 19078 THEN x := x - 1 END;
+IF x > 19079 THEN x := x - 1 END;
+IF x > 19080 THEN x := x - 1 END;
+IF x > 19081 THEN x := x - 1 END;
+IF x > 19082 THEN x := x - 1 END;
+IF x > 19083 THEN x := x - 1 END;
+IF x > 19084 THEN x := x - 1 END;
+IF x > 19085 THEN x := x - 1 END;
+IF x > 19086 THEN x := x - 1 END;
+IF x > 19087 THEN x := x - 1 END;
+IF x > 19088 THEN x := x - 1 END;
+IF x > 19089 THEN x := x - 1 END;
+IF x > 19090 THEN x := x - 1 END;
+IF x > 19091 THEN x := x - 1 END;
+IF x > 19092 THEN x := x - 1 END;
+IF x > 19093 THEN x := x - 1 END;
+IF x > 19094 THEN x := x - 1 END;
+IF x > 19095 THEN x := x - 1 END;
+IF x > 19096 THEN x := x - 1 END;
+IF x > 19097 THEN x := x - 1 END;
+IF x > 19098 THEN x := x - 1 END;
+IF x > 19099 THEN x := x - 1 END;
+IF x > 19100 THEN x := x - 1 END;
+IF x > 19101 THEN x := x - 1 END;
+IF x > 19102 THEN x := x - 1 END;
+IF x > 19103 THEN x := x - 1 END;
+IF x > 19104 THEN x := x - 1 END;
+IF x > 19105 THEN x := x - 1 END;
+IF x > 19106 THEN x := x - 1 END;
+IF x > 19107 THEN x := x - 1 END;
+IF x > 19108 THEN x := x - 1 END;
+IF x > 19109 THEN x := x - 1 END;
+IF x > 19110 THEN x := x - 1 END;
+IF x > 19111 THEN x := x - 1 END;
+IF x > 19112 THEN x := x - 1 END;
+IF x > 19113 THEN x := x - 1 END;
+IF x > 19114 THEN x := x - 1 END;
+IF x > 19115 THEN x := x - 1 END;
+IF x > 19116 THEN x := x - 1 END;
+IF x > 19117 THEN x := x - 1 END;
+IF x > 19118 THEN x := x - 1 END;
+IF x > 19119 THEN x := x - 1 END;
+IF x > 19120 THEN x := x - 1 END;
+IF x > 19121 THEN x := x - 1 END;
+IF x > 19122 THEN x := x - 1 END;
+IF x > 19123 THEN x := x - 1 END;
+IF x > 19124 THEN x := x - 1 END;
+IF x > 19125 THEN x := x - 1 END;
+IF x > 19126 THEN x := x - 1 END;
+IF x > 19127 THEN x := x - 1 END;
+IF x > 19128 THEN x := x - 1 END;
+IF x > 19129 THEN x := x - 1 END;
+IF x > 19130 THEN x := x - 1 END;
+IF x > 19131 THEN x := x - 1 END;
+IF x > 19132 THEN x := x - 1 END;
+IF x > 19133 THEN x := x - 1 END;
+IF x > 19134 THEN x := x - 1 END;
+IF x > 19135 THEN x := x - 1 END;
+IF x > 19136 THEN x := x - 1 END;
+IF x > 19137 THEN x := x - 1 END;
+IF x > 19138 THEN x := x - 1 END;
+IF x > 19139 THEN x := x - 1 END;
+IF x > 19140 THEN x := x - 1 END;
+IF x > 19141 THEN x := x - 1 END;
+IF x > 19142 THEN x := x - 1 END;
+IF x > 19143 THEN x := x - 1 END;
+IF x > 19144 THEN x := x - 1 END;
+IF x > 19145 THEN x := x - 1 END;
+IF x > 19146 THEN x := x - 1 END;
+IF x > 19147 THEN x := x - 1 END;
+IF x > 19148 THEN x := x - 1 END;
+IF x > 19149 THEN x := x - 1 END;
+IF x > 19150 THEN x := x - 1 END;
+IF x > 19151 THEN x := x - 1 END;
+IF x > 19152 THEN x := x - 1 END;
+IF x > 19153 THEN x := x - 1 END;
+IF x > 19154 THEN x := x - 1 END;
+IF x > 19155 THEN x := x - 1 END;
+IF x > 19156 THEN x := x - 1 END;
+IF x > 19157 THEN x := x - 1 END;
+IF x > 19158 THEN x := x - 1 END;
+IF x > 19159 THEN x := x - 1 END;
+IF x > 19160 THEN x := x - 1 END;
+IF x > 19161 THEN x := x - 1 END;
+IF x > 19162 THEN x := x - 1 END;
+IF x > 19163 THEN x := x - 1 END;
+IF x > 19164 THEN x := x - 1 END;
+IF x > 19165 THEN x := x - 1 END;
+IF x > 19166 THEN x := x - 1 END;
+IF x > 19167 THEN x := x - 1 END;
+IF x > 19168 THEN x := x - 1 END;
+IF x > 19169 THEN x := x - 1 END;
+IF x > 19170 THEN x := x - 1 END;
+IF x > 19171 THEN x := x - 1 END;
+IF x > 19172 THEN x := x - 1 END;
+IF x > 19173 THEN x := x - 1 END;
+IF x > 19174 THEN x := x - 1 END;
+IF x > 19175 THEN x := x - 1 END;
+IF x > 19176 THEN x := x - 1 END;
+IF x > 19177 THEN x := x - 1 END;
+IF x > 19178 THEN x := x - 1 END;
+IF x > 19179 THEN x := x - 1 END;
+IF x > 19180 THEN x := x - 1 END;
+IF x > 19181 THEN x := x - 1 END;
+IF x > 19182 THEN x := x - 1 END;
+IF x > 19183 THEN x := x - 1 END;
+IF x > 19184 THEN x := x - 1 END;
+IF x > 19185 THEN x := x - 1 END;
+IF x > 19186 THEN x := x - 1 END;
+IF x > 19187 THEN x := x - 1 END;
+IF x > 19188 THEN x := x - 1 END;
+IF x > 19189 THEN x := x - 1 END;
+IF x > 19190 THEN x := x - 1 END;
+IF x > 19191 THEN x := x - 1 END;
+IF x > 19192 THEN x := x - 1 END;
+IF x > 19193 THEN x := x - 1 END;
+IF x > 19194 THEN x := x - 1 END;
+IF x > 19195 THEN x := x - 1 END;
+IF x > 19196 THEN x := x - 1 END;
+IF x > 19197 THEN x := x - 1 END;
+IF x > 19198 THEN x := x - 1 END;
+IF x > 19199 THEN x := x - 1 END;
+IF x > 19200 THEN x := x - 1 END;
+IF x > 19201 THEN x := x - 1 END;
+IF x > 19202 THEN x := x - 1 END;
+IF x > 19203 THEN x := x - 1 END;
+IF x > 19204 THEN x := x - 1 END;
+IF x > 19205 THEN x := x - 1 END;
+IF x > 19206 THEN x := x - 1 END;
+IF x > 19207 THEN x := x - 1 END;
+IF x > 19208 THEN x := x - 1 END;
+IF x > 19209 THEN x := x - 1 END;
+IF x > 19210 THEN x := x - 1 END;
+IF x > 19211 THEN x := x - 1 END;
+IF x > 19212 THEN x := x - 1 END;
+IF x > 19213 THEN x := x - 1 END;
+IF x > 19214 THEN x := x - 1 END;
+IF x > 19215 THEN x := x - 1 END;
+IF x > 19216 THEN x := x - 1 END;
+IF x > 19217 THEN x := x - 1 END;
+IF x > 19218 THEN x := x - 1 END;
+IF x > 19219 THEN x := x - 1 END;
+IF x > 19220 THEN x := x - 1 END;
+IF x > 19221 THEN x := x - 1 END;
+IF x > 19222 THEN x := x - 1 END;
+IF x > 19223 THEN x := x - 1 END;
+IF x > 19224 THEN x := x - 1 END;
+IF x > 19225 THEN x := x - 1 END;
+IF x > 19226 THEN x := x - 1 END;
+IF x > 19227 THEN x := x - 1 END;
+IF x > 19228 THEN x := x - 1 END;
+IF x > 19229 THEN x := x - 1 END;
+IF x > 19230 THEN x := x - 1 END;
+IF x > 19231 THEN x := x - 1 END;
+IF x > 19232 THEN x := x - 1 END;
+IF x > 19233 THEN x := x - 1 END;
+IF x > 19234 THEN x := x - 1 END;
+IF x > 19235 THEN x := x - 1 END;
+IF x > 19236 THEN x := x - 1 END;
+IF x > 19237 THEN x := x - 1 END;
+IF x > 19238 THEN x := x - 1 END;
+IF x > 19239 THEN x := x - 1 END;
+IF x > 19240 THEN x := x - 1 END;
+IF x > 19241 THEN x := x - 1 END;
+IF x > 19242 THEN x := x - 1 END;
+IF x > 19243 THEN x := x - 1 END;
+IF x > 19244 THEN x := x - 1 END;
+IF x > 19245 THEN x := x - 1 END;
+IF x > 19246 THEN x := x - 1 END;
+IF x > 19247 THEN x := x - 1 END;
+IF x > 19248 THEN x := x - 1 END;
+IF x > 19249 THEN x := x - 1 END;
+IF x > 19250 THEN x := x - 1 END;
+IF x > 19251 THEN x := x - 1 END;
+IF x > 19252 THEN x := x - 1 END;
+IF x > 19253 THEN x := x - 1 END;
+IF x > 19254 THEN x := x - 1 END;
+IF x > 19255 THEN x := x - 1 END;
+IF x > 19256 THEN x := x - 1 END;
+IF x > 19257 THEN x := x - 1 END;
+IF x > 19258 THEN x := x - 1 END;
+IF x > 19259 THEN x := x - 1 END;
+IF x > 19260 THEN x := x - 1 END;
+IF x > 19261 THEN x := x - 1 END;
+IF x > 19262 THEN x := x - 1 END;
+IF x > 19263 THEN x := x - 1 END;
+IF x > 19264 THEN x := x - 1 END;
+IF x > 19265 THEN x := x - 1 END;
+IF x > 19266 THEN x := x - 1 END;
+IF x > 19267 THEN x := x - 1 END;
+IF x > 19268 THEN x := x - 1 END;
+IF x > 19269 THEN x := x - 1 END;
+IF x > 19270 THEN x := x - 1 END;
+IF x > 19271 THEN x := x - 1 END;
+IF x > 19272 THEN x := x - 1 END;
+IF x > 19273 THEN x := x - 1 END;
+IF x > 19274 THEN x := x - 1 END;
+IF x > 19275 THEN x := x - 1 END;
+IF x > 19276 THEN x := x - 1 END;
+IF x > 19277 THEN x := x - 1 END;
+IF x > 19278 THEN x := x - 1 END;
+IF x > 19279 THEN x := x - 1 END;
+IF x > 19280 THEN x := x - 1 END;
+IF x > 19281 THEN x := x - 1 END;
+IF x > 19282 THEN x := x - 1 END;
+IF x > 19283 THEN x := x - 1 END;
+IF x > 19284 THEN x := x - 1 END;
+IF x > 19285 THEN x := x - 1 END;
+IF x > 19286 THEN x := x - 1 END;
+IF x > 19287 THEN x := x - 1 END;
+IF x > 19288 THEN x := x - 1 END;
+IF x > 19289 THEN x := x - 1 END;
+IF x > 19290 THEN x := x - 1 END;
+IF x > 19291 THEN x := x - 1 END;
+IF x > 19292 THEN x := x - 1 END;
+IF x > 19293 THEN x := x - 1 END;
+IF x > 19294 THEN x := x - 1 END;
+IF x > 19295 THEN x := x - 1 END;
+IF x > 19296 THEN x := x - 1 END;
+IF x > 19297 THEN x := x - 1 END;
+IF x > 19298 THEN x := x - 1 END;
+IF x > 19299 THEN x := x - 1 END;
+IF x > 19300 THEN x := x - 1 END;
+IF x > 19301 THEN x := x - 1 END;
+IF x > 19302 THEN x := x - 1 END;
+IF x > 19303 THEN x := x - 1 END;
+IF x > 19304 THEN x := x - 1 END;
+IF x > 19305 THEN x := x - 1 END;
+IF x > 19306 THEN x := x - 1 END;
+IF x > 19307 THEN x := x - 1 END;
+IF x > 19308 THEN x := x - 1 END;
+IF x > 19309 THEN x := x - 1 END;
+IF x > 19310 THEN x := x - 1 END;
+IF x > 19311 THEN x := x - 1 END;
+IF x > 19312 THEN x := x - 1 END;
+IF x > 19313 THEN x := x - 1 END;
+IF x > 19314 THEN x := x - 1 END;
+IF x > 19315 THEN x := x - 1 END;
+IF x > 19316 THEN x := x - 1 END;
+IF x > 19317 THEN x := x - 1 END;
+IF x > 19318 THEN x := x - 1 END;
+IF x > 19319 THEN x := x - 1 END;
+IF x > 19320 THEN x := x - 1 END;
+IF x > 19321 THEN x := x - 1 END;
+IF x > 19322 THEN x := x - 1 END;
+IF x > 19323 THEN x := x - 1 END;
+IF x > 19324 THEN x := x - 1 END;
+IF x > 19325 THEN x := x - 1 END;
+IF x > 19326 THEN x := x - 1 END;
+IF x > 19327 THEN x := x - 1 END;
+IF x > 19328 THEN x := x - 1 END;
+IF x > 19329 THEN x := x - 1 END;
+IF x > 19330 THEN x := x - 1 END;
+IF x > 19331 THEN x := x - 1 END;
+IF x > 19332 THEN x := x - 1 END;
+IF x > 19333 THEN x := x - 1 END;
+IF x > 19334 THEN x := x - 1 END;
+IF x > 19335 THEN x := x - 1 END;
+IF x > 19336 THEN x := x - 1 END;
+IF x > 19337 THEN x := x - 1 END;
+IF x > 19338 THEN x := x - 1 END;
+IF x > 19339 THEN x := x - 1 END;
+IF x > 19340 THEN x := x - 1 END;
+IF x > 19341 THEN x := x - 1 END;
+IF x > 19342 THEN x := x - 1 END;
+IF x > 19343 THEN x := x - 1 END;
+IF x > 19344 THEN x := x - 1 END;
+IF x > 19345 THEN x := x - 1 END;
+IF x > 19346 THEN x := x - 1 END;
+IF x > 19347 THEN x := x - 1 END;
+IF x > 19348 THEN x := x - 1 END;
+IF x > 19349 THEN x := x - 1 END;
+IF x > 19350 THEN x := x - 1 END;
+IF x > 19351 THEN x := x - 1 END;
+IF x > 19352 THEN x := x - 1 END;
+IF x > 19353 THEN x := x - 1 END;
+IF x > 19354 THEN x := x - 1 END;
+IF x > 19355 THEN x := x - 1 END;
+IF x > 19356 THEN x := x - 1 END;
+IF x > 19357 THEN x := x - 1 END;
+IF x > 19358 THEN x := x - 1 END;
+IF x > 19359 THEN x := x - 1 END;
+IF x > 19360 THEN x := x - 1 END;
+IF x > 19361 THEN x := x - 1 END;
+IF x > 19362 THEN x := x - 1 END;
+IF x > 19363 THEN x := x - 1 END;
+IF x > 19364 THEN x := x - 1 END;
+IF x > 19365 THEN x := x - 1 END;
+IF x > 19366 THEN x := x - 1 END;
+IF x > 19367 THEN x := x - 1 END;
+IF x > 19368 THEN x := x - 1 END;
+IF x > 19369 THEN x := x - 1 END;
+IF x > 19370 THEN x := x - 1 END;
+IF x > 19371 THEN x := x - 1 END;
+IF x > 19372 THEN x := x - 1 END;
+IF x > 19373 THEN x := x - 1 END;
+IF x > 19374 THEN x := x - 1 END;
+IF x > 19375 THEN x := x - 1 END;
+IF x > 19376 THEN x := x - 1 END;
+IF x > 19377 THEN x := x - 1 END;
+IF x > 19378 THEN x := x - 1 END;
+IF x > 19379 THEN x := x - 1 END;
+IF x > 19380 THEN x := x - 1 END;
+IF x > 19381 THEN x := x - 1 END;
+IF x > 19382 THEN x := x - 1 END;
+IF x > 19383 THEN x := x - 1 END;
+IF x > 19384 THEN x := x - 1 END;
+IF x > 19385 THEN x := x - 1 END;
+IF x > 19386 THEN x := x - 1 END;
+IF x > 19387 THEN x := x - 1 END;
+IF x > 19388 THEN x := x - 1 END;
+IF x > 19389 THEN x := x - 1 END;
+IF x > 19390 THEN x := x - 1 END;
+IF x > 19391 THEN x := x - 1 END;
+IF x > 19392 THEN x := x - 1 END;
+IF x > 19393 THEN x := x - 1 END;
+IF x > 19394 THEN x := x - 1 END;
+IF x > 19395 THEN x := x - 1 END;
+IF x > 19396 THEN x := x - 1 END;
+IF x > 19397 THEN x := x - 1 END;
+IF x > 19398 THEN x := x - 1 END;
+IF x > 19399 THEN x := x - 1 END;
+IF x > 19400 THEN x := x - 1 END;
+IF x > 19401 THEN x := x - 1 END;
+IF x > 19402 THEN x := x - 1 END;
+IF x > 19403 THEN x := x - 1 END;
+IF x > 19404 THEN x := x - 1 END;
+IF x > 19405 THEN x := x - 1 END;
+IF x > 19406 THEN x := x - 1 END;
+IF x > 19407 THEN x := x - 1 END;
+IF x > 19408 THEN x := x - 1 END;
+IF x > 19409 THEN x := x - 1 END;
+IF x > 19410 THEN x := x - 1 END;
+IF x > 19411 THEN x := x - 1 END;
+IF x > 19412 THEN x := x - 1 END;
+IF x > 19413 THEN x := x - 1 END;
+IF x > 19414 THEN x := x - 1 END;
+IF x > 19415 THEN x := x - 1 END;
+IF x > 19416 THEN x := x - 1 END;
+IF x > 19417 THEN x := x - 1 END;
+IF x > 19418 THEN x := x - 1 END;
+IF x > 19419 THEN x := x - 1 END;
+IF x > 19420 THEN x := x - 1 END;
+IF x > 19421 THEN x := x - 1 END;
+IF x > 19422 THEN x := x - 1 END;
+IF x > 19423 THEN x := x - 1 END;
+IF x > 19424 THEN x := x - 1 END;
+IF x > 19425 THEN x := x - 1 END;
+IF x > 19426 THEN x := x - 1 END;
+IF x > 19427 THEN x := x - 1 END;
+IF x > 19428 THEN x := x - 1 END;
+IF x > 19429 THEN x := x - 1 END;
+IF x > 19430 THEN x := x - 1 END;
+IF x > 19431 THEN x := x - 1 END;
+IF x > 19432 THEN x := x - 1 END;
+IF x > 19433 THEN x := x - 1 END;
+IF x > 19434 THEN x := x - 1 END;
+IF x > 19435 THEN x := x - 1 END;
+IF x > 19436 THEN x := x - 1 END;
+IF x > 19437 THEN x := x - 1 END;
+IF x > 19438 THEN x := x - 1 END;
+IF x > 19439 THEN x := x - 1 END;
+IF x > 19440 THEN x := x - 1 END;
+IF x > 19441 THEN x := x - 1 END;
+IF x > 19442 THEN x := x - 1 END;
+IF x > 19443 THEN x := x - 1 END;
+IF x > 19444 THEN x := x - 1 END;
+IF x > 19445 THEN x := x - 1 END;
+IF x > 19446 THEN x := x - 1 END;
+IF x > 19447 THEN x := x - 1 END;
+IF x > 19448 THEN x := x - 1 END;
+IF x > 19449 THEN x := x - 1 END;
+IF x > 19450 THEN x := x - 1 END;
+IF x > 19451 THEN x := x - 1 END;
+IF x > 19452 THEN x := x - 1 END;
+IF x > 19453 THEN x := x - 1 END;
+IF x > 19454 THEN x := x - 1 END;
+IF x > 19455 THEN x := x - 1 END;
+IF x > 19456 THEN x := x - 1 END;
+IF x > 19457 THEN x := x - 1 END;
+IF x > 19458 THEN x := x - 1 END;
+IF x > 19459 THEN x := x - 1 END;
+IF x > 19460 THEN x := x - 1 END;
+IF x > 19461 THEN x := x - 1 END;
+IF x > 19462 THEN x := x - 1 END;
+IF x > 19463 THEN x := x - 1 END;
+IF x > 19464 THEN x := x - 1 END;
+IF x > 19465 THEN x := x - 1 END;
+IF x > 19466 THEN x := x - 1 END;
+IF x > 19467 THEN x := x - 1 END;
+IF x > 19468 THEN x := x - 1 END;
+IF x > 19469 THEN x := x - 1 END;
+IF x > 19470 THEN x := x - 1 END;
+IF x > 19471 THEN x := x - 1 END;
+IF x > 19472 THEN x := x - 1 END;
+IF x > 19473 THEN x := x - 1 END;
+IF x > 19474 THEN x := x - 1 END;
+IF x > 19475 THEN x := x - 1 END;
+IF x > 19476 THEN x := x - 1 END;
+IF x > 19477 THEN x := x - 1 END;
+IF x > 19478 THEN x := x - 1 END;
+IF x > 19479 THEN x := x - 1 END;
+IF x > 19480 THEN x := x - 1 END;
+IF x > 19481 THEN x := x - 1 END;
+IF x > 19482 THEN x := x - 1 END;
+IF x > 19483 THEN x := x - 1 END;
+IF x > 19484 THEN x := x - 1 END;
+IF x > 19485 THEN x := x - 1 END;
+IF x > 19486 THEN x := x - 1 END;
+IF x > 19487 THEN x := x - 1 END;
+IF x > 19488 THEN x := x - 1 END;
+IF x > 19489 THEN x := x - 1 END;
+IF x > 19490 THEN x := x - 1 END;
+IF x > 19491 THEN x := x - 1 END;
+IF x > 19492 THEN x := x - 1 END;
+IF x > 19493 THEN x := x - 1 END;
+IF x > 19494 THEN x := x - 1 END;
+IF x > 19495 THEN x := x - 1 END;
+IF x > 19496 THEN x := x - 1 END;
+IF x > 19497 THEN x := x - 1 END;
+IF x > 19498 THEN x := x - 1 END;
+IF x > 19499 THEN x := x - 1 END;
+IF x > 19500 THEN x := x - 1 END;
+IF x > 19501 THEN x := x - 1 END;
+IF x > 19502 THEN x := x - 1 END;
+IF x > 19503 THEN x := x - 1 END;
+IF x > 19504 THEN x := x - 1 END;
+IF x > 19505 THEN x := x - 1 END;
+IF x > 19506 THEN x := x - 1 END;
+IF x > 19507 THEN x := x - 1 END;
+IF x > 19508 THEN x := x - 1 END;
+IF x > 19509 THEN x := x - 1 END;
+IF x > 19510 THEN x := x - 1 END;
+IF x > 19511 THEN x := x - 1 END;
+IF x > 19512 THEN x := x - 1 END;
+IF x > 19513 THEN x := x - 1 END;
+IF x > 19514 THEN x := x - 1 END;
+IF x > 19515 THEN x := x - 1 END;
+IF x > 19516 THEN x := x - 1 END;
+IF x > 19517 THEN x := x - 1 END;
+IF x > 19518 THEN x := x - 1 END;
+IF x > 19519 THEN x := x - 1 END;
+IF x > 19520 THEN x := x - 1 END;
+IF x > 19521 THEN x := x - 1 END;
+IF x > 19522 THEN x := x - 1 END;
+IF x > 19523 THEN x := x - 1 END;
+IF x > 19524 THEN x := x - 1 END;
+IF x > 19525 THEN x := x - 1 END;
+IF x > 19526 THEN x := x - 1 END;
+IF x > 19527 THEN x := x - 1 END;
+IF x > 19528 THEN x := x - 1 END;
+IF x > 19529 THEN x := x - 1 END;
+IF x > 19530 THEN x := x - 1 END;
+IF x > 19531 THEN x := x - 1 END;
+IF x > 19532 THEN x := x - 1 END;
+IF x > 19533 THEN x := x - 1 END;
+IF x > 19534 THEN x := x - 1 END;
+IF x > 19535 THEN x := x - 1 END;
+IF x > 19536 THEN x := x - 1 END;
+IF x > 19537 THEN x := x - 1 END;
+IF x > 19538 THEN x := x - 1 END;
+IF x > 19539 THEN x := x - 1 END;
+IF x > 19540 THEN x := x - 1 END;
+IF x > 19541 THEN x := x - 1 END;
+IF x > 19542 THEN x := x - 1 END;
+IF x > 19543 THEN x := x - 1 END;
+IF x > 19544 THEN x := x - 1 END;
+IF x > 19545 THEN x := x - 1 END;
+IF x > 19546 THEN x := x - 1 END;
+IF x > 19547 THEN x := x - 1 END;
+IF x > 19548 THEN x := x - 1 END;
+IF x > 19549 THEN x := x - 1 END;
+IF x > 19550 THEN x := x - 1 END;
+IF x > 19551 THEN x := x - 1 END;
+IF x > 19552 THEN x := x - 1 END;
+IF x > 19553 THEN x := x - 1 END;
+IF x > 19554 THEN x := x - 1 END;
+IF x > 19555 THEN x := x - 1 END;
+IF x > 19556 THEN x := x - 1 END;
+IF x > 19557 THEN x := x - 1 END;
+IF x > 19558 THEN x := x - 1 END;
+IF x > 19559 THEN x := x - 1 END;
+IF x > 19560 THEN x := x - 1 END;
+IF x > 19561 THEN x := x - 1 END;
+IF x > 19562 THEN x := x - 1 END;
+IF x > 19563 THEN x := x - 1 END;
+IF x > 19564 THEN x := x - 1 END;
+IF x > 19565 THEN x := x - 1 END;
+IF x > 19566 THEN x := x - 1 END;
+IF x > 19567 THEN x := x - 1 END;
+IF x > 19568 THEN x := x - 1 END;
+IF x > 19569 THEN x := x - 1 END;
+IF x > 19570 THEN x := x - 1 END;
+IF x > 19571 THEN x := x - 1 END;
+IF x > 19572 THEN x := x - 1 END;
+IF x > 19573 THEN x := x - 1 END;
+IF x > 19574 THEN x := x - 1 END;
+IF x > 19575 THEN x := x - 1 END;
+IF x > 19576 THEN x := x - 1 END;
+IF x > 19577 THEN x := x - 1 END;
+IF x > 19578 THEN x := x - 1 END;
+IF x > 19579 THEN x := x - 1 END;
+IF x > 19580 THEN x := x - 1 END;
+IF x > 19581 THEN x := x - 1 END;
+IF x > 19582 THEN x := x - 1 END;
+IF x > 19583 THEN x := x - 1 END;
+IF x > 19584 THEN x := x - 1 END;
+IF x > 19585 THEN x := x - 1 END;
+IF x > 19586 THEN x := x - 1 END;
+IF x > 19587 THEN x := x - 1 END;
+IF x > 19588 THEN x := x - 1 END;
+IF x > 19589 THEN x := x - 1 END;
+IF x > 19590 THEN x := x - 1 END;
+IF x > 19591 THEN x := x - 1 END;
+IF x > 19592 THEN x := x - 1 END;
+IF x > 19593 THEN x := x - 1 END;
+IF x > 19594 THEN x := x - 1 END;
+IF x > 19595 THEN x := x - 1 END;
+IF x > 19596 THEN x := x - 1 END;
+IF x > 19597 THEN x := x - 1 END;
+IF x > 19598 THEN x := x - 1 END;
+IF x > 19599 THEN x := x - 1 END;
+IF x > 19600 THEN x := x - 1 END;
+IF x > 19601 THEN x := x - 1 END;
+IF x > 19602 THEN x := x - 1 END;
+IF x > 19603 THEN x := x - 1 END;
+IF x > 19604 THEN x := x - 1 END;
+IF x > 19605 THEN x := x - 1 END;
+IF x > 19606 THEN x := x - 1 END;
+IF x > 19607 THEN x := x - 1 END;
+IF x > 19608 THEN x := x - 1 END;
+IF x > 19609 THEN x := x - 1 END;
+IF x > 19610 THEN x := x - 1 END;
+IF x > 19611 THEN x := x - 1 END;
+IF x > 19612 THEN x := x - 1 END;
+IF x > 19613 THEN x := x - 1 END;
+IF x > 19614 THEN x := x - 1 END;
+IF x > 19615 THEN x := x - 1 END;
+IF x > 19616 THEN x := x - 1 END;
+IF x > 19617 THEN x := x - 1 END;
+IF x > 19618 THEN x := x - 1 END;
+IF x > 19619 THEN x := x - 1 END;
+IF x > 19620 THEN x := x - 1 END;
+IF x > 19621 THEN x := x - 1 END;
+IF x > 19622 THEN x := x - 1 END;
+IF x > 19623 THEN x := x - 1 END;
+IF x > 19624 THEN x := x - 1 END;
+IF x > 19625 THEN x := x - 1 END;
+IF x > 19626 THEN x := x - 1 END;
+IF x > 19627 THEN x := x - 1 END;
+IF x > 19628 THEN x := x - 1 END;
+IF x > 19629 THEN x := x - 1 END;
+IF x > 19630 THEN x := x - 1 END;
+IF x > 19631 THEN x := x - 1 END;
+IF x > 19632 THEN x := x - 1 END;
+IF x > 19633 THEN x := x - 1 END;
+IF x > 19634 THEN x := x - 1 END;
+IF x > 19635 THEN x := x - 1 END;
+IF x > 19636 THEN x := x - 1 END;
+IF x > 19637 THEN x := x - 1 END;
+IF x > 19638 THEN x := x - 1 END;
+IF x > 19639 THEN x := x - 1 END;
+IF x > 19640 THEN x := x - 1 END;
+IF x > 19641 THEN x := x - 1 END;
+IF x > 19642 THEN x := x - 1 END;
+IF x > 19643 THEN x := x - 1 END;
+IF x > 19644 THEN x := x - 1 END;
+IF x > 19645 THEN x := x - 1 END;
+IF x > 19646 THEN x := x - 1 END;
+IF x > 19647 THEN x := x - 1 END;
+IF x > 19648 THEN x := x - 1 END;
+IF x > 19649 THEN x := x - 1 END;
+IF x > 19650 THEN x := x - 1 END;
+IF x > 19651 THEN x := x - 1 END;
+IF x > 19652 THEN x := x - 1 END;
+IF x > 19653 THEN x := x - 1 END;
+IF x > 19654 THEN x := x - 1 END;
+IF x > 19655 THEN x := x - 1 END;
+IF x > 19656 THEN x := x - 1 END;
+IF x > 19657 THEN x := x - 1 END;
+IF x > 19658 THEN x := x - 1 END;
+IF x > 19659 THEN x := x - 1 END;
+IF x > 19660 THEN x := x - 1 END;
+IF x > 19661 THEN x := x - 1 END;
+IF x > 19662 THEN x := x - 1 END;
+IF x > 19663 THEN x := x - 1 END;
+IF x > 19664 THEN x := x - 1 END;
+IF x > 19665 THEN x := x - 1 END;
+IF x > 19666 THEN x := x - 1 END;
+IF x > 19667 THEN x := x - 1 END;
+IF x > 19668 THEN x := x - 1 END;
+IF x > 19669 THEN x := x - 1 END;
+IF x > 19670 THEN x := x - 1 END;
+IF x > 19671 THEN x := x - 1 END;
+IF x > 19672 THEN x := x - 1 END;
+IF x > 19673 THEN x := x - 1 END;
+IF x > 19674 THEN x := x - 1 END;
+IF x > 19675 THEN x := x - 1 END;
+IF x > 19676 THEN x := x - 1 END;
+IF x > 19677 THEN x := x - 1 END;
+IF x > 19678 THEN x := x - 1 END;
+IF x > 19679 THEN x := x - 1 END;
+IF x > 19680 THEN x := x - 1 END;
+IF x > 19681 THEN x := x - 1 END;
+IF x > 19682 THEN x := x - 1 END;
+IF x > 19683 THEN x := x - 1 END;
+IF x > 19684 THEN x := x - 1 END;
+IF x > 19685 THEN x := x - 1 END;
+IF x > 19686 THEN x := x - 1 END;
+IF x > 19687 THEN x := x - 1 END;
+IF x > 19688 THEN x := x - 1 END;
+IF x > 19689 THEN x := x - 1 END;
+IF x > 19690 THEN x := x - 1 END;
+IF x > 19691 THEN x := x - 1 END;
+IF x > 19692 THEN x := x - 1 END;
+IF x > 19693 THEN x := x - 1 END;
+IF x > 19694 THEN x := x - 1 END;
+IF x > 19695 THEN x := x - 1 END;
+IF x > 19696 THEN x := x - 1 END;
+IF x > 19697 THEN x := x - 1 END;
+IF x > 19698 THEN x := x - 1 END;
+IF x > 19699 THEN x := x - 1 END;
+IF x > 19700 THEN x := x - 1 END;
+IF x > 19701 THEN x := x - 1 END;
+IF x > 19702 THEN x := x - 1 END;
+IF x > 19703 THEN x := x - 1 END;
+IF x > 19704 THEN x := x - 1 END;
+IF x > 19705 THEN x := x - 1 END;
+IF x > 19706 THEN x := x - 1 END;
+IF x > 19707 THEN x := x - 1 END;
+IF x > 19708 THEN x := x - 1 END;
+IF x > 19709 THEN x := x - 1 END;
+IF x > 19710 THEN x := x - 1 END;
+IF x > 19711 THEN x := x - 1 END;
+IF x > 19712 THEN x := x - 1 END;
+IF x > 19713 THEN x := x - 1 END;
+IF x > 19714 THEN x := x - 1 END;
+IF x > 19715 THEN x := x - 1 END;
+IF x > 19716 THEN x := x - 1 END;
+IF x > 19717 THEN x := x - 1 END;
+IF x > 19718 THEN x := x - 1 END;
+IF x > 19719 THEN x := x - 1 END;
+IF x > 19720 THEN x := x - 1 END;
+IF x > 19721 THEN x := x - 1 END;
+IF x > 19722 THEN x := x - 1 END;
+IF x > 19723 THEN x := x - 1 END;
+IF x > 19724 THEN x := x - 1 END;
+IF x > 19725 THEN x := x - 1 END;
+IF x > 19726 THEN x := x - 1 END;
+IF x > 19727 THEN x := x - 1 END;
+IF x > 19728 THEN x := x - 1 END;
+IF x > 19729 THEN x := x - 1 END;
+IF x > 19730 THEN x := x - 1 END;
+IF x > 19731 THEN x := x - 1 END;
+IF x > 19732 THEN x := x - 1 END;
+IF x > 19733 THEN x := x - 1 END;
+IF x > 19734 THEN x := x - 1 END;
+IF x > 19735 THEN x := x - 1 END;
+IF x > 19736 THEN x := x - 1 END;
+IF x > 19737 THEN x := x - 1 END;
+IF x > 19738 THEN x := x - 1 END;
+IF x > 19739 THEN x := x - 1 END;
+IF x > 19740 THEN x := x - 1 END;
+IF x > 19741 THEN x := x - 1 END;
+IF x > 19742 THEN x := x - 1 END;
+IF x > 19743 THEN x := x - 1 END;
+IF x > 19744 THEN x := x - 1 END;
+IF x > 19745 THEN x := x - 1 END;
+IF x > 19746 THEN x := x - 1 END;
+IF x > 19747 THEN x := x - 1 END;
+IF x > 19748 THEN x := x - 1 END;
+IF x > 19749 THEN x := x - 1 END;
+IF x > 19750 THEN x := x - 1 END;
+IF x > 19751 THEN x := x - 1 END;
+IF x > 19752 THEN x := x - 1 END;
+IF x > 19753 THEN x := x - 1 END;
+IF x > 19754 THEN x := x - 1 END;
+IF x > 19755 THEN x := x - 1 END;
+IF x > 19756 THEN x := x - 1 END;
+IF x > 19757 THEN x := x - 1 END;
+IF x > 19758 THEN x := x - 1 END;
+IF x > 19759 THEN x := x - 1 END;
+IF x > 19760 THEN x := x - 1 END;
+IF x > 19761 THEN x := x - 1 END;
+IF x > 19762 THEN x := x - 1 END;
+IF x > 19763 THEN x := x - 1 END;
+IF x > 19764 THEN x := x - 1 END;
+IF x > 19765 THEN x := x - 1 END;
+IF x > 19766 THEN x := x - 1 END;
+IF x > 19767 THEN x := x - 1 END;
+IF x > 19768 THEN x := x - 1 END;
+IF x > 19769 THEN x := x - 1 END;
+IF x > 19770 THEN x := x - 1 END;
+IF x > 19771 THEN x := x - 1 END;
+IF x > 19772 THEN x := x - 1 END;
+IF x > 19773 THEN x := x - 1 END;
+IF x > 19774 THEN x := x - 1 END;
+IF x > 19775 THEN x := x - 1 END;
+IF x > 19776 THEN x := x - 1 END;
+IF x > 19777 THEN x := x - 1 END;
+IF x > 19778 THEN x := x - 1 END;
+IF x > 19779 THEN x := x - 1 END;
+IF x > 19780 THEN x := x - 1 END;
+IF x > 19781 THEN x := x - 1 END;
+IF x > 19782 THEN x := x - 1 END;
+IF x > 19783 THEN x := x - 1 END;
+IF x > 19784 THEN x := x - 1 END;
+IF x > 19785 THEN x := x - 1 END;
+IF x > 19786 THEN x := x - 1 END;
+IF x > 19787 THEN x := x - 1 END;
+IF x > 19788 THEN x := x - 1 END;
+IF x > 19789 THEN x := x - 1 END;
+IF x > 19790 THEN x := x - 1 END;
+IF x > 19791 THEN x := x - 1 END;
+IF x > 19792 THEN x := x - 1 END;
+IF x > 19793 THEN x := x - 1 END;
+IF x > 19794 THEN x := x - 1 END;
+IF x > 19795 THEN x := x - 1 END;
+IF x > 19796 THEN x := x - 1 END;
+IF x > 19797 THEN x := x - 1 END;
+IF x > 19798 THEN x := x - 1 END;
+IF x > 19799 THEN x := x - 1 END;
+IF x > 19800 THEN x := x - 1 END;
+IF x > 19801 THEN x := x - 1 END;
+IF x > 19802 THEN x := x - 1 END;
+IF x > 19803 THEN x := x - 1 END;
+IF x > 19804 THEN x := x - 1 END;
+IF x > 19805 THEN x := x - 1 END;
+IF x > 19806 THEN x := x - 1 END;
+IF x > 19807 THEN x := x - 1 END;
+IF x > 19808 THEN x := x - 1 END;
+IF x > 19809 THEN x := x - 1 END;
+IF x > 19810 THEN x := x - 1 END;
+IF x > 19811 THEN x := x - 1 END;
+IF x > 19812 THEN x := x - 1 END;
+IF x > 19813 THEN x := x - 1 END;
+IF x > 19814 THEN x := x - 1 END;
+IF x > 19815 THEN x := x - 1 END;
+IF x > 19816 THEN x := x - 1 END;
+IF x > 19817 THEN x := x - 1 END;
+IF x > 19818 THEN x := x - 1 END;
+IF x > 19819 THEN x := x - 1 END;
+IF x > 19820 THEN x := x - 1 END;
+IF x > 19821 THEN x := x - 1 END;
+IF x > 19822 THEN x := x - 1 END;
+IF x > 19823 THEN x := x - 1 END;
+IF x > 19824 THEN x := x - 1 END;
+IF x > 19825 THEN x := x - 1 END;
+IF x > 19826 THEN x := x - 1 END;
+IF x > 19827 THEN x := x - 1 END;
+IF x > 19828 THEN x := x - 1 END;
+IF x > 19829 THEN x := x - 1 END;
+IF x > 19830 THEN x := x - 1 END;
+IF x > 19831 THEN x := x - 1 END;
+IF x > 19832 THEN x := x - 1 END;
+IF x > 19833 THEN x := x - 1 END;
+IF x > 19834 THEN x := x - 1 END;
+IF x > 19835 THEN x := x - 1 END;
+IF x > 19836 THEN x := x - 1 END;
+IF x > 19837 THEN x := x - 1 END;
+IF x > 19838 THEN x := x - 1 END;
+IF x > 19839 THEN x := x - 1 END;
+IF x > 19840 THEN x := x - 1 END;
+IF x > 19841 THEN x := x - 1 END;
+IF x > 19842 THEN x := x - 1 END;
+IF x > 19843 THEN x := x - 1 END;
+IF x > 19844 THEN x := x - 1 END;
+IF x > 19845 THEN x := x - 1 END;
+IF x > 19846 THEN x := x - 1 END;
+IF x > 19847 THEN x := x - 1 END;
+IF x > 19848 THEN x := x - 1 END;
+IF x > 19849 THEN x := x - 1 END;
+IF x > 19850 THEN x := x - 1 END;
+IF x > 19851 THEN x := x - 1 END;
+IF x > 19852 THEN x := x - 1 END;
+IF x > 19853 THEN x := x - 1 END;
+IF x > 19854 THEN x := x - 1 END;
+IF x > 19855 THEN x := x - 1 END;
+IF x > 19856 THEN x := x - 1 END;
+IF x > 19857 THEN x := x - 1 END;
+IF x > 19858 THEN x := x - 1 END;
+IF x > 19859 THEN x := x - 1 END;
+IF x > 19860 THEN x := x - 1 END;
+IF x > 19861 THEN x := x - 1 END;
+IF x > 19862 THEN x := x - 1 END;
+IF x > 19863 THEN x := x - 1 END;
+IF x > 19864 THEN x := x - 1 END;
+IF x > 19865 THEN x := x - 1 END;
+IF x > 19866 THEN x := x - 1 END;
+IF x > 19867 THEN x := x - 1 END;
+IF x > 19868 THEN x := x - 1 END;
+IF x > 19869 THEN x := x - 1 END;
+IF x > 19870 THEN x := x - 1 END;
+IF x > 19871 THEN x := x - 1 END;
+IF x > 19872 THEN x := x - 1 END;
+IF x > 19873 THEN x := x - 1 END;
+IF x > 19874 THEN x := x - 1 END;
+IF x > 19875 THEN x := x - 1 END;
+IF x > 19876 THEN x := x - 1 END;
+IF x > 19877 THEN x := x - 1 END;
+IF x > 19878 THEN x := x - 1 END;
+IF x > 19879 THEN x := x - 1 END;
+IF x > 19880 THEN x := x - 1 END;
+IF x > 19881 THEN x := x - 1 END;
+IF x > 19882 THEN x := x - 1 END;
+IF x > 19883 THEN x := x - 1 END;
+IF x > 19884 THEN x := x - 1 END;
+IF x > 19885 THEN x := x - 1 END;
+IF x > 19886 THEN x := x - 1 END;
+IF x > 19887 THEN x := x - 1 END;
+IF x > 19888 THEN x := x - 1 END;
+IF x > 19889 THEN x := x - 1 END;
+IF x > 19890 THEN x := x - 1 END;
+IF x > 19891 THEN x := x - 1 END;
+IF x > 19892 THEN x := x - 1 END;
+IF x > 19893 THEN x := x - 1 END;
+IF x > 19894 THEN x := x - 1 END;
+IF x > 19895 THEN x := x - 1 END;
+IF x > 19896 THEN x := x - 1 END;
+IF x > 19897 THEN x := x - 1 END;
+IF x > 19898 THEN x := x - 1 END;
+IF x > 19899 THEN x := x - 1 END;
+IF x > 19900 THEN x := x - 1 END;
+IF x > 19901 THEN x := x - 1 END;
+IF x > 19902 THEN x := x - 1 END;
+IF x > 19903 THEN x := x - 1 END;
+IF x > 19904 THEN x := x - 1 END;
+IF x > 19905 THEN x := x - 1 END;
+IF x > 19906 THEN x := x - 1 END;
+IF x > 19907 THEN x := x - 1 END;
+IF x > 19908 THEN x := x - 1 END;
+IF x > 19909 THEN x := x - 1 END;
+IF x > 19910 THEN x := x - 1 END;
+IF x > 19911 THEN x := x - 1 END;
+IF x > 19912 THEN x := x - 1 END;
+IF x > 19913 THEN x := x - 1 END;
+IF x > 19914 THEN x := x - 1 END;
+IF x > 19915 THEN x := x - 1 END;
+IF x > 19916 THEN x := x - 1 END;
+IF x > 19917 THEN x := x - 1 END;
+IF x > 19918 THEN x := x - 1 END;
+IF x > 19919 THEN x := x - 1 END;
+IF x > 19920 THEN x := x - 1 END;
+IF x > 19921 THEN x := x - 1 END;
+IF x > 19922 THEN x := x - 1 END;
+IF x > 19923 THEN x := x - 1 END;
+IF x > 19924 THEN x := x - 1 END;
+IF x > 19925 THEN x := x - 1 END;
+IF x > 19926 THEN x := x - 1 END;
+IF x > 19927 THEN x := x - 1 END;
+IF x > 19928 THEN x := x - 1 END;
+IF x > 19929 THEN x := x - 1 END;
+IF x > 19930 THEN x := x - 1 END;
+IF x > 19931 THEN x := x - 1 END;
+IF x > 19932 THEN x := x - 1 END;
+IF x > 19933 THEN x := x - 1 END;
+IF x > 19934 THEN x := x - 1 END;
+IF x > 19935 THEN x := x - 1 END;
+IF x > 19936 THEN x := x - 1 END;
+IF x > 19937 THEN x := x - 1 END;
+IF x > 19938 THEN x := x - 1 END;
+IF x > 19939 THEN x := x - 1 END;
+IF x > 19940 THEN x := x - 1 END;
+IF x > 19941 THEN x := x - 1 END;
+IF x > 19942 THEN x := x - 1 END;
+IF x > 19943 THEN x := x - 1 END;
+IF x > 19944 THEN x := x - 1 END;
+IF x > 19945 THEN x := x - 1 END;
+IF x > 19946 THEN x := x - 1 END;
+IF x > 19947 THEN x := x - 1 END;
+IF x > 19948 THEN x := x - 1 END;
+IF x > 19949 THEN x := x - 1 END;
+IF x > 19950 THEN x := x - 1 END;
+IF x > 19951 THEN x := x - 1 END;
+IF x > 19952 THEN x := x - 1 END;
+IF x > 19953 THEN x := x - 1 END;
+IF x > 19954 THEN x := x - 1 END;
+IF x > 19955 THEN x := x - 1 END;
+IF x > 19956 THEN x := x - 1 END;
+IF x > 19957 THEN x := x - 1 END;
+IF x > 19958 THEN x := x - 1 END;
+IF x > 19959 THEN x := x - 1 END;
+IF x > 19960 THEN x := x - 1 END;
+IF x > 19961 THEN x := x - 1 END;
+IF x > 19962 THEN x := x - 1 END;
+IF x > 19963 THEN x := x - 1 END;
+IF x > 19964 THEN x := x - 1 END;
+IF x > 19965 THEN x := x - 1 END;
+IF x > 19966 THEN x := x - 1 END;
+IF x > 19967 THEN x := x - 1 END;
+IF x > 19968 THEN x := x - 1 END;
+IF x > 19969 THEN x := x - 1 END;
+IF x > 19970 THEN x := x - 1 END;
+IF x > 19971 THEN x := x - 1 END;
+IF x > 19972 THEN x := x - 1 END;
+IF x > 19973 THEN x := x - 1 END;
+IF x > 19974 THEN x := x - 1 END;
+IF x > 19975 THEN x := x - 1 END;
+IF x > 19976 THEN x := x - 1 END;
+IF x > 19977 THEN x := x - 1 END;
+IF x > 19978 THEN x := x - 1 END;
+IF x > 19979 THEN x := x - 1 END;
+IF x > 19980 THEN x := x - 1 END;
+IF x > 19981 THEN x := x - 1 END;
+IF x > 19982 THEN x := x - 1 END;
+IF x > 19983 THEN x := x - 1 END;
+IF x > 19984 THEN x := x - 1 END;
+IF x > 19985 THEN x := x - 1 END;
+IF x > 19986 THEN x := x - 1 END;
+IF x > 19987 THEN x := x - 1 END;
+IF x > 19988 THEN x := x - 1 END;
+IF x > 19989 THEN x := x - 1 END;
+IF x > 19990 THEN x := x - 1 END;
+IF x > 19991 THEN x := x - 1 END;
+IF x > 19992 THEN x := x - 1 END;
+IF x > 19993 THEN x := x - 1 END;
+IF x > 19994 THEN x := x - 1 END;
+IF x > 19995 THEN x := x - 1 END;
+IF x > 19996 THEN x := x - 1 END;
+IF x > 19997 THEN x := x - 1 END;
+IF x > 19998 THEN x := x - 1 END;
+IF x > 19999 THEN x := x - 1 END;
+RETURN x END P; END Deep.
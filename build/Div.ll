@@ -0,0 +1,37 @@
+define i32 @Div_P(i32 %0, i32 %1) {
+entry:
+	%2 = icmp sgt i32 %0, 0
+	br label %while_cond_0_0
+while_cond_0_0:
+	%3 = phi i32 [ 0, %entry ], [ %8, %if_end_0 ]
+	%4 = phi i32 [ 0, %entry ], [ %9, %if_end_0 ]
+	%5 = icmp slt i32 %4, %1
+	br i1 %5, label %while_body_0_0, label %while_cond_0_1
+while_body_0_0:
+	br i1 %2, label %if_body_0_0, label %if_cond_0_1
+if_body_0_0:
+	%6 = sub i32 0, %0
+	%7 = add i32 %3, %6
+	br label %if_end_0
+if_cond_0_1:
+	br label %if_end_0
+if_end_0:
+	%8 = phi i32 [ %7, %if_body_0_0 ], [ %3, %if_cond_0_1 ]
+	%9 = add i32 %4, 1
+	br label %while_cond_0_0
+while_cond_0_1:
+	ret i32 %3
+}
+define i32 @Div_Quot(i32 %0) {
+entry:
+	%1 = sub i32 0, %0
+	ret i32 %1
+}
+define i32 @Div_Rem(i32 %0) {
+entry:
+	ret i32 0
+}
+define void @Div__init() {
+entry:
+	ret void
+}
@@ -0,0 +1,60 @@
+define i32 @Gcd_GCD(i32 %0, i32 %1) {
+entry:
+	br label %while_cond_0_0
+while_cond_0_0:
+	%2 = phi i32 [ 0, %entry ], [ %12, %while_body_0_0 ]
+	%3 = phi i32 [ %1, %entry ], [ %12, %while_body_0_0 ]
+	%4 = phi i32 [ %0, %entry ], [ %3, %while_body_0_0 ]
+	%5 = icmp ne i32 %3, 0
+	br i1 %5, label %while_body_0_0, label %while_cond_0_1
+while_body_0_0:
+	%6 = srem i32 %4, %3
+	%7 = xor i32 %6, %3
+	%8 = icmp slt i32 %7, 0
+	%9 = icmp ne i32 %6, 0
+	%10 = and i1 %9, %8
+	%11 = select i1 %10, i32 %3, i32 0
+	%12 = add i32 %6, %11
+	br label %while_cond_0_0
+while_cond_0_1:
+	ret i32 %4
+}
+define i32 @Gcd_Min(i32 %0, i32 %1) {
+entry:
+	br label %if_cond_0_0
+if_cond_0_0:
+	%2 = icmp slt i32 %0, %1
+	br i1 %2, label %if_body_0_0, label %if_cond_0_1
+if_body_0_0:
+	br label %if_end_0
+if_cond_0_1:
+	br label %if_end_0
+if_end_0:
+	%3 = phi i32 [ %0, %if_body_0_0 ], [ %1, %if_cond_0_1 ]
+	ret i32 %3
+}
+define i32 @Gcd_Sum(i32 %0, i32 %1) {
+entry:
+	%2 = add i32 %0, %1
+	ret i32 %2
+}
+define double @Gcd_Sum2(double %0, double %1) {
+entry:
+	%2 = fadd double %0, %1
+	ret double %2
+}
+define i32 @Gcd_Mod(i32 %0, i32 %1) {
+entry:
+	%2 = srem i32 %0, %1
+	%3 = xor i32 %2, %1
+	%4 = icmp slt i32 %3, 0
+	%5 = icmp ne i32 %2, 0
+	%6 = and i1 %5, %4
+	%7 = select i1 %6, i32 %1, i32 0
+	%8 = add i32 %2, %7
+	ret i32 %8
+}
+define void @Gcd__init() {
+entry:
+	ret void
+}
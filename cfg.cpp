@@ -0,0 +1,106 @@
+#include "cfg.h"
+
+Cfg::Cfg(const Ir_Function &fn):
+	blocks_ { fn.blocks }, preds_(fn.blocks.size()),
+	succs_(fn.blocks.size()), children_(fn.blocks.size()),
+	idom_(fn.blocks.size(), -1), rpo_number_(fn.blocks.size(), -1),
+	pre_(fn.blocks.size(), -1), post_(fn.blocks.size(), -1)
+{
+	for (int i { 0 }; i < size(); ++i) { index_[blocks_[i]] = i; }
+	for (int i { 0 }; i < size(); ++i) {
+		auto term { blocks_[i]->terminator() };
+		if (! term) { continue; }
+		for (auto target : term->targets) {
+			if (! target) { continue; }
+			auto t { index_.at(target) };
+			succs_[i].push_back(t);
+			preds_[t].push_back(i);
+		}
+	}
+	compute_dominators();
+}
+
+// Cooper, Harvey and Kennedy: iterate over the reverse post order
+// until the immediate dominators are stable
+void Cfg::compute_dominators() {
+	if (blocks_.empty()) { return; }
+	std::vector<int> post;
+	std::vector<bool> seen(size());
+	std::vector<std::pair<int, size_t>> stack { { 0, 0 } };
+	seen[0] = true;
+	while (! stack.empty()) {
+		auto &[block, next] { stack.back() };
+		if (next < succs_[block].size()) {
+			auto s { succs_[block][next++] };
+			if (! seen[s]) {
+				seen[s] = true;
+				stack.push_back({ s, 0 });
+			}
+		} else {
+			post.push_back(block);
+			stack.pop_back();
+		}
+	}
+	rpo_.assign(post.rbegin(), post.rend());
+	for (size_t i { 0 }; i < rpo_.size(); ++i) { rpo_number_[rpo_[i]] = i; }
+
+	auto intersect { [&](int a, int b) {
+		while (a != b) {
+			while (rpo_number_[a] > rpo_number_[b]) { a = idom_[a]; }
+			while (rpo_number_[b] > rpo_number_[a]) { b = idom_[b]; }
+		}
+		return a;
+	} };
+	idom_[0] = 0;
+	for (bool changed { true }; changed; ) {
+		changed = false;
+		for (size_t i { 1 }; i < rpo_.size(); ++i) {
+			auto block { rpo_[i] };
+			int dom { -1 };
+			for (auto p : preds_[block]) {
+				if (idom_[p] < 0) { continue; }
+				dom = dom < 0 ? p : intersect(p, dom);
+			}
+			if (dom != idom_[block]) {
+				idom_[block] = dom;
+				changed = true;
+			}
+		}
+	}
+	idom_[0] = -1;
+	for (int i { 1 }; i < size(); ++i) {
+		if (idom_[i] >= 0) { children_[idom_[i]].push_back(i); }
+	}
+
+	// a dominates b if b is entered and left while a is open
+	int time { 0 };
+	std::vector<std::pair<int, size_t>> open { { 0, 0 } };
+	pre_[0] = time++;
+	while (! open.empty()) {
+		auto &[block, next] { open.back() };
+		if (next < children_[block].size()) {
+			auto child { children_[block][next++] };
+			pre_[child] = time++;
+			open.push_back({ child, 0 });
+		} else {
+			post_[block] = time++;
+			open.pop_back();
+		}
+	}
+}
+
+std::vector<std::vector<int>> Cfg::frontiers() const {
+	std::vector<std::vector<int>> result(size());
+	for (int i { 0 }; i < size(); ++i) {
+		if (preds_[i].size() < 2) { continue; }
+		for (auto p : preds_[i]) {
+			for (auto runner { p }; runner >= 0 && runner != idom_[i];
+				runner = idom_[runner]
+			) {
+				auto &df { result[runner] };
+				if (df.empty() || df.back() != i) { df.push_back(i); }
+			}
+		}
+	}
+	return result;
+}
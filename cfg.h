@@ -0,0 +1,48 @@
+#pragma once
+
+#include "ir.h"
+
+#include <unordered_map>
+#include <vector>
+
+// control flow graph of a function and its dominator tree; blocks are
+// identified by their index in layout order, all must be reachable
+class Cfg {
+		std::vector<Ir_Block::Ptr> blocks_;
+		std::unordered_map<Ir_Block::Ptr, int> index_;
+		std::vector<std::vector<int>> preds_;
+		std::vector<std::vector<int>> succs_;
+		std::vector<std::vector<int>> children_;
+		std::vector<int> idom_;
+		std::vector<int> rpo_;
+		std::vector<int> rpo_number_;
+		// entry and exit times of a walk of the dominator tree
+		std::vector<int> pre_;
+		std::vector<int> post_;
+
+		void compute_dominators();
+	public:
+		explicit Cfg(const Ir_Function &fn);
+
+		int size() const { return blocks_.size(); }
+		Ir_Block::Ptr block(int i) const { return blocks_[i]; }
+		int index(Ir_Block::Ptr block) const { return index_.at(block); }
+
+		const std::vector<int> &preds(int i) const { return preds_[i]; }
+		const std::vector<int> &succs(int i) const { return succs_[i]; }
+
+		// immediate dominator; the entry block has none (-1)
+		int idom(int i) const { return idom_[i]; }
+		const std::vector<int> &children(int i) const {
+			return children_[i];
+		}
+		const std::vector<int> &reverse_post_order() const { return rpo_; }
+		int rpo_number(int i) const { return rpo_number_[i]; }
+		// constant time with the numbers of the dominator tree walk
+		bool dominates(int a, int b) const {
+			return a >= 0 && b >= 0 && pre_[a] >= 0 && pre_[b] >= 0 &&
+				pre_[a] <= pre_[b] && post_[b] <= post_[a];
+		}
+
+		std::vector<std::vector<int>> frontiers() const;
+};
@@ -0,0 +1,171 @@
+#include "checker.h"
+
+namespace {
+	bool is_numeric(Type::Ptr t) {
+		return t == integer_type || t == real_type;
+	}
+
+	bool assignable(Type::Ptr to, Type::Ptr from) {
+		return to == from || (to == real_type && from == integer_type);
+	}
+}
+
+Type::Ptr Checker::expression(Expr e) const {
+	switch (e.kind) {
+		case Expr_Kind::literal:
+			return ast_.literal(e)->type();
+		case Expr_Kind::variable:
+			return ast_.variable(e)->type();
+		case Expr_Kind::plus: {
+			auto t { expression(ast_.plus(e)) };
+			if (! is_numeric(t)) { throw Error { "wrong type for unary +" }; }
+			return t;
+		}
+		case Expr_Kind::unary: {
+			auto &node { ast_.unary(e) };
+			auto t { expression(node.operand) };
+			if (node.op == Unary_Op::neg && ! is_numeric(t)) {
+				throw Error { "wrong type for unary -" };
+			}
+			if (node.op == Unary_Op::log_not && t != boolean_type) {
+				throw Error { "wrong type for unary ~" };
+			}
+			return t;
+		}
+		case Expr_Kind::binary: {
+			auto &node { ast_.binary(e) };
+			auto lt { expression(node.left) };
+			auto rt { expression(node.right) };
+			auto &info { binary_operator(node.op) };
+			if (
+				node.op == Binary_Op::log_and || node.op == Binary_Op::log_or
+			) {
+				if (lt != boolean_type || rt != boolean_type) {
+					throw Error {
+						std::string { "wrong type for " } + info.name
+					};
+				}
+				return boolean_type;
+			}
+			auto t { operand_type(node.op, lt, rt) };
+			return info.predicate ? boolean_type : t;
+		}
+		case Expr_Kind::call: {
+			auto &node { ast_.call(e) };
+			call(node);
+			if (! node.procedure->returns()) {
+				throw Error {
+					node.procedure->name() + " returns no value"
+				};
+			}
+			return node.procedure->returns();
+		}
+	}
+	return nullptr;
+}
+
+bool Checker::constant(Expr e) const {
+	switch (e.kind) {
+		case Expr_Kind::literal:
+			return true;
+		case Expr_Kind::plus:
+			return constant(ast_.plus(e));
+		case Expr_Kind::unary:
+			return constant(ast_.unary(e).operand);
+		case Expr_Kind::binary: {
+			auto &node { ast_.binary(e) };
+			return constant(node.left) && constant(node.right);
+		}
+		default:
+			return false;
+	}
+}
+
+void Checker::call(const Call_Node &node) const {
+	auto formal { node.procedure->args_begin() };
+	for (std::uint32_t i { 0 }; i < node.arguments.count; ++i, ++formal) {
+		auto arg { ast_.argument(node.arguments.first + i) };
+		auto t { expression(arg) };
+		if ((**formal).is_var()) {
+			if (t != (**formal).type()) {
+				throw Error {
+					"wrong type for VAR parameter " + (**formal).name()
+				};
+			}
+		} else if (! assignable((**formal).type(), t)) {
+			throw Error {
+				"wrong type for parameter " + (**formal).name()
+			};
+		}
+	}
+}
+
+void Checker::condition(const Branch_Node &branch) const {
+	at_line(branch.line, [&] {
+		if (expression(branch.condition) != boolean_type) {
+			throw Error { "wrong type for condition" };
+		}
+	});
+	statements(branch.body);
+}
+
+void Checker::statement(const Stmt &stmt) const {
+	switch (stmt.kind) {
+		case Stmt_Kind::assign: {
+			auto &node { ast_.assign(stmt) };
+			if (! assignable(node.target->type(), expression(node.value))) {
+				throw Error {
+					"wrong type for assignment to " + node.target->name()
+				};
+			}
+			break;
+		}
+		case Stmt_Kind::call:
+			call(ast_.call(stmt));
+			break;
+		case Stmt_Kind::if_: {
+			auto &node { ast_.if_statement(stmt) };
+			for (std::uint32_t i { 0 }; i < node.branches.count; ++i) {
+				condition(ast_.branch(node.branches.first + i));
+			}
+			statements(node.otherwise);
+			break;
+		}
+		case Stmt_Kind::while_: {
+			auto branches { ast_.while_statement(stmt) };
+			for (std::uint32_t i { 0 }; i < branches.count; ++i) {
+				condition(ast_.branch(branches.first + i));
+			}
+			break;
+		}
+		case Stmt_Kind::repeat: {
+			auto &node { ast_.repeat(stmt) };
+			statements(node.body);
+			if (expression(node.condition) != boolean_type) {
+				throw Error { "wrong type for condition" };
+			}
+			break;
+		}
+	}
+}
+
+void Checker::statements(Node_Range list) const {
+	for (std::uint32_t i { 0 }; i < list.count; ++i) {
+		auto &stmt { ast_.statement(list.first + i) };
+		at_line(stmt.line, [&] { statement(stmt); });
+	}
+}
+
+void Checker::body(const Body &body, Procedure::Ptr procedure) const {
+	statements(body.statements);
+	if (! body.has_result) { return; }
+	at_line(body.result_line, [&] {
+		if (! procedure->returns()) {
+			throw Error { "proper procedure " + procedure->name() +
+				" returns a value" };
+		}
+		if (! assignable(procedure->returns(), expression(body.result))) {
+			throw Error { "wrong type for RETURN of " + procedure->name() };
+		}
+	});
+}
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "ast.h"
+
+// type checks a tree before code is generated for it; INTEGER values
+// are accepted where REAL ones are expected
+class Checker {
+		const Ast &ast_;
+
+		void call(const Call_Node &node) const;
+		void condition(const Branch_Node &branch) const;
+		void statement(const Stmt &stmt) const;
+		void statements(Node_Range list) const;
+	public:
+		explicit Checker(const Ast &ast): ast_ { ast } { }
+
+		Type::Ptr expression(Expr e) const;
+		// whether the expression only combines literals, so that code
+		// generation folds it into one
+		bool constant(Expr e) const;
+		// procedure is nullptr for the module body, which returns nothing
+		void body(const Body &body, Procedure::Ptr procedure) const;
+};
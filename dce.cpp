@@ -0,0 +1,166 @@
+#include "passes.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+void remove_unreachable_blocks(Ir_Function &fn) {
+	if (fn.blocks.empty()) { return; }
+	std::unordered_set<Ir_Block::Ptr> reached { fn.blocks.front() };
+	std::vector<Ir_Block::Ptr> work { fn.blocks.front() };
+	while (! work.empty()) {
+		auto block { work.back() };
+		work.pop_back();
+		auto term { block->terminator() };
+		if (! term) { continue; }
+		for (auto target : term->targets) {
+			if (target && reached.insert(target).second) {
+				work.push_back(target);
+			}
+		}
+	}
+	fn.blocks.erase(std::remove_if(
+		fn.blocks.begin(), fn.blocks.end(),
+		[&](Ir_Block::Ptr block) { return ! reached.count(block); }
+	), fn.blocks.end());
+
+	for (auto block : fn.blocks) {
+		for (auto inst : block->instructions) {
+			if (inst->opcode != Opcode::phi) { continue; }
+			for (size_t i { inst->incoming.size() }; i-- > 0; ) {
+				if (! reached.count(inst->incoming[i])) {
+					inst->incoming.erase(inst->incoming.begin() + i);
+					inst->operands.erase(inst->operands.begin() + i);
+				}
+			}
+		}
+	}
+}
+
+// a phi that merges only one value besides itself is that value
+static void remove_trivial_phis(Ir_Function &fn) {
+	std::unordered_map<Value::Ptr, Value::Ptr> replaced;
+	auto resolve { [&](Value::Ptr value) {
+		for (;;) {
+			auto got { replaced.find(value) };
+			if (got == replaced.end()) { return value; }
+			value = got->second;
+		}
+	} };
+	for (bool changed { true }; changed; ) {
+		changed = false;
+		for (auto block : fn.blocks) {
+			for (auto inst : block->instructions) {
+				if (inst->opcode != Opcode::phi) { break; }
+				if (replaced.count(inst->result)) { continue; }
+				Value::Ptr same { nullptr };
+				bool trivial { true };
+				for (auto op : inst->operands) {
+					op = resolve(op);
+					if (op == inst->result || op == same) { continue; }
+					if (same) { trivial = false; break; }
+					same = op;
+				}
+				if (trivial && same) {
+					replaced[inst->result] = same;
+					changed = true;
+				}
+			}
+		}
+	}
+	if (replaced.empty()) { return; }
+	for (auto block : fn.blocks) {
+		auto &insts { block->instructions };
+		insts.erase(std::remove_if(
+			insts.begin(), insts.end(), [&](Ir_Instruction *inst) {
+				return inst->result && replaced.count(inst->result);
+			}
+		), insts.end());
+		for (auto inst : insts) {
+			for (auto &op : inst->operands) { op = resolve(op); }
+		}
+	}
+}
+
+// appends blocks to their only predecessor if it jumps to them
+static void merge_blocks(Ir_Function &fn) {
+	std::unordered_map<Ir_Block::Ptr, int> preds;
+	for (auto block : fn.blocks) {
+		if (auto term { block->terminator() }) {
+			for (auto target : term->targets) {
+				if (target) { ++preds[target]; }
+			}
+		}
+	}
+	std::unordered_set<Ir_Block::Ptr> merged;
+	for (auto block : fn.blocks) {
+		if (merged.count(block)) { continue; }
+		for (;;) {
+			auto term { block->terminator() };
+			if (! term || term->opcode != Opcode::branch) { break; }
+			auto next { term->targets[0] };
+			if (
+				next == block || next == fn.blocks.front() ||
+				preds[next] != 1 ||
+				next->instructions.front()->opcode == Opcode::phi
+			) {
+				break;
+			}
+			auto &insts { block->instructions };
+			insts.pop_back();
+			insts.insert(
+				insts.end(), next->instructions.begin(),
+				next->instructions.end()
+			);
+			merged.insert(next);
+			if (auto last { block->terminator() }) {
+				for (auto target : last->targets) {
+					if (! target) { continue; }
+					for (auto inst : target->instructions) {
+						if (inst->opcode != Opcode::phi) { break; }
+						std::replace(
+							inst->incoming.begin(), inst->incoming.end(),
+							next, block
+						);
+					}
+				}
+			}
+		}
+	}
+	fn.blocks.erase(std::remove_if(
+		fn.blocks.begin(), fn.blocks.end(),
+		[&](Ir_Block::Ptr block) { return merged.count(block) > 0; }
+	), fn.blocks.end());
+}
+
+void eliminate_dead_code(Ir_Function &fn, Pass_Context &context) {
+	remove_unreachable_blocks(fn);
+	remove_trivial_phis(fn);
+	merge_blocks(fn);
+
+	// removing an instruction may make its operands unused, so repeat
+	// until nothing changes
+	for (bool changed { true }; changed; ) {
+		changed = false;
+		std::unordered_set<Value::Ptr> used;
+		for (auto block : fn.blocks) {
+			for (auto inst : block->instructions) {
+				used.insert(inst->operands.begin(), inst->operands.end());
+			}
+		}
+		for (auto block : fn.blocks) {
+			auto &insts { block->instructions };
+			auto end { std::remove_if(
+				insts.begin(), insts.end(), [&](Ir_Instruction *inst) {
+					return ! inst->has_side_effects() &&
+						! used.count(inst->result);
+				}
+			) };
+			if (end != insts.end()) {
+				context.stats.add("dce.removed", insts.end() - end);
+				insts.erase(end, insts.end());
+				changed = true;
+			}
+		}
+	}
+}
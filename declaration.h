@@ -1,16 +1,19 @@
 #pragma once
 
+#include "symbol.h"
+
 #include <string>
-#include <memory>
 
+// declarations live in an arena; a Ptr is a plain non-owning handle
 class Declaration {
-		const std::string name_;
+		const Symbol name_;
 	protected:
-		Declaration(std::string name): name_ { name } { }
+		Declaration(Symbol name): name_ { name } { }
 
 	public:
-		using Ptr = std::shared_ptr<Declaration>;
+		using Ptr = Declaration *;
 		virtual ~Declaration() { }
 
-		const std::string &name() const { return name_; }
+		Symbol symbol() const { return name_; }
+		const std::string &name() const { return name_.str(); }
 };
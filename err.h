@@ -5,7 +5,13 @@
 
 class Error: public std::exception {
 		std::string what_;
+		int line_;
 	public:
-		Error(std::string what): what_ { what } { }
+		Error(std::string what, int line = 0):
+			what_ { what }, line_ { line }
+		{ }
 		const char *what() const noexcept override { return what_.c_str(); }
+
+		int line() const { return line_; }
+		void set_line(int line) { if (! line_) { line_ = line; } }
 };
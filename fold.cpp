@@ -0,0 +1,286 @@
+#include "fold.h"
+
+#include "err.h"
+
+namespace {
+	#define FOLD(name, type, expr) \
+		Literal::Ptr name(Constant_Pool &pool, type a, type b) { \
+			return pool.get(expr); \
+		}
+	// INTEGER arithmetic wraps around like the generated code
+	FOLD(add_int, int, static_cast<int>(
+		static_cast<unsigned>(a) + static_cast<unsigned>(b)
+	))
+	FOLD(sub_int, int, static_cast<int>(
+		static_cast<unsigned>(a) - static_cast<unsigned>(b)
+	))
+	FOLD(mul_int, int, static_cast<int>(
+		static_cast<unsigned>(a) * static_cast<unsigned>(b)
+	))
+	FOLD(add_real, double, a + b)
+	FOLD(sub_real, double, a - b)
+	FOLD(mul_real, double, a * b)
+	FOLD(eq_int, int, a == b)
+	FOLD(ne_int, int, a != b)
+	FOLD(lt_int, int, a < b)
+	FOLD(le_int, int, a <= b)
+	FOLD(gt_int, int, a > b)
+	FOLD(ge_int, int, a >= b)
+	FOLD(eq_real, double, a == b)
+	FOLD(ne_real, double, a != b)
+	FOLD(lt_real, double, a < b)
+	FOLD(le_real, double, a <= b)
+	FOLD(gt_real, double, a > b)
+	FOLD(ge_real, double, a >= b)
+	FOLD(eq_bool, bool, a == b)
+	FOLD(ne_bool, bool, a != b)
+	FOLD(and_bool, bool, a && b)
+	FOLD(or_bool, bool, a || b)
+
+	// truncating; the quotient of the smallest INTEGER by -1 wraps
+	int quotient(int a, int b) {
+		if (! b) { throw Error { "division by zero" }; }
+		if (b == -1) { return static_cast<int>(0u - a); }
+		return a / b;
+	}
+
+	int remainder(int a, int b) {
+		if (! b) { throw Error { "division by zero" }; }
+		return b == -1 ? 0 : a % b;
+	}
+
+	// DIV and MOD round towards negative infinity
+	Literal::Ptr div_int(Constant_Pool &pool, int a, int b) {
+		auto q { quotient(a, b) };
+		auto r { remainder(a, b) };
+		return pool.get(r && (r ^ b) < 0 ? q - 1 : q);
+	}
+
+	Literal::Ptr mod_int(Constant_Pool &pool, int a, int b) {
+		auto r { remainder(a, b) };
+		return pool.get(r && (r ^ b) < 0 ? r + b : r);
+	}
+
+	Literal::Ptr quot_int(Constant_Pool &pool, int a, int b) {
+		return pool.get(quotient(a, b));
+	}
+
+	Literal::Ptr rem_int(Constant_Pool &pool, int a, int b) {
+		return pool.get(remainder(a, b));
+	}
+
+	FOLD(shl_int, int, static_cast<int>(
+		static_cast<unsigned>(a) << (b & 31)
+	))
+	FOLD(ashr_int, int, a >> (b & 31))
+	FOLD(lshr_int, int, static_cast<int>(
+		static_cast<unsigned>(a) >> (b & 31)
+	))
+	FOLD(and_int, int, a & b)
+	FOLD(or_int, int, a | b)
+	FOLD(xor_int, int, a ^ b)
+	FOLD(mul_high_int, int, static_cast<int>(
+		(static_cast<long long>(a) * b) >> 32
+	))
+	#undef FOLD
+
+	using O = Operand_Class;
+
+	// indexed by Binary_Op
+	const Binary_Operator operators[] {
+		{
+			"+", O::numeric, false, "add", "fadd", nullptr,
+			add_int, add_real, nullptr, true, 0, true, false, 0
+		}, {
+			"-", O::numeric, false, "sub", "fsub", nullptr,
+			sub_int, sub_real, nullptr, true, 0, false, false, 0
+		}, {
+			"*", O::numeric, false, "mul", "fmul", nullptr,
+			mul_int, mul_real, nullptr, true, 1, true, true, 0
+		}, {
+			"DIV", O::integer, false, nullptr, nullptr, nullptr,
+			div_int, nullptr, nullptr, true, 1, false, false, 0
+		}, {
+			"MOD", O::integer, false, nullptr, nullptr, nullptr,
+			mod_int, nullptr, nullptr, false, 0, false, false, 0
+		}, {
+			"=", O::any, true, "icmp eq", "fcmp oeq", "icmp eq",
+			eq_int, eq_real, eq_bool, false, 0, false, false, 0
+		}, {
+			"#", O::any, true, "icmp ne", "fcmp one", "icmp ne",
+			ne_int, ne_real, ne_bool, false, 0, false, false, 0
+		}, {
+			"<", O::numeric, true, "icmp slt", "fcmp olt", nullptr,
+			lt_int, lt_real, nullptr, false, 0, false, false, 0
+		}, {
+			"<=", O::numeric, true, "icmp sle", "fcmp ole", nullptr,
+			le_int, le_real, nullptr, false, 0, false, false, 0
+		}, {
+			">", O::numeric, true, "icmp sgt", "fcmp ogt", nullptr,
+			gt_int, gt_real, nullptr, false, 0, false, false, 0
+		}, {
+			">=", O::numeric, true, "icmp sge", "fcmp oge", nullptr,
+			ge_int, ge_real, nullptr, false, 0, false, false, 0
+		}, {
+			"&", O::boolean, false, nullptr, nullptr, "and",
+			nullptr, nullptr, and_bool, true, 1, true, true, 0
+		}, {
+			"OR", O::boolean, false, nullptr, nullptr, "or",
+			nullptr, nullptr, or_bool, true, 0, true, true, 1
+		}, {
+			"quot", O::integer, false, "sdiv", nullptr, nullptr,
+			quot_int, nullptr, nullptr, true, 1, false, false, 0
+		}, {
+			"rem", O::integer, false, "srem", nullptr, nullptr,
+			rem_int, nullptr, nullptr, false, 0, false, false, 0
+		}, {
+			"shl", O::integer, false, "shl", nullptr, nullptr,
+			shl_int, nullptr, nullptr, true, 0, false, false, 0
+		}, {
+			"ashr", O::integer, false, "ashr", nullptr, nullptr,
+			ashr_int, nullptr, nullptr, true, 0, false, false, 0
+		}, {
+			"lshr", O::integer, false, "lshr", nullptr, nullptr,
+			lshr_int, nullptr, nullptr, true, 0, false, false, 0
+		}, {
+			"and", O::integer, false, "and", nullptr, nullptr,
+			and_int, nullptr, nullptr, true, -1, true, true, 0
+		}, {
+			"or", O::integer, false, "or", nullptr, nullptr,
+			or_int, nullptr, nullptr, true, 0, true, true, -1
+		}, {
+			"xor", O::integer, false, "xor", nullptr, nullptr,
+			xor_int, nullptr, nullptr, true, 0, true, false, 0
+		}, {
+			"mulh", O::integer, false, nullptr, nullptr, nullptr,
+			mul_high_int, nullptr, nullptr, false, 0, true, true, 0
+		}
+	};
+
+	template<typename LIT> auto value_of(Value::Ptr v) {
+		return static_cast<LIT *>(v)->value();
+	}
+}
+
+const Binary_Operator &binary_operator(Binary_Op op) {
+	return operators[static_cast<int>(op)];
+}
+
+Type::Ptr operand_type(Binary_Op op, Type::Ptr lt, Type::Ptr rt) {
+	auto &info { binary_operator(op) };
+	bool numeric {
+		(lt == integer_type || lt == real_type) &&
+		(rt == integer_type || rt == real_type)
+	};
+	switch (info.operands) {
+		case Operand_Class::integer:
+			if (lt == integer_type && rt == integer_type) {
+				return integer_type;
+			}
+			break;
+		case Operand_Class::boolean:
+			if (lt == boolean_type && rt == boolean_type) {
+				return boolean_type;
+			}
+			break;
+		case Operand_Class::any:
+			if (lt == boolean_type && rt == boolean_type) {
+				return boolean_type;
+			}
+			[[fallthrough]];
+		case Operand_Class::numeric:
+			if (numeric) {
+				return lt == real_type || rt == real_type ?
+					real_type : integer_type;
+			}
+			break;
+	}
+	throw Error {
+		std::string { "wrong type for binary " } + info.name
+	};
+}
+
+Type::Ptr operand_type(Binary_Op op, Value::Ptr left, Value::Ptr right) {
+	return operand_type(op, left->type(), right->type());
+}
+
+const char *instruction(Binary_Op op, Type::Ptr operand_type) {
+	auto &info { binary_operator(op) };
+	if (operand_type == integer_type) { return info.int_instr; }
+	if (operand_type == real_type) { return info.real_instr; }
+	return info.bool_instr;
+}
+
+Value::Ptr fold(
+	Constant_Pool &pool, Binary_Op op, Value::Ptr left, Value::Ptr right
+) {
+	auto &info { binary_operator(op) };
+	auto lk { left->kind() };
+	auto rk { right->kind() };
+	if (lk == rk) {
+		switch (lk) {
+			case Value_Kind::int_literal:
+				if (! info.fold_int) { break; }
+				return info.fold_int(
+					pool, value_of<Integer_Literal>(left),
+					value_of<Integer_Literal>(right)
+				);
+			case Value_Kind::real_literal:
+				if (! info.fold_real) { break; }
+				return info.fold_real(
+					pool, value_of<Real_Literal>(left),
+					value_of<Real_Literal>(right)
+				);
+			case Value_Kind::bool_literal:
+				if (! info.fold_bool) { break; }
+				return info.fold_bool(
+					pool, value_of<Bool_Literal>(left),
+					value_of<Bool_Literal>(right)
+				);
+			default:
+				break;
+		}
+	}
+	// x * 0 is -0 or NaN and 0 + x is +0 for x = -0 in IEEE arithmetic,
+	// so REAL operands are only folded when both are literals
+	auto t { left->type() };
+	if (t == real_type || right->type() == real_type) { return nullptr; }
+	// pooled literals are unique, so comparing pointers is enough
+	if (info.has_absorbing) {
+		auto absorbing { pool.number(t, info.absorbing) };
+		if (left == absorbing || right == absorbing) {
+			return absorbing;
+		}
+	}
+	if (info.has_identity) {
+		auto identity { pool.number(t, info.identity) };
+		if (right == identity) { return left; }
+		if (info.commutative && left == identity) { return right; }
+	}
+	return nullptr;
+}
+
+Value::Ptr fold(Constant_Pool &pool, Unary_Op op, Value::Ptr value) {
+	switch (value->kind()) {
+		case Value_Kind::int_literal:
+			if (op == Unary_Op::neg) {
+				return pool.get(static_cast<int>(
+					0u - value_of<Integer_Literal>(value)
+				));
+			}
+			break;
+		case Value_Kind::real_literal:
+			if (op == Unary_Op::neg) {
+				return pool.get(-value_of<Real_Literal>(value));
+			}
+			break;
+		case Value_Kind::bool_literal:
+			if (op == Unary_Op::log_not) {
+				return pool.get(! value_of<Bool_Literal>(value));
+			}
+			break;
+		default:
+			break;
+	}
+	return nullptr;
+}
@@ -0,0 +1,58 @@
+#pragma once
+
+#include "pool.h"
+
+// the source operators; the ones after log_or only appear after
+// lowering: truncating division, shifts, bit operations and the upper
+// half of a 64 bit product
+enum class Binary_Op {
+	add, sub, mul, int_div, mod,
+	equal, not_equal, less, less_equal, greater, greater_equal,
+	log_and, log_or,
+	quot, rem, shl, ashr, lshr, bit_and, bit_or, bit_xor, mul_high
+};
+
+// division by zero traps, so these must not be speculated
+inline bool can_trap(Binary_Op op) {
+	return op == Binary_Op::int_div || op == Binary_Op::mod ||
+		op == Binary_Op::quot || op == Binary_Op::rem;
+}
+
+enum class Unary_Op { neg, log_not };
+
+enum class Operand_Class { numeric, integer, boolean, any };
+
+// typed description of an operator: which operand types it accepts,
+// which instruction implements it and how it is folded
+struct Binary_Operator {
+	const char *name;
+	Operand_Class operands;
+	bool predicate;
+	const char *int_instr;
+	const char *real_instr;
+	const char *bool_instr;
+	Literal::Ptr (*fold_int)(Constant_Pool &pool, int a, int b);
+	Literal::Ptr (*fold_real)(Constant_Pool &pool, double a, double b);
+	Literal::Ptr (*fold_bool)(Constant_Pool &pool, bool a, bool b);
+	bool has_identity;
+	int identity;
+	bool commutative;
+	bool has_absorbing;
+	int absorbing;
+};
+
+const Binary_Operator &binary_operator(Binary_Op op);
+
+// common type of the operands (after promotion to REAL); throws if
+// the operator does not accept them
+Type::Ptr operand_type(Binary_Op op, Type::Ptr left, Type::Ptr right);
+Type::Ptr operand_type(Binary_Op op, Value::Ptr left, Value::Ptr right);
+
+const char *instruction(Binary_Op op, Type::Ptr operand_type);
+
+// the value of an operation if it is known at compile time or is one
+// of its operands; nullptr if code must be generated
+Value::Ptr fold(
+	Constant_Pool &pool, Binary_Op op, Value::Ptr left, Value::Ptr right
+);
+Value::Ptr fold(Constant_Pool &pool, Unary_Op op, Value::Ptr value);
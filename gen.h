@@ -1,94 +1,101 @@
 #pragma once
 
-#include <iostream>
+#include "fold.h"
+#include "value.h"
+
 #include <string>
+#include <string_view>
+#include <vector>
 
-#include "value.h"
+// a basic block name like "while_cond_3_1"; id and alt are left out
+// when negative
+struct Label {
+	const char *prefix;
+	int id { -1 };
+	int alt { -1 };
+};
+
+inline std::string label_name(const Label &label) {
+	std::string name { label.prefix };
+	if (label.id >= 0) { name += std::to_string(label.id); }
+	if (label.alt >= 0) { name += "_" + std::to_string(label.alt); }
+	return name;
+}
 
+// a formal parameter; a VAR parameter holds the address of a variable
+struct Parameter {
+	Reference::Ptr ref;
+	bool by_reference { false };
+};
+
+// an actual parameter; by_reference passes the address of a variable
+struct Argument {
+	Value::Ptr value;
+	bool by_reference { false };
+};
+
+// interface of the code generators; Ast_Gen drives them from the tree
+// and emit from the IR
 class Gen {
 		int next_id_ { 0 };
 		int next_while_id_ { 0 };
 		int next_if_id_ { 0 };
 		int next_or_id_ { 0 };
 		int next_and_id_ { 0 };
-		int hidden_ { 0 };
+		int next_repeat_id_ { 0 };
 	public:
-		int next_id() { return hidden_ ? -1 : next_id_++; }
-		int next_while_id() { return hidden_ ? -1 : next_while_id_++; }
-		int next_if_id() { return hidden_ ? -1 : next_if_id_++; }
-		int next_or_id() { return hidden_ ? -1 : next_or_id_++; }
-		int next_and_id() { return hidden_ ? -1 : next_and_id_++; }
+		virtual ~Gen() { }
+
+		int next_id() { return next_id_++; }
+		int next_while_id() { return next_while_id_++; }
+		int next_if_id() { return next_if_id_++; }
+		int next_or_id() { return next_or_id_++; }
+		int next_and_id() { return next_and_id_++; }
+		int next_repeat_id() { return next_repeat_id_++; }
 
-		void hide() { ++hidden_; }
-		void show() { --hidden_; }
 		void reset() {
 			next_id_ = next_while_id_ = next_if_id_ = 0;
-			next_or_id_ = next_and_id_ = hidden_ = 0;
+			next_or_id_ = next_and_id_ = next_repeat_id_ = 0;
 		}
 
-		void append_raw(std::string str) { 
-			if (! hidden_) { std::cout << str << "\n"; }
-		}
-		void append(std::string str) { append_raw("\t" + str); }
+		// inline_hint is set for procedures declared INLINE
+		virtual void define(
+			std::string_view name, Type::Ptr returns,
+			const std::vector<Parameter> &params, bool inline_hint
+		) = 0;
+		virtual void end_define() = 0;
+		virtual void def_label(const Label &label) = 0;
+		virtual void branch(const Label &label) = 0;
+		virtual void conditional(
+			Value::Ptr value, const Label &true_label,
+			const Label &false_label
+		) = 0;
+		virtual void ret() = 0;
+		virtual void ret(Value::Ptr value) = 0;
+		virtual void alloca(Reference::Ptr ref) = 0;
+		virtual void load(Reference::Ptr result, Reference::Ptr ptr) = 0;
+		virtual void store(Value::Ptr value, Reference::Ptr ptr) = 0;
+		virtual void unary(
+			Reference::Ptr result, Unary_Op op, Value::Ptr value
+		) = 0;
+		virtual void binary(
+			Reference::Ptr result, Binary_Op op,
+			Value::Ptr left, Value::Ptr right
+		) = 0;
+		virtual void phi(
+			Reference::Ptr result,
+			const std::vector<std::pair<Value::Ptr, Label>> &incoming
+		) = 0;
+		virtual void select(
+			Reference::Ptr result, Value::Ptr condition,
+			Value::Ptr if_true, Value::Ptr if_false
+		) = 0;
+		// result is nullptr for proper procedures
+		virtual void call(
+			Reference::Ptr result, std::string_view name,
+			const std::vector<Argument> &args
+		) = 0;
 
-		void def_label(std::string label) { append_raw(label + ":"); }
-		void def_label(std::string label, int idx) {
-			def_label(label + std::to_string(idx));
-		}
-		void branch(std::string label) {
-			append("br label %" + label);
-		}
-		void branch(std::string label, int idx) {
-			branch(label + std::to_string(idx));
-		}
-		void conditional(
-			Value::Ptr value, std::string true_label,
-			std::string false_label
-		) {
-			append(
-				"br " + get_ir_type(value->type()) + " " +
-				value->name() + ", label %" + true_label +
-				", label %" + false_label
-			);
-		}
-		void conditional(
-			Value::Ptr value, std::string true_label, int true_idx,
-			std::string false_label, int false_idx
-		) {
-			conditional(
-				value, true_label + std::to_string(true_idx),
-				false_label + std::to_string(false_idx)
-			);
-		}
-		void conditional(
-			Value::Ptr value, std::string true_label, int true_idx,
-			std::string false_label
-		) {
-			conditional(
-				value, true_label + std::to_string(true_idx),
-				false_label
-			);
-		}
-		void conditional(
-			Value::Ptr value, std::string true_label,
-			std::string false_label, int false_idx
-		) {
-			conditional(
-				value, true_label,
-				false_label + std::to_string(false_idx)
-			);
-		}
-		void ret() { append("ret void"); }
-		void ret(Value::Ptr value) {
-			append(
-				"ret " + get_ir_type(value->type()) + " " +
-				value->name()
-			);
-		}
-		void alloca(Reference::Ptr ref) {
-			append(
-				ref->name() + " = alloca " +
-				get_ir_type(ref->type()) + ", align 4"
-			);
-		}
+		// called once after the whole module is generated
+		virtual void finish() { }
 };
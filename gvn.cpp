@@ -0,0 +1,242 @@
+#include "cfg.h"
+#include "passes.h"
+
+#include <algorithm>
+#include <array>
+#include <unordered_map>
+
+// dominator based value numbering: a pure instruction that computes
+// the same as one in a dominating block is replaced by it; loads reuse
+// the last load or store of the same variable as long as no store or
+// call can have changed it
+namespace {
+	struct Key {
+		Opcode opcode;
+		int op;
+		std::array<Value::Ptr, 3> operands;
+
+		bool operator==(const Key &other) const {
+			return opcode == other.opcode && op == other.op &&
+				operands == other.operands;
+		}
+	};
+
+	struct Key_Hash {
+		size_t operator()(const Key &key) const {
+			size_t hash { static_cast<size_t>(key.opcode) * 31 + key.op };
+			for (auto op : key.operands) {
+				hash = hash * 0x9e3779b97f4a7c15ull +
+					reinterpret_cast<uintptr_t>(op);
+			}
+			return hash;
+		}
+	};
+
+	// the value each variable is known to hold; changes are logged, so
+	// that leaving a block of the dominator tree undoes them, and
+	// clearing only raises the age below which entries are stale
+	class Memory {
+			struct Known {
+				Value::Ptr value;
+				size_t age;
+			};
+			std::unordered_map<Value::Ptr, Known> known_;
+			// the entry before each change; no value if there was none
+			std::vector<std::pair<Value::Ptr, Known>> undo_;
+			size_t next_age_ { 0 };
+			size_t floor_ { 0 };
+		public:
+			struct Mark {
+				size_t undo;
+				size_t floor;
+			};
+
+			Value::Ptr find(Value::Ptr var) const {
+				auto got { known_.find(var) };
+				return got == known_.end() || got->second.age < floor_ ?
+					nullptr : got->second.value;
+			}
+			void set(Value::Ptr var, Value::Ptr value) {
+				auto got { known_.find(var) };
+				undo_.push_back({ var, got == known_.end() ?
+					Known { nullptr, 0 } : got->second
+				});
+				known_[var] = { value, next_age_++ };
+			}
+			void clear() { floor_ = next_age_; }
+
+			Mark mark() const { return { undo_.size(), floor_ }; }
+			void release(const Mark &mark) {
+				for (; undo_.size() > mark.undo; undo_.pop_back()) {
+					auto &[var, known] { undo_.back() };
+					if (known.value) {
+						known_[var] = known;
+					} else {
+						known_.erase(var);
+					}
+				}
+				floor_ = mark.floor;
+			}
+	};
+
+	class Numbering {
+			Ir_Function &fn_;
+			Cfg cfg_;
+			std::unordered_map<Key, Value::Ptr, Key_Hash> available_;
+			std::vector<Key> scope_;
+			Memory memory_;
+			std::unordered_map<Value::Ptr, Value::Ptr> replaced_;
+			std::unordered_map<Value::Ptr, bool> locals_;
+			size_t removed_ { 0 };
+
+			Value::Ptr resolve(Value::Ptr value) const;
+			bool key(const Ir_Instruction *inst, Key &key) const;
+			bool redundant(Ir_Instruction *inst);
+			void visit(int block);
+			void walk();
+		public:
+			Numbering(Ir_Function &fn);
+			size_t run();
+	};
+}
+
+Numbering::Numbering(Ir_Function &fn): fn_ { fn }, cfg_ { fn } {
+	for (auto inst : fn.blocks.front()->instructions) {
+		if (inst->opcode == Opcode::alloca) { locals_[inst->result] = true; }
+	}
+}
+
+Value::Ptr Numbering::resolve(Value::Ptr value) const {
+	for (;;) {
+		auto got { replaced_.find(value) };
+		if (got == replaced_.end()) { return value; }
+		value = got->second;
+	}
+}
+
+// operands of commutative operators are ordered, so a + b and b + a
+// get the same key
+bool Numbering::key(const Ir_Instruction *inst, Key &key) const {
+	auto &ops { inst->operands };
+	key = { inst->opcode, 0, { nullptr, nullptr, nullptr } };
+	switch (inst->opcode) {
+		case Opcode::unary:
+			key.op = static_cast<int>(inst->unary_op);
+			break;
+		case Opcode::binary:
+			key.op = static_cast<int>(inst->binary_op);
+			break;
+		case Opcode::select:
+			break;
+		default:
+			return false;
+	}
+	std::copy(ops.begin(), ops.end(), key.operands.begin());
+	if (
+		inst->opcode == Opcode::binary &&
+		binary_operator(inst->binary_op).commutative &&
+		std::less<Value::Ptr> { }(key.operands[1], key.operands[0])
+	) {
+		std::swap(key.operands[0], key.operands[1]);
+	}
+	return true;
+}
+
+bool Numbering::redundant(Ir_Instruction *inst) {
+	for (auto &op : inst->operands) { op = resolve(op); }
+	auto &ops { inst->operands };
+	switch (inst->opcode) {
+		case Opcode::load: {
+			if (auto got { memory_.find(ops[0]) }) {
+				replaced_[inst->result] = got;
+				return true;
+			}
+			memory_.set(ops[0], inst->result);
+			return false;
+		}
+		case Opcode::store:
+			// only stores to local variables are known not to alias
+			if (! locals_.count(ops[1])) { memory_.clear(); }
+			memory_.set(ops[1], ops[0]);
+			return false;
+		case Opcode::call:
+			memory_.clear();
+			return false;
+		default:
+			break;
+	}
+	Key k;
+	if (! key(inst, k)) { return false; }
+	auto [got, inserted] { available_.insert({ k, inst->result }) };
+	if (inserted) {
+		scope_.push_back(k);
+		return false;
+	}
+	replaced_[inst->result] = got->second;
+	return true;
+}
+
+void Numbering::visit(int b) {
+	auto &insts { cfg_.block(b)->instructions };
+	auto end { std::remove_if(
+		insts.begin(), insts.end(), [&](Ir_Instruction *inst) {
+			return redundant(inst);
+		}
+	) };
+	removed_ += insts.end() - end;
+	insts.erase(end, insts.end());
+}
+
+// preorder walk of the dominator tree on an explicit stack; leaving a
+// block drops the values and memory it added. memory state only flows
+// into a block that its dominator enters directly; a join may be
+// reached through stores on another path
+void Numbering::walk() {
+	struct Step {
+		int block;
+		bool leaving;
+		size_t scope;
+		Memory::Mark memory;
+	};
+	std::vector<Step> work { { 0, false, 0, { } } };
+	while (! work.empty()) {
+		auto step { work.back() };
+		work.pop_back();
+		if (step.leaving) {
+			while (scope_.size() > step.scope) {
+				available_.erase(scope_.back());
+				scope_.pop_back();
+			}
+			memory_.release(step.memory);
+			continue;
+		}
+		auto b { step.block };
+		work.push_back({ b, true, scope_.size(), memory_.mark() });
+		auto &preds { cfg_.preds(b) };
+		if (preds.size() != 1 || preds.front() != cfg_.idom(b)) {
+			memory_.clear();
+		}
+		visit(b);
+		auto &children { cfg_.children(b) };
+		for (auto c { children.rbegin() }; c != children.rend(); ++c) {
+			work.push_back({ *c, false, 0, { } });
+		}
+	}
+}
+
+size_t Numbering::run() {
+	walk();
+	// phis may use values of blocks visited later
+	for (auto block : fn_.blocks) {
+		for (auto inst : block->instructions) {
+			for (auto &op : inst->operands) { op = resolve(op); }
+		}
+	}
+	return removed_;
+}
+
+void number_values(Ir_Function &fn, Pass_Context &context) {
+	remove_unreachable_blocks(fn);
+	if (fn.blocks.empty()) { return; }
+	context.stats.add("gvn.removed", Numbering { fn }.run());
+}
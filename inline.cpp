@@ -0,0 +1,247 @@
+#include "passes.h"
+
+#include <algorithm>
+#include <unordered_set>
+
+// callees are finished and optimized before their callers, so the
+// copies need no further inlining; a call is split off into a block
+// that the returns of the copy branch to
+namespace {
+	const char *const inline_prefix { "inline_" };
+
+	// instructions that remain after inlining
+	int cost(const Ir_Function &fn) {
+		int cost { 0 };
+		for (auto block : fn.blocks) {
+			for (auto inst : block->instructions) {
+				switch (inst->opcode) {
+					case Opcode::alloca:
+					case Opcode::phi:
+					case Opcode::branch:
+					case Opcode::ret:
+						break;
+					default:
+						++cost;
+				}
+			}
+		}
+		return cost;
+	}
+
+	bool calls(const Ir_Function &fn, const std::string &name) {
+		for (auto block : fn.blocks) {
+			for (auto inst : block->instructions) {
+				if (inst->opcode == Opcode::call && inst->callee == name) {
+					return true;
+				}
+			}
+		}
+		return false;
+	}
+
+	class Inliner {
+			Ir_Function &fn_;
+			Pass_Context &context_;
+			int next_id_ { 0 };
+			std::unordered_set<Ir_Block::Ptr> copies_;
+			std::unordered_map<Value::Ptr, Value::Ptr> replaced_;
+
+			Value::Ptr resolve(Value::Ptr value) const;
+			void remark(bool missed, const std::string &message) {
+				context_.remarks.add("inline", missed, message);
+			}
+			const Ir_Function *decide(const Ir_Instruction *call);
+			Ir_Block::Ptr expand(
+				Ir_Block::Ptr block, size_t at, const Ir_Function &callee
+			);
+		public:
+			Inliner(Ir_Function &fn, Pass_Context &context);
+			size_t run();
+	};
+}
+
+Inliner::Inliner(Ir_Function &fn, Pass_Context &context):
+	fn_ { fn }, context_ { context }
+{
+	for (auto block : fn.blocks) {
+		if (block->label().prefix == inline_prefix) {
+			next_id_ = std::max(next_id_, block->label().id + 1);
+		}
+	}
+}
+
+Value::Ptr Inliner::resolve(Value::Ptr value) const {
+	for (;;) {
+		auto got { replaced_.find(value) };
+		if (got == replaced_.end()) { return value; }
+		value = got->second;
+	}
+}
+
+// the body to inline or nullptr; the reason is reported either way
+const Ir_Function *Inliner::decide(const Ir_Instruction *call) {
+	auto names { "'" + call->callee + "' " };
+	auto into { "into '" + fn_.name() + "'" };
+	auto missed { [&](const std::string &reason) {
+		remark(true, names + "not inlined " + into + " because " + reason);
+		return nullptr;
+	} };
+	auto got { context_.callees.find(call->callee) };
+	if (got == context_.callees.end()) {
+		return missed(call->callee == fn_.name() ?
+			"it is recursive" : "its definition is unavailable"
+		);
+	}
+	const auto &callee { got->second };
+	auto cost { std::to_string(callee.cost) };
+	auto threshold { std::to_string(context_.inline_threshold) };
+	if (callee.recursive) { return missed("it is recursive"); }
+	if (! callee.body) {
+		return missed(
+			"too costly (cost=" + cost + ", threshold=" + threshold + ")"
+		);
+	}
+	if (callee.cost > context_.inline_threshold) {
+		remark(false,
+			names + "inlined " + into + " with (cost=" + cost +
+			"): INLINE hint"
+		);
+	} else {
+		remark(false,
+			names + "inlined " + into + " with (cost=" + cost +
+			", threshold=" + threshold + ")"
+		);
+	}
+	return callee.body.get();
+}
+
+// returns the block with the instructions after the call
+Ir_Block::Ptr Inliner::expand(
+	Ir_Block::Ptr block, size_t at, const Ir_Function &callee
+) {
+	auto id { next_id_++ };
+	auto call { block->instructions[at] };
+	Ir_Copier copier { fn_ };
+	const auto &params { callee.params() };
+	for (size_t i { 0 }; i < params.size(); ++i) {
+		copier.map(params[i].ref, resolve(call->operands[i]));
+	}
+	auto copies { copier.copy(callee, inline_prefix, id) };
+	copies_.insert(copies.begin(), copies.end());
+
+	auto rest { fn_.create_block({
+		inline_prefix, id, static_cast<int>(copies.size())
+	}) };
+	auto &insts { block->instructions };
+	rest->instructions.assign(insts.begin() + at + 1, insts.end());
+	insts.erase(insts.begin() + at, insts.end());
+	auto enter { fn_.create(Opcode::branch) };
+	enter->targets[0] = copies.front();
+	insts.push_back(enter);
+	if (auto term { rest->terminator() }) {
+		for (auto target : term->targets) {
+			if (! target) { continue; }
+			for (auto inst : target->instructions) {
+				if (inst->opcode != Opcode::phi) { break; }
+				std::replace(
+					inst->incoming.begin(), inst->incoming.end(), block, rest
+				);
+			}
+		}
+	}
+
+	// allocas stay in the entry block, the copy may run in a loop
+	auto &entry { fn_.blocks.front()->instructions };
+	auto pos { entry.begin() };
+	while (pos != entry.end() && (**pos).opcode == Opcode::alloca) {
+		++pos;
+	}
+	auto result { fn_.create(Opcode::phi) };
+	for (auto copy : copies) {
+		auto &body { copy->instructions };
+		for (auto inst : body) {
+			if (inst->opcode == Opcode::alloca) {
+				pos = entry.insert(pos, inst) + 1;
+			}
+		}
+		body.erase(std::remove_if(
+			body.begin(), body.end(), [](Ir_Instruction *inst) {
+				return inst->opcode == Opcode::alloca;
+			}
+		), body.end());
+		auto term { copy->terminator() };
+		if (term->opcode != Opcode::ret) { continue; }
+		if (! term->operands.empty()) {
+			result->operands.push_back(term->operands[0]);
+			result->incoming.push_back(copy);
+		}
+		term->opcode = Opcode::branch;
+		term->operands.clear();
+		term->targets[0] = rest;
+	}
+	if (call->result && ! result->operands.empty()) {
+		if (result->operands.size() == 1) {
+			replaced_[call->result] = result->operands.front();
+		} else {
+			result->result = Reference::create(
+				fn_.arena(), -1, call->result->type()
+			);
+			rest->instructions.insert(rest->instructions.begin(), result);
+			replaced_[call->result] = result->result;
+		}
+	}
+
+	auto after { std::find(fn_.blocks.begin(), fn_.blocks.end(), block) };
+	after = fn_.blocks.insert(after + 1, copies.begin(), copies.end());
+	fn_.blocks.insert(after + copies.size(), rest);
+	return rest;
+}
+
+// blocks are visited in layout order, which reaches the rest of a
+// split block after the copies
+size_t Inliner::run() {
+	size_t inlined { 0 };
+	for (size_t b { 0 }; b < fn_.blocks.size(); ++b) {
+		auto block { fn_.blocks[b] };
+		if (copies_.count(block)) { continue; }
+		auto &insts { block->instructions };
+		for (size_t i { 0 }; i < insts.size(); ++i) {
+			if (insts[i]->opcode != Opcode::call) { continue; }
+			if (auto callee { decide(insts[i]) }) {
+				expand(block, i, *callee);
+				++inlined;
+				break;
+			}
+		}
+	}
+	for (auto block : fn_.blocks) {
+		for (auto inst : block->instructions) {
+			for (auto &op : inst->operands) { op = resolve(op); }
+		}
+	}
+	return inlined;
+}
+
+void inline_calls(Ir_Function &fn, Pass_Context &context) {
+	context.stats.add("inline.inlined", Inliner { fn, context }.run());
+}
+
+// the body is copied, the values of the function die with the
+// procedure in the parser
+void remember_callee(const Ir_Function &fn, Pass_Context &context) {
+	auto &callee { context.callees[fn.name()] };
+	callee.cost = cost(fn);
+	callee.recursive = calls(fn, fn.name());
+	callee.body = nullptr;
+	if (
+		callee.recursive ||
+		(callee.cost > context.inline_threshold && ! fn.inline_hint())
+	) {
+		return;
+	}
+	callee.body = std::make_unique<Ir_Function>(
+		fn.name(), fn.returns(), fn.params(), fn.inline_hint()
+	);
+	Ir_Copier copier { *callee.body };
+	callee.body->blocks = copier.copy(fn, inline_prefix, 0);
+}
@@ -0,0 +1,267 @@
+#include "ir.h"
+
+#include "passes.h"
+
+void emit(Ir_Function &fn, Gen &gen) {
+	int next { 0 };
+	for (const auto &param : fn.params()) { param.ref->renumber(next++); }
+	for (auto block : fn.blocks) {
+		for (auto inst : block->instructions) {
+			if (inst->result) { inst->result->renumber(next++); }
+		}
+	}
+
+	gen.define(fn.name(), fn.returns(), fn.params(), fn.inline_hint());
+	for (auto block : fn.blocks) {
+		gen.def_label(block->label());
+		for (auto inst : block->instructions) {
+			auto &ops { inst->operands };
+			switch (inst->opcode) {
+				case Opcode::alloca:
+					gen.alloca(inst->result); break;
+				case Opcode::load:
+					gen.load(
+						inst->result, static_cast<Reference *>(ops[0])
+					);
+					break;
+				case Opcode::store:
+					gen.store(ops[0], static_cast<Reference *>(ops[1]));
+					break;
+				case Opcode::unary:
+					gen.unary(inst->result, inst->unary_op, ops[0]);
+					break;
+				case Opcode::binary:
+					gen.binary(
+						inst->result, inst->binary_op, ops[0], ops[1]
+					);
+					break;
+				case Opcode::phi: {
+					std::vector<std::pair<Value::Ptr, Label>> incoming;
+					for (size_t i { 0 }; i < ops.size(); ++i) {
+						incoming.push_back({
+							ops[i], inst->incoming[i]->label()
+						});
+					}
+					gen.phi(inst->result, incoming);
+					break;
+				}
+				case Opcode::select:
+					gen.select(inst->result, ops[0], ops[1], ops[2]);
+					break;
+				case Opcode::call: {
+					std::vector<Argument> args;
+					for (size_t i { 0 }; i < ops.size(); ++i) {
+						args.push_back({ ops[i], inst->by_reference[i] });
+					}
+					gen.call(inst->result, inst->callee, args);
+					break;
+				}
+				case Opcode::branch:
+					gen.branch(inst->targets[0]->label()); break;
+				case Opcode::conditional:
+					gen.conditional(
+						ops[0], inst->targets[0]->label(),
+						inst->targets[1]->label()
+					);
+					break;
+				case Opcode::ret:
+					if (ops.empty()) {
+						gen.ret();
+					} else {
+						gen.ret(ops[0]);
+					}
+					break;
+			}
+		}
+	}
+	gen.end_define();
+}
+
+std::vector<Ir_Block::Ptr> Ir_Copier::copy(
+	const Ir_Function &source, const char *prefix, int id
+) {
+	std::vector<Ir_Block::Ptr> copies;
+	for (auto block : source.blocks) {
+		auto copy { target_.create_block({
+			prefix, id, static_cast<int>(copies.size())
+		}) };
+		blocks_[block] = copy;
+		copies.push_back(copy);
+		for (auto inst : block->instructions) {
+			if (! inst->result) { continue; }
+			values_[inst->result] = Reference::create(
+				target_.arena(), -1, inst->result->type()
+			);
+		}
+	}
+	// all results are mapped before operands refer to them
+	for (size_t i { 0 }; i < copies.size(); ++i) {
+		for (auto inst : source.blocks[i]->instructions) {
+			auto copy { target_.create(inst->opcode) };
+			*copy = *inst;
+			if (inst->result) {
+				copy->result = static_cast<Reference *>(
+					values_.at(inst->result)
+				);
+			}
+			for (auto &op : copy->operands) { op = (*this)[op]; }
+			for (auto &from : copy->incoming) { from = blocks_.at(from); }
+			for (auto &target : copy->targets) {
+				if (target) { target = blocks_.at(target); }
+			}
+			copies[i]->instructions.push_back(copy);
+		}
+	}
+	return copies;
+}
+
+Ir_Block::Ptr Ir_Builder::block(const Label &label) {
+	auto &open { open_.back() };
+	auto &got { open.blocks[label_name(label)] };
+	if (! got) { got = open.function->create_block(label); }
+	return got;
+}
+
+// instructions behind a terminator are unreachable and dropped
+Ir_Instruction *Ir_Builder::append(Opcode opcode) {
+	if (open_.empty()) { return nullptr; }
+	auto &open { open_.back() };
+	if (! open.current || open.current->terminator()) { return nullptr; }
+	auto inst { open.function->create(opcode) };
+	open.current->instructions.push_back(inst);
+	return inst;
+}
+
+void Ir_Builder::define(
+	std::string_view name, Type::Ptr returns,
+	const std::vector<Parameter> &params, bool inline_hint
+) {
+	open_.push_back({
+		std::make_unique<Ir_Function>(name, returns, params, inline_hint)
+	});
+}
+
+void Ir_Builder::end_define() {
+	auto fn { std::move(open_.back().function) };
+	open_.pop_back();
+	passes_.run(*fn, context_);
+	remember_callee(*fn, context_);
+	lower_arithmetic(*fn, context_);
+	emit(*fn, target_);
+}
+
+void Ir_Builder::def_label(const Label &label) {
+	auto b { block(label) };
+	open_.back().function->blocks.push_back(b);
+	open_.back().current = b;
+}
+
+void Ir_Builder::branch(const Label &label) {
+	if (auto inst { append(Opcode::branch) }) {
+		inst->targets[0] = block(label);
+	}
+}
+
+void Ir_Builder::conditional(
+	Value::Ptr value, const Label &true_label, const Label &false_label
+) {
+	if (auto inst { append(Opcode::conditional) }) {
+		inst->operands = { value };
+		inst->targets[0] = block(true_label);
+		inst->targets[1] = block(false_label);
+	}
+}
+
+void Ir_Builder::ret() { append(Opcode::ret); }
+
+void Ir_Builder::ret(Value::Ptr value) {
+	if (auto inst { append(Opcode::ret) }) { inst->operands = { value }; }
+}
+
+void Ir_Builder::alloca(Reference::Ptr ref) {
+	if (open_.empty()) {
+		// module variables are not part of a function
+		target_.alloca(ref);
+		return;
+	}
+	// allocas are hoisted to the start of the entry block
+	auto &open { open_.back() };
+	auto inst { open.function->create(Opcode::alloca) };
+	inst->result = ref;
+	auto &entry { block({ "entry" })->instructions };
+	auto pos { entry.begin() };
+	while (pos != entry.end() && (**pos).opcode == Opcode::alloca) {
+		++pos;
+	}
+	entry.insert(pos, inst);
+}
+
+void Ir_Builder::load(Reference::Ptr result, Reference::Ptr ptr) {
+	if (auto inst { append(Opcode::load) }) {
+		inst->result = result;
+		inst->operands = { ptr };
+	}
+}
+
+void Ir_Builder::store(Value::Ptr value, Reference::Ptr ptr) {
+	if (auto inst { append(Opcode::store) }) {
+		inst->operands = { value, ptr };
+	}
+}
+
+void Ir_Builder::unary(
+	Reference::Ptr result, Unary_Op op, Value::Ptr value
+) {
+	if (auto inst { append(Opcode::unary) }) {
+		inst->result = result;
+		inst->unary_op = op;
+		inst->operands = { value };
+	}
+}
+
+void Ir_Builder::phi(
+	Reference::Ptr result,
+	const std::vector<std::pair<Value::Ptr, Label>> &incoming
+) {
+	if (auto inst { append(Opcode::phi) }) {
+		inst->result = result;
+		for (const auto &[value, label] : incoming) {
+			inst->operands.push_back(value);
+			inst->incoming.push_back(block(label));
+		}
+	}
+}
+
+void Ir_Builder::select(
+	Reference::Ptr result, Value::Ptr condition,
+	Value::Ptr if_true, Value::Ptr if_false
+) {
+	if (auto inst { append(Opcode::select) }) {
+		inst->result = result;
+		inst->operands = { condition, if_true, if_false };
+	}
+}
+
+void Ir_Builder::call(
+	Reference::Ptr result, std::string_view name,
+	const std::vector<Argument> &args
+) {
+	if (auto inst { append(Opcode::call) }) {
+		inst->result = result;
+		inst->callee = name;
+		for (const auto &arg : args) {
+			inst->operands.push_back(arg.value);
+			inst->by_reference.push_back(arg.by_reference);
+		}
+	}
+}
+
+void Ir_Builder::binary(
+	Reference::Ptr result, Binary_Op op, Value::Ptr left, Value::Ptr right
+) {
+	if (auto inst { append(Opcode::binary) }) {
+		inst->result = result;
+		inst->binary_op = op;
+		inst->operands = { left, right };
+	}
+}
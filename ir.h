@@ -0,0 +1,180 @@
+#pragma once
+
+#include "gen.h"
+#include "pool.h"
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+enum class Opcode {
+	alloca, load, store, unary, binary, phi, select, call,
+	branch, conditional, ret
+};
+
+class Ir_Block;
+
+// one instruction; result is nullptr for instructions without value;
+// the operands of a phi come from the blocks in incoming, the operands
+// of a call are its arguments
+struct Ir_Instruction {
+	Opcode opcode;
+	Reference::Ptr result { nullptr };
+	std::vector<Value::Ptr> operands;
+	std::vector<Ir_Block *> incoming;
+	Ir_Block *targets[2] { nullptr, nullptr };
+	Binary_Op binary_op { Binary_Op::add };
+	Unary_Op unary_op { Unary_Op::neg };
+	std::string callee;
+	std::vector<bool> by_reference;
+
+	bool is_terminator() const {
+		return opcode == Opcode::branch || opcode == Opcode::conditional ||
+			opcode == Opcode::ret;
+	}
+	bool has_side_effects() const {
+		return opcode == Opcode::store || opcode == Opcode::call ||
+			is_terminator();
+	}
+};
+
+class Ir_Block {
+		friend class Arena;
+		Label label_;
+		Ir_Block(const Label &label): label_ { label } { }
+	public:
+		using Ptr = Ir_Block *;
+		std::vector<Ir_Instruction *> instructions;
+
+		const Label &label() const { return label_; }
+		Ir_Instruction *terminator() const {
+			return instructions.empty() ||
+				! instructions.back()->is_terminator() ?
+				nullptr : instructions.back();
+		}
+};
+
+// a procedure in SSA form; the blocks are in layout order, the first
+// is the entry block; the function owns everything passes create
+class Ir_Function {
+		std::string name_;
+		Type::Ptr returns_;
+		std::vector<Parameter> params_;
+		bool inline_hint_;
+		Arena arena_;
+	public:
+		std::vector<Ir_Block::Ptr> blocks;
+
+		Ir_Function(
+			std::string_view name, Type::Ptr returns,
+			std::vector<Parameter> params, bool inline_hint
+		):
+			name_ { name }, returns_ { returns },
+			params_ { std::move(params) }, inline_hint_ { inline_hint }
+		{ }
+
+		const std::string &name() const { return name_; }
+		Type::Ptr returns() const { return returns_; }
+		const std::vector<Parameter> &params() const { return params_; }
+		bool inline_hint() const { return inline_hint_; }
+		Arena &arena() { return arena_; }
+
+		Ir_Block::Ptr create_block(const Label &label) {
+			return arena_.create<Ir_Block>(label);
+		}
+		Ir_Instruction *create(Opcode opcode) {
+			auto inst { arena_.create<Ir_Instruction>() };
+			inst->opcode = opcode;
+			return inst;
+		}
+};
+
+// copies the blocks of one function into another; results get new
+// references in the target, values that are not mapped, like literals
+// and module variables, are shared
+class Ir_Copier {
+		Ir_Function &target_;
+		std::unordered_map<Value::Ptr, Value::Ptr> values_;
+		std::unordered_map<const Ir_Block *, Ir_Block::Ptr> blocks_;
+	public:
+		explicit Ir_Copier(Ir_Function &target): target_ { target } { }
+
+		void map(Value::Ptr from, Value::Ptr to) { values_[from] = to; }
+		Value::Ptr operator[](Value::Ptr value) const {
+			auto got { values_.find(value) };
+			return got == values_.end() ? value : got->second;
+		}
+
+		// the copies in layout order; block i is labeled prefix, id, i
+		std::vector<Ir_Block::Ptr> copy(
+			const Ir_Function &source, const char *prefix, int id
+		);
+};
+
+// renumbers the values in layout order and drives a backend with them
+void emit(Ir_Function &fn, Gen &gen);
+
+class Pass_Manager;
+struct Pass_Context;
+
+// records what the parser generates as IR; each function is run
+// through the passes and emitted to the backend when it is complete,
+// nested procedures before their parent
+class Ir_Builder: public Gen {
+		struct Open_Function {
+			std::unique_ptr<Ir_Function> function;
+			Ir_Block::Ptr current { nullptr };
+			std::unordered_map<std::string, Ir_Block::Ptr> blocks;
+		};
+
+		Gen &target_;
+		const Pass_Manager &passes_;
+		Pass_Context &context_;
+		std::vector<Open_Function> open_;
+
+		Ir_Block::Ptr block(const Label &label);
+		Ir_Instruction *append(Opcode opcode);
+	public:
+		Ir_Builder(
+			Gen &target, const Pass_Manager &passes, Pass_Context &context
+		):
+			target_ { target }, passes_ { passes }, context_ { context }
+		{ }
+
+		void define(
+			std::string_view name, Type::Ptr returns,
+			const std::vector<Parameter> &params, bool inline_hint
+		) override;
+		void end_define() override;
+		void def_label(const Label &label) override;
+		void branch(const Label &label) override;
+		void conditional(
+			Value::Ptr value, const Label &true_label,
+			const Label &false_label
+		) override;
+		void ret() override;
+		void ret(Value::Ptr value) override;
+		void alloca(Reference::Ptr ref) override;
+		void load(Reference::Ptr result, Reference::Ptr ptr) override;
+		void store(Value::Ptr value, Reference::Ptr ptr) override;
+		void unary(
+			Reference::Ptr result, Unary_Op op, Value::Ptr value
+		) override;
+		void binary(
+			Reference::Ptr result, Binary_Op op,
+			Value::Ptr left, Value::Ptr right
+		) override;
+		void phi(
+			Reference::Ptr result,
+			const std::vector<std::pair<Value::Ptr, Label>> &incoming
+		) override;
+		void select(
+			Reference::Ptr result, Value::Ptr condition,
+			Value::Ptr if_true, Value::Ptr if_false
+		) override;
+		void call(
+			Reference::Ptr result, std::string_view name,
+			const std::vector<Argument> &args
+		) override;
+		void finish() override { target_.finish(); }
+};
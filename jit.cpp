@@ -0,0 +1,135 @@
+#include "jit.h"
+
+#include "err.h"
+#include "run_args.h"
+
+#include <cstdint>
+#include <cstring>
+#include <sys/mman.h>
+#include <unistd.h>
+
+namespace {
+	using Value_Class = Object_Code::Value_Class;
+
+	size_t page_align(size_t size) {
+		size_t page = ::sysconf(_SC_PAGESIZE);
+		return (size + page - 1) & ~(page - 1);
+	}
+
+	// the first six integer and eight real arguments travel in
+	// registers; both kinds are passed to every call, the callee only
+	// reads the ones it expects
+	constexpr int int_args { 6 };
+	constexpr int real_args { 8 };
+	using Int_Function = std::int64_t (*)(
+		std::int64_t, std::int64_t, std::int64_t, std::int64_t,
+		std::int64_t, std::int64_t, double, double, double, double,
+		double, double, double, double
+	);
+	using Real_Function = double (*)(
+		std::int64_t, std::int64_t, std::int64_t, std::int64_t,
+		std::int64_t, std::int64_t, double, double, double, double,
+		double, double, double, double
+	);
+}
+
+Jit::Jit(const Object_Code &code): code_ { code } {
+	for (const auto &reloc : code.relocations) {
+		if (
+			reloc.kind == Object_Code::Relocation::Kind::call &&
+			! find(reloc.symbol)
+		) {
+			throw Error { "undefined procedure " + reloc.symbol };
+		}
+	}
+	text_size_ = page_align(code.text.size());
+	size_ = text_size_ + page_align(code.data_size);
+	if (! size_) { return; }
+	auto memory { ::mmap(
+		nullptr, size_, PROT_READ | PROT_WRITE,
+		MAP_PRIVATE | MAP_ANONYMOUS, -1, 0
+	) };
+	if (memory == MAP_FAILED) {
+		throw Error { "cannot map memory for the code" };
+	}
+	memory_ = static_cast<char *>(memory);
+	std::memcpy(memory_, code.text.data(), code.text.size());
+
+	// the data follows the text, so every field fits 32 bits
+	for (const auto &reloc : code.relocations) {
+		auto place { memory_ + reloc.offset };
+		const char *target { memory_ + text_size_ };
+		if (reloc.kind == Object_Code::Relocation::Kind::call) {
+			target = memory_ + find(reloc.symbol)->offset;
+		}
+		std::int32_t value = target + reloc.addend - place;
+		std::memcpy(place, &value, sizeof(value));
+	}
+	if (text_size_ && ::mprotect(
+		memory_, text_size_, PROT_READ | PROT_EXEC
+	)) {
+		::munmap(memory_, size_);
+		memory_ = nullptr;
+		throw Error { "cannot make the code executable" };
+	}
+}
+
+Jit::~Jit() {
+	if (memory_) { ::munmap(memory_, size_); }
+}
+
+const Object_Code::Function *Jit::find(const std::string &name) const {
+	for (const auto &fn : code_.functions) {
+		if (fn.name == name) { return &fn; }
+	}
+	return nullptr;
+}
+
+std::string Jit::call(
+	const std::string &name, const std::vector<std::string> &args
+) {
+	auto fn { find(name) };
+	if (! fn) { throw Error { "no procedure " + name }; }
+	if (args.size() != fn->params.size()) {
+		throw Error {
+			name + " expects " + std::to_string(fn->params.size()) +
+			" arguments"
+		};
+	}
+	std::int64_t ints[int_args] { };
+	double reals[real_args] { };
+	int next_int { 0 }, next_real { 0 };
+	for (size_t i { 0 }; i < args.size(); ++i) {
+		auto cls { fn->params[i] };
+		if (cls == Value_Class::address) {
+			throw Error { "cannot pass VAR parameters to " + name };
+		}
+		if (cls == Value_Class::real) {
+			if (next_real == real_args) {
+				throw Error { "too many REAL arguments for " + name };
+			}
+			reals[next_real++] = parse_real_arg(args[i]);
+			continue;
+		}
+		if (next_int == int_args) {
+			throw Error { "too many arguments for " + name };
+		}
+		ints[next_int++] = parse_int_arg(cls, args[i]);
+	}
+
+	auto entry { memory_ + fn->offset };
+	if (fn->result == Value_Class::real) {
+		auto got { reinterpret_cast<Real_Function>(entry)(
+			ints[0], ints[1], ints[2], ints[3], ints[4], ints[5],
+			reals[0], reals[1], reals[2], reals[3], reals[4], reals[5],
+			reals[6], reals[7]
+		) };
+		return print_result(fn->result, 0, got);
+	}
+	auto got { reinterpret_cast<Int_Function>(entry)(
+		ints[0], ints[1], ints[2], ints[3], ints[4], ints[5],
+		reals[0], reals[1], reals[2], reals[3], reals[4], reals[5],
+		reals[6], reals[7]
+	) };
+	return print_result(fn->result, got, 0);
+}
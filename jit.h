@@ -0,0 +1,33 @@
+#pragma once
+
+#include "object_file.h"
+
+#include <string>
+#include <vector>
+
+// loads the code of a module into this process: the text is copied
+// and relocated in writable pages that become executable, but no
+// longer writable, before anything runs; the module data stays
+// writable and never executable
+class Jit {
+		const Object_Code &code_;
+		char *memory_ { nullptr };
+		size_t text_size_ { 0 };
+		size_t size_ { 0 };
+
+		const Object_Code::Function *find(const std::string &name) const;
+	public:
+		explicit Jit(const Object_Code &code);
+		Jit(const Jit &) = delete;
+		Jit &operator=(const Jit &) = delete;
+		~Jit();
+
+		bool has(const std::string &name) const { return find(name); }
+
+		// calls a function with arguments written as INTEGER, REAL or
+		// BOOLEAN literals; returns the printed result, or an empty
+		// string for proper procedures
+		std::string call(
+			const std::string &name, const std::vector<std::string> &args
+		);
+};
@@ -1,51 +1,110 @@
 #include "lexer.h"
 
 #include "err.h"
+#include "scan.h"
 
-#include <map>
 
 using namespace std::literals::string_literals;
 
 class Unknown_Char_Err: public Error {
 	public:
-		Unknown_Char_Err(char ch):
-			Error { "unknown input character '"s + ch + "'\n"s }
+		Unknown_Char_Err(char ch, int line):
+			Error { "unknown input character '"s + ch + "'\n"s, line }
 		{ }
 };
 
-static std::map<std::string, Token_Kind> keywords {
-	{ "ARRAY", Token_Kind::kw_ARRAY },
-	{ "BEGIN", Token_Kind::kw_BEGIN },
-	{ "CONST", Token_Kind::kw_CONST },
-	{ "DIV", Token_Kind::kw_DIV },
-	{ "DO", Token_Kind::kw_DO },
-	{ "IF", Token_Kind::kw_IF },
-	{ "IMPORT", Token_Kind::kw_IMPORT },
-	{ "ELSE", Token_Kind::kw_ELSE },
-	{ "ELSIF", Token_Kind::kw_ELSIF },
-	{ "END", Token_Kind::kw_END },
-	{ "FALSE", Token_Kind::kw_FALSE },
-	{ "MOD", Token_Kind::kw_MOD },
-	{ "MODULE", Token_Kind::kw_MODULE },
-	{ "OF", Token_Kind::kw_OF },
-	{ "OR", Token_Kind::kw_OR },
-	{ "PROCEDURE", Token_Kind::kw_PROCEDURE },
-	{ "REPEAT", Token_Kind::kw_REPEAT },
-	{ "RETURN", Token_Kind::kw_RETURN },
-	{ "THEN", Token_Kind::kw_THEN },
-	{ "TRUE", Token_Kind::kw_TRUE },
-	{ "TYPE", Token_Kind::kw_TYPE },
-	{ "UNTIL", Token_Kind::kw_UNTIL },
-	{ "VAR", Token_Kind::kw_VAR },
-	{ "WHILE", Token_Kind::kw_WHILE },
-	{ "WITH", Token_Kind::kw_WITH }
-};
+namespace Keywords {
+	struct Entry {
+		std::string_view name;
+		Token_Kind kind;
+	};
 
-namespace Char_Info {
-	inline bool is_whitespace(int c) {
-		return c == ' ' || c == '\t' || c == '\f' || c == '\v' ||
-			c == '\r' || c == '\n';
+	constexpr Entry entries[] {
+		{ "ARRAY", Token_Kind::kw_ARRAY },
+		{ "BEGIN", Token_Kind::kw_BEGIN },
+		{ "CONST", Token_Kind::kw_CONST },
+		{ "DIV", Token_Kind::kw_DIV },
+		{ "DO", Token_Kind::kw_DO },
+		{ "IF", Token_Kind::kw_IF },
+		{ "IMPORT", Token_Kind::kw_IMPORT },
+		{ "ELSE", Token_Kind::kw_ELSE },
+		{ "ELSIF", Token_Kind::kw_ELSIF },
+		{ "END", Token_Kind::kw_END },
+		{ "FALSE", Token_Kind::kw_FALSE },
+		{ "MOD", Token_Kind::kw_MOD },
+		{ "MODULE", Token_Kind::kw_MODULE },
+		{ "OF", Token_Kind::kw_OF },
+		{ "OR", Token_Kind::kw_OR },
+		{ "PROCEDURE", Token_Kind::kw_PROCEDURE },
+		{ "REPEAT", Token_Kind::kw_REPEAT },
+		{ "RETURN", Token_Kind::kw_RETURN },
+		{ "THEN", Token_Kind::kw_THEN },
+		{ "TRUE", Token_Kind::kw_TRUE },
+		{ "TYPE", Token_Kind::kw_TYPE },
+		{ "UNTIL", Token_Kind::kw_UNTIL },
+		{ "VAR", Token_Kind::kw_VAR },
+		{ "WHILE", Token_Kind::kw_WHILE },
+		{ "WITH", Token_Kind::kw_WITH }
+	};
+
+	constexpr unsigned table_size { 64 };
+	constexpr size_t min_length { 2 };
+	constexpr size_t max_length { 9 };
+
+	// the keywords differ in length, first, second or last char
+	constexpr unsigned hash(std::string_view name, unsigned seed) {
+		unsigned h = name.size();
+		h = h * seed + static_cast<unsigned char>(name[0]);
+		h = h * seed + static_cast<unsigned char>(name[1]);
+		h = h * seed + static_cast<unsigned char>(name.back());
+		return (h ^ (h >> 7)) % table_size;
+	}
+
+	constexpr bool is_perfect(unsigned seed) {
+		bool used[table_size] { };
+		for (const auto &e : entries) {
+			auto h { hash(e.name, seed) };
+			if (used[h]) { return false; }
+			used[h] = true;
+		}
+		return true;
+	}
+
+	constexpr unsigned find_seed() {
+		for (unsigned seed { 1 }; seed < 10000; ++seed) {
+			if (is_perfect(seed)) { return seed; }
+		}
+		return 0;
+	}
+
+	constexpr unsigned seed { find_seed() };
+	static_assert(seed, "no perfect hash for keywords");
+
+	struct Table {
+		const Entry *slots[table_size] { };
+	};
+
+	constexpr Table build_table() {
+		Table table;
+		for (const auto &e : entries) {
+			table.slots[hash(e.name, seed)] = &e;
+		}
+		return table;
+	}
+
+	constexpr Table table { build_table() };
+
+	inline Token_Kind lookup(std::string_view name) {
+		if (name.size() < min_length || name.size() > max_length) {
+			return Token_Kind::identifier;
+		}
+		auto got { table.slots[hash(name, seed)] };
+		return got && got->name == name ?
+			got->kind : Token_Kind::identifier;
 	}
+}
+
+namespace Char_Info {
 	inline bool is_digit(int c) {
 		return c >= '0' && c <= '9';
 	}
@@ -57,67 +116,58 @@ namespace Char_Info {
 void Lexer::double_token(
 	Token &tok, Token_Kind with_equals, Token_Kind without_equals
 ) {
-	std::string name; name += ch_;
-	ch_ = in_.get();
-	if (ch_ == '=') {
-		set_token(tok, name + '=', with_equals);
-		ch_ = in_.get();
+	auto begin { cur_++ };
+	if (cur_ < end_ && *cur_ == '=') {
+		++cur_;
+		set_token(tok, begin, with_equals);
 	} else {
-		set_token(tok, name, without_equals);
+		set_token(tok, begin, without_equals);
 	}
 }
 
 void Lexer::eat_comment() {
 	int nesting { 1 };
-	for (;;) {
-		switch (ch_) {
-			case '(':
-				ch_ = in_.get();
-				if (ch_ == '*') { ++nesting; }
-				break;
-			case '*':
-				ch_ = in_.get();
-				if (ch_ == ')') {
-					ch_ = in_.get();
-					if (! --nesting) { return; }
-				}
-				break;
-			case EOF: throw Error { "unclosed comment" };
-			default:
-				ch_ = in_.get();
-		}
-
-	}
+	cur_ = Scan::skip_comment(cur_, end_, line_, nesting);
+	if (nesting) { throw Error { "unclosed comment", line_ }; }
 }
 
 void Lexer::next(Token &tok) {
-	while (Char_Info::is_whitespace(ch_)) {
-		if (ch_ == '\n') { ++line_; }
-		ch_ = in_.get();
+	for (;;) {
+		cur_ = Scan::skip_whitespace(cur_, end_, line_);
+		if (
+			cur_ + 1 < end_ && cur_[0] == '(' && cur_[1] == '*'
+		) {
+			cur_ += 2; eat_comment();
+		} else { break; }
 	}
-	if (ch_ == EOF) { tok.kind_ = Token_Kind::eoi; return; }
-	if (Char_Info::is_letter(ch_)) {
-		std::string name;
-		while (Char_Info::is_letter(ch_) || Char_Info::is_digit(ch_)) {
-			name += ch_; ch_ = in_.get();
-		}
-		auto got { keywords.find(name) };
-		Token_Kind k = got != keywords.end() ?
-			got->second : Token_Kind::identifier;
-		set_token(tok, name, k);
-	} else if (Char_Info::is_digit(ch_)) {
-		std::string name;
-		while (Char_Info::is_digit(ch_)) {
-			name += ch_; ch_ = in_.get();
+	if (cur_ >= end_) {
+		tok.kind_ = Token_Kind::eoi; tok.raw_ = { };
+		tok.line_ = line_; return;
+	}
+	auto begin { cur_ };
+	if (Char_Info::is_letter(*cur_)) {
+		while (cur_ < end_ && (
+			Char_Info::is_letter(*cur_) || Char_Info::is_digit(*cur_)
+		)) { ++cur_; }
+		std::string_view name {
+			begin, static_cast<size_t>(cur_ - begin)
+		};
+		auto k { Keywords::lookup(name) };
+		set_token(tok, begin, k);
+		if (k == Token_Kind::identifier) {
+			tok.symbol_ = Symbol::intern(name);
 		}
-		set_token(tok, name, Token_Kind::integer_literal);
-	} else switch (ch_) {
-		#define CASE(ch, tk) case ch: set_token(tok, ch, tk); \
-			ch_ = in_.get(); break
+	} else if (Char_Info::is_digit(*cur_)) {
+		while (cur_ < end_ && Char_Info::is_digit(*cur_)) { ++cur_; }
+		set_token(tok, begin, Token_Kind::integer_literal);
+	} else switch (*cur_) {
+		#define CASE(ch, tk) case ch: ++cur_; set_token(tok, begin, tk); \
+			break
 		CASE('+', Token_Kind::plus);
 		CASE('-', Token_Kind::minus);
 		CASE('*', Token_Kind::star);
 		CASE('/', Token_Kind::slash);
+		CASE('(', Token_Kind::l_paren);
 		CASE(')', Token_Kind::r_paren);
 		CASE(',', Token_Kind::comma);
 		CASE(';', Token_Kind::semicolon);
@@ -127,14 +177,6 @@ void Lexer::next(Token &tok) {
 		CASE('&', Token_Kind::sym_and);
 		CASE('~', Token_Kind::sym_not);
 		#undef CASE
-		case '(':
-			ch_ = in_.get();
-			if (ch_ == '*') {
-				eat_comment(); next(tok);
-			} else {
-				set_token(tok, '(', Token_Kind::l_paren);
-			}
-			break;
 		case ':':
 	       		double_token(
 				tok, Token_Kind::assign, Token_Kind::colon
@@ -151,18 +193,19 @@ void Lexer::next(Token &tok) {
 			       	Token_Kind::greater
 			);
 			break;
-		default: throw Unknown_Char_Err { static_cast<char>(ch_) };
+		default: throw Unknown_Char_Err { *cur_, line_ };
 	}
 }
 
-int Lexer::line_ { 0 };
-
-void Lexer::set_token(Token &tok, std::string raw, Token_Kind kind) {
-	tok.kind_ = kind;
-	tok.raw_ = raw;
+Token Lexer::peek(int ahead) {
+	Lexer copy { *this };
+	Token tok;
+	for (int i { 0 }; i < ahead; ++i) { copy.next(tok); }
+	return tok;
 }
 
-void Lexer::set_token(Token &tok, char raw, Token_Kind kind) {
-	set_token(tok, std::string { } + raw, kind);
+void Lexer::set_token(Token &tok, const char *begin, Token_Kind kind) {
+	tok.kind_ = kind;
+	tok.raw_ = { begin, static_cast<size_t>(cur_ - begin) };
+	tok.line_ = line_;
 }
-
@@ -1,10 +1,13 @@
 #pragma once
 
+#include "source.h"
+#include "symbol.h"
+
 #include <cassert>
-#include <iostream>
-#include <string>
+#include <string_view>
 
 class Lexer;
+class Token_Table;
 
 enum class Token_Kind {
 	eoi, identifier, comma, colon, assign, semicolon,
@@ -19,11 +22,15 @@ enum class Token_Kind {
 
 class Token {
 		friend class Lexer;
-		Token_Kind kind_;
-		std::string raw_;
+		friend class Token_Table;
+		Token_Kind kind_ { Token_Kind::eoi };
+		std::string_view raw_;
+		Symbol symbol_;
+		int line_ { 0 };
 	
 	public:
 		Token_Kind kind() const { return kind_; }
+		int line() const { return line_; }
 
 		bool is(Token_Kind k) const { return kind_ == k; }
 		bool is_one_of(Token_Kind k1) const { return is(k1); }
@@ -32,12 +39,12 @@ class Token {
 				return is(k1) || is_one_of(ks...);
 			}
 
-		const std::string &raw() const { return raw_; }
-		const std::string &identifier() const {
+		std::string_view raw() const { return raw_; }
+		Symbol identifier() const {
 			assert(is(Token_Kind::identifier));
-			return raw();
+			return symbol_;
 		}
-		const std::string &literal_data() const{
+		std::string_view literal_data() const{
 			assert(is_one_of(
 				Token_Kind::integer_literal,
 				Token_Kind::string_literal
@@ -46,21 +53,35 @@ class Token {
 		}
 };
 
-class Lexer {
-		std::istream &in_;
-		int ch_;
-		static int line_;
+class Token_Source {
 	public:
-		Lexer(std::istream &in): in_ { in }, ch_ { in_.get() } {
-			++line_;
-		}
-		void next(Token &tok);
+		virtual ~Token_Source() { }
+		virtual void next(Token &tok) = 0;
+
+		// token ahead positions behind the last one returned by next
+		virtual Token peek(int ahead) = 0;
+};
 
-		static int current_line() { return line_; };
-		static void reset_current_line() { line_ = 0; };
+class Lexer: public Token_Source {
+		const char *begin_;
+		const char *cur_;
+		const char *end_;
+		int line_ { 1 };
+	public:
+		Lexer(const Source &source):
+			begin_ { source.begin() }, cur_ { source.begin() },
+			end_ { source.end() }
+		{ }
+		void next(Token &tok) override;
+		Token peek(int ahead) override;
+
+		const char *source_begin() const { return begin_; }
+
+		int current_line() const { return line_; };
 	private:
-		void set_token(Token &tok, std::string raw, Token_Kind kind);
-		void set_token(Token &tok, char raw, Token_Kind kind);
+		void set_token(
+			Token &tok, const char *begin, Token_Kind kind
+		);
 		void double_token(
 			Token &tok, Token_Kind with_equals, 
 			Token_Kind without_equals
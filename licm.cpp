@@ -0,0 +1,287 @@
+#include "cfg.h"
+#include "passes.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+// moves the pure computations and loads of a loop that do not depend
+// on the loop out into a block that runs once before it; a WHILE with
+// ELSIF branches is one loop whose bodies all lead back to its first
+// condition
+namespace {
+	const char *const preheader_prefix { "loop_pre_" };
+
+	// blocks of a natural loop: the header and all blocks that reach a
+	// back edge to it without passing through it
+	struct Loop {
+		int header;
+		std::vector<int> blocks;
+		std::vector<bool> contains;
+	};
+
+	std::vector<Loop> find_loops(const Cfg &cfg) {
+		std::unordered_map<int, Loop> by_header;
+		for (int tail { 0 }; tail < cfg.size(); ++tail) {
+			for (auto header : cfg.succs(tail)) {
+				// a header comes before the tails of its back edges
+				if (cfg.rpo_number(header) > cfg.rpo_number(tail)) {
+					continue;
+				}
+				if (! cfg.dominates(header, tail)) { continue; }
+				auto &loop { by_header[header] };
+				if (loop.contains.empty()) {
+					loop.header = header;
+					loop.contains.assign(cfg.size(), false);
+					loop.contains[header] = true;
+					loop.blocks.push_back(header);
+				}
+				std::vector<int> work { tail };
+				while (! work.empty()) {
+					auto b { work.back() };
+					work.pop_back();
+					if (loop.contains[b]) { continue; }
+					loop.contains[b] = true;
+					loop.blocks.push_back(b);
+					for (auto pred : cfg.preds(b)) { work.push_back(pred); }
+				}
+			}
+		}
+		std::vector<Loop> loops;
+		for (auto &[header, loop] : by_header) {
+			loops.push_back(std::move(loop));
+		}
+		// inner loops first, so their invariants can move on outwards
+		std::sort(
+			loops.begin(), loops.end(), [](const Loop &a, const Loop &b) {
+				return a.blocks.size() != b.blocks.size() ?
+					a.blocks.size() < b.blocks.size() : a.header < b.header;
+			}
+		);
+		return loops;
+	}
+
+	class Hoister {
+			Ir_Function &fn_;
+			std::unordered_set<Value::Ptr> locals_;
+			int next_preheader_ { 0 };
+
+			Ir_Block::Ptr make_preheader(
+				Ir_Block::Ptr header, const std::vector<Ir_Block::Ptr> &outside
+			);
+			bool needs_preheader(const Cfg &cfg, const Loop &loop) const;
+			bool is_invariant(
+				const Ir_Instruction *inst, const Loop &loop,
+				const std::unordered_map<Value::Ptr, int> &defined_in,
+				const std::unordered_set<Value::Ptr> &stored, bool clobbered
+			) const;
+			size_t hoist(const Cfg &cfg, const Loop &loop);
+		public:
+			Hoister(Ir_Function &fn);
+			size_t run();
+	};
+}
+
+Hoister::Hoister(Ir_Function &fn): fn_ { fn } {
+	for (auto inst : fn.blocks.front()->instructions) {
+		if (inst->opcode == Opcode::alloca) { locals_.insert(inst->result); }
+	}
+	for (auto block : fn.blocks) {
+		if (block->label().prefix == preheader_prefix) {
+			next_preheader_ = std::max(next_preheader_, block->label().id + 1);
+		}
+	}
+}
+
+// a loop entered from one block that only branches to the header
+// already has a place for its invariants
+bool Hoister::needs_preheader(const Cfg &cfg, const Loop &loop) const {
+	std::vector<int> outside;
+	for (auto pred : cfg.preds(loop.header)) {
+		if (! loop.contains[pred]) { outside.push_back(pred); }
+	}
+	if (outside.size() != 1) { return true; }
+	return cfg.block(outside.front())->terminator()->opcode !=
+		Opcode::branch;
+}
+
+// all entries into the loop go through the new block; phi entries of
+// several outside blocks are joined there
+Ir_Block::Ptr Hoister::make_preheader(
+	Ir_Block::Ptr header, const std::vector<Ir_Block::Ptr> &outside
+) {
+	auto pre { fn_.create_block({ preheader_prefix, next_preheader_++ }) };
+	for (auto inst : header->instructions) {
+		if (inst->opcode != Opcode::phi) { break; }
+		Ir_Instruction *joined { nullptr };
+		std::vector<Value::Ptr> operands;
+		std::vector<Ir_Block *> incoming;
+		for (size_t i { 0 }; i < inst->operands.size(); ++i) {
+			auto from { inst->incoming[i] };
+			if (std::find(outside.begin(), outside.end(), from) ==
+				outside.end()
+			) {
+				operands.push_back(inst->operands[i]);
+				incoming.push_back(from);
+				continue;
+			}
+			if (! joined) {
+				joined = fn_.create(Opcode::phi);
+				joined->result = Reference::create(
+					fn_.arena(), -1, inst->result->type()
+				);
+			}
+			joined->operands.push_back(inst->operands[i]);
+			joined->incoming.push_back(from);
+		}
+		if (! joined) { continue; }
+		auto &values { joined->operands };
+		if (std::all_of(values.begin(), values.end(), [&](Value::Ptr v) {
+			return v == values.front();
+		})) {
+			operands.push_back(values.front());
+		} else {
+			pre->instructions.push_back(joined);
+			operands.push_back(joined->result);
+		}
+		incoming.push_back(pre);
+		inst->operands = std::move(operands);
+		inst->incoming = std::move(incoming);
+	}
+	auto term { fn_.create(Opcode::branch) };
+	term->targets[0] = header;
+	pre->instructions.push_back(term);
+
+	for (auto block : outside) {
+		for (auto &target : block->terminator()->targets) {
+			if (target == header) { target = pre; }
+		}
+	}
+	fn_.blocks.insert(
+		std::find(fn_.blocks.begin(), fn_.blocks.end(), header), pre
+	);
+	return pre;
+}
+
+// operands must come from outside the loop; a load also needs the
+// loop to leave its variable alone, and division may only move when
+// it cannot trap: by 0 it does, by -1 it overflows for the smallest
+// INTEGER
+bool Hoister::is_invariant(
+	const Ir_Instruction *inst, const Loop &loop,
+	const std::unordered_map<Value::Ptr, int> &defined_in,
+	const std::unordered_set<Value::Ptr> &stored, bool clobbered
+) const {
+	switch (inst->opcode) {
+		case Opcode::unary:
+		case Opcode::select:
+			break;
+		case Opcode::binary:
+			if (can_trap(inst->binary_op)) {
+				auto divisor { value_cast<Integer_Literal>(inst->operands[1]) };
+				if (! divisor || divisor->value() <= 0) { return false; }
+			}
+			break;
+		case Opcode::load:
+			if (clobbered || stored.count(inst->operands[0])) {
+				return false;
+			}
+			break;
+		default:
+			return false;
+	}
+	return std::all_of(
+		inst->operands.begin(), inst->operands.end(), [&](Value::Ptr op) {
+			auto got { defined_in.find(op) };
+			return got == defined_in.end() || ! loop.contains[got->second];
+		}
+	);
+}
+
+size_t Hoister::hoist(const Cfg &cfg, const Loop &loop) {
+	std::unordered_map<Value::Ptr, int> defined_in;
+	for (int b { 0 }; b < cfg.size(); ++b) {
+		for (auto inst : cfg.block(b)->instructions) {
+			if (inst->result) { defined_in[inst->result] = b; }
+		}
+	}
+	std::unordered_set<Value::Ptr> stored;
+	bool clobbered { false };
+	for (auto b : loop.blocks) {
+		for (auto inst : cfg.block(b)->instructions) {
+			if (! inst->has_side_effects() || inst->is_terminator()) {
+				continue;
+			}
+			if (inst->opcode == Opcode::store &&
+				locals_.count(inst->operands[1])
+			) {
+				stored.insert(inst->operands[1]);
+			} else {
+				clobbered = true;
+			}
+		}
+	}
+
+	int pre { -1 };
+	for (auto pred : cfg.preds(loop.header)) {
+		if (! loop.contains[pred]) { pre = pred; }
+	}
+	auto &target { cfg.block(pre)->instructions };
+	size_t hoisted { 0 };
+	// in reverse post order every operand is seen before its uses
+	for (auto b : cfg.reverse_post_order()) {
+		if (! loop.contains[b]) { continue; }
+		auto &insts { cfg.block(b)->instructions };
+		auto end { std::remove_if(
+			insts.begin(), insts.end(), [&](Ir_Instruction *inst) {
+				if (! is_invariant(inst, loop, defined_in, stored, clobbered)) {
+					return false;
+				}
+				target.insert(target.end() - 1, inst);
+				defined_in[inst->result] = pre;
+				return true;
+			}
+		) };
+		hoisted += insts.end() - end;
+		insts.erase(end, insts.end());
+	}
+	return hoisted;
+}
+
+size_t Hoister::run() {
+	{
+		Cfg cfg { fn_ };
+		std::vector<std::pair<Ir_Block::Ptr, std::vector<Ir_Block::Ptr>>>
+			entries;
+		for (auto &loop : find_loops(cfg)) {
+			if (loop.header == 0 || ! needs_preheader(cfg, loop)) {
+				continue;
+			}
+			std::vector<Ir_Block::Ptr> outside;
+			for (auto pred : cfg.preds(loop.header)) {
+				if (! loop.contains[pred]) {
+					outside.push_back(cfg.block(pred));
+				}
+			}
+			entries.push_back({ cfg.block(loop.header), std::move(outside) });
+		}
+		for (auto &[header, outside] : entries) {
+			make_preheader(header, outside);
+		}
+	}
+
+	Cfg cfg { fn_ };
+	size_t hoisted { 0 };
+	for (auto &loop : find_loops(cfg)) {
+		if (loop.header != 0 && ! needs_preheader(cfg, loop)) {
+			hoisted += hoist(cfg, loop);
+		}
+	}
+	return hoisted;
+}
+
+void move_invariants(Ir_Function &fn, Pass_Context &context) {
+	remove_unreachable_blocks(fn);
+	if (fn.blocks.empty()) { return; }
+	context.stats.add("licm.hoisted", Hoister { fn }.run());
+}
@@ -0,0 +1,449 @@
+#include "llvm_gen.h"
+
+#include "err.h"
+
+#ifdef TINY_LLVM
+
+#include <llvm/Bitcode/BitcodeWriter.h>
+#include <llvm/IR/IRBuilder.h>
+#include <llvm/IR/LLVMContext.h>
+#include <llvm/IR/LegacyPassManager.h>
+#include <llvm/IR/Module.h>
+#include <llvm/IR/Verifier.h>
+#include <llvm/MC/TargetRegistry.h>
+#include <llvm/Passes/PassBuilder.h>
+#include <llvm/Support/FileSystem.h>
+#include <llvm/Support/Host.h>
+#include <llvm/Support/TargetSelect.h>
+#include <llvm/Support/raw_ostream.h>
+#include <llvm/Target/TargetMachine.h>
+#include <llvm/Target/TargetOptions.h>
+
+#include <mutex>
+#include <unordered_map>
+
+// a phi whose incoming values may be defined further down
+struct Pending_Phi {
+	llvm::PHINode *node;
+	std::vector<std::pair<Value::Ptr, Label>> incoming;
+};
+
+// the function being generated; nested procedures push a new one
+struct Function_State {
+	llvm::Function *function;
+	llvm::BasicBlock *insert;
+	std::unordered_map<std::string, llvm::BasicBlock *> blocks;
+	std::vector<Pending_Phi> phis;
+};
+
+struct LLVM_Gen::State {
+	llvm::LLVMContext context;
+	std::unique_ptr<llvm::Module> module;
+	llvm::IRBuilder<> builder;
+	std::vector<Function_State> functions;
+	std::unordered_map<Reference::Ptr, llvm::Value *> values;
+	std::string path;
+	Emit emit;
+	int opt_level;
+
+	State(const std::string &name, std::string path, Emit emit, int opt):
+		module { std::make_unique<llvm::Module>(name, context) },
+		builder { context }, path { std::move(path) }, emit { emit },
+		opt_level { opt }
+	{ }
+
+	llvm::Type *type(Type::Ptr ty);
+	llvm::Value *value(Value::Ptr value);
+	llvm::BasicBlock *block(const Label &label);
+	void optimize();
+	void write_bitcode();
+	void write_object();
+};
+
+llvm::Type *LLVM_Gen::State::type(Type::Ptr ty) {
+	if (! ty) {
+		return builder.getVoidTy();
+	} else if (ty == integer_type) {
+		return builder.getInt32Ty();
+	} else if (ty == real_type) {
+		return builder.getDoubleTy();
+	} else if (ty == boolean_type) {
+		return builder.getInt1Ty();
+	}
+	throw Error { "no low level type for '" + ty->name() + "'" };
+}
+
+llvm::Value *LLVM_Gen::State::value(Value::Ptr value) {
+	switch (value->kind()) {
+		case Value_Kind::int_literal:
+			return builder.getInt32(
+				value_cast<Integer_Literal>(value)->value()
+			);
+		case Value_Kind::real_literal:
+			return llvm::ConstantFP::get(
+				builder.getDoubleTy(),
+				value_cast<Real_Literal>(value)->value()
+			);
+		case Value_Kind::bool_literal:
+			return builder.getInt1(
+				value_cast<Bool_Literal>(value)->value()
+			);
+		case Value_Kind::reference: break;
+	}
+	auto got { values.find(static_cast<Reference *>(value)) };
+	if (got == values.end()) {
+		throw Error { "undefined value " + value->name() };
+	}
+	return got->second;
+}
+
+llvm::BasicBlock *LLVM_Gen::State::block(const Label &label) {
+	auto name { label_name(label) };
+	auto &fn { functions.back() };
+	auto &got { fn.blocks[name] };
+	if (! got) {
+		got = llvm::BasicBlock::Create(context, name, fn.function);
+	}
+	return got;
+}
+
+void LLVM_Gen::State::optimize() {
+	if (opt_level <= 0) { return; }
+	llvm::LoopAnalysisManager lam;
+	llvm::FunctionAnalysisManager fam;
+	llvm::CGSCCAnalysisManager cgam;
+	llvm::ModuleAnalysisManager mam;
+	llvm::PassBuilder builder;
+	builder.registerModuleAnalyses(mam);
+	builder.registerCGSCCAnalyses(cgam);
+	builder.registerFunctionAnalyses(fam);
+	builder.registerLoopAnalyses(lam);
+	builder.crossRegisterProxies(lam, fam, cgam, mam);
+	auto level { opt_level == 1 ?
+		llvm::OptimizationLevel::O1 : llvm::OptimizationLevel::O2
+	};
+	builder.buildPerModuleDefaultPipeline(level).run(*module, mam);
+}
+
+void LLVM_Gen::State::write_bitcode() {
+	std::error_code ec;
+	llvm::raw_fd_ostream out { path, ec, llvm::sys::fs::OF_None };
+	if (ec) { throw Error { "cannot open " + path + " for writing" }; }
+	llvm::WriteBitcodeToFile(*module, out);
+}
+
+void LLVM_Gen::State::write_object() {
+	static std::once_flag initialized;
+	std::call_once(initialized, [] {
+		llvm::InitializeNativeTarget();
+		llvm::InitializeNativeTargetAsmPrinter();
+	});
+	auto triple { llvm::sys::getDefaultTargetTriple() };
+	std::string message;
+	auto target { llvm::TargetRegistry::lookupTarget(triple, message) };
+	if (! target) { throw Error { message }; }
+	std::unique_ptr<llvm::TargetMachine> machine {
+		target->createTargetMachine(
+			triple, "generic", "", llvm::TargetOptions { },
+			llvm::Reloc::PIC_
+		)
+	};
+	module->setTargetTriple(triple);
+	module->setDataLayout(machine->createDataLayout());
+	optimize();
+
+	std::error_code ec;
+	llvm::raw_fd_ostream out { path, ec, llvm::sys::fs::OF_None };
+	if (ec) { throw Error { "cannot open " + path + " for writing" }; }
+	llvm::legacy::PassManager passes;
+	if (machine->addPassesToEmitFile(
+		passes, out, nullptr, llvm::CGFT_ObjectFile
+	)) {
+		throw Error { "target cannot emit object files" };
+	}
+	passes.run(*module);
+	out.flush();
+}
+
+LLVM_Gen::LLVM_Gen(
+	const std::string &module_name, std::string path, Emit emit,
+	int opt_level
+):
+	state_ { std::make_unique<State>(
+		module_name, std::move(path), emit, opt_level
+	) }
+{ }
+
+LLVM_Gen::~LLVM_Gen() { }
+
+bool LLVM_Gen::available() { return true; }
+
+void LLVM_Gen::define(
+	std::string_view name, Type::Ptr returns,
+	const std::vector<Parameter> &params, bool inline_hint
+) {
+	auto &s { *state_ };
+	if (! s.functions.empty()) {
+		s.functions.back().insert = s.builder.GetInsertBlock();
+	}
+	std::vector<llvm::Type *> types;
+	for (const auto &param : params) {
+		auto ty { s.type(param.ref->type()) };
+		types.push_back(param.by_reference ? ty->getPointerTo() : ty);
+	}
+	auto function { llvm::Function::Create(
+		llvm::FunctionType::get(s.type(returns), types, false),
+		llvm::Function::ExternalLinkage, llvm::StringRef {
+			name.data(), name.size()
+		}, *s.module
+	) };
+	if (inline_hint) { function->addFnAttr(llvm::Attribute::InlineHint); }
+	auto arg { function->arg_begin() };
+	for (const auto &param : params) { s.values[param.ref] = arg++; }
+	s.functions.push_back({ function, nullptr, { } });
+}
+
+void LLVM_Gen::end_define() {
+	auto &s { *state_ };
+	for (auto &phi : s.functions.back().phis) {
+		for (const auto &[value, label] : phi.incoming) {
+			phi.node->addIncoming(s.value(value), s.block(label));
+		}
+	}
+	s.functions.pop_back();
+	if (! s.functions.empty()) {
+		s.builder.SetInsertPoint(s.functions.back().insert);
+	} else {
+		s.builder.ClearInsertionPoint();
+	}
+}
+
+void LLVM_Gen::def_label(const Label &label) {
+	state_->builder.SetInsertPoint(state_->block(label));
+}
+
+void LLVM_Gen::branch(const Label &label) {
+	state_->builder.CreateBr(state_->block(label));
+}
+
+void LLVM_Gen::conditional(
+	Value::Ptr value, const Label &true_label, const Label &false_label
+) {
+	auto &s { *state_ };
+	s.builder.CreateCondBr(
+		s.value(value), s.block(true_label), s.block(false_label)
+	);
+}
+
+void LLVM_Gen::ret() {
+	state_->builder.CreateRetVoid();
+}
+
+void LLVM_Gen::ret(Value::Ptr value) {
+	state_->builder.CreateRet(state_->value(value));
+}
+
+void LLVM_Gen::alloca(Reference::Ptr ref) {
+	auto &s { *state_ };
+	auto ty { s.type(ref->type()) };
+	if (s.functions.empty()) {
+		// module variables become zero initialized globals
+		s.values[ref] = new llvm::GlobalVariable(
+			*s.module, ty, false, llvm::GlobalValue::InternalLinkage,
+			llvm::Constant::getNullValue(ty)
+		);
+		return;
+	}
+	auto entry { s.block({ "entry" }) };
+	llvm::IRBuilder<> at_entry { entry, entry->begin() };
+	s.values[ref] = at_entry.CreateAlloca(ty);
+}
+
+void LLVM_Gen::load(Reference::Ptr result, Reference::Ptr ptr) {
+	auto &s { *state_ };
+	s.values[result] = s.builder.CreateLoad(
+		s.type(result->type()), s.value(ptr)
+	);
+}
+
+void LLVM_Gen::store(Value::Ptr value, Reference::Ptr ptr) {
+	auto &s { *state_ };
+	s.builder.CreateStore(s.value(value), s.value(ptr));
+}
+
+void LLVM_Gen::unary(Reference::Ptr result, Unary_Op op, Value::Ptr value) {
+	auto &s { *state_ };
+	auto v { s.value(value) };
+	if (op == Unary_Op::log_not) {
+		s.values[result] = s.builder.CreateNot(v);
+	} else if (value->type() == real_type) {
+		s.values[result] = s.builder.CreateFNeg(v);
+	} else {
+		s.values[result] = s.builder.CreateNeg(v);
+	}
+}
+
+void LLVM_Gen::binary(
+	Reference::Ptr result, Binary_Op op, Value::Ptr left, Value::Ptr right
+) {
+	auto &s { *state_ };
+	auto &b { s.builder };
+	auto l { s.value(left) };
+	auto r { s.value(right) };
+	llvm::Value *v { nullptr };
+	if (left->type() == real_type) {
+		switch (op) {
+			case Binary_Op::add: v = b.CreateFAdd(l, r); break;
+			case Binary_Op::sub: v = b.CreateFSub(l, r); break;
+			case Binary_Op::mul: v = b.CreateFMul(l, r); break;
+			case Binary_Op::equal: v = b.CreateFCmpOEQ(l, r); break;
+			case Binary_Op::not_equal: v = b.CreateFCmpONE(l, r); break;
+			case Binary_Op::less: v = b.CreateFCmpOLT(l, r); break;
+			case Binary_Op::less_equal: v = b.CreateFCmpOLE(l, r); break;
+			case Binary_Op::greater: v = b.CreateFCmpOGT(l, r); break;
+			case Binary_Op::greater_equal:
+				v = b.CreateFCmpOGE(l, r); break;
+			default: break;
+		}
+	} else {
+		switch (op) {
+			case Binary_Op::add: v = b.CreateAdd(l, r); break;
+			case Binary_Op::sub: v = b.CreateSub(l, r); break;
+			case Binary_Op::mul: v = b.CreateMul(l, r); break;
+			case Binary_Op::quot: v = b.CreateSDiv(l, r); break;
+			case Binary_Op::rem: v = b.CreateSRem(l, r); break;
+			case Binary_Op::shl: v = b.CreateShl(l, r); break;
+			case Binary_Op::ashr: v = b.CreateAShr(l, r); break;
+			case Binary_Op::lshr: v = b.CreateLShr(l, r); break;
+			case Binary_Op::bit_and: v = b.CreateAnd(l, r); break;
+			case Binary_Op::bit_or: v = b.CreateOr(l, r); break;
+			case Binary_Op::bit_xor: v = b.CreateXor(l, r); break;
+			case Binary_Op::mul_high: {
+				auto wide { b.getInt64Ty() };
+				auto product { b.CreateMul(
+					b.CreateSExt(l, wide), b.CreateSExt(r, wide)
+				) };
+				v = b.CreateTrunc(
+					b.CreateAShr(product, 32), b.getInt32Ty()
+				);
+				break;
+			}
+			case Binary_Op::equal: v = b.CreateICmpEQ(l, r); break;
+			case Binary_Op::not_equal: v = b.CreateICmpNE(l, r); break;
+			case Binary_Op::less: v = b.CreateICmpSLT(l, r); break;
+			case Binary_Op::less_equal: v = b.CreateICmpSLE(l, r); break;
+			case Binary_Op::greater: v = b.CreateICmpSGT(l, r); break;
+			case Binary_Op::greater_equal:
+				v = b.CreateICmpSGE(l, r); break;
+			case Binary_Op::log_and: v = b.CreateAnd(l, r); break;
+			case Binary_Op::log_or: v = b.CreateOr(l, r); break;
+			default: break;
+		}
+	}
+	if (! v) {
+		throw Error {
+			std::string { "no instruction for " } +
+			binary_operator(op).name
+		};
+	}
+	s.values[result] = v;
+}
+
+void LLVM_Gen::phi(
+	Reference::Ptr result,
+	const std::vector<std::pair<Value::Ptr, Label>> &incoming
+) {
+	auto &s { *state_ };
+	auto node { s.builder.CreatePHI(
+		s.type(result->type()), incoming.size()
+	) };
+	s.values[result] = node;
+	s.functions.back().phis.push_back({ node, incoming });
+}
+
+void LLVM_Gen::select(
+	Reference::Ptr result, Value::Ptr condition,
+	Value::Ptr if_true, Value::Ptr if_false
+) {
+	auto &s { *state_ };
+	s.values[result] = s.builder.CreateSelect(
+		s.value(condition), s.value(if_true), s.value(if_false)
+	);
+}
+
+// callees are defined before their callers, except for recursion
+void LLVM_Gen::call(
+	Reference::Ptr result, std::string_view name,
+	const std::vector<Argument> &args
+) {
+	auto &s { *state_ };
+	std::vector<llvm::Type *> types;
+	std::vector<llvm::Value *> values;
+	for (const auto &arg : args) {
+		auto ty { s.type(arg.value->type()) };
+		types.push_back(arg.by_reference ? ty->getPointerTo() : ty);
+		values.push_back(s.value(arg.value));
+	}
+	auto callee { s.module->getOrInsertFunction(
+		llvm::StringRef { name.data(), name.size() },
+		llvm::FunctionType::get(
+			s.type(result ? result->type() : nullptr), types, false
+		)
+	) };
+	auto value { s.builder.CreateCall(callee, values) };
+	if (result) { s.values[result] = value; }
+}
+
+void LLVM_Gen::finish() {
+	auto &s { *state_ };
+	std::string message;
+	llvm::raw_string_ostream report { message };
+	if (llvm::verifyModule(*s.module, &report)) {
+		throw Error { "invalid module: " + report.str() };
+	}
+	if (s.emit == Emit::object) {
+		s.write_object();
+	} else {
+		s.optimize();
+		s.write_bitcode();
+	}
+}
+
+#else
+
+// builds without LLVM only know the text backend
+
+struct LLVM_Gen::State { };
+
+LLVM_Gen::LLVM_Gen(const std::string &, std::string, Emit, int) {
+	throw Error { "tiny was built without LLVM support" };
+}
+
+LLVM_Gen::~LLVM_Gen() { }
+
+bool LLVM_Gen::available() { return false; }
+
+void LLVM_Gen::define(
+	std::string_view, Type::Ptr, const std::vector<Parameter> &, bool
+) { }
+void LLVM_Gen::end_define() { }
+void LLVM_Gen::def_label(const Label &) { }
+void LLVM_Gen::branch(const Label &) { }
+void LLVM_Gen::conditional(Value::Ptr, const Label &, const Label &) { }
+void LLVM_Gen::ret() { }
+void LLVM_Gen::ret(Value::Ptr) { }
+void LLVM_Gen::alloca(Reference::Ptr) { }
+void LLVM_Gen::load(Reference::Ptr, Reference::Ptr) { }
+void LLVM_Gen::store(Value::Ptr, Reference::Ptr) { }
+void LLVM_Gen::unary(Reference::Ptr, Unary_Op, Value::Ptr) { }
+void LLVM_Gen::binary(Reference::Ptr, Binary_Op, Value::Ptr, Value::Ptr) { }
+void LLVM_Gen::phi(
+	Reference::Ptr, const std::vector<std::pair<Value::Ptr, Label>> &
+) { }
+void LLVM_Gen::select(Reference::Ptr, Value::Ptr, Value::Ptr, Value::Ptr) { }
+void LLVM_Gen::call(
+	Reference::Ptr, std::string_view, const std::vector<Argument> &
+) { }
+void LLVM_Gen::finish() { }
+
+#endif
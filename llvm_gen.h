@@ -0,0 +1,62 @@
+#pragma once
+
+#include "gen.h"
+
+#include <memory>
+#include <string>
+
+// native objects come from the built-in x86-64 backend
+enum class Emit { text, bitcode, object, native };
+
+// builds the module in memory through the LLVM C++ API and writes
+// bitcode or a native object file in finish(); only usable in builds
+// configured with TINY_LLVM
+class LLVM_Gen: public Gen {
+		struct State;
+		std::unique_ptr<State> state_;
+	public:
+		LLVM_Gen(
+			const std::string &module_name, std::string path, Emit emit,
+			int opt_level
+		);
+		~LLVM_Gen();
+
+		static bool available();
+
+		void define(
+			std::string_view name, Type::Ptr returns,
+			const std::vector<Parameter> &params, bool inline_hint
+		) override;
+		void end_define() override;
+		void def_label(const Label &label) override;
+		void branch(const Label &label) override;
+		void conditional(
+			Value::Ptr value, const Label &true_label,
+			const Label &false_label
+		) override;
+		void ret() override;
+		void ret(Value::Ptr value) override;
+		void alloca(Reference::Ptr ref) override;
+		void load(Reference::Ptr result, Reference::Ptr ptr) override;
+		void store(Value::Ptr value, Reference::Ptr ptr) override;
+		void unary(
+			Reference::Ptr result, Unary_Op op, Value::Ptr value
+		) override;
+		void binary(
+			Reference::Ptr result, Binary_Op op,
+			Value::Ptr left, Value::Ptr right
+		) override;
+		void phi(
+			Reference::Ptr result,
+			const std::vector<std::pair<Value::Ptr, Label>> &incoming
+		) override;
+		void select(
+			Reference::Ptr result, Value::Ptr condition,
+			Value::Ptr if_true, Value::Ptr if_false
+		) override;
+		void call(
+			Reference::Ptr result, std::string_view name,
+			const std::vector<Argument> &args
+		) override;
+		void finish() override;
+};
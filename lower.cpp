@@ -0,0 +1,219 @@
+#include "passes.h"
+
+#include <cstdint>
+#include <unordered_map>
+
+// Oberon's DIV and MOD round towards negative infinity, the machine
+// divides truncating; constant operands get cheaper sequences
+namespace {
+	struct Magic {
+		int multiplier;
+		int shift;
+	};
+
+	// signed magic number for 2 <= d (Hacker's Delight, 10-1)
+	Magic magic(int d) {
+		constexpr std::uint32_t two31 { 0x80000000u };
+		std::uint32_t ad = d;
+		std::uint32_t anc = two31 - 1 - two31 % ad;
+		int p { 31 };
+		std::uint32_t q1 = two31 / anc, r1 = two31 - q1 * anc;
+		std::uint32_t q2 = two31 / ad, r2 = two31 - q2 * ad;
+		std::uint32_t delta;
+		do {
+			++p;
+			q1 *= 2; r1 *= 2;
+			if (r1 >= anc) { ++q1; r1 -= anc; }
+			q2 *= 2; r2 *= 2;
+			if (r2 >= ad) { ++q2; r2 -= ad; }
+			delta = ad - r2;
+		} while (q1 < delta || (q1 == delta && r1 == 0));
+		return { static_cast<int>(q2 + 1), p - 32 };
+	}
+
+	int log2_exact(int value) {
+		if (value <= 0 || (value & (value - 1))) { return -1; }
+		int k { 0 };
+		while ((1 << k) != value) { ++k; }
+		return k;
+	}
+
+	class Lowering {
+			Ir_Function &fn_;
+			Constant_Pool &pool_;
+			std::vector<Ir_Instruction *> out_;
+			std::unordered_map<Value::Ptr, Value::Ptr> replaced_;
+
+			Value::Ptr emit(Binary_Op op, Value::Ptr left, Value::Ptr right);
+			Value::Ptr select(
+				Value::Ptr condition, Value::Ptr if_true,
+				Value::Ptr if_false
+			);
+			Value::Ptr constant(int value) { return pool_.get(value); }
+
+			Value::Ptr multiply(Value::Ptr x, int c);
+			Value::Ptr divide_by_constant(Value::Ptr x, int d);
+			Value::Ptr floor_divide(
+				Value::Ptr x, Value::Ptr y, bool want_quotient
+			);
+			Value::Ptr lower(Ir_Instruction *inst);
+		public:
+			Lowering(Ir_Function &fn, Constant_Pool &pool):
+				fn_ { fn }, pool_ { pool }
+			{ }
+			void run();
+	};
+}
+
+// literal operands are folded right away
+Value::Ptr Lowering::emit(
+	Binary_Op op, Value::Ptr left, Value::Ptr right
+) {
+	if (auto folded { fold(pool_, op, left, right) }) { return folded; }
+	auto inst { fn_.create(Opcode::binary) };
+	inst->binary_op = op;
+	inst->operands = { left, right };
+	inst->result = Reference::create(
+		fn_.arena(), -1,
+		binary_operator(op).predicate ? boolean_type : left->type()
+	);
+	out_.push_back(inst);
+	return inst->result;
+}
+
+Value::Ptr Lowering::select(
+	Value::Ptr condition, Value::Ptr if_true, Value::Ptr if_false
+) {
+	auto inst { fn_.create(Opcode::select) };
+	inst->operands = { condition, if_true, if_false };
+	inst->result = Reference::create(fn_.arena(), -1, if_true->type());
+	out_.push_back(inst);
+	return inst->result;
+}
+
+// constants with at most two set bits in c or c + 1 become shifts
+Value::Ptr Lowering::multiply(Value::Ptr x, int c) {
+	if (c < 0 && c != INT32_MIN) {
+		return emit(Binary_Op::sub, constant(0), multiply(x, -c));
+	}
+	auto uc { static_cast<std::uint32_t>(c) };
+	auto shifted { [&](int k) {
+		return emit(Binary_Op::shl, x, constant(k));
+	} };
+	if (uc && ! (uc & (uc - 1))) {
+		return shifted(__builtin_ctz(uc));
+	}
+	if (__builtin_popcount(uc) == 2) {
+		auto low { __builtin_ctz(uc) };
+		auto high { 31 - __builtin_clz(uc) };
+		return emit(Binary_Op::add, shifted(high), shifted(low));
+	}
+	auto above { uc + 1 };
+	if (above && ! (above & (above - 1))) {
+		return emit(Binary_Op::sub, shifted(__builtin_ctz(above)), x);
+	}
+	return emit(Binary_Op::mul, x, constant(c));
+}
+
+// x DIV d for 1 < d: floor(x / d) is ~(~x / d) for negative x, so
+// the complement of negative values is divided with a magic number
+Value::Ptr Lowering::divide_by_constant(Value::Ptr x, int d) {
+	auto k { log2_exact(d) };
+	if (k >= 0) { return emit(Binary_Op::ashr, x, constant(k)); }
+	auto sign { emit(Binary_Op::ashr, x, constant(31)) };
+	auto positive { emit(Binary_Op::bit_xor, x, sign) };
+	auto [multiplier, shift] { magic(d) };
+	auto q { emit(Binary_Op::mul_high, positive, constant(multiplier)) };
+	if (multiplier < 0) { q = emit(Binary_Op::add, q, positive); }
+	q = emit(Binary_Op::ashr, q, constant(shift));
+	return emit(Binary_Op::bit_xor, q, sign);
+}
+
+// truncating division corrected by one where the remainder and the
+// divisor differ in sign
+Value::Ptr Lowering::floor_divide(
+	Value::Ptr x, Value::Ptr y, bool want_quotient
+) {
+	auto r { emit(Binary_Op::rem, x, y) };
+	auto signs { emit(Binary_Op::bit_xor, r, y) };
+	auto adjust { emit(
+		Binary_Op::log_and,
+		emit(Binary_Op::not_equal, r, constant(0)),
+		emit(Binary_Op::less, signs, constant(0))
+	) };
+	if (want_quotient) {
+		auto q { emit(Binary_Op::quot, x, y) };
+		return emit(
+			Binary_Op::sub, q, select(adjust, constant(1), constant(0))
+		);
+	}
+	return emit(Binary_Op::add, r, select(adjust, y, constant(0)));
+}
+
+Value::Ptr Lowering::lower(Ir_Instruction *inst) {
+	if (inst->opcode != Opcode::binary) { return nullptr; }
+	auto &ops { inst->operands };
+	if (ops[0]->type() != integer_type) { return nullptr; }
+	auto divisor { value_cast<Integer_Literal>(ops[1]) };
+	auto d { divisor ? divisor->value() : 0 };
+	switch (inst->binary_op) {
+		case Binary_Op::mul: {
+			if (auto c { value_cast<Integer_Literal>(ops[0]) }) {
+				return multiply(ops[1], c->value());
+			}
+			return divisor ? multiply(ops[0], d) : nullptr;
+		}
+		case Binary_Op::int_div:
+			if (d == 1) { return ops[0]; }
+			// wraps for the smallest INTEGER, as folding does
+			if (d == -1) {
+				return emit(Binary_Op::sub, constant(0), ops[0]);
+			}
+			if (d > 1) { return divide_by_constant(ops[0], d); }
+			return floor_divide(ops[0], ops[1], true);
+		case Binary_Op::mod: {
+			if (d == 1 || d == -1) { return constant(0); }
+			auto k { log2_exact(d) };
+			if (k > 0) {
+				return emit(Binary_Op::bit_and, ops[0], constant(d - 1));
+			}
+			if (d > 1) {
+				auto q { divide_by_constant(ops[0], d) };
+				return emit(Binary_Op::sub, ops[0], multiply(q, d));
+			}
+			return floor_divide(ops[0], ops[1], false);
+		}
+		default:
+			return nullptr;
+	}
+}
+
+void Lowering::run() {
+	for (auto block : fn_.blocks) {
+		out_.clear();
+		for (auto inst : block->instructions) {
+			if (auto value { lower(inst) }) {
+				replaced_[inst->result] = value;
+			} else {
+				out_.push_back(inst);
+			}
+		}
+		block->instructions.swap(out_);
+	}
+	if (replaced_.empty()) { return; }
+	for (auto block : fn_.blocks) {
+		for (auto inst : block->instructions) {
+			for (auto &op : inst->operands) {
+				for (;;) {
+					auto got { replaced_.find(op) };
+					if (got == replaced_.end()) { break; }
+					op = got->second;
+				}
+			}
+		}
+	}
+}
+
+void lower_arithmetic(Ir_Function &fn, Pass_Context &context) {
+	Lowering { fn, context.pool }.run();
+}
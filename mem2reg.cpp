@@ -0,0 +1,251 @@
+#include "cfg.h"
+#include "passes.h"
+
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+// SSA construction after Cytron et al.: phis are placed on the
+// iterated dominance frontiers of the stores, then loads are renamed
+// walking the dominator tree
+namespace {
+	class Promoter {
+			Ir_Function &fn_;
+			Constant_Pool &pool_;
+			Cfg cfg_;
+			std::unordered_map<Reference::Ptr, int> vars_;
+			std::vector<Reference::Ptr> allocas_;
+			std::vector<std::vector<Value::Ptr>> stacks_;
+			std::unordered_map<Ir_Instruction *, int> phis_;
+			std::unordered_map<Value::Ptr, Value::Ptr> replaced_;
+
+			// -1 for literals and references that are no promoted alloca
+			int var(Value::Ptr ptr) const {
+				auto ref { value_cast<Reference>(ptr) };
+				if (! ref) { return -1; }
+				auto got { vars_.find(ref) };
+				return got == vars_.end() ? -1 : got->second;
+			}
+			Value::Ptr current(int v);
+			Value::Ptr resolve(Value::Ptr value) const;
+
+			void find_promotable();
+			void place_phis();
+			void rename_block(int block, std::vector<int> &pushed);
+			void rename();
+			void remove_trivial_phis();
+			void clean_up();
+		public:
+			Promoter(Ir_Function &fn, Constant_Pool &pool):
+				fn_ { fn }, pool_ { pool }, cfg_ { fn }
+			{ }
+			void run();
+			size_t promoted() const { return vars_.size(); }
+	};
+}
+
+// a variable read before any store reads zero
+Value::Ptr Promoter::current(int v) {
+	if (! stacks_[v].empty()) { return stacks_[v].back(); }
+	return pool_.number(allocas_[v]->type(), 0);
+}
+
+Value::Ptr Promoter::resolve(Value::Ptr value) const {
+	for (;;) {
+		auto got { replaced_.find(value) };
+		if (got == replaced_.end()) { return value; }
+		value = got->second;
+	}
+}
+
+// only allocas that are used as address of loads and stores
+void Promoter::find_promotable() {
+	for (auto inst : fn_.blocks.front()->instructions) {
+		if (inst->opcode == Opcode::alloca) {
+			vars_[inst->result] = allocas_.size();
+			allocas_.push_back(inst->result);
+		}
+	}
+	std::unordered_set<Reference::Ptr> escaping;
+	for (auto block : fn_.blocks) {
+		for (auto inst : block->instructions) {
+			auto &ops { inst->operands };
+			for (size_t i { 0 }; i < ops.size(); ++i) {
+				if (var(ops[i]) < 0) { continue; }
+				bool address {
+					(inst->opcode == Opcode::load && i == 0) ||
+					(inst->opcode == Opcode::store && i == 1)
+				};
+				if (! address) {
+					escaping.insert(static_cast<Reference *>(ops[i]));
+				}
+			}
+		}
+	}
+	for (auto ref : escaping) { vars_.erase(ref); }
+	stacks_.resize(allocas_.size());
+}
+
+void Promoter::place_phis() {
+	auto frontiers { cfg_.frontiers() };
+	std::vector<std::vector<int>> defs(allocas_.size());
+	for (int b { 0 }; b < cfg_.size(); ++b) {
+		for (auto inst : cfg_.block(b)->instructions) {
+			if (inst->opcode != Opcode::store) { continue; }
+			auto v { var(inst->operands[1]) };
+			if (v >= 0 && (defs[v].empty() || defs[v].back() != b)) {
+				defs[v].push_back(b);
+			}
+		}
+	}
+	// in the order of the allocas, so the phis do not depend on where
+	// the variables were allocated
+	for (int v { 0 }; v < static_cast<int>(allocas_.size()); ++v) {
+		auto ref { allocas_[v] };
+		if (var(ref) != v) { continue; }
+		std::vector<bool> has_phi(cfg_.size());
+		auto work { defs[v] };
+		while (! work.empty()) {
+			auto b { work.back() };
+			work.pop_back();
+			for (auto d : frontiers[b]) {
+				if (has_phi[d]) { continue; }
+				has_phi[d] = true;
+				auto phi { fn_.create(Opcode::phi) };
+				phi->result = Reference::create(
+					fn_.arena(), -1, ref->type()
+				);
+				auto &insts { cfg_.block(d)->instructions };
+				insts.insert(insts.begin(), phi);
+				phis_[phi] = v;
+				work.push_back(d);
+			}
+		}
+	}
+}
+
+// pushes the values the block stores and gives the phis of its
+// successors their operand from it; pushed logs the variables
+void Promoter::rename_block(int b, std::vector<int> &pushed) {
+	for (auto inst : cfg_.block(b)->instructions) {
+		if (inst->opcode == Opcode::phi) {
+			auto got { phis_.find(inst) };
+			if (got != phis_.end()) {
+				stacks_[got->second].push_back(inst->result);
+				pushed.push_back(got->second);
+			}
+		} else if (inst->opcode == Opcode::load) {
+			auto v { var(inst->operands[0]) };
+			if (v >= 0) { replaced_[inst->result] = current(v); }
+		} else if (inst->opcode == Opcode::store) {
+			auto v { var(inst->operands[1]) };
+			if (v >= 0) {
+				stacks_[v].push_back(inst->operands[0]);
+				pushed.push_back(v);
+			}
+		}
+	}
+	auto block { cfg_.block(b) };
+	for (auto s : cfg_.succs(b)) {
+		for (auto inst : cfg_.block(s)->instructions) {
+			if (inst->opcode != Opcode::phi) { break; }
+			auto got { phis_.find(inst) };
+			if (got == phis_.end()) { continue; }
+			inst->operands.push_back(current(got->second));
+			inst->incoming.push_back(block);
+		}
+	}
+}
+
+// preorder walk of the dominator tree on an explicit stack, as it may
+// be as deep as the procedure is long; leaving a block pops what it
+// pushed by unwinding the log to the size it had on entry
+void Promoter::rename() {
+	constexpr auto entering { static_cast<size_t>(-1) };
+	struct Step {
+		int block;
+		size_t unwind;
+	};
+	std::vector<int> pushed;
+	std::vector<Step> work { { 0, entering } };
+	while (! work.empty()) {
+		auto step { work.back() };
+		work.pop_back();
+		if (step.unwind != entering) {
+			for (; pushed.size() > step.unwind; pushed.pop_back()) {
+				stacks_[pushed.back()].pop_back();
+			}
+			continue;
+		}
+		work.push_back({ step.block, pushed.size() });
+		rename_block(step.block, pushed);
+		auto &children { cfg_.children(step.block) };
+		for (auto c { children.rbegin() }; c != children.rend(); ++c) {
+			work.push_back({ *c, entering });
+		}
+	}
+}
+
+// a phi that merges only one value besides itself is that value
+void Promoter::remove_trivial_phis() {
+	for (bool changed { true }; changed; ) {
+		changed = false;
+		for (auto &[phi, v] : phis_) {
+			if (replaced_.count(phi->result)) { continue; }
+			Value::Ptr same { nullptr };
+			bool trivial { true };
+			for (auto op : phi->operands) {
+				op = resolve(op);
+				if (op == phi->result || op == same) { continue; }
+				if (same) { trivial = false; break; }
+				same = op;
+			}
+			if (trivial && same) {
+				replaced_[phi->result] = same;
+				changed = true;
+			}
+		}
+	}
+}
+
+void Promoter::clean_up() {
+	for (auto block : fn_.blocks) {
+		auto &insts { block->instructions };
+		insts.erase(std::remove_if(
+			insts.begin(), insts.end(), [&](Ir_Instruction *inst) {
+				switch (inst->opcode) {
+					case Opcode::alloca:
+						return var(inst->result) >= 0;
+					case Opcode::load:
+						return var(inst->operands[0]) >= 0;
+					case Opcode::store:
+						return var(inst->operands[1]) >= 0;
+					case Opcode::phi:
+						return replaced_.count(inst->result) > 0;
+					default:
+						return false;
+				}
+			}
+		), insts.end());
+		for (auto inst : insts) {
+			for (auto &op : inst->operands) { op = resolve(op); }
+		}
+	}
+}
+
+void Promoter::run() {
+	find_promotable();
+	if (vars_.empty()) { return; }
+	place_phis();
+	rename();
+	remove_trivial_phis();
+	clean_up();
+}
+
+void promote_memory_to_registers(Ir_Function &fn, Pass_Context &context) {
+	remove_unreachable_blocks(fn);
+	if (fn.blocks.empty()) { return; }
+	Promoter promoter { fn, context.pool };
+	promoter.run();
+	context.stats.add("mem2reg.promoted", promoter.promoted());
+}
@@ -3,55 +3,58 @@
 #include "value.h"
 
 #include <string>
-#include <memory>
 #include <vector>
 
 class Scoping_Declaration: public Declaration {
 	public:
-		using Ptr = std::shared_ptr<Scoping_Declaration>;
+		using Ptr = Scoping_Declaration *;
 	private:
 		Scoping_Declaration::Ptr parent_;
+		mutable std::string prefix_;
+		const std::string &prefix() const;
 	protected:
 		Scoping_Declaration(
-			std::string name, Scoping_Declaration::Ptr parent
+			Symbol name, Scoping_Declaration::Ptr parent
 		):
 			Declaration { name }, parent_ { parent }
 		{ }
 	public:
 		auto parent() const { return parent_; }
-		std::string mangle(std::string name) const;
+		std::string mangle(Symbol name) const;
 };
 
 class Module: public Scoping_Declaration {
-		Module(std::string name): Scoping_Declaration(name, nullptr) { }
+		friend class Arena;
+		Module(Symbol name): Scoping_Declaration(name, nullptr) { }
 	public:
-		using Ptr = std::shared_ptr<Module>;
-		static auto create(std::string name) {
-			return Ptr { new Module { name } };
+		using Ptr = Module *;
+		static auto create(Arena &arena, Symbol name) {
+			return arena.create<Module>(name);
 		}
 };
 
 class Variable: public Declaration {
+		friend class Arena;
 		Reference::Ptr ref_;
 		bool is_var_;
 		bool with_load_;
 
 		Variable(
-			std::string name, Reference::Ptr ref,
+			Symbol name, Reference::Ptr ref,
 			bool is_var, bool with_load
 		):
 			Declaration { name }, ref_ { ref }, 
 			is_var_ { is_var }, with_load_ { with_load }
 		{ }
 	public:
-		using Ptr = std::shared_ptr<Variable>;
+		using Ptr = Variable *;
 		static auto create(
-			std::string name, Reference::Ptr ref,
+			Arena &arena, Symbol name, Reference::Ptr ref,
 			bool is_var, bool with_load
 		) {
-			return Ptr { new Variable {
+			return arena.create<Variable>(
 				name, ref, is_var, with_load
-			} };
+			);
 		}
 		auto type() { return ref_ ? ref_->type() : nullptr; }
 		auto ref() { return ref_; }
@@ -61,18 +64,19 @@ class Variable: public Declaration {
 };
 
 class Procedure: public Scoping_Declaration {
-		Type::Ptr returns_;
+		friend class Arena;
+		Type::Ptr returns_ { nullptr };
 		std::vector<Variable::Ptr> arguments_;
 
-		Procedure(std::string name, Scoping_Declaration::Ptr parent):
+		Procedure(Symbol name, Scoping_Declaration::Ptr parent):
 			Scoping_Declaration { name, parent }
 		{ }
 	public:
-		using Ptr = std::shared_ptr<Procedure>;
+		using Ptr = Procedure *;
 		static auto create(
-			std::string name, Scoping_Declaration::Ptr parent
+			Arena &arena, Symbol name, Scoping_Declaration::Ptr parent
 		) {
-			return Ptr { new Procedure { name, parent } };
+			return arena.create<Procedure>(name, parent);
 		}
 		auto returns() { return returns_; }
 		void set_returns(Type::Ptr returns) { returns_ = returns; }
@@ -84,15 +88,18 @@ class Procedure: public Scoping_Declaration {
 };
 
 class Const: public Declaration {
+		friend class Arena;
 		Literal::Ptr literal_;
 
-		Const(std::string name, Literal::Ptr literal):
+		Const(Symbol name, Literal::Ptr literal):
 			Declaration { name }, literal_ { literal }
 		{ }
 	public:
-		using Ptr = std::shared_ptr<Const>;
-		static auto create(std::string name, Literal::Ptr literal) {
-			return Ptr { new Const { name, literal } };
+		using Ptr = Const *;
+		static auto create(
+			Arena &arena, Symbol name, Literal::Ptr literal
+		) {
+			return arena.create<Const>(name, literal);
 		}
 		auto value() { return literal_; }
 };
@@ -0,0 +1,191 @@
+#include "object_file.h"
+
+#include "output.h"
+
+#include <cstring>
+#include <elf.h>
+#include <unordered_map>
+
+namespace {
+	enum Section_Index {
+		no_section, text_section, data_section, rela_section,
+		symtab_section, strtab_section, shstrtab_section, stack_section,
+		section_count
+	};
+
+	class Image {
+			std::string bytes_;
+		public:
+			size_t size() const { return bytes_.size(); }
+			const std::string &bytes() const { return bytes_; }
+
+			size_t add(const void *data, size_t size) {
+				auto at { bytes_.size() };
+				bytes_.append(static_cast<const char *>(data), size);
+				return at;
+			}
+			template<typename T> size_t add(const T &value) {
+				return add(&value, sizeof(value));
+			}
+			void align(size_t alignment) {
+				auto size { bytes_.size() + alignment - 1 };
+				bytes_.resize(size & ~(alignment - 1));
+			}
+			template<typename T> T &at(size_t offset) {
+				return *reinterpret_cast<T *>(&bytes_[offset]);
+			}
+	};
+
+	// names separated by zero bytes, starting with the empty name
+	class String_Table {
+			std::string chars_ { '\0' };
+		public:
+			const std::string &chars() const { return chars_; }
+			Elf64_Word add(const std::string &name) {
+				auto at { chars_.size() };
+				chars_ += name;
+				chars_ += '\0';
+				return at;
+			}
+	};
+}
+
+void write_object_file(
+	const Object_Code &code, const std::string &path,
+	const std::string &source
+) {
+	String_Table strings;
+	std::vector<Elf64_Sym> symbols(1);
+	auto add_symbol { [&](
+		Elf64_Word name, unsigned char info, Elf64_Half section,
+		Elf64_Addr value, Elf64_Xword size
+	) {
+		Elf64_Sym sym { };
+		sym.st_name = name;
+		sym.st_info = info;
+		sym.st_shndx = section;
+		sym.st_value = value;
+		sym.st_size = size;
+		symbols.push_back(sym);
+		return static_cast<Elf64_Word>(symbols.size() - 1);
+	} };
+	add_symbol(
+		strings.add(source), ELF64_ST_INFO(STB_LOCAL, STT_FILE),
+		SHN_ABS, 0, 0
+	);
+	add_symbol(0, ELF64_ST_INFO(STB_LOCAL, STT_SECTION), text_section, 0, 0);
+	auto data_symbol { add_symbol(
+		0, ELF64_ST_INFO(STB_LOCAL, STT_SECTION), data_section, 0, 0
+	) };
+	Elf64_Word first_global = symbols.size();
+	std::unordered_map<std::string, Elf64_Word> by_name;
+	for (const auto &fn : code.functions) {
+		by_name[fn.name] = add_symbol(
+			strings.add(fn.name), ELF64_ST_INFO(STB_GLOBAL, STT_FUNC),
+			text_section, fn.offset, fn.size
+		);
+	}
+	std::vector<Elf64_Rela> relas;
+	for (const auto &reloc : code.relocations) {
+		Elf64_Rela rela { };
+		rela.r_offset = reloc.offset;
+		rela.r_addend = reloc.addend;
+		if (reloc.kind == Object_Code::Relocation::Kind::data) {
+			rela.r_info = ELF64_R_INFO(data_symbol, R_X86_64_PC32);
+		} else {
+			auto &sym { by_name[reloc.symbol] };
+			if (! sym) {
+				sym = add_symbol(
+					strings.add(reloc.symbol),
+					ELF64_ST_INFO(STB_GLOBAL, STT_NOTYPE), SHN_UNDEF, 0, 0
+				);
+			}
+			rela.r_info = ELF64_R_INFO(sym, R_X86_64_PLT32);
+		}
+		relas.push_back(rela);
+	}
+
+	Image image;
+	image.add(Elf64_Ehdr { });
+	image.align(16);
+	auto text_at { image.add(code.text.data(), code.text.size()) };
+	image.align(8);
+	auto rela_at { image.add(relas.data(), relas.size() * sizeof(Elf64_Rela)) };
+	auto symtab_at { image.add(
+		symbols.data(), symbols.size() * sizeof(Elf64_Sym)
+	) };
+	auto strtab_at { image.add(
+		strings.chars().data(), strings.chars().size()
+	) };
+	String_Table names;
+	Elf64_Shdr sections[section_count] { };
+	auto section { [&](
+		Section_Index index, const char *name, Elf64_Word type,
+		Elf64_Xword flags, Elf64_Off offset, Elf64_Xword size,
+		Elf64_Xword alignment
+	) -> Elf64_Shdr & {
+		auto &s { sections[index] };
+		s.sh_name = names.add(name);
+		s.sh_type = type;
+		s.sh_flags = flags;
+		s.sh_offset = offset;
+		s.sh_size = size;
+		s.sh_addralign = alignment;
+		return s;
+	} };
+	section(
+		text_section, ".text", SHT_PROGBITS, SHF_ALLOC | SHF_EXECINSTR,
+		text_at, code.text.size(), 16
+	);
+	section(
+		data_section, ".bss", SHT_NOBITS, SHF_ALLOC | SHF_WRITE,
+		image.size(), code.data_size, 8
+	);
+	auto &rela { section(
+		rela_section, ".rela.text", SHT_RELA, SHF_INFO_LINK, rela_at,
+		relas.size() * sizeof(Elf64_Rela), 8
+	) };
+	rela.sh_link = symtab_section;
+	rela.sh_info = text_section;
+	rela.sh_entsize = sizeof(Elf64_Rela);
+	auto &symtab { section(
+		symtab_section, ".symtab", SHT_SYMTAB, 0, symtab_at,
+		symbols.size() * sizeof(Elf64_Sym), 8
+	) };
+	symtab.sh_link = strtab_section;
+	symtab.sh_info = first_global;
+	symtab.sh_entsize = sizeof(Elf64_Sym);
+	section(
+		strtab_section, ".strtab", SHT_STRTAB, 0, strtab_at,
+		strings.chars().size(), 1
+	);
+	auto &shstrtab { section(
+		shstrtab_section, ".shstrtab", SHT_STRTAB, 0, 0, 0, 1
+	) };
+	// without the note linkers assume an executable stack
+	section(
+		stack_section, ".note.GNU-stack", SHT_PROGBITS, 0, image.size(), 0, 1
+	);
+	shstrtab.sh_offset = image.add(names.chars().data(), names.chars().size());
+	shstrtab.sh_size = names.chars().size();
+	image.align(8);
+	auto sections_at { image.add(sections, sizeof(sections)) };
+
+	auto &header { image.at<Elf64_Ehdr>(0) };
+	std::memcpy(header.e_ident, ELFMAG, SELFMAG);
+	header.e_ident[EI_CLASS] = ELFCLASS64;
+	header.e_ident[EI_DATA] = ELFDATA2LSB;
+	header.e_ident[EI_VERSION] = EV_CURRENT;
+	header.e_ident[EI_OSABI] = ELFOSABI_SYSV;
+	header.e_type = ET_REL;
+	header.e_machine = EM_X86_64;
+	header.e_version = EV_CURRENT;
+	header.e_shoff = sections_at;
+	header.e_ehsize = sizeof(Elf64_Ehdr);
+	header.e_shentsize = sizeof(Elf64_Shdr);
+	header.e_shnum = section_count;
+	header.e_shstrndx = shstrtab_section;
+
+	Output out { path };
+	out << image.bytes();
+}
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// machine code of a module: one text section with the functions,
+// zeroed data for the module variables and the places that still
+// need an address
+struct Object_Code {
+	// how a parameter or the result travels in the calling convention;
+	// a jit needs it to call into the code
+	enum class Value_Class { none, integer, boolean, real, address };
+
+	struct Function {
+		std::string name;
+		size_t offset;
+		size_t size;
+		std::vector<Value_Class> params;
+		Value_Class result { Value_Class::none };
+	};
+
+	// a 32 bit pc relative field at offset; calls name a function,
+	// data references point into the zeroed data at addend + 4
+	struct Relocation {
+		enum class Kind { call, data };
+		Kind kind;
+		size_t offset;
+		std::string symbol;
+		std::int64_t addend;
+	};
+
+	std::vector<std::uint8_t> text;
+	size_t data_size { 0 };
+	std::vector<Function> functions;
+	std::vector<Relocation> relocations;
+};
+
+// writes an ELF64 relocatable object for x86-64; calls of functions
+// that are not part of code become undefined symbols
+void write_object_file(
+	const Object_Code &code, const std::string &path,
+	const std::string &source
+);
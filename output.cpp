@@ -0,0 +1,48 @@
+#include "output.h"
+
+#include "err.h"
+
+#include <cerrno>
+#include <charconv>
+#include <fcntl.h>
+#include <unistd.h>
+
+Output::Output(const std::string &path):
+	fd_ { ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644) },
+	owns_fd_ { true }
+{
+	if (fd_ < 0) { throw Error { "cannot open " + path + " for writing" }; }
+	buffer_.reserve(2 * flush_size);
+}
+
+Output::~Output() {
+	try { flush(); } catch (const Error &) { }
+	if (owns_fd_) { ::close(fd_); }
+}
+
+Output &Output::operator<<(int value) {
+	char digits[16];
+	auto got { std::to_chars(digits, digits + sizeof(digits), value) };
+	return *this << std::string_view {
+		digits, static_cast<size_t>(got.ptr - digits)
+	};
+}
+
+void Output::write_out() {
+	const char *cur { buffer_.data() };
+	size_t left { buffer_.size() };
+	while (left) {
+		auto written { ::write(fd_, cur, left) };
+		if (written < 0) {
+			if (errno == EINTR) { continue; }
+			buffer_.clear();
+			throw Error { "cannot write output" };
+		}
+		cur += written; left -= written;
+	}
+	buffer_.clear();
+}
+
+void Output::flush() {
+	if (fd_ >= 0 && ! buffer_.empty()) { write_out(); }
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+// buffered sink for the generated code; writes to a file descriptor in
+// large chunks or, without one, collects everything in memory
+class Output {
+		static constexpr size_t flush_size { 1 << 20 };
+		int fd_;
+		bool owns_fd_ { false };
+		std::string buffer_;
+
+		void write_out();
+	public:
+		Output(): fd_ { -1 } { }
+		Output(int fd): fd_ { fd } { buffer_.reserve(2 * flush_size); }
+		Output(const std::string &path);
+		Output(const Output &) = delete;
+		Output &operator=(const Output &) = delete;
+		~Output();
+
+		Output &operator<<(std::string_view str) {
+			buffer_.append(str);
+			if (buffer_.size() >= flush_size && fd_ >= 0) {
+				write_out();
+			}
+			return *this;
+		}
+		Output &operator<<(const char *str) {
+			return *this << std::string_view { str };
+		}
+		Output &operator<<(char ch) {
+			buffer_.push_back(ch);
+			return *this;
+		}
+		Output &operator<<(int value);
+
+		void flush();
+
+		// collected text of an output without file descriptor
+		std::string_view contents() const { return buffer_; }
+};
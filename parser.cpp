@@ -1,545 +1,147 @@
 #include "parser.h"
 
-#include "scope.h"
+#include "ast_gen.h"
+#include "checker.h"
 
-void Parser::parse() {
-	parse_module();
-	expect(Token_Kind::eoi);
-}
-
-bool is_numeric(Type::Ptr t) {
-	return t == integer_type || t == real_type;
-}
+#include <charconv>
 
-Value::Ptr Parser::parse_unary_plus(Value::Ptr left) {
-	auto t { left->type() };
-	if (! is_numeric(t)) { throw Error { "wrong type for unary +" }; }
-	return left;
-}
-
-Value::Ptr Parser::parse_unary_minus(Value::Ptr left) {
-	auto t { left->type() };
-	if (! is_numeric(t)) { throw Error { "wrong type for unary -" }; }
-	if (auto l { std::dynamic_pointer_cast<Integer_Literal>(left) }) {
-		return Integer_Literal::create(-l->value());
-	}
-	if (auto l { std::dynamic_pointer_cast<Real_Literal>(left) }) {
-		return Real_Literal::create(-l->value());
-	}
-	
-	auto r { Reference::create(gen_.next_id(), t) };
-	gen_.append(
-		r->name() + " = neg " + get_ir_type(t) + " " + left->name()
-	);
-	return r;
-}
-
-Value::Ptr propagate_to_real(Value::Ptr v) {
-	if (v->type() == real_type) { return v; }
-	if (v->type() != integer_type) {
-		throw Error { "cannot promote type to REAL" };
-	}
-	if (auto i { std::dynamic_pointer_cast<Integer_Literal>(v) }) {
-		return Real_Literal::create(i->value());
-	}
-	throw Error { "cannot cast integer to REAL" }; // TODO
-}
-
-Value::Ptr Parser::parse_binary_plus(Value::Ptr left, Value::Ptr right) {
-	auto lt { left->type() };
-	auto rt { left->type() };
-	if (! (is_numeric(lt) && is_numeric(rt))) {
-		throw Error { "wrong type for binary +" };
-	}
-
-	if (lt == integer_type && rt == integer_type) {
-		auto li { std::dynamic_pointer_cast<Integer_Literal>(left) };
-		auto ri { std::dynamic_pointer_cast<Integer_Literal>(right) };
-
-		if (li && ri) { return Integer_Literal::create(
-			li->value() + ri->value()
-		); }
-		if (li && li->value() == 0) { return right; }
-		if (ri && ri->value() == 0) { return left; }
-
-		auto r { Reference::create(gen_.next_id(), integer_type) };
-		gen_.append(
-			r->name() + " = add i32 " + left->name() + ", " +
-			right->name()
-		);
-		return r;
-	}
-	
-	left = { propagate_to_real(left) };
-	right = { propagate_to_real(right) };
-	auto lr { std::dynamic_pointer_cast<Real_Literal>(left) };
-	auto rr { std::dynamic_pointer_cast<Real_Literal>(right) };
-	if (lr && rr) {
-		return Real_Literal::create(lr->value() + rr->value());
-	}
-	if (lr && lr->value() == 0.0) { return right; }
-	if (rr && rr->value() == 0.0) { return left; }
-
-	auto r { Reference::create(gen_.next_id(), real_type) };
-	gen_.append(
-		r->name() + " = fadd double " + left->name() + ", " +
-		right->name()
-	);
-	return r;
-}
-
-Value::Ptr Parser::parse_binary_minus(Value::Ptr left, Value::Ptr right) {
-	auto lt { left->type() };
-	auto rt { left->type() };
-	if (! (is_numeric(lt) && is_numeric(rt))) {
-		throw Error { "wrong type for binary -" };
-	}
-
-	if (lt == integer_type && rt == integer_type) {
-		auto li { std::dynamic_pointer_cast<Integer_Literal>(left) };
-		auto ri { std::dynamic_pointer_cast<Integer_Literal>(right) };
-
-		if (li && ri) { return Integer_Literal::create(
-			li->value() - ri->value()
-		); }
-		if (ri && ri->value() == 0) { return left; }
-
-		auto r { Reference::create(gen_.next_id(), integer_type) };
-		gen_.append(
-			r->name() + " = sub i32 " + left->name() + ", " +
-			right->name()
-		);
-		return r;
+void Parser::parse() {
+	try {
+		parse_module();
+		expect(Token_Kind::eoi);
+	} catch (Error &e) {
+		e.set_line(tok_.line());
+		throw;
 	}
-	
-	left = { propagate_to_real(left) };
-	right = { propagate_to_real(right) };
-	auto lr { std::dynamic_pointer_cast<Real_Literal>(left) };
-	auto rr { std::dynamic_pointer_cast<Real_Literal>(right) };
-	if (lr && rr) {
-		return Real_Literal::create(lr->value() - rr->value());
-	}
-	if (rr && rr->value() == 0.0) { return left; }
-
-	auto r { Reference::create(gen_.next_id(), real_type) };
-	gen_.append(
-		r->name() + " = fsub double " + left->name() + ", " +
-		right->name()
-	);
-	return r;
 }
 
-Value::Ptr Parser::parse_conditional_or(Value::Ptr left) {
-	if (left->type() != boolean_type) {
-		throw Error { "wrong type for OR" };
-	}
-	if (auto lb { std::dynamic_pointer_cast<Bool_Literal>(left) }) {
-		if (lb->value()) {
-			gen_.hide();
-			parse_term();
-			gen_.show();
-			return left;
-		} else {
-			return parse_term();
-		}
-	} else {
-		auto id { std::to_string(gen_.next_or_id()) };
-		auto store { Reference::create(gen_.next_id(), boolean_type) };
-		gen_.alloca(store);
-		gen_.append(
-			"store i1 " + left->name() +
-			", i1* " + store->name() + ", align 4"
-		);
-		gen_.conditional(left, "or_end_" + id, "or_alt_" + id);
-		gen_.def_label("or_alt_" + id);
-		auto right { parse_term() };
-		gen_.append(
-			"store i1 " + right->name() + 
-			", i1* " + store->name() + ", align 4"
-		);
-		gen_.branch("or_end_" + id);
-		gen_.def_label("or_end_" + id);
-		auto r { Reference::create(gen_.next_id(), boolean_type) };
-		gen_.append(
-			r->name() + " = load i1, "
-			"i1* " + store->name() + ", align 4"
-		);
-		return r;
+static int parse_integer(std::string_view digits) {
+	int value { 0 };
+	auto got { std::from_chars(
+		digits.data(), digits.data() + digits.size(), value
+	) };
+	if (got.ec != std::errc { }) {
+		throw Error {
+			"integer literal " + std::string { digits } +
+			" out of range"
+		};
 	}
+	return value;
 }
 
-Value::Ptr Parser::parse_simple_expression() {
-	Value::Ptr left;
+Expr Parser::parse_simple_expression() {
+	Expr left;
 	switch (tok_.kind()) {
 		case Token_Kind::plus:
 			advance();
-			left = parse_unary_plus(parse_term());
+			left = ast_.add_plus(parse_term());
 			break;
 		case Token_Kind::minus:
 			advance();
-			left = parse_unary_minus(parse_term());
+			left = ast_.add_unary(Unary_Op::neg, parse_term());
 			break;
 		default:
 			left = parse_term();
 	}
 
-	if (! left) { left = parse_term(); }
 	for (;;) {
+		Binary_Op op;
 		switch (tok_.kind()) {
-			case Token_Kind::plus:
-				advance();
-				left = parse_binary_plus(left, parse_term());
-				break;
-			case Token_Kind::minus:
-				advance();
-				left = parse_binary_minus(left, parse_term());
-				break;
-			case Token_Kind::kw_OR:
-				advance();
-				left = parse_conditional_or(left);
+			case Token_Kind::plus: op = Binary_Op::add; break;
+			case Token_Kind::minus: op = Binary_Op::sub; break;
+			case Token_Kind::kw_OR: op = Binary_Op::log_or; break;
 			default: return left;
 		}
+		advance();
+		left = ast_.add_binary(op, left, parse_term());
 	}
 }
 
-template<typename FN> Value::Ptr Parser::parse_numeric_predicate(
-	std::string cmd, FN fn, Value::Ptr left, Value::Ptr right
-) {
-	auto lt { left->type() };
-	auto rt { left->type() };
-	if (! (is_numeric(lt) && is_numeric(rt))) {
-		throw Error { "wrong type for predicate" };
-	}
-
-	if (lt == integer_type && rt == integer_type) {
-		auto li { std::dynamic_pointer_cast<Integer_Literal>(left) };
-		auto ri { std::dynamic_pointer_cast<Integer_Literal>(right) };
-
-		if (li && ri) { return Bool_Literal::create(
-			fn(li->value(), ri->value())
-		); }
-
-		auto r { Reference::create(gen_.next_id(), boolean_type) };
-		gen_.append(
-			r->name() + " = icmp " + cmd +
-			" i32 " + left->name() + ", " + right->name()
-		);
-		return r;
-	}
-	
-	left = { propagate_to_real(left) };
-	right = { propagate_to_real(right) };
-	auto lr { std::dynamic_pointer_cast<Real_Literal>(left) };
-	auto rr { std::dynamic_pointer_cast<Real_Literal>(right) };
-	if (lr && rr) {
-		return Real_Literal::create(fn(lr->value(), rr->value()));
-	}
-
-	auto r { Reference::create(gen_.next_id(), boolean_type) };
-	gen_.append(
-		r->name() + " = fcmp " + cmd + " double " + left->name() +
-		", " + right->name()
-	);
-	return r;
-}
-
-template<typename FN> Value::Ptr Parser::parse_full_predicate(
-	std::string cmd, FN fn, Value::Ptr left, Value::Ptr right
-) {
-	auto lt { left->type() };
-	auto rt { left->type() };
-	if (lt == boolean_type && rt == boolean_type) {
-		auto lb { std::dynamic_pointer_cast<Bool_Literal>(left) };
-		auto rb { std::dynamic_pointer_cast<Bool_Literal>(right) };
-
-		if (lb && rb) { return Bool_Literal::create(
-			fn(lb->value(), rb->value())
-		); }
-
-		auto r { Reference::create(gen_.next_id(), boolean_type) };
-		gen_.append(
-			r->name() + " = icmp " + cmd +
-			" i1 " + left->name() + ", " + right->name()
-		);
-		return r;
-	}
-	return parse_numeric_predicate(cmd, fn, left, right);
-}
-
-struct Equal {
-	bool operator()(int a, int b) { return a == b; }
-	bool operator()(bool a, bool b) { return a == b; }
-	bool operator()(double a, double b) { return a == b; }
-};
-
-struct Not_Equal {
-	bool operator()(int a, int b) { return a != b; }
-	bool operator()(bool a, bool b) { return a != b; }
-	bool operator()(double a, double b) { return a != b; }
-};
-
-struct Less {
-	bool operator()(int a, int b) { return a < b; }
-	bool operator()(double a, double b) { return a < b; }
-};
-
-struct Less_Or_Equal {
-	bool operator()(int a, int b) { return a <= b; }
-	bool operator()(double a, double b) { return a <= b; }
-};
-
-struct Greater {
-	bool operator()(int a, int b) { return a > b; }
-	bool operator()(double a, double b) { return a > b; }
-};
-
-struct Greater_Or_Equal {
-	bool operator()(int a, int b) { return a >= b; }
-	bool operator()(double a, double b) { return a >= b; }
-};
-
-Value::Ptr Parser::parse_expression() {
+Expr Parser::parse_expression() {
 	auto left { parse_simple_expression() };
 	for (;;) {
+		Binary_Op op;
 		switch (tok_.kind()) {
-			case Token_Kind::equal:
-				advance();
-				left = parse_full_predicate(
-					"eq", Equal { }, left,
-					parse_simple_expression()
-				);
-				break;
+			case Token_Kind::equal: op = Binary_Op::equal; break;
 			case Token_Kind::not_equal:
-				advance();
-				left = parse_full_predicate(
-					"ne", Not_Equal { }, left, 
-					parse_simple_expression()
-				);
-				break;
-			case Token_Kind::less:
-				advance();
-				left = parse_numeric_predicate(
-					"slt", Less { }, left, 
-					parse_simple_expression()
-				);
-				break;
+				op = Binary_Op::not_equal; break;
+			case Token_Kind::less: op = Binary_Op::less; break;
 			case Token_Kind::less_equal:
-				advance();
-				left = parse_numeric_predicate(
-					"sle", Less_Or_Equal { }, left, 
-					parse_simple_expression()
-				);
-				break;
-			case Token_Kind::greater:
-				advance();
-				left = parse_numeric_predicate(
-					"sgt", Greater { }, left, 
-					parse_simple_expression()
-				);
-				break;
+				op = Binary_Op::less_equal; break;
+			case Token_Kind::greater: op = Binary_Op::greater; break;
 			case Token_Kind::greater_equal:
-				advance();
-				left = parse_numeric_predicate(
-					"sge", Greater_Or_Equal { }, left,
-					parse_simple_expression()
-				);
-				break;
+				op = Binary_Op::greater_equal; break;
 			default: return left;
 		}
+		advance();
+		left = ast_.add_binary(op, left, parse_simple_expression());
 	}
 	return left;
 }
 
-Value::Ptr Parser::parse_binary_mul(Value::Ptr left, Value::Ptr right) {
-	auto lt { left->type() };
-	auto rt { left->type() };
-	if (! (is_numeric(lt) && is_numeric(rt))) {
-		throw Error { "wrong type for binary *" };
-	}
-
-	if (lt == integer_type && rt == integer_type) {
-		auto li { std::dynamic_pointer_cast<Integer_Literal>(left) };
-		auto ri { std::dynamic_pointer_cast<Integer_Literal>(right) };
-
-		if (li && ri) { return Integer_Literal::create(
-			li->value() * ri->value()
-		); }
-		if (li && li->value() == 1) { return right; }
-		if (ri && ri->value() == 1) { return left; }
-		if ((li && li->value() == 0) || (ri && ri->value() == 0)) {
-			return Integer_Literal::create(0);
-		}
-
-		auto r { Reference::create(gen_.next_id(), integer_type) };
-		gen_.append(
-			r->name() + " = mul i32 " + left->name() + ", " +
-			right->name()
-		);
-		return r;
-	}
-	
-	left = { propagate_to_real(left) };
-	right = { propagate_to_real(right) };
-	auto lr { std::dynamic_pointer_cast<Real_Literal>(left) };
-	auto rr { std::dynamic_pointer_cast<Real_Literal>(right) };
-	if (lr && rr) {
-		return Real_Literal::create(lr->value() + rr->value());
-	}
-	if (lr && lr->value() == 1.0) { return right; }
-	if (rr && rr->value() == 1.0) { return left; }
-	if ((lr && lr->value() == 0.0) || (rr && rr->value() == 0.0)) {
-		return Real_Literal::create(0.0);
-	}
-
-	auto r { Reference::create(gen_.next_id(), real_type) };
-	gen_.append(
-		r->name() + " = fmul double " + left->name() + ", " +
-		right->name()
-	);
-	return r;
-}
-
-Value::Ptr Parser::parse_binary_int_div(Value::Ptr left, Value::Ptr right) {
-	if (left->type() != integer_type || right->type() != integer_type) {
-		throw Error { "wrong type for DIV" };
-	}
-
-	auto li { std::dynamic_pointer_cast<Integer_Literal>(left) };
-	auto ri { std::dynamic_pointer_cast<Integer_Literal>(right) };
-
-	if (ri && ri->value() == 1) { return left; }
-
-	if (li && ri) {
-		if (ri->value() == 0) {
-			throw Error { "division by zero" };
-		}
-		return Integer_Literal::create(li->value() / ri->value());
-	}
-
-	auto r { Reference::create(gen_.next_id(), integer_type) };
-	gen_.append(
-		r->name() + " = div i32 " + left->name() + ", " +
-		right->name()
-	);
-	return r;
-}
-
-Value::Ptr Parser::parse_binary_mod(Value::Ptr left, Value::Ptr right) {
-	if (left->type() != integer_type || right->type() != integer_type) {
-		throw Error { "wrong type for MOD" };
-	}
-
-	auto li { std::dynamic_pointer_cast<Integer_Literal>(left) };
-	auto ri { std::dynamic_pointer_cast<Integer_Literal>(right) };
-
-	if (li && ri) {
-		return Integer_Literal::create(li->value() % ri->value());
-	}
-
-	auto r { Reference::create(gen_.next_id(), integer_type) };
-	gen_.append(
-		r->name() + " = srem i32 " + left->name() + ", " +
-		right->name()
-	);
-	return r;
-}
-
-Value::Ptr Parser::parse_term() {
+Expr Parser::parse_term() {
 	auto left { parse_factor() };
 	for (;;) {
+		Binary_Op op;
 		switch (tok_.kind()) {
-			case Token_Kind::star:
-				advance();
-				left = parse_binary_mul(left, parse_factor());
-				break;
-			case Token_Kind::kw_DIV: {
-				advance();
-				left = parse_binary_int_div(
-					left, parse_factor()
-				);
-				break;
-			}
-			case Token_Kind::kw_MOD: {
-				advance();
-				left = parse_binary_mod(left, parse_factor());
-			       	break;
-			}
+			case Token_Kind::star: op = Binary_Op::mul; break;
+			case Token_Kind::kw_DIV: op = Binary_Op::int_div; break;
+			case Token_Kind::kw_MOD: op = Binary_Op::mod; break;
+			case Token_Kind::sym_and: op = Binary_Op::log_and; break;
 			default: return left;
 		}
+		advance();
+		left = ast_.add_binary(op, left, parse_factor());
 	}
 	return left;
 }
 
-Value::Ptr Parser::parse_unary_not(Value::Ptr left) {
-	auto t { left->type() };
-	if (t != boolean_type) {
-		throw Error { "wrong type for unary ~" };
-	}
-	if (auto l { std::dynamic_pointer_cast<Bool_Literal>(left) }) {
-		return Bool_Literal::create(! l->value());
-	}
-	auto r { Reference::create(gen_.next_id(), t) };
-	gen_.append(
-		r->name() + " = not " + get_ir_type(t) + " " + left->name()
-	);
-	return r;
-}
-
-Value::Ptr Parser::parse_factor() {
-	std::shared_ptr<Value> res;
+Expr Parser::parse_factor() {
+	Expr res;
 	switch(tok_.kind()) {
 		case Token_Kind::integer_literal:
-			res = Integer_Literal::create(
-				std::stoi(tok_.literal_data())
+			res = ast_.add_literal(
+				pool_.get(parse_integer(tok_.literal_data()))
 			);
 			advance();
 			break;
 		case Token_Kind::identifier: {
 			auto got { parse_qual_ident() };
-			if (auto var { std::dynamic_pointer_cast<Variable>(
+			if (auto var { dynamic_cast<Variable *>(
 				got
 			) }) {
-				if (var->with_load()) {
-					auto r { gen_.next_id() };
-					res = Reference::create(
-						r, var->type()
-					);
-					gen_.append(
-						res->name() + " = load " +
-						get_ir_type(var->type()) +
-						", " +
-						get_ir_type(var->type()) +
-						"* " + var->ref()->name() +
-						", align 4"
-					);
-				} else {
-					res = var->ref();
-				}
-			} else if (auto c { std::dynamic_pointer_cast<Const>(
+				res = ast_.add_variable(var);
+			} else if (auto c { dynamic_cast<Const *>(
+				got
+			) }) {
+				res = ast_.add_literal(c->value());
+			} else if (auto p { dynamic_cast<Procedure *>(
 				got
 			) }) {
-				res = c->value();
+				expect(Token_Kind::l_paren);
+				res = parse_call(p);
 			} else { throw Error { got->name() + " not found" }; }
 			break;
 		}
 		case Token_Kind::kw_FALSE:
-			res = Bool_Literal::create(false);
+			res = ast_.add_literal(pool_.get(false));
 			advance();
 			break;
 		case Token_Kind::kw_TRUE:
-			res = Bool_Literal::create(true);
+			res = ast_.add_literal(pool_.get(true));
 			advance();
 			break;
 		case Token_Kind::sym_not:
 			advance();
-			res = parse_unary_not(parse_expression());
+			res = ast_.add_unary(Unary_Op::log_not, parse_factor());
 			break;
 		case Token_Kind::l_paren:
 			advance();
 			res = parse_expression();
 			consume(Token_Kind::r_paren);
+			break;
 		default:
-			throw Error { "no factor: '" + tok_.raw() + "'" };
+			throw Error { "no factor: '" + std::string { tok_.raw() } + "'" };
 	}
 	return res;
 }
@@ -549,88 +151,84 @@ Declaration::Ptr Parser::parse_designator() {
 	// TODO: selectors
 }
 
-void Parser::parse_statement() {
-	if (tok_.is(Token_Kind::kw_IF)) {
-		auto id { std::to_string(gen_.next_if_id()) };
-		int alt { 0 };
-		gen_.branch("if_cond_" + id + "_", alt);
-		gen_.def_label("if_cond_" + id + "_", alt);
+Expr Parser::parse_argument(Variable::Ptr formal) {
+	if (formal->is_var()) {
+		auto got { parse_designator() };
+		auto var { dynamic_cast<Variable *>(got) };
+		if (! var) {
+			throw Error { got->name() + " is no variable for VAR parameter" };
+		}
+		return ast_.add_variable(var);
+	}
+	return parse_expression();
+}
+
+Expr Parser::parse_call(Procedure::Ptr procedure) {
+	std::vector<Expr> args;
+	auto formal { procedure->args_begin() };
+	auto end { procedure->args_end() };
+	if (tok_.is(Token_Kind::l_paren)) {
 		advance();
-		auto expr { parse_expression() };
-		gen_.conditional(
-			expr, "if_body_" + id + "_", alt,
-			"if_cond_" + id + "_", alt + 1
-		);
-		gen_.def_label("if_body_" + id + "_", alt);
-		++alt;
-		consume(Token_Kind::kw_THEN);
-		parse_statement_sequence();
-		gen_.branch("if_end_" + id);
-		gen_.def_label("if_cond_" + id + "_", alt);
-		while (tok_.is(Token_Kind::kw_ELSIF)) {
+		while (! tok_.is_one_of(Token_Kind::r_paren, Token_Kind::eoi)) {
+			if (! args.empty()) { consume(Token_Kind::comma); }
+			if (formal == end) {
+				throw Error { "too many arguments for " + procedure->name() };
+			}
+			args.push_back(parse_argument(*formal++));
+		}
+		consume(Token_Kind::r_paren);
+	}
+	if (formal != end) {
+		throw Error { "too few arguments for " + procedure->name() };
+	}
+	return ast_.add_call(procedure, args);
+}
+
+void Parser::parse_statement(std::vector<Stmt> &sequence) {
+	auto line { tok_.line() };
+	if (tok_.is(Token_Kind::kw_IF)) {
+		std::vector<Branch_Node> branches;
+		do {
+			auto cond_line { tok_.line() };
 			advance();
 			auto expr { parse_expression() };
-			gen_.conditional(
-				expr, "if_body_" + id + "_", alt,
-				"if_cond_" + id + "_", alt + 1
-			);
-			gen_.def_label("if_body_" + id + "_", alt);
-			++alt;
 			consume(Token_Kind::kw_THEN);
-			parse_statement_sequence();
-			gen_.branch("if_end_" + id);
-		}
+			branches.push_back({
+				expr, parse_statement_sequence(), cond_line
+			});
+		} while (tok_.is(Token_Kind::kw_ELSIF));
+		Node_Range otherwise;
 		if (tok_.is(Token_Kind::kw_ELSE)) {
 			advance();
-			parse_statement_sequence();
+			otherwise = parse_statement_sequence();
 		}
-		gen_.branch("if_end_" + id);
-		gen_.def_label("if_end_" + id);
 		consume(Token_Kind::kw_END);
+		sequence.push_back(ast_.add_if(branches, otherwise, line));
 		return;
 	}
 	// TODO: case statement
 	if (tok_.is(Token_Kind::kw_WHILE)) {
-		auto id { std::to_string(gen_.next_while_id()) };
-		int alt { 0 };
-		gen_.branch("while_cond_" + id + "_", alt);
-		gen_.def_label("while_cond_" + id + "_", alt);
-		advance();
-		auto expr { parse_expression() };
-		gen_.conditional(
-			expr, "while_body_" + id + "_", alt,
-			"while_cond_" + id + "_", alt + 1
-		);
-		consume(Token_Kind::kw_DO);
-		gen_.def_label("while_body_" + id + "_", alt);
-		parse_statement_sequence();
-		gen_.branch("while_cond_" + id + "_0");
-		++alt;
-		gen_.def_label("while_cond_" + id + "_", alt);
-
-		while (tok_.is(Token_Kind::kw_ELSIF)) {
+		std::vector<Branch_Node> branches;
+		do {
+			auto cond_line { tok_.line() };
 			advance();
 			auto expr { parse_expression() };
-			gen_.conditional(
-				expr, "while_body_" + id + "_", alt,
-				"while_cond_" + id + "_", alt + 1
-			);
 			consume(Token_Kind::kw_DO);
-			gen_.def_label("while_body_" + id + "_", alt);
-			parse_statement_sequence();
-			gen_.branch("while_cond_" + id + "_0");
-			++alt;
-			gen_.def_label("while_cond_" + id + "_", alt);
-		}
+			branches.push_back({
+				expr, parse_statement_sequence(), cond_line
+			});
+		} while (tok_.is(Token_Kind::kw_ELSIF));
 		consume(Token_Kind::kw_END);
+		sequence.push_back(ast_.add_while(branches, line));
 		return;
 	}
 
 	if (tok_.is(Token_Kind::kw_REPEAT)) {
 		advance();
-		parse_statement_sequence();
+		auto body { parse_statement_sequence() };
 		consume(Token_Kind::kw_UNTIL);
-		parse_expression();
+		auto expr { parse_expression() };
+		sequence.push_back(ast_.add_repeat(body, expr, line));
 		return;
 	}
 	// TODO: for statement
@@ -640,39 +238,29 @@ void Parser::parse_statement() {
 	auto id { parse_designator() };
 	if (tok_.is(Token_Kind::assign)) {
 		advance();
-		auto v { std::dynamic_pointer_cast<Variable>(id) };
+		auto v { dynamic_cast<Variable *>(id) };
 		if (! v) { throw Error {
-			v->name() + " is no variable for assignment"
+			id->name() + " is no variable for assignment"
 		}; }
 		auto e { parse_expression() };
-		gen_.append(
-			"store " + get_ir_type(v->type()) + " " +
-			e->name() + ", " + get_ir_type(v->type()) +
-			"* " + v->ref()->name() + ", align 4"
-		);
-	} else if (tok_.is(Token_Kind::l_paren)) {
-		advance();
-		if (! tok_.is(Token_Kind::r_paren)) {
-			parse_expression();
-			while (tok_.is(Token_Kind::comma)) {
-				advance();
-				parse_expression();
-			}
-		}
-		consume(Token_Kind::r_paren);
+		sequence.push_back(ast_.add_assign(v, e, line));
+	} else if (auto p { dynamic_cast<Procedure *>(id) }) {
+		sequence.push_back(ast_.add_call_statement(parse_call(p), line));
 	}
 }
 
-void Parser::parse_statement_sequence() {
-	parse_statement();
+Node_Range Parser::parse_statement_sequence() {
+	std::vector<Stmt> sequence;
+	parse_statement(sequence);
 	while (tok_.is(Token_Kind::semicolon)) {
 		advance();
-		parse_statement();
+		parse_statement(sequence);
 	}
+	return ast_.add_sequence(sequence);
 }
 
-std::vector<std::string> Parser::parse_ident_list() {
-	std::vector<std::string> ids;
+std::vector<Symbol> Parser::parse_ident_list() {
+	std::vector<Symbol> ids;
 
 	expect(Token_Kind::identifier);
 	ids.push_back(tok_.identifier());
@@ -688,10 +276,10 @@ std::vector<std::string> Parser::parse_ident_list() {
 
 Declaration::Ptr Parser::parse_qual_ident() {
 	expect(Token_Kind::identifier);
-	auto got { current_scope->lookup(tok_.identifier()) };
+	auto got { scope_.lookup(tok_.identifier()) };
 	if (! got) {
 		throw Error {
-			"unknown identifier '" + tok_.identifier() + "'"
+			"unknown identifier '" + tok_.identifier().str() + "'"
 		};
 	}
 	advance();
@@ -702,14 +290,13 @@ std::vector<Variable::Ptr> Parser::parse_parameter_declaration(bool is_var) {
 	auto ids { parse_ident_list() };
 	consume(Token_Kind::colon);
 	auto d { parse_qual_ident() };
-	auto t { std::dynamic_pointer_cast<Type>(d) };
+	auto t { dynamic_cast<Type *>(d) };
 	if (! t) { throw Error { d->name() + " is no type" }; }
 	std::vector<Variable::Ptr> result;
 	for (auto &n : ids) {
-		auto dcl = Variable::create(
-			n, Reference::create(gen_.next_id(), t), is_var, false
-		);
-		current_scope->insert(dcl);
+		auto ref { Reference::create(arena_, gen_.next_id(), t) };
+		auto dcl = Variable::create(arena_, n, ref, is_var, true);
+		scope_.insert(dcl);
 		result.push_back(dcl);
 	}
 	return result;
@@ -719,14 +306,13 @@ std::vector<Variable::Ptr> Parser::parse_variable_declaration() {
 	auto ids { parse_ident_list() };
 	consume(Token_Kind::colon);
 	auto d { parse_qual_ident() };
-	auto t { std::dynamic_pointer_cast<Type>(d) };
+	auto t { dynamic_cast<Type *>(d) };
 	if (! t) { throw Error { d->name() + " is no type" }; }
 	std::vector<Variable::Ptr> result;
 	for (auto &n : ids) {
-		auto r { Reference::create(gen_.next_id(), t) };
-		gen_.alloca(r);
-		auto dcl = Variable::create(n, r, false, true);
-		current_scope->insert(dcl);
+		auto r { Reference::create(local_arena(), gen_.next_id(), t) };
+		auto dcl = Variable::create(local_arena(), n, r, false, true);
+		scope_.insert(dcl);
 		result.push_back(dcl);
 	}
 	return result;
@@ -753,7 +339,7 @@ void Parser::parse_formal_parameters(Procedure::Ptr decl) {
 		for (auto arg : args) {
 			decl->add_argument(arg);
 		}
-		while (tok_.is(Token_Kind::comma)) {
+		while (tok_.is(Token_Kind::semicolon)) {
 			advance();
 			auto args { parse_fp_section(decl) };
 			for (auto arg : args) {
@@ -765,93 +351,181 @@ void Parser::parse_formal_parameters(Procedure::Ptr decl) {
 	if (tok_.is(Token_Kind::colon)) {
 		advance();
 		auto got { parse_qual_ident() };
-		auto ty { std::dynamic_pointer_cast<Type>(got) };
+		auto ty { dynamic_cast<Type *>(got) };
 		if (! ty) { Error { got->name() + " is not a type" }; }
 		decl->set_returns(ty);
 	}
 
 }
 
-std::string Parser::parse_procedure_heading() {
+// INLINE before the name asks for the procedure to be inlined; it is
+// no reserved word
+Symbol Parser::parse_procedure_heading(bool &inline_hint) {
 	consume(Token_Kind::kw_PROCEDURE);
 	expect(Token_Kind::identifier);
+	inline_hint = tok_.identifier() == Symbol::intern("INLINE") &&
+		peek(1).is(Token_Kind::identifier);
+	if (inline_hint) { advance(); }
 	auto name { tok_.identifier() };
 	advance();
 	return name;
 }
 
-void Parser::parse_procedure_body(Procedure::Ptr decl) {
-	parse_declaration_sequence(decl);
+void Parser::parse_procedure_body(Procedure::Ptr decl, Body &body) {
+	parse_declaration_sequence(decl, body);
 	if (tok_.is(Token_Kind::kw_BEGIN)) {
 		advance();
-		parse_statement_sequence();
+		body.statements = parse_statement_sequence();
 	}
 	if (tok_.is(Token_Kind::kw_RETURN)) {
+		body.result_line = tok_.line();
 		advance();
-		gen_.ret(parse_expression());
-
-	} else {
-		gen_.ret();
+		body.has_result = true;
+		body.result = parse_expression();
 	}
 	consume(Token_Kind::kw_END);
 }
 
+// what the code of a procedure depends on in a declaration it uses;
+// false for procedures without fingerprint
+bool Parser::add_dependency(
+	Fingerprint &fingerprint, Declaration::Ptr declaration
+) {
+	fingerprint.add(declaration->name());
+	if (auto c { dynamic_cast<Const *>(declaration) }) {
+		fingerprint.add(c->value()->type()->name());
+		fingerprint.add(c->value()->spelling());
+	} else if (auto var { dynamic_cast<Variable *>(declaration) }) {
+		fingerprint.add(var->type()->name());
+		fingerprint.add(var->is_var());
+		fingerprint.add(var->ref()->index());
+	} else if (auto p { dynamic_cast<Procedure *>(declaration) }) {
+		auto got { fingerprints_.find(p) };
+		if (got == fingerprints_.end()) { return false; }
+		fingerprint.add(got->second);
+	}
+	return true;
+}
+
+// hashes the tokens from PROCEDURE to the name after the matching END,
+// which end points to, and the declarations of the identifiers found
+// in the scope; false if the procedure does not end or uses one that
+// cannot be cached
+bool Parser::scan_procedure(Fingerprint &fingerprint, const char *&end) {
+	std::vector<Symbol> names;
+	auto naming { false };
+	auto prev { Token_Kind::eoi };
+	int ahead { 1 };
+	for (auto tok { tok_ }; ! tok.is(Token_Kind::eoi); tok = peek(ahead++)) {
+		fingerprint.add(static_cast<std::uint64_t>(tok.kind()));
+		fingerprint.add(tok.raw());
+		if (tok.is(Token_Kind::identifier)) {
+			auto id { tok.identifier() };
+			if (
+				prev == Token_Kind::kw_PROCEDURE &&
+				id == Symbol::intern("INLINE") &&
+				peek(ahead).is(Token_Kind::identifier)
+			) {
+				naming = true;
+			} else if (prev == Token_Kind::kw_PROCEDURE || naming) {
+				names.push_back(id);
+				naming = false;
+			} else if (
+				prev == Token_Kind::kw_END && ! names.empty() &&
+				id == names.back()
+			) {
+				names.pop_back();
+				if (names.empty()) {
+					end = tok.raw().data();
+					return true;
+				}
+			} else if (auto got { scope_.lookup(id) }) {
+				if (! add_dependency(fingerprint, got)) { return false; }
+			}
+		}
+		prev = tok.kind();
+	}
+	return false;
+}
+
+// the body is checked and generated once the whole procedure is parsed;
+// with a cache the text of an unchanged procedure is copied and its
+// body skipped
 Procedure::Ptr Parser::parse_procedure_declaration(
 	Scoping_Declaration::Ptr parent
 ) {
-	auto name { parse_procedure_heading() };
-	auto decl { Procedure::create(name, parent) };
-	Pushed_Scope pushed { decl };
+	Fingerprint fingerprint;
+	const char *end { nullptr };
+	auto cached { cache_ && scan_procedure(fingerprint, end) };
+	bool inline_hint;
+	auto name { parse_procedure_heading(inline_hint) };
+	auto decl { Procedure::create(arena_, name, parent) };
+	if (! scope_.insert(decl)) {
+		throw Error { name.str() + " already defined" };
+	}
+	Arena_Scope locals { procedure_arena_ };
+	Pushed_Scope pushed { scope_ };
+	auto was_in_procedure { in_procedure_ };
+	in_procedure_ = true;
 	if (tok_.is(Token_Kind::l_paren)) {
 		parse_formal_parameters(decl);
 	}
 	consume(Token_Kind::semicolon);
 
-	gen_.reset();
-	std::string def { "define " + get_ir_type(decl->returns()) + " @" };
-	def += parent->mangle(decl->name()) + "(";
-	int j { 0 };
-	for (
-		auto i { decl->args_begin() }, e { decl->args_end() };
-		i != e; ++i, ++j
-	) {
-		if (j) { def += ", "; }
-		auto r { Reference::create(gen_.next_id(), (**i).type()) };
-		def += get_ir_type(r->type()) + " " + r->name();
-		(**i).set_ref(r);
-	}
-	def += ") {";
-	gen_.append_raw(def);
-	gen_.def_label("entry");
-	parse_procedure_body(decl);
-	gen_.append_raw("}");
-	expect(Token_Kind::identifier);
-	if (name != tok_.identifier()) {
-		throw Error {
-			"PROCEDURE '" + name + "' ends with name '" +
-			tok_.identifier() + "'"
-		};
+	auto mangled { parent->mangle(name) };
+	if (cached) { fingerprint.add(mangled); }
+	if (cached && cache_->reuse(mangled, fingerprint.value())) {
+		while (tok_.raw().data() != end) { advance(); }
+	} else {
+		if (cached) { cache_->begin(); }
+		Body body;
+		parse_procedure_body(decl, body);
+		expect(Token_Kind::identifier);
+		if (name != tok_.identifier()) {
+			throw Error {
+				"PROCEDURE '" + name.str() + "' ends with name '" +
+				tok_.identifier().str() + "'"
+			};
+		}
+		Checker { ast_ }.body(body, decl);
+		Ast_Gen { ast_, gen_, pool_, procedure_arena_ }.procedure(
+			decl, inline_hint, body
+		);
+		ast_.clear();
+		if (cached) { cache_->store(mangled, fingerprint.value()); }
 	}
+	if (cached) { fingerprints_[decl] = fingerprint.value(); }
 	advance();
+	in_procedure_ = was_in_procedure;
 	return decl;
 }
 
-void Parser::parse_declaration_sequence(Scoping_Declaration::Ptr parent) {
+void Parser::parse_declaration_sequence(
+	Scoping_Declaration::Ptr parent, Body &body
+) {
 	if (tok_.is(Token_Kind::kw_CONST)) {
 		advance();
 		while (tok_.is(Token_Kind::identifier)) {
 			auto name { tok_.identifier() };
 			advance();
 			consume(Token_Kind::equal);
-			auto got { parse_expression() };
-			auto lit { std::dynamic_pointer_cast<Literal>(got) };
-			if (! lit) {
+			auto expr { parse_expression() };
+			Checker checker { ast_ };
+			checker.expression(expr);
+			if (! checker.constant(expr)) {
+				throw Error { "expression is not const" };
+			}
+			auto got {
+				Ast_Gen { ast_, gen_, pool_, local_arena() }.expression(expr)
+			};
+			if (! got->is_literal()) {
 				throw Error { "expression is not const" };
 			}
-			if (! current_scope->insert(
-				Const::create(name, lit)
+			auto lit { static_cast<Literal *>(got) };
+			if (! scope_.insert(
+				Const::create(local_arena(), name, lit)
 			)) {
-				throw Error { name + " already defined" };
+				throw Error { name.str() + " already defined" };
 			}
 			consume(Token_Kind::semicolon);
 		}
@@ -861,13 +535,23 @@ void Parser::parse_declaration_sequence(Scoping_Declaration::Ptr parent) {
 	}
 	if (tok_.is(Token_Kind::kw_VAR)) {
 		advance();
+		std::vector<Variable::Ptr> vars;
 		while (! tok_.is_one_of(
 			Token_Kind::eoi, Token_Kind::kw_END,
 			Token_Kind::kw_BEGIN, Token_Kind::kw_PROCEDURE
 		)) {
-			auto vars { parse_variable_declaration() };
+			auto got { parse_variable_declaration() };
+			vars.insert(vars.end(), got.begin(), got.end());
 			consume(Token_Kind::semicolon);
 		}
+		if (in_procedure_) {
+			body.locals = std::move(vars);
+		} else {
+			// module variables are no locals of the module body and
+			// come before the procedures using them
+			Ast_Gen { ast_, gen_, pool_, arena_ }.globals(vars);
+			if (cache_) { cache_->add_globals(vars); }
+		}
 	}
 	while (tok_.is(Token_Kind::kw_PROCEDURE)) {
 		parse_procedure_declaration(parent);
@@ -878,9 +562,9 @@ void Parser::parse_declaration_sequence(Scoping_Declaration::Ptr parent) {
 Module::Ptr Parser::parse_module() {
 	consume(Token_Kind::kw_MODULE);
 	expect(Token_Kind::identifier);
-	auto mod = Module::create(tok_.identifier());
-	current_scope->insert(mod);
-	Pushed_Scope pushed { mod };
+	auto mod = Module::create(arena_, tok_.identifier());
+	scope_.insert(mod);
+	Pushed_Scope pushed { scope_ };
 
 	advance();
 	consume(Token_Kind::semicolon);
@@ -889,29 +573,26 @@ Module::Ptr Parser::parse_module() {
 		throw Error { "IMPORT not implemented" }; // TODO
 	}
 
-	parse_declaration_sequence(mod);
-
-	gen_.reset();
-	gen_.append_raw("define void @" + mod->mangle("_init") + "() {");
-	gen_.def_label("entry");
+	Body body;
+	parse_declaration_sequence(mod, body);
 	if (tok_.is(Token_Kind::kw_BEGIN)) {
 		advance();
-		parse_statement_sequence();
+		body.statements = parse_statement_sequence();
 	}
-	gen_.ret();
-	gen_.append_raw("}");
 
 	consume(Token_Kind::kw_END);
 	expect(Token_Kind::identifier);
-	if (tok_.identifier() != mod->name()) {
+	if (tok_.identifier() != mod->symbol()) {
 		throw Error {
 			"MODULE '" + mod->name() + "' ends in name '" +
-			tok_.identifier() + "'" 
+			tok_.identifier().str() + "'"
 		};
 	}
+	Checker { ast_ }.body(body, nullptr);
+	Ast_Gen { ast_, gen_, pool_, arena_ }.module(mod, body);
+	ast_.clear();
 	advance();
 	consume(Token_Kind::period);
 
 	return mod;
 };
-
@@ -1,20 +1,45 @@
 #pragma once
 
+#include "ast.h"
 #include "err.h"
+#include "fold.h"
 #include "gen.h"
 #include "lexer.h"
 #include "obj.h"
+#include "procedure_cache.h"
+#include "scope.h"
+
+#include <cstdint>
+#include <unordered_map>
 
 class Parser {
-		Lexer &lexer_;
+		Token_Source &lexer_;
 		Token tok_;
-		Gen gen_;
+		Gen &gen_;
+		Scope scope_;
+		Arena arena_;
+		Arena procedure_arena_;
+		Constant_Pool &pool_;
+		Ast ast_;
+		bool in_procedure_ { false };
+		Procedure_Cache *cache_;
+		// of the procedures of this compilation that can be cached
+		std::unordered_map<Procedure::Ptr, std::uint64_t> fingerprints_;
+
+		// values and declarations that die with the current procedure
+		Arena &local_arena() {
+			return in_procedure_ ? procedure_arena_ : arena_;
+		}
 
 		void error() {
-			throw Error { "Unexpected: '" + tok_.raw() + "'\n" };
+			throw Error {
+				"Unexpected: '" + std::string { tok_.raw() } +
+				"'\n"
+			};
 		}
 
 		void advance() { lexer_.next(tok_); }
+		Token peek(int ahead) { return lexer_.peek(ahead); }
 
 		void expect(Token_Kind k) {
 			if (tok_.kind() != k) { error(); }
@@ -24,38 +49,17 @@ class Parser {
 			expect(k); advance();
 		}
 
-		template<typename FN> Value::Ptr parse_numeric_predicate(
-			std::string cmd, FN fn,
-			Value::Ptr left, Value::Ptr right
-		);
-		template<typename FN> Value::Ptr parse_full_predicate(
-			std::string cmd, FN fn,
-			Value::Ptr left, Value::Ptr right
-		);
-		Value::Ptr parse_expression();
-		Value::Ptr parse_unary_plus(Value::Ptr left);
-		Value::Ptr parse_unary_minus(Value::Ptr left);
-		Value::Ptr parse_binary_plus(
-			Value::Ptr left, Value::Ptr right
-		);
-		Value::Ptr parse_binary_minus(
-			Value::Ptr left, Value::Ptr right
-		);
-		Value::Ptr parse_conditional_or(Value::Ptr left);
-		Value::Ptr parse_simple_expression();
-		Value::Ptr parse_binary_mul(Value::Ptr left, Value::Ptr right);
-		Value::Ptr parse_binary_int_div(
-			Value::Ptr left, Value::Ptr right
-		);
-		Value::Ptr parse_binary_mod(Value::Ptr left, Value::Ptr right);
-		Value::Ptr parse_term();
-		Value::Ptr parse_unary_not(Value::Ptr left);
-		Value::Ptr parse_factor();
+		Expr parse_expression();
+		Expr parse_simple_expression();
+		Expr parse_term();
+		Expr parse_factor();
 		Declaration::Ptr parse_designator();
-		void parse_statement();
-		void parse_statement_sequence();
+		Expr parse_argument(Variable::Ptr formal);
+		Expr parse_call(Procedure::Ptr procedure);
+		void parse_statement(std::vector<Stmt> &sequence);
+		Node_Range parse_statement_sequence();
 
-		std::vector<std::string> parse_ident_list();
+		std::vector<Symbol> parse_ident_list();
 		Declaration::Ptr parse_qual_ident();
 		std::vector<Variable::Ptr> parse_variable_declaration();
 		std::vector<Variable::Ptr> parse_parameter_declaration(
@@ -66,18 +70,30 @@ class Parser {
 			Procedure::Ptr decl
 		);
 		void parse_formal_parameters(Procedure::Ptr decl);
-		std::string parse_procedure_heading();
-		void parse_procedure_body(Procedure::Ptr decl);
+		Symbol parse_procedure_heading(bool &inline_hint);
+		void parse_procedure_body(Procedure::Ptr decl, Body &body);
+		bool add_dependency(
+			Fingerprint &fingerprint, Declaration::Ptr declaration
+		);
+		bool scan_procedure(Fingerprint &fingerprint, const char *&end);
 		Procedure::Ptr parse_procedure_declaration(
 			Scoping_Declaration::Ptr parent
 		);
 		void parse_declaration_sequence(
-			Scoping_Declaration::Ptr parent
+			Scoping_Declaration::Ptr parent, Body &body
 		);
 		Module::Ptr parse_module();
 
 	public:
-		Parser(Lexer &lexer): lexer_ { lexer } { advance(); }
+		// with a cache the pool has to be the one of the cache
+		Parser(
+			Token_Source &lexer, Gen &gen, Constant_Pool &pool,
+			Procedure_Cache *cache = nullptr
+		):
+			lexer_ { lexer }, gen_ { gen }, pool_ { pool }, cache_ { cache }
+		{
+			advance();
+		}
 
 		void parse();
 };
@@ -0,0 +1,43 @@
+#include "passes.h"
+
+namespace {
+	const Pass registered[] {
+		{ "inline", inline_calls },
+		{ "mem2reg", promote_memory_to_registers },
+		{ "tre", eliminate_tail_calls },
+		{ "sccp", propagate_constants },
+		{ "licm", move_invariants },
+		{ "gvn", number_values },
+		{ "select", flatten_conditionals },
+		{ "dce", eliminate_dead_code },
+	};
+}
+
+bool Pass_Manager::add(std::string_view name) {
+	for (const auto &pass : registered) {
+		if (name == pass.name) {
+			passes_.push_back(&pass);
+			return true;
+		}
+	}
+	return false;
+}
+
+// variables live in registers even without optimization; inlined
+// VAR parameters become local variables of the caller for mem2reg
+void Pass_Manager::add_level(int opt_level) {
+	if (opt_level >= 1) { add("inline"); }
+	add("mem2reg");
+	if (opt_level >= 1) {
+		add("tre");
+		add("sccp");
+		add("licm");
+		add("gvn");
+	}
+	add("select");
+	if (opt_level >= 1) { add("dce"); }
+}
+
+void Pass_Manager::run(Ir_Function &fn, Pass_Context &context) const {
+	for (auto pass : passes_) { pass->run(fn, context); }
+}
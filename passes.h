@@ -0,0 +1,90 @@
+#pragma once
+
+#include "ir.h"
+#include "remarks.h"
+#include "stats.h"
+
+#include <memory>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// a finished procedure of the module as the inliner sees it; the body
+// is only kept when it may be inlined
+struct Callee {
+	int cost;
+	bool recursive;
+	std::unique_ptr<Ir_Function> body;
+};
+
+constexpr int default_inline_threshold { 20 };
+
+// what passes share besides the function
+struct Pass_Context {
+	Constant_Pool &pool;
+	Stats &stats;
+	Remarks &remarks;
+	// procedures costing more are only inlined with an INLINE hint
+	int inline_threshold { default_inline_threshold };
+	std::unordered_map<std::string, Callee> callees { };
+};
+
+using Pass_Function = void (*)(Ir_Function &fn, Pass_Context &context);
+
+struct Pass {
+	const char *name;
+	Pass_Function run;
+};
+
+// the configured sequence of passes each function runs through
+class Pass_Manager {
+		std::vector<const Pass *> passes_;
+	public:
+		// adds a pass by name; false if there is no such pass
+		bool add(std::string_view name);
+
+		// the default passes of an optimization level
+		void add_level(int opt_level);
+
+		bool empty() const { return passes_.empty(); }
+
+		void run(Ir_Function &fn, Pass_Context &context) const;
+};
+
+// replaces calls of small procedures that are defined before by their
+// bodies; remember_callee records each finished procedure for it
+void inline_calls(Ir_Function &fn, Pass_Context &context);
+void remember_callee(const Ir_Function &fn, Pass_Context &context);
+
+// turns calls of the procedure itself that are returned, maybe added
+// to or multiplied by a value, into a loop
+void eliminate_tail_calls(Ir_Function &fn, Pass_Context &context);
+
+// removes unreachable blocks and unused instructions without side
+// effects
+void eliminate_dead_code(Ir_Function &fn, Pass_Context &context);
+void remove_unreachable_blocks(Ir_Function &fn);
+
+// promotes local variables to SSA values with phi nodes at the joins
+void promote_memory_to_registers(Ir_Function &fn, Pass_Context &context);
+
+// sparse conditional constant propagation; removes the branches that
+// are never taken
+void propagate_constants(Ir_Function &fn, Pass_Context &context);
+
+// removes pure instructions and loads that a dominating instruction
+// already computed
+void number_values(Ir_Function &fn, Pass_Context &context);
+
+// moves pure instructions and loads whose operands a loop does not
+// change into a preheader before the loop
+void move_invariants(Ir_Function &fn, Pass_Context &context);
+
+// implements DIV and MOD with truncating division, shifts and magic
+// numbers and multiplies by cheap constants with shifts; must run
+// last, the backends know no DIV and MOD
+void lower_arithmetic(Ir_Function &fn, Pass_Context &context);
+
+// replaces branches around a few cheap instructions that cannot trap
+// by and, or and select
+void flatten_conditionals(Ir_Function &fn, Pass_Context &context);
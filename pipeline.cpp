@@ -0,0 +1,91 @@
+#include "pipeline.h"
+
+#include "err.h"
+
+#include <algorithm>
+
+void Token_Table::reserve(size_t count) {
+	kinds_.reserve(count);
+	offsets_.reserve(count);
+	lengths_.reserve(count);
+	lines_.reserve(count);
+	symbols_.reserve(count);
+}
+
+void Token_Table::push_back(const Token &tok) {
+	kinds_.push_back(static_cast<std::uint8_t>(tok.kind_));
+	offsets_.push_back(tok.raw_.data() ? tok.raw_.data() - source_ : 0);
+	lengths_.push_back(tok.raw_.size());
+	lines_.push_back(tok.line_);
+	symbols_.push_back(tok.symbol_);
+}
+
+Token Token_Table::operator[](size_t index) const {
+	Token tok;
+	tok.kind_ = static_cast<Token_Kind>(kinds_[index]);
+	tok.raw_ = { source_ + offsets_[index], lengths_[index] };
+	tok.line_ = lines_[index];
+	tok.symbol_ = symbols_[index];
+	return tok;
+}
+
+Pipelined_Lexer::Pipelined_Lexer(const Source &source):
+	lexer_ { source }, table_ { source.begin() }
+{
+	// a token every few bytes is a good guess for Oberon sources
+	table_.reserve((source.end() - source.begin()) / 4 + 1);
+	producer_ = std::thread { &Pipelined_Lexer::produce, this };
+}
+
+Pipelined_Lexer::~Pipelined_Lexer() {
+	stop_ = true;
+	producer_.join();
+}
+
+void Pipelined_Lexer::produce() {
+	Token tok;
+	do {
+		try {
+			lexer_.next(tok);
+		} catch (const Error &e) {
+			error_ = e.what();
+			error_line_ = e.line();
+			failed_ = true;
+			tok = Token { };
+		}
+		while (! queue_.push(tok)) {
+			if (stop_) { return; }
+			std::this_thread::yield();
+		}
+	} while (! tok.is(Token_Kind::eoi));
+}
+
+void Pipelined_Lexer::fetch(size_t count) {
+	Token tok;
+	while (table_.size() < count && ! done_) {
+		if (! queue_.pop(tok)) {
+			std::this_thread::yield(); continue;
+		}
+		table_.push_back(tok);
+		if (tok.is(Token_Kind::eoi)) {
+			done_ = true;
+			if (failed_) { error_index_ = table_.size() - 1; }
+		}
+	}
+}
+
+void Pipelined_Lexer::next(Token &tok) {
+	fetch(next_ + 1);
+	if (next_ >= error_index_) { throw Error { error_, error_line_ }; }
+	if (next_ < table_.size()) {
+		tok = table_[next_++];
+	} else {
+		tok = table_[table_.size() - 1];
+	}
+}
+
+Token Pipelined_Lexer::peek(int ahead) {
+	auto index { next_ + ahead - 1 };
+	fetch(index + 1);
+	return table_[std::min(index, table_.size() - 1)];
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "lexer.h"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+#include <thread>
+#include <vector>
+
+// bounded lock-free queue for exactly one producer and one consumer
+template<typename T, size_t N> class Spsc_Queue {
+		static_assert((N & (N - 1)) == 0, "capacity must be power of 2");
+		T slots_[N];
+		alignas(64) std::atomic<size_t> head_ { 0 };
+		alignas(64) std::atomic<size_t> tail_ { 0 };
+	public:
+		bool push(const T &value) {
+			auto tail { tail_.load(std::memory_order_relaxed) };
+			if (tail - head_.load(std::memory_order_acquire) == N) {
+				return false;
+			}
+			slots_[tail & (N - 1)] = value;
+			tail_.store(tail + 1, std::memory_order_release);
+			return true;
+		}
+		bool pop(T &value) {
+			auto head { head_.load(std::memory_order_relaxed) };
+			if (head == tail_.load(std::memory_order_acquire)) {
+				return false;
+			}
+			value = slots_[head & (N - 1)];
+			head_.store(head + 1, std::memory_order_release);
+			return true;
+		}
+};
+
+// all tokens of one source as struct of arrays
+class Token_Table {
+		const char *source_;
+		std::vector<std::uint8_t> kinds_;
+		std::vector<std::uint32_t> offsets_;
+		std::vector<std::uint32_t> lengths_;
+		std::vector<int> lines_;
+		std::vector<Symbol> symbols_;
+	public:
+		Token_Table(const char *source): source_ { source } { }
+
+		size_t size() const { return kinds_.size(); }
+		void reserve(size_t count);
+		void push_back(const Token &tok);
+		Token operator[](size_t index) const;
+};
+
+// lexes the whole source on a background thread while the parser
+// consumes the tokens
+class Pipelined_Lexer: public Token_Source {
+		Lexer lexer_;
+		Token_Table table_;
+		Spsc_Queue<Token, 4096> queue_;
+		std::atomic<bool> stop_ { false };
+		std::atomic<bool> failed_ { false };
+		std::string error_;
+		int error_line_ { 0 };
+		size_t error_index_ { SIZE_MAX };
+		size_t next_ { 0 };
+		bool done_ { false };
+		std::thread producer_;
+
+		void produce();
+		void fetch(size_t count);
+	public:
+		Pipelined_Lexer(const Source &source);
+		~Pipelined_Lexer();
+
+		void next(Token &tok) override;
+		Token peek(int ahead) override;
+
+		const Token_Table &table() const { return table_; }
+};
@@ -0,0 +1,50 @@
+#include "pool.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+
+std::string Bool_Trait::spell(bool value) {
+	return value ? "true" : "false";
+}
+
+std::string Integer_Trait::spell(int value) {
+	return std::to_string(value);
+}
+
+// LLVM only accepts decimal REALs that are exact; the hex form always is
+std::string Real_Trait::spell(double value) {
+	std::uint64_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	char buffer[24];
+	std::snprintf(buffer, sizeof(buffer), "0x%016" PRIX64, bits);
+	return buffer;
+}
+
+template<typename TRAIT> Concrete_Literal<TRAIT> *Constant_Pool::intern(
+	typename TRAIT::base_type value, std::uint64_t bits
+) {
+	auto &got { literals_[{ TRAIT::value_kind, bits }] };
+	if (! got) { got = Concrete_Literal<TRAIT>::create(arena_, value); }
+	return static_cast<Concrete_Literal<TRAIT> *>(got);
+}
+
+Bool_Literal::Ptr Constant_Pool::get(bool value) {
+	return intern<Bool_Trait>(value, value);
+}
+
+Integer_Literal::Ptr Constant_Pool::get(int value) {
+	return intern<Integer_Trait>(value, static_cast<std::uint32_t>(value));
+}
+
+Real_Literal::Ptr Constant_Pool::get(double value) {
+	std::uint64_t bits;
+	std::memcpy(&bits, &value, sizeof(bits));
+	return intern<Real_Trait>(value, bits);
+}
+
+Literal::Ptr Constant_Pool::number(Type::Ptr type, int n) {
+	if (type == real_type) { return get(static_cast<double>(n)); }
+	if (type == boolean_type) { return get(n != 0); }
+	return get(n);
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "value.h"
+
+#include <cstdint>
+#include <unordered_map>
+
+// one shared literal per (type, bits); literals from the pool can be
+// compared by pointer
+class Constant_Pool {
+		struct Key {
+			Value_Kind kind;
+			std::uint64_t bits;
+			bool operator==(const Key &other) const {
+				return kind == other.kind && bits == other.bits;
+			}
+		};
+		struct Key_Hash {
+			size_t operator()(const Key &key) const {
+				return (key.bits * 0x9e3779b97f4a7c15ull) ^
+					static_cast<size_t>(key.kind);
+			}
+		};
+
+		Arena arena_;
+		std::unordered_map<Key, Literal::Ptr, Key_Hash> literals_;
+
+		template<typename TRAIT> Concrete_Literal<TRAIT> *intern(
+			typename TRAIT::base_type value, std::uint64_t bits
+		);
+	public:
+		Bool_Literal::Ptr get(bool value);
+		Integer_Literal::Ptr get(int value);
+		Real_Literal::Ptr get(double value);
+
+		// the literal n of an INTEGER or REAL type, or FALSE/TRUE
+		Literal::Ptr number(Type::Ptr type, int n);
+
+		size_t size() const { return literals_.size(); }
+};
@@ -0,0 +1,137 @@
+#include "procedure_cache.h"
+
+#include <unordered_set>
+
+void Procedure_Cache::start(Output &out, Pass_Context &context) {
+	out_ = &out;
+	context_ = &context;
+	open_.clear();
+	globals_.clear();
+	reused_ = generated_ = 0;
+	for (auto &[name, entry] : entries_) { entry.used = false; }
+}
+
+void Procedure_Cache::add_globals(
+	const std::vector<Variable::Ptr> &variables
+) {
+	for (auto var : variables) { globals_[var->ref()->index()] = var->ref(); }
+}
+
+bool Procedure_Cache::reuse(
+	const std::string &name, std::uint64_t fingerprint
+) {
+	auto got { entries_.find(name) };
+	if (got == entries_.end() || got->second.fingerprint != fingerprint) {
+		return false;
+	}
+	auto &entry { got->second };
+	for (auto global : entry.globals) {
+		if (! globals_.count(global->index())) { return false; }
+	}
+	*out_ << entry.text;
+	if (! open_.empty()) { open_.back().nested.push_back(name); }
+	auto &callee { context_->callees[name] };
+	callee.cost = entry.cost;
+	callee.recursive = entry.recursive;
+	callee.body = entry.body ? attach(entry) : nullptr;
+	use(entry);
+	++reused_;
+	return true;
+}
+
+void Procedure_Cache::use(Entry &entry) {
+	entry.used = true;
+	for (const auto &name : entry.nested) { use(entries_.at(name)); }
+}
+
+void Procedure_Cache::begin() {
+	open_.push_back({ out_->contents().size(), { } });
+}
+
+void Procedure_Cache::store(
+	const std::string &name, std::uint64_t fingerprint
+) {
+	auto open { std::move(open_.back()) };
+	open_.pop_back();
+	if (! open_.empty()) { open_.back().nested.push_back(name); }
+	Entry entry { };
+	entry.fingerprint = fingerprint;
+	entry.text = out_->contents().substr(open.start);
+	entry.nested = std::move(open.nested);
+	auto &callee { context_->callees.at(name) };
+	entry.cost = callee.cost;
+	entry.recursive = callee.recursive;
+	if (callee.body) { detach(*callee.body, entry); }
+	entry.used = true;
+	entries_[name] = std::move(entry);
+	++generated_;
+}
+
+void Procedure_Cache::finish() {
+	for (auto i { entries_.begin() }; i != entries_.end(); ) {
+		i = i->second.used ? std::next(i) : entries_.erase(i);
+	}
+}
+
+// the references that no instruction defines and that are no parameter
+// are module variables; they are replaced by ones of the entry and
+// bound to the variables of the same index again by attach
+void Procedure_Cache::detach(const Ir_Function &fn, Entry &entry) {
+	std::vector<Parameter> params;
+	for (const auto &param : fn.params()) {
+		params.push_back({
+			Reference::create(
+				references_, param.ref->index(), param.ref->type()
+			),
+			param.by_reference
+		});
+	}
+	entry.body = std::make_unique<Ir_Function>(
+		fn.name(), fn.returns(), params, fn.inline_hint()
+	);
+	Ir_Copier copier { *entry.body };
+	std::unordered_set<Value::Ptr> defined;
+	for (size_t i { 0 }; i < params.size(); ++i) {
+		copier.map(fn.params()[i].ref, params[i].ref);
+		defined.insert(fn.params()[i].ref);
+	}
+	for (auto block : fn.blocks) {
+		for (auto inst : block->instructions) {
+			if (inst->result) { defined.insert(inst->result); }
+		}
+	}
+	for (auto block : fn.blocks) {
+		for (auto inst : block->instructions) {
+			for (auto op : inst->operands) {
+				auto ref { value_cast<Reference>(op) };
+				if (! ref || ! defined.insert(ref).second) { continue; }
+				auto global { Reference::create(
+					references_, ref->index(), ref->type()
+				) };
+				copier.map(ref, global);
+				entry.globals.push_back(global);
+			}
+		}
+	}
+	entry.body->blocks = copier.copy(
+		fn, fn.blocks.front()->label().prefix, 0
+	);
+}
+
+std::unique_ptr<Ir_Function> Procedure_Cache::attach(
+	const Entry &entry
+) const {
+	const auto &stored { *entry.body };
+	auto body { std::make_unique<Ir_Function>(
+		stored.name(), stored.returns(), stored.params(),
+		stored.inline_hint()
+	) };
+	Ir_Copier copier { *body };
+	for (auto global : entry.globals) {
+		copier.map(global, globals_.at(global->index()));
+	}
+	body->blocks = copier.copy(
+		stored, stored.blocks.front()->label().prefix, 0
+	);
+	return body;
+}
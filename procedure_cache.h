@@ -0,0 +1,92 @@
+#pragma once
+
+#include "obj.h"
+#include "output.h"
+#include "passes.h"
+#include "pool.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+// FNV-1a hash of what the code of a procedure depends on
+class Fingerprint {
+		std::uint64_t value_ { 0xcbf29ce484222325ull };
+
+		void add_byte(unsigned char byte) {
+			value_ = (value_ ^ byte) * 0x100000001b3ull;
+		}
+	public:
+		void add(std::uint64_t number) {
+			for (int i { 0 }; i < 8; ++i) { add_byte(number >> (8 * i)); }
+		}
+		void add(std::string_view bytes) {
+			for (unsigned char byte : bytes) { add_byte(byte); }
+			add(static_cast<std::uint64_t>(bytes.size()));
+		}
+		std::uint64_t value() const { return value_; }
+};
+
+// keeps the generated text and the inliner record of each procedure
+// between compilations of the same module; a procedure whose
+// fingerprint did not change is copied instead of parsed again
+class Procedure_Cache {
+		struct Entry {
+			std::uint64_t fingerprint;
+			std::string text;
+			int cost;
+			bool recursive;
+			// the inliner's body; its parameters and the module
+			// variables it uses are references of the cache, so that it
+			// survives the compilation
+			std::unique_ptr<Ir_Function> body;
+			std::vector<Reference::Ptr> globals;
+			// the nested procedures, which are reused with it
+			std::vector<std::string> nested;
+			bool used;
+		};
+		struct Open {
+			size_t start;
+			std::vector<std::string> nested;
+		};
+
+		// cached bodies share their literals with all compilations
+		Constant_Pool pool_;
+		// the few references of dropped entries stay until the end
+		Arena references_;
+		std::unordered_map<std::string, Entry> entries_;
+		Output *out_ { nullptr };
+		Pass_Context *context_ { nullptr };
+		std::vector<Open> open_;
+		std::unordered_map<int, Reference::Ptr> globals_;
+		int reused_ { 0 };
+		int generated_ { 0 };
+
+		void use(Entry &entry);
+		void detach(const Ir_Function &fn, Entry &entry);
+		std::unique_ptr<Ir_Function> attach(const Entry &entry) const;
+	public:
+		Constant_Pool &pool() { return pool_; }
+
+		// a compilation writing its text to out begins
+		void start(Output &out, Pass_Context &context);
+		void add_globals(const std::vector<Variable::Ptr> &variables);
+
+		// writes the text of the procedure if its fingerprint is known;
+		// false if it has to be generated
+		bool reuse(const std::string &name, std::uint64_t fingerprint);
+
+		// brackets the generation of a procedure; nested procedures are
+		// stored before the one containing them
+		void begin();
+		void store(const std::string &name, std::uint64_t fingerprint);
+
+		// forgets the procedures the finished compilation did not have
+		void finish();
+
+		int reused() const { return reused_; }
+		int generated() const { return generated_; }
+};
@@ -0,0 +1,35 @@
+#pragma once
+
+#include <ostream>
+#include <set>
+#include <string>
+#include <vector>
+
+// optimization remarks of the passes selected with -Rpass=<pass> and
+// -Rpass-missed=<pass>, kept per module and printed after it
+class Remarks {
+		std::set<std::string> passed_;
+		std::set<std::string> missed_;
+		std::vector<std::string> lines_;
+	public:
+		void enable(const std::string &pass, bool missed) {
+			(missed ? missed_ : passed_).insert(pass);
+		}
+		bool wanted(const std::string &pass, bool missed) const {
+			return (missed ? missed_ : passed_).count(pass);
+		}
+		void add(
+			const std::string &pass, bool missed, const std::string &message
+		) {
+			if (! wanted(pass, missed)) { return; }
+			lines_.push_back(
+				message + (missed ? " [-Rpass-missed=" : " [-Rpass=") +
+				pass + "]"
+			);
+		}
+		void print(std::ostream &out, const std::string &file) const {
+			for (const auto &line : lines_) {
+				out << file << ": remark: " << line << '\n';
+			}
+		}
+};
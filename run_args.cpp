@@ -0,0 +1,55 @@
+#include "run_args.h"
+
+#include "err.h"
+
+#include <charconv>
+
+using Value_Class = Object_Code::Value_Class;
+
+Value_Class value_class(Type::Ptr type) {
+	if (! type) { return Value_Class::none; }
+	if (type == real_type) { return Value_Class::real; }
+	if (type == boolean_type) { return Value_Class::boolean; }
+	return Value_Class::integer;
+}
+
+std::int64_t parse_int_arg(Value_Class cls, const std::string &arg) {
+	if (cls == Value_Class::boolean) {
+		if (arg == "TRUE") { return 1; }
+		if (arg == "FALSE") { return 0; }
+		throw Error { "no BOOLEAN: '" + arg + "'" };
+	}
+	int value;
+	auto end { arg.data() + arg.size() };
+	auto got { std::from_chars(arg.data(), end, value) };
+	if (got.ec != std::errc { } || got.ptr != end) {
+		throw Error { "no INTEGER: '" + arg + "'" };
+	}
+	return value;
+}
+
+double parse_real_arg(const std::string &arg) {
+	double value;
+	auto end { arg.data() + arg.size() };
+	auto got { std::from_chars(arg.data(), end, value) };
+	if (got.ec != std::errc { } || got.ptr != end) {
+		throw Error { "no REAL: '" + arg + "'" };
+	}
+	return value;
+}
+
+std::string print_result(Value_Class cls, std::int64_t integer, double real) {
+	switch (cls) {
+		case Value_Class::none:
+			return { };
+		case Value_Class::real: {
+			char digits[32];
+			auto end { std::to_chars(digits, digits + sizeof(digits), real) };
+			return { digits, end.ptr };
+		}
+		case Value_Class::boolean:
+			return integer & 1 ? "TRUE" : "FALSE";
+		default:
+			return std::to_string(static_cast<std::int32_t>(integer));
+	}
+}
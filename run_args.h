@@ -0,0 +1,24 @@
+#pragma once
+
+#include "object_file.h"
+#include "type.h"
+
+#include <cstdint>
+#include <string>
+
+// the arguments of --run are INTEGER, REAL or BOOLEAN literals; the
+// results are printed the same way
+
+// how a value of the type is passed; nullptr for no value
+Object_Code::Value_Class value_class(Type::Ptr type);
+
+// the bits of an INTEGER or BOOLEAN argument
+std::int64_t parse_int_arg(
+	Object_Code::Value_Class cls, const std::string &arg
+);
+double parse_real_arg(const std::string &arg);
+
+// empty for proper procedures
+std::string print_result(
+	Object_Code::Value_Class cls, std::int64_t integer, double real
+);
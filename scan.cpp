@@ -0,0 +1,233 @@
+#include "scan.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+	#include <immintrin.h>
+	#define SCAN_X86 1
+#endif
+
+namespace {
+	inline bool is_whitespace(char c) {
+		return c == ' ' || c == '\t' || c == '\f' || c == '\v' ||
+			c == '\r' || c == '\n';
+	}
+
+	const char *whitespace_scalar(
+		const char *cur, const char *end, int &lines
+	) {
+		for (; cur < end && is_whitespace(*cur); ++cur) {
+			if (*cur == '\n') { ++lines; }
+		}
+		return cur;
+	}
+
+	// returns the next '(' or '*' in [cur, end) or end; only these
+	// can start the "(*" and "*)" pairs that change the nesting
+	const char *special_scalar(
+		const char *cur, const char *end, int &lines
+	) {
+		for (; cur < end; ++cur) {
+			switch (*cur) {
+				case '(': case '*': return cur;
+				case '\n': ++lines; break;
+				default: break;
+			}
+		}
+		return cur;
+	}
+
+	#if SCAN_X86
+		// mask has one bit per byte; count the newlines before bit idx
+		inline int newlines_before(unsigned nl, unsigned idx) {
+			return __builtin_popcount(nl & ((1u << idx) - 1u));
+		}
+
+		const char *whitespace_sse2(
+			const char *cur, const char *end, int &lines
+		) {
+			const auto space { _mm_set1_epi8(' ') };
+			const auto nl { _mm_set1_epi8('\n') };
+			const auto tab { _mm_set1_epi8('\t') };
+			const auto cr { _mm_set1_epi8('\r') };
+			const auto ff { _mm_set1_epi8('\f') };
+			const auto vt { _mm_set1_epi8('\v') };
+			for (; end - cur >= 16; cur += 16) {
+				auto v { _mm_loadu_si128(
+					reinterpret_cast<const __m128i *>(cur)
+				) };
+				auto nls { _mm_cmpeq_epi8(v, nl) };
+				auto ws { _mm_or_si128(
+					_mm_or_si128(
+						_mm_cmpeq_epi8(v, space), nls
+					),
+					_mm_or_si128(
+						_mm_or_si128(
+							_mm_cmpeq_epi8(v, tab),
+							_mm_cmpeq_epi8(v, cr)
+						),
+						_mm_or_si128(
+							_mm_cmpeq_epi8(v, ff),
+							_mm_cmpeq_epi8(v, vt)
+						)
+					)
+				) };
+				unsigned nl_mask = _mm_movemask_epi8(nls);
+				unsigned other = ~_mm_movemask_epi8(ws) & 0xffffu;
+				if (other) {
+					unsigned idx = __builtin_ctz(other);
+					lines += newlines_before(nl_mask, idx);
+					return cur + idx;
+				}
+				lines += __builtin_popcount(nl_mask);
+			}
+			return whitespace_scalar(cur, end, lines);
+		}
+
+		const char *special_sse2(
+			const char *cur, const char *end, int &lines
+		) {
+			const auto nl { _mm_set1_epi8('\n') };
+			const auto open { _mm_set1_epi8('(') };
+			const auto star { _mm_set1_epi8('*') };
+			for (; end - cur >= 16; cur += 16) {
+				auto v { _mm_loadu_si128(
+					reinterpret_cast<const __m128i *>(cur)
+				) };
+				unsigned nl_mask = _mm_movemask_epi8(
+					_mm_cmpeq_epi8(v, nl)
+				);
+				unsigned special = _mm_movemask_epi8(_mm_or_si128(
+					_mm_cmpeq_epi8(v, open),
+					_mm_cmpeq_epi8(v, star)
+				));
+				if (special) {
+					unsigned idx = __builtin_ctz(special);
+					lines += newlines_before(nl_mask, idx);
+					return cur + idx;
+				}
+				lines += __builtin_popcount(nl_mask);
+			}
+			return special_scalar(cur, end, lines);
+		}
+
+		__attribute__((target("avx2")))
+		const char *whitespace_avx2(
+			const char *cur, const char *end, int &lines
+		) {
+			const auto space { _mm256_set1_epi8(' ') };
+			const auto nl { _mm256_set1_epi8('\n') };
+			const auto tab { _mm256_set1_epi8('\t') };
+			const auto cr { _mm256_set1_epi8('\r') };
+			const auto ff { _mm256_set1_epi8('\f') };
+			const auto vt { _mm256_set1_epi8('\v') };
+			for (; end - cur >= 32; cur += 32) {
+				auto v { _mm256_loadu_si256(
+					reinterpret_cast<const __m256i *>(cur)
+				) };
+				auto nls { _mm256_cmpeq_epi8(v, nl) };
+				auto ws { _mm256_or_si256(
+					_mm256_or_si256(
+						_mm256_cmpeq_epi8(v, space), nls
+					),
+					_mm256_or_si256(
+						_mm256_or_si256(
+							_mm256_cmpeq_epi8(v, tab),
+							_mm256_cmpeq_epi8(v, cr)
+						),
+						_mm256_or_si256(
+							_mm256_cmpeq_epi8(v, ff),
+							_mm256_cmpeq_epi8(v, vt)
+						)
+					)
+				) };
+				unsigned nl_mask = _mm256_movemask_epi8(nls);
+				unsigned other = ~_mm256_movemask_epi8(ws);
+				if (other) {
+					unsigned idx = __builtin_ctz(other);
+					lines += newlines_before(nl_mask, idx);
+					return cur + idx;
+				}
+				lines += __builtin_popcount(nl_mask);
+			}
+			return whitespace_sse2(cur, end, lines);
+		}
+
+		__attribute__((target("avx2")))
+		const char *special_avx2(
+			const char *cur, const char *end, int &lines
+		) {
+			const auto nl { _mm256_set1_epi8('\n') };
+			const auto open { _mm256_set1_epi8('(') };
+			const auto star { _mm256_set1_epi8('*') };
+			for (; end - cur >= 32; cur += 32) {
+				auto v { _mm256_loadu_si256(
+					reinterpret_cast<const __m256i *>(cur)
+				) };
+				unsigned nl_mask = _mm256_movemask_epi8(
+					_mm256_cmpeq_epi8(v, nl)
+				);
+				unsigned special = _mm256_movemask_epi8(
+					_mm256_or_si256(
+						_mm256_cmpeq_epi8(v, open),
+						_mm256_cmpeq_epi8(v, star)
+					)
+				);
+				if (special) {
+					unsigned idx = __builtin_ctz(special);
+					lines += newlines_before(nl_mask, idx);
+					return cur + idx;
+				}
+				lines += __builtin_popcount(nl_mask);
+			}
+			return special_sse2(cur, end, lines);
+		}
+	#endif
+
+	using Kernel = const char *(*)(const char *, const char *, int &);
+
+	struct Kernels {
+		const char *name;
+		Kernel whitespace;
+		Kernel special;
+	};
+
+	Kernels select_kernels() {
+		#if SCAN_X86
+			__builtin_cpu_init();
+			if (__builtin_cpu_supports("avx2")) {
+				return { "avx2", whitespace_avx2, special_avx2 };
+			}
+			if (__builtin_cpu_supports("sse2")) {
+				return { "sse2", whitespace_sse2, special_sse2 };
+			}
+		#endif
+		return { "scalar", whitespace_scalar, special_scalar };
+	}
+
+	const Kernels kernels { select_kernels() };
+}
+
+const char *Scan::skip_whitespace(
+	const char *cur, const char *end, int &lines
+) {
+	// most runs are a single blank or a few tabs of indentation
+	if (cur < end && ! is_whitespace(*cur)) { return cur; }
+	return kernels.whitespace(cur, end, lines);
+}
+
+const char *Scan::skip_comment(
+	const char *cur, const char *end, int &lines, int &nesting
+) {
+	while (nesting) {
+		cur = kernels.special(cur, end, lines);
+		if (cur >= end) { break; }
+		if (end - cur < 2) { ++cur; continue; }
+		if (cur[0] == '(' && cur[1] == '*') {
+			++nesting; cur += 2;
+		} else if (cur[0] == '*' && cur[1] == ')') {
+			--nesting; cur += 2;
+		} else { ++cur; }
+	}
+	return cur;
+}
+
+const char *Scan::kernel_name() { return kernels.name; }
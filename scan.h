@@ -0,0 +1,18 @@
+#pragma once
+
+namespace Scan {
+	// returns the first non-whitespace character in [cur, end) and
+	// adds the skipped newlines to lines
+	const char *skip_whitespace(
+		const char *cur, const char *end, int &lines
+	);
+
+	// cur points behind an opening "(*"; returns the position behind
+	// the comment or end, if nesting did not drop to 0
+	const char *skip_comment(
+		const char *cur, const char *end, int &lines, int &nesting
+	);
+
+	// name of the kernel set selected for this CPU
+	const char *kernel_name();
+}
@@ -0,0 +1,256 @@
+#include "passes.h"
+
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+#include <unordered_set>
+
+// sparse conditional constant propagation after Wegman and Zadeck:
+// values start unknown and only blocks reached by executable edges
+// are evaluated, so constants flow through phis of loops and into
+// branch conditions
+namespace {
+	struct Cell {
+		enum State { unknown, constant, varying } state { unknown };
+		Literal::Ptr value { nullptr };
+	};
+
+	class Propagator {
+			using Edge = std::pair<Ir_Block::Ptr, Ir_Block::Ptr>;
+
+			Ir_Function &fn_;
+			Constant_Pool &pool_;
+			Stats &stats_;
+			std::unordered_map<Value::Ptr, Cell> cells_;
+			std::unordered_map<Value::Ptr, std::vector<Ir_Instruction *>>
+				users_;
+			std::unordered_map<Ir_Instruction *, Ir_Block::Ptr> owner_;
+			std::unordered_set<Ir_Block::Ptr> reached_;
+			std::set<Edge> edges_;
+			std::vector<Edge> flow_work_;
+			std::vector<Value::Ptr> value_work_;
+
+			Cell cell(Value::Ptr value);
+			void update(Value::Ptr value, const Cell &got);
+			void mark_edge(Ir_Block::Ptr from, Ir_Block::Ptr to);
+			Cell evaluate(Ir_Instruction *inst);
+			void visit(Ir_Instruction *inst);
+			void rewrite();
+		public:
+			Propagator(Ir_Function &fn, Pass_Context &context);
+			void run();
+	};
+
+	Cell meet(const Cell &a, const Cell &b) {
+		if (a.state == Cell::unknown) { return b; }
+		if (b.state == Cell::unknown) { return a; }
+		if (
+			a.state == Cell::constant && b.state == Cell::constant &&
+			a.value == b.value
+		) {
+			return a;
+		}
+		return { Cell::varying };
+	}
+
+	Cell constant(Value::Ptr value) {
+		if (value && value->is_literal()) {
+			return { Cell::constant, static_cast<Literal *>(value) };
+		}
+		return { Cell::varying };
+	}
+
+	bool is_zero(Literal::Ptr value) {
+		auto i { value_cast<Integer_Literal>(value) };
+		return i && i->value() == 0;
+	}
+}
+
+Propagator::Propagator(Ir_Function &fn, Pass_Context &context):
+	fn_ { fn }, pool_ { context.pool }, stats_ { context.stats }
+{
+	for (const auto &param : fn.params()) {
+		cells_[param.ref] = { Cell::varying };
+	}
+	for (auto block : fn.blocks) {
+		for (auto inst : block->instructions) {
+			owner_[inst] = block;
+			for (auto op : inst->operands) {
+				if (! op->is_literal()) { users_[op].push_back(inst); }
+			}
+		}
+	}
+}
+
+Cell Propagator::cell(Value::Ptr value) {
+	if (value->is_literal()) {
+		return { Cell::constant, static_cast<Literal *>(value) };
+	}
+	return cells_[value];
+}
+
+// cells only move down the lattice
+void Propagator::update(Value::Ptr value, const Cell &got) {
+	auto &old { cells_[value] };
+	auto merged { old.state == Cell::unknown ? got : meet(old, got) };
+	if (merged.state == old.state && merged.value == old.value) { return; }
+	old = merged;
+	value_work_.push_back(value);
+}
+
+void Propagator::mark_edge(Ir_Block::Ptr from, Ir_Block::Ptr to) {
+	if (edges_.insert({ from, to }).second) {
+		flow_work_.push_back({ from, to });
+	}
+}
+
+Cell Propagator::evaluate(Ir_Instruction *inst) {
+	auto &ops { inst->operands };
+	switch (inst->opcode) {
+		case Opcode::unary: {
+			auto v { cell(ops[0]) };
+			if (v.state != Cell::constant) { return v; }
+			return constant(fold(pool_, inst->unary_op, v.value));
+		}
+		case Opcode::binary: {
+			auto l { cell(ops[0]) };
+			auto r { cell(ops[1]) };
+			if (l.state == Cell::unknown || r.state == Cell::unknown) {
+				return { };
+			}
+			auto op { inst->binary_op };
+			if (
+				can_trap(op) && r.state == Cell::constant &&
+				is_zero(r.value)
+			) {
+				return { Cell::varying };
+			}
+			// an absorbing operand decides even with a varying one
+			return constant(fold(
+				pool_, op,
+				l.state == Cell::constant ? l.value : ops[0],
+				r.state == Cell::constant ? r.value : ops[1]
+			));
+		}
+		case Opcode::select: {
+			auto c { cell(ops[0]) };
+			if (c.state == Cell::constant) {
+				auto b { value_cast<Bool_Literal>(c.value) };
+				return cell(b->value() ? ops[1] : ops[2]);
+			}
+			if (c.state == Cell::unknown) { return { }; }
+			return meet(cell(ops[1]), cell(ops[2]));
+		}
+		case Opcode::phi: {
+			Cell result;
+			auto block { owner_.at(inst) };
+			for (size_t i { 0 }; i < ops.size(); ++i) {
+				if (edges_.count({ inst->incoming[i], block })) {
+					result = meet(result, cell(ops[i]));
+				}
+			}
+			return result;
+		}
+		default:
+			return { Cell::varying };
+	}
+}
+
+void Propagator::visit(Ir_Instruction *inst) {
+	auto block { owner_.at(inst) };
+	if (! reached_.count(block)) { return; }
+	switch (inst->opcode) {
+		case Opcode::branch:
+			mark_edge(block, inst->targets[0]);
+			break;
+		case Opcode::conditional: {
+			auto c { cell(inst->operands[0]) };
+			if (c.state == Cell::constant) {
+				auto taken { value_cast<Bool_Literal>(c.value)->value() };
+				mark_edge(block, inst->targets[taken ? 0 : 1]);
+			} else if (c.state == Cell::varying) {
+				mark_edge(block, inst->targets[0]);
+				mark_edge(block, inst->targets[1]);
+			}
+			break;
+		}
+		case Opcode::ret:
+		case Opcode::store:
+			break;
+		default:
+			if (inst->result) { update(inst->result, evaluate(inst)); }
+	}
+}
+
+void Propagator::run() {
+	auto entry { fn_.blocks.front() };
+	reached_.insert(entry);
+	for (auto inst : entry->instructions) { visit(inst); }
+	while (! flow_work_.empty() || ! value_work_.empty()) {
+		while (! flow_work_.empty()) {
+			auto [from, to] { flow_work_.back() };
+			flow_work_.pop_back();
+			bool first { reached_.insert(to).second };
+			for (auto inst : to->instructions) {
+				if (first || inst->opcode == Opcode::phi) { visit(inst); }
+			}
+		}
+		while (! value_work_.empty()) {
+			auto value { value_work_.back() };
+			value_work_.pop_back();
+			for (auto user : users_[value]) { visit(user); }
+		}
+	}
+	rewrite();
+}
+
+// constants replace their uses, decided branches become jumps and
+// edges that are never taken leave the phis
+void Propagator::rewrite() {
+	auto replace { [&](Value::Ptr value) -> Value::Ptr {
+		if (value->is_literal()) { return value; }
+		auto got { cells_.find(value) };
+		return got != cells_.end() && got->second.state == Cell::constant ?
+			got->second.value : value;
+	} };
+	for (auto block : fn_.blocks) {
+		if (! reached_.count(block)) { continue; }
+		auto &insts { block->instructions };
+		auto end { std::remove_if(
+			insts.begin(), insts.end(), [&](Ir_Instruction *inst) {
+				auto r { inst->result };
+				return r && replace(r) != r;
+			}
+		) };
+		stats_.add("sccp.constants", insts.end() - end);
+		insts.erase(end, insts.end());
+		for (auto inst : insts) {
+			for (auto &op : inst->operands) { op = replace(op); }
+			if (inst->opcode == Opcode::phi) {
+				for (size_t i { inst->incoming.size() }; i-- > 0; ) {
+					if (! edges_.count({ inst->incoming[i], block })) {
+						inst->incoming.erase(inst->incoming.begin() + i);
+						inst->operands.erase(inst->operands.begin() + i);
+					}
+				}
+			}
+		}
+		auto term { block->terminator() };
+		if (term && term->opcode == Opcode::conditional) {
+			auto c { term->operands[0] };
+			if (auto b { value_cast<Bool_Literal>(c) }) {
+				stats_.add("sccp.branches");
+				term->opcode = Opcode::branch;
+				term->targets[0] = term->targets[b->value() ? 0 : 1];
+				term->targets[1] = nullptr;
+				term->operands.clear();
+			}
+		}
+	}
+	remove_unreachable_blocks(fn_);
+}
+
+void propagate_constants(Ir_Function &fn, Pass_Context &context) {
+	if (fn.blocks.empty()) { return; }
+	Propagator { fn, context }.run();
+}
@@ -2,31 +2,75 @@
 
 #include "err.h"
 #include "type.h"
+#include "value.h"
 
-Type::Ptr boolean_type = Type::create("BOOLEAN");
-Type::Ptr integer_type = Type::create("INTEGER");
-Type::Ptr real_type = Type::create("REAL");
+static Arena builtins;
 
-class Initial_Scope: public Scope {
-	public:
-		Initial_Scope(): Scope { nullptr } {
-			insert(integer_type);
-			insert(boolean_type);
-			insert(real_type);
-		}
-};
+Type::Ptr boolean_type = Type::create(builtins, Symbol::intern("BOOLEAN"));
+Type::Ptr integer_type = Type::create(builtins, Symbol::intern("INTEGER"));
+Type::Ptr real_type = Type::create(builtins, Symbol::intern("REAL"));
 
-Scope::Ptr current_scope = std::make_shared<Initial_Scope>();
+// must be initialized after the types in the same translation unit
+Type::Ptr Bool_Trait::oberon_type = boolean_type;
+Type::Ptr Integer_Trait::oberon_type = integer_type;
+Type::Ptr Real_Trait::oberon_type = real_type;
+
+Scope::Scope(): slots_(64) {
+	insert(integer_type);
+	insert(boolean_type);
+	insert(real_type);
+}
+
+size_t Scope::find_slot(Symbol name) const {
+	size_t mask { slots_.size() - 1 };
+	size_t idx { (name.id() * 0x9e3779b1u) & mask };
+	while (slots_[idx].name && slots_[idx].name != name) {
+		idx = (idx + 1) & mask;
+	}
+	return idx;
+}
+
+void Scope::grow() {
+	std::vector<Slot> old(slots_.size() * 2);
+	old.swap(slots_);
+	for (auto &slot : old) {
+		if (slot.name) { slots_[find_slot(slot.name)] = slot; }
+	}
+}
+
+void Scope::push() {
+	markers_.push_back(undo_.size());
+	++depth_;
+}
+
+void Scope::pop() {
+	for (auto mark { markers_.back() }; undo_.size() > mark; ) {
+		auto &undo { undo_.back() };
+		auto &slot { slots_[find_slot(undo.name)] };
+		slot.declaration = undo.declaration;
+		slot.depth = undo.depth;
+		undo_.pop_back();
+	}
+	markers_.pop_back();
+	--depth_;
+}
 
 bool Scope::insert(Declaration::Ptr declaration) {
 	if (! declaration) { throw Error { "insert nullptr" }; return false; }
-	return symbols_.insert({ declaration->name(), declaration }).second;
+	auto name { declaration->symbol() };
+	if (2 * (used_ + 1) > slots_.size()) { grow(); }
+	auto &slot { slots_[find_slot(name)] };
+	if (! slot.name) {
+		slot.name = name; ++used_;
+	} else if (slot.declaration && slot.depth == depth_) {
+		return false;
+	}
+	undo_.push_back({ name, slot.declaration, slot.depth });
+	slot.declaration = declaration;
+	slot.depth = depth_;
+	return true;
 }
 
-Declaration::Ptr Scope::lookup(std::string name) {
-	for (auto cur { current_scope }; cur; cur = cur->parent_) {
-		auto got { cur->symbols_.find(name) };
-		if (got != cur->symbols_.end()) { return got->second; }
-	}
-	return nullptr;
+Declaration::Ptr Scope::lookup(Symbol name) const {
+	return slots_[find_slot(name)].declaration;
 }
@@ -2,35 +2,42 @@
 
 #include "declaration.h"
 
-#include <map>
-#include <memory>
-#include <string>
+#include <vector>
 
+// all visible declarations in one open addressing table keyed by symbol;
+// shadowed entries are kept in an undo log until their scope is left
 class Scope {
+		struct Slot {
+			Symbol name;
+			Declaration::Ptr declaration { nullptr };
+			int depth { 0 };
+		};
+		struct Undo {
+			Symbol name;
+			Declaration::Ptr declaration;
+			int depth;
+		};
+
+		std::vector<Slot> slots_;
+		size_t used_ { 0 };
+		std::vector<Undo> undo_;
+		std::vector<size_t> markers_;
+		int depth_ { 0 };
+
+		size_t find_slot(Symbol name) const;
+		void grow();
 	public:
-		using Ptr = std::shared_ptr<Scope>;
-	private:
-		Scope::Ptr parent_;
-		std::map<std::string, Declaration::Ptr> symbols_;
-	public:
-		Scope(Scope::Ptr parent): parent_ { parent } { }
-		static auto create(Scope::Ptr parent) {
-			return Ptr { new Scope { parent } };
-		}
+		Scope();
+
+		void push();
+		void pop();
 		bool insert(Declaration::Ptr declaration);
-		Declaration::Ptr lookup(std::string name);
+		Declaration::Ptr lookup(Symbol name) const;
 };
 
-extern Scope::Ptr current_scope;
-
 class Pushed_Scope {
-		Scope::Ptr old_current_scope_;
+		Scope &scope_;
 	public:
-		Pushed_Scope(Declaration::Ptr parent) {
-			old_current_scope_ = current_scope;
-			current_scope = Scope::create(old_current_scope_);
-		}
-		~Pushed_Scope() {
-			current_scope = old_current_scope_;
-		}
+		Pushed_Scope(Scope &scope): scope_ { scope } { scope_.push(); }
+		~Pushed_Scope() { scope_.pop(); }
 };
@@ -0,0 +1,178 @@
+#include "passes.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace {
+	// more instructions are worth a branch
+	constexpr size_t max_speculated { 4 };
+
+	bool can_speculate(const Ir_Instruction *inst) {
+		if (inst->has_side_effects() || inst->opcode == Opcode::phi) {
+			return false;
+		}
+		// division by zero must not happen on the other path
+		return inst->opcode != Opcode::binary || ! can_trap(inst->binary_op);
+	}
+
+	class Flattener {
+			Ir_Function &fn_;
+			std::unordered_map<Ir_Block::Ptr, int> preds_;
+
+			void count_preds();
+			bool is_side(Ir_Block::Ptr side, Ir_Block::Ptr join) const;
+			Ir_Instruction *merge(
+				Reference::Ptr result, Value::Ptr condition,
+				Value::Ptr if_true, Value::Ptr if_false
+			);
+			void flatten(Ir_Block::Ptr head, int side);
+			void join(Ir_Block::Ptr head, Ir_Block::Ptr tail);
+		public:
+			Flattener(Ir_Function &fn): fn_ { fn } { }
+			bool step();
+	};
+}
+
+void Flattener::count_preds() {
+	preds_.clear();
+	for (auto block : fn_.blocks) {
+		if (auto term { block->terminator() }) {
+			for (auto target : term->targets) {
+				if (target) { ++preds_[target]; }
+			}
+		}
+	}
+}
+
+// side is a block that only the head enters and that falls through to
+// join after a few instructions without effects
+bool Flattener::is_side(Ir_Block::Ptr side, Ir_Block::Ptr join) const {
+	auto term { side->terminator() };
+	if (! term || term->opcode != Opcode::branch) { return false; }
+	if (term->targets[0] != join || preds_.at(side) != 1) { return false; }
+	auto &insts { side->instructions };
+	if (insts.size() - 1 > max_speculated) { return false; }
+	return std::all_of(insts.begin(), insts.end() - 1, can_speculate);
+}
+
+// boolean selects of the condition itself are short circuits
+Ir_Instruction *Flattener::merge(
+	Reference::Ptr result, Value::Ptr condition,
+	Value::Ptr if_true, Value::Ptr if_false
+) {
+	Ir_Instruction *inst;
+	if (if_true == if_false) {
+		return nullptr;
+	} else if (result->type() == boolean_type && if_true == condition) {
+		inst = fn_.create(Opcode::binary);
+		inst->binary_op = Binary_Op::log_or;
+		inst->operands = { condition, if_false };
+	} else if (result->type() == boolean_type && if_false == condition) {
+		inst = fn_.create(Opcode::binary);
+		inst->binary_op = Binary_Op::log_and;
+		inst->operands = { condition, if_true };
+	} else {
+		inst = fn_.create(Opcode::select);
+		inst->operands = { condition, if_true, if_false };
+	}
+	inst->result = result;
+	return inst;
+}
+
+// head: br c, side, join (or mirrored) becomes straight line code with
+// the phis of join replaced
+void Flattener::flatten(Ir_Block::Ptr head, int side_index) {
+	auto term { head->terminator() };
+	auto side { term->targets[side_index] };
+	auto join_block { term->targets[1 - side_index] };
+	auto condition { term->operands[0] };
+
+	auto &insts { head->instructions };
+	insts.pop_back();
+	insts.insert(
+		insts.end(), side->instructions.begin(),
+		side->instructions.end() - 1
+	);
+
+	std::unordered_map<Value::Ptr, Value::Ptr> replaced;
+	auto &joined { join_block->instructions };
+	auto first { joined.begin() };
+	for (
+		; first != joined.end() && (**first).opcode == Opcode::phi;
+		++first
+	) {
+		auto phi { *first };
+		Value::Ptr from_head { nullptr };
+		Value::Ptr from_side { nullptr };
+		for (size_t i { 0 }; i < phi->operands.size(); ++i) {
+			(phi->incoming[i] == head ? from_head : from_side) =
+				phi->operands[i];
+		}
+		auto if_true { side_index == 0 ? from_side : from_head };
+		auto if_false { side_index == 0 ? from_head : from_side };
+		auto inst { merge(phi->result, condition, if_true, if_false) };
+		if (inst) {
+			insts.push_back(inst);
+		} else {
+			replaced[phi->result] = if_true;
+		}
+	}
+	joined.erase(joined.begin(), first);
+	if (! replaced.empty()) {
+		for (auto block : fn_.blocks) {
+			for (auto inst : block->instructions) {
+				for (auto &op : inst->operands) {
+					auto got { replaced.find(op) };
+					if (got != replaced.end()) { op = got->second; }
+				}
+			}
+		}
+	}
+
+	auto &blocks { fn_.blocks };
+	blocks.erase(std::find(blocks.begin(), blocks.end(), side));
+	join(head, join_block);
+}
+
+// appends tail, whose only predecessor is head, to head
+void Flattener::join(Ir_Block::Ptr head, Ir_Block::Ptr tail) {
+	head->instructions.insert(
+		head->instructions.end(), tail->instructions.begin(),
+		tail->instructions.end()
+	);
+	for (auto block : fn_.blocks) {
+		for (auto inst : block->instructions) {
+			if (inst->opcode != Opcode::phi) { break; }
+			std::replace(
+				inst->incoming.begin(), inst->incoming.end(), tail, head
+			);
+		}
+	}
+	auto &blocks { fn_.blocks };
+	blocks.erase(std::find(blocks.begin(), blocks.end(), tail));
+}
+
+bool Flattener::step() {
+	count_preds();
+	for (auto head : fn_.blocks) {
+		auto term { head->terminator() };
+		if (! term || term->opcode != Opcode::conditional) { continue; }
+		for (int side { 0 }; side < 2; ++side) {
+			auto join_block { term->targets[1 - side] };
+			if (
+				term->targets[side] != join_block &&
+				preds_[join_block] == 2 &&
+				is_side(term->targets[side], join_block)
+			) {
+				flatten(head, side);
+				return true;
+			}
+		}
+	}
+	return false;
+}
+
+void flatten_conditionals(Ir_Function &fn, Pass_Context &context) {
+	Flattener flattener { fn };
+	while (flattener.step()) { context.stats.add("select.flattened"); }
+}
@@ -0,0 +1,53 @@
+#include "source.h"
+
+#include "err.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+Source::Source(const std::string &path) {
+	int fd { ::open(path.c_str(), O_RDONLY) };
+	if (fd < 0) { throw Error { "cannot open for reading" }; }
+	try {
+		map_or_read(fd);
+	} catch (...) {
+		::close(fd); throw;
+	}
+	::close(fd);
+}
+
+void Source::map_or_read(int fd) {
+	struct stat st;
+	bool regular { ::fstat(fd, &st) == 0 && S_ISREG(st.st_mode) };
+	if (regular && st.st_size > 0) {
+		void *got { ::mmap(
+			nullptr, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0
+		) };
+		if (got != MAP_FAILED) {
+			begin_ = static_cast<const char *>(got);
+			end_ = begin_ + st.st_size;
+			mapped_ = true;
+			return;
+		}
+	}
+
+	// pipes, terminals and files that can't be mapped: one bulk read
+	if (regular) { buffer_.reserve(st.st_size); }
+	char chunk[64 * 1024];
+	for (;;) {
+		auto got { ::read(fd, chunk, sizeof(chunk)) };
+		if (got < 0) { throw Error { "cannot read input" }; }
+		if (! got) { break; }
+		buffer_.append(chunk, got);
+	}
+	begin_ = buffer_.data();
+	end_ = begin_ + buffer_.size();
+}
+
+Source::~Source() {
+	if (mapped_) {
+		::munmap(const_cast<char *>(begin_), end_ - begin_);
+	}
+}
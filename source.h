@@ -0,0 +1,25 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+
+class Source {
+		const char *begin_ { nullptr };
+		const char *end_ { nullptr };
+		bool mapped_ { false };
+		std::string buffer_;
+
+		void map_or_read(int fd);
+	public:
+		Source(const std::string &path);
+		Source(int fd) { map_or_read(fd); }
+		Source(const Source &) = delete;
+		Source &operator=(const Source &) = delete;
+		~Source();
+
+		const char *begin() const { return begin_; }
+		const char *end() const { return end_; }
+		std::string_view text() const {
+			return { begin_, static_cast<size_t>(end_ - begin_) };
+		}
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <map>
+#include <ostream>
+#include <string>
+
+// named counters of a compilation, printed with --stats
+class Stats {
+		std::map<std::string, long> counters_;
+	public:
+		void add(const std::string &name, long count = 1) {
+			if (count) { counters_[name] += count; }
+		}
+		void merge(const Stats &other) {
+			for (const auto &[name, count] : other.counters_) {
+				add(name, count);
+			}
+		}
+		void print(std::ostream &out) const {
+			for (const auto &[name, count] : counters_) {
+				out << name << ": " << count << '\n';
+			}
+		}
+};
@@ -0,0 +1,42 @@
+#include "symbol.h"
+
+#include <deque>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace {
+	// shared between the lexer threads
+	struct Symbol_Table {
+		std::shared_mutex mutex;
+		std::deque<std::string> names;
+		std::unordered_map<std::string_view, int> ids;
+	};
+
+	Symbol_Table &table() {
+		static Symbol_Table table;
+		return table;
+	}
+}
+
+Symbol Symbol::intern(std::string_view name) {
+	auto &t { table() };
+	{
+		std::shared_lock lock { t.mutex };
+		auto got { t.ids.find(name) };
+		if (got != t.ids.end()) { return Symbol { got->second }; }
+	}
+	std::unique_lock lock { t.mutex };
+	auto got { t.ids.find(name) };
+	if (got != t.ids.end()) { return Symbol { got->second }; }
+	int id = t.names.size();
+	t.names.emplace_back(name);
+	t.ids.emplace(t.names.back(), id);
+	return Symbol { id };
+}
+
+const std::string &Symbol::str() const {
+	auto &t { table() };
+	std::shared_lock lock { t.mutex };
+	return t.names[id_];
+}
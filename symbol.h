@@ -0,0 +1,28 @@
+#pragma once
+
+#include <functional>
+#include <string>
+#include <string_view>
+
+class Symbol {
+		int id_ { -1 };
+		explicit Symbol(int id): id_ { id } { }
+	public:
+		Symbol() = default;
+
+		static Symbol intern(std::string_view name);
+
+		int id() const { return id_; }
+		const std::string &str() const;
+		explicit operator bool() const { return id_ >= 0; }
+
+		bool operator==(Symbol other) const { return id_ == other.id_; }
+		bool operator!=(Symbol other) const { return id_ != other.id_; }
+		bool operator<(Symbol other) const { return id_ < other.id_; }
+};
+
+namespace std {
+	template<> struct hash<Symbol> {
+		size_t operator()(Symbol s) const { return s.id(); }
+	};
+}
@@ -0,0 +1,36 @@
+extern void Div__init();
+extern int Div_P(int, int);
+extern int Div_Quot(int);
+extern int Div_Rem(int);
+
+#include <stdio.h>
+#include <assert.h>
+
+void run_p(int x, int n, int ex) {
+	int got = Div_P(x, n);
+	printf("p(%d, %d) == %d\n", x, n, got);
+	assert(got == ex);
+}
+
+void run_quot(int x, int ex) {
+	int got = Div_Quot(x);
+	printf("quot(%d) == %d\n", x, got);
+	assert(got == ex);
+}
+
+void run_rem(int x, int ex) {
+	int got = Div_Rem(x);
+	printf("rem(%d) == %d\n", x, got);
+	assert(got == ex);
+}
+
+int main() {
+	Div__init();
+	run_p(-2147483647 - 1, 3, 0);
+	run_p(5, 3, -15);
+	run_p(5, 0, 0);
+	run_quot(-2147483647 - 1, -2147483647 - 1);
+	run_quot(7, -7);
+	run_rem(-2147483647 - 1, 0);
+	run_rem(7, 0);
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include "err.h"
+#include "gen.h"
+#include "output.h"
+
+// writes textual LLVM IR
+class Text_Gen: public Gen {
+		Output &out_;
+
+		void put(Value::Ptr value) {
+			if (value->is_literal()) {
+				out_ << static_cast<Literal *>(value)->spelling();
+			} else {
+				out_ << '%' << static_cast<Reference *>(value)->index();
+			}
+		}
+		void put(Type::Ptr type) { out_ << get_ir_type(type); }
+		void put(const Label &label) {
+			out_ << label.prefix;
+			if (label.id >= 0) { out_ << label.id; }
+			if (label.alt >= 0) { out_ << '_' << label.alt; }
+		}
+		void put(const char *str) { out_ << str; }
+		void put(std::string_view str) { out_ << str; }
+
+		template<typename... ARGS> void line(ARGS... args) {
+			out_ << '\t';
+			(put(args), ...);
+			out_ << '\n';
+		}
+
+		// intermediate values are named after the result, so they do
+		// not take numbers
+		struct Temp {
+			Reference::Ptr of;
+			const char *suffix;
+		};
+		void put(const Temp &temp) {
+			out_ << "%mulh" << temp.of->index() << temp.suffix;
+		}
+
+		// the upper half of the 64 bit product
+		void mul_high(
+			Reference::Ptr result, Value::Ptr left, Value::Ptr right
+		) {
+			Temp l { result, ".l" }, r { result, ".r" };
+			Temp product { result, ".p" }, high { result, ".h" };
+			line(l, " = sext i32 ", left, " to i64");
+			line(r, " = sext i32 ", right, " to i64");
+			line(product, " = mul i64 ", l, ", ", r);
+			line(high, " = ashr i64 ", product, ", 32");
+			line(result, " = trunc i64 ", high, " to i32");
+		}
+	public:
+		Text_Gen(Output &out): out_ { out } { }
+
+		void define(
+			std::string_view name, Type::Ptr returns,
+			const std::vector<Parameter> &params, bool inline_hint
+		) override {
+			out_ << "define ";
+			put(returns);
+			out_ << " @" << name << '(';
+			bool first { true };
+			for (const auto &param : params) {
+				if (! first) { out_ << ", "; }
+				first = false;
+				put(param.ref->type());
+				if (param.by_reference) { out_ << '*'; }
+				out_ << ' '; put(param.ref);
+			}
+			out_ << (inline_hint ? ") inlinehint {\n" : ") {\n");
+		}
+		void end_define() override { out_ << "}\n"; }
+
+		void def_label(const Label &label) override {
+			put(label); out_ << ":\n";
+		}
+		void branch(const Label &label) override {
+			line("br label %", label);
+		}
+		void conditional(
+			Value::Ptr value, const Label &true_label,
+			const Label &false_label
+		) override {
+			line(
+				"br ", value->type(), " ", value, ", label %",
+				true_label, ", label %", false_label
+			);
+		}
+		void ret() override { line("ret void"); }
+		void ret(Value::Ptr value) override {
+			line("ret ", value->type(), " ", value);
+		}
+		void alloca(Reference::Ptr ref) override {
+			line(ref, " = alloca ", ref->type(), ", align 4");
+		}
+		void load(Reference::Ptr result, Reference::Ptr ptr) override {
+			line(
+				result, " = load ", result->type(), ", ",
+				result->type(), "* ", ptr, ", align 4"
+			);
+		}
+		void store(Value::Ptr value, Reference::Ptr ptr) override {
+			line(
+				"store ", value->type(), " ", value, ", ",
+				value->type(), "* ", ptr, ", align 4"
+			);
+		}
+		void unary(
+			Reference::Ptr result, Unary_Op op, Value::Ptr value
+		) override {
+			auto t { value->type() };
+			if (op == Unary_Op::log_not) {
+				line(result, " = xor ", t, " ", value, ", true");
+			} else if (t == real_type) {
+				line(result, " = fneg ", t, " ", value);
+			} else {
+				line(result, " = sub ", t, " 0, ", value);
+			}
+		}
+		void binary(
+			Reference::Ptr result, Binary_Op op,
+			Value::Ptr left, Value::Ptr right
+		) override {
+			auto t { left->type() };
+			if (op == Binary_Op::mul_high) {
+				mul_high(result, left, right);
+				return;
+			}
+			auto instr { instruction(op, t) };
+			if (! instr) {
+				throw Error {
+					std::string { "no instruction for " } +
+					binary_operator(op).name
+				};
+			}
+			line(result, " = ", instr, " ", t, " ", left, ", ", right);
+		}
+		void phi(
+			Reference::Ptr result,
+			const std::vector<std::pair<Value::Ptr, Label>> &incoming
+		) override {
+			out_ << '\t';
+			put(result); out_ << " = phi "; put(result->type());
+			bool first { true };
+			for (const auto &[value, label] : incoming) {
+				out_ << (first ? " [ " : ", [ ");
+				first = false;
+				put(value); out_ << ", %"; put(label); out_ << " ]";
+			}
+			out_ << '\n';
+		}
+		void select(
+			Reference::Ptr result, Value::Ptr condition,
+			Value::Ptr if_true, Value::Ptr if_false
+		) override {
+			line(
+				result, " = select i1 ", condition, ", ",
+				if_true->type(), " ", if_true, ", ", if_false->type(),
+				" ", if_false
+			);
+		}
+		void call(
+			Reference::Ptr result, std::string_view name,
+			const std::vector<Argument> &args
+		) override {
+			out_ << '\t';
+			if (result) { put(result); out_ << " = "; }
+			out_ << "call ";
+			put(result ? result->type() : nullptr);
+			out_ << " @" << name << '(';
+			bool first { true };
+			for (const auto &arg : args) {
+				if (! first) { out_ << ", "; }
+				first = false;
+				put(arg.value->type());
+				if (arg.by_reference) { out_ << '*'; }
+				out_ << ' '; put(arg.value);
+			}
+			out_ << ")\n";
+		}
+};
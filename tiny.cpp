@@ -1,34 +1,401 @@
 #include "err.h"
+#include "jit.h"
+#include "llvm_gen.h"
 #include "parser.h"
+#include "passes.h"
+#include "pipeline.h"
+#include "procedure_cache.h"
+#include "text_gen.h"
+#include "vm_gen.h"
+#include "x86_gen.h"
 
-#include <fstream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
 #include <iostream>
+#include <memory>
+#include <sys/stat.h>
+#include <thread>
+#include <vector>
 
-int main(int argc, const char **argv) {
-	std::string current_file;
+struct Job {
+	std::string file;
+	Output out;
+	bool failed { false };
+	std::string error;
+	int line { 0 };
+	Stats stats;
+	Remarks remarks;
+};
+
+struct Options {
+	bool pipelined { false };
+	Emit emit { Emit::text };
+	int opt_level { 0 };
+	bool explicit_passes { false };
+	bool stats { false };
+	Remarks remarks;
+	int inline_threshold { default_inline_threshold };
+	Pass_Manager passes;
+	std::string output_file;
+	// --run: the procedure to call and its arguments
+	bool run { false };
+	bool vm { false };
+	std::vector<std::string> run_args;
+	// --watch: compile the module again on each change
+	bool watch { false };
+};
+
+// bitcode and object files are written per module: to the -o file or
+// next to the source
+static std::string target_path(const Job &job, const Options &options) {
+	if (! options.output_file.empty()) { return options.output_file; }
+	if (job.file == "-") { throw Error { "-o is needed for stdin" }; }
+	auto path { job.file };
+	auto dot { path.rfind('.') };
+	if (
+		dot != std::string::npos && path.find('/', dot) == std::string::npos
+	) {
+		path.erase(dot);
+	}
+	return path + (options.emit == Emit::bitcode ? ".bc" : ".o");
+}
 
+// with a cache, gen writes its text to the output of the job
+static void translate(
+	Job &job, const Options &options, Gen &gen,
+	Procedure_Cache *cache = nullptr
+) {
+	auto source { job.file == "-" ?
+		std::make_unique<Source>(0) :
+		std::make_unique<Source>(job.file)
+	};
+	// the cache looks ahead over whole procedures
+	std::unique_ptr<Token_Source> tokens;
+	if (options.pipelined || cache) {
+		tokens = std::make_unique<Pipelined_Lexer>(*source);
+	} else {
+		tokens = std::make_unique<Lexer>(*source);
+	}
+	// parser and passes share the literals
+	Constant_Pool local_pool;
+	auto &pool { cache ? cache->pool() : local_pool };
+	Pass_Context context {
+		pool, job.stats, job.remarks, options.inline_threshold
+	};
+	if (cache) { cache->start(job.out, context); }
+	Ir_Builder builder { gen, options.passes, context };
+	Parser parser { *tokens, builder, pool, cache };
+	parser.parse();
+	builder.finish();
+}
+
+static void compile(Job &job, const Options &options, Output &out) {
 	try {
-		for (
-			auto cur { argv + 1}, end { argv + argc };
-			cur != end; ++cur
+		std::unique_ptr<Gen> gen;
+		if (options.emit == Emit::text) {
+			gen = std::make_unique<Text_Gen>(out);
+		} else if (options.emit == Emit::native) {
+			gen = std::make_unique<X86_Gen>(
+				job.file, target_path(job, options)
+			);
+		} else {
+			gen = std::make_unique<LLVM_Gen>(
+				job.file, target_path(job, options), options.emit,
+				options.opt_level
+			);
+		}
+		translate(job, options, *gen);
+	} catch (const Error &e) {
+		job.failed = true;
+		job.error = e.what();
+		job.line = e.line();
+	}
+}
+
+static int report(const Job &job) {
+	std::cerr << job.file << ':';
+	if (job.line > 0) { std::cerr << job.line << ':'; }
+	std::cerr << ' ' << job.error << '\n';
+	return 10;
+}
+
+// runs the module body, then the procedure named by the first run
+// argument; returns its printed result
+template<typename Engine, typename Functions> static std::string execute(
+	Engine &engine, const Functions &functions, const Options &options
+) {
+	std::string init;
+	for (const auto &fn : functions) {
+		auto at { fn.name.rfind("__init") };
+		if (at != std::string::npos && at + 6 == fn.name.size()) {
+			init = fn.name;
+		}
+	}
+	engine.call(init, { });
+	if (options.run_args.empty()) { return { }; }
+	auto name { init.substr(0, init.size() - 5) + options.run_args[0] };
+	return engine.call(name, {
+		options.run_args.begin() + 1, options.run_args.end()
+	});
+}
+
+// compiles a module into memory as machine code or, with --vm, as
+// bytecode and executes it; the result goes to stdout, the times of
+// both steps to stderr
+static void run(Job &job, const Options &options) {
+	using Clock = std::chrono::steady_clock;
+	auto millis { [](Clock::duration d) {
+		return std::chrono::duration<double, std::milli> { d }.count();
+	} };
+	try {
+		auto start { Clock::now() };
+		auto compiled { start };
+		std::string result;
+		if (options.vm) {
+			Vm_Gen gen;
+			translate(job, options, gen);
+			Vm vm { gen.code() };
+			compiled = Clock::now();
+			result = execute(vm, gen.code().functions, options);
+		} else {
+			X86_Gen gen { job.file, { } };
+			translate(job, options, gen);
+			Jit jit { gen.code() };
+			compiled = Clock::now();
+			result = execute(jit, gen.code().functions, options);
+		}
+		auto done { Clock::now() };
+
+		if (! result.empty()) { std::cout << result << '\n'; }
+		std::cerr << "compile: " << millis(compiled - start) << " ms\n";
+		std::cerr << "run: " << millis(done - compiled) << " ms\n";
+	} catch (const Error &e) {
+		job.failed = true;
+		job.error = e.what();
+		job.line = e.line();
+	}
+}
+
+// compiles the module again whenever it changes and writes the text to
+// the -o file or stdout; procedures whose fingerprint did not change
+// are taken from the cache, the counts and the time go to stderr
+[[noreturn]] static void watch(
+	const std::string &file, const Options &options
+) {
+	using Clock = std::chrono::steady_clock;
+	Procedure_Cache cache;
+	struct stat seen { };
+	for (;; std::this_thread::sleep_for(std::chrono::milliseconds { 100 })) {
+		struct stat now;
+		if (
+			::stat(file.c_str(), &now) != 0 || (
+				now.st_mtim.tv_sec == seen.st_mtim.tv_sec &&
+				now.st_mtim.tv_nsec == seen.st_mtim.tv_nsec &&
+				now.st_size == seen.st_size
+			)
 		) {
-			if (**cur == '-') { continue; }
-			Lexer::reset_current_line();
-			current_file = *cur;
-			std::ifstream in { *cur };
-			if (! in) {
-				throw Error { "cannot open for reading" };
+			continue;
+		}
+		seen = now;
+		Job job;
+		job.file = file;
+		auto start { Clock::now() };
+		try {
+			Text_Gen gen { job.out };
+			translate(job, options, gen, &cache);
+			cache.finish();
+			auto out { options.output_file.empty() ?
+				std::make_unique<Output>(1) :
+				std::make_unique<Output>(options.output_file)
+			};
+			*out << job.out.contents();
+			out->flush();
+		} catch (const Error &e) {
+			job.error = e.what();
+			job.line = e.line();
+			report(job);
+			continue;
+		}
+		std::chrono::duration<double, std::milli> took {
+			Clock::now() - start
+		};
+		std::cerr << file << ": " << cache.reused() << " reused, " <<
+			cache.generated() << " generated, " << took.count() << " ms\n";
+	}
+}
+
+// writes what is left in out; a failed write is reported here, the
+// destructor of Output cannot
+static bool flushed(Output &out) {
+	try {
+		out.flush();
+	} catch (const Error &e) {
+		std::cerr << e.what() << '\n';
+		return false;
+	}
+	return true;
+}
+
+static int finish(const std::vector<Job> &jobs, const Options &options) {
+	for (const auto &job : jobs) { job.remarks.print(std::cerr, job.file); }
+	if (options.stats) {
+		Stats total;
+		for (const auto &job : jobs) { total.merge(job.stats); }
+		total.print(std::cerr);
+	}
+	return 0;
+}
+
+int main(int argc, const char **argv) {
+	Options options;
+	int threads { 1 };
+	std::vector<std::string> files;
+	for (
+		auto cur { argv + 1}, end { argv + argc };
+		cur != end; ++cur
+	) {
+		std::string arg { *cur };
+		if (arg == "--pipeline") {
+			options.pipelined = true;
+		} else if (arg == "--stats") {
+			options.stats = true;
+		} else if (arg.rfind("-Rpass=", 0) == 0) {
+			options.remarks.enable(arg.substr(7), false);
+		} else if (arg.rfind("-Rpass-missed=", 0) == 0) {
+			options.remarks.enable(arg.substr(14), true);
+		} else if (arg.rfind("--inline-threshold=", 0) == 0) {
+			options.inline_threshold = std::atoi(arg.c_str() + 19);
+		} else if (arg == "--emit=ll") {
+			options.emit = Emit::text;
+		} else if (arg == "--emit=bc") {
+			options.emit = Emit::bitcode;
+		} else if (arg == "--emit=obj") {
+			options.emit = Emit::object;
+		} else if (arg == "-c") {
+			options.emit = Emit::native;
+		} else if (arg == "-O0" || arg == "-O1" || arg == "-O2") {
+			options.opt_level = arg[2] - '0';
+		} else if (arg.rfind("--passes=", 0) == 0) {
+			options.explicit_passes = true;
+			for (size_t pos { 9 }; pos <= arg.size(); ) {
+				auto comma { std::min(arg.find(',', pos), arg.size()) };
+				auto name { arg.substr(pos, comma - pos) };
+				if (! name.empty() && ! options.passes.add(name)) {
+					std::cerr << "unknown pass " << name << '\n';
+					return 10;
+				}
+				pos = comma + 1;
+			}
+		} else if (arg == "--watch") {
+			options.watch = true;
+		} else if (arg == "--vm") {
+			options.vm = true;
+		} else if (arg == "--run") {
+			// the module, then the procedure and its arguments
+			options.run = true;
+			if (cur + 1 != end) { files.push_back(*++cur); }
+			options.run_args.assign(cur + 1, end);
+			break;
+		} else if (arg == "-o" && cur + 1 != end) {
+			options.output_file = *++cur;
+		} else if (arg.rfind("-j", 0) == 0) {
+			if (arg.size() > 2) {
+				threads = std::atoi(arg.c_str() + 2);
+			} else if (cur + 1 != end) {
+				threads = std::atoi(*++cur);
 			}
-			Lexer lexer { in };
-			Parser parser { lexer };
-			parser.parse();
+			if (threads < 1) { threads = 1; }
+		} else if (arg == "-" || arg[0] != '-') {
+			files.push_back(arg);
+		}
+	}
+
+	if (! options.explicit_passes) {
+		options.passes.add_level(options.opt_level);
+	}
+	if (options.run) {
+		if (files.size() != 1) {
+			std::cerr << "--run needs a single module\n";
+			return 10;
+		}
+		std::vector<Job> jobs(1);
+		jobs[0].file = files[0];
+		jobs[0].remarks = options.remarks;
+		run(jobs[0], options);
+		if (jobs[0].failed) { return report(jobs[0]); }
+		if (! std::cout.flush()) {
+			std::cerr << "cannot write output\n";
+			return 10;
+		}
+		return finish(jobs, options);
+	}
+	if (options.watch) {
+		if (
+			files.size() != 1 || files[0] == "-" ||
+			options.emit != Emit::text
+		) {
+			std::cerr << "--watch needs a single module file and text output\n";
+			return 10;
 		}
+		watch(files[0], options);
+	}
+	if (options.emit != Emit::text) {
+		if (options.emit != Emit::native && ! LLVM_Gen::available()) {
+			std::cerr << "tiny was built without LLVM support\n";
+			return 10;
+		}
+		if (! options.output_file.empty() && files.size() > 1) {
+			std::cerr << "-o needs a single module with --emit\n";
+			return 10;
+		}
+	}
+
+	std::unique_ptr<Output> out;
+	try {
+		out = options.emit != Emit::text || options.output_file.empty() ?
+			std::make_unique<Output>(1) :
+			std::make_unique<Output>(options.output_file);
 	} catch (const Error &e) {
-		std::cerr << current_file << ':';
-		auto line { Lexer::current_line() };
-		if (line > 0) { std::cerr << line << ':'; }
-		std::cerr << ' ' << e.what() << '\n';
+		std::cerr << e.what() << '\n';
 		return 10;
 	}
-	return 0;
+
+	std::vector<Job> jobs(files.size());
+	for (size_t i { 0 }; i < files.size(); ++i) {
+		jobs[i].file = files[i];
+		jobs[i].remarks = options.remarks;
+	}
+
+	if (threads == 1 || jobs.size() < 2) {
+		for (auto &job : jobs) {
+			compile(job, options, *out);
+			if (job.failed) { flushed(*out); return report(job); }
+		}
+		if (! flushed(*out)) { return 10; }
+		return finish(jobs, options);
+	}
+
+	// each module writes to its own buffer; the buffers are written in
+	// the order of the arguments, so the output matches the serial run
+	std::atomic<size_t> next_job { 0 };
+	std::vector<std::thread> pool;
+	auto worker { [&] {
+		for (;;) {
+			auto idx { next_job++ };
+			if (idx >= jobs.size()) { break; }
+			compile(jobs[idx], options, jobs[idx].out);
+		}
+	} };
+	threads = std::min<int>(threads, jobs.size());
+	for (int i { 0 }; i < threads; ++i) { pool.emplace_back(worker); }
+	for (auto &t : pool) { t.join(); }
+
+	for (auto &job : jobs) {
+		*out << job.out.contents();
+		if (job.failed) { flushed(*out); return report(job); }
+	}
+	if (! flushed(*out)) { return 10; }
+	return finish(jobs, options);
 }
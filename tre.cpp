@@ -0,0 +1,282 @@
+#include "passes.h"
+
+#include <algorithm>
+
+// a call of the procedure itself whose result is returned, maybe
+// through a phi, becomes a branch back to a loop header after the
+// entry block, with the arguments as the new parameters; a result
+// that is added or multiplied with the call's result before the
+// return is collected in an accumulator instead; VAR parameters must
+// be passed on unchanged
+namespace {
+	const char *const loop_prefix { "tail_loop" };
+
+	struct Site {
+		Ir_Block::Ptr block;
+		Ir_Instruction *call;
+		// op(result, operand) between call and return
+		Ir_Instruction *accumulate { nullptr };
+		Value::Ptr operand { nullptr };
+		// the block returning the result through a phi
+		Ir_Block::Ptr join { nullptr };
+	};
+
+	bool is_accumulator(const Ir_Instruction *inst) {
+		return inst->opcode == Opcode::binary &&
+			inst->result->type() == integer_type && (
+				inst->binary_op == Binary_Op::add ||
+				inst->binary_op == Binary_Op::mul
+			);
+	}
+
+	class Eliminator {
+			Ir_Function &fn_;
+			Constant_Pool &pool_;
+			std::unordered_map<Value::Ptr, int> uses_;
+			bool accumulating_ { false };
+			Binary_Op op_ { Binary_Op::add };
+
+			bool returned(Site &site, Value::Ptr value);
+			bool find(Ir_Block::Ptr block, Site &site);
+			Ir_Block::Ptr make_header();
+		public:
+			Eliminator(Ir_Function &fn, Constant_Pool &pool);
+			size_t run();
+	};
+}
+
+Eliminator::Eliminator(Ir_Function &fn, Constant_Pool &pool):
+	fn_ { fn }, pool_ { pool }
+{
+	for (auto block : fn.blocks) {
+		for (auto inst : block->instructions) {
+			for (auto op : inst->operands) { ++uses_[op]; }
+		}
+	}
+}
+
+// value must be what the block returns and used for nothing else
+bool Eliminator::returned(Site &site, Value::Ptr value) {
+	auto term { site.block->terminator() };
+	if (value && uses_[value] != 1) { return false; }
+	if (term->opcode == Opcode::ret) {
+		return term->operands.empty() ? ! value : term->operands[0] == value;
+	}
+	if (term->opcode != Opcode::branch) { return false; }
+	auto join { term->targets[0] };
+	auto ret { join->terminator() };
+	if (! ret || ret->opcode != Opcode::ret) { return false; }
+	for (auto inst : join->instructions) {
+		if (inst != ret && inst->opcode != Opcode::phi) { return false; }
+	}
+	site.join = join;
+	if (! value) { return true; }
+	auto phi { ret->operands[0] };
+	for (auto inst : join->instructions) {
+		if (inst->result != phi) { continue; }
+		for (size_t i { 0 }; i < inst->operands.size(); ++i) {
+			if (inst->incoming[i] == site.block) {
+				return inst->operands[i] == value;
+			}
+		}
+	}
+	return false;
+}
+
+// only instructions without effects that leave the result alone may
+// follow the call, besides one accumulating operation
+bool Eliminator::find(Ir_Block::Ptr block, Site &site) {
+	auto &insts { block->instructions };
+	auto call { std::find_if(
+		insts.rbegin(), insts.rend(), [&](Ir_Instruction *inst) {
+			return inst->has_side_effects() && ! inst->is_terminator();
+		}
+	) };
+	if (call == insts.rend() || (**call).opcode != Opcode::call) {
+		return false;
+	}
+	if ((**call).callee != fn_.name()) { return false; }
+	site = { block, *call };
+	const auto &params { fn_.params() };
+	for (size_t i { 0 }; i < params.size(); ++i) {
+		if (
+			params[i].by_reference &&
+			site.call->operands[i] != params[i].ref
+		) {
+			return false;
+		}
+	}
+	auto result { site.call->result };
+	for (auto inst { call.base() }; inst != insts.end() - 1; ++inst) {
+		auto &ops { (**inst).operands };
+		if (std::find(ops.begin(), ops.end(), result) == ops.end()) {
+			continue;
+		}
+		if (site.accumulate || ! is_accumulator(*inst)) { return false; }
+		if (accumulating_ && (**inst).binary_op != op_) { return false; }
+		site.accumulate = *inst;
+		site.operand = ops[0] == result ? ops[1] : ops[0];
+		if (site.operand == result) { return false; }
+	}
+	if (site.accumulate) {
+		if (uses_[result] != 1) { return false; }
+		if (! returned(site, site.accumulate->result)) { return false; }
+		accumulating_ = true;
+		op_ = site.accumulate->binary_op;
+		return true;
+	}
+	return returned(site, result);
+}
+
+// the entry block keeps the allocas and enters the loop
+Ir_Block::Ptr Eliminator::make_header() {
+	auto entry { fn_.blocks.front() };
+	auto header { fn_.create_block({ loop_prefix }) };
+	auto &insts { entry->instructions };
+	auto first { std::find_if(
+		insts.begin(), insts.end(), [](Ir_Instruction *inst) {
+			return inst->opcode != Opcode::alloca;
+		}
+	) };
+	header->instructions.assign(first, insts.end());
+	insts.erase(first, insts.end());
+	auto enter { fn_.create(Opcode::branch) };
+	enter->targets[0] = header;
+	insts.push_back(enter);
+	for (auto target : header->terminator()->targets) {
+		if (! target) { continue; }
+		for (auto inst : target->instructions) {
+			if (inst->opcode != Opcode::phi) { break; }
+			std::replace(
+				inst->incoming.begin(), inst->incoming.end(), entry, header
+			);
+		}
+	}
+	fn_.blocks.insert(fn_.blocks.begin() + 1, header);
+	return header;
+}
+
+size_t Eliminator::run() {
+	for (auto block : fn_.blocks) {
+		if (block->label().prefix == loop_prefix) { return 0; }
+	}
+	std::vector<Site> sites;
+	for (auto block : fn_.blocks) {
+		Site site;
+		if (find(block, site)) { sites.push_back(site); }
+	}
+	if (sites.empty()) { return 0; }
+
+	auto entry { fn_.blocks.front() };
+	auto header { make_header() };
+	for (auto &site : sites) {
+		if (site.block == entry) { site.block = header; }
+	}
+
+	// value parameters are replaced by phis of the loop
+	std::unordered_map<Value::Ptr, Value::Ptr> replaced;
+	auto resolve { [&](Value::Ptr value) {
+		auto got { replaced.find(value) };
+		return got == replaced.end() ? value : got->second;
+	} };
+	auto &header_insts { header->instructions };
+	auto add_phi { [&](Value::Ptr initial, Type::Ptr type) {
+		auto phi { fn_.create(Opcode::phi) };
+		phi->result = Reference::create(fn_.arena(), -1, type);
+		phi->operands = { initial };
+		phi->incoming = { entry };
+		header_insts.insert(header_insts.begin(), phi);
+		return phi;
+	} };
+	const auto &params { fn_.params() };
+	std::vector<Ir_Instruction *> phis(params.size());
+	for (size_t i { 0 }; i < params.size(); ++i) {
+		if (params[i].by_reference) { continue; }
+		auto ref { params[i].ref };
+		phis[i] = add_phi(ref, ref->type());
+		replaced[ref] = phis[i]->result;
+	}
+	for (auto block : fn_.blocks) {
+		for (auto inst : block->instructions) {
+			if (inst->opcode == Opcode::phi && inst->incoming[0] == entry) {
+				continue;
+			}
+			for (auto &op : inst->operands) { op = resolve(op); }
+		}
+	}
+	Ir_Instruction *accumulator { nullptr };
+	if (accumulating_) {
+		accumulator = add_phi(
+			pool_.number(integer_type, op_ == Binary_Op::mul ? 1 : 0),
+			integer_type
+		);
+	}
+
+	for (auto &site : sites) {
+		auto block { site.block };
+		auto &insts { block->instructions };
+		insts.pop_back();
+		insts.erase(std::remove_if(
+			insts.begin(), insts.end(), [&](Ir_Instruction *inst) {
+				return inst == site.call || inst == site.accumulate;
+			}
+		), insts.end());
+		for (size_t i { 0 }; i < phis.size(); ++i) {
+			if (! phis[i]) { continue; }
+			phis[i]->operands.push_back(site.call->operands[i]);
+			phis[i]->incoming.push_back(block);
+		}
+		if (accumulator) {
+			Value::Ptr next { accumulator->result };
+			if (site.accumulate) {
+				auto inst { fn_.create(Opcode::binary) };
+				inst->binary_op = op_;
+				inst->operands = {
+					accumulator->result, resolve(site.operand)
+				};
+				inst->result = Reference::create(
+					fn_.arena(), -1, integer_type
+				);
+				insts.push_back(inst);
+				next = inst->result;
+			}
+			accumulator->operands.push_back(next);
+			accumulator->incoming.push_back(block);
+		}
+		auto back { fn_.create(Opcode::branch) };
+		back->targets[0] = header;
+		insts.push_back(back);
+		if (! site.join) { continue; }
+		for (auto inst : site.join->instructions) {
+			if (inst->opcode != Opcode::phi) { break; }
+			for (size_t i { inst->incoming.size() }; i-- > 0; ) {
+				if (inst->incoming[i] != block) { continue; }
+				inst->operands.erase(inst->operands.begin() + i);
+				inst->incoming.erase(inst->incoming.begin() + i);
+			}
+		}
+	}
+
+	// the remaining returns add what the tail calls accumulated
+	if (accumulator) {
+		for (auto block : fn_.blocks) {
+			auto term { block->terminator() };
+			if (! term || term->opcode != Opcode::ret) { continue; }
+			auto inst { fn_.create(Opcode::binary) };
+			inst->binary_op = op_;
+			inst->operands = { accumulator->result, term->operands[0] };
+			inst->result = Reference::create(fn_.arena(), -1, integer_type);
+			block->instructions.insert(block->instructions.end() - 1, inst);
+			term->operands[0] = inst->result;
+		}
+	}
+	// joins may have lost all their predecessors
+	remove_unreachable_blocks(fn_);
+	return sites.size();
+}
+
+void eliminate_tail_calls(Ir_Function &fn, Pass_Context &context) {
+	context.stats.add(
+		"tre.eliminated", Eliminator { fn, context.pool }.run()
+	);
+}
@@ -1,13 +1,15 @@
 #pragma once
 
+#include "arena.h"
 #include "declaration.h"
 
 class Type: public Declaration {
-		Type(std::string name): Declaration { name } { }
+		friend class Arena;
+		Type(Symbol name): Declaration { name } { }
 	public:
-		using Ptr = std::shared_ptr<Type>;
-		static auto create(std::string name) {
-			return Ptr { new Type { name } };
+		using Ptr = Type *;
+		static auto create(Arena &arena, Symbol name) {
+			return arena.create<Type>(name);
 		}
 };
 
@@ -15,4 +17,4 @@ extern Type::Ptr boolean_type;
 extern Type::Ptr integer_type;
 extern Type::Ptr real_type;
 
-std::string get_ir_type(Type::Ptr ty);
+const char *get_ir_type(Type::Ptr ty);
@@ -1,71 +1,109 @@
 #pragma once
 
+#include "arena.h"
 #include "type.h"
 
 #include <string>
-#include <memory>
 
+enum class Value_Kind {
+	reference, int_literal, real_literal, bool_literal
+};
+
+// values live in an arena; a Ptr is a plain non-owning handle
 class Value {
+		const Value_Kind kind_;
+	protected:
+		Value(Value_Kind kind): kind_ { kind } { }
 	public:
-		using Ptr = std::shared_ptr<Value>;
-		virtual ~Value() { }
+		using Ptr = Value *;
+		Value_Kind kind() const { return kind_; }
+		bool is_literal() const { return kind_ != Value_Kind::reference; }
 		virtual Type::Ptr type() = 0;
 		virtual std::string name() = 0;
 };
 
-class Literal: public Value { };
+// checked downcast on the kind tag instead of RTTI
+template<typename T> T *value_cast(Value *value) {
+	return value && value->kind() == T::value_kind ?
+		static_cast<T *>(value) : nullptr;
+}
+
+class Literal: public Value {
+		std::string spelling_;
+	protected:
+		Literal(Value_Kind kind, std::string spelling):
+			Value { kind }, spelling_ { std::move(spelling) }
+		{ }
+	public:
+		using Ptr = Literal *;
+		const std::string &spelling() const { return spelling_; }
+		std::string name() override { return spelling_; }
+};
 
 template<typename TRAIT> class Concrete_Literal: public Literal {
+		friend class Arena;
 		typename TRAIT::base_type value_;
 		Concrete_Literal(typename TRAIT::base_type value):
+			Literal { TRAIT::value_kind, TRAIT::spell(value) },
 			value_ { value }
 		{ }
 	public:
-		using Ptr = std::shared_ptr<Concrete_Literal<TRAIT>>;
-		static auto create(typename TRAIT::base_type value) {
-			return Ptr { new Concrete_Literal<TRAIT> { value } };
+		using Ptr = Concrete_Literal<TRAIT> *;
+		static constexpr Value_Kind value_kind { TRAIT::value_kind };
+		static auto create(
+			Arena &arena, typename TRAIT::base_type value
+		) {
+			return arena.create<Concrete_Literal<TRAIT>>(value);
 		}
 		Type::Ptr type() override {
 			return TRAIT::oberon_type;
 		}
 		auto value() const { return value_; }
-		std::string name() override { return std::to_string(value_); }
 };
 
 struct Bool_Trait {
 	using base_type = bool;
+	static constexpr Value_Kind value_kind { Value_Kind::bool_literal };
 	static Type::Ptr oberon_type;
+	static std::string spell(bool value);
 };
 
 using Bool_Literal = Concrete_Literal<Bool_Trait>;
 
 struct Integer_Trait {
 	using base_type = int;
+	static constexpr Value_Kind value_kind { Value_Kind::int_literal };
 	static Type::Ptr oberon_type;
+	static std::string spell(int value);
 };
 
 using Integer_Literal = Concrete_Literal<Integer_Trait>;
 
 struct Real_Trait {
 	using base_type = double;
+	static constexpr Value_Kind value_kind { Value_Kind::real_literal };
 	static Type::Ptr oberon_type;
+	static std::string spell(double value);
 };
 
 using Real_Literal = Concrete_Literal<Real_Trait>;
 
 class Reference: public Value {
+		friend class Arena;
 		int index_;
 		Type::Ptr type_;
 
 		Reference(int index, Type::Ptr type):
-			index_ { index }, type_ { type }
+			Value { Value_Kind::reference }, index_ { index }, type_ { type }
 		{ }
 	public:
-		using Ptr = std::shared_ptr<Reference>;
-		static auto create(int index, Type::Ptr type) {
-			return Ptr { new Reference { index, type } };
+		using Ptr = Reference *;
+		static constexpr Value_Kind value_kind { Value_Kind::reference };
+		static auto create(Arena &arena, int index, Type::Ptr type) {
+			return arena.create<Reference>(index, type);
 		}
 		auto index() const { return index_; }
+		void renumber(int index) { index_ = index; }
 		Type::Ptr type() override { return type_; }
 
 		std::string name() override {
@@ -0,0 +1,220 @@
+#include "vm.h"
+
+#include "err.h"
+#include "run_args.h"
+
+#include <algorithm>
+
+namespace {
+	constexpr size_t stack_slots { 1 << 20 };
+
+	// INTEGER arithmetic wraps around like the 32 bit machine types
+	std::uint32_t bits(std::int32_t value) {
+		return static_cast<std::uint32_t>(value);
+	}
+
+	std::int32_t wrap(std::uint32_t value) {
+		return static_cast<std::int32_t>(value);
+	}
+
+	std::int32_t quotient(std::int32_t a, std::int32_t b) {
+		if (! b) { throw Error { "division by zero" }; }
+		return b == -1 ? wrap(0u - bits(a)) : a / b;
+	}
+
+	std::int32_t remainder(std::int32_t a, std::int32_t b) {
+		if (! b) { throw Error { "division by zero" }; }
+		return b == -1 ? 0 : a % b;
+	}
+
+	// the caller continues at ip with its frame
+	struct Return {
+		const Vm_Instr *ip;
+		Vm_Slot *frame;
+		const Bytecode::Function *function;
+		std::uint16_t result;
+	};
+}
+
+Vm::Vm(const Bytecode &code):
+	code_ { code }, globals_(code.globals),
+	stack_ { new Vm_Slot[stack_slots] }
+{
+	for (const auto &fn : code.functions) {
+		if (! fn.defined) { throw Error { "undefined procedure " + fn.name }; }
+	}
+}
+
+Vm_Slot Vm::execute(size_t function) {
+	static void *const dispatch[] {
+		#define VM_OP_LABEL(name) &&op_##name,
+		VM_OPS(VM_OP_LABEL)
+		#undef VM_OP_LABEL
+	};
+	auto code { code_.code.data() };
+	auto stack_end { stack_.get() + stack_slots };
+	std::vector<Return> returns;
+	auto current { &code_.functions[function] };
+	auto frame { stack_.get() };
+	auto start { code + current->start };
+	auto ip { start };
+
+	#define NEXT() goto *dispatch[static_cast<int>(ip->op)]
+	#define STEP() do { ++ip; NEXT(); } while (false)
+	#define R(field) frame[ip->field]
+	#define INT_OP(name, expr) \
+		op_##name: { \
+			auto a { R(b).i }; auto b { R(c).i }; \
+			R(a).i = (expr); STEP(); \
+		}
+	#define REAL_OP(name, expr) \
+		op_##name: { \
+			auto a { R(b).r }; auto b { R(c).r }; \
+			R(a).r = (expr); STEP(); \
+		}
+	#define REAL_CMP(name, expr) \
+		op_##name: { \
+			auto a { R(b).r }; auto b { R(c).r }; \
+			R(a).i = (expr); STEP(); \
+		}
+	#define JUMP_IF(name, expr) \
+		op_##name: { \
+			auto a { R(a).i }; auto b { R(b).i }; \
+			ip = (expr) ? start + ip->c : ip + 1; NEXT(); \
+		}
+
+	NEXT();
+	op_mov: R(a) = R(b); STEP();
+	op_movnz: if (R(b).i) { R(a) = R(c); } STEP();
+	op_addr: R(a).p = &R(b); STEP();
+	op_global: R(a).p = &globals_[ip->b]; STEP();
+	op_load: R(a) = *R(b).p; STEP();
+	op_store: *R(a).p = R(b); STEP();
+	op_neg_i: R(a).i = wrap(0u - bits(R(b).i)); STEP();
+	op_neg_r: R(a).r = -R(b).r; STEP();
+	op_log_not: R(a).i = R(b).i ^ 1; STEP();
+	INT_OP(add_i, wrap(bits(a) + bits(b)))
+	INT_OP(sub_i, wrap(bits(a) - bits(b)))
+	INT_OP(mul_i, wrap(bits(a) * bits(b)))
+	INT_OP(quot_i, quotient(a, b))
+	INT_OP(rem_i, remainder(a, b))
+	INT_OP(mul_high_i, static_cast<std::int32_t>(
+		(static_cast<std::int64_t>(a) * b) >> 32
+	))
+	INT_OP(shl_i, wrap(bits(a) << (b & 31)))
+	INT_OP(ashr_i, a >> (b & 31))
+	INT_OP(lshr_i, wrap(bits(a) >> (b & 31)))
+	INT_OP(and_i, a & b)
+	INT_OP(or_i, a | b)
+	INT_OP(xor_i, a ^ b)
+	REAL_OP(add_r, a + b)
+	REAL_OP(sub_r, a - b)
+	REAL_OP(mul_r, a * b)
+	INT_OP(eq_i, a == b)
+	INT_OP(ne_i, a != b)
+	INT_OP(lt_i, a < b)
+	INT_OP(le_i, a <= b)
+	INT_OP(gt_i, a > b)
+	INT_OP(ge_i, a >= b)
+	REAL_CMP(eq_r, a == b)
+	REAL_CMP(ne_r, a < b || a > b)
+	REAL_CMP(lt_r, a < b)
+	REAL_CMP(le_r, a <= b)
+	REAL_CMP(gt_r, a > b)
+	REAL_CMP(ge_r, a >= b)
+	op_jmp: ip = start + ip->a; NEXT();
+	op_jz: ip = R(a).i ? ip + 1 : start + ip->b; NEXT();
+	op_jnz: ip = R(a).i ? start + ip->b : ip + 1; NEXT();
+	JUMP_IF(jeq_i, a == b)
+	JUMP_IF(jne_i, a != b)
+	JUMP_IF(jlt_i, a < b)
+	JUMP_IF(jle_i, a <= b)
+	JUMP_IF(jgt_i, a > b)
+	JUMP_IF(jge_i, a >= b)
+	op_call: {
+		auto &callee { code_.functions[ip->b] };
+		auto next { frame + current->frame };
+		if (callee.frame > stack_end - next) {
+			throw Error { "stack overflow in " + callee.name };
+		}
+		auto args { reinterpret_cast<const std::uint16_t *>(ip + 1) };
+		for (int i { 0 }; i < ip->c; ++i) {
+			next[callee.params[i]] = frame[args[i]];
+		}
+		std::copy(
+			callee.constants.begin(), callee.constants.end(),
+			next + callee.first_constant
+		);
+		returns.push_back({
+			ip + 1 + (ip->c + 3) / 4, frame, current, ip->a
+		});
+		frame = next;
+		current = &callee;
+		start = ip = code + callee.start;
+		NEXT();
+	}
+	op_ret:
+	op_ret_void: {
+		Vm_Slot value { };
+		if (ip->op == Vm_Op::ret) { value = R(a); }
+		if (returns.empty()) { return value; }
+		auto &back { returns.back() };
+		ip = back.ip;
+		frame = back.frame;
+		current = back.function;
+		start = code + current->start;
+		if (back.result != Bytecode::no_register) {
+			frame[back.result] = value;
+		}
+		returns.pop_back();
+		NEXT();
+	}
+	#undef JUMP_IF
+	#undef REAL_CMP
+	#undef REAL_OP
+	#undef INT_OP
+	#undef R
+	#undef STEP
+	#undef NEXT
+}
+
+std::string Vm::call(
+	const std::string &name, const std::vector<std::string> &args
+) {
+	using Value_Class = Object_Code::Value_Class;
+	auto fn { std::find_if(
+		code_.functions.begin(), code_.functions.end(),
+		[&](const auto &fn) { return fn.name == name; }
+	) };
+	if (fn == code_.functions.end()) {
+		throw Error { "no procedure " + name };
+	}
+	if (args.size() != fn->params.size()) {
+		throw Error {
+			name + " expects " + std::to_string(fn->params.size()) +
+			" arguments"
+		};
+	}
+	if (static_cast<size_t>(fn->frame) > stack_slots) {
+		throw Error { "stack overflow in " + name };
+	}
+	auto frame { stack_.get() };
+	for (size_t i { 0 }; i < args.size(); ++i) {
+		auto &slot { frame[fn->params[i]] };
+		switch (fn->param_classes[i]) {
+			case Value_Class::address:
+				throw Error { "cannot pass VAR parameters to " + name };
+			case Value_Class::real:
+				slot.r = parse_real_arg(args[i]);
+				break;
+			default:
+				slot.i = parse_int_arg(fn->param_classes[i], args[i]);
+		}
+	}
+	std::copy(
+		fn->constants.begin(), fn->constants.end(),
+		frame + fn->first_constant
+	);
+	auto got { execute(fn - code_.functions.begin()) };
+	return print_result(fn->result, got.i, got.r);
+}
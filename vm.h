@@ -0,0 +1,84 @@
+#pragma once
+
+#include "object_file.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// the operations of the bytecode; a, b and c name registers of the
+// frame unless noted: addr takes a local variable, global a module
+// variable, the jumps a target in the function, call a function index
+#define VM_OPS(X) \
+	X(mov) X(movnz) X(addr) X(global) X(load) X(store) \
+	X(neg_i) X(neg_r) X(log_not) \
+	X(add_i) X(sub_i) X(mul_i) X(quot_i) X(rem_i) X(mul_high_i) \
+	X(shl_i) X(ashr_i) X(lshr_i) X(and_i) X(or_i) X(xor_i) \
+	X(add_r) X(sub_r) X(mul_r) \
+	X(eq_i) X(ne_i) X(lt_i) X(le_i) X(gt_i) X(ge_i) \
+	X(eq_r) X(ne_r) X(lt_r) X(le_r) X(gt_r) X(ge_r) \
+	X(jmp) X(jz) X(jnz) \
+	X(jeq_i) X(jne_i) X(jlt_i) X(jle_i) X(jgt_i) X(jge_i) \
+	X(call) X(ret) X(ret_void)
+
+enum class Vm_Op: std::uint16_t {
+	#define VM_OP_ENUM(name) name,
+	VM_OPS(VM_OP_ENUM)
+	#undef VM_OP_ENUM
+};
+
+// a register or a variable; INTEGER and BOOLEAN use i
+union Vm_Slot {
+	std::int32_t i;
+	double r;
+	Vm_Slot *p;
+};
+
+// a call is followed by its argument registers, four per instruction
+struct Vm_Instr {
+	Vm_Op op;
+	std::uint16_t a, b, c;
+};
+
+// bytecode of a module; a function runs in a frame of registers that
+// holds its values, its local variables, its constants and the
+// temporaries of phi moves in this order
+struct Bytecode {
+	static constexpr std::uint16_t no_register { 0xffff };
+
+	struct Function {
+		std::string name;
+		bool defined { false };
+		size_t start { 0 };
+		int frame { 0 };
+		std::vector<std::uint16_t> params;
+		int first_constant { 0 };
+		std::vector<Vm_Slot> constants;
+		std::vector<Object_Code::Value_Class> param_classes;
+		Object_Code::Value_Class result { Object_Code::Value_Class::none };
+	};
+
+	std::vector<Vm_Instr> code;
+	std::vector<Function> functions;
+	size_t globals { 0 };
+};
+
+// interprets bytecode with threaded dispatch; all frames share one
+// preallocated stack
+class Vm {
+		const Bytecode &code_;
+		std::vector<Vm_Slot> globals_;
+		std::unique_ptr<Vm_Slot[]> stack_;
+
+		Vm_Slot execute(size_t function);
+	public:
+		explicit Vm(const Bytecode &code);
+
+		// calls a function with arguments written as INTEGER, REAL or
+		// BOOLEAN literals; returns the printed result, or an empty
+		// string for proper procedures
+		std::string call(
+			const std::string &name, const std::vector<std::string> &args
+		);
+};
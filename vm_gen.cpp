@@ -0,0 +1,672 @@
+#include "vm_gen.h"
+
+#include "err.h"
+#include "fold.h"
+#include "ir.h"
+#include "run_args.h"
+
+#include <algorithm>
+#include <unordered_map>
+
+namespace {
+	struct Node {
+		Opcode opcode;
+		Reference::Ptr result { nullptr };
+		std::vector<Value::Ptr> operands;
+		std::vector<int> incoming;
+		int targets[2] { -1, -1 };
+		Binary_Op binary_op { Binary_Op::add };
+		Unary_Op unary_op { Unary_Op::neg };
+		int callee { -1 };
+		std::vector<bool> by_reference;
+		int cell { -1 };
+
+		bool is_terminator() const {
+			return opcode == Opcode::branch ||
+				opcode == Opcode::conditional || opcode == Opcode::ret;
+		}
+	};
+
+	struct Block {
+		std::vector<Node> nodes;
+		int label { -1 };
+	};
+
+	// a jump whose target is written once the label is bound
+	struct Fixup {
+		size_t at;
+		std::uint16_t Vm_Instr::*field;
+		int label;
+	};
+
+	using Moves = std::vector<std::pair<int, int>>;
+
+	bool is_real(Value::Ptr value) { return value->type() == real_type; }
+
+	Vm_Op int_op(Binary_Op op) {
+		switch (op) {
+			case Binary_Op::add: return Vm_Op::add_i;
+			case Binary_Op::sub: return Vm_Op::sub_i;
+			case Binary_Op::mul: return Vm_Op::mul_i;
+			case Binary_Op::quot: return Vm_Op::quot_i;
+			case Binary_Op::rem: return Vm_Op::rem_i;
+			case Binary_Op::mul_high: return Vm_Op::mul_high_i;
+			case Binary_Op::shl: return Vm_Op::shl_i;
+			case Binary_Op::ashr: return Vm_Op::ashr_i;
+			case Binary_Op::lshr: return Vm_Op::lshr_i;
+			case Binary_Op::bit_and: case Binary_Op::log_and:
+				return Vm_Op::and_i;
+			case Binary_Op::bit_or: case Binary_Op::log_or:
+				return Vm_Op::or_i;
+			case Binary_Op::bit_xor: return Vm_Op::xor_i;
+			case Binary_Op::equal: return Vm_Op::eq_i;
+			case Binary_Op::not_equal: return Vm_Op::ne_i;
+			case Binary_Op::less: return Vm_Op::lt_i;
+			case Binary_Op::less_equal: return Vm_Op::le_i;
+			case Binary_Op::greater: return Vm_Op::gt_i;
+			case Binary_Op::greater_equal: return Vm_Op::ge_i;
+			default:
+				throw Error {
+					std::string { "no bytecode for " } +
+					binary_operator(op).name
+				};
+		}
+	}
+
+	Vm_Op real_op(Binary_Op op) {
+		switch (op) {
+			case Binary_Op::add: return Vm_Op::add_r;
+			case Binary_Op::sub: return Vm_Op::sub_r;
+			case Binary_Op::mul: return Vm_Op::mul_r;
+			case Binary_Op::equal: return Vm_Op::eq_r;
+			case Binary_Op::not_equal: return Vm_Op::ne_r;
+			case Binary_Op::less: return Vm_Op::lt_r;
+			case Binary_Op::less_equal: return Vm_Op::le_r;
+			case Binary_Op::greater: return Vm_Op::gt_r;
+			case Binary_Op::greater_equal: return Vm_Op::ge_r;
+			default:
+				throw Error {
+					std::string { "no REAL bytecode for " } +
+					binary_operator(op).name
+				};
+		}
+	}
+
+	// the jump taken when an INTEGER compare is true, or false
+	Vm_Op jump_op(Binary_Op op, bool when) {
+		switch (op) {
+			case Binary_Op::equal:
+				return when ? Vm_Op::jeq_i : Vm_Op::jne_i;
+			case Binary_Op::not_equal:
+				return when ? Vm_Op::jne_i : Vm_Op::jeq_i;
+			case Binary_Op::less:
+				return when ? Vm_Op::jlt_i : Vm_Op::jge_i;
+			case Binary_Op::less_equal:
+				return when ? Vm_Op::jle_i : Vm_Op::jgt_i;
+			case Binary_Op::greater:
+				return when ? Vm_Op::jgt_i : Vm_Op::jle_i;
+			default:
+				return when ? Vm_Op::jge_i : Vm_Op::jlt_i;
+		}
+	}
+}
+
+struct Vm_Gen::State {
+	Bytecode code;
+	std::unordered_map<std::string, int> functions;
+	std::unordered_map<Reference::Ptr, int> globals;
+
+	// the function being compiled
+	std::string name;
+	Type::Ptr returns { nullptr };
+	std::vector<Parameter> params;
+	std::vector<Block> blocks;
+	std::vector<int> layout;
+	std::unordered_map<std::string, int> block_index;
+	int current { -1 };
+	int values { 0 };
+	int cells { 0 };
+
+	// registers of the literals and the first temporary
+	std::unordered_map<Value::Ptr, int> constants;
+	int first_temp { 0 };
+	int temp(size_t i) const { return first_temp + static_cast<int>(i); }
+	std::vector<int> uses;
+	size_t start { 0 };
+	std::vector<int> labels;
+	std::vector<Fixup> fixups;
+
+	int function(std::string_view name);
+	int block(const Label &label);
+	int result(Reference::Ptr ref);
+	Node *add(Opcode opcode);
+
+	bool is_global(Value::Ptr value) const {
+		auto ref { value_cast<Reference>(value) };
+		return ref && globals.count(ref);
+	}
+	std::uint16_t u16(int value) const;
+	int reg(Value::Ptr value) const;
+	size_t emit(Vm_Op op, int a = 0, int b = 0, int c = 0);
+	int new_label() {
+		labels.push_back(-1);
+		return labels.size() - 1;
+	}
+	void bind(int label) { labels[label] = code.code.size() - start; }
+	void jump(int label);
+	int address(Value::Ptr ptr, int temp);
+
+	void prepare();
+	void generate();
+	Moves edge_moves(int from, int to);
+	void emit_moves(const Moves &moves);
+	void jump_if(
+		const Node *compare, Value::Ptr condition, bool when, int label
+	);
+	void emit_conditional(
+		const Node &node, const Node *compare, int next
+	);
+	void emit_call(const Node &node);
+	void emit_binary(const Node &node);
+};
+
+int Vm_Gen::State::function(std::string_view name) {
+	auto [got, added] { functions.emplace(
+		std::string { name }, static_cast<int>(code.functions.size())
+	) };
+	if (added) {
+		code.functions.emplace_back();
+		code.functions.back().name = name;
+	}
+	return got->second;
+}
+
+int Vm_Gen::State::block(const Label &label) {
+	auto [got, added] { block_index.emplace(
+		label_name(label), static_cast<int>(blocks.size())
+	) };
+	if (added) { blocks.emplace_back(); }
+	return got->second;
+}
+
+int Vm_Gen::State::result(Reference::Ptr ref) {
+	values = std::max(values, ref->index() + 1);
+	return ref->index();
+}
+
+// instructions after a terminator are unreachable
+Node *Vm_Gen::State::add(Opcode opcode) {
+	if (current < 0) { return nullptr; }
+	auto &nodes { blocks[current].nodes };
+	if (! nodes.empty() && nodes.back().is_terminator()) { return nullptr; }
+	nodes.emplace_back();
+	nodes.back().opcode = opcode;
+	return &nodes.back();
+}
+
+std::uint16_t Vm_Gen::State::u16(int value) const {
+	if (value < 0 || value >= Bytecode::no_register) {
+		throw Error { name + " is too large for the bytecode" };
+	}
+	return value;
+}
+
+int Vm_Gen::State::reg(Value::Ptr value) const {
+	if (auto ref { value_cast<Reference>(value) }) { return ref->index(); }
+	return constants.at(value);
+}
+
+size_t Vm_Gen::State::emit(Vm_Op op, int a, int b, int c) {
+	code.code.push_back({ op, u16(a), u16(b), u16(c) });
+	return code.code.size() - 1;
+}
+
+void Vm_Gen::State::jump(int label) {
+	fixups.push_back({ emit(Vm_Op::jmp), &Vm_Instr::a, label });
+}
+
+// module variables are addressed through a temporary
+int Vm_Gen::State::address(Value::Ptr ptr, int temp) {
+	if (! is_global(ptr)) { return reg(ptr); }
+	auto ref { static_cast<Reference *>(ptr) };
+	emit(Vm_Op::global, temp, globals.at(ref));
+	return temp;
+}
+
+// counts the uses and gives every literal a register after the
+// variables, followed by the temporaries
+void Vm_Gen::State::prepare() {
+	uses.assign(values, 0);
+	constants.clear();
+	auto &slots { code.functions[function(name)].constants };
+	slots.clear();
+	int temps { 1 };
+	for (const auto &block : blocks) {
+		int phis { 0 };
+		for (const auto &node : block.nodes) {
+			int global_args { 0 };
+			for (auto value : node.operands) {
+				if (is_global(value)) {
+					++global_args;
+				} else if (auto ref { value_cast<Reference>(value) }) {
+					++uses[ref->index()];
+				} else if (! constants.count(value)) {
+					constants[value] = values + cells + slots.size();
+					Vm_Slot slot { };
+					if (auto i { value_cast<Integer_Literal>(value) }) {
+						slot.i = i->value();
+					} else if (auto b { value_cast<Bool_Literal>(value) }) {
+						slot.i = b->value();
+					} else if (auto r { value_cast<Real_Literal>(value) }) {
+						slot.r = r->value();
+					}
+					slots.push_back(slot);
+				}
+			}
+			if (node.opcode == Opcode::phi) { ++phis; }
+			temps = std::max({ temps, phis, global_args });
+		}
+	}
+	first_temp = values + cells + slots.size();
+	u16(first_temp + temps);
+	auto &fn { code.functions[function(name)] };
+	fn.first_constant = values + cells;
+	fn.frame = first_temp + temps;
+}
+
+// the moves into the phis of to when coming from; they happen at
+// once, so sources that are also targets go through temporaries
+Moves Vm_Gen::State::edge_moves(int from, int to) {
+	Moves moves;
+	for (const auto &node : blocks[to].nodes) {
+		if (node.opcode != Opcode::phi) { continue; }
+		for (size_t i { 0 }; i < node.incoming.size(); ++i) {
+			if (node.incoming[i] != from) { continue; }
+			auto src { reg(node.operands[i]) };
+			auto dst { node.result->index() };
+			if (src != dst) { moves.push_back({ dst, src }); }
+		}
+	}
+	bool overlaps { false };
+	for (const auto &move : moves) {
+		for (const auto &other : moves) {
+			if (move.second == other.first) { overlaps = true; }
+		}
+	}
+	if (overlaps) {
+		Moves staged;
+		for (size_t i { 0 }; i < moves.size(); ++i) {
+			staged.push_back({ temp(i), moves[i].second });
+		}
+		for (size_t i { 0 }; i < moves.size(); ++i) {
+			staged.push_back({ moves[i].first, temp(i) });
+		}
+		return staged;
+	}
+	return moves;
+}
+
+void Vm_Gen::State::emit_moves(const Moves &moves) {
+	for (const auto &move : moves) {
+		emit(Vm_Op::mov, move.first, move.second);
+	}
+}
+
+// a compare that only feeds the branch becomes part of the jump
+void Vm_Gen::State::jump_if(
+	const Node *compare, Value::Ptr condition, bool when, int label
+) {
+	if (compare) {
+		fixups.push_back({ emit(
+			jump_op(compare->binary_op, when),
+			reg(compare->operands[0]), reg(compare->operands[1])
+		), &Vm_Instr::c, label });
+		return;
+	}
+	fixups.push_back({ emit(
+		when ? Vm_Op::jnz : Vm_Op::jz, reg(condition)
+	), &Vm_Instr::b, label });
+}
+
+void Vm_Gen::State::emit_conditional(
+	const Node &node, const Node *compare, int next
+) {
+	auto condition { node.operands[0] };
+	auto if_true { node.targets[0] };
+	auto if_false { node.targets[1] };
+	auto true_moves { edge_moves(current, if_true) };
+	auto false_moves { edge_moves(current, if_false) };
+	auto true_label { blocks[if_true].label };
+	auto false_label { blocks[if_false].label };
+	if (true_moves.empty() && false_moves.empty()) {
+		if (if_false == next) {
+			jump_if(compare, condition, true, true_label);
+		} else if (if_true == next) {
+			jump_if(compare, condition, false, false_label);
+		} else {
+			jump_if(compare, condition, true, true_label);
+			jump(false_label);
+		}
+	} else if (false_moves.empty()) {
+		jump_if(compare, condition, false, false_label);
+		emit_moves(true_moves);
+		if (if_true != next) { jump(true_label); }
+	} else if (true_moves.empty()) {
+		jump_if(compare, condition, true, true_label);
+		emit_moves(false_moves);
+		if (if_false != next) { jump(false_label); }
+	} else {
+		auto other { new_label() };
+		jump_if(compare, condition, false, other);
+		emit_moves(true_moves);
+		jump(true_label);
+		bind(other);
+		emit_moves(false_moves);
+		if (if_false != next) { jump(false_label); }
+	}
+}
+
+// the argument registers follow the call, four per instruction
+void Vm_Gen::State::emit_call(const Node &node) {
+	std::vector<int> args;
+	int temp { first_temp };
+	for (auto value : node.operands) {
+		args.push_back(address(value, temp));
+		if (is_global(value)) { ++temp; }
+	}
+	auto at { emit(Vm_Op::call, 0, node.callee, args.size()) };
+	code.code[at].a = node.result ?
+		u16(node.result->index()) : Bytecode::no_register;
+	for (size_t i { 0 }; i < args.size(); i += 4) {
+		std::uint16_t words[4] { };
+		for (size_t j { i }; j < args.size() && j < i + 4; ++j) {
+			words[j - i] = u16(args[j]);
+		}
+		code.code.push_back({
+			static_cast<Vm_Op>(words[0]), words[1], words[2], words[3]
+		});
+	}
+}
+
+void Vm_Gen::State::emit_binary(const Node &node) {
+	auto left { node.operands[0] };
+	auto op { is_real(left) ? real_op(node.binary_op) :
+		int_op(node.binary_op)
+	};
+	emit(
+		op, node.result->index(), reg(left), reg(node.operands[1])
+	);
+}
+
+void Vm_Gen::State::generate() {
+	prepare();
+	start = code.code.size();
+	labels.clear();
+	fixups.clear();
+	for (auto &block : blocks) { block.label = new_label(); }
+
+	for (size_t l { 0 }; l < layout.size(); ++l) {
+		current = layout[l];
+		auto next { l + 1 < layout.size() ? layout[l + 1] : -1 };
+		auto &nodes { blocks[current].nodes };
+		bind(blocks[current].label);
+		const Node *compare { nullptr };
+		for (size_t i { 0 }; i < nodes.size(); ++i) {
+			const auto &node { nodes[i] };
+			switch (node.opcode) {
+				case Opcode::phi:
+					break;
+				case Opcode::alloca:
+					emit(
+						Vm_Op::addr, node.result->index(),
+						values + node.cell
+					);
+					break;
+				case Opcode::load:
+					emit(
+						Vm_Op::load, node.result->index(),
+						address(node.operands[0], first_temp)
+					);
+					break;
+				case Opcode::store:
+					emit(
+						Vm_Op::store, address(node.operands[1], first_temp),
+						reg(node.operands[0])
+					);
+					break;
+				case Opcode::unary:
+					emit(
+						node.unary_op == Unary_Op::log_not ?
+							Vm_Op::log_not : is_real(node.operands[0]) ?
+							Vm_Op::neg_r : Vm_Op::neg_i,
+						node.result->index(), reg(node.operands[0])
+					);
+					break;
+				case Opcode::binary: {
+					auto following {
+						i + 1 < nodes.size() ? &nodes[i + 1] : nullptr
+					};
+					if (
+						binary_operator(node.binary_op).predicate &&
+						! is_real(node.operands[0]) && following &&
+						following->opcode == Opcode::conditional &&
+						following->operands[0] == node.result &&
+						uses[node.result->index()] == 1
+					) {
+						compare = &node;
+						break;
+					}
+					emit_binary(node);
+					break;
+				}
+				case Opcode::select:
+					emit(
+						Vm_Op::mov, node.result->index(),
+						reg(node.operands[2])
+					);
+					emit(
+						Vm_Op::movnz, node.result->index(),
+						reg(node.operands[0]), reg(node.operands[1])
+					);
+					break;
+				case Opcode::call:
+					emit_call(node);
+					break;
+				case Opcode::branch: {
+					emit_moves(edge_moves(current, node.targets[0]));
+					if (node.targets[0] != next) {
+						jump(blocks[node.targets[0]].label);
+					}
+					break;
+				}
+				case Opcode::conditional:
+					emit_conditional(node, compare, next);
+					break;
+				case Opcode::ret:
+					if (node.operands.empty()) {
+						emit(Vm_Op::ret_void);
+					} else {
+						emit(Vm_Op::ret, reg(node.operands[0]));
+					}
+					break;
+			}
+		}
+	}
+	for (const auto &fixup : fixups) {
+		code.code[fixup.at].*fixup.field = u16(labels[fixup.label]);
+	}
+
+	auto &fn { code.functions[function(name)] };
+	fn.defined = true;
+	fn.start = start;
+	fn.params.clear();
+	fn.param_classes.clear();
+	for (const auto &param : params) {
+		fn.params.push_back(u16(param.ref->index()));
+		fn.param_classes.push_back(param.by_reference ?
+			Object_Code::Value_Class::address :
+			value_class(param.ref->type())
+		);
+	}
+	fn.result = value_class(returns);
+}
+
+Vm_Gen::Vm_Gen(): state_ { std::make_unique<State>() } { }
+
+Vm_Gen::~Vm_Gen() { }
+
+void Vm_Gen::define(
+	std::string_view name, Type::Ptr returns,
+	const std::vector<Parameter> &params, bool
+) {
+	auto &s { *state_ };
+	s.name = name;
+	s.returns = returns;
+	s.params = params;
+	s.blocks.clear();
+	s.layout.clear();
+	s.block_index.clear();
+	s.current = -1;
+	s.values = s.cells = 0;
+	for (const auto &param : params) { s.result(param.ref); }
+}
+
+void Vm_Gen::end_define() {
+	auto &s { *state_ };
+	s.generate();
+	s.name.clear();
+	s.current = -1;
+}
+
+void Vm_Gen::def_label(const Label &label) {
+	auto &s { *state_ };
+	s.current = s.block(label);
+	s.layout.push_back(s.current);
+}
+
+void Vm_Gen::branch(const Label &label) {
+	auto &s { *state_ };
+	auto target { s.block(label) };
+	if (auto node { s.add(Opcode::branch) }) { node->targets[0] = target; }
+}
+
+void Vm_Gen::conditional(
+	Value::Ptr value, const Label &true_label, const Label &false_label
+) {
+	auto &s { *state_ };
+	auto if_true { s.block(true_label) };
+	auto if_false { s.block(false_label) };
+	if (auto node { s.add(Opcode::conditional) }) {
+		node->operands = { value };
+		node->targets[0] = if_true;
+		node->targets[1] = if_false;
+	}
+}
+
+void Vm_Gen::ret() { state_->add(Opcode::ret); }
+
+void Vm_Gen::ret(Value::Ptr value) {
+	if (auto node { state_->add(Opcode::ret) }) { node->operands = { value }; }
+}
+
+// module variables are slots of the vm, local variables cells after
+// the values of the frame
+void Vm_Gen::alloca(Reference::Ptr ref) {
+	auto &s { *state_ };
+	if (s.name.empty()) {
+		s.globals[ref] = s.code.globals++;
+		return;
+	}
+	if (auto node { s.add(Opcode::alloca) }) {
+		node->result = ref;
+		node->cell = s.cells++;
+		s.result(ref);
+	}
+}
+
+void Vm_Gen::load(Reference::Ptr result, Reference::Ptr ptr) {
+	auto &s { *state_ };
+	if (auto node { s.add(Opcode::load) }) {
+		node->result = result;
+		node->operands = { ptr };
+		s.result(result);
+	}
+}
+
+void Vm_Gen::store(Value::Ptr value, Reference::Ptr ptr) {
+	if (auto node { state_->add(Opcode::store) }) {
+		node->operands = { value, ptr };
+	}
+}
+
+void Vm_Gen::unary(Reference::Ptr result, Unary_Op op, Value::Ptr value) {
+	auto &s { *state_ };
+	if (auto node { s.add(Opcode::unary) }) {
+		node->result = result;
+		node->unary_op = op;
+		node->operands = { value };
+		s.result(result);
+	}
+}
+
+void Vm_Gen::binary(
+	Reference::Ptr result, Binary_Op op, Value::Ptr left, Value::Ptr right
+) {
+	auto &s { *state_ };
+	if (auto node { s.add(Opcode::binary) }) {
+		node->result = result;
+		node->binary_op = op;
+		node->operands = { left, right };
+		s.result(result);
+	}
+}
+
+void Vm_Gen::phi(
+	Reference::Ptr result,
+	const std::vector<std::pair<Value::Ptr, Label>> &incoming
+) {
+	auto &s { *state_ };
+	std::vector<int> from;
+	for (const auto &entry : incoming) {
+		from.push_back(s.block(entry.second));
+	}
+	if (auto node { s.add(Opcode::phi) }) {
+		node->result = result;
+		for (const auto &entry : incoming) {
+			node->operands.push_back(entry.first);
+		}
+		node->incoming = std::move(from);
+		s.result(result);
+	}
+}
+
+void Vm_Gen::select(
+	Reference::Ptr result, Value::Ptr condition,
+	Value::Ptr if_true, Value::Ptr if_false
+) {
+	auto &s { *state_ };
+	if (auto node { s.add(Opcode::select) }) {
+		node->result = result;
+		node->operands = { condition, if_true, if_false };
+		s.result(result);
+	}
+}
+
+void Vm_Gen::call(
+	Reference::Ptr result, std::string_view name,
+	const std::vector<Argument> &args
+) {
+	auto &s { *state_ };
+	auto callee { s.function(name) };
+	if (auto node { s.add(Opcode::call) }) {
+		node->result = result;
+		node->callee = callee;
+		for (const auto &arg : args) {
+			node->operands.push_back(arg.value);
+			node->by_reference.push_back(arg.by_reference);
+		}
+		if (result) { s.result(result); }
+	}
+}
+
+const Bytecode &Vm_Gen::code() const { return state_->code; }
@@ -0,0 +1,251 @@
+#include "x86_asm.h"
+
+using namespace x86;
+
+namespace {
+	bool fits8(std::int64_t value) { return value >= -128 && value < 128; }
+
+	bool fits32(std::int64_t value) {
+		return value >= INT32_MIN && value <= INT32_MAX;
+	}
+}
+
+void X86_Asm::imm32(std::int64_t value) {
+	for (int i { 0 }; i < 4; ++i) { byte(value >> (8 * i)); }
+}
+
+// byte registers 4 to 7 mean spl to dil only with a prefix
+void X86_Asm::rex(int size, int reg, const Operand &rm, bool force) {
+	int bits { 0x40 };
+	if (size == 64) { bits |= 8; }
+	if (reg >= 8) { bits |= 4; }
+	if (rm.kind != Operand::Kind::rip && rm.kind != Operand::Kind::imm &&
+		rm.reg >= 8
+	) {
+		bits |= 1;
+	}
+	if (bits != 0x40 || force) { byte(bits); }
+}
+
+void X86_Asm::modrm(int reg, const Operand &rm) {
+	reg = (reg & 7) << 3;
+	switch (rm.kind) {
+		case Operand::Kind::reg:
+			byte(0xc0 | reg | (rm.reg & 7));
+			return;
+		case Operand::Kind::rip:
+			byte(0x05 | reg);
+			code_.relocations.push_back({
+				Object_Code::Relocation::Kind::data, offset(), { },
+				rm.value - 4
+			});
+			imm32(0);
+			return;
+		default:
+			break;
+	}
+	auto base { rm.reg & 7 };
+	int mod { 2 };
+	if (rm.value == 0 && base != rbp) {
+		mod = 0;
+	} else if (fits8(rm.value)) {
+		mod = 1;
+	}
+	byte((mod << 6) | reg | base);
+	if (base == rsp) { byte(0x24); }
+	if (mod == 1) {
+		byte(rm.value);
+	} else if (mod == 2) {
+		imm32(rm.value);
+	}
+}
+
+void X86_Asm::op(
+	int size, std::initializer_list<int> opcode, int reg,
+	const Operand &rm, int prefix
+) {
+	if (prefix) { byte(prefix); }
+	bool low_byte {
+		size == 8 && ((rm.is_reg() && rm.reg >= 4) || reg >= 4)
+	};
+	rex(size, reg, rm, low_byte);
+	for (auto b : opcode) { byte(b); }
+	modrm(reg, rm);
+}
+
+int X86_Asm::new_label() {
+	labels_.push_back(-1);
+	return labels_.size() - 1;
+}
+
+void X86_Asm::bind(int label) { labels_[label] = offset(); }
+
+void X86_Asm::rel32(int label) {
+	fixups_.push_back({ offset(), label });
+	imm32(0);
+}
+
+void X86_Asm::resolve() {
+	for (const auto &fixup : fixups_) {
+		std::int64_t distance { labels_[fixup.label] - (
+			static_cast<std::int64_t>(fixup.at) + 4
+		) };
+		for (int i { 0 }; i < 4; ++i) {
+			code_.text[fixup.at + i] = distance >> (8 * i);
+		}
+	}
+	fixups_.clear();
+}
+
+void X86_Asm::mov(int size, const Operand &dst, const Operand &src) {
+	auto byte_op { size == 8 };
+	if (src.is_reg()) {
+		op(size, { byte_op ? 0x88 : 0x89 }, src.reg, dst);
+	} else if (src.is_memory()) {
+		op(size, { byte_op ? 0x8a : 0x8b }, dst.reg, src);
+	} else if (dst.is_reg() && (size != 64 || ! fits32(src.value))) {
+		rex(size, 0, dst, false);
+		byte(0xb8 + (dst.reg & 7));
+		if (size == 64) {
+			imm32(src.value);
+			imm32(src.value >> 32);
+		} else {
+			imm32(src.value);
+		}
+	} else if (byte_op) {
+		op(size, { 0xc6 }, 0, dst);
+		byte(src.value);
+	} else {
+		op(size, { 0xc7 }, 0, dst);
+		imm32(src.value);
+	}
+}
+
+void X86_Asm::movzx8(int dst, const Operand &src) {
+	rex(32, dst, src, src.is_reg() && src.reg >= 4);
+	byte(0x0f); byte(0xb6);
+	modrm(dst, src);
+}
+
+void X86_Asm::movsxd(int dst, const Operand &src) {
+	op(64, { 0x63 }, dst, src);
+}
+
+void X86_Asm::lea(int dst, const Operand &src) {
+	op(64, { 0x8d }, dst, src);
+}
+
+void X86_Asm::alu(Alu alu, int size, const Operand &dst, const Operand &src) {
+	if (src.is_imm()) {
+		if (fits8(src.value)) {
+			op(size, { 0x83 }, alu, dst);
+			byte(src.value);
+		} else {
+			op(size, { 0x81 }, alu, dst);
+			imm32(src.value);
+		}
+	} else if (src.is_reg()) {
+		op(size, { alu * 8 + 1 }, src.reg, dst);
+	} else {
+		op(size, { alu * 8 + 3 }, dst.reg, src);
+	}
+}
+
+void X86_Asm::test(int size, int a, int b) {
+	op(size, { 0x85 }, b, Operand::r(a));
+}
+
+void X86_Asm::imul(int size, int dst, const Operand &src) {
+	op(size, { 0x0f, 0xaf }, dst, src);
+}
+
+void X86_Asm::imul(int size, int dst, const Operand &src, int value) {
+	if (fits8(value)) {
+		op(size, { 0x6b }, dst, src);
+		byte(value);
+	} else {
+		op(size, { 0x69 }, dst, src);
+		imm32(value);
+	}
+}
+
+void X86_Asm::shift(Shift shift, int size, int reg, int count) {
+	op(size, { 0xc1 }, shift, Operand::r(reg));
+	byte(count);
+}
+
+void X86_Asm::shift_cl(Shift shift, int size, int reg) {
+	op(size, { 0xd3 }, shift, Operand::r(reg));
+}
+
+void X86_Asm::neg(int size, int reg) {
+	op(size, { 0xf7 }, 3, Operand::r(reg));
+}
+
+void X86_Asm::cdq() { byte(0x99); }
+
+void X86_Asm::idiv(int size, const Operand &src) {
+	op(size, { 0xf7 }, 7, src);
+}
+
+void X86_Asm::setcc(Cond cc, int reg) {
+	op(8, { 0x0f, 0x90 + cc }, 0, Operand::r(reg));
+}
+
+void X86_Asm::cmov(Cond cc, int size, int dst, const Operand &src) {
+	op(size, { 0x0f, 0x40 + cc }, dst, src);
+}
+
+void X86_Asm::push(int reg) {
+	if (reg >= 8) { byte(0x41); }
+	byte(0x50 + (reg & 7));
+}
+
+void X86_Asm::pop(int reg) {
+	if (reg >= 8) { byte(0x41); }
+	byte(0x58 + (reg & 7));
+}
+
+void X86_Asm::jmp(int label) {
+	byte(0xe9);
+	rel32(label);
+}
+
+void X86_Asm::jcc(Cond cc, int label) {
+	byte(0x0f); byte(0x80 + cc);
+	rel32(label);
+}
+
+void X86_Asm::call(const std::string &symbol) {
+	byte(0xe8);
+	code_.relocations.push_back({
+		Object_Code::Relocation::Kind::call, offset(), symbol, -4
+	});
+	imm32(0);
+}
+
+void X86_Asm::movsd(const Operand &dst, const Operand &src) {
+	if (dst.is_reg() && src.is_reg()) {
+		op(32, { 0x0f, 0x28 }, dst.reg, src);
+	} else if (dst.is_reg()) {
+		op(32, { 0x0f, 0x10 }, dst.reg, src, 0xf2);
+	} else {
+		op(32, { 0x0f, 0x11 }, src.reg, dst, 0xf2);
+	}
+}
+
+void X86_Asm::sse(Sse sse, int dst, const Operand &src) {
+	op(32, { 0x0f, sse }, dst, src, 0xf2);
+}
+
+void X86_Asm::ucomisd(int a, const Operand &b) {
+	op(32, { 0x0f, 0x2e }, a, b, 0x66);
+}
+
+void X86_Asm::xorpd(int dst, int src) {
+	op(32, { 0x0f, 0x57 }, dst, Operand::r(src), 0x66);
+}
+
+void X86_Asm::movq_to_xmm(int dst, int src) {
+	op(64, { 0x0f, 0x6e }, dst, Operand::r(src), 0x66);
+}
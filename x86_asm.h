@@ -0,0 +1,128 @@
+#pragma once
+
+#include "object_file.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// encoder for the x86-64 instructions the native backend selects;
+// general purpose and xmm registers share the numbers 0 to 15
+namespace x86 {
+	enum Reg {
+		rax, rcx, rdx, rbx, rsp, rbp, rsi, rdi,
+		r8, r9, r10, r11, r12, r13, r14, r15
+	};
+
+	enum Cond {
+		cc_o, cc_no, cc_b, cc_ae, cc_e, cc_ne, cc_be, cc_a,
+		cc_s, cc_ns, cc_p, cc_np, cc_l, cc_ge, cc_le, cc_g
+	};
+
+	inline Cond negate(Cond cc) { return static_cast<Cond>(cc ^ 1); }
+
+	// the extension in the reg field of the group opcodes
+	enum Alu { alu_add = 0, alu_or = 1, alu_and = 4, alu_sub = 5,
+		alu_xor = 6, alu_cmp = 7 };
+	enum Shift { shift_shl = 4, shift_shr = 5, shift_sar = 7 };
+
+	// the second opcode byte of the scalar double instructions
+	enum Sse {
+		sse_add = 0x58, sse_mul = 0x59, sse_sub = 0x5c, sse_div = 0x5e
+	};
+
+	// a register, an immediate or [base + disp]; with rip the address
+	// is disp bytes into the module data
+	struct Operand {
+		enum class Kind { reg, imm, mem, rip };
+		Kind kind;
+		int reg { 0 };
+		std::int64_t value { 0 };
+
+		static Operand r(int reg) { return { Kind::reg, reg }; }
+		static Operand imm(std::int64_t value) {
+			return { Kind::imm, 0, value };
+		}
+		static Operand mem(int base, int disp) {
+			return { Kind::mem, base, disp };
+		}
+		static Operand data(int offset) {
+			return { Kind::rip, 0, offset };
+		}
+		bool is_reg() const { return kind == Kind::reg; }
+		bool is_imm() const { return kind == Kind::imm; }
+		bool is_memory() const {
+			return kind == Kind::mem || kind == Kind::rip;
+		}
+		bool operator==(const Operand &other) const {
+			return kind == other.kind && reg == other.reg &&
+				value == other.value;
+		}
+		bool operator!=(const Operand &other) const {
+			return ! (*this == other);
+		}
+	};
+}
+
+// appends instructions to the text of a module; operand sizes are 8,
+// 32 or 64 bits; memory operands relative to rip must not be followed
+// by an immediate, their relocation expects the field at the end
+class X86_Asm {
+		Object_Code &code_;
+		std::vector<std::int64_t> labels_;
+		struct Fixup { size_t at; int label; };
+		std::vector<Fixup> fixups_;
+
+		void byte(int b) { code_.text.push_back(static_cast<std::uint8_t>(b)); }
+		void imm32(std::int64_t value);
+		void rex(int size, int reg, const x86::Operand &rm, bool force);
+		void modrm(int reg, const x86::Operand &rm);
+		// [prefix] [rex] opcode bytes modrm
+		void op(
+			int size, std::initializer_list<int> opcode, int reg,
+			const x86::Operand &rm, int prefix = 0
+		);
+		void rel32(int label);
+	public:
+		explicit X86_Asm(Object_Code &code): code_ { code } { }
+
+		size_t offset() const { return code_.text.size(); }
+
+		int new_label();
+		void bind(int label);
+		// patches the jumps; labels stay valid
+		void resolve();
+
+		void mov(int size, const x86::Operand &dst, const x86::Operand &src);
+		void movzx8(int dst, const x86::Operand &src);
+		void movsxd(int dst, const x86::Operand &src);
+		void lea(int dst, const x86::Operand &src);
+		void alu(
+			x86::Alu alu, int size, const x86::Operand &dst,
+			const x86::Operand &src
+		);
+		void test(int size, int a, int b);
+		void imul(int size, int dst, const x86::Operand &src);
+		void imul(int size, int dst, const x86::Operand &src, int value);
+		void shift(x86::Shift shift, int size, int reg, int count);
+		void shift_cl(x86::Shift shift, int size, int reg);
+		void neg(int size, int reg);
+		void cdq();
+		void idiv(int size, const x86::Operand &src);
+		void setcc(x86::Cond cc, int reg);
+		void cmov(x86::Cond cc, int size, int dst, const x86::Operand &src);
+		void push(int reg);
+		void pop(int reg);
+		void jmp(int label);
+		void jcc(x86::Cond cc, int label);
+		void call(const std::string &symbol);
+		void leave() { byte(0xc9); }
+		void ret() { byte(0xc3); }
+
+		// scalar doubles
+		void movsd(const x86::Operand &dst, const x86::Operand &src);
+		void sse(x86::Sse op, int dst, const x86::Operand &src);
+		void ucomisd(int a, const x86::Operand &b);
+		void xorpd(int dst, int src);
+		void movq_to_xmm(int dst, int src);
+};
@@ -0,0 +1,1267 @@
+#include "x86_gen.h"
+
+#include "err.h"
+#include "ir.h"
+#include "object_file.h"
+#include "run_args.h"
+#include "x86_asm.h"
+
+#include <algorithm>
+#include <climits>
+#include <cstring>
+#include <unordered_map>
+
+using namespace x86;
+
+// rax, rcx, rdx and r11 are kept free for division, shift counts,
+// addresses and moves, xmm14 and xmm15 for doubles; a value that
+// lives across a call only gets a callee saved register
+namespace {
+	constexpr int int_args[] { rdi, rsi, rdx, rcx, r8, r9 };
+	constexpr int real_args { 8 };
+	constexpr int caller_saved[] { rsi, rdi, r8, r9, r10 };
+	constexpr int callee_saved[] { rbx, r12, r13, r14, r15 };
+	constexpr int allocatable_xmms { 14 };
+	constexpr int xmm_temp { 14 };
+	constexpr int xmm_scratch { 15 };
+
+	// integers and booleans are 32 bit values, VAR parameters hold
+	// 64 bit addresses
+	enum class Class { integer, pointer, real };
+
+	struct Node {
+		Opcode opcode;
+		int result { -1 };
+		std::vector<Value::Ptr> operands;
+		std::vector<int> incoming;
+		int targets[2] { -1, -1 };
+		Binary_Op binary_op { Binary_Op::add };
+		Unary_Op unary_op { Unary_Op::neg };
+		std::string callee;
+		std::vector<bool> by_reference;
+		int pos { 0 };
+	};
+
+	class Bits {
+			std::vector<std::uint64_t> words_;
+		public:
+			explicit Bits(size_t size = 0): words_((size + 63) / 64) { }
+
+			void set(int i) { words_[i / 64] |= std::uint64_t { 1 } << i % 64; }
+			bool test(int i) const { return words_[i / 64] >> i % 64 & 1; }
+			// this = (this - removed) | added; true if anything changed
+			bool assign(
+				const Bits &from, const Bits &removed, const Bits &added
+			) {
+				bool changed { false };
+				for (size_t i { 0 }; i < words_.size(); ++i) {
+					auto word { (from.words_[i] & ~removed.words_[i]) |
+						added.words_[i] };
+					changed |= word != words_[i];
+					words_[i] = word;
+				}
+				return changed;
+			}
+			void merge(const Bits &other) {
+				for (size_t i { 0 }; i < words_.size(); ++i) {
+					words_[i] |= other.words_[i];
+				}
+			}
+			template<typename F> void each(F f) const {
+				for (size_t i { 0 }; i < words_.size(); ++i) {
+					for (auto word { words_[i] }; word; word &= word - 1) {
+						f(static_cast<int>(i * 64 + __builtin_ctzll(word)));
+					}
+				}
+			}
+	};
+
+	struct Block {
+		std::vector<Node> nodes;
+		std::vector<int> succs;
+		int start { 0 };
+		int end { 0 };
+		int label { -1 };
+		Bits use, def, phi_uses, live_in, live_out;
+	};
+
+	// one value of the function; an alloca is a slot in the frame
+	struct Vreg {
+		Class cls { Class::integer };
+		bool boolean { false };
+		bool slot { false };
+		int start { INT_MAX };
+		int end { -1 };
+		int uses { 0 };
+		Operand loc { Operand::imm(0) };
+	};
+
+	// one part of a parallel move; address moves load the address of
+	// the memory operand
+	struct Move {
+		Operand dst;
+		Operand src;
+		Class cls;
+		bool address { false };
+	};
+
+	bool is_compare(Binary_Op op) {
+		return binary_operator(op).predicate;
+	}
+
+	Class class_of(Type::Ptr type) {
+		if (type == real_type) { return Class::real; }
+		if (type == integer_type || type == boolean_type) {
+			return Class::integer;
+		}
+		throw Error { "no x86-64 type for '" + type->name() + "'" };
+	}
+
+	Alu alu_of(Binary_Op op) {
+		switch (op) {
+			case Binary_Op::sub: return alu_sub;
+			case Binary_Op::bit_and: case Binary_Op::log_and: return alu_and;
+			case Binary_Op::bit_or: case Binary_Op::log_or: return alu_or;
+			case Binary_Op::bit_xor: return alu_xor;
+			default: return alu_add;
+		}
+	}
+
+	Cond int_cond(Binary_Op op) {
+		switch (op) {
+			case Binary_Op::equal: return cc_e;
+			case Binary_Op::not_equal: return cc_ne;
+			case Binary_Op::less: return cc_l;
+			case Binary_Op::less_equal: return cc_le;
+			case Binary_Op::greater: return cc_g;
+			default: return cc_ge;
+		}
+	}
+}
+
+struct X86_Gen::State {
+	std::string source;
+	std::string path;
+	Object_Code code;
+	X86_Asm as { code };
+	std::unordered_map<Reference::Ptr, int> globals;
+
+	// the function being compiled
+	std::string name;
+	Type::Ptr returns { nullptr };
+	std::vector<Parameter> params;
+	std::vector<Block> blocks;
+	std::vector<int> layout;
+	std::unordered_map<std::string, int> block_index;
+	int current { -1 };
+	std::vector<Vreg> vregs;
+	std::vector<int> calls;
+	int slots { 0 };
+	int stack_args { 0 };
+	std::vector<int> saved;
+
+	State(std::string source, std::string path):
+		source { std::move(source) }, path { std::move(path) }
+	{ }
+
+	int block(const Label &label);
+	Vreg &vreg(Reference::Ptr ref);
+	int result(Reference::Ptr ref);
+	Node *add(Opcode opcode);
+
+	void number();
+	void live();
+	void intervals();
+	void allocate();
+	void generate();
+
+	bool crosses_call(const Vreg &v) const;
+	int new_slot() { return -8 * ++slots; }
+	int saved_slot(size_t i) const {
+		return -8 * (slots + static_cast<int>(i) + 1);
+	}
+
+	Operand operand(Value::Ptr value);
+	Operand address(Value::Ptr ptr);
+	int int_in(Value::Ptr value, int scratch);
+	int real_in(Value::Ptr value, int scratch);
+	Operand real_operand(Value::Ptr value, int scratch);
+	int target(int vreg, int scratch);
+	void set(int vreg, int reg);
+	void materialize(int xmm, std::int64_t bits);
+
+	void emit_move(const Move &move);
+	void parallel_move(std::vector<Move> moves);
+	void edge_moves(int from, int to);
+	void epilogue();
+
+	bool fusable(const Node &node, const Node *next);
+	Cond compare(const Node &node);
+	void emit_binary(const Node &node);
+	void emit_unary(const Node &node);
+	void emit_select(const Node &node);
+	void emit_call(const Node &node);
+	void emit_ret(const Node &node);
+	void emit_conditional(
+		const Node &node, int at, bool fused, Cond cc
+	);
+	void emit_jump(int at, int to);
+};
+
+int X86_Gen::State::block(const Label &label) {
+	auto [got, added] { block_index.emplace(
+		label_name(label), static_cast<int>(blocks.size())
+	) };
+	if (added) { blocks.emplace_back(); }
+	return got->second;
+}
+
+Vreg &X86_Gen::State::vreg(Reference::Ptr ref) {
+	auto index { static_cast<size_t>(ref->index()) };
+	if (index >= vregs.size()) { vregs.resize(index + 1); }
+	return vregs[index];
+}
+
+int X86_Gen::State::result(Reference::Ptr ref) {
+	auto &v { vreg(ref) };
+	v.cls = class_of(ref->type());
+	v.boolean = ref->type() == boolean_type;
+	return ref->index();
+}
+
+// instructions after a terminator are unreachable
+Node *X86_Gen::State::add(Opcode opcode) {
+	if (current < 0) { return nullptr; }
+	auto &nodes { blocks[current].nodes };
+	if (! nodes.empty() && (
+		nodes.back().opcode == Opcode::branch ||
+		nodes.back().opcode == Opcode::conditional ||
+		nodes.back().opcode == Opcode::ret
+	)) {
+		return nullptr;
+	}
+	nodes.emplace_back();
+	nodes.back().opcode = opcode;
+	return &nodes.back();
+}
+
+// phis sit at the start of their block, the moves that feed them at
+// the end of the predecessors
+void X86_Gen::State::number() {
+	int pos { 0 };
+	for (auto b : layout) {
+		auto &block { blocks[b] };
+		block.start = pos++;
+		for (auto &node : block.nodes) {
+			for (auto op : node.operands) {
+				auto ref { value_cast<Reference>(op) };
+				if (ref && ! globals.count(ref)) { vreg(ref); }
+			}
+			if (node.opcode == Opcode::phi) {
+				node.pos = block.start;
+				continue;
+			}
+			node.pos = pos++;
+			if (node.opcode == Opcode::call) {
+				calls.push_back(node.pos);
+				int ints { 0 }, reals { 0 };
+				for (size_t i { 0 }; i < node.operands.size(); ++i) {
+					auto real { ! node.by_reference[i] &&
+						node.operands[i]->type() == real_type };
+					++(real ? reals : ints);
+				}
+				stack_args = std::max(
+					stack_args, std::max(ints - 6, 0) +
+						std::max(reals - real_args, 0)
+				);
+			}
+		}
+		block.end = pos++;
+		auto term { block.nodes.empty() ? nullptr : &block.nodes.back() };
+		if (term && term->opcode == Opcode::branch) {
+			block.succs = { term->targets[0] };
+		} else if (term && term->opcode == Opcode::conditional) {
+			block.succs = { term->targets[0], term->targets[1] };
+		}
+	}
+}
+
+
+void X86_Gen::State::live() {
+	auto count { vregs.size() };
+	auto vreg_index { [&](Value::Ptr value) {
+		auto ref { value_cast<Reference>(value) };
+		if (! ref || globals.count(ref) || vreg(ref).slot) { return -1; }
+		return ref->index();
+	} };
+	for (auto b : layout) {
+		auto &block { blocks[b] };
+		block.use = block.def = block.phi_uses = Bits { count };
+		block.live_in = block.live_out = Bits { count };
+	}
+	for (auto b : layout) {
+		auto &block { blocks[b] };
+		for (auto &node : block.nodes) {
+			for (size_t i { 0 }; i < node.operands.size(); ++i) {
+				auto index { vreg_index(node.operands[i]) };
+				if (index < 0) { continue; }
+				if (node.opcode == Opcode::phi) {
+					blocks[node.incoming[i]].phi_uses.set(index);
+				} else if (! block.def.test(index)) {
+					block.use.set(index);
+				}
+			}
+			if (node.result >= 0) { block.def.set(node.result); }
+		}
+	}
+	Bits out { count };
+	for (bool changed { true }; changed; ) {
+		changed = false;
+		for (auto b { layout.rbegin() }; b != layout.rend(); ++b) {
+			auto &block { blocks[*b] };
+			out = block.phi_uses;
+			for (auto s : block.succs) { out.merge(blocks[s].live_in); }
+			block.live_out = out;
+			changed |= block.live_in.assign(out, block.def, block.use);
+		}
+	}
+}
+
+// one range from the first to the last position a value is live; a
+// phi is also written at the end of its predecessors
+void X86_Gen::State::intervals() {
+	auto extend { [&](int index, int pos) {
+		auto &v { vregs[index] };
+		v.start = std::min(v.start, pos);
+		v.end = std::max(v.end, pos);
+	} };
+	for (const auto &param : params) { extend(param.ref->index(), 0); }
+	for (auto b : layout) {
+		auto &block { blocks[b] };
+		block.live_in.each([&](int v) { extend(v, block.start); });
+		block.live_out.each([&](int v) { extend(v, block.end); });
+		for (auto &node : block.nodes) {
+			if (node.result >= 0) { extend(node.result, node.pos); }
+			for (size_t i { 0 }; i < node.operands.size(); ++i) {
+				auto ref { value_cast<Reference>(node.operands[i]) };
+				if (! ref || globals.count(ref)) { continue; }
+				auto &v { vreg(ref) };
+				++v.uses;
+				if (v.slot) { continue; }
+				extend(ref->index(), node.opcode == Opcode::phi ?
+					blocks[node.incoming[i]].end : node.pos
+				);
+			}
+			if (node.opcode == Opcode::phi) {
+				for (auto from : node.incoming) {
+					extend(node.result, blocks[from].end);
+				}
+			}
+		}
+	}
+}
+
+bool X86_Gen::State::crosses_call(const Vreg &v) const {
+	auto call { std::upper_bound(calls.begin(), calls.end(), v.start) };
+	return call != calls.end() && *call < v.end;
+}
+
+// linear scan; intervals that touch conflict, so a result never
+// shares its register with an operand of the same instruction; when
+// registers run out the interval that ends last goes to the frame
+void X86_Gen::State::allocate() {
+	std::vector<int> order;
+	for (size_t i { 0 }; i < vregs.size(); ++i) {
+		if (vregs[i].end >= 0 && ! vregs[i].slot) { order.push_back(i); }
+	}
+	std::sort(order.begin(), order.end(), [&](int a, int b) {
+		return vregs[a].start != vregs[b].start ?
+			vregs[a].start < vregs[b].start : a < b;
+	});
+	bool free_int[16] { }, free_real[16] { };
+	for (auto reg : caller_saved) { free_int[reg] = true; }
+	for (auto reg : callee_saved) { free_int[reg] = true; }
+	for (int reg { 0 }; reg < allocatable_xmms; ++reg) {
+		free_real[reg] = true;
+	}
+	auto free_of { [&](const Vreg &v) {
+		return v.cls == Class::real ? free_real : free_int;
+	} };
+
+	std::vector<int> active;
+	int allowed[16];
+	for (auto i : order) {
+		auto &v { vregs[i] };
+		active.erase(std::remove_if(
+			active.begin(), active.end(), [&](int a) {
+				if (vregs[a].end >= v.start) { return false; }
+				free_of(vregs[a])[vregs[a].loc.reg] = true;
+				return true;
+			}
+		), active.end());
+
+		int count { 0 };
+		auto crosses { crosses_call(v) };
+		if (v.cls == Class::real) {
+			for (int reg { 0 }; ! crosses && reg < allocatable_xmms; ++reg) {
+				allowed[count++] = reg;
+			}
+		} else {
+			for (auto reg : caller_saved) {
+				if (! crosses) { allowed[count++] = reg; }
+			}
+			for (auto reg : callee_saved) { allowed[count++] = reg; }
+		}
+		auto free { free_of(v) };
+		auto reg { -1 };
+		for (int j { 0 }; j < count && reg < 0; ++j) {
+			if (free[allowed[j]]) { reg = allowed[j]; }
+		}
+		if (reg >= 0) {
+			free[reg] = false;
+		} else {
+			auto victim { active.end() };
+			for (auto a { active.begin() }; a != active.end(); ++a) {
+				auto &other { vregs[*a] };
+				if ((other.cls == Class::real) != (v.cls == Class::real)) {
+					continue;
+				}
+				if (std::find(allowed, allowed + count, other.loc.reg) ==
+					allowed + count
+				) {
+					continue;
+				}
+				if (victim == active.end() || other.end > vregs[*victim].end) {
+					victim = a;
+				}
+			}
+			if (victim == active.end() || vregs[*victim].end <= v.end) {
+				v.loc = Operand::mem(rbp, new_slot());
+				continue;
+			}
+			reg = vregs[*victim].loc.reg;
+			vregs[*victim].loc = Operand::mem(rbp, new_slot());
+			active.erase(victim);
+		}
+		v.loc = Operand::r(reg);
+		active.push_back(i);
+		if (v.cls != Class::real && std::count(
+			std::begin(callee_saved), std::end(callee_saved), reg
+		) && ! std::count(saved.begin(), saved.end(), reg)) {
+			saved.push_back(reg);
+		}
+	}
+}
+
+Operand X86_Gen::State::operand(Value::Ptr value) {
+	switch (value->kind()) {
+		case Value_Kind::int_literal:
+			return Operand::imm(value_cast<Integer_Literal>(value)->value());
+		case Value_Kind::bool_literal:
+			return Operand::imm(value_cast<Bool_Literal>(value)->value());
+		case Value_Kind::real_literal: {
+			auto real { value_cast<Real_Literal>(value)->value() };
+			std::int64_t bits;
+			std::memcpy(&bits, &real, sizeof(bits));
+			return Operand::imm(bits);
+		}
+		case Value_Kind::reference:
+			break;
+	}
+	return vreg(static_cast<Reference *>(value)).loc;
+}
+
+// the memory of a variable; addresses in the frame are loaded to r11
+Operand X86_Gen::State::address(Value::Ptr ptr) {
+	auto ref { static_cast<Reference *>(ptr) };
+	auto global { globals.find(ref) };
+	if (global != globals.end()) { return Operand::data(global->second); }
+	auto &v { vreg(ref) };
+	if (v.slot) { return v.loc; }
+	if (v.loc.is_reg()) { return Operand::mem(v.loc.reg, 0); }
+	as.mov(64, Operand::r(r11), v.loc);
+	return Operand::mem(r11, 0);
+}
+
+void X86_Gen::State::materialize(int xmm, std::int64_t bits) {
+	as.mov(64, Operand::r(rax), Operand::imm(bits));
+	as.movq_to_xmm(xmm, rax);
+}
+
+int X86_Gen::State::int_in(Value::Ptr value, int scratch) {
+	auto op { operand(value) };
+	if (op.is_reg()) { return op.reg; }
+	as.mov(32, Operand::r(scratch), op);
+	return scratch;
+}
+
+int X86_Gen::State::real_in(Value::Ptr value, int scratch) {
+	auto op { operand(value) };
+	if (op.is_reg()) { return op.reg; }
+	if (op.is_imm()) {
+		materialize(scratch, op.value);
+	} else {
+		as.movsd(Operand::r(scratch), op);
+	}
+	return scratch;
+}
+
+Operand X86_Gen::State::real_operand(Value::Ptr value, int scratch) {
+	auto op { operand(value) };
+	if (! op.is_imm()) { return op; }
+	materialize(scratch, op.value);
+	return Operand::r(scratch);
+}
+
+// the register to compute a result in
+int X86_Gen::State::target(int vreg, int scratch) {
+	auto &loc { vregs[vreg].loc };
+	return loc.is_reg() ? loc.reg : scratch;
+}
+
+void X86_Gen::State::set(int vreg, int reg) {
+	auto &v { vregs[vreg] };
+	if (v.loc == Operand::r(reg)) { return; }
+	if (v.cls == Class::real) {
+		as.movsd(v.loc, Operand::r(reg));
+	} else {
+		as.mov(v.cls == Class::pointer ? 64 : 32, v.loc, Operand::r(reg));
+	}
+}
+
+// rax carries values between two memory operands
+void X86_Gen::State::emit_move(const Move &move) {
+	auto &[dst, src, cls, address] { move };
+	auto temp { Operand::r(rax) };
+	if (address) {
+		as.lea(dst.is_reg() ? dst.reg : rax, src);
+		if (! dst.is_reg()) { as.mov(64, dst, temp); }
+	} else if (cls == Class::real) {
+		if (src.is_imm()) {
+			as.mov(64, temp, src);
+			if (dst.is_reg()) {
+				as.movq_to_xmm(dst.reg, rax);
+			} else {
+				as.mov(64, dst, temp);
+			}
+		} else if (dst.is_memory() && src.is_memory()) {
+			as.movsd(Operand::r(xmm_temp), src);
+			as.movsd(dst, Operand::r(xmm_temp));
+		} else {
+			as.movsd(dst, src);
+		}
+	} else {
+		auto size { cls == Class::pointer ? 64 : 32 };
+		if (dst.is_memory() && src.is_memory()) {
+			as.mov(size, temp, src);
+			as.mov(size, dst, temp);
+		} else {
+			as.mov(size, dst, src);
+		}
+	}
+}
+
+// a move is done once no other move still reads its destination;
+// when only cycles are left one destination is saved in r11 or xmm15
+void X86_Gen::State::parallel_move(std::vector<Move> moves) {
+	auto reads { [](const Move &move, const Operand &loc) {
+		return ! move.address && ! move.src.is_imm() && move.src == loc;
+	} };
+	moves.erase(std::remove_if(
+		moves.begin(), moves.end(), [&](const Move &move) {
+			return reads(move, move.dst);
+		}
+	), moves.end());
+	while (! moves.empty()) {
+		auto ready { std::find_if(
+			moves.begin(), moves.end(), [&](const Move &move) {
+				return std::none_of(
+					moves.begin(), moves.end(), [&](const Move &other) {
+						return reads(other, move.dst);
+					}
+				);
+			}
+		) };
+		if (ready != moves.end()) {
+			emit_move(*ready);
+			moves.erase(ready);
+			continue;
+		}
+		auto blocked { moves.front().dst };
+		auto reader { std::find_if(
+			moves.begin(), moves.end(), [&](const Move &move) {
+				return reads(move, blocked);
+			}
+		) };
+		auto scratch { Operand::r(
+			reader->cls == Class::real ? xmm_scratch : r11
+		) };
+		emit_move({ scratch, blocked, reader->cls });
+		for (auto &move : moves) {
+			if (reads(move, blocked)) { move.src = scratch; }
+		}
+	}
+}
+
+void X86_Gen::State::edge_moves(int from, int to) {
+	std::vector<Move> moves;
+	for (auto &node : blocks[to].nodes) {
+		if (node.opcode != Opcode::phi) { break; }
+		auto &v { vregs[node.result] };
+		if (! v.uses) { continue; }
+		for (size_t i { 0 }; i < node.incoming.size(); ++i) {
+			if (node.incoming[i] == from) {
+				moves.push_back({ v.loc, operand(node.operands[i]), v.cls });
+			}
+		}
+	}
+	parallel_move(std::move(moves));
+}
+
+void X86_Gen::State::emit_jump(int at, int to) {
+	if (at + 1 < static_cast<int>(layout.size()) && layout[at + 1] == to) {
+		return;
+	}
+	as.jmp(blocks[to].label);
+}
+
+void X86_Gen::State::epilogue() {
+	for (size_t i { 0 }; i < saved.size(); ++i) {
+		as.mov(
+			64, Operand::r(saved[i]), Operand::mem(rbp, saved_slot(i))
+		);
+	}
+	as.leave();
+	as.ret();
+}
+
+// a comparison that only feeds the branch right after it leaves its
+// result in the flags
+bool X86_Gen::State::fusable(const Node &node, const Node *next) {
+	if (! is_compare(node.binary_op) || ! next ||
+		next->opcode != Opcode::conditional
+	) {
+		return false;
+	}
+	auto condition { value_cast<Reference>(next->operands[0]) };
+	return condition && condition->index() == node.result &&
+		vregs[node.result].uses == 1 && ! (
+			node.operands[0]->type() == real_type &&
+			node.binary_op == Binary_Op::equal
+		);
+}
+
+// sets the flags and returns the condition that holds; ordered
+// equality of doubles needs the parity flag as well
+Cond X86_Gen::State::compare(const Node &node) {
+	auto op { node.binary_op };
+	auto left { node.operands[0] };
+	auto right { node.operands[1] };
+	if (left->type() == real_type) {
+		if (op == Binary_Op::less || op == Binary_Op::less_equal) {
+			std::swap(left, right);
+		}
+		as.ucomisd(
+			real_in(left, xmm_scratch), real_operand(right, xmm_temp)
+		);
+		switch (op) {
+			case Binary_Op::equal: return cc_e;
+			case Binary_Op::not_equal: return cc_ne;
+			case Binary_Op::less: case Binary_Op::greater: return cc_a;
+			default: return cc_ae;
+		}
+	}
+	auto a { operand(left) };
+	auto b { operand(right) };
+	if (a.is_imm() || (a.is_memory() && b.is_memory())) {
+		as.mov(32, Operand::r(r11), a);
+		a = Operand::r(r11);
+	}
+	as.alu(alu_cmp, 32, a, b);
+	return int_cond(op);
+}
+
+void X86_Gen::State::emit_binary(const Node &node) {
+	auto op { node.binary_op };
+	auto left { node.operands[0] };
+	auto right { node.operands[1] };
+	auto result { node.result };
+	if (is_compare(op)) {
+		auto cc { compare(node) };
+		auto w { target(result, rax) };
+		as.setcc(cc, w);
+		as.movzx8(w, Operand::r(w));
+		if (left->type() == real_type && op == Binary_Op::equal) {
+			as.setcc(cc_np, r11);
+			as.movzx8(r11, Operand::r(r11));
+			as.alu(alu_and, 32, Operand::r(w), Operand::r(r11));
+		}
+		set(result, w);
+		return;
+	}
+	if (left->type() == real_type) {
+		auto w { target(result, xmm_scratch) };
+		auto l { operand(left) };
+		if (l.is_imm()) {
+			materialize(w, l.value);
+		} else {
+			as.movsd(Operand::r(w), l);
+		}
+		auto r { real_operand(right, xmm_temp) };
+		switch (op) {
+			case Binary_Op::add: as.sse(sse_add, w, r); break;
+			case Binary_Op::sub: as.sse(sse_sub, w, r); break;
+			case Binary_Op::mul: as.sse(sse_mul, w, r); break;
+			default:
+				throw Error {
+					std::string { "no x86-64 instruction for REAL " } +
+					binary_operator(op).name
+				};
+		}
+		set(result, w);
+		return;
+	}
+	auto w { target(result, rax) };
+	auto l { operand(left) };
+	auto r { operand(right) };
+	switch (op) {
+		case Binary_Op::quot:
+		case Binary_Op::rem:
+			// idiv traps on the smallest INTEGER by -1, which wraps
+			if (r.is_imm() && r.value == -1) {
+				if (op == Binary_Op::quot) {
+					as.mov(32, Operand::r(w), l);
+					as.neg(32, w);
+				} else {
+					as.mov(32, Operand::r(w), Operand::imm(0));
+				}
+				break;
+			}
+			as.mov(32, Operand::r(rax), l);
+			as.cdq();
+			if (r.is_imm()) {
+				as.mov(32, Operand::r(r11), r);
+				r = Operand::r(r11);
+			}
+			as.idiv(32, r);
+			set(result, op == Binary_Op::quot ? rax : rdx);
+			return;
+		case Binary_Op::mul_high: {
+			auto widen { [&](int reg, const Operand &value) {
+				if (value.is_imm()) {
+					as.mov(64, Operand::r(reg), value);
+				} else {
+					as.movsxd(reg, value);
+				}
+			} };
+			widen(rax, l);
+			widen(r11, r);
+			as.imul(64, rax, Operand::r(r11));
+			as.shift(shift_sar, 64, rax, 32);
+			set(result, rax);
+			return;
+		}
+		case Binary_Op::shl:
+		case Binary_Op::ashr:
+		case Binary_Op::lshr: {
+			auto shift { op == Binary_Op::shl ? shift_shl :
+				op == Binary_Op::ashr ? shift_sar : shift_shr };
+			if (r.is_imm()) {
+				as.mov(32, Operand::r(w), l);
+				as.shift(shift, 32, w, r.value & 31);
+			} else {
+				as.mov(32, Operand::r(rcx), r);
+				as.mov(32, Operand::r(w), l);
+				as.shift_cl(shift, 32, w);
+			}
+			break;
+		}
+		case Binary_Op::mul:
+			if (l.is_imm()) { std::swap(l, r); }
+			if (r.is_imm()) {
+				if (l.is_imm()) {
+					as.mov(32, Operand::r(w), l);
+					l = Operand::r(w);
+				}
+				as.imul(32, w, l, r.value);
+			} else {
+				as.mov(32, Operand::r(w), l);
+				as.imul(32, w, r);
+			}
+			break;
+		case Binary_Op::add:
+		case Binary_Op::sub:
+		case Binary_Op::bit_and:
+		case Binary_Op::bit_or:
+		case Binary_Op::bit_xor:
+		case Binary_Op::log_and:
+		case Binary_Op::log_or:
+			as.mov(32, Operand::r(w), l);
+			as.alu(alu_of(op), 32, Operand::r(w), r);
+			break;
+		default:
+			throw Error {
+				std::string { "no x86-64 instruction for " } +
+				binary_operator(op).name
+			};
+	}
+	set(result, w);
+}
+
+void X86_Gen::State::emit_unary(const Node &node) {
+	auto value { node.operands[0] };
+	if (value->type() == real_type) {
+		auto w { target(node.result, xmm_scratch) };
+		materialize(xmm_temp, INT64_MIN);
+		auto v { operand(value) };
+		if (v.is_imm()) {
+			materialize(w, v.value);
+		} else {
+			as.movsd(Operand::r(w), v);
+		}
+		as.xorpd(w, xmm_temp);
+		set(node.result, w);
+		return;
+	}
+	auto w { target(node.result, rax) };
+	as.mov(32, Operand::r(w), operand(value));
+	if (node.unary_op == Unary_Op::log_not) {
+		as.alu(alu_xor, 32, Operand::r(w), Operand::imm(1));
+	} else {
+		as.neg(32, w);
+	}
+	set(node.result, w);
+}
+
+// integers use a conditional move, doubles a short branch
+void X86_Gen::State::emit_select(const Node &node) {
+	auto condition { operand(node.operands[0]) };
+	auto if_true { node.operands[1] };
+	auto if_false { node.operands[2] };
+	auto result { node.result };
+	auto real { vregs[result].cls == Class::real };
+	if (condition.is_imm()) {
+		auto chosen { condition.value ? if_true : if_false };
+		auto w { target(result, real ? xmm_scratch : rax) };
+		if (real) {
+			as.movsd(Operand::r(w), real_operand(chosen, w));
+		} else {
+			as.mov(32, Operand::r(w), operand(chosen));
+		}
+		set(result, w);
+		return;
+	}
+	if (real) {
+		auto w { target(result, xmm_scratch) };
+		auto t { real_operand(if_true, xmm_temp) };
+		auto f { operand(if_false) };
+		if (f.is_imm()) {
+			materialize(w, f.value);
+		} else {
+			as.movsd(Operand::r(w), f);
+		}
+		as.alu(alu_cmp, 32, condition, Operand::imm(0));
+		auto skip { as.new_label() };
+		as.jcc(cc_e, skip);
+		as.movsd(Operand::r(w), t);
+		as.bind(skip);
+		set(result, w);
+		return;
+	}
+	auto t { operand(if_true) };
+	if (t.is_imm()) {
+		as.mov(32, Operand::r(r11), t);
+		t = Operand::r(r11);
+	}
+	auto w { target(result, rax) };
+	as.alu(alu_cmp, 32, condition, Operand::imm(0));
+	as.mov(32, Operand::r(w), operand(if_false));
+	as.cmov(cc_ne, 32, w, t);
+	set(result, w);
+}
+
+// values that live across the call are in callee saved registers or
+// in the frame, so the argument registers are free
+void X86_Gen::State::emit_call(const Node &node) {
+	std::vector<Move> moves;
+	int ints { 0 }, reals { 0 }, stack { 0 };
+	for (size_t i { 0 }; i < node.operands.size(); ++i) {
+		auto value { node.operands[i] };
+		Move move { Operand::imm(0), Operand::imm(0), Class::integer };
+		if (node.by_reference[i]) {
+			auto ref { static_cast<Reference *>(value) };
+			auto global { globals.find(ref) };
+			move.cls = Class::pointer;
+			if (global != globals.end()) {
+				move.src = Operand::data(global->second);
+				move.address = true;
+			} else {
+				move.src = vreg(ref).loc;
+				move.address = vreg(ref).slot;
+			}
+		} else {
+			move.cls = class_of(value->type());
+			move.src = operand(value);
+		}
+		if (move.cls == Class::real && reals < real_args) {
+			move.dst = Operand::r(reals++);
+		} else if (move.cls != Class::real && ints < 6) {
+			move.dst = Operand::r(int_args[ints++]);
+		} else {
+			move.dst = Operand::mem(rsp, 8 * stack++);
+		}
+		moves.push_back(move);
+	}
+	parallel_move(std::move(moves));
+	as.call(node.callee);
+	if (node.result >= 0) { set(node.result, rax); }
+}
+
+void X86_Gen::State::emit_ret(const Node &node) {
+	if (! node.operands.empty()) {
+		auto value { node.operands[0] };
+		if (value->type() == real_type) {
+			auto v { operand(value) };
+			if (v.is_imm()) {
+				materialize(0, v.value);
+			} else {
+				as.movsd(Operand::r(0), v);
+			}
+		} else {
+			as.mov(32, Operand::r(rax), operand(value));
+		}
+	}
+	epilogue();
+}
+
+// edges into blocks with phis get their moves on their own path
+void X86_Gen::State::emit_conditional(
+	const Node &node, int at, bool fused, Cond cc
+) {
+	auto from { layout[at] };
+	auto if_true { node.targets[0] };
+	auto if_false { node.targets[1] };
+	if (! fused) {
+		auto condition { operand(node.operands[0]) };
+		if (condition.is_imm()) {
+			auto to { condition.value ? if_true : if_false };
+			edge_moves(from, to);
+			emit_jump(at, to);
+			return;
+		}
+		as.alu(alu_cmp, 32, condition, Operand::imm(0));
+		cc = cc_ne;
+	}
+	auto has_phis { [&](int b) {
+		auto &nodes { blocks[b].nodes };
+		return ! nodes.empty() && nodes.front().opcode == Opcode::phi;
+	} };
+	if (! has_phis(if_true) && ! has_phis(if_false)) {
+		auto next { at + 1 < static_cast<int>(layout.size()) ?
+			layout[at + 1] : -1 };
+		if (if_true == next) {
+			as.jcc(negate(cc), blocks[if_false].label);
+		} else {
+			as.jcc(cc, blocks[if_true].label);
+			emit_jump(at, if_false);
+		}
+		return;
+	}
+	auto other { as.new_label() };
+	as.jcc(negate(cc), other);
+	edge_moves(from, if_true);
+	as.jmp(blocks[if_true].label);
+	as.bind(other);
+	edge_moves(from, if_false);
+	emit_jump(at, if_false);
+}
+
+// frame: saved rbp, the allocas and spill slots, the saved callee
+// saved registers and the outgoing stack arguments
+void X86_Gen::State::generate() {
+	auto start { as.offset() };
+	for (auto b : layout) { blocks[b].label = as.new_label(); }
+	auto frame { 8 * (slots + static_cast<int>(saved.size()) + stack_args) };
+	frame = (frame + 15) & ~15;
+	as.push(rbp);
+	as.mov(64, Operand::r(rbp), Operand::r(rsp));
+	if (frame) { as.alu(alu_sub, 64, Operand::r(rsp), Operand::imm(frame)); }
+	for (size_t i { 0 }; i < saved.size(); ++i) {
+		as.mov(
+			64, Operand::mem(rbp, saved_slot(i)), Operand::r(saved[i])
+		);
+	}
+
+	std::vector<Move> moves;
+	int ints { 0 }, reals { 0 }, stack { 0 };
+	for (const auto &param : params) {
+		auto &v { vreg(param.ref) };
+		auto real { v.cls == Class::real };
+		Operand src { Operand::mem(rbp, 16 + 8 * stack) };
+		if (real && reals < real_args) {
+			src = Operand::r(reals++);
+		} else if (! real && ints < 6) {
+			src = Operand::r(int_args[ints++]);
+		} else {
+			++stack;
+		}
+		if (v.uses) { moves.push_back({ v.loc, src, v.cls }); }
+	}
+	parallel_move(std::move(moves));
+
+	for (size_t at { 0 }; at < layout.size(); ++at) {
+		auto &block { blocks[layout[at]] };
+		as.bind(block.label);
+		auto &nodes { block.nodes };
+		for (size_t i { 0 }; i < nodes.size(); ++i) {
+			auto &node { nodes[i] };
+			switch (node.opcode) {
+				case Opcode::alloca:
+				case Opcode::phi:
+					break;
+				case Opcode::load: {
+					auto addr { address(node.operands[0]) };
+					auto &v { vregs[node.result] };
+					auto w { target(
+						node.result, v.cls == Class::real ? xmm_scratch : rax
+					) };
+					if (v.cls == Class::real) {
+						as.movsd(Operand::r(w), addr);
+					} else if (v.boolean) {
+						as.movzx8(w, addr);
+					} else {
+						as.mov(32, Operand::r(w), addr);
+					}
+					set(node.result, w);
+					break;
+				}
+				case Opcode::store: {
+					auto addr { address(node.operands[1]) };
+					auto value { node.operands[0] };
+					if (value->type() == real_type) {
+						as.movsd(addr, Operand::r(real_in(value, xmm_scratch)));
+						break;
+					}
+					auto size { value->type() == boolean_type ? 8 : 32 };
+					auto v { operand(value) };
+					if (! v.is_imm() || addr.kind == Operand::Kind::rip) {
+						v = Operand::r(int_in(value, rax));
+					}
+					as.mov(size, addr, v);
+					break;
+				}
+				case Opcode::unary:
+					emit_unary(node);
+					break;
+				case Opcode::binary: {
+					auto next {
+					i + 1 < nodes.size() ? &nodes[i + 1] : nullptr
+				};
+					if (fusable(node, next)) {
+						emit_conditional(*next, at, true, compare(node));
+						++i;
+					} else {
+						emit_binary(node);
+					}
+					break;
+				}
+				case Opcode::select:
+					emit_select(node);
+					break;
+				case Opcode::call:
+					emit_call(node);
+					break;
+				case Opcode::branch:
+					edge_moves(layout[at], node.targets[0]);
+					emit_jump(at, node.targets[0]);
+					break;
+				case Opcode::conditional:
+					emit_conditional(node, at, false, cc_ne);
+					break;
+				case Opcode::ret:
+					emit_ret(node);
+					break;
+			}
+		}
+	}
+	as.resolve();
+	Object_Code::Function fn { name, start, as.offset() - start };
+	for (const auto &param : params) {
+		fn.params.push_back(param.by_reference ?
+			Object_Code::Value_Class::address :
+			value_class(param.ref->type())
+		);
+	}
+	fn.result = value_class(returns);
+	code.functions.push_back(std::move(fn));
+}
+
+X86_Gen::X86_Gen(std::string source, std::string path):
+	state_ { std::make_unique<State>(std::move(source), std::move(path)) }
+{ }
+
+X86_Gen::~X86_Gen() { }
+
+void X86_Gen::define(
+	std::string_view name, Type::Ptr returns,
+	const std::vector<Parameter> &params, bool
+) {
+	auto &s { *state_ };
+	s.name = name;
+	s.returns = returns;
+	s.params = params;
+	s.blocks.clear();
+	s.layout.clear();
+	s.block_index.clear();
+	s.current = -1;
+	s.vregs.clear();
+	s.calls.clear();
+	s.slots = s.stack_args = 0;
+	s.saved.clear();
+	if (returns) { class_of(returns); }
+	for (const auto &param : params) {
+		auto index { s.result(param.ref) };
+		if (param.by_reference) { s.vregs[index].cls = Class::pointer; }
+	}
+}
+
+void X86_Gen::end_define() {
+	auto &s { *state_ };
+	s.number();
+	s.live();
+	s.intervals();
+	s.allocate();
+	s.generate();
+	s.name.clear();
+	s.current = -1;
+}
+
+void X86_Gen::def_label(const Label &label) {
+	auto &s { *state_ };
+	s.current = s.block(label);
+	s.layout.push_back(s.current);
+}
+
+void X86_Gen::branch(const Label &label) {
+	auto &s { *state_ };
+	auto target { s.block(label) };
+	if (auto node { s.add(Opcode::branch) }) { node->targets[0] = target; }
+}
+
+void X86_Gen::conditional(
+	Value::Ptr value, const Label &true_label, const Label &false_label
+) {
+	auto &s { *state_ };
+	auto if_true { s.block(true_label) };
+	auto if_false { s.block(false_label) };
+	if (auto node { s.add(Opcode::conditional) }) {
+		node->operands = { value };
+		node->targets[0] = if_true;
+		node->targets[1] = if_false;
+	}
+}
+
+void X86_Gen::ret() { state_->add(Opcode::ret); }
+
+void X86_Gen::ret(Value::Ptr value) {
+	if (auto node { state_->add(Opcode::ret) }) { node->operands = { value }; }
+}
+
+// module variables get 8 bytes each in the zeroed data
+void X86_Gen::alloca(Reference::Ptr ref) {
+	auto &s { *state_ };
+	class_of(ref->type());
+	if (s.name.empty()) {
+		s.globals[ref] = s.code.data_size;
+		s.code.data_size += 8;
+		return;
+	}
+	auto &v { s.vreg(ref) };
+	v.slot = true;
+	v.loc = Operand::mem(rbp, s.new_slot());
+}
+
+void X86_Gen::load(Reference::Ptr result, Reference::Ptr ptr) {
+	auto &s { *state_ };
+	if (auto node { s.add(Opcode::load) }) {
+		node->result = s.result(result);
+		node->operands = { ptr };
+	}
+}
+
+void X86_Gen::store(Value::Ptr value, Reference::Ptr ptr) {
+	if (auto node { state_->add(Opcode::store) }) {
+		node->operands = { value, ptr };
+	}
+}
+
+void X86_Gen::unary(Reference::Ptr result, Unary_Op op, Value::Ptr value) {
+	auto &s { *state_ };
+	if (auto node { s.add(Opcode::unary) }) {
+		node->result = s.result(result);
+		node->unary_op = op;
+		node->operands = { value };
+	}
+}
+
+void X86_Gen::binary(
+	Reference::Ptr result, Binary_Op op, Value::Ptr left, Value::Ptr right
+) {
+	auto &s { *state_ };
+	if (auto node { s.add(Opcode::binary) }) {
+		node->result = s.result(result);
+		node->binary_op = op;
+		node->operands = { left, right };
+	}
+}
+
+void X86_Gen::phi(
+	Reference::Ptr result,
+	const std::vector<std::pair<Value::Ptr, Label>> &incoming
+) {
+	auto &s { *state_ };
+	std::vector<int> from;
+	for (const auto &entry : incoming) {
+		from.push_back(s.block(entry.second));
+	}
+	if (auto node { s.add(Opcode::phi) }) {
+		node->result = s.result(result);
+		for (const auto &entry : incoming) {
+			node->operands.push_back(entry.first);
+		}
+		node->incoming = std::move(from);
+	}
+}
+
+void X86_Gen::select(
+	Reference::Ptr result, Value::Ptr condition,
+	Value::Ptr if_true, Value::Ptr if_false
+) {
+	auto &s { *state_ };
+	if (auto node { s.add(Opcode::select) }) {
+		node->result = s.result(result);
+		node->operands = { condition, if_true, if_false };
+	}
+}
+
+void X86_Gen::call(
+	Reference::Ptr result, std::string_view name,
+	const std::vector<Argument> &args
+) {
+	auto &s { *state_ };
+	if (auto node { s.add(Opcode::call) }) {
+		if (result) { node->result = s.result(result); }
+		node->callee = name;
+		for (const auto &arg : args) {
+			node->operands.push_back(arg.value);
+			node->by_reference.push_back(arg.by_reference);
+		}
+	}
+}
+
+void X86_Gen::finish() {
+	auto &s { *state_ };
+	if (! s.path.empty()) { write_object_file(s.code, s.path, s.source); }
+}
+
+const Object_Code &X86_Gen::code() const { return state_->code; }
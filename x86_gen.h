@@ -0,0 +1,59 @@
+#pragma once
+
+#include "gen.h"
+#include "object_file.h"
+
+#include <memory>
+#include <string>
+
+// compiles each function to x86-64 code for the System V ABI without
+// LLVM: instructions are selected one by one, values get registers
+// by linear scan over their live intervals; finish() writes the
+// module as a relocatable ELF object unless the path is empty
+class X86_Gen: public Gen {
+		struct State;
+		std::unique_ptr<State> state_;
+	public:
+		X86_Gen(std::string source, std::string path);
+		~X86_Gen();
+
+		void define(
+			std::string_view name, Type::Ptr returns,
+			const std::vector<Parameter> &params, bool inline_hint
+		) override;
+		void end_define() override;
+		void def_label(const Label &label) override;
+		void branch(const Label &label) override;
+		void conditional(
+			Value::Ptr value, const Label &true_label,
+			const Label &false_label
+		) override;
+		void ret() override;
+		void ret(Value::Ptr value) override;
+		void alloca(Reference::Ptr ref) override;
+		void load(Reference::Ptr result, Reference::Ptr ptr) override;
+		void store(Value::Ptr value, Reference::Ptr ptr) override;
+		void unary(
+			Reference::Ptr result, Unary_Op op, Value::Ptr value
+		) override;
+		void binary(
+			Reference::Ptr result, Binary_Op op,
+			Value::Ptr left, Value::Ptr right
+		) override;
+		void phi(
+			Reference::Ptr result,
+			const std::vector<std::pair<Value::Ptr, Label>> &incoming
+		) override;
+		void select(
+			Reference::Ptr result, Value::Ptr condition,
+			Value::Ptr if_true, Value::Ptr if_false
+		) override;
+		void call(
+			Reference::Ptr result, std::string_view name,
+			const std::vector<Argument> &args
+		) override;
+		void finish() override;
+
+		// the machine code of the functions defined so far
+		const Object_Code &code() const;
+};